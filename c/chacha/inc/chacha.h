@@ -1,7 +1,14 @@
 #pragma once
+
+#include <stdbool.h>
+
 #include "util.h"
+#include "poly1305.h"
 
 // ChaCha Cipher Tunables
+// These select the default variant used by chacha_init and the one-shot
+// crypt functions. Other variants are selected at runtime with
+// chacha_init_variant.
 
 // Key size (in bytes) to use for ChaCha cipher.
 // MUST be 16 or 32.
@@ -10,8 +17,7 @@
 // Number of ChaCha round operations to perform when
 // generating keystream blocks. More rounds offer
 // higher security at the cost of lower performance.
-// MUST be a integer value greater than 0.
-// Common values are 8, 12, or 20.
+// MUST be 8, 12, or 20.
 #define CHACHA_ROUNDS 20
 
 // Number of bytes to reserve for the ChaCha cipher
@@ -30,20 +36,104 @@
 // MUST be 16.
 #define CHACHA_STATE_WORDS 16
 
+// ChaCha cipher variant parameters
+typedef struct chacha_variant
+{
+    // Number of rounds (8, 12, or 20)
+    size_t rounds;
+
+    // Key size (in bytes) (16 or 32)
+    size_t key_size;
+
+    // Stream counter size (in bytes) (4, 8, or 16)
+    size_t counter_size;
+} chacha_variant;
+
+// Variant selected by the tunables above
+extern const chacha_variant CHACHA_VARIANT_DEFAULT;
+
+// ChaCha8 with a 256-bit key (fast keystream, not for data at rest)
+extern const chacha_variant CHACHA_VARIANT_CHACHA8;
+
+// ChaCha12 with a 256-bit key
+extern const chacha_variant CHACHA_VARIANT_CHACHA12;
+
+// ChaCha20 with a 256-bit key
+extern const chacha_variant CHACHA_VARIANT_CHACHA20;
+
+// Keystream prefetch ring (opaque, see chacha_prefetch_start)
+typedef struct chacha_prefetch chacha_prefetch;
+
 // ChaCha cipher context structure
 typedef struct chacha_ctx
 {
     u32 state[CHACHA_STATE_WORDS];
     u32 stream[CHACHA_STATE_WORDS];
     size_t index;
+    size_t rounds;
+    size_t counter_words;
+
+    // Keystream prefetch ring (NULL unless prefetching)
+    chacha_prefetch* prefetch;
 } chacha_ctx;
 
-// Set initial state for ChaCha cipher context
+// Keystream prefetch counters (in keystream blocks)
+typedef struct chacha_prefetch_stats
+{
+    // Blocks crypted with prefetched keystream
+    u64 hits;
+
+    // Blocks generated inline because the ring ran dry
+    u64 misses;
+
+    // Prefetched blocks dropped after a seek or miss moved the stream
+    u64 discarded;
+} chacha_prefetch_stats;
+
+// Scatter-gather segment of a batch crypt message
+typedef struct chacha_segment
+{
+    // Segment data to crypt (may alias output)
+    const void* input;
+
+    // Crypted segment data
+    void* output;
+
+    // Size (in bytes) of the segment
+    size_t size;
+} chacha_segment;
+
+// Independent message of a batch crypt operation
+typedef struct chacha_job
+{
+    // Key to crypt the message with (CHACHA_KEY_SIZE bytes)
+    const u8* key;
+
+    // Nonce to crypt the message with (CHACHA_NONCE_SIZE bytes)
+    const u8* nonce;
+
+    // Message segments crypted as one continuous keystream
+    const chacha_segment* segments;
+
+    // Number of message segments
+    size_t count;
+} chacha_job;
+
+// Set initial state for ChaCha cipher context (default variant)
 void chacha_init(
     chacha_ctx* ctx,
     const u8 key[CHACHA_KEY_SIZE]);
 
-// Securely teardown a ChaCHa cipher context
+// Set initial state for ChaCha cipher context using the provided variant.
+// `key` holds variant->key_size bytes.
+// Returns false (leaving the context untouched) if the variant is invalid.
+// Call chacha_prefetch_stop before re-keying a context that is prefetching.
+bool chacha_init_variant(
+    chacha_ctx* ctx,
+    const u8* key,
+    const chacha_variant* variant);
+
+// Securely teardown a ChaCHa cipher context (stopping any prefetching)
 void chacha_wipe(chacha_ctx* ctx);
 
 // Seek the ChaCha keystream using a 128-bit (16-byte) nonce
@@ -64,6 +154,18 @@ void chacha_update(
     void* output,
     size_t size);
 
+// Crypt data using a ChaCha cipher context and continue the CRC-32C value
+// `crc` (0 for new data) over the crypted output. Data is processed in
+// cache-resident steps so each byte of output is checksummed right after it
+// is written. Output and result are identical to chacha_update followed by
+// crc_update(&CRC_MODEL_CRC32C, crc, output, size).
+u32 chacha_update_crc32c(
+    chacha_ctx* ctx,
+    const void* input,
+    void* output,
+    size_t size,
+    u32 crc);
+
 // Crypt data using a key and nonce
 void chacha_crypt(
     const u8 key[CHACHA_KEY_SIZE],
@@ -72,6 +174,22 @@ void chacha_crypt(
     void* output,
     size_t size);
 
+// Crypt data using a key and nonce across up to `threads` worker threads
+// (0 uses all available cores). Output is identical to chacha_crypt.
+void chacha_crypt_parallel(
+    const u8 key[CHACHA_KEY_SIZE],
+    const u8 nonce[CHACHA_NONCE_SIZE],
+    const void* input,
+    void* output,
+    size_t size,
+    size_t threads);
+
+// Crypt `count` independent messages, each with its own key and nonce.
+// Messages are interleaved across vector lanes so batches of small messages
+// approach the throughput of one large message. Output of each job is
+// identical to chacha_crypt over its concatenated segments.
+void chacha_crypt_batch(const chacha_job* jobs, size_t count);
+
 // Crypt data using a key, nonce, and block counter
 void chacha_crypt_block(
     const u8 key[CHACHA_KEY_SIZE],
@@ -89,3 +207,120 @@ void chacha_crypt_offset(
     const void* input,
     void* output,
     size_t size);
+
+// Start pre-generating upcoming keystream of a context into a ring of
+// `blocks` keystream blocks (0 selects a default size) so that
+// chacha_update only XORs on the critical path, falling back to inline
+// generation when the ring runs dry. With `thread` a helper thread keeps
+// the ring full, otherwise it is filled by chacha_prefetch_fill.
+// The context MUST NOT be copied or re-initialized while prefetching.
+// Returns false (leaving the context unchanged) on failure.
+bool chacha_prefetch_start(chacha_ctx* ctx, size_t blocks, bool thread);
+
+// Fill the prefetch ring from the calling thread (e.g. when idle).
+// Returns the number of blocks generated (0 if a helper thread fills it).
+size_t chacha_prefetch_fill(chacha_ctx* ctx);
+
+// Get the prefetch counters of a context (zero if not prefetching)
+void chacha_prefetch_get_stats(const chacha_ctx* ctx, chacha_prefetch_stats* stats);
+
+// Stop prefetching and securely release the ring
+void chacha_prefetch_stop(chacha_ctx* ctx);
+
+// Fill memory with cryptographically secure random bytes.
+// Each thread draws from its own buffered ChaCha12 generator, seeded from
+// the OS on first use and reseeded periodically and after fork.
+void chacha_rand(void* data, size_t size);
+
+// Reseed the calling thread's random generator from the OS
+void chacha_rand_reseed(void);
+
+// Seed the calling thread's random generator with a fixed key for
+// reproducible output (periodic reseeding stops until chacha_rand_reseed)
+void chacha_rand_seed(const u8 key[CHACHA_KEY_SIZE]);
+
+// ChaCha20-Poly1305 AEAD (RFC 8439) Constants [DO NOT CHANGE]
+
+// Key size (in bytes) of the ChaCha20-Poly1305 AEAD.
+// MUST be 32.
+#define CHACHA_AEAD_KEY_SIZE 32
+
+// Nonce size (in bytes) of the ChaCha20-Poly1305 AEAD.
+// MUST be 12.
+#define CHACHA_AEAD_NONCE_SIZE 12
+
+// Tag size (in bytes) of the ChaCha20-Poly1305 AEAD.
+// MUST be 16.
+#define CHACHA_AEAD_TAG_SIZE 16
+
+// ChaCha20-Poly1305 AEAD context structure
+typedef struct chacha_aead_ctx
+{
+    chacha_ctx cipher;
+    poly1305_ctx mac;
+    u64 aad_size;
+    u64 data_size;
+    bool aad_done;
+} chacha_aead_ctx;
+
+// Set initial state for ChaCha20-Poly1305 AEAD context.
+// NOTE: a nonce MUST NOT be reused with the same key.
+void chacha_aead_init(
+    chacha_aead_ctx* ctx,
+    const u8 key[CHACHA_AEAD_KEY_SIZE],
+    const u8 nonce[CHACHA_AEAD_NONCE_SIZE]);
+
+// Authenticate additional data (MUST precede all seal/open updates)
+void chacha_aead_update_aad(
+    chacha_aead_ctx* ctx,
+    const void* aad,
+    size_t size);
+
+// Encrypt and authenticate more plaintext
+void chacha_aead_seal_update(
+    chacha_aead_ctx* ctx,
+    const void* input,
+    void* output,
+    size_t size);
+
+// Authenticate and decrypt more ciphertext.
+// NOTE: plaintext MUST NOT be used before chacha_aead_open_final succeeds.
+void chacha_aead_open_update(
+    chacha_aead_ctx* ctx,
+    const void* input,
+    void* output,
+    size_t size);
+
+// Produce the tag of a sealed message and securely teardown the context
+void chacha_aead_seal_final(
+    chacha_aead_ctx* ctx,
+    u8 tag[CHACHA_AEAD_TAG_SIZE]);
+
+// Verify the tag of an opened message and securely teardown the context.
+// Returns false if the message is not authentic.
+bool chacha_aead_open_final(
+    chacha_aead_ctx* ctx,
+    const u8 tag[CHACHA_AEAD_TAG_SIZE]);
+
+// Encrypt and authenticate a message with additional data
+void chacha_aead_seal(
+    const u8 key[CHACHA_AEAD_KEY_SIZE],
+    const u8 nonce[CHACHA_AEAD_NONCE_SIZE],
+    const void* aad,
+    size_t aad_size,
+    const void* input,
+    void* output,
+    size_t size,
+    u8 tag[CHACHA_AEAD_TAG_SIZE]);
+
+// Authenticate and decrypt a message with additional data.
+// Returns false (wiping the output) if the message is not authentic.
+bool chacha_aead_open(
+    const u8 key[CHACHA_AEAD_KEY_SIZE],
+    const u8 nonce[CHACHA_AEAD_NONCE_SIZE],
+    const void* aad,
+    size_t aad_size,
+    const void* input,
+    void* output,
+    size_t size,
+    const u8 tag[CHACHA_AEAD_TAG_SIZE]);
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include "chacha.h"
+
+// ChaCha Container Format
+//
+// Seekable encrypted file made of fixed-size chunks:
+//
+//   header (64 bytes)
+//     magic "CHACHACF", version, rounds, chunk size, random 64-bit nonce,
+//     key check value, and the CRC-32C of the header
+//   data (plaintext size bytes)
+//     plaintext byte i crypted with the keystream at byte offset i of the
+//     nonce (chacha_seek_offset), so any range decrypts independently
+//   index (4 bytes per chunk)
+//     CRC-32C of the crypted bytes of each chunk
+//   footer (32 bytes)
+//     plaintext size, chunk count, CRC-32C of the index and of the footer,
+//     and the magic "CHACHAIX"
+//
+// All integers are little-endian. Chunk CRCs cover the crypted data, so
+// integrity is verified without the key. They detect corruption but do not
+// authenticate the data.
+
+// ChaCha Container Tunables
+
+// Default size (in bytes) of each container chunk.
+// MUST be a multiple of 64.
+#define CHACHA_CONTAINER_CHUNK_SIZE (1 << 20)
+
+// ChaCha Container Constants [DO NOT CHANGE]
+
+// Size (in bytes) of the container header
+#define CHACHA_CONTAINER_HEADER_SIZE 64
+
+// Size (in bytes) of the container footer
+#define CHACHA_CONTAINER_FOOTER_SIZE 32
+
+// Container format version
+#define CHACHA_CONTAINER_VERSION 1
+
+// Open container file
+typedef struct chacha_container
+{
+    int fd;
+    bool writable;
+
+    // Key was provided (required to append and read)
+    bool keyed;
+
+    // Index or footer changed since the container was opened or synced
+    bool dirty;
+
+    // Cipher key, variant rounds, and container nonce
+    u8 key[CHACHA_KEY_SIZE];
+    size_t rounds;
+    u64 nonce;
+
+    // Size (in bytes) of each chunk and of the plaintext data
+    size_t chunk_size;
+    u64 size;
+
+    // Chunk index (CRC-32C of the crypted data of each chunk)
+    u32* crcs;
+    size_t count;
+    size_t capacity;
+} chacha_container;
+
+// Create a new (empty) container file, replacing any existing file.
+// `chunk_size` of 0 selects CHACHA_CONTAINER_CHUNK_SIZE.
+bool chacha_container_create(
+    chacha_container* container,
+    const char* path,
+    const u8 key[CHACHA_KEY_SIZE],
+    size_t chunk_size);
+
+// Open an existing container file for reading (and appending if `append`).
+// Fails if the file is malformed or the key does not match.
+bool chacha_container_open(
+    chacha_container* container,
+    const char* path,
+    const u8 key[CHACHA_KEY_SIZE],
+    bool append);
+
+// Open an existing container file without the key (only verification and
+// metadata are available)
+bool chacha_container_open_unkeyed(chacha_container* container, const char* path);
+
+// Encrypt and append data to the end of a container.
+// Data overwrites the index and footer, which are only rewritten by
+// chacha_container_sync and chacha_container_close, so the file fails to
+// open if the process dies in between.
+bool chacha_container_append(
+    chacha_container* container,
+    const void* data,
+    size_t size);
+
+// Decrypt `size` bytes of plaintext starting at `offset`.
+// Only the chunks overlapping the range are read and their CRCs checked.
+// Ranges spanning several chunks are decrypted by up to `threads` worker
+// threads (0 uses all available cores).
+bool chacha_container_read(
+    chacha_container* container,
+    u64 offset,
+    void* data,
+    size_t size,
+    size_t threads);
+
+// Verify the CRC of every chunk using up to `threads` worker threads
+// (0 uses all available cores). Reports the first corrupt chunk.
+bool chacha_container_verify(chacha_container* container, size_t threads);
+
+// Write the index and footer (if changed) and flush the container to disk,
+// so every append made so far survives a crash
+bool chacha_container_sync(chacha_container* container);
+
+// Write the index and footer (if changed), close the file, and securely
+// teardown the container
+bool chacha_container_close(chacha_container* container);
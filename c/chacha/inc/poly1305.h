@@ -0,0 +1,59 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include "util.h"
+
+// Poly1305 Constants [DO NOT CHANGE]
+
+// One-time key size (in bytes) of the Poly1305 authenticator.
+// MUST be 32.
+#define POLY1305_KEY_SIZE 32
+
+// Tag size (in bytes) produced by the Poly1305 authenticator.
+// MUST be 16.
+#define POLY1305_TAG_SIZE 16
+
+// Block size (in bytes) processed by the Poly1305 authenticator.
+// MUST be 16.
+#define POLY1305_BLOCK_SIZE 16
+
+// Poly1305 authenticator context structure
+typedef struct poly1305_ctx
+{
+    // Clamped key r (26-bit limbs)
+    u32 r[5];
+
+    // Key s added to the final value
+    u32 pad[4];
+
+    // Accumulator (26-bit limbs)
+    u32 h[5];
+
+    // Powers r^1 through r^4 (26-bit limbs) used by vector kernels
+    u32 powers[4][5];
+
+    // Partial block of buffered input
+    u8 buffer[POLY1305_BLOCK_SIZE];
+    size_t leftover;
+} poly1305_ctx;
+
+// Set initial state for Poly1305 context using a one-time key.
+// NOTE: a key MUST NOT be used to authenticate more than one message.
+void poly1305_init(poly1305_ctx* ctx, const u8 key[POLY1305_KEY_SIZE]);
+
+// Authenticate more data using a Poly1305 context
+void poly1305_update(poly1305_ctx* ctx, const void* data, size_t size);
+
+// Produce the tag of all authenticated data and securely teardown the context
+void poly1305_final(poly1305_ctx* ctx, u8 tag[POLY1305_TAG_SIZE]);
+
+// Calculate the Poly1305 tag of the provided data using a one-time key
+void poly1305_compute(
+    const u8 key[POLY1305_KEY_SIZE],
+    const void* data,
+    size_t size,
+    u8 tag[POLY1305_TAG_SIZE]);
+
+// Compare two tags in constant time
+bool poly1305_verify(const u8 a[POLY1305_TAG_SIZE], const u8 b[POLY1305_TAG_SIZE]);
@@ -1,13 +1,23 @@
-#include "chacha.h"
+#include <pthread.h>
 
-// Block size (in bytes) of a ChaCha keystream block
-// MUST be 64.
-#define CHACHA_BLOCK_SIZE 64
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+#include "chacha_internal.h"
+#include "crc.h"
+
+// Size (in bytes) of the keystream chunk crypted by each parallel work item.
+// MUST be a multiple of CHACHA_BLOCK_SIZE.
+#define CHACHA_PARALLEL_CHUNK_SIZE (1 << 20)
 
-// Number of 32-bit (4-byte) words to use for the
-// incrementing the internal stream counter.
-// MUST be 1, 2, or 4.
-#define CHACHA_COUNTER_WORDS (CHACHA_COUNTER_SIZE / 4)
+// Minimum size (in bytes) of data worth splitting across threads
+#define CHACHA_PARALLEL_MIN_SIZE (4 * CHACHA_PARALLEL_CHUNK_SIZE)
+
+// Size (in bytes) of each step crypted then checksummed by
+// chacha_update_crc32c while it is still in L1 cache.
+// MUST be a multiple of CHACHA_BLOCK_SIZE.
+#define CHACHA_CRC_STEP_SIZE (16 << 10)
 
 // ChaCha cipher constant value used with
 // a 256-bit (32-byte) key.
@@ -17,12 +27,15 @@
 // a 128-bit (16-byte) key.
 #define CHACHA_TAU ((const u8*) "expand 16-byte k")
 
-#if CHACHA_KEY_SIZE >= 32
-#define CHACHA_CONSTANT CHACHA_SIGMA
-#else
-#define CHACHA_CONSTANT CHACHA_TAU
+#if CHACHA_ROUNDS != 8 && CHACHA_ROUNDS != 12 && CHACHA_ROUNDS != 20
+#error "CHACHA_ROUNDS MUST be 8, 12, or 20"
 #endif
 
+const chacha_variant CHACHA_VARIANT_DEFAULT = { CHACHA_ROUNDS, CHACHA_KEY_SIZE, CHACHA_COUNTER_SIZE };
+const chacha_variant CHACHA_VARIANT_CHACHA8 = { 8, 32, 16 };
+const chacha_variant CHACHA_VARIANT_CHACHA12 = { 12, 32, 16 };
+const chacha_variant CHACHA_VARIANT_CHACHA20 = { 20, 32, 16 };
+
 // Perform the ChaCha quarter round operation
 static void chacha_quarter_round(
     u32 block[CHACHA_STATE_WORDS],
@@ -44,29 +57,33 @@ static void chacha_quarter_round(
     block[c] += block[d]; block[b] = rotl32(block[b] ^ block[c], 7);
 }
 
+// Perform a ChaCha odd and even round
+static inline void chacha_double_round(u32 block[CHACHA_STATE_WORDS])
+{
+    // Odd round
+    chacha_quarter_round(block, 0, 4, 8, 12);
+    chacha_quarter_round(block, 1, 5, 9, 13);
+    chacha_quarter_round(block, 2, 6, 10, 14);
+    chacha_quarter_round(block, 3, 7, 11, 15);
+
+    // Even round
+    chacha_quarter_round(block, 0, 5, 10, 15);
+    chacha_quarter_round(block, 1, 6, 11, 12);
+    chacha_quarter_round(block, 2, 7, 8, 13);
+    chacha_quarter_round(block, 3, 4, 9, 14);
+}
+
 // Generate ChaCha cipher keystream
 static void chacha_block(
     const u32 input[CHACHA_STATE_WORDS],
-    u32 output[CHACHA_STATE_WORDS])
+    u32 output[CHACHA_STATE_WORDS],
+    size_t rounds)
 {
     // Load initial state into output buffer
     memcpy(output, input, CHACHA_BLOCK_SIZE);
 
-    // Perform ChaCha rounds
-    for (size_t i = 0; i < CHACHA_ROUNDS; i += 2)
-    {
-        // Odd round
-        chacha_quarter_round(output, 0, 4, 8, 12);
-        chacha_quarter_round(output, 1, 5, 9, 13);
-        chacha_quarter_round(output, 2, 6, 10, 14);
-        chacha_quarter_round(output, 3, 7, 11, 15);
-
-        // Even round
-        chacha_quarter_round(output, 0, 5, 10, 15);
-        chacha_quarter_round(output, 1, 6, 11, 12);
-        chacha_quarter_round(output, 2, 7, 8, 13);
-        chacha_quarter_round(output, 3, 4, 9, 14);
-    }
+    // Perform ChaCha rounds (fully unrolled)
+    CHACHA_DOUBLE_ROUNDS(rounds, chacha_double_round(output);)
 
     // Encode generated keystream block
     for (size_t i = 0; i < CHACHA_STATE_WORDS; i++)
@@ -75,36 +92,366 @@ static void chacha_block(
     }
 }
 
-// Increment 128-bit (16-byte) nonce as little-endian counter
-static void chacha_increment(u32 counter[CHACHA_COUNTER_WORDS])
+// Maximum number of vector kernels bound at once
+#define CHACHA_DISPATCH_KERNELS 3
+
+// Vector kernels of one round count bound for the running CPU (widest first)
+typedef struct chacha_kernels
+{
+    chacha_kernel_t kernels[CHACHA_DISPATCH_KERNELS];
+    size_t lanes[CHACHA_DISPATCH_KERNELS];
+    size_t count;
+
+    // Widest multi-stream kernel (NULL if none)
+    chacha_lanes_t streams;
+    size_t streams_lanes;
+} chacha_kernels;
+
+static chacha_kernels CHACHA_DISPATCH[CHACHA_VARIANT_COUNT];
+static pthread_once_t CHACHA_DISPATCH_ONCE = PTHREAD_ONCE_INIT;
+
+// Append a kernel (narrower than those already bound)
+static inline void chacha_dispatch_add(
+    chacha_kernels* k,
+    chacha_kernel_t kernel,
+    chacha_lanes_t streams,
+    size_t lanes)
+{
+    k->kernels[k->count] = kernel;
+    k->lanes[k->count++] = lanes;
+
+    if (k->streams == NULL)
+    {
+        k->streams = streams;
+        k->streams_lanes = lanes;
+    }
+}
+
+#define CHACHA_BIND_AVX512(rounds) \
+    chacha_dispatch_add(d + CHACHA_VARIANT_INDEX(rounds), chacha_xor_avx512_##rounds, chacha_xor_lanes_avx512_##rounds, 16);
+#define CHACHA_BIND_AVX2(rounds) \
+    chacha_dispatch_add(d + CHACHA_VARIANT_INDEX(rounds), chacha_xor_avx2_##rounds, chacha_xor_lanes_avx2_##rounds, 8);
+#define CHACHA_BIND_SSE2(rounds) \
+    chacha_dispatch_add(d + CHACHA_VARIANT_INDEX(rounds), chacha_xor_sse2_##rounds, chacha_xor_lanes_sse2_##rounds, 4);
+
+// Bind vector kernels of every round count from the detected CPU features
+static void chacha_dispatch_resolve(void)
+{
+    chacha_kernels d[CHACHA_VARIANT_COUNT];
+
+    memset(d, 0, sizeof(d));
+
+#if CPU_X86
+    const u32 features = cpu_features();
+
+    if (cpu_has(features, CPU_FEATURE_AVX512F))
+    {
+        CHACHA_VARIANTS(CHACHA_BIND_AVX512)
+    }
+
+    if (cpu_has(features, CPU_FEATURE_AVX2))
+    {
+        CHACHA_VARIANTS(CHACHA_BIND_AVX2)
+    }
+
+    if (cpu_has(features, CPU_FEATURE_SSE2))
+    {
+        CHACHA_VARIANTS(CHACHA_BIND_SSE2)
+    }
+#endif
+
+    memcpy(CHACHA_DISPATCH, d, sizeof(d));
+}
+
+// Get the vector kernels bound for a round count
+static const chacha_kernels* chacha_dispatch_get(size_t rounds)
 {
-    for (size_t i = 0; i < CHACHA_COUNTER_WORDS; i++)
+    pthread_once(&CHACHA_DISPATCH_ONCE, chacha_dispatch_resolve);
+
+    return CHACHA_DISPATCH + CHACHA_VARIANT_INDEX(rounds);
+}
+
+// Crypt full blocks using the widest available vector kernels.
+// Returns the number of blocks processed (the rest is left to the scalar path).
+static size_t chacha_xor_blocks(
+    chacha_ctx* ctx,
+    const u8* input,
+    u8* output,
+    size_t blocks)
+{
+    const chacha_kernels* const k = chacha_dispatch_get(ctx->rounds);
+    size_t done = 0;
+
+    for (size_t i = 0; i < k->count; i++)
     {
-        if (++counter[i])
+        const size_t lanes = k->lanes[i];
+        const size_t n = (blocks - done) / lanes * lanes;
+
+        if (n > 0)
+        {
+            k->kernels[i](
+                ctx->state,
+                input + done * CHACHA_BLOCK_SIZE,
+                output + done * CHACHA_BLOCK_SIZE,
+                n,
+                ctx->counter_words);
+
+            chacha_advance(ctx->state + 12, ctx->counter_words, n);
+            done += n;
+        }
+    }
+
+    return done;
+}
+
+// Progress of a batch message assigned to a vector lane
+typedef struct chacha_lane
+{
+    // Message being crypted (NULL if the lane is idle)
+    const chacha_job* job;
+
+    // Current segment index and byte offset within it
+    size_t segment;
+    size_t offset;
+} chacha_lane;
+
+// Step a lane past exhausted segments (idling it once the message is done)
+static void chacha_lane_skip(chacha_lane* lane)
+{
+    while (lane->segment < lane->job->count &&
+           lane->offset == lane->job->segments[lane->segment].size)
+    {
+        lane->segment++;
+        lane->offset = 0;
+    }
+
+    if (lane->segment == lane->job->count)
+    {
+        lane->job = NULL;
+    }
+}
+
+// Gather up to one block of message input that spans segments.
+// Returns the number of bytes gathered.
+static size_t chacha_lane_gather(const chacha_lane* lane, u8 block[CHACHA_BLOCK_SIZE])
+{
+    size_t segment = lane->segment;
+    size_t offset = lane->offset;
+    size_t size = 0;
+
+    while (size < CHACHA_BLOCK_SIZE && segment < lane->job->count)
+    {
+        const chacha_segment* const seg = lane->job->segments + segment;
+        const size_t msize = MIN(CHACHA_BLOCK_SIZE - size, seg->size - offset);
+
+        memcpy(block + size, OFFSET_CPTR(seg->input, offset), msize);
+        size += msize;
+        offset += msize;
+
+        if (offset == seg->size)
+        {
+            segment++;
+            offset = 0;
+        }
+    }
+
+    return size;
+}
+
+// Scatter `size` bytes of crypted output across segments and advance the lane
+static void chacha_lane_scatter(chacha_lane* lane, const u8 block[CHACHA_BLOCK_SIZE], size_t size)
+{
+    size_t done = 0;
+
+    while (done < size)
+    {
+        const chacha_segment* const seg = lane->job->segments + lane->segment;
+        const size_t msize = MIN(size - done, seg->size - lane->offset);
+
+        memcpy(OFFSET_PTR(seg->output, lane->offset), block + done, msize);
+        done += msize;
+        lane->offset += msize;
+
+        chacha_lane_skip(lane);
+    }
+}
+
+// Crypt batch messages one at a time (no multi-stream kernel available)
+static void chacha_crypt_batch_serial(const chacha_job* jobs, size_t count)
+{
+    chacha_ctx ctx = { 0 };
+
+    for (size_t i = 0; i < count; i++)
+    {
+        chacha_init(&ctx, jobs[i].key);
+        chacha_seek(&ctx, jobs[i].nonce);
+
+        for (size_t j = 0; j < jobs[i].count; j++)
+        {
+            const chacha_segment* const seg = jobs[i].segments + j;
+            chacha_update(&ctx, seg->input, seg->output, seg->size);
+        }
+    }
+
+    chacha_wipe(&ctx);
+}
+
+// Crypt independent messages using the multi-stream kernel
+void chacha_crypt_batch(const chacha_job* jobs, size_t count)
+{
+    const chacha_kernels* const k = chacha_dispatch_get(CHACHA_ROUNDS);
+    const chacha_lanes_t kernel = k->streams;
+    const size_t lanes = k->streams_lanes;
+
+    if (count == 0)
+    {
+        return;
+    }
+
+    if (kernel == NULL)
+    {
+        chacha_crypt_batch_serial(jobs, count);
+        return;
+    }
+
+    u32 words[CHACHA_STATE_WORDS][CHACHA_LANES_MAX] = { { 0 } };
+    u8 scratch[CHACHA_LANES_MAX][CHACHA_BLOCK_SIZE] = { { 0 } };
+    chacha_lane lane[CHACHA_LANES_MAX] = { { 0 } };
+    size_t gathered[CHACHA_LANES_MAX] = { 0 };
+    const u8* input[CHACHA_LANES_MAX];
+    u8* output[CHACHA_LANES_MAX];
+    size_t next = 0;
+    chacha_ctx ctx = { 0 };
+
+    for (;;)
+    {
+        size_t active = 0;
+
+        for (size_t j = 0; j < lanes; j++)
+        {
+            // Assign the next non-empty message to an idle lane
+            while (lane[j].job == NULL && next < count)
+            {
+                lane[j] = (chacha_lane) { jobs + next++, 0, 0 };
+                chacha_lane_skip(lane + j);
+
+                if (lane[j].job != NULL)
+                {
+                    chacha_init(&ctx, lane[j].job->key);
+                    chacha_seek(&ctx, lane[j].job->nonce);
+
+                    for (size_t w = 0; w < CHACHA_STATE_WORDS; w++)
+                    {
+                        words[w][j] = ctx.state[w];
+                    }
+                }
+            }
+
+            // Point the lane at its next block (gathering partial blocks)
+            input[j] = scratch[j];
+            output[j] = scratch[j];
+            gathered[j] = 0;
+
+            if (lane[j].job != NULL)
+            {
+                const chacha_segment* const seg = lane[j].job->segments + lane[j].segment;
+
+                if (seg->size - lane[j].offset >= CHACHA_BLOCK_SIZE)
+                {
+                    input[j] = OFFSET_CPTR(seg->input, lane[j].offset);
+                    output[j] = OFFSET_PTR(seg->output, lane[j].offset);
+                }
+                else
+                {
+                    gathered[j] = chacha_lane_gather(lane + j, scratch[j]);
+                }
+
+                active++;
+            }
+        }
+
+        if (active == 0)
         {
             break;
         }
+
+        kernel((const u32 (*)[CHACHA_LANES_MAX]) words, input, output);
+
+        // Advance active lanes past the crypted block
+        for (size_t j = 0; j < lanes; j++)
+        {
+            if (lane[j].job == NULL)
+            {
+                continue;
+            }
+
+            if (gathered[j] > 0)
+            {
+                chacha_lane_scatter(lane + j, scratch[j], gathered[j]);
+            }
+            else
+            {
+                lane[j].offset += CHACHA_BLOCK_SIZE;
+                chacha_lane_skip(lane + j);
+            }
+
+            for (size_t w = 0; w < CHACHA_COUNTER_WORDS; w++)
+            {
+                if (++words[12 + w][j])
+                {
+                    break;
+                }
+            }
+        }
     }
+
+    // Teardown key material
+    chacha_wipe(&ctx);
+    memwipe(words, sizeof(words));
+    memwipe(scratch, sizeof(scratch));
 }
 
 // Set initial state for ChaCha cipher context
 void chacha_init(chacha_ctx* ctx, const u8 key[CHACHA_KEY_SIZE])
 {
+    chacha_init_variant(ctx, key, &CHACHA_VARIANT_DEFAULT);
+}
+
+// Set initial state for ChaCha cipher context using the provided variant
+bool chacha_init_variant(
+    chacha_ctx* ctx,
+    const u8* key,
+    const chacha_variant* variant)
+{
+    const size_t rounds = variant->rounds;
+    const size_t key_size = variant->key_size;
+    const size_t counter_size = variant->counter_size;
+
+    // Validate variant parameters
+    if ((rounds != 8 && rounds != 12 && rounds != 20) ||
+        (key_size != 16 && key_size != 32) ||
+        (counter_size != 4 && counter_size != 8 && counter_size != 16))
+    {
+        return false;
+    }
+
     // ChaCha constant
-    ctx->state[0] = load32_le(CHACHA_CONSTANT + 0);
-    ctx->state[1] = load32_le(CHACHA_CONSTANT + 4);
-    ctx->state[2] = load32_le(CHACHA_CONSTANT + 8);
-    ctx->state[3] = load32_le(CHACHA_CONSTANT + 12);
+    const u8* const constant = key_size == 32 ? CHACHA_SIGMA : CHACHA_TAU;
+
+    ctx->state[0] = load32_le(constant + 0);
+    ctx->state[1] = load32_le(constant + 4);
+    ctx->state[2] = load32_le(constant + 8);
+    ctx->state[3] = load32_le(constant + 12);
 
     // 256-bit (32-byte) or 128-bit (16-byte) key
     ctx->state[4] = load32_le(key + 0);
     ctx->state[5] = load32_le(key + 4);
     ctx->state[6] = load32_le(key + 8);
     ctx->state[7] = load32_le(key + 12);
-    ctx->state[8] = load32_le(key + 16 % CHACHA_KEY_SIZE);
-    ctx->state[9] = load32_le(key + 20 % CHACHA_KEY_SIZE);
-    ctx->state[10] = load32_le(key + 24 % CHACHA_KEY_SIZE);
-    ctx->state[11] = load32_le(key + 28 % CHACHA_KEY_SIZE);
+    ctx->state[8] = load32_le(key + 16 % key_size);
+    ctx->state[9] = load32_le(key + 20 % key_size);
+    ctx->state[10] = load32_le(key + 24 % key_size);
+    ctx->state[11] = load32_le(key + 28 % key_size);
 
     // 128-bit (16-byte) nonce/counter value
     ctx->state[12] = 0;
@@ -114,6 +461,15 @@ void chacha_init(chacha_ctx* ctx, const u8 key[CHACHA_KEY_SIZE])
 
     // Keystream window index
     ctx->index = CHACHA_BLOCK_SIZE;
+
+    // Variant parameters
+    ctx->rounds = rounds;
+    ctx->counter_words = counter_size / 4;
+
+    // No keystream prefetching
+    ctx->prefetch = NULL;
+
+    return true;
 }
 
 // Securely teardown a ChaCha cipher context
@@ -121,6 +477,11 @@ void chacha_wipe(chacha_ctx* ctx)
 {
     if (ctx != NULL)
     {
+        if (ctx->prefetch != NULL)
+        {
+            chacha_prefetch_stop(ctx);
+        }
+
         memwipe(ctx, sizeof(*ctx));
     }
 }
@@ -136,6 +497,11 @@ void chacha_seek(
     ctx->state[15] = load32_le(nonce + 12);
 
     ctx->index = CHACHA_BLOCK_SIZE;
+
+    if (ctx->prefetch != NULL)
+    {
+        chacha_prefetch_restart(ctx);
+    }
 }
 
 // Seek the ChaCha keystream using a 64-bit (8-byte) nonce and block counter
@@ -147,6 +513,11 @@ void chacha_seek_block(chacha_ctx* ctx, u64 nonce, u64 block)
     ctx->state[15] = (u32)(nonce >> 32);
 
     ctx->index = CHACHA_BLOCK_SIZE;
+
+    if (ctx->prefetch != NULL)
+    {
+        chacha_prefetch_restart(ctx);
+    }
 }
 
 // Seek the ChaCha keystream using a 64-bit (8-byte) nonce and byte counter
@@ -161,8 +532,8 @@ void chacha_seek_offset(chacha_ctx* ctx, u64 nonce, u64 offset)
     // Seek to relevant keystream byte
     if (index > 0)
     {
-        chacha_block(ctx->state, ctx->stream);
-        chacha_increment(ctx->state + 12);
+        chacha_block(ctx->state, ctx->stream, ctx->rounds);
+        chacha_increment(ctx->state + 12, ctx->counter_words);
         ctx->index = (size_t) index;
     }
 }
@@ -197,12 +568,35 @@ void chacha_update(
         size -= msize;
     }
 
-    // Crypt full blocks
+    // Crypt using prefetched keystream blocks
+    if (size > 0 && ctx->prefetch != NULL)
+    {
+        const size_t n = chacha_prefetch_xor(
+            ctx,
+            OFFSET_CPTR(input, offset),
+            OFFSET_PTR(output, offset),
+            size);
+
+        offset += n;
+        size -= n;
+    }
+
+    // Crypt the bulk of full blocks with vector kernels
+    const size_t blocks = chacha_xor_blocks(
+        ctx,
+        OFFSET_CPTR(input, offset),
+        OFFSET_PTR(output, offset),
+        size / CHACHA_BLOCK_SIZE);
+
+    offset += blocks * CHACHA_BLOCK_SIZE;
+    size -= blocks * CHACHA_BLOCK_SIZE;
+
+    // Crypt remaining full blocks
     while (size >= CHACHA_BLOCK_SIZE)
     {
         // Generate next keystream block
-        chacha_block(ctx->state, ctx->stream);
-        chacha_increment(ctx->state + 12);
+        chacha_block(ctx->state, ctx->stream, ctx->rounds);
+        chacha_increment(ctx->state + 12, ctx->counter_words);
 
         // Xor input with keystream bytes
         memxor(
@@ -220,8 +614,8 @@ void chacha_update(
     if (size > 0)
     {
         // Generate next keystream block
-        chacha_block(ctx->state, ctx->stream);
-        chacha_increment(ctx->state + 12);
+        chacha_block(ctx->state, ctx->stream, ctx->rounds);
+        chacha_increment(ctx->state + 12, ctx->counter_words);
 
         // Xor input with keystream bytes
         memxor(
@@ -235,6 +629,29 @@ void chacha_update(
     }
 }
 
+// Crypt data and continue the CRC-32C of the crypted output
+u32 chacha_update_crc32c(
+    chacha_ctx* ctx,
+    const void* input,
+    void* output,
+    size_t size,
+    u32 crc)
+{
+    while (size > 0)
+    {
+        const size_t n = MIN(size, CHACHA_CRC_STEP_SIZE);
+
+        chacha_update(ctx, input, output, n);
+        crc = (u32) crc_update(&CRC_MODEL_CRC32C, crc, output, n);
+
+        input = OFFSET_CPTR(input, n);
+        output = OFFSET_PTR(output, n);
+        size -= n;
+    }
+
+    return crc;
+}
+
 // Crypt data using a key and nonce
 void chacha_crypt(
     const u8 key[CHACHA_KEY_SIZE],
@@ -299,3 +716,56 @@ void chacha_crypt_offset(
     // Teardown context
     chacha_wipe(&ctx);
 }
+
+// Crypt data using a key and nonce across several threads
+void chacha_crypt_parallel(
+    const u8 key[CHACHA_KEY_SIZE],
+    const u8 nonce[CHACHA_NONCE_SIZE],
+    const void* input,
+    void* output,
+    size_t size,
+    size_t threads)
+{
+    const size_t chunks = (size + CHACHA_PARALLEL_CHUNK_SIZE - 1) / CHACHA_PARALLEL_CHUNK_SIZE;
+
+#if defined(_OPENMP)
+    if (threads == 0)
+    {
+        threads = (size_t) omp_get_max_threads();
+    }
+#endif
+
+    // Small buffers are not worth waking the thread pool for
+    threads = MIN(MAX(threads, 1), chunks);
+    if (threads <= 1 || size < CHACHA_PARALLEL_MIN_SIZE)
+    {
+        chacha_crypt(key, nonce, input, output, size);
+        return;
+    }
+
+    // Crypt chunks independently (each worker keys its context once)
+    #pragma omp parallel num_threads(threads) default(shared)
+    {
+        chacha_ctx ctx;
+        chacha_init(&ctx, key);
+
+        #pragma omp for schedule(static)
+        for (size_t i = 0; i < chunks; i++)
+        {
+            const size_t offset = i * CHACHA_PARALLEL_CHUNK_SIZE;
+
+            // Seek keystream to the first block of this chunk
+            chacha_seek(&ctx, nonce);
+            chacha_advance(ctx.state + 12, ctx.counter_words, offset / CHACHA_BLOCK_SIZE);
+
+            chacha_update(
+                &ctx,
+                OFFSET_CPTR(input, offset),
+                OFFSET_PTR(output, offset),
+                MIN(size - offset, CHACHA_PARALLEL_CHUNK_SIZE));
+        }
+
+        // Teardown context
+        chacha_wipe(&ctx);
+    }
+}
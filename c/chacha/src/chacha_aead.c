@@ -0,0 +1,196 @@
+#include "chacha_internal.h"
+
+// Size (in bytes) of the chunks crypted then authenticated (or authenticated
+// then crypted) in turn, so each chunk is still cached for the second pass
+#define CHACHA_AEAD_CHUNK_SIZE 4096
+
+// Zero bytes used to pad authenticated data to whole blocks
+static const u8 CHACHA_AEAD_PAD[POLY1305_BLOCK_SIZE];
+
+// ChaCha20 with a 32-bit block counter (RFC 8439)
+static const chacha_variant CHACHA_AEAD_VARIANT = { 20, 32, 4 };
+
+// Pad authenticated data of `size` bytes to a whole block
+static void chacha_aead_pad(chacha_aead_ctx* ctx, u64 size)
+{
+    const size_t remainder = (size_t) (size % POLY1305_BLOCK_SIZE);
+
+    if (remainder > 0)
+    {
+        poly1305_update(&ctx->mac, CHACHA_AEAD_PAD, POLY1305_BLOCK_SIZE - remainder);
+    }
+}
+
+// Finish additional data before the first message bytes
+static void chacha_aead_finish_aad(chacha_aead_ctx* ctx)
+{
+    if (!ctx->aad_done)
+    {
+        chacha_aead_pad(ctx, ctx->aad_size);
+        ctx->aad_done = true;
+    }
+}
+
+// Compute the tag of all authenticated data
+static void chacha_aead_tag(chacha_aead_ctx* ctx, u8 tag[CHACHA_AEAD_TAG_SIZE])
+{
+    u8 sizes[16];
+
+    chacha_aead_finish_aad(ctx);
+    chacha_aead_pad(ctx, ctx->data_size);
+
+    store64_le(sizes + 0, ctx->aad_size);
+    store64_le(sizes + 8, ctx->data_size);
+
+    poly1305_update(&ctx->mac, sizes, sizeof(sizes));
+    poly1305_final(&ctx->mac, tag);
+
+    // Teardown cipher context
+    chacha_wipe(&ctx->cipher);
+}
+
+// Set initial state for ChaCha20-Poly1305 AEAD context
+void chacha_aead_init(
+    chacha_aead_ctx* ctx,
+    const u8 key[CHACHA_AEAD_KEY_SIZE],
+    const u8 nonce[CHACHA_AEAD_NONCE_SIZE])
+{
+    u8 counter_nonce[CHACHA_NONCE_SIZE] = { 0 };
+    u8 mac_key[CHACHA_BLOCK_SIZE] = { 0 };
+
+    // 32-bit block counter (starting at zero) followed by the 96-bit nonce
+    memcpy(counter_nonce + 4, nonce, CHACHA_AEAD_NONCE_SIZE);
+
+    chacha_init_variant(&ctx->cipher, key, &CHACHA_AEAD_VARIANT);
+    chacha_seek(&ctx->cipher, counter_nonce);
+
+    // Block 0 keys the authenticator; the message starts at block 1
+    chacha_update(&ctx->cipher, mac_key, mac_key, sizeof(mac_key));
+    poly1305_init(&ctx->mac, mac_key);
+    memwipe(mac_key, sizeof(mac_key));
+
+    ctx->aad_size = 0;
+    ctx->data_size = 0;
+    ctx->aad_done = false;
+}
+
+// Authenticate additional data
+void chacha_aead_update_aad(
+    chacha_aead_ctx* ctx,
+    const void* aad,
+    size_t size)
+{
+    poly1305_update(&ctx->mac, aad, size);
+    ctx->aad_size += size;
+}
+
+// Encrypt and authenticate more plaintext
+void chacha_aead_seal_update(
+    chacha_aead_ctx* ctx,
+    const void* input,
+    void* output,
+    size_t size)
+{
+    chacha_aead_finish_aad(ctx);
+
+    // Crypt then authenticate each chunk while it is still cached
+    for (size_t offset = 0; offset < size; offset += CHACHA_AEAD_CHUNK_SIZE)
+    {
+        const size_t msize = MIN(size - offset, CHACHA_AEAD_CHUNK_SIZE);
+
+        chacha_update(&ctx->cipher, OFFSET_CPTR(input, offset), OFFSET_PTR(output, offset), msize);
+        poly1305_update(&ctx->mac, OFFSET_CPTR(output, offset), msize);
+    }
+
+    ctx->data_size += size;
+}
+
+// Authenticate and decrypt more ciphertext
+void chacha_aead_open_update(
+    chacha_aead_ctx* ctx,
+    const void* input,
+    void* output,
+    size_t size)
+{
+    chacha_aead_finish_aad(ctx);
+
+    // Authenticate then crypt each chunk while it is still cached
+    for (size_t offset = 0; offset < size; offset += CHACHA_AEAD_CHUNK_SIZE)
+    {
+        const size_t msize = MIN(size - offset, CHACHA_AEAD_CHUNK_SIZE);
+
+        poly1305_update(&ctx->mac, OFFSET_CPTR(input, offset), msize);
+        chacha_update(&ctx->cipher, OFFSET_CPTR(input, offset), OFFSET_PTR(output, offset), msize);
+    }
+
+    ctx->data_size += size;
+}
+
+// Produce the tag of a sealed message and securely teardown the context
+void chacha_aead_seal_final(
+    chacha_aead_ctx* ctx,
+    u8 tag[CHACHA_AEAD_TAG_SIZE])
+{
+    chacha_aead_tag(ctx, tag);
+}
+
+// Verify the tag of an opened message and securely teardown the context
+bool chacha_aead_open_final(
+    chacha_aead_ctx* ctx,
+    const u8 tag[CHACHA_AEAD_TAG_SIZE])
+{
+    u8 expected[CHACHA_AEAD_TAG_SIZE];
+
+    chacha_aead_tag(ctx, expected);
+
+    const bool valid = poly1305_verify(expected, tag);
+    memwipe(expected, sizeof(expected));
+
+    return valid;
+}
+
+// Encrypt and authenticate a message with additional data
+void chacha_aead_seal(
+    const u8 key[CHACHA_AEAD_KEY_SIZE],
+    const u8 nonce[CHACHA_AEAD_NONCE_SIZE],
+    const void* aad,
+    size_t aad_size,
+    const void* input,
+    void* output,
+    size_t size,
+    u8 tag[CHACHA_AEAD_TAG_SIZE])
+{
+    chacha_aead_ctx ctx;
+
+    chacha_aead_init(&ctx, key, nonce);
+    chacha_aead_update_aad(&ctx, aad, aad_size);
+    chacha_aead_seal_update(&ctx, input, output, size);
+    chacha_aead_seal_final(&ctx, tag);
+}
+
+// Authenticate and decrypt a message with additional data
+bool chacha_aead_open(
+    const u8 key[CHACHA_AEAD_KEY_SIZE],
+    const u8 nonce[CHACHA_AEAD_NONCE_SIZE],
+    const void* aad,
+    size_t aad_size,
+    const void* input,
+    void* output,
+    size_t size,
+    const u8 tag[CHACHA_AEAD_TAG_SIZE])
+{
+    chacha_aead_ctx ctx;
+
+    chacha_aead_init(&ctx, key, nonce);
+    chacha_aead_update_aad(&ctx, aad, aad_size);
+    chacha_aead_open_update(&ctx, input, output, size);
+
+    // Never release plaintext of an inauthentic message
+    if (!chacha_aead_open_final(&ctx, tag))
+    {
+        memwipe(output, size);
+        return false;
+    }
+
+    return true;
+}
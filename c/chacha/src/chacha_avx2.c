@@ -0,0 +1,211 @@
+#include "chacha_internal.h"
+
+#if defined(__AVX2__)
+
+#include <immintrin.h>
+
+// Number of blocks processed in parallel
+#define CHACHA_AVX2_LANES 8
+
+// Rotate each 32-bit word left by a constant
+static inline __m256i chacha_rotl_avx2(__m256i x, int count)
+{
+    // Byte-granular rotations are a single shuffle
+    if (count == 16)
+    {
+        const __m256i r16 = _mm256_set_epi8(
+            13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2,
+            13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2);
+        return _mm256_shuffle_epi8(x, r16);
+    }
+    else if (count == 8)
+    {
+        const __m256i r8 = _mm256_set_epi8(
+            14, 13, 12, 15, 10, 9, 8, 11, 6, 5, 4, 7, 2, 1, 0, 3,
+            14, 13, 12, 15, 10, 9, 8, 11, 6, 5, 4, 7, 2, 1, 0, 3);
+        return _mm256_shuffle_epi8(x, r8);
+    }
+
+    return _mm256_or_si256(_mm256_slli_epi32(x, count), _mm256_srli_epi32(x, 32 - count));
+}
+
+// Perform the ChaCha quarter round operation on eight blocks
+CHACHA_KERNEL_INLINE void chacha_quarter_round_avx2(
+    __m256i x[CHACHA_STATE_WORDS],
+    size_t a,
+    size_t b,
+    size_t c,
+    size_t d)
+{
+    x[a] = _mm256_add_epi32(x[a], x[b]); x[d] = chacha_rotl_avx2(_mm256_xor_si256(x[d], x[a]), 16);
+    x[c] = _mm256_add_epi32(x[c], x[d]); x[b] = chacha_rotl_avx2(_mm256_xor_si256(x[b], x[c]), 12);
+    x[a] = _mm256_add_epi32(x[a], x[b]); x[d] = chacha_rotl_avx2(_mm256_xor_si256(x[d], x[a]), 8);
+    x[c] = _mm256_add_epi32(x[c], x[d]); x[b] = chacha_rotl_avx2(_mm256_xor_si256(x[b], x[c]), 7);
+}
+
+// Transpose four words of four blocks within each 128-bit half
+static inline void chacha_transpose_avx2(__m256i x[4])
+{
+    const __m256i t0 = _mm256_unpacklo_epi32(x[0], x[1]);
+    const __m256i t1 = _mm256_unpacklo_epi32(x[2], x[3]);
+    const __m256i t2 = _mm256_unpackhi_epi32(x[0], x[1]);
+    const __m256i t3 = _mm256_unpackhi_epi32(x[2], x[3]);
+
+    x[0] = _mm256_unpacklo_epi64(t0, t1);
+    x[1] = _mm256_unpackhi_epi64(t0, t1);
+    x[2] = _mm256_unpacklo_epi64(t2, t3);
+    x[3] = _mm256_unpackhi_epi64(t2, t3);
+}
+
+// XOR 32 bytes of keystream into the output
+static inline void chacha_xor32_avx2(__m256i k, const u8* input, u8* output)
+{
+    const __m256i m = _mm256_loadu_si256((const __m256i *) input);
+    _mm256_storeu_si256((__m256i *) output, _mm256_xor_si256(m, k));
+}
+
+// Perform a ChaCha odd and even round on eight blocks
+CHACHA_KERNEL_INLINE void chacha_double_round_avx2(__m256i x[CHACHA_STATE_WORDS])
+{
+    // Odd round
+    chacha_quarter_round_avx2(x, 0, 4, 8, 12);
+    chacha_quarter_round_avx2(x, 1, 5, 9, 13);
+    chacha_quarter_round_avx2(x, 2, 6, 10, 14);
+    chacha_quarter_round_avx2(x, 3, 7, 11, 15);
+
+    // Even round
+    chacha_quarter_round_avx2(x, 0, 5, 10, 15);
+    chacha_quarter_round_avx2(x, 1, 6, 11, 12);
+    chacha_quarter_round_avx2(x, 2, 7, 8, 13);
+    chacha_quarter_round_avx2(x, 3, 4, 9, 14);
+}
+
+// Generate eight blocks from word-sliced state `s` using `rounds` rounds
+// and XOR them into the blocks at input[j] and output[j]
+CHACHA_KERNEL_INLINE void chacha_blocks_avx2(
+    const __m256i s[CHACHA_STATE_WORDS],
+    const u8* input[CHACHA_AVX2_LANES],
+    u8* output[CHACHA_AVX2_LANES],
+    size_t rounds)
+{
+    __m256i x[CHACHA_STATE_WORDS];
+
+    for (size_t i = 0; i < CHACHA_STATE_WORDS; i++)
+    {
+        x[i] = s[i];
+    }
+
+    // Perform ChaCha rounds (fully unrolled)
+    CHACHA_DOUBLE_ROUNDS(rounds, chacha_double_round_avx2(x);)
+
+    for (size_t i = 0; i < CHACHA_STATE_WORDS; i++)
+    {
+        x[i] = _mm256_add_epi32(x[i], s[i]);
+    }
+
+    // Transpose each group of four words so x[4g + j] holds words
+    // 4g..4g+3 of block j (low half) and block j + 4 (high half)
+    chacha_transpose_avx2(x + 0);
+    chacha_transpose_avx2(x + 4);
+    chacha_transpose_avx2(x + 8);
+    chacha_transpose_avx2(x + 12);
+
+    // Recombine halves into whole blocks and XOR into the output
+    for (size_t j = 0; j < 4; j++)
+    {
+        const u8* const lo_in = input[j];
+        const u8* const hi_in = input[j + 4];
+        u8* const lo_out = output[j];
+        u8* const hi_out = output[j + 4];
+
+        chacha_xor32_avx2(_mm256_permute2x128_si256(x[j], x[4 + j], 0x20), lo_in + 0, lo_out + 0);
+        chacha_xor32_avx2(_mm256_permute2x128_si256(x[8 + j], x[12 + j], 0x20), lo_in + 32, lo_out + 32);
+        chacha_xor32_avx2(_mm256_permute2x128_si256(x[j], x[4 + j], 0x31), hi_in + 0, hi_out + 0);
+        chacha_xor32_avx2(_mm256_permute2x128_si256(x[8 + j], x[12 + j], 0x31), hi_in + 32, hi_out + 32);
+    }
+}
+
+// Crypt blocks eight at a time using AVX2
+CHACHA_KERNEL_INLINE void chacha_xor_avx2(
+    const u32 state[CHACHA_STATE_WORDS],
+    const u8* input,
+    u8* output,
+    size_t blocks,
+    size_t counter_words,
+    size_t rounds)
+{
+    u32 counter[4] = { state[12], state[13], state[14], state[15] };
+    u32 words[4][CHACHA_LANES_MAX];
+
+    for (; blocks >= CHACHA_AVX2_LANES; blocks -= CHACHA_AVX2_LANES)
+    {
+        __m256i s[CHACHA_STATE_WORDS];
+        const u8* in[CHACHA_AVX2_LANES];
+        u8* out[CHACHA_AVX2_LANES];
+
+        // Load word-sliced initial state (one block per lane)
+        chacha_lane_counters(counter, counter_words, words, CHACHA_AVX2_LANES);
+
+        for (size_t i = 0; i < 12; i++)
+        {
+            s[i] = _mm256_set1_epi32((int) state[i]);
+        }
+
+        for (size_t i = 12; i < CHACHA_STATE_WORDS; i++)
+        {
+            s[i] = _mm256_loadu_si256((const __m256i *) words[i - 12]);
+        }
+
+        for (size_t j = 0; j < CHACHA_AVX2_LANES; j++)
+        {
+            in[j] = input + j * CHACHA_BLOCK_SIZE;
+            out[j] = output + j * CHACHA_BLOCK_SIZE;
+        }
+
+        chacha_blocks_avx2(s, in, out, rounds);
+
+        input += CHACHA_AVX2_LANES * CHACHA_BLOCK_SIZE;
+        output += CHACHA_AVX2_LANES * CHACHA_BLOCK_SIZE;
+    }
+}
+
+// Crypt one block of each of eight independent streams using AVX2
+CHACHA_KERNEL_INLINE void chacha_xor_lanes_avx2(
+    const u32 words[CHACHA_STATE_WORDS][CHACHA_LANES_MAX],
+    const u8* input[CHACHA_LANES_MAX],
+    u8* output[CHACHA_LANES_MAX],
+    size_t rounds)
+{
+    __m256i s[CHACHA_STATE_WORDS];
+
+    for (size_t i = 0; i < CHACHA_STATE_WORDS; i++)
+    {
+        s[i] = _mm256_loadu_si256((const __m256i *) words[i]);
+    }
+
+    chacha_blocks_avx2(s, input, output, rounds);
+}
+
+// Instantiate kernels with fully unrolled rounds for each round count
+#define CHACHA_DEFINE_AVX2(rounds) \
+    void chacha_xor_avx2_##rounds( \
+        const u32 state[CHACHA_STATE_WORDS], \
+        const u8* input, \
+        u8* output, \
+        size_t blocks, \
+        size_t counter_words) \
+    { \
+        chacha_xor_avx2(state, input, output, blocks, counter_words, rounds); \
+    } \
+    \
+    void chacha_xor_lanes_avx2_##rounds( \
+        const u32 words[CHACHA_STATE_WORDS][CHACHA_LANES_MAX], \
+        const u8* input[CHACHA_LANES_MAX], \
+        u8* output[CHACHA_LANES_MAX]) \
+    { \
+        chacha_xor_lanes_avx2(words, input, output, rounds); \
+    }
+
+CHACHA_VARIANTS(CHACHA_DEFINE_AVX2)
+
+#endif
@@ -0,0 +1,197 @@
+#include "chacha_internal.h"
+
+#if defined(__AVX512F__)
+
+#include <immintrin.h>
+
+// Number of blocks processed in parallel
+#define CHACHA_AVX512_LANES 16
+
+// Perform the ChaCha quarter round operation on sixteen blocks
+CHACHA_KERNEL_INLINE void chacha_quarter_round_avx512(
+    __m512i x[CHACHA_STATE_WORDS],
+    size_t a,
+    size_t b,
+    size_t c,
+    size_t d)
+{
+    x[a] = _mm512_add_epi32(x[a], x[b]); x[d] = _mm512_rol_epi32(_mm512_xor_si512(x[d], x[a]), 16);
+    x[c] = _mm512_add_epi32(x[c], x[d]); x[b] = _mm512_rol_epi32(_mm512_xor_si512(x[b], x[c]), 12);
+    x[a] = _mm512_add_epi32(x[a], x[b]); x[d] = _mm512_rol_epi32(_mm512_xor_si512(x[d], x[a]), 8);
+    x[c] = _mm512_add_epi32(x[c], x[d]); x[b] = _mm512_rol_epi32(_mm512_xor_si512(x[b], x[c]), 7);
+}
+
+// Transpose four words of four blocks within each 128-bit lane
+static inline void chacha_transpose_avx512(__m512i x[4])
+{
+    const __m512i t0 = _mm512_unpacklo_epi32(x[0], x[1]);
+    const __m512i t1 = _mm512_unpacklo_epi32(x[2], x[3]);
+    const __m512i t2 = _mm512_unpackhi_epi32(x[0], x[1]);
+    const __m512i t3 = _mm512_unpackhi_epi32(x[2], x[3]);
+
+    x[0] = _mm512_unpacklo_epi64(t0, t1);
+    x[1] = _mm512_unpackhi_epi64(t0, t1);
+    x[2] = _mm512_unpacklo_epi64(t2, t3);
+    x[3] = _mm512_unpackhi_epi64(t2, t3);
+}
+
+// XOR 64 bytes of keystream into the output
+static inline void chacha_xor64_avx512(__m512i k, const u8* input, u8* output)
+{
+    const __m512i m = _mm512_loadu_si512((const void *) input);
+    _mm512_storeu_si512((void *) output, _mm512_xor_si512(m, k));
+}
+
+// Perform a ChaCha odd and even round on sixteen blocks
+CHACHA_KERNEL_INLINE void chacha_double_round_avx512(__m512i x[CHACHA_STATE_WORDS])
+{
+    // Odd round
+    chacha_quarter_round_avx512(x, 0, 4, 8, 12);
+    chacha_quarter_round_avx512(x, 1, 5, 9, 13);
+    chacha_quarter_round_avx512(x, 2, 6, 10, 14);
+    chacha_quarter_round_avx512(x, 3, 7, 11, 15);
+
+    // Even round
+    chacha_quarter_round_avx512(x, 0, 5, 10, 15);
+    chacha_quarter_round_avx512(x, 1, 6, 11, 12);
+    chacha_quarter_round_avx512(x, 2, 7, 8, 13);
+    chacha_quarter_round_avx512(x, 3, 4, 9, 14);
+}
+
+// Generate sixteen blocks from word-sliced state `s` using `rounds` rounds
+// and XOR them into the blocks at input[j] and output[j]
+CHACHA_KERNEL_INLINE void chacha_blocks_avx512(
+    const __m512i s[CHACHA_STATE_WORDS],
+    const u8* input[CHACHA_AVX512_LANES],
+    u8* output[CHACHA_AVX512_LANES],
+    size_t rounds)
+{
+    __m512i x[CHACHA_STATE_WORDS];
+
+    for (size_t i = 0; i < CHACHA_STATE_WORDS; i++)
+    {
+        x[i] = s[i];
+    }
+
+    // Perform ChaCha rounds (fully unrolled)
+    CHACHA_DOUBLE_ROUNDS(rounds, chacha_double_round_avx512(x);)
+
+    for (size_t i = 0; i < CHACHA_STATE_WORDS; i++)
+    {
+        x[i] = _mm512_add_epi32(x[i], s[i]);
+    }
+
+    // Transpose each group of four words so 128-bit lane q of
+    // x[4g + j] holds words 4g..4g+3 of block 4q + j
+    chacha_transpose_avx512(x + 0);
+    chacha_transpose_avx512(x + 4);
+    chacha_transpose_avx512(x + 8);
+    chacha_transpose_avx512(x + 12);
+
+    // Transpose 128-bit lanes into whole blocks and XOR into the output
+    for (size_t j = 0; j < 4; j++)
+    {
+        const __m512i ab_lo = _mm512_shuffle_i32x4(x[j], x[4 + j], _MM_SHUFFLE(1, 0, 1, 0));
+        const __m512i ab_hi = _mm512_shuffle_i32x4(x[j], x[4 + j], _MM_SHUFFLE(3, 2, 3, 2));
+        const __m512i cd_lo = _mm512_shuffle_i32x4(x[8 + j], x[12 + j], _MM_SHUFFLE(1, 0, 1, 0));
+        const __m512i cd_hi = _mm512_shuffle_i32x4(x[8 + j], x[12 + j], _MM_SHUFFLE(3, 2, 3, 2));
+
+        const __m512i k[4] =
+        {
+            _mm512_shuffle_i32x4(ab_lo, cd_lo, _MM_SHUFFLE(2, 0, 2, 0)),
+            _mm512_shuffle_i32x4(ab_lo, cd_lo, _MM_SHUFFLE(3, 1, 3, 1)),
+            _mm512_shuffle_i32x4(ab_hi, cd_hi, _MM_SHUFFLE(2, 0, 2, 0)),
+            _mm512_shuffle_i32x4(ab_hi, cd_hi, _MM_SHUFFLE(3, 1, 3, 1)),
+        };
+
+        for (size_t q = 0; q < 4; q++)
+        {
+            chacha_xor64_avx512(k[q], input[4 * q + j], output[4 * q + j]);
+        }
+    }
+}
+
+// Crypt blocks sixteen at a time using AVX-512
+CHACHA_KERNEL_INLINE void chacha_xor_avx512(
+    const u32 state[CHACHA_STATE_WORDS],
+    const u8* input,
+    u8* output,
+    size_t blocks,
+    size_t counter_words,
+    size_t rounds)
+{
+    u32 counter[4] = { state[12], state[13], state[14], state[15] };
+    u32 words[4][CHACHA_LANES_MAX];
+
+    for (; blocks >= CHACHA_AVX512_LANES; blocks -= CHACHA_AVX512_LANES)
+    {
+        __m512i s[CHACHA_STATE_WORDS];
+        const u8* in[CHACHA_AVX512_LANES];
+        u8* out[CHACHA_AVX512_LANES];
+
+        // Load word-sliced initial state (one block per lane)
+        chacha_lane_counters(counter, counter_words, words, CHACHA_AVX512_LANES);
+
+        for (size_t i = 0; i < 12; i++)
+        {
+            s[i] = _mm512_set1_epi32((int) state[i]);
+        }
+
+        for (size_t i = 12; i < CHACHA_STATE_WORDS; i++)
+        {
+            s[i] = _mm512_loadu_si512((const void *) words[i - 12]);
+        }
+
+        for (size_t j = 0; j < CHACHA_AVX512_LANES; j++)
+        {
+            in[j] = input + j * CHACHA_BLOCK_SIZE;
+            out[j] = output + j * CHACHA_BLOCK_SIZE;
+        }
+
+        chacha_blocks_avx512(s, in, out, rounds);
+
+        input += CHACHA_AVX512_LANES * CHACHA_BLOCK_SIZE;
+        output += CHACHA_AVX512_LANES * CHACHA_BLOCK_SIZE;
+    }
+}
+
+// Crypt one block of each of sixteen independent streams using AVX-512
+CHACHA_KERNEL_INLINE void chacha_xor_lanes_avx512(
+    const u32 words[CHACHA_STATE_WORDS][CHACHA_LANES_MAX],
+    const u8* input[CHACHA_LANES_MAX],
+    u8* output[CHACHA_LANES_MAX],
+    size_t rounds)
+{
+    __m512i s[CHACHA_STATE_WORDS];
+
+    for (size_t i = 0; i < CHACHA_STATE_WORDS; i++)
+    {
+        s[i] = _mm512_loadu_si512((const void *) words[i]);
+    }
+
+    chacha_blocks_avx512(s, input, output, rounds);
+}
+
+// Instantiate kernels with fully unrolled rounds for each round count
+#define CHACHA_DEFINE_AVX512(rounds) \
+    void chacha_xor_avx512_##rounds( \
+        const u32 state[CHACHA_STATE_WORDS], \
+        const u8* input, \
+        u8* output, \
+        size_t blocks, \
+        size_t counter_words) \
+    { \
+        chacha_xor_avx512(state, input, output, blocks, counter_words, rounds); \
+    } \
+    \
+    void chacha_xor_lanes_avx512_##rounds( \
+        const u32 words[CHACHA_STATE_WORDS][CHACHA_LANES_MAX], \
+        const u8* input[CHACHA_LANES_MAX], \
+        u8* output[CHACHA_LANES_MAX]) \
+    { \
+        chacha_xor_lanes_avx512(words, input, output, rounds); \
+    }
+
+CHACHA_VARIANTS(CHACHA_DEFINE_AVX512)
+
+#endif
@@ -0,0 +1,757 @@
+#define _GNU_SOURCE
+#define _FILE_OFFSET_BITS 64
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+#include "chacha_internal.h"
+#include "chacha_container.h"
+#include "crc.h"
+
+// Keystream block holding the key check value (never reached by data)
+#define CHACHA_CONTAINER_CHECK_BLOCK U64_C(0xFFFFFFFFFFFFFFFF)
+
+// Maximum size (in bytes) of a container chunk (CRC index entries are
+// 32-bit and chunk sizes are stored in 32 bits)
+#define CHACHA_CONTAINER_CHUNK_SIZE_MAX (1U << 30)
+
+// Header and footer magic values
+static const u8 CHACHA_CONTAINER_MAGIC[8] = { 'C', 'H', 'A', 'C', 'H', 'A', 'C', 'F' };
+static const u8 CHACHA_CONTAINER_FOOTER_MAGIC[8] = { 'C', 'H', 'A', 'C', 'H', 'A', 'I', 'X' };
+
+// Read exactly `size` bytes at `offset` (retrying short reads)
+static bool chacha_container_pread(int fd, void* buffer, size_t size, u64 offset)
+{
+    while (size > 0)
+    {
+        const ssize_t n = pread(fd, buffer, size, (off_t) offset);
+
+        if (n <= 0)
+        {
+            if (n < 0 && errno == EINTR)
+            {
+                continue;
+            }
+
+            errno = n == 0 ? EBADMSG : errno;
+            return false;
+        }
+
+        buffer = OFFSET_PTR(buffer, n);
+        offset += (u64) n;
+        size -= (size_t) n;
+    }
+
+    return true;
+}
+
+// Write exactly `size` bytes at `offset` (retrying short writes)
+static bool chacha_container_pwrite(int fd, const void* buffer, size_t size, u64 offset)
+{
+    while (size > 0)
+    {
+        const ssize_t n = pwrite(fd, buffer, size, (off_t) offset);
+
+        if (n <= 0)
+        {
+            if (n < 0 && errno == EINTR)
+            {
+                continue;
+            }
+
+            errno = n == 0 ? EIO : errno;
+            return false;
+        }
+
+        buffer = OFFSET_CPTR(buffer, n);
+        offset += (u64) n;
+        size -= (size_t) n;
+    }
+
+    return true;
+}
+
+// Key a cipher context for the container variant
+static void chacha_container_keystream(const chacha_container* container, chacha_ctx* ctx)
+{
+    const chacha_variant variant = { container->rounds, CHACHA_KEY_SIZE, CHACHA_COUNTER_SIZE };
+
+    chacha_init_variant(ctx, container->key, &variant);
+}
+
+// Calculate the key check value (keystream from a block data never reaches)
+static u64 chacha_container_check(const chacha_container* container)
+{
+    u8 check[8] = { 0 };
+    chacha_ctx ctx;
+
+    chacha_container_keystream(container, &ctx);
+    chacha_seek_block(&ctx, container->nonce, CHACHA_CONTAINER_CHECK_BLOCK);
+    chacha_update(&ctx, check, check, sizeof(check));
+    chacha_wipe(&ctx);
+
+    return load64_le(check);
+}
+
+// File offset of a chunk's crypted data
+static inline u64 chacha_container_chunk_offset(const chacha_container* container, size_t chunk)
+{
+    return CHACHA_CONTAINER_HEADER_SIZE + (u64) chunk * container->chunk_size;
+}
+
+// Size (in bytes) of a chunk's data
+static inline size_t chacha_container_chunk_size(const chacha_container* container, size_t chunk)
+{
+    return (size_t) MIN(container->size - (u64) chunk * container->chunk_size, container->chunk_size);
+}
+
+// Read the crypted data of a chunk and check it against the index
+static bool chacha_container_chunk_read(const chacha_container* container, size_t chunk, u8* buffer)
+{
+    const size_t size = chacha_container_chunk_size(container, chunk);
+
+    if (!chacha_container_pread(container->fd, buffer, size, chacha_container_chunk_offset(container, chunk)))
+    {
+        return false;
+    }
+
+    if (crc32c(buffer, size) != container->crcs[chunk])
+    {
+        errno = EBADMSG;
+        return false;
+    }
+
+    return true;
+}
+
+// Grow the chunk index to hold at least `count` entries
+static bool chacha_container_reserve(chacha_container* container, size_t count)
+{
+    if (count <= container->capacity)
+    {
+        return true;
+    }
+
+    const size_t capacity = MAX(count, 2 * container->capacity);
+    u32* const crcs = (u32*) realloc(container->crcs, capacity * sizeof(u32));
+
+    if (crcs == NULL)
+    {
+        return false;
+    }
+
+    container->crcs = crcs;
+    container->capacity = capacity;
+
+    return true;
+}
+
+// Close the file and securely teardown the container
+static void chacha_container_teardown(chacha_container* container)
+{
+    if (container->fd >= 0)
+    {
+        close(container->fd);
+    }
+
+    free(container->crcs);
+    memwipe(container, sizeof(*container));
+    container->fd = -1;
+}
+
+// Write the container header
+static bool chacha_container_write_header(const chacha_container* container)
+{
+    u8 header[CHACHA_CONTAINER_HEADER_SIZE] = { 0 };
+
+    memcpy(header, CHACHA_CONTAINER_MAGIC, sizeof(CHACHA_CONTAINER_MAGIC));
+    store32_le(header + 8, CHACHA_CONTAINER_VERSION);
+    store32_le(header + 12, (u32) container->rounds);
+    store32_le(header + 16, (u32) container->chunk_size);
+    store64_le(header + 24, container->nonce);
+    store64_le(header + 32, chacha_container_check(container));
+    store32_le(header + 60, crc32c(header, 60));
+
+    return chacha_container_pwrite(container->fd, header, sizeof(header), 0);
+}
+
+// Write the chunk index and footer after the data and trim the file
+static bool chacha_container_write_index(const chacha_container* container)
+{
+    const size_t index_size = container->count * sizeof(u32);
+    const u64 offset = CHACHA_CONTAINER_HEADER_SIZE + container->size;
+    u8* const index = (u8*) malloc(index_size + CHACHA_CONTAINER_FOOTER_SIZE);
+    bool success = false;
+
+    if (index == NULL)
+    {
+        return false;
+    }
+
+    u8* const footer = index + index_size;
+
+    for (size_t i = 0; i < container->count; i++)
+    {
+        store32_le(index + i * sizeof(u32), container->crcs[i]);
+    }
+
+    memset(footer, 0, CHACHA_CONTAINER_FOOTER_SIZE);
+    store64_le(footer + 0, container->size);
+    store64_le(footer + 8, (u64) container->count);
+    store32_le(footer + 16, crc32c(index, index_size));
+    store32_le(footer + 20, crc32c(footer, 20));
+    memcpy(footer + 24, CHACHA_CONTAINER_FOOTER_MAGIC, sizeof(CHACHA_CONTAINER_FOOTER_MAGIC));
+
+    success = chacha_container_pwrite(container->fd, index, index_size + CHACHA_CONTAINER_FOOTER_SIZE, offset) &&
+        ftruncate(container->fd, (off_t) (offset + index_size + CHACHA_CONTAINER_FOOTER_SIZE)) == 0;
+
+    free(index);
+
+    return success;
+}
+
+// Open and validate an existing container (key may be NULL)
+static bool chacha_container_load(
+    chacha_container* container,
+    const char* path,
+    const u8* key,
+    bool append)
+{
+    u8 header[CHACHA_CONTAINER_HEADER_SIZE];
+    u8 footer[CHACHA_CONTAINER_FOOTER_SIZE];
+    u8* index = NULL;
+    struct stat sb;
+
+    memset(container, 0, sizeof(*container));
+    container->fd = open(path, append ? O_RDWR : O_RDONLY);
+    container->writable = append;
+
+    // Handle file failure
+    if (container->fd < 0 || fstat(container->fd, &sb) != 0)
+    {
+        goto error;
+    }
+
+    const u64 file_size = (u64) sb.st_size;
+
+    if (file_size < CHACHA_CONTAINER_HEADER_SIZE + CHACHA_CONTAINER_FOOTER_SIZE)
+    {
+        errno = EBADMSG;
+        goto error;
+    }
+
+    // Validate header
+    if (!chacha_container_pread(container->fd, header, sizeof(header), 0))
+    {
+        goto error;
+    }
+
+    container->rounds = load32_le(header + 12);
+    container->chunk_size = load32_le(header + 16);
+    container->nonce = load64_le(header + 24);
+
+    if (memcmp(header, CHACHA_CONTAINER_MAGIC, sizeof(CHACHA_CONTAINER_MAGIC)) != 0 ||
+        load32_le(header + 60) != crc32c(header, 60) ||
+        load32_le(header + 8) != CHACHA_CONTAINER_VERSION ||
+        (container->rounds != 8 && container->rounds != 12 && container->rounds != 20) ||
+        container->chunk_size == 0 ||
+        container->chunk_size % CHACHA_BLOCK_SIZE != 0 ||
+        container->chunk_size > CHACHA_CONTAINER_CHUNK_SIZE_MAX)
+    {
+        errno = EBADMSG;
+        goto error;
+    }
+
+    // Validate footer and layout
+    if (!chacha_container_pread(container->fd, footer, sizeof(footer), file_size - sizeof(footer)))
+    {
+        goto error;
+    }
+
+    container->size = load64_le(footer + 0);
+
+    const u64 count = load64_le(footer + 8);
+    const u64 data_size = file_size - CHACHA_CONTAINER_HEADER_SIZE - CHACHA_CONTAINER_FOOTER_SIZE;
+
+    if (memcmp(footer + 24, CHACHA_CONTAINER_FOOTER_MAGIC, sizeof(CHACHA_CONTAINER_FOOTER_MAGIC)) != 0 ||
+        load32_le(footer + 20) != crc32c(footer, 20) ||
+        container->size > data_size ||
+        count != (container->size + container->chunk_size - 1) / container->chunk_size ||
+        count * sizeof(u32) != data_size - container->size)
+    {
+        errno = EBADMSG;
+        goto error;
+    }
+
+    // Load chunk index
+    const size_t index_size = (size_t) count * sizeof(u32);
+
+    index = (u8*) malloc(MAX(index_size, 1));
+    if (index == NULL || !chacha_container_reserve(container, (size_t) count))
+    {
+        goto error;
+    }
+
+    if (!chacha_container_pread(container->fd, index, index_size, CHACHA_CONTAINER_HEADER_SIZE + container->size))
+    {
+        goto error;
+    }
+
+    if (load32_le(footer + 16) != crc32c(index, index_size))
+    {
+        errno = EBADMSG;
+        goto error;
+    }
+
+    for (size_t i = 0; i < (size_t) count; i++)
+    {
+        container->crcs[i] = load32_le(index + i * sizeof(u32));
+    }
+
+    container->count = (size_t) count;
+    free(index);
+
+    // Check the key against the header
+    if (key != NULL)
+    {
+        memcpy(container->key, key, CHACHA_KEY_SIZE);
+        container->keyed = true;
+
+        if (load64_le(header + 32) != chacha_container_check(container))
+        {
+            errno = EACCES;
+            fprintf(stderr, "[chacha_container_open] opening '%s' failed: key does not match\n", path);
+            chacha_container_teardown(container);
+            return false;
+        }
+    }
+
+    return true;
+
+error:
+    fprintf(stderr, "[chacha_container_open] opening '%s' failed: %s\n",
+            path, strerror(errno));
+
+    free(index);
+    chacha_container_teardown(container);
+
+    return false;
+}
+
+// Create a new (empty) container file
+bool chacha_container_create(
+    chacha_container* container,
+    const char* path,
+    const u8 key[CHACHA_KEY_SIZE],
+    size_t chunk_size)
+{
+    memset(container, 0, sizeof(*container));
+    container->fd = -1;
+
+    if (chunk_size == 0)
+    {
+        chunk_size = CHACHA_CONTAINER_CHUNK_SIZE;
+    }
+
+    if (chunk_size % CHACHA_BLOCK_SIZE != 0 || chunk_size > CHACHA_CONTAINER_CHUNK_SIZE_MAX)
+    {
+        errno = EINVAL;
+        goto error;
+    }
+
+    container->fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0666);
+    if (container->fd < 0)
+    {
+        goto error;
+    }
+
+    // Fresh random nonce so a key may be reused across containers
+    container->writable = true;
+    container->keyed = true;
+    container->dirty = true;
+    memcpy(container->key, key, CHACHA_KEY_SIZE);
+    container->rounds = CHACHA_ROUNDS;
+    container->chunk_size = chunk_size;
+    chacha_rand(&container->nonce, sizeof(container->nonce));
+
+    // Write an empty index so the new container is valid right away
+    if (!chacha_container_write_header(container) || !chacha_container_write_index(container))
+    {
+        goto error;
+    }
+
+    container->dirty = false;
+
+    return true;
+
+error:
+    fprintf(stderr, "[chacha_container_create] creating '%s' failed: %s\n",
+            path, strerror(errno));
+
+    chacha_container_teardown(container);
+
+    return false;
+}
+
+// Open an existing container file
+bool chacha_container_open(
+    chacha_container* container,
+    const char* path,
+    const u8 key[CHACHA_KEY_SIZE],
+    bool append)
+{
+    return chacha_container_load(container, path, key, append);
+}
+
+// Open an existing container file without the key
+bool chacha_container_open_unkeyed(chacha_container* container, const char* path)
+{
+    return chacha_container_load(container, path, NULL, false);
+}
+
+// Encrypt and append data to the end of a container
+bool chacha_container_append(
+    chacha_container* container,
+    const void* data,
+    size_t size)
+{
+    const size_t buffer_size = MIN(size, container->chunk_size);
+    u8* buffer = NULL;
+    chacha_ctx ctx;
+    bool success = true;
+
+    if (!container->writable || !container->keyed)
+    {
+        errno = EBADF;
+        goto error;
+    }
+
+    if (size == 0)
+    {
+        return true;
+    }
+
+    buffer = (u8*) malloc(buffer_size);
+    if (buffer == NULL)
+    {
+        goto error;
+    }
+
+    // Continue the keystream at the end of the data
+    chacha_container_keystream(container, &ctx);
+    chacha_seek_offset(&ctx, container->nonce, container->size);
+
+    // Crypt and write data up to each chunk boundary
+    while (size > 0)
+    {
+        const size_t inner = (size_t) (container->size % container->chunk_size);
+        const size_t n = MIN(size, container->chunk_size - inner);
+
+        // Crypt and checksum the data in one pass (continuing the CRC of a
+        // partial last chunk)
+        const u32 crc = chacha_update_crc32c(&ctx, data, buffer, n, inner == 0 ? 0 : container->crcs[container->count - 1]);
+
+        if (!chacha_container_pwrite(container->fd, buffer, n, CHACHA_CONTAINER_HEADER_SIZE + container->size))
+        {
+            chacha_wipe(&ctx);
+            goto error;
+        }
+
+        // Start a new chunk or update the CRC of the partial last chunk
+        if (inner == 0)
+        {
+            if (!chacha_container_reserve(container, container->count + 1))
+            {
+                chacha_wipe(&ctx);
+                goto error;
+            }
+
+            container->count++;
+        }
+
+        container->crcs[container->count - 1] = crc;
+
+        container->size += n;
+        container->dirty = true;
+
+        data = OFFSET_CPTR(data, n);
+        size -= n;
+    }
+
+    chacha_wipe(&ctx);
+
+    goto exit;
+
+error:
+    fprintf(stderr, "[chacha_container_append] appending at offset %llu failed: %s\n",
+            (unsigned long long) container->size, strerror(errno));
+
+    success = false;
+
+exit:
+    if (buffer != NULL)
+    {
+        memwipe(buffer, buffer_size);
+        free(buffer);
+    }
+
+    return success;
+}
+
+// Decrypt a range of plaintext
+bool chacha_container_read(
+    chacha_container* container,
+    u64 offset,
+    void* data,
+    size_t size,
+    size_t threads)
+{
+    size_t error_chunk = 0;
+    int error = 0;
+
+    if (!container->keyed)
+    {
+        error = EBADF;
+        goto error;
+    }
+
+    if (offset > container->size || size > container->size - offset)
+    {
+        error = EINVAL;
+        goto error;
+    }
+
+    if (size == 0)
+    {
+        return true;
+    }
+
+    const u64 end = offset + size;
+    const size_t first = (size_t) (offset / container->chunk_size);
+    const size_t last = (size_t) ((end - 1) / container->chunk_size);
+    const size_t chunks = last - first + 1;
+
+#if defined(_OPENMP)
+    if (threads == 0)
+    {
+        threads = (size_t) omp_get_max_threads();
+    }
+#endif
+
+    threads = MIN(MAX(threads, 1), chunks);
+
+    // Each worker reads, checks, and decrypts whole chunks of the range
+    #pragma omp parallel num_threads(threads) if(threads > 1) default(shared)
+    {
+        u8* const buffer = (u8*) malloc(container->chunk_size);
+        int worker_error = buffer == NULL ? errno : 0;
+        size_t worker_chunk = first;
+        chacha_ctx ctx;
+
+        chacha_container_keystream(container, &ctx);
+
+        #pragma omp for schedule(dynamic)
+        for (size_t chunk = first; chunk <= last; chunk++)
+        {
+            if (worker_error)
+            {
+                continue;
+            }
+
+            if (!chacha_container_chunk_read(container, chunk, buffer))
+            {
+                worker_error = errno;
+                worker_chunk = chunk;
+                continue;
+            }
+
+            // Decrypt the part of the chunk inside the range
+            const u64 chunk_offset = (u64) chunk * container->chunk_size;
+            const u64 lo = MAX(offset, chunk_offset);
+            const u64 hi = MIN(end, chunk_offset + container->chunk_size);
+
+            chacha_seek_offset(&ctx, container->nonce, lo);
+            chacha_update(
+                &ctx,
+                buffer + (lo - chunk_offset),
+                OFFSET_PTR(data, lo - offset),
+                (size_t) (hi - lo));
+        }
+
+        // Report the first failing chunk
+        if (worker_error)
+        {
+            #pragma omp critical(container_error)
+            {
+                if (!error || worker_chunk < error_chunk)
+                {
+                    error = worker_error;
+                    error_chunk = worker_chunk;
+                }
+            }
+        }
+
+        // Teardown worker context and buffer
+        chacha_wipe(&ctx);
+
+        if (buffer != NULL)
+        {
+            memwipe(buffer, container->chunk_size);
+            free(buffer);
+        }
+    }
+
+    if (error)
+    {
+        fprintf(stderr, "[chacha_container_read] reading chunk %zu failed: %s\n",
+                error_chunk, strerror(error));
+
+        memwipe(data, size);
+        return false;
+    }
+
+    return true;
+
+error:
+    fprintf(stderr, "[chacha_container_read] reading %zu bytes at offset %llu failed: %s\n",
+            size, (unsigned long long) offset, strerror(error));
+
+    return false;
+}
+
+// Verify the CRC of every chunk
+bool chacha_container_verify(chacha_container* container, size_t threads)
+{
+    const size_t chunks = container->count;
+    size_t error_chunk = 0;
+    size_t corrupt = 0;
+    int error = 0;
+
+#if defined(_OPENMP)
+    if (threads == 0)
+    {
+        threads = (size_t) omp_get_max_threads();
+    }
+#endif
+
+    threads = MIN(MAX(threads, 1), MAX(chunks, 1));
+
+    // Each worker reads and checks whole chunks (no key required)
+    #pragma omp parallel num_threads(threads) if(threads > 1) default(shared)
+    {
+        u8* const buffer = (u8*) malloc(container->chunk_size);
+        size_t worker_chunk = 0;
+        size_t worker_corrupt = 0;
+        int worker_error = buffer == NULL ? errno : 0;
+
+        #pragma omp for schedule(dynamic)
+        for (size_t chunk = 0; chunk < chunks; chunk++)
+        {
+            if (buffer == NULL || chacha_container_chunk_read(container, chunk, buffer))
+            {
+                continue;
+            }
+
+            // Keep checking past failing chunks (reporting the first)
+            if (!worker_error || chunk < worker_chunk)
+            {
+                worker_error = errno;
+                worker_chunk = chunk;
+            }
+
+            if (errno == EBADMSG)
+            {
+                worker_corrupt++;
+            }
+        }
+
+        #pragma omp critical(container_error)
+        {
+            corrupt += worker_corrupt;
+
+            if (worker_error && (!error || worker_chunk < error_chunk))
+            {
+                error = worker_error;
+                error_chunk = worker_chunk;
+            }
+        }
+
+        free(buffer);
+    }
+
+    if (error)
+    {
+        fprintf(stderr, "[chacha_container_verify] chunk %zu failed: %s (%zu of %zu chunks corrupt)\n",
+                error_chunk, strerror(error), corrupt, chunks);
+
+        return false;
+    }
+
+    return true;
+}
+
+// Write the index and footer (if changed) and flush the container to disk
+bool chacha_container_sync(chacha_container* container)
+{
+    if (!container->writable)
+    {
+        errno = EBADF;
+        goto error;
+    }
+
+    if (container->dirty)
+    {
+        if (!chacha_container_write_index(container))
+        {
+            goto error;
+        }
+
+        container->dirty = false;
+    }
+
+    if (fdatasync(container->fd) != 0)
+    {
+        goto error;
+    }
+
+    return true;
+
+error:
+    fprintf(stderr, "[chacha_container_sync] syncing failed: %s\n", strerror(errno));
+
+    return false;
+}
+
+// Write the index and footer, close the file, and teardown the container
+bool chacha_container_close(chacha_container* container)
+{
+    bool success = true;
+
+    if (container->writable && container->dirty && !chacha_container_write_index(container))
+    {
+        fprintf(stderr, "[chacha_container_close] writing index failed: %s\n", strerror(errno));
+        success = false;
+    }
+
+    if (container->fd >= 0 && close(container->fd) != 0 && success)
+    {
+        fprintf(stderr, "[chacha_container_close] closing failed: %s\n", strerror(errno));
+        success = false;
+    }
+
+    container->fd = -1;
+    chacha_container_teardown(container);
+
+    return success;
+}
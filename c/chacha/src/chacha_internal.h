@@ -0,0 +1,164 @@
+#pragma once
+
+#include "chacha.h"
+#include "cpu.h"
+
+// Block size (in bytes) of a ChaCha keystream block
+// MUST be 64.
+#define CHACHA_BLOCK_SIZE 64
+
+// Number of 32-bit (4-byte) words to use for the
+// incrementing the internal stream counter (default variant).
+// MUST be 1, 2, or 4.
+#define CHACHA_COUNTER_WORDS (CHACHA_COUNTER_SIZE / 4)
+
+// Round counts with specialized kernels (X-macro: X(rounds))
+#define CHACHA_VARIANTS(X) X(8) X(12) X(20)
+
+// Number of round counts with specialized kernels
+#define CHACHA_VARIANT_COUNT 3
+
+// Index of a supported round count within CHACHA_VARIANTS
+#define CHACHA_VARIANT_INDEX(rounds) ((rounds) == 8 ? 0 : (rounds) == 12 ? 1 : 2)
+
+// Expand `op` once per double round of a supported round count
+// (fully unrolled rounds without a loop counter)
+#define CHACHA_DOUBLE_ROUNDS_8(op) op op op op
+#define CHACHA_DOUBLE_ROUNDS_12(op) CHACHA_DOUBLE_ROUNDS_8(op) op op
+#define CHACHA_DOUBLE_ROUNDS_20(op) CHACHA_DOUBLE_ROUNDS_12(op) CHACHA_DOUBLE_ROUNDS_8(op)
+
+// Kernel bodies shared by every round count instantiation.
+// Forced inline so each instantiation is specialized for its round count.
+#if defined(__GNUC__)
+#define CHACHA_KERNEL_INLINE static inline __attribute__((always_inline))
+#else
+#define CHACHA_KERNEL_INLINE static inline
+#endif
+
+// Perform the double rounds of a supported round count using `op`.
+// `rounds` is a constant in instantiated kernels so only one case remains.
+#define CHACHA_DOUBLE_ROUNDS(rounds, op) \
+    switch (rounds) \
+    { \
+        case 8: CHACHA_DOUBLE_ROUNDS_8(op) break; \
+        case 12: CHACHA_DOUBLE_ROUNDS_12(op) break; \
+        default: CHACHA_DOUBLE_ROUNDS_20(op) break; \
+    }
+
+// Maximum number of blocks (lanes) processed by one vector kernel call
+#define CHACHA_LANES_MAX 16
+
+// Increment the low `words` words of the nonce as little-endian counter
+static inline void chacha_increment(u32 counter[4], size_t words)
+{
+    for (size_t i = 0; i < words; i++)
+    {
+        if (++counter[i])
+        {
+            break;
+        }
+    }
+}
+
+// Advance the low `words` words of the nonce as little-endian counter by `blocks`
+static inline void chacha_advance(u32 counter[4], size_t words, u64 blocks)
+{
+    u64 carry = 0;
+
+    for (size_t i = 0; i < words; i++)
+    {
+        const u64 sum = (u64) counter[i] + (i < 2 ? (u32) (blocks >> (32 * i)) : 0) + carry;
+
+        counter[i] = (u32) sum;
+        carry = sum >> 32;
+    }
+}
+
+// Fill the nonce/counter words of `lanes` consecutive blocks in
+// word-sliced layout (words[w][lane]) and advance the counter past them
+static inline void chacha_lane_counters(
+    u32 counter[4],
+    size_t counter_words,
+    u32 words[4][CHACHA_LANES_MAX],
+    size_t lanes)
+{
+    for (size_t lane = 0; lane < lanes; lane++)
+    {
+        words[0][lane] = counter[0];
+        words[1][lane] = counter[1];
+        words[2][lane] = counter[2];
+        words[3][lane] = counter[3];
+
+        chacha_increment(counter, counter_words);
+    }
+}
+
+// Crypt data from the start of a keystream block using prefetched blocks.
+// Returns the number of bytes crypted (the rest is generated inline).
+size_t chacha_prefetch_xor(
+    chacha_ctx* ctx,
+    const u8* input,
+    u8* output,
+    size_t size);
+
+// Drop prefetched keystream after seeking a prefetching context
+void chacha_prefetch_restart(chacha_ctx* ctx);
+
+// ChaCha keystream kernel function type.
+// XORs `blocks` consecutive keystream blocks (starting at the counter in
+// `state`, incremented over `counter_words` words) with `input` into
+// `output`. Does not advance the counter.
+typedef void (*chacha_kernel_t)(
+    const u32 state[CHACHA_STATE_WORDS],
+    const u8* input,
+    u8* output,
+    size_t blocks,
+    size_t counter_words);
+
+// ChaCha multi-stream kernel function type.
+// XORs one keystream block of each lane with input[lane] into output[lane],
+// where lane state is word-sliced (words[w][lane]). Does not advance the
+// counters.
+typedef void (*chacha_lanes_t)(
+    const u32 words[CHACHA_STATE_WORDS][CHACHA_LANES_MAX],
+    const u8* input[CHACHA_LANES_MAX],
+    u8* output[CHACHA_LANES_MAX]);
+
+// Declare the kernels of one instruction set for one round count
+#define CHACHA_DECLARE_KERNELS(isa, rounds) \
+    void chacha_xor_##isa##_##rounds( \
+        const u32 state[CHACHA_STATE_WORDS], \
+        const u8* input, \
+        u8* output, \
+        size_t blocks, \
+        size_t counter_words); \
+    void chacha_xor_lanes_##isa##_##rounds( \
+        const u32 words[CHACHA_STATE_WORDS][CHACHA_LANES_MAX], \
+        const u8* input[CHACHA_LANES_MAX], \
+        u8* output[CHACHA_LANES_MAX]);
+
+#define CHACHA_DECLARE_SSE2(rounds) CHACHA_DECLARE_KERNELS(sse2, rounds)
+#define CHACHA_DECLARE_AVX2(rounds) CHACHA_DECLARE_KERNELS(avx2, rounds)
+#define CHACHA_DECLARE_AVX512(rounds) CHACHA_DECLARE_KERNELS(avx512, rounds)
+
+// Instruction set specific kernels (chacha_xor_<isa>_<rounds> and
+// chacha_xor_lanes_<isa>_<rounds> for each round count).
+// Each is built in its own translation unit with its own target flags and
+// MUST only be called when the CPU feature noted above it is available.
+
+#if CPU_X86
+// Crypt blocks four at a time (`blocks` MUST be a multiple of 4) or one
+// block of each of four independent streams using SSE2
+// Requires CPU_FEATURE_SSE2
+CHACHA_VARIANTS(CHACHA_DECLARE_SSE2)
+
+// Crypt blocks eight at a time (`blocks` MUST be a multiple of 8) or one
+// block of each of eight independent streams using AVX2
+// Requires CPU_FEATURE_AVX2
+CHACHA_VARIANTS(CHACHA_DECLARE_AVX2)
+
+// Crypt blocks sixteen at a time (`blocks` MUST be a multiple of 16) or one
+// block of each of sixteen independent streams using AVX-512
+// Requires CPU_FEATURE_AVX512F
+CHACHA_VARIANTS(CHACHA_DECLARE_AVX512)
+#endif
@@ -0,0 +1,386 @@
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#include <pthread.h>
+
+#include "chacha_internal.h"
+
+// Default number of keystream blocks held by a prefetch ring (64 KiB)
+#define CHACHA_PREFETCH_BLOCKS 1024
+
+// Number of keystream blocks generated per producer step.
+// MUST be a multiple of the widest vector kernel (CHACHA_LANES_MAX).
+#define CHACHA_PREFETCH_BATCH CHACHA_LANES_MAX
+
+// Size (in bytes) separating producer and consumer owned fields
+#define CHACHA_PREFETCH_LINE_SIZE 64
+
+// Zero input XORed with keystream to generate it in place
+static const u8 CHACHA_PREFETCH_ZERO[CHACHA_PREFETCH_BATCH * CHACHA_BLOCK_SIZE];
+
+// Single-producer/single-consumer keystream ring.
+// Positions are free running block counts; slot i holds position i modulo
+// the capacity. Each slot is tagged with the counter it was generated for,
+// so blocks left over from before a seek are detected and dropped.
+struct chacha_prefetch
+{
+    // Keystream blocks and the counter words of each
+    u8 (*blocks)[CHACHA_BLOCK_SIZE];
+    u32 (*tags)[4];
+    size_t capacity;
+
+    // Producer side: private generator and published position
+    chacha_ctx generator;
+    u64 head;
+    u8 head_pad[CHACHA_PREFETCH_LINE_SIZE];
+
+    // Consumer side: consumed position and counters
+    u64 tail;
+    chacha_prefetch_stats stats;
+    u8 tail_pad[CHACHA_PREFETCH_LINE_SIZE];
+
+    // Requests from the consumer (flags read without the lock)
+    u32 restart;
+    u32 restart_counter[4];
+    u32 stop;
+    u32 waiting;
+
+    // Helper thread (sleeps while the ring is full)
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    pthread_t thread;
+    bool threaded;
+};
+
+// Number of free slots in the ring (as seen by the producer)
+static inline size_t chacha_prefetch_space(const chacha_prefetch* p)
+{
+    const u64 tail = __atomic_load_n(&p->tail, __ATOMIC_SEQ_CST);
+
+    return p->capacity - (size_t) (p->head - tail);
+}
+
+// Generate keystream into free slots until the ring is full.
+// Returns the number of blocks published.
+static size_t chacha_prefetch_produce(chacha_prefetch* p)
+{
+    size_t produced = 0;
+
+    while (!__atomic_load_n(&p->stop, __ATOMIC_ACQUIRE))
+    {
+        // Move the generator to where the consumer now reads
+        if (__atomic_load_n(&p->restart, __ATOMIC_ACQUIRE))
+        {
+            pthread_mutex_lock(&p->lock);
+            memcpy(p->generator.state + 12, p->restart_counter, sizeof(p->restart_counter));
+            __atomic_store_n(&p->restart, 0, __ATOMIC_RELAXED);
+            pthread_mutex_unlock(&p->lock);
+        }
+
+        if (chacha_prefetch_space(p) < CHACHA_PREFETCH_BATCH)
+        {
+            break;
+        }
+
+        // Tag and generate a batch of consecutive blocks
+        const size_t slot = (size_t) (p->head % p->capacity);
+        u32 counter[4];
+
+        memcpy(counter, p->generator.state + 12, sizeof(counter));
+
+        for (size_t i = 0; i < CHACHA_PREFETCH_BATCH; i++)
+        {
+            memcpy(p->tags[slot + i], counter, sizeof(counter));
+            chacha_increment(counter, p->generator.counter_words);
+        }
+
+        chacha_update(
+            &p->generator,
+            CHACHA_PREFETCH_ZERO,
+            p->blocks[slot],
+            sizeof(CHACHA_PREFETCH_ZERO));
+
+        // Publish the batch to the consumer
+        __atomic_store_n(&p->head, p->head + CHACHA_PREFETCH_BATCH, __ATOMIC_RELEASE);
+        produced += CHACHA_PREFETCH_BATCH;
+    }
+
+    return produced;
+}
+
+// Helper thread keeping the ring full
+static void* chacha_prefetch_thread(void* arg)
+{
+    chacha_prefetch* const p = (chacha_prefetch*) arg;
+
+    while (!__atomic_load_n(&p->stop, __ATOMIC_ACQUIRE))
+    {
+        if (chacha_prefetch_produce(p) > 0)
+        {
+            continue;
+        }
+
+        // Ring is full: sleep until half of it is consumed (or a request)
+        pthread_mutex_lock(&p->lock);
+        __atomic_store_n(&p->waiting, 1, __ATOMIC_SEQ_CST);
+
+        while (!p->stop && !p->restart && chacha_prefetch_space(p) < p->capacity / 2)
+        {
+            pthread_cond_wait(&p->wake, &p->lock);
+        }
+
+        __atomic_store_n(&p->waiting, 0, __ATOMIC_RELAXED);
+        pthread_mutex_unlock(&p->lock);
+    }
+
+    return NULL;
+}
+
+// Wake the helper thread (caller holds the lock)
+static inline void chacha_prefetch_signal(chacha_prefetch* p)
+{
+    if (p->threaded)
+    {
+        pthread_cond_signal(&p->wake);
+    }
+}
+
+// Ask the producer to continue from the counter of `ctx`, advanced by `blocks`
+static void chacha_prefetch_request(const chacha_ctx* ctx, u64 blocks)
+{
+    chacha_prefetch* const p = ctx->prefetch;
+
+    pthread_mutex_lock(&p->lock);
+
+    memcpy(p->restart_counter, ctx->state + 12, sizeof(p->restart_counter));
+    chacha_advance(p->restart_counter, ctx->counter_words, blocks);
+    __atomic_store_n(&p->restart, 1, __ATOMIC_RELEASE);
+
+    chacha_prefetch_signal(p);
+    pthread_mutex_unlock(&p->lock);
+}
+
+// Drop the prefetched keystream after a seek and restart the producer
+void chacha_prefetch_restart(chacha_ctx* ctx)
+{
+    chacha_prefetch* const p = ctx->prefetch;
+    const u64 head = __atomic_load_n(&p->head, __ATOMIC_ACQUIRE);
+
+    // Blocks published after this are caught by their tags
+    p->stats.discarded += head - p->tail;
+    __atomic_store_n(&p->tail, head, __ATOMIC_SEQ_CST);
+
+    chacha_prefetch_request(ctx, 0);
+}
+
+// Crypt data from the start of a keystream block using prefetched blocks.
+// A final partial block is kept in the keystream window of `ctx`.
+// Returns the number of bytes crypted (the rest is generated inline).
+size_t chacha_prefetch_xor(
+    chacha_ctx* ctx,
+    const u8* input,
+    u8* output,
+    size_t size)
+{
+    chacha_prefetch* const p = ctx->prefetch;
+    const u64 head = __atomic_load_n(&p->head, __ATOMIC_ACQUIRE);
+    u64 tail = p->tail;
+    size_t offset = 0;
+
+    while (offset < size && tail != head)
+    {
+        const size_t slot = (size_t) (tail++ % p->capacity);
+        const u32* const tag = p->tags[slot];
+        const u32* const counter = ctx->state + 12;
+
+        // Drop blocks generated for another stream position
+        if (tag[0] != counter[0] || tag[1] != counter[1] ||
+            tag[2] != counter[2] || tag[3] != counter[3])
+        {
+            p->stats.discarded++;
+            continue;
+        }
+
+        if (size - offset >= CHACHA_BLOCK_SIZE)
+        {
+            memxor(output + offset, input + offset, p->blocks[slot], CHACHA_BLOCK_SIZE);
+            offset += CHACHA_BLOCK_SIZE;
+        }
+        else
+        {
+            memcpy(ctx->stream, p->blocks[slot], CHACHA_BLOCK_SIZE);
+            memxor(output + offset, input + offset, ctx->stream, size - offset);
+            ctx->index = size - offset;
+            offset = size;
+        }
+
+        chacha_increment(ctx->state + 12, ctx->counter_words);
+        p->stats.hits++;
+    }
+
+    // Release consumed slots, waking the producer once half the ring is free
+    __atomic_store_n(&p->tail, tail, __ATOMIC_SEQ_CST);
+
+    if (__atomic_load_n(&p->waiting, __ATOMIC_SEQ_CST) &&
+        p->capacity - (size_t) (head - tail) >= p->capacity / 2)
+    {
+        pthread_mutex_lock(&p->lock);
+        chacha_prefetch_signal(p);
+        pthread_mutex_unlock(&p->lock);
+    }
+
+    // Ring ran dry: the rest is generated inline, so move the producer past it
+    if (offset < size)
+    {
+        const u64 blocks = (size - offset + CHACHA_BLOCK_SIZE - 1) / CHACHA_BLOCK_SIZE;
+
+        p->stats.misses += blocks;
+        chacha_prefetch_request(ctx, blocks);
+    }
+
+    return offset;
+}
+
+// Start pre-generating keystream of a context into a prefetch ring
+bool chacha_prefetch_start(chacha_ctx* ctx, size_t blocks, bool thread)
+{
+    chacha_prefetch* p = NULL;
+    int error = 0;
+
+    if (ctx->prefetch != NULL)
+    {
+        error = EBUSY;
+        goto error;
+    }
+
+    // Round the ring up to whole batches
+    if (blocks == 0)
+    {
+        blocks = CHACHA_PREFETCH_BLOCKS;
+    }
+
+    blocks = (blocks + CHACHA_PREFETCH_BATCH - 1) / CHACHA_PREFETCH_BATCH * CHACHA_PREFETCH_BATCH;
+
+    p = (chacha_prefetch*) calloc(1, sizeof(*p));
+    if (p == NULL)
+    {
+        error = errno;
+        goto error;
+    }
+
+    p->capacity = blocks;
+
+    if ((error = posix_memalign((void**) &p->blocks, CHACHA_PREFETCH_LINE_SIZE, blocks * CHACHA_BLOCK_SIZE)) != 0)
+    {
+        p->blocks = NULL;
+        goto error;
+    }
+
+    p->tags = calloc(blocks, sizeof(*p->tags));
+    if (p->tags == NULL)
+    {
+        error = errno;
+        goto error;
+    }
+
+    // The producer generates from its own copy of the key and counter
+    p->generator = *ctx;
+    p->generator.index = CHACHA_BLOCK_SIZE;
+    p->generator.prefetch = NULL;
+
+    pthread_mutex_init(&p->lock, NULL);
+    pthread_cond_init(&p->wake, NULL);
+
+    if (thread)
+    {
+        if ((error = pthread_create(&p->thread, NULL, chacha_prefetch_thread, p)) != 0)
+        {
+            pthread_cond_destroy(&p->wake);
+            pthread_mutex_destroy(&p->lock);
+            goto error;
+        }
+
+        p->threaded = true;
+    }
+
+    ctx->prefetch = p;
+
+    return true;
+
+error:
+    fprintf(stderr, "[chacha] Failed to start keystream prefetch: %s\n", strerror(error));
+
+    if (p != NULL)
+    {
+        free(p->tags);
+        free(p->blocks);
+        free(p);
+    }
+
+    return false;
+}
+
+// Fill the prefetch ring from the calling thread
+size_t chacha_prefetch_fill(chacha_ctx* ctx)
+{
+    chacha_prefetch* const p = ctx->prefetch;
+
+    if (p == NULL || p->threaded)
+    {
+        return 0;
+    }
+
+    return chacha_prefetch_produce(p);
+}
+
+// Get the prefetch counters of a context
+void chacha_prefetch_get_stats(const chacha_ctx* ctx, chacha_prefetch_stats* stats)
+{
+    if (ctx->prefetch == NULL)
+    {
+        memset(stats, 0, sizeof(*stats));
+        return;
+    }
+
+    *stats = ctx->prefetch->stats;
+}
+
+// Stop prefetching and securely release the ring
+void chacha_prefetch_stop(chacha_ctx* ctx)
+{
+    chacha_prefetch* const p = ctx->prefetch;
+
+    if (p == NULL)
+    {
+        return;
+    }
+
+    // Stop and join the helper thread
+    pthread_mutex_lock(&p->lock);
+    __atomic_store_n(&p->stop, 1, __ATOMIC_RELEASE);
+    chacha_prefetch_signal(p);
+    pthread_mutex_unlock(&p->lock);
+
+    if (p->threaded)
+    {
+        pthread_join(p->thread, NULL);
+    }
+
+    pthread_cond_destroy(&p->wake);
+    pthread_mutex_destroy(&p->lock);
+
+    // Wipe keystream and key material
+    memwipe(p->blocks, p->capacity * CHACHA_BLOCK_SIZE);
+    chacha_wipe(&p->generator);
+
+    free(p->tags);
+    free(p->blocks);
+    memwipe(p, sizeof(*p));
+    free(p);
+
+    ctx->prefetch = NULL;
+}
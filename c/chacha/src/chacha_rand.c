@@ -0,0 +1,235 @@
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <errno.h>
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/random.h>
+
+#include "chacha_internal.h"
+
+// Size (in bytes) of each page of output generated between rekeys.
+// Bulk requests receive whole pages directly and small requests are
+// served from a buffered page, so output does not depend on request sizes.
+#define CHACHA_RAND_BUFFER_SIZE 4096
+
+// Number of bytes generated before reseeding from the OS
+#define CHACHA_RAND_RESEED_SIZE (U64_C(1) << 30)
+
+// Generator keystream variant (ChaCha12)
+static const chacha_variant CHACHA_RAND_VARIANT = { 12, CHACHA_KEY_SIZE, CHACHA_COUNTER_SIZE };
+
+// Per-thread generator state
+typedef struct chacha_rand_state
+{
+    chacha_ctx ctx;
+    u8 buffer[CHACHA_RAND_BUFFER_SIZE];
+
+    // Unread bytes at the end of the buffer
+    size_t available;
+
+    // Bytes generated since the last reseed
+    u64 generated;
+
+    // Process generation the state was seeded in (0 if unseeded)
+    u64 generation;
+
+    // Seeded with a fixed key (no periodic reseeding)
+    bool fixed;
+} chacha_rand_state;
+
+static __thread chacha_rand_state CHACHA_RAND_STATE;
+
+// Process generation (advanced in the child after every fork)
+static volatile u64 CHACHA_RAND_GENERATION = 1;
+static pthread_once_t CHACHA_RAND_ONCE = PTHREAD_ONCE_INIT;
+
+// Invalidate every inherited generator in a forked child
+static void chacha_rand_atfork_child(void)
+{
+    CHACHA_RAND_GENERATION++;
+}
+
+static void chacha_rand_register(void)
+{
+    pthread_atfork(NULL, NULL, chacha_rand_atfork_child);
+}
+
+// Read a seed from the OS (aborts if no entropy source is available)
+static void chacha_rand_entropy(u8 seed[CHACHA_KEY_SIZE])
+{
+    size_t size = 0;
+
+    while (size < CHACHA_KEY_SIZE)
+    {
+        const ssize_t n = getrandom(seed + size, CHACHA_KEY_SIZE - size, 0);
+
+        if (n < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            break;
+        }
+
+        size += (size_t) n;
+    }
+
+    // Fall back to the random device (e.g. getrandom not supported)
+    if (size < CHACHA_KEY_SIZE)
+    {
+        const int fd = open("/dev/urandom", O_RDONLY | O_CLOEXEC);
+
+        size = 0;
+
+        while (fd >= 0 && size < CHACHA_KEY_SIZE)
+        {
+            const ssize_t n = read(fd, seed + size, CHACHA_KEY_SIZE - size);
+
+            if (n <= 0)
+            {
+                if (n < 0 && errno == EINTR)
+                {
+                    continue;
+                }
+
+                break;
+            }
+
+            size += (size_t) n;
+        }
+
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+    }
+
+    // Never hand out output from an unseeded generator
+    if (size < CHACHA_KEY_SIZE)
+    {
+        fprintf(stderr, "[chacha_rand] seeding from the OS failed: %s\n", strerror(errno));
+        abort();
+    }
+}
+
+// Key the generator (ChaCha12 keystream with an all zero nonce)
+static void chacha_rand_key(chacha_rand_state* state, const u8 key[CHACHA_KEY_SIZE])
+{
+    chacha_init_variant(&state->ctx, key, &CHACHA_RAND_VARIANT);
+
+    memwipe(state->buffer, sizeof(state->buffer));
+    state->available = 0;
+    state->generated = 0;
+    state->generation = CHACHA_RAND_GENERATION;
+}
+
+// Replace the key with fresh keystream so earlier output cannot be
+// reconstructed from the current state (fast key erasure)
+static void chacha_rand_rekey(chacha_rand_state* state)
+{
+    u8 key[CHACHA_KEY_SIZE] = { 0 };
+
+    chacha_update(&state->ctx, key, key, sizeof(key));
+    chacha_init_variant(&state->ctx, key, &CHACHA_RAND_VARIANT);
+
+    memwipe(key, sizeof(key));
+}
+
+// Generate a page of keystream in place (over zeros) and rekey
+static void chacha_rand_generate(chacha_rand_state* state, u8 data[CHACHA_RAND_BUFFER_SIZE])
+{
+    memset(data, 0, CHACHA_RAND_BUFFER_SIZE);
+    chacha_update(&state->ctx, data, data, CHACHA_RAND_BUFFER_SIZE);
+    chacha_rand_rekey(state);
+
+    state->generated += CHACHA_RAND_BUFFER_SIZE;
+}
+
+// Get the calling thread's generator (seeding it when needed)
+static chacha_rand_state* chacha_rand_state_get(void)
+{
+    chacha_rand_state* const state = &CHACHA_RAND_STATE;
+
+    pthread_once(&CHACHA_RAND_ONCE, chacha_rand_register);
+
+    // Seed on first use, after fork, and periodically
+    if (state->generation != CHACHA_RAND_GENERATION ||
+        (!state->fixed && state->generated >= CHACHA_RAND_RESEED_SIZE))
+    {
+        chacha_rand_reseed();
+    }
+
+    return state;
+}
+
+// Fill memory with cryptographically secure random bytes
+void chacha_rand(void* data, size_t size)
+{
+    chacha_rand_state* const state = chacha_rand_state_get();
+    u8* p = (u8*) data;
+
+    // Serve from buffered keystream first
+    const size_t msize = MIN(size, state->available);
+
+    memcpy(p, state->buffer + CHACHA_RAND_BUFFER_SIZE - state->available, msize);
+    memwipe(state->buffer + CHACHA_RAND_BUFFER_SIZE - state->available, msize);
+    state->available -= msize;
+    p += msize;
+    size -= msize;
+
+    // Generate whole pages of bulk requests directly into the output
+    while (size >= CHACHA_RAND_BUFFER_SIZE)
+    {
+        chacha_rand_generate(state, p);
+
+        p += CHACHA_RAND_BUFFER_SIZE;
+        size -= CHACHA_RAND_BUFFER_SIZE;
+    }
+
+    // Refill the buffer for the remaining small request
+    if (size > 0)
+    {
+        chacha_rand_generate(state, state->buffer);
+        state->available = CHACHA_RAND_BUFFER_SIZE;
+
+        memcpy(p, state->buffer, size);
+        memwipe(state->buffer, size);
+        state->available -= size;
+    }
+}
+
+// Reseed the calling thread's generator from the OS
+void chacha_rand_reseed(void)
+{
+    chacha_rand_state* const state = &CHACHA_RAND_STATE;
+    u8 seed[CHACHA_KEY_SIZE];
+
+    chacha_rand_entropy(seed);
+    chacha_rand_key(state, seed);
+    state->fixed = false;
+
+    memwipe(seed, sizeof(seed));
+}
+
+// Seed the calling thread's generator with a fixed key
+void chacha_rand_seed(const u8 key[CHACHA_KEY_SIZE])
+{
+    chacha_rand_state* const state = &CHACHA_RAND_STATE;
+
+    pthread_once(&CHACHA_RAND_ONCE, chacha_rand_register);
+
+    chacha_rand_key(state, key);
+    state->fixed = true;
+}
+
+// Fills memory with random bytes (util.h hook)
+void memrand(void* data, size_t size)
+{
+    chacha_rand(data, size);
+}
@@ -0,0 +1,187 @@
+#include "chacha_internal.h"
+
+#if defined(__SSE2__)
+
+#include <emmintrin.h>
+
+// Number of blocks processed in parallel
+#define CHACHA_SSE2_LANES 4
+
+// Rotate each 32-bit word left by a constant
+static inline __m128i chacha_rotl_sse2(__m128i x, int count)
+{
+    return _mm_or_si128(_mm_slli_epi32(x, count), _mm_srli_epi32(x, 32 - count));
+}
+
+// Perform the ChaCha quarter round operation on four blocks
+CHACHA_KERNEL_INLINE void chacha_quarter_round_sse2(
+    __m128i x[CHACHA_STATE_WORDS],
+    size_t a,
+    size_t b,
+    size_t c,
+    size_t d)
+{
+    x[a] = _mm_add_epi32(x[a], x[b]); x[d] = chacha_rotl_sse2(_mm_xor_si128(x[d], x[a]), 16);
+    x[c] = _mm_add_epi32(x[c], x[d]); x[b] = chacha_rotl_sse2(_mm_xor_si128(x[b], x[c]), 12);
+    x[a] = _mm_add_epi32(x[a], x[b]); x[d] = chacha_rotl_sse2(_mm_xor_si128(x[d], x[a]), 8);
+    x[c] = _mm_add_epi32(x[c], x[d]); x[b] = chacha_rotl_sse2(_mm_xor_si128(x[b], x[c]), 7);
+}
+
+// Transpose four words of four blocks and XOR them into each block's
+// output at byte `offset`
+static inline void chacha_xor4_sse2(
+    const __m128i x[4],
+    const u8* input[CHACHA_SSE2_LANES],
+    u8* output[CHACHA_SSE2_LANES],
+    size_t offset)
+{
+    const __m128i t0 = _mm_unpacklo_epi32(x[0], x[1]);
+    const __m128i t1 = _mm_unpacklo_epi32(x[2], x[3]);
+    const __m128i t2 = _mm_unpackhi_epi32(x[0], x[1]);
+    const __m128i t3 = _mm_unpackhi_epi32(x[2], x[3]);
+
+    const __m128i r[4] =
+    {
+        _mm_unpacklo_epi64(t0, t1),
+        _mm_unpackhi_epi64(t0, t1),
+        _mm_unpacklo_epi64(t2, t3),
+        _mm_unpackhi_epi64(t2, t3),
+    };
+
+    for (size_t i = 0; i < 4; i++)
+    {
+        const __m128i m = _mm_loadu_si128((const __m128i *) (input[i] + offset));
+        _mm_storeu_si128((__m128i *) (output[i] + offset), _mm_xor_si128(m, r[i]));
+    }
+}
+
+// Perform a ChaCha odd and even round on four blocks
+CHACHA_KERNEL_INLINE void chacha_double_round_sse2(__m128i x[CHACHA_STATE_WORDS])
+{
+    // Odd round
+    chacha_quarter_round_sse2(x, 0, 4, 8, 12);
+    chacha_quarter_round_sse2(x, 1, 5, 9, 13);
+    chacha_quarter_round_sse2(x, 2, 6, 10, 14);
+    chacha_quarter_round_sse2(x, 3, 7, 11, 15);
+
+    // Even round
+    chacha_quarter_round_sse2(x, 0, 5, 10, 15);
+    chacha_quarter_round_sse2(x, 1, 6, 11, 12);
+    chacha_quarter_round_sse2(x, 2, 7, 8, 13);
+    chacha_quarter_round_sse2(x, 3, 4, 9, 14);
+}
+
+// Generate four blocks from word-sliced state `s` using `rounds` rounds
+// and XOR them into the blocks at input[j] and output[j]
+CHACHA_KERNEL_INLINE void chacha_blocks_sse2(
+    const __m128i s[CHACHA_STATE_WORDS],
+    const u8* input[CHACHA_SSE2_LANES],
+    u8* output[CHACHA_SSE2_LANES],
+    size_t rounds)
+{
+    __m128i x[CHACHA_STATE_WORDS];
+
+    for (size_t i = 0; i < CHACHA_STATE_WORDS; i++)
+    {
+        x[i] = s[i];
+    }
+
+    // Perform ChaCha rounds (fully unrolled)
+    CHACHA_DOUBLE_ROUNDS(rounds, chacha_double_round_sse2(x);)
+
+    for (size_t i = 0; i < CHACHA_STATE_WORDS; i++)
+    {
+        x[i] = _mm_add_epi32(x[i], s[i]);
+    }
+
+    // Transpose back to block order and XOR into the output
+    chacha_xor4_sse2(x + 0, input, output, 0);
+    chacha_xor4_sse2(x + 4, input, output, 16);
+    chacha_xor4_sse2(x + 8, input, output, 32);
+    chacha_xor4_sse2(x + 12, input, output, 48);
+}
+
+// Crypt blocks four at a time using SSE2
+CHACHA_KERNEL_INLINE void chacha_xor_sse2(
+    const u32 state[CHACHA_STATE_WORDS],
+    const u8* input,
+    u8* output,
+    size_t blocks,
+    size_t counter_words,
+    size_t rounds)
+{
+    u32 counter[4] = { state[12], state[13], state[14], state[15] };
+    u32 words[4][CHACHA_LANES_MAX];
+
+    for (; blocks >= CHACHA_SSE2_LANES; blocks -= CHACHA_SSE2_LANES)
+    {
+        __m128i s[CHACHA_STATE_WORDS];
+        const u8* in[CHACHA_SSE2_LANES];
+        u8* out[CHACHA_SSE2_LANES];
+
+        // Load word-sliced initial state (one block per lane)
+        chacha_lane_counters(counter, counter_words, words, CHACHA_SSE2_LANES);
+
+        for (size_t i = 0; i < 12; i++)
+        {
+            s[i] = _mm_set1_epi32((int) state[i]);
+        }
+
+        for (size_t i = 12; i < CHACHA_STATE_WORDS; i++)
+        {
+            s[i] = _mm_loadu_si128((const __m128i *) words[i - 12]);
+        }
+
+        for (size_t j = 0; j < CHACHA_SSE2_LANES; j++)
+        {
+            in[j] = input + j * CHACHA_BLOCK_SIZE;
+            out[j] = output + j * CHACHA_BLOCK_SIZE;
+        }
+
+        chacha_blocks_sse2(s, in, out, rounds);
+
+        input += CHACHA_SSE2_LANES * CHACHA_BLOCK_SIZE;
+        output += CHACHA_SSE2_LANES * CHACHA_BLOCK_SIZE;
+    }
+}
+
+// Crypt one block of each of four independent streams using SSE2
+CHACHA_KERNEL_INLINE void chacha_xor_lanes_sse2(
+    const u32 words[CHACHA_STATE_WORDS][CHACHA_LANES_MAX],
+    const u8* input[CHACHA_LANES_MAX],
+    u8* output[CHACHA_LANES_MAX],
+    size_t rounds)
+{
+    __m128i s[CHACHA_STATE_WORDS];
+
+    for (size_t i = 0; i < CHACHA_STATE_WORDS; i++)
+    {
+        s[i] = _mm_loadu_si128((const __m128i *) words[i]);
+    }
+
+    chacha_blocks_sse2(s, input, output, rounds);
+}
+
+// Instantiate kernels with fully unrolled rounds for each round count
+#define CHACHA_DEFINE_SSE2(rounds) \
+    void chacha_xor_sse2_##rounds( \
+        const u32 state[CHACHA_STATE_WORDS], \
+        const u8* input, \
+        u8* output, \
+        size_t blocks, \
+        size_t counter_words) \
+    { \
+        chacha_xor_sse2(state, input, output, blocks, counter_words, rounds); \
+    } \
+    \
+    void chacha_xor_lanes_sse2_##rounds( \
+        const u32 words[CHACHA_STATE_WORDS][CHACHA_LANES_MAX], \
+        const u8* input[CHACHA_LANES_MAX], \
+        u8* output[CHACHA_LANES_MAX]) \
+    { \
+        chacha_xor_lanes_sse2(words, input, output, rounds); \
+    }
+
+CHACHA_VARIANTS(CHACHA_DEFINE_SSE2)
+
+#endif
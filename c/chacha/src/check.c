@@ -0,0 +1,573 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "chacha.h"
+#include "crc.h"
+
+// Number of messages in each random batch
+#define CHECK_JOBS 37
+
+// Maximum number of segments per message
+#define CHECK_SEGMENTS 5
+
+// Maximum size (in bytes) of each segment
+#define CHECK_SEGMENT_SIZE 3000
+
+// Number of random batches
+#define CHECK_ROUNDS 50
+
+// Deterministic pseudo-random generator (xorshift64)
+static u64 check_state = U64_C(0x9E3779B97F4A7C15);
+
+static u64 check_rand(void)
+{
+    check_state ^= check_state << 13;
+    check_state ^= check_state >> 7;
+    check_state ^= check_state << 17;
+
+    return check_state;
+}
+
+static void check_fill(void* data, size_t size)
+{
+    u8* const bytes = (u8*) data;
+
+    for (size_t i = 0; i < size; i++)
+    {
+        bytes[i] = (u8) check_rand();
+    }
+}
+
+// Decode a hexadecimal test vector (returns the number of bytes)
+static size_t check_hex(const char* hex, u8* data)
+{
+    size_t size = 0;
+
+    for (; hex[0] != '\0' && hex[1] != '\0'; hex += 2)
+    {
+        unsigned int byte;
+        sscanf(hex, "%2x", &byte);
+        data[size++] = (u8) byte;
+    }
+
+    return size;
+}
+
+// Message of the RFC 8439 ChaCha20 and AEAD test vectors
+static const char CHECK_SUNSCREEN[] =
+    "Ladies and Gentlemen of the class of '99: If I could offer you only one "
+    "tip for the future, sunscreen would be it.";
+
+// Size (in bytes) of a ChaCha keystream block
+#define CHECK_BLOCK_SIZE 64
+
+// Size (in blocks) of the streams crossing a counter carry
+#define CHECK_CARRY_BLOCKS 41
+
+// ChaCha20 must match RFC 8439 section 2.4.2
+static bool check_chacha20(void)
+{
+    static const chacha_variant ietf = { 20, 32, 4 };
+    const size_t size = sizeof(CHECK_SUNSCREEN) - 1;
+    u8 key[CHACHA_KEY_SIZE];
+    u8 nonce[CHACHA_NONCE_SIZE];
+    u8 expected[sizeof(CHECK_SUNSCREEN)];
+    u8 output[sizeof(CHECK_SUNSCREEN)];
+    chacha_ctx ctx;
+
+    check_hex("000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f", key);
+    check_hex("01000000000000000000004a00000000", nonce);
+    check_hex(
+        "6e2e359a2568f98041ba0728dd0d6981e97e7aec1d4360c20a27afccfd9fae0b"
+        "f91b65c5524733ab8f593dabcd62b3571639d624e65152ab8f530c359f0861d8"
+        "07ca0dbf500d6a6156a38e088a22b65e52bc514d16ccf806818ce91ab7793736"
+        "5af90bbf74a35be6b40b8eedf2785e42874d", expected);
+
+    chacha_init_variant(&ctx, key, &ietf);
+    chacha_seek(&ctx, nonce);
+    chacha_update(&ctx, CHECK_SUNSCREEN, output, size);
+    chacha_wipe(&ctx);
+
+    if (memcmp(output, expected, size) != 0)
+    {
+        fprintf(stderr, "[check_chacha20] RFC 8439 2.4.2 mismatch\n");
+        return false;
+    }
+
+    return true;
+}
+
+// Long streams crossing a carry of the block counter (crypted by the vector
+// kernels) must match crypting each block from its own counter
+static bool check_carry(const chacha_variant* variant)
+{
+    static u8 input[CHECK_CARRY_BLOCKS * CHECK_BLOCK_SIZE];
+    static u8 output[sizeof(input)];
+    static u8 expected[sizeof(input)];
+    const size_t words = variant->counter_size / 4;
+    u8 key[CHACHA_KEY_SIZE];
+    u8 nonce[CHACHA_NONCE_SIZE];
+    chacha_ctx ctx;
+
+    for (size_t round = 0; round < CHECK_ROUNDS; round++)
+    {
+        u32 counter[4];
+
+        // Counter a few blocks before carrying out of every counter word
+        // but the last
+        check_fill(key, sizeof(key));
+        check_fill(counter, sizeof(counter));
+        counter[0] = U32_C(0xFFFFFFFF) - (u32) (check_rand() % CHECK_CARRY_BLOCKS);
+
+        for (size_t i = 1; i + 1 < words; i++)
+        {
+            counter[i] = U32_C(0xFFFFFFFF);
+        }
+
+        for (size_t i = 0; i < 4; i++)
+        {
+            store32_le(nonce + 4 * i, counter[i]);
+        }
+
+        check_fill(input, sizeof(input));
+
+        chacha_init_variant(&ctx, key, variant);
+        chacha_seek(&ctx, nonce);
+        chacha_update(&ctx, input, output, sizeof(input));
+
+        // Reference: one block at a time, carrying within the counter words
+        for (size_t block = 0; block < CHECK_CARRY_BLOCKS; block++)
+        {
+            const size_t offset = block * CHECK_BLOCK_SIZE;
+
+            chacha_seek(&ctx, nonce);
+            chacha_update(&ctx, input + offset, expected + offset, CHECK_BLOCK_SIZE);
+
+            for (size_t i = 0; i < words; i++)
+            {
+                store32_le(nonce + 4 * i, ++counter[i]);
+
+                if (counter[i] != 0)
+                {
+                    break;
+                }
+            }
+        }
+
+        chacha_wipe(&ctx);
+
+        if (memcmp(output, expected, sizeof(input)) != 0)
+        {
+            fprintf(stderr, "[check_carry] ChaCha%zu with %zu byte counter mismatch in round %zu\n",
+                    variant->rounds, variant->counter_size, round);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// ChaCha20 streams must carry correctly with every counter size
+static bool check_chacha20_carry(void)
+{
+    static const chacha_variant variants[] =
+    {
+        { 20, 32, 4 },
+        { 20, 32, 8 },
+        { 20, 32, 16 },
+    };
+
+    for (size_t i = 0; i < sizeof(variants) / sizeof(variants[0]); i++)
+    {
+        if (!check_carry(variants + i))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// ChaCha8 and ChaCha12 must match the reference keystream of an all-zero
+// key and nonce, and carry correctly with every counter size
+static bool check_variants(void)
+{
+    static const struct
+    {
+        const chacha_variant* variant;
+        const char* keystream;
+    } variants[] =
+    {
+        {
+            &CHACHA_VARIANT_CHACHA8,
+            "3e00ef2f895f40d67f5bb8e81f09a5a12c840ec3ce9a7f3b181be188ef711a1e"
+            "984ce172b9216f419f445367456d5619314a42a3da86b001387bfdb80e0cfe42",
+        },
+        {
+            &CHACHA_VARIANT_CHACHA12,
+            "9bf49a6a0755f953811fce125f2683d50429c3bb49e074147e0089a52eae155f"
+            "0564f879d27ae3c02ce82834acfa8c793a629f2ca0de6919610be82f411326be",
+        },
+    };
+
+    static const size_t counter_sizes[] = { 4, 8, 16 };
+
+    for (size_t i = 0; i < sizeof(variants) / sizeof(variants[0]); i++)
+    {
+        const chacha_variant* const variant = variants[i].variant;
+        const u8 key[CHACHA_KEY_SIZE] = { 0 };
+        const u8 nonce[CHACHA_NONCE_SIZE] = { 0 };
+        u8 expected[CHECK_BLOCK_SIZE];
+        u8 output[CHECK_BLOCK_SIZE] = { 0 };
+        chacha_ctx ctx;
+
+        check_hex(variants[i].keystream, expected);
+
+        chacha_init_variant(&ctx, key, variant);
+        chacha_seek(&ctx, nonce);
+        chacha_update(&ctx, output, output, sizeof(output));
+        chacha_wipe(&ctx);
+
+        if (memcmp(output, expected, sizeof(output)) != 0)
+        {
+            fprintf(stderr, "[check_variants] ChaCha%zu keystream mismatch\n", variant->rounds);
+            return false;
+        }
+
+        for (size_t j = 0; j < sizeof(counter_sizes) / sizeof(counter_sizes[0]); j++)
+        {
+            const chacha_variant carry = { variant->rounds, variant->key_size, counter_sizes[j] };
+
+            if (!check_carry(&carry))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// Batches without messages or without data must be no-ops
+static bool check_batch_empty(void)
+{
+    u8 key[CHACHA_KEY_SIZE] = { 0 };
+    u8 nonce[CHACHA_NONCE_SIZE] = { 0 };
+    u8 data[64] = { 0 };
+    const chacha_segment empty = { data, data, 0 };
+    const chacha_job jobs[] =
+    {
+        { key, nonce, NULL, 0 },
+        { key, nonce, &empty, 1 },
+    };
+
+    chacha_crypt_batch(NULL, 0);
+    chacha_crypt_batch(jobs, 1);
+    chacha_crypt_batch(jobs + 1, 1);
+    chacha_crypt_batch(jobs, 2);
+
+    for (size_t i = 0; i < sizeof(data); i++)
+    {
+        if (data[i] != 0)
+        {
+            fprintf(stderr, "[check_batch_empty] Empty batch modified data\n");
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Batches of random scatter-gather messages must match chacha_crypt
+static bool check_batch_random(void)
+{
+    static u8 keys[CHECK_JOBS][CHACHA_KEY_SIZE];
+    static u8 nonces[CHECK_JOBS][CHACHA_NONCE_SIZE];
+    static u8 input[CHECK_JOBS][CHECK_SEGMENTS * CHECK_SEGMENT_SIZE];
+    static u8 output[CHECK_JOBS][CHECK_SEGMENTS * CHECK_SEGMENT_SIZE];
+    static u8 expected[CHECK_SEGMENTS * CHECK_SEGMENT_SIZE];
+    static chacha_segment segments[CHECK_JOBS][CHECK_SEGMENTS];
+    static chacha_job jobs[CHECK_JOBS];
+    static size_t sizes[CHECK_JOBS];
+
+    for (size_t round = 0; round < CHECK_ROUNDS; round++)
+    {
+        // Random messages (some empty) split into random segments
+        for (size_t i = 0; i < CHECK_JOBS; i++)
+        {
+            const size_t count = (size_t) (check_rand() % (CHECK_SEGMENTS + 1));
+            size_t size = 0;
+
+            check_fill(keys[i], sizeof(keys[i]));
+            check_fill(nonces[i], sizeof(nonces[i]));
+
+            for (size_t j = 0; j < count; j++)
+            {
+                const size_t n = (size_t) (check_rand() % (CHECK_SEGMENT_SIZE + 1));
+
+                segments[i][j] = (chacha_segment) { input[i] + size, output[i] + size, n };
+                size += n;
+            }
+
+            check_fill(input[i], size);
+            jobs[i] = (chacha_job) { keys[i], nonces[i], segments[i], count };
+            sizes[i] = size;
+        }
+
+        chacha_crypt_batch(jobs, CHECK_JOBS);
+
+        for (size_t i = 0; i < CHECK_JOBS; i++)
+        {
+            chacha_crypt(keys[i], nonces[i], input[i], expected, sizes[i]);
+
+            if (memcmp(output[i], expected, sizes[i]) != 0)
+            {
+                fprintf(stderr, "[check_batch_random] Message %zu (%zu bytes) of round %zu mismatch\n", i, sizes[i], round);
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// Crypting with chacha_update_crc32c must match chacha_update followed by
+// crc_update, from any starting CRC and however the data is split
+static bool check_update_crc32c(void)
+{
+    static u8 input[CHECK_SEGMENTS * CHECK_SEGMENT_SIZE * 4];
+    static u8 output[sizeof(input)];
+    static u8 expected[sizeof(input)];
+    u8 key[CHACHA_KEY_SIZE];
+    u8 nonce[CHACHA_NONCE_SIZE];
+
+    for (size_t round = 0; round < CHECK_ROUNDS; round++)
+    {
+        const size_t size = (size_t) (check_rand() % (sizeof(input) + 1));
+        const u32 start = round == 0 ? 0 : (u32) check_rand();
+        chacha_ctx ctx;
+        u32 crc = start;
+
+        check_fill(key, sizeof(key));
+        check_fill(nonce, sizeof(nonce));
+        check_fill(input, size);
+
+        chacha_crypt(key, nonce, input, expected, size);
+        const u32 expected_crc = (u32) crc_update(&CRC_MODEL_CRC32C, start, expected, size);
+
+        chacha_init(&ctx, key);
+        chacha_seek(&ctx, nonce);
+
+        for (size_t offset = 0; offset < size;)
+        {
+            const size_t piece = (size_t) (check_rand() % (CHECK_SEGMENT_SIZE * 8));
+            const size_t n = MIN(size - offset, piece);
+
+            crc = chacha_update_crc32c(&ctx, input + offset, output + offset, n, crc);
+            offset += n;
+        }
+
+        chacha_wipe(&ctx);
+
+        if (memcmp(output, expected, size) != 0 || crc != expected_crc)
+        {
+            fprintf(stderr, "[check_update_crc32c] %zu bytes from CRC %08x mismatch\n", size, start);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Poly1305 must match RFC 8439 section 2.5.2, and the vector kernel used
+// for long updates must match small (scalar) updates
+static bool check_poly1305(void)
+{
+    static const char message[] = "Cryptographic Forum Research Group";
+    static u8 data[4096];
+    u8 key[POLY1305_KEY_SIZE];
+    u8 expected[POLY1305_TAG_SIZE];
+    u8 tag[POLY1305_TAG_SIZE];
+
+    check_hex("85d6be7857556d337f4452fe42d506a80103808afb0db2fd4abff6af4149f51b", key);
+    check_hex("a8061dc1305136c6c22b8baf0c0127a9", expected);
+
+    poly1305_compute(key, message, sizeof(message) - 1, tag);
+
+    if (memcmp(tag, expected, sizeof(tag)) != 0)
+    {
+        fprintf(stderr, "[check_poly1305] RFC 8439 2.5.2 tag mismatch\n");
+        return false;
+    }
+
+    for (size_t round = 0; round < CHECK_ROUNDS; round++)
+    {
+        const size_t size = (size_t) (check_rand() % (sizeof(data) + 1));
+        poly1305_ctx ctx;
+
+        check_fill(key, sizeof(key));
+        check_fill(data, size);
+        poly1305_compute(key, data, size, expected);
+
+        poly1305_init(&ctx, key);
+
+        for (size_t offset = 0; offset < size;)
+        {
+            const size_t piece = (size_t) (check_rand() % 64);
+            const size_t n = MIN(size - offset, piece);
+
+            poly1305_update(&ctx, data + offset, n);
+            offset += n;
+        }
+
+        poly1305_final(&ctx, tag);
+
+        if (memcmp(tag, expected, sizeof(tag)) != 0)
+        {
+            fprintf(stderr, "[check_poly1305] %zu byte message tag mismatch\n", size);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Feed data to an AEAD update function in random pieces
+static void check_aead_split(
+    chacha_aead_ctx* ctx,
+    void (*update)(chacha_aead_ctx*, const void*, void*, size_t),
+    const u8* input,
+    u8* output,
+    size_t size)
+{
+    for (size_t offset = 0; offset < size;)
+    {
+        const size_t piece = (size_t) (check_rand() % 80);
+        const size_t n = MIN(size - offset, piece);
+
+        update(ctx, input + offset, output + offset, n);
+        offset += n;
+    }
+}
+
+// ChaCha20-Poly1305 must match RFC 8439 section 2.8.2 however the message is
+// split, and reject tampered messages
+static bool check_aead(void)
+{
+    const size_t size = sizeof(CHECK_SUNSCREEN) - 1;
+    u8 key[CHACHA_AEAD_KEY_SIZE];
+    u8 nonce[CHACHA_AEAD_NONCE_SIZE];
+    u8 aad[12];
+    u8 expected[sizeof(CHECK_SUNSCREEN)];
+    u8 expected_tag[CHACHA_AEAD_TAG_SIZE];
+    u8 output[sizeof(CHECK_SUNSCREEN)];
+    u8 tag[CHACHA_AEAD_TAG_SIZE];
+
+    check_hex("808182838485868788898a8b8c8d8e8f909192939495969798999a9b9c9d9e9f", key);
+    check_hex("070000004041424344454647", nonce);
+    check_hex("50515253c0c1c2c3c4c5c6c7", aad);
+    check_hex(
+        "d31a8d34648e60db7b86afbc53ef7ec2a4aded51296e08fea9e2b5a736ee62d6"
+        "3dbea45e8ca9671282fafb69da92728b1a71de0a9e060b2905d6a5b67ecd3b36"
+        "92ddbd7f2d778b8c9803aee328091b58fab324e4fad675945585808b4831d7bc"
+        "3ff4def08e4b7a9de576d26586cec64b6116", expected);
+    check_hex("1ae10b594f09e26a7e902ecbd0600691", expected_tag);
+
+    for (size_t round = 0; round < CHECK_ROUNDS; round++)
+    {
+        const size_t aad_split = (size_t) (check_rand() % (sizeof(aad) + 1));
+        chacha_aead_ctx ctx;
+
+        // Seal
+        chacha_aead_init(&ctx, key, nonce);
+        chacha_aead_update_aad(&ctx, aad, aad_split);
+        chacha_aead_update_aad(&ctx, aad + aad_split, sizeof(aad) - aad_split);
+        check_aead_split(&ctx, chacha_aead_seal_update, (const u8*) CHECK_SUNSCREEN, output, size);
+        chacha_aead_seal_final(&ctx, tag);
+
+        if (memcmp(output, expected, size) != 0 || memcmp(tag, expected_tag, sizeof(tag)) != 0)
+        {
+            fprintf(stderr, "[check_aead] RFC 8439 2.8.2 seal mismatch\n");
+            return false;
+        }
+
+        // Open
+        chacha_aead_init(&ctx, key, nonce);
+        chacha_aead_update_aad(&ctx, aad, aad_split);
+        chacha_aead_update_aad(&ctx, aad + aad_split, sizeof(aad) - aad_split);
+        check_aead_split(&ctx, chacha_aead_open_update, expected, output, size);
+
+        if (!chacha_aead_open_final(&ctx, expected_tag) || memcmp(output, CHECK_SUNSCREEN, size) != 0)
+        {
+            fprintf(stderr, "[check_aead] RFC 8439 2.8.2 open mismatch\n");
+            return false;
+        }
+    }
+
+    // Any flipped bit of the tag, ciphertext, or additional data is rejected
+    for (size_t bit = 0; bit < 8 * sizeof(expected_tag); bit++)
+    {
+        expected_tag[bit / 8] ^= (u8) (1 << (bit % 8));
+        const bool opened = chacha_aead_open(key, nonce, aad, sizeof(aad), expected, output, size, expected_tag);
+        expected_tag[bit / 8] ^= (u8) (1 << (bit % 8));
+
+        if (opened)
+        {
+            fprintf(stderr, "[check_aead] Tampered tag (bit %zu) accepted\n", bit);
+            return false;
+        }
+    }
+
+    expected[size / 2] ^= 1;
+    const bool tampered_data = chacha_aead_open(key, nonce, aad, sizeof(aad), expected, output, size, expected_tag);
+    expected[size / 2] ^= 1;
+
+    aad[0] ^= 1;
+    const bool tampered_aad = chacha_aead_open(key, nonce, aad, sizeof(aad), expected, output, size, expected_tag);
+    aad[0] ^= 1;
+
+    if (tampered_data || tampered_aad)
+    {
+        fprintf(stderr, "[check_aead] Tampered message accepted\n");
+        return false;
+    }
+
+    return chacha_aead_open(key, nonce, aad, sizeof(aad), expected, output, size, expected_tag) &&
+        memcmp(output, CHECK_SUNSCREEN, size) == 0;
+}
+
+int main(void)
+{
+    static const struct
+    {
+        const char* name;
+        bool (*run)(void);
+    } checks[] =
+    {
+        { "chacha20", check_chacha20 },
+        { "chacha20_carry", check_chacha20_carry },
+        { "variants", check_variants },
+        { "batch_empty", check_batch_empty },
+        { "batch_random", check_batch_random },
+        { "update_crc32c", check_update_crc32c },
+        { "poly1305", check_poly1305 },
+        { "aead", check_aead },
+    };
+
+    int status = EXIT_SUCCESS;
+
+    for (size_t i = 0; i < sizeof(checks) / sizeof(checks[0]); i++)
+    {
+        const bool ok = checks[i].run();
+
+        printf("%-16s %s\n", checks[i].name, ok ? "ok" : "FAILED");
+
+        if (!ok)
+        {
+            status = EXIT_FAILURE;
+        }
+    }
+
+    return status;
+}
@@ -1,190 +1,634 @@
+#define _GNU_SOURCE
+
 #include <stdio.h>
 #include <stdbool.h>
 #include <errno.h>
 
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
 #include <sys/types.h>
 #include <sys/stat.h>
 
 #include "chacha.h"
+#include "chacha_container.h"
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
 
 #define BUFFER_SIZE (1 << 16)
 
-static size_t filesize(const char* filename)
+// Size (in bytes) of each buffer in the copy pipeline ring
+#define PIPELINE_BUFFER_SIZE (1 << 20)
+
+// Alignment (in bytes) of copy pipeline buffers
+#define PIPELINE_BUFFER_ALIGN 4096
+
+// Size (in bytes) of each container append or extract step
+#define CONTAINER_BUFFER_SIZE (64 << 20)
+
+// Read exactly `size` bytes at `offset` (retrying short reads)
+static bool read_full(int fd, void* buffer, size_t size, u64 offset)
 {
-    size_t size = 0;
-    struct stat sb;
+    while (size > 0)
+    {
+        const ssize_t n = pread(fd, buffer, size, (off_t) offset);
+
+        if (n <= 0)
+        {
+            if (n < 0 && errno == EINTR)
+            {
+                continue;
+            }
+
+            errno = n == 0 ? EIO : errno;
+            return false;
+        }
+
+        buffer = OFFSET_PTR(buffer, n);
+        offset += (u64) n;
+        size -= (size_t) n;
+    }
 
-    if (stat(filename, &sb) != -1)
+    return true;
+}
+
+// Write exactly `size` bytes at `offset` (retrying short writes)
+static bool write_full(int fd, const void* buffer, size_t size, u64 offset)
+{
+    while (size > 0)
     {
-        size = (size_t) sb.st_size;
+        const ssize_t n = pwrite(fd, buffer, size, (off_t) offset);
+
+        if (n <= 0)
+        {
+            if (n < 0 && errno == EINTR)
+            {
+                continue;
+            }
+
+            errno = n == 0 ? EIO : errno;
+            return false;
+        }
+
+        buffer = OFFSET_CPTR(buffer, n);
+        offset += (u64) n;
+        size -= (size_t) n;
     }
 
-    return size;
+    return true;
 }
 
-static bool copy_file(const char* inpath, const char* outpath)
+bool crypt_file_parallel(const char* path, const u8 key[CHACHA_KEY_SIZE])
 {
-    FILE* infile = fopen(inpath, "rb");
-    FILE* outfile = fopen(outpath, "wb");
+    const int fd = open(path, O_RDWR);
+    struct stat sb;
     bool success = true;
+    u64 error_offset = 0;
+    int error = 0;
 
-    // Handle file or allocation failure
-    if (infile == NULL || outfile == NULL)
+    // Handle file failure
+    if (fd < 0 || fstat(fd, &sb) != 0)
     {
         goto error;
     }
 
-    // Disable I/O buffering
-    setbuf(infile, NULL);
-    setbuf(outfile, NULL);
+    const u64 size = (u64) sb.st_size;
+    const size_t blocks = (size_t) ((size + BUFFER_SIZE - 1) / BUFFER_SIZE);
 
-    // Copy file blocks
-    for (;;)
+    // Process blocks of file data (using parallel threads if possible).
+    // Each worker reads, crypts, and writes its own range with positional
+    // I/O so no lock is held around the file.
+    #pragma omp parallel default(shared)
     {
-        u8 buffer[BUFFER_SIZE];
+        u8* const buffer = (u8*) malloc(BUFFER_SIZE);
+        u64 worker_offset = 0;
+        int worker_error = buffer == NULL ? errno : 0;
+        chacha_ctx ctx;
 
-        // Read into buffer then write buffer
-        const size_t read_size = fread(buffer, 1, BUFFER_SIZE, infile);
-        const size_t write_size = fwrite(buffer, 1, read_size, outfile);
+        // Key context once per worker
+        chacha_init(&ctx, key);
 
-        // Check for EOF and errors
-        if (read_size != BUFFER_SIZE || read_size != write_size)
+        #pragma omp for schedule(nonmonotonic:dynamic)
+        for (size_t i = 0; i < blocks; i++)
         {
-            if (ferror(infile) || ferror(outfile))
+            const u64 offset = (u64) i * BUFFER_SIZE;
+            const size_t block_size = (size_t) MIN(size - offset, BUFFER_SIZE);
+
+            if (worker_error)
             {
-                goto error;
+                continue;
             }
 
-            break;
+            // Uses a nonce with all zero bytes. NOTE: reusing a nonce value with the same
+            // key when encrypting two different plaintexts will void the security of the cipher.
+            // This example always uses a nonce of all zero bytes and is only for testing purposes.
+            chacha_seek_offset(&ctx, 0, offset);
+
+            // Read, crypt, and write back local file data
+            if (!read_full(fd, buffer, block_size, offset))
+            {
+                worker_error = errno;
+                worker_offset = offset;
+                continue;
+            }
+
+            chacha_update(&ctx, buffer, buffer, block_size);
+
+            if (!write_full(fd, buffer, block_size, offset))
+            {
+                worker_error = errno;
+                worker_offset = offset;
+            }
+        }
+
+        // Report the first worker failure
+        if (worker_error)
+        {
+            #pragma omp critical(crypt_error)
+            {
+                if (!error)
+                {
+                    error = worker_error;
+                    error_offset = worker_offset;
+                }
+            }
+        }
+
+        // Teardown worker context and buffer
+        chacha_wipe(&ctx);
+
+        if (buffer != NULL)
+        {
+            memwipe(buffer, BUFFER_SIZE);
+            free(buffer);
         }
     }
 
+    if (error)
+    {
+        fprintf(stderr, "[crypt_file_parallel] crypting '%s' at offset %llu failed: %s\n",
+                path, (unsigned long long) error_offset, strerror(error));
+
+        success = false;
+    }
+
     goto exit;
 
 error:
-    fprintf(stderr, "[copy_file] copy '%s' to '%s' failed: %s\n",
-            inpath, outpath, strerror(errno));
+    fprintf(stderr, "[crypt_file_parallel] crypting '%s' failed: %s\n",
+            path, strerror(errno));
+
+    success = false;
+
+exit:
+    // Close file
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+
+    return success;
+}
+
+bool crypt_file_mapped(const char* path, const u8 key[CHACHA_KEY_SIZE])
+{
+    const int fd = open(path, O_RDWR);
+    const u8 nonce[CHACHA_NONCE_SIZE] = { 0 };
+    void* data = MAP_FAILED;
+    struct stat sb;
+    bool success = true;
+    size_t size = 0;
+
+    // Handle file failure
+    if (fd < 0 || fstat(fd, &sb) != 0)
+    {
+        goto error;
+    }
+
+    size = (size_t) sb.st_size;
+
+    // Nothing to crypt (mmap rejects empty mappings)
+    if (size == 0)
+    {
+        goto exit;
+    }
+
+    // Map file data shared so it is crypted in place
+    data = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (data == MAP_FAILED)
+    {
+        goto error;
+    }
+
+    // Hint read-ahead since every range is swept once front to back
+    madvise(data, size, MADV_SEQUENTIAL);
+
+    // Crypt mapped data across all cores (same keystream as crypt_file_parallel)
+    chacha_crypt_parallel(key, nonce, data, data, size, 0);
+
+    // Flush crypted pages to the file
+    if (msync(data, size, MS_SYNC) != 0)
+    {
+        goto error;
+    }
+
+    goto exit;
+
+error:
+    fprintf(stderr, "[crypt_file_mapped] crypting '%s' failed: %s\n",
+            path, strerror(errno));
 
     success = false;
 
 exit:
-    // Close input file
-    if (infile != NULL)
+    // Unmap file data
+    if (data != MAP_FAILED)
     {
-        fclose(infile);
+        munmap(data, size);
     }
 
-    // Close output file
-    if (outfile != NULL)
+    // Close file
+    if (fd >= 0)
     {
-        fclose(outfile);
+        close(fd);
     }
 
     return success;
 }
 
-bool crypt_file_parallel(const char* path, const u8 key[CHACHA_KEY_SIZE])
+bool crypt_file_pipeline(const char* inpath, const char* outpath, const u8 key[CHACHA_KEY_SIZE])
 {
-    size_t size = filesize(path);
-    FILE* file = fopen(path, "rb+");
-    const size_t full_blocks = size / BUFFER_SIZE;
-    const size_t partial_size = size % BUFFER_SIZE;
+    const int infd = open(inpath, O_RDONLY);
+    const int outfd = open(outpath, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    u8* ring = NULL;
+    size_t slots = 0;
+    struct stat sb;
     bool success = true;
+    u64 error_offset = 0;
+    int error = 0;
 
-    // Handle file or allocation failure
-    if (file == NULL || size == 0)
+    // Handle file failure
+    if (infd < 0 || outfd < 0 || fstat(infd, &sb) != 0)
     {
         goto error;
     }
 
-    // Disable I/O buffering
-    setbuf(file, NULL);
+    const u64 size = (u64) sb.st_size;
+    const size_t blocks = (size_t) ((size + PIPELINE_BUFFER_SIZE - 1) / PIPELINE_BUFFER_SIZE);
 
-    // Process full blocks of file data (using parallel threads if possible)
-    #pragma omp parallel for default(shared) schedule(nonmonotonic:dynamic)
-    for (size_t i = 0; i < full_blocks; i++)
+#if defined(_OPENMP)
+    const size_t threads = (size_t) omp_get_max_threads();
+#else
+    const size_t threads = 1;
+#endif
+
+    // Ring of reusable buffers (one being read, one being written, and the
+    // rest being crypted) bounds memory use regardless of file size
+    slots = MIN(2 * threads + 2, MAX(blocks, 1));
+
+    if (posix_memalign((void**) &ring, PIPELINE_BUFFER_ALIGN, slots * PIPELINE_BUFFER_SIZE) != 0)
     {
-        const u64 offset = i * BUFFER_SIZE;
-        u8 buffer[BUFFER_SIZE];
+        ring = NULL;
+        errno = ENOMEM;
+        goto error;
+    }
 
-        // Seekt to correct file position and read into buffer
-        #pragma omp critical(file)
+    // Reader, crypt, and writer stages linked by task dependencies.
+    // Reads and writes are each chained in file order through their file
+    // descriptors; a slot is only
+    // refilled once its previous contents have been written out.
+    #pragma omp parallel default(shared)
+    #pragma omp single
+    {
+        for (size_t i = 0; i < blocks; i++)
         {
-            if (success)
+            u8* const buffer = ring + (i % slots) * PIPELINE_BUFFER_SIZE;
+            const u64 offset = (u64) i * PIPELINE_BUFFER_SIZE;
+            const size_t block_size = (size_t) MIN(size - offset, PIPELINE_BUFFER_SIZE);
+
+            // Read stage
+            #pragma omp task default(shared) firstprivate(buffer, offset, block_size) depend(inout: infd, buffer[0])
             {
-                fseek(file, (long int) offset, SEEK_SET);
-                size_t read_size = fread(buffer, 1, BUFFER_SIZE, file);
+                int failed;
 
-                if (read_size != BUFFER_SIZE)
+                #pragma omp atomic read
+                failed = error;
+
+                if (!failed && !read_full(infd, buffer, block_size, offset))
                 {
-                    success = false;
+                    #pragma omp critical(crypt_error)
+                    if (!error)
+                    {
+                        error = errno;
+                        error_offset = offset;
+                    }
                 }
             }
-        }
 
-        // Uses a nonce with all zero bytes. NOTE: reusing a nonce value with the same
-        // key when encrypting two different plaintexts will void the security of the cipher.
-        // This example always uses a nonce of all zero bytes and is only for testing purposes.
-
-        // Crypt local file data
-        chacha_crypt_offset(key, 0, offset, buffer, buffer, BUFFER_SIZE);
+            // Crypt stage (runs concurrently across slots).
+            // Uses a nonce with all zero bytes, see crypt_file_parallel.
+            #pragma omp task default(shared) firstprivate(buffer, offset, block_size) depend(inout: buffer[0])
+            {
+                chacha_crypt_offset(key, 0, offset, buffer, buffer, block_size);
+            }
 
-        // Seek to correct file position and write crypted data
-        #pragma omp critical(file)
-        {
-            if (success)
+            // Write stage
+            #pragma omp task default(shared) firstprivate(buffer, offset, block_size) depend(inout: outfd, buffer[0])
             {
-                fseek(file, (long int) offset, SEEK_SET);
-                size_t write_size = fwrite(buffer, 1, BUFFER_SIZE, file);
+                int failed;
 
-                if (write_size != BUFFER_SIZE)
+                #pragma omp atomic read
+                failed = error;
+
+                if (!failed && !write_full(outfd, buffer, block_size, offset))
                 {
-                    success = false;
+                    #pragma omp critical(crypt_error)
+                    if (!error)
+                    {
+                        error = errno;
+                        error_offset = offset;
+                    }
                 }
             }
         }
     }
 
-    // Handle last partial block of file data
-    if (partial_size > 0)
+    if (error)
+    {
+        fprintf(stderr, "[crypt_file_pipeline] crypting '%s' to '%s' at offset %llu failed: %s\n",
+                inpath, outpath, (unsigned long long) error_offset, strerror(error));
+
+        success = false;
+    }
+
+    goto exit;
+
+error:
+    fprintf(stderr, "[crypt_file_pipeline] crypting '%s' to '%s' failed: %s\n",
+            inpath, outpath, strerror(errno));
+
+    success = false;
+
+exit:
+    // Wipe and release buffer ring
+    if (ring != NULL)
+    {
+        memwipe(ring, slots * PIPELINE_BUFFER_SIZE);
+        free(ring);
+    }
+
+    // Close files
+    if (infd >= 0)
     {
-        const size_t offset = full_blocks * BUFFER_SIZE;
-        u8 buffer[BUFFER_SIZE];
+        close(infd);
+    }
 
-        fseek(file, (long int) offset, SEEK_SET);
-        size_t read_size = fread(buffer, 1, partial_size, file);
+    if (outfd >= 0)
+    {
+        close(outfd);
+    }
 
-        if (read_size != partial_size)
+    return success;
+}
+
+// Encrypt a file into a new container (or onto the end of an existing one)
+bool container_pack(const char* inpath, const char* path, const u8 key[CHACHA_KEY_SIZE], bool append)
+{
+    const int fd = open(inpath, O_RDONLY);
+    u8* const buffer = (u8*) malloc(CONTAINER_BUFFER_SIZE);
+    chacha_container container;
+    bool opened = false;
+    bool success = true;
+
+    // Handle file failure
+    if (fd < 0 || buffer == NULL)
+    {
+        goto error;
+    }
+
+    opened = append
+        ? chacha_container_open(&container, path, key, true)
+        : chacha_container_create(&container, path, key, 0);
+
+    if (!opened)
+    {
+        success = false;
+        goto exit;
+    }
+
+    // Stream input data onto the end of the container
+    for (;;)
+    {
+        const ssize_t n = read(fd, buffer, CONTAINER_BUFFER_SIZE);
+
+        if (n < 0)
         {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
             goto error;
         }
 
-        chacha_crypt_offset(key, 0, offset, buffer, buffer, partial_size);
+        if (n == 0 || !chacha_container_append(&container, buffer, (size_t) n))
+        {
+            success = n == 0;
+            break;
+        }
+    }
+
+    goto exit;
+
+error:
+    fprintf(stderr, "[container_pack] packing '%s' into '%s' failed: %s\n",
+            inpath, path, strerror(errno));
+
+    success = false;
+
+exit:
+    // Write index and close container
+    if (opened && !chacha_container_close(&container))
+    {
+        success = false;
+    }
+
+    if (buffer != NULL)
+    {
+        memwipe(buffer, CONTAINER_BUFFER_SIZE);
+        free(buffer);
+    }
+
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+
+    return success;
+}
+
+// Decrypt a byte range of a container into a file (`size` of UINT64_MAX
+// extracts up to the end of the data)
+bool container_extract(
+    const char* path,
+    const char* outpath,
+    const u8 key[CHACHA_KEY_SIZE],
+    u64 offset,
+    u64 size)
+{
+    const int fd = open(outpath, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    u8* const buffer = (u8*) malloc(CONTAINER_BUFFER_SIZE);
+    chacha_container container;
+    bool opened = false;
+    bool success = true;
+
+    // Handle file failure
+    if (fd < 0 || buffer == NULL)
+    {
+        goto error;
+    }
+
+    if (!(opened = chacha_container_open(&container, path, key, false)))
+    {
+        success = false;
+        goto exit;
+    }
+
+    if (offset > container.size)
+    {
+        errno = EINVAL;
+        goto error;
+    }
+
+    size = MIN(size, container.size - offset);
+
+    // Decrypt the range in steps (chunks of each step are read in parallel)
+    for (u64 done = 0; done < size; )
+    {
+        const size_t n = (size_t) MIN(size - done, CONTAINER_BUFFER_SIZE);
 
-        fseek(file, (long int) offset, SEEK_SET);
-        size_t write_size = fwrite(buffer, 1, partial_size, file);
+        if (!chacha_container_read(&container, offset + done, buffer, n, 0))
+        {
+            success = false;
+            goto exit;
+        }
 
-        if (write_size != read_size)
+        if (!write_full(fd, buffer, n, done))
         {
             goto error;
         }
+
+        done += n;
     }
 
     goto exit;
 
 error:
-    fprintf(stderr, "[crypt_file_parallel] crypting '%s' failed: %s\n",
-            path, strerror(errno));
+    fprintf(stderr, "[container_extract] extracting '%s' to '%s' failed: %s\n",
+            path, outpath, strerror(errno));
 
     success = false;
 
 exit:
-    // Close input file
-    if (file != NULL)
+    if (opened)
+    {
+        chacha_container_close(&container);
+    }
+
+    if (buffer != NULL)
+    {
+        memwipe(buffer, CONTAINER_BUFFER_SIZE);
+        free(buffer);
+    }
+
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+
+    return success;
+}
+
+// Verify every chunk of a container (no key required)
+bool container_verify(const char* path)
+{
+    chacha_container container;
+
+    if (!chacha_container_open_unkeyed(&container, path))
     {
-        fclose(file);
+        return false;
     }
 
+    const bool success = chacha_container_verify(&container, 0);
+
+    chacha_container_close(&container);
+
+    return success;
+}
+
+// Combine a password with an empty key buffer
+static void password_key(u8 key[CHACHA_KEY_SIZE], char* password)
+{
+    memset(key, 0, CHACHA_KEY_SIZE);
+
+    if (password != NULL)
+    {
+        size_t password_len = strlen(password);
+        memxor(key, key, password, MIN(CHACHA_KEY_SIZE, password_len));
+        memwipe(password, password_len);
+    }
+}
+
+// Run a container mode (`argv` starts at the mode flag)
+static bool container_main(int argc, char** argv)
+{
+    const char* mode = argv[0];
+    u8 key[CHACHA_KEY_SIZE];
+    bool success = false;
+
+    if (strcmp(mode, "--verify") == 0 && argc == 2)
+    {
+        printf("Verifying '%s'...", argv[1]); fflush(stdout);
+        success = container_verify(argv[1]);
+    }
+    else if ((strcmp(mode, "--pack") == 0 || strcmp(mode, "--append") == 0) && (argc == 3 || argc == 4))
+    {
+        password_key(key, argc > 3 ? argv[3] : NULL);
+
+        printf("Packing '%s' into '%s' using ChaCha cipher...", argv[1], argv[2]); fflush(stdout);
+        success = container_pack(argv[1], argv[2], key, strcmp(mode, "--append") == 0);
+    }
+    else if (strcmp(mode, "--unpack") == 0 && (argc == 3 || argc == 4))
+    {
+        password_key(key, argc > 3 ? argv[3] : NULL);
+
+        printf("Unpacking '%s' to '%s' using ChaCha cipher...", argv[1], argv[2]); fflush(stdout);
+        success = container_extract(argv[1], argv[2], key, 0, UINT64_MAX);
+    }
+    else if (strcmp(mode, "--read") == 0 && (argc == 5 || argc == 6))
+    {
+        const u64 offset = strtoull(argv[2], NULL, 0);
+        const u64 size = strtoull(argv[3], NULL, 0);
+
+        password_key(key, argc > 5 ? argv[5] : NULL);
+
+        printf("Reading %llu bytes at offset %llu of '%s' to '%s'...",
+               (unsigned long long) size, (unsigned long long) offset, argv[1], argv[4]); fflush(stdout);
+        success = container_extract(argv[1], argv[4], key, offset, size);
+    }
+    else
+    {
+        fprintf(stderr, "Invalid arguments for %s\n", mode);
+        return false;
+    }
+
+    printf(success ? " done.\n" : " failed.\n");
+
+    // Securely wipe key buffer
+    memwipe(key, sizeof(key));
+
     return success;
 }
 
@@ -192,10 +636,32 @@ int main(int argc, char** argv)
 {
     u8 key_buffer[CHACHA_KEY_SIZE] = { 0 };
     bool success = true;
+    bool mapped = false;
+    const char* program = argv[0];
+
+    // Seekable chunked container modes
+    if (argc > 1 && strncmp(argv[1], "--", 2) == 0 && strcmp(argv[1], "--mmap") != 0)
+    {
+        success = container_main(argc - 1, argv + 1);
+        goto exit;
+    }
+
+    // Crypt through a shared memory mapping instead of positional I/O
+    if (argc > 1 && strcmp(argv[1], "--mmap") == 0)
+    {
+        mapped = true;
+        argv++;
+        argc--;
+    }
 
     if (argc < 2)
     {
-        printf("Usage: %s input_file [password] [output_file]\n", argv[0]);
+        printf("Usage: %s [--mmap] input_file [password] [output_file]\n", program);
+        printf("       %s --pack input_file container [password]\n", program);
+        printf("       %s --append input_file container [password]\n", program);
+        printf("       %s --unpack container output_file [password]\n", program);
+        printf("       %s --read container offset size output_file [password]\n", program);
+        printf("       %s --verify container\n", program);
         goto exit;
     }
 
@@ -204,26 +670,22 @@ int main(int argc, char** argv)
     const char* outpath = argv[argc < 4 ? 1 : 3];
 
     // Combine password with empty key buffer
-    if (password != NULL)
-    {
-        size_t password_len = strlen(password);
-        memxor(key_buffer, key_buffer, password, MIN(sizeof(key_buffer), password_len));
-        memwipe(password, password_len);
-    }
+    password_key(key_buffer, password);
 
-    // Copy input file to output path
+    // Crypt input file to output path in a single pass
     if (inpath != outpath && strcmp(inpath, outpath) != 0)
     {
-        printf("Copying '%s' to '%s'...", inpath, outpath); fflush(stdout);
-        success = copy_file(inpath, outpath);
+        printf("Crypting '%s' to '%s' using ChaCha cipher...", inpath, outpath); fflush(stdout);
+        success = crypt_file_pipeline(inpath, outpath, key_buffer);
         printf(success ? " done.\n" : " failed.\n");
     }
-
-    // Crypt file in parallel using threads
-    if (success)
+    // Crypt file in place in parallel using threads
+    else
     {
         printf("Crypting '%s' using ChaCha cipher...", outpath); fflush(stdout);
-        success = crypt_file_parallel(outpath, key_buffer);
+        success = mapped
+            ? crypt_file_mapped(outpath, key_buffer)
+            : crypt_file_parallel(outpath, key_buffer);
         printf(success ? " done.\n" : " failed.\n");
     }
 
@@ -0,0 +1,259 @@
+#include <pthread.h>
+
+#include "poly1305_internal.h"
+
+// Minimum number of whole blocks worth handing to a vector kernel
+#define POLY1305_VECTOR_MIN_BLOCKS 16
+
+// Vector kernel bound for the running CPU
+typedef struct poly1305_dispatch
+{
+    poly1305_kernel_t kernel;
+    size_t lanes;
+} poly1305_dispatch;
+
+static poly1305_dispatch POLY1305_DISPATCH;
+static pthread_once_t POLY1305_DISPATCH_ONCE = PTHREAD_ONCE_INIT;
+
+// Bind the vector kernel from the detected CPU features
+static void poly1305_dispatch_resolve(void)
+{
+    poly1305_dispatch d = { NULL, 0 };
+
+#if CPU_X86
+    const u32 features = cpu_features();
+
+    if (cpu_has(features, CPU_FEATURE_AVX2))
+    {
+        d.kernel = poly1305_blocks_avx2;
+        d.lanes = 4;
+    }
+#endif
+
+    POLY1305_DISPATCH = d;
+}
+
+// Multiply h by r modulo 2^130 - 5 (26-bit limbs, partially reduced)
+static void poly1305_multiply(u32 h[5], const u32 r[5])
+{
+    const u32 s1 = r[1] * 5;
+    const u32 s2 = r[2] * 5;
+    const u32 s3 = r[3] * 5;
+    const u32 s4 = r[4] * 5;
+
+    const u64 d0 = (u64) h[0] * r[0] + (u64) h[1] * s4 + (u64) h[2] * s3 + (u64) h[3] * s2 + (u64) h[4] * s1;
+    u64 d1 = (u64) h[0] * r[1] + (u64) h[1] * r[0] + (u64) h[2] * s4 + (u64) h[3] * s3 + (u64) h[4] * s2;
+    u64 d2 = (u64) h[0] * r[2] + (u64) h[1] * r[1] + (u64) h[2] * r[0] + (u64) h[3] * s4 + (u64) h[4] * s3;
+    u64 d3 = (u64) h[0] * r[3] + (u64) h[1] * r[2] + (u64) h[2] * r[1] + (u64) h[3] * r[0] + (u64) h[4] * s4;
+    u64 d4 = (u64) h[0] * r[4] + (u64) h[1] * r[3] + (u64) h[2] * r[2] + (u64) h[3] * r[1] + (u64) h[4] * r[0];
+
+    // Propagate carries (wrapping the top limb back in times 5)
+    u32 c;
+
+    c = (u32) (d0 >> 26); h[0] = (u32) d0 & POLY1305_LIMB_MASK;
+    d1 += c; c = (u32) (d1 >> 26); h[1] = (u32) d1 & POLY1305_LIMB_MASK;
+    d2 += c; c = (u32) (d2 >> 26); h[2] = (u32) d2 & POLY1305_LIMB_MASK;
+    d3 += c; c = (u32) (d3 >> 26); h[3] = (u32) d3 & POLY1305_LIMB_MASK;
+    d4 += c; c = (u32) (d4 >> 26); h[4] = (u32) d4 & POLY1305_LIMB_MASK;
+    h[0] += c * 5; c = h[0] >> 26; h[0] &= POLY1305_LIMB_MASK;
+    h[1] += c;
+}
+
+// Absorb full message blocks one at a time.
+// `hibit` is 1 << 24 for whole blocks and 0 for the padded final block.
+static void poly1305_blocks(poly1305_ctx* ctx, const u8* data, size_t blocks, u32 hibit)
+{
+    for (; blocks > 0; blocks--)
+    {
+        ctx->h[0] += (load32_le(data + 0) >> 0) & POLY1305_LIMB_MASK;
+        ctx->h[1] += (load32_le(data + 3) >> 2) & POLY1305_LIMB_MASK;
+        ctx->h[2] += (load32_le(data + 6) >> 4) & POLY1305_LIMB_MASK;
+        ctx->h[3] += (load32_le(data + 9) >> 6) & POLY1305_LIMB_MASK;
+        ctx->h[4] += (load32_le(data + 12) >> 8) | hibit;
+
+        poly1305_multiply(ctx->h, ctx->r);
+
+        data += POLY1305_BLOCK_SIZE;
+    }
+}
+
+// Absorb full message blocks using the vector kernel when worthwhile
+static void poly1305_blocks_dispatch(poly1305_ctx* ctx, const u8* data, size_t blocks)
+{
+    pthread_once(&POLY1305_DISPATCH_ONCE, poly1305_dispatch_resolve);
+
+    if (POLY1305_DISPATCH.kernel != NULL && blocks >= POLY1305_VECTOR_MIN_BLOCKS)
+    {
+        const size_t n = blocks / POLY1305_DISPATCH.lanes * POLY1305_DISPATCH.lanes;
+
+        POLY1305_DISPATCH.kernel(ctx, data, n);
+
+        data += n * POLY1305_BLOCK_SIZE;
+        blocks -= n;
+    }
+
+    poly1305_blocks(ctx, data, blocks, 1 << 24);
+}
+
+// Set initial state for Poly1305 context using a one-time key
+void poly1305_init(poly1305_ctx* ctx, const u8 key[POLY1305_KEY_SIZE])
+{
+    // r &= 0xffffffc0ffffffc0ffffffc0fffffff
+    ctx->r[0] = (load32_le(key + 0) >> 0) & 0x3ffffff;
+    ctx->r[1] = (load32_le(key + 3) >> 2) & 0x3ffff03;
+    ctx->r[2] = (load32_le(key + 6) >> 4) & 0x3ffc0ff;
+    ctx->r[3] = (load32_le(key + 9) >> 6) & 0x3f03fff;
+    ctx->r[4] = (load32_le(key + 12) >> 8) & 0x00fffff;
+
+    // s
+    ctx->pad[0] = load32_le(key + 16);
+    ctx->pad[1] = load32_le(key + 20);
+    ctx->pad[2] = load32_le(key + 24);
+    ctx->pad[3] = load32_le(key + 28);
+
+    // h = 0
+    memset(ctx->h, 0, sizeof(ctx->h));
+
+    // Powers r^1 through r^4 for vector kernels
+    memcpy(ctx->powers[0], ctx->r, sizeof(ctx->r));
+
+    for (size_t i = 1; i < 4; i++)
+    {
+        memcpy(ctx->powers[i], ctx->powers[i - 1], sizeof(ctx->r));
+        poly1305_multiply(ctx->powers[i], ctx->r);
+    }
+
+    ctx->leftover = 0;
+}
+
+// Authenticate more data using a Poly1305 context
+void poly1305_update(poly1305_ctx* ctx, const void* data, size_t size)
+{
+    const u8* p = (const u8*) data;
+
+    // Complete any buffered partial block
+    if (ctx->leftover > 0)
+    {
+        const size_t msize = MIN(size, POLY1305_BLOCK_SIZE - ctx->leftover);
+
+        memcpy(ctx->buffer + ctx->leftover, p, msize);
+        ctx->leftover += msize;
+        p += msize;
+        size -= msize;
+
+        if (ctx->leftover < POLY1305_BLOCK_SIZE)
+        {
+            return;
+        }
+
+        poly1305_blocks(ctx, ctx->buffer, 1, 1 << 24);
+        ctx->leftover = 0;
+    }
+
+    // Absorb whole blocks
+    const size_t blocks = size / POLY1305_BLOCK_SIZE;
+
+    if (blocks > 0)
+    {
+        poly1305_blocks_dispatch(ctx, p, blocks);
+
+        p += blocks * POLY1305_BLOCK_SIZE;
+        size -= blocks * POLY1305_BLOCK_SIZE;
+    }
+
+    // Buffer the remaining partial block
+    memcpy(ctx->buffer, p, size);
+    ctx->leftover = size;
+}
+
+// Produce the tag of all authenticated data and securely teardown the context
+void poly1305_final(poly1305_ctx* ctx, u8 tag[POLY1305_TAG_SIZE])
+{
+    u32 h0, h1, h2, h3, h4, c;
+    u32 g0, g1, g2, g3, g4;
+    u32 mask;
+    u64 f;
+
+    // Absorb the final partial block (padded with a single one bit)
+    if (ctx->leftover > 0)
+    {
+        ctx->buffer[ctx->leftover] = 1;
+        memset(ctx->buffer + ctx->leftover + 1, 0, POLY1305_BLOCK_SIZE - ctx->leftover - 1);
+
+        poly1305_blocks(ctx, ctx->buffer, 1, 0);
+    }
+
+    // Fully carry h
+    h0 = ctx->h[0]; h1 = ctx->h[1]; h2 = ctx->h[2]; h3 = ctx->h[3]; h4 = ctx->h[4];
+
+    c = h1 >> 26; h1 &= POLY1305_LIMB_MASK;
+    h2 += c; c = h2 >> 26; h2 &= POLY1305_LIMB_MASK;
+    h3 += c; c = h3 >> 26; h3 &= POLY1305_LIMB_MASK;
+    h4 += c; c = h4 >> 26; h4 &= POLY1305_LIMB_MASK;
+    h0 += c * 5; c = h0 >> 26; h0 &= POLY1305_LIMB_MASK;
+    h1 += c;
+
+    // Compute h + -p
+    g0 = h0 + 5; c = g0 >> 26; g0 &= POLY1305_LIMB_MASK;
+    g1 = h1 + c; c = g1 >> 26; g1 &= POLY1305_LIMB_MASK;
+    g2 = h2 + c; c = g2 >> 26; g2 &= POLY1305_LIMB_MASK;
+    g3 = h3 + c; c = g3 >> 26; g3 &= POLY1305_LIMB_MASK;
+    g4 = h4 + c - (1 << 26);
+
+    // Select h if h < p, or h + -p if h >= p (in constant time)
+    mask = (g4 >> 31) - 1;
+    g0 &= mask; g1 &= mask; g2 &= mask; g3 &= mask; g4 &= mask;
+    mask = ~mask;
+    h0 = (h0 & mask) | g0;
+    h1 = (h1 & mask) | g1;
+    h2 = (h2 & mask) | g2;
+    h3 = (h3 & mask) | g3;
+    h4 = (h4 & mask) | g4;
+
+    // h = h % 2^128
+    h0 = (h0 >> 0) | (h1 << 26);
+    h1 = (h1 >> 6) | (h2 << 20);
+    h2 = (h2 >> 12) | (h3 << 14);
+    h3 = (h3 >> 18) | (h4 << 8);
+
+    // tag = (h + s) % 2^128
+    f = (u64) h0 + ctx->pad[0]; h0 = (u32) f;
+    f = (u64) h1 + ctx->pad[1] + (f >> 32); h1 = (u32) f;
+    f = (u64) h2 + ctx->pad[2] + (f >> 32); h2 = (u32) f;
+    f = (u64) h3 + ctx->pad[3] + (f >> 32); h3 = (u32) f;
+
+    store32_le(tag + 0, h0);
+    store32_le(tag + 4, h1);
+    store32_le(tag + 8, h2);
+    store32_le(tag + 12, h3);
+
+    // Teardown context
+    memwipe(ctx, sizeof(*ctx));
+}
+
+// Calculate the Poly1305 tag of the provided data using a one-time key
+void poly1305_compute(
+    const u8 key[POLY1305_KEY_SIZE],
+    const void* data,
+    size_t size,
+    u8 tag[POLY1305_TAG_SIZE])
+{
+    poly1305_ctx ctx;
+
+    poly1305_init(&ctx, key);
+    poly1305_update(&ctx, data, size);
+    poly1305_final(&ctx, tag);
+}
+
+// Compare two tags in constant time
+bool poly1305_verify(const u8 a[POLY1305_TAG_SIZE], const u8 b[POLY1305_TAG_SIZE])
+{
+    u32 diff = 0;
+
+    for (size_t i = 0; i < POLY1305_TAG_SIZE; i++)
+    {
+        diff |= (u32) (a[i] ^ b[i]);
+    }
+
+    return diff == 0;
+}
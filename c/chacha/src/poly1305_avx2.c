@@ -0,0 +1,165 @@
+#include "poly1305_internal.h"
+
+#if defined(__AVX2__)
+
+#include <immintrin.h>
+
+// Number of blocks processed in parallel
+#define POLY1305_AVX2_LANES 4
+
+// Multiply each lane of h by the matching lane of r modulo 2^130 - 5.
+// Limbs are 26-bit values held in 64-bit lanes; s holds 5 * r.
+static inline void poly1305_multiply_avx2(
+    __m256i h[5],
+    const __m256i r[5],
+    const __m256i s[5])
+{
+    const __m256i mask = _mm256_set1_epi64x(POLY1305_LIMB_MASK);
+
+    __m256i d0 = _mm256_mul_epu32(h[0], r[0]);
+    __m256i d1 = _mm256_mul_epu32(h[0], r[1]);
+    __m256i d2 = _mm256_mul_epu32(h[0], r[2]);
+    __m256i d3 = _mm256_mul_epu32(h[0], r[3]);
+    __m256i d4 = _mm256_mul_epu32(h[0], r[4]);
+
+    d0 = _mm256_add_epi64(d0, _mm256_mul_epu32(h[1], s[4]));
+    d1 = _mm256_add_epi64(d1, _mm256_mul_epu32(h[1], r[0]));
+    d2 = _mm256_add_epi64(d2, _mm256_mul_epu32(h[1], r[1]));
+    d3 = _mm256_add_epi64(d3, _mm256_mul_epu32(h[1], r[2]));
+    d4 = _mm256_add_epi64(d4, _mm256_mul_epu32(h[1], r[3]));
+
+    d0 = _mm256_add_epi64(d0, _mm256_mul_epu32(h[2], s[3]));
+    d1 = _mm256_add_epi64(d1, _mm256_mul_epu32(h[2], s[4]));
+    d2 = _mm256_add_epi64(d2, _mm256_mul_epu32(h[2], r[0]));
+    d3 = _mm256_add_epi64(d3, _mm256_mul_epu32(h[2], r[1]));
+    d4 = _mm256_add_epi64(d4, _mm256_mul_epu32(h[2], r[2]));
+
+    d0 = _mm256_add_epi64(d0, _mm256_mul_epu32(h[3], s[2]));
+    d1 = _mm256_add_epi64(d1, _mm256_mul_epu32(h[3], s[3]));
+    d2 = _mm256_add_epi64(d2, _mm256_mul_epu32(h[3], s[4]));
+    d3 = _mm256_add_epi64(d3, _mm256_mul_epu32(h[3], r[0]));
+    d4 = _mm256_add_epi64(d4, _mm256_mul_epu32(h[3], r[1]));
+
+    d0 = _mm256_add_epi64(d0, _mm256_mul_epu32(h[4], s[1]));
+    d1 = _mm256_add_epi64(d1, _mm256_mul_epu32(h[4], s[2]));
+    d2 = _mm256_add_epi64(d2, _mm256_mul_epu32(h[4], s[3]));
+    d3 = _mm256_add_epi64(d3, _mm256_mul_epu32(h[4], s[4]));
+    d4 = _mm256_add_epi64(d4, _mm256_mul_epu32(h[4], r[0]));
+
+    // Propagate carries (wrapping the top limb back in times 5)
+    __m256i c;
+
+    c = _mm256_srli_epi64(d0, 26); h[0] = _mm256_and_si256(d0, mask);
+    d1 = _mm256_add_epi64(d1, c); c = _mm256_srli_epi64(d1, 26); h[1] = _mm256_and_si256(d1, mask);
+    d2 = _mm256_add_epi64(d2, c); c = _mm256_srli_epi64(d2, 26); h[2] = _mm256_and_si256(d2, mask);
+    d3 = _mm256_add_epi64(d3, c); c = _mm256_srli_epi64(d3, 26); h[3] = _mm256_and_si256(d3, mask);
+    d4 = _mm256_add_epi64(d4, c); c = _mm256_srli_epi64(d4, 26); h[4] = _mm256_and_si256(d4, mask);
+
+    h[0] = _mm256_add_epi64(h[0], _mm256_add_epi64(c, _mm256_slli_epi64(c, 2)));
+    c = _mm256_srli_epi64(h[0], 26); h[0] = _mm256_and_si256(h[0], mask);
+    h[1] = _mm256_add_epi64(h[1], c);
+}
+
+// Load a limb of r^n for each lane along with its multiple of 5
+static inline void poly1305_load_powers_avx2(
+    __m256i r[5],
+    __m256i s[5],
+    const u32 powers[4][5],
+    size_t p0,
+    size_t p1,
+    size_t p2,
+    size_t p3)
+{
+    for (size_t i = 0; i < 5; i++)
+    {
+        r[i] = _mm256_set_epi64x(powers[p3][i], powers[p2][i], powers[p1][i], powers[p0][i]);
+        s[i] = _mm256_add_epi64(r[i], _mm256_slli_epi64(r[i], 2));
+    }
+}
+
+// Absorb blocks four at a time using AVX2.
+// Lane j accumulates every fourth block using r^4, then the lanes are
+// multiplied by the remaining powers of r and summed into the accumulator.
+void poly1305_blocks_avx2(
+    poly1305_ctx* ctx,
+    const u8* data,
+    size_t blocks)
+{
+    const __m256i mask = _mm256_set1_epi64x(POLY1305_LIMB_MASK);
+    const __m256i hibit = _mm256_set1_epi64x(1 << 24);
+    __m256i r[5];
+    __m256i s[5];
+    __m256i h[5];
+
+    if (blocks < POLY1305_AVX2_LANES)
+    {
+        return;
+    }
+
+    // Start lane 0 from the current accumulator
+    for (size_t i = 0; i < 5; i++)
+    {
+        h[i] = _mm256_set_epi64x(0, 0, 0, ctx->h[i]);
+    }
+
+    // Each lane steps by r^4
+    poly1305_load_powers_avx2(r, s, ctx->powers, 3, 3, 3, 3);
+
+    for (;;)
+    {
+        // Split four blocks into 26-bit limbs. Unpacking within 128-bit
+        // halves places blocks 0, 2, 1, and 3 in lanes 0 through 3.
+        const __m256i m01 = _mm256_loadu_si256((const __m256i *) (data + 0));
+        const __m256i m23 = _mm256_loadu_si256((const __m256i *) (data + 32));
+        const __m256i lo = _mm256_unpacklo_epi64(m01, m23);
+        const __m256i hi = _mm256_unpackhi_epi64(m01, m23);
+
+        const __m256i m0 = _mm256_and_si256(lo, mask);
+        const __m256i m1 = _mm256_and_si256(_mm256_srli_epi64(lo, 26), mask);
+        const __m256i m2 = _mm256_and_si256(_mm256_or_si256(_mm256_srli_epi64(lo, 52), _mm256_slli_epi64(hi, 12)), mask);
+        const __m256i m3 = _mm256_and_si256(_mm256_srli_epi64(hi, 14), mask);
+        const __m256i m4 = _mm256_or_si256(_mm256_srli_epi64(hi, 40), hibit);
+
+        h[0] = _mm256_add_epi64(h[0], m0);
+        h[1] = _mm256_add_epi64(h[1], m1);
+        h[2] = _mm256_add_epi64(h[2], m2);
+        h[3] = _mm256_add_epi64(h[3], m3);
+        h[4] = _mm256_add_epi64(h[4], m4);
+
+        data += POLY1305_AVX2_LANES * POLY1305_BLOCK_SIZE;
+        blocks -= POLY1305_AVX2_LANES;
+
+        if (blocks < POLY1305_AVX2_LANES)
+        {
+            break;
+        }
+
+        poly1305_multiply_avx2(h, r, s);
+    }
+
+    // Lanes hold blocks 0, 2, 1, and 3 of the last group, which still
+    // need r^4, r^2, r^3, and r^1 respectively
+    poly1305_load_powers_avx2(r, s, ctx->powers, 3, 1, 2, 0);
+    poly1305_multiply_avx2(h, r, s);
+
+    // Sum lanes and carry into the scalar accumulator
+    u64 d[5];
+
+    for (size_t i = 0; i < 5; i++)
+    {
+        const __m128i t = _mm_add_epi64(_mm256_castsi256_si128(h[i]), _mm256_extracti128_si256(h[i], 1));
+        d[i] = (u64) _mm_cvtsi128_si64(t) + (u64) _mm_extract_epi64(t, 1);
+    }
+
+    u64 c;
+
+    c = d[0] >> 26; ctx->h[0] = (u32) d[0] & POLY1305_LIMB_MASK;
+    d[1] += c; c = d[1] >> 26; ctx->h[1] = (u32) d[1] & POLY1305_LIMB_MASK;
+    d[2] += c; c = d[2] >> 26; ctx->h[2] = (u32) d[2] & POLY1305_LIMB_MASK;
+    d[3] += c; c = d[3] >> 26; ctx->h[3] = (u32) d[3] & POLY1305_LIMB_MASK;
+    d[4] += c; c = d[4] >> 26; ctx->h[4] = (u32) d[4] & POLY1305_LIMB_MASK;
+    ctx->h[0] += (u32) c * 5; c = ctx->h[0] >> 26; ctx->h[0] &= POLY1305_LIMB_MASK;
+    ctx->h[1] += (u32) c;
+}
+
+#endif
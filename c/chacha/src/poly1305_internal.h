@@ -0,0 +1,27 @@
+#pragma once
+
+#include "poly1305.h"
+#include "cpu.h"
+
+// Mask of a 26-bit accumulator limb
+#define POLY1305_LIMB_MASK 0x3ffffff
+
+// Poly1305 block kernel function type.
+// Absorbs `blocks` full message blocks into the accumulator of `ctx`.
+typedef void (*poly1305_kernel_t)(
+    poly1305_ctx* ctx,
+    const u8* data,
+    size_t blocks);
+
+// Instruction set specific kernels.
+// Each is built in its own translation unit with its own target flags and
+// MUST only be called when the CPU feature noted above it is available.
+
+#if CPU_X86
+// Absorb blocks four at a time using AVX2 (`blocks` MUST be a multiple of 4)
+// Requires CPU_FEATURE_AVX2
+void poly1305_blocks_avx2(
+    poly1305_ctx* ctx,
+    const u8* data,
+    size_t blocks);
+#endif
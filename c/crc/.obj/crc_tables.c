@@ -0,0 +1,6110 @@
+// Generated by crc_gen from crc_models.h. Do not edit.
+
+#include "crc_internal.h"
+
+// CRC-16/IBM-3740 slicing tables (generic engine)
+const u64 CRC16_IBM_3740_SLICE64_TABLE[8][256] =
+{
+    {
+        U64_C(0x0000000000000000), U64_C(0x1021000000000000), U64_C(0x2042000000000000), U64_C(0x3063000000000000),
+        U64_C(0x4084000000000000), U64_C(0x50A5000000000000), U64_C(0x60C6000000000000), U64_C(0x70E7000000000000),
+        U64_C(0x8108000000000000), U64_C(0x9129000000000000), U64_C(0xA14A000000000000), U64_C(0xB16B000000000000),
+        U64_C(0xC18C000000000000), U64_C(0xD1AD000000000000), U64_C(0xE1CE000000000000), U64_C(0xF1EF000000000000),
+        U64_C(0x1231000000000000), U64_C(0x0210000000000000), U64_C(0x3273000000000000), U64_C(0x2252000000000000),
+        U64_C(0x52B5000000000000), U64_C(0x4294000000000000), U64_C(0x72F7000000000000), U64_C(0x62D6000000000000),
+        U64_C(0x9339000000000000), U64_C(0x8318000000000000), U64_C(0xB37B000000000000), U64_C(0xA35A000000000000),
+        U64_C(0xD3BD000000000000), U64_C(0xC39C000000000000), U64_C(0xF3FF000000000000), U64_C(0xE3DE000000000000),
+        U64_C(0x2462000000000000), U64_C(0x3443000000000000), U64_C(0x0420000000000000), U64_C(0x1401000000000000),
+        U64_C(0x64E6000000000000), U64_C(0x74C7000000000000), U64_C(0x44A4000000000000), U64_C(0x5485000000000000),
+        U64_C(0xA56A000000000000), U64_C(0xB54B000000000000), U64_C(0x8528000000000000), U64_C(0x9509000000000000),
+        U64_C(0xE5EE000000000000), U64_C(0xF5CF000000000000), U64_C(0xC5AC000000000000), U64_C(0xD58D000000000000),
+        U64_C(0x3653000000000000), U64_C(0x2672000000000000), U64_C(0x1611000000000000), U64_C(0x0630000000000000),
+        U64_C(0x76D7000000000000), U64_C(0x66F6000000000000), U64_C(0x5695000000000000), U64_C(0x46B4000000000000),
+        U64_C(0xB75B000000000000), U64_C(0xA77A000000000000), U64_C(0x9719000000000000), U64_C(0x8738000000000000),
+        U64_C(0xF7DF000000000000), U64_C(0xE7FE000000000000), U64_C(0xD79D000000000000), U64_C(0xC7BC000000000000),
+        U64_C(0x48C4000000000000), U64_C(0x58E5000000000000), U64_C(0x6886000000000000), U64_C(0x78A7000000000000),
+        U64_C(0x0840000000000000), U64_C(0x1861000000000000), U64_C(0x2802000000000000), U64_C(0x3823000000000000),
+        U64_C(0xC9CC000000000000), U64_C(0xD9ED000000000000), U64_C(0xE98E000000000000), U64_C(0xF9AF000000000000),
+        U64_C(0x8948000000000000), U64_C(0x9969000000000000), U64_C(0xA90A000000000000), U64_C(0xB92B000000000000),
+        U64_C(0x5AF5000000000000), U64_C(0x4AD4000000000000), U64_C(0x7AB7000000000000), U64_C(0x6A96000000000000),
+        U64_C(0x1A71000000000000), U64_C(0x0A50000000000000), U64_C(0x3A33000000000000), U64_C(0x2A12000000000000),
+        U64_C(0xDBFD000000000000), U64_C(0xCBDC000000000000), U64_C(0xFBBF000000000000), U64_C(0xEB9E000000000000),
+        U64_C(0x9B79000000000000), U64_C(0x8B58000000000000), U64_C(0xBB3B000000000000), U64_C(0xAB1A000000000000),
+        U64_C(0x6CA6000000000000), U64_C(0x7C87000000000000), U64_C(0x4CE4000000000000), U64_C(0x5CC5000000000000),
+        U64_C(0x2C22000000000000), U64_C(0x3C03000000000000), U64_C(0x0C60000000000000), U64_C(0x1C41000000000000),
+        U64_C(0xEDAE000000000000), U64_C(0xFD8F000000000000), U64_C(0xCDEC000000000000), U64_C(0xDDCD000000000000),
+        U64_C(0xAD2A000000000000), U64_C(0xBD0B000000000000), U64_C(0x8D68000000000000), U64_C(0x9D49000000000000),
+        U64_C(0x7E97000000000000), U64_C(0x6EB6000000000000), U64_C(0x5ED5000000000000), U64_C(0x4EF4000000000000),
+        U64_C(0x3E13000000000000), U64_C(0x2E32000000000000), U64_C(0x1E51000000000000), U64_C(0x0E70000000000000),
+        U64_C(0xFF9F000000000000), U64_C(0xEFBE000000000000), U64_C(0xDFDD000000000000), U64_C(0xCFFC000000000000),
+        U64_C(0xBF1B000000000000), U64_C(0xAF3A000000000000), U64_C(0x9F59000000000000), U64_C(0x8F78000000000000),
+        U64_C(0x9188000000000000), U64_C(0x81A9000000000000), U64_C(0xB1CA000000000000), U64_C(0xA1EB000000000000),
+        U64_C(0xD10C000000000000), U64_C(0xC12D000000000000), U64_C(0xF14E000000000000), U64_C(0xE16F000000000000),
+        U64_C(0x1080000000000000), U64_C(0x00A1000000000000), U64_C(0x30C2000000000000), U64_C(0x20E3000000000000),
+        U64_C(0x5004000000000000), U64_C(0x4025000000000000), U64_C(0x7046000000000000), U64_C(0x6067000000000000),
+        U64_C(0x83B9000000000000), U64_C(0x9398000000000000), U64_C(0xA3FB000000000000), U64_C(0xB3DA000000000000),
+        U64_C(0xC33D000000000000), U64_C(0xD31C000000000000), U64_C(0xE37F000000000000), U64_C(0xF35E000000000000),
+        U64_C(0x02B1000000000000), U64_C(0x1290000000000000), U64_C(0x22F3000000000000), U64_C(0x32D2000000000000),
+        U64_C(0x4235000000000000), U64_C(0x5214000000000000), U64_C(0x6277000000000000), U64_C(0x7256000000000000),
+        U64_C(0xB5EA000000000000), U64_C(0xA5CB000000000000), U64_C(0x95A8000000000000), U64_C(0x8589000000000000),
+        U64_C(0xF56E000000000000), U64_C(0xE54F000000000000), U64_C(0xD52C000000000000), U64_C(0xC50D000000000000),
+        U64_C(0x34E2000000000000), U64_C(0x24C3000000000000), U64_C(0x14A0000000000000), U64_C(0x0481000000000000),
+        U64_C(0x7466000000000000), U64_C(0x6447000000000000), U64_C(0x5424000000000000), U64_C(0x4405000000000000),
+        U64_C(0xA7DB000000000000), U64_C(0xB7FA000000000000), U64_C(0x8799000000000000), U64_C(0x97B8000000000000),
+        U64_C(0xE75F000000000000), U64_C(0xF77E000000000000), U64_C(0xC71D000000000000), U64_C(0xD73C000000000000),
+        U64_C(0x26D3000000000000), U64_C(0x36F2000000000000), U64_C(0x0691000000000000), U64_C(0x16B0000000000000),
+        U64_C(0x6657000000000000), U64_C(0x7676000000000000), U64_C(0x4615000000000000), U64_C(0x5634000000000000),
+        U64_C(0xD94C000000000000), U64_C(0xC96D000000000000), U64_C(0xF90E000000000000), U64_C(0xE92F000000000000),
+        U64_C(0x99C8000000000000), U64_C(0x89E9000000000000), U64_C(0xB98A000000000000), U64_C(0xA9AB000000000000),
+        U64_C(0x5844000000000000), U64_C(0x4865000000000000), U64_C(0x7806000000000000), U64_C(0x6827000000000000),
+        U64_C(0x18C0000000000000), U64_C(0x08E1000000000000), U64_C(0x3882000000000000), U64_C(0x28A3000000000000),
+        U64_C(0xCB7D000000000000), U64_C(0xDB5C000000000000), U64_C(0xEB3F000000000000), U64_C(0xFB1E000000000000),
+        U64_C(0x8BF9000000000000), U64_C(0x9BD8000000000000), U64_C(0xABBB000000000000), U64_C(0xBB9A000000000000),
+        U64_C(0x4A75000000000000), U64_C(0x5A54000000000000), U64_C(0x6A37000000000000), U64_C(0x7A16000000000000),
+        U64_C(0x0AF1000000000000), U64_C(0x1AD0000000000000), U64_C(0x2AB3000000000000), U64_C(0x3A92000000000000),
+        U64_C(0xFD2E000000000000), U64_C(0xED0F000000000000), U64_C(0xDD6C000000000000), U64_C(0xCD4D000000000000),
+        U64_C(0xBDAA000000000000), U64_C(0xAD8B000000000000), U64_C(0x9DE8000000000000), U64_C(0x8DC9000000000000),
+        U64_C(0x7C26000000000000), U64_C(0x6C07000000000000), U64_C(0x5C64000000000000), U64_C(0x4C45000000000000),
+        U64_C(0x3CA2000000000000), U64_C(0x2C83000000000000), U64_C(0x1CE0000000000000), U64_C(0x0CC1000000000000),
+        U64_C(0xEF1F000000000000), U64_C(0xFF3E000000000000), U64_C(0xCF5D000000000000), U64_C(0xDF7C000000000000),
+        U64_C(0xAF9B000000000000), U64_C(0xBFBA000000000000), U64_C(0x8FD9000000000000), U64_C(0x9FF8000000000000),
+        U64_C(0x6E17000000000000), U64_C(0x7E36000000000000), U64_C(0x4E55000000000000), U64_C(0x5E74000000000000),
+        U64_C(0x2E93000000000000), U64_C(0x3EB2000000000000), U64_C(0x0ED1000000000000), U64_C(0x1EF0000000000000),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x3331000000000000), U64_C(0x6662000000000000), U64_C(0x5553000000000000),
+        U64_C(0xCCC4000000000000), U64_C(0xFFF5000000000000), U64_C(0xAAA6000000000000), U64_C(0x9997000000000000),
+        U64_C(0x89A9000000000000), U64_C(0xBA98000000000000), U64_C(0xEFCB000000000000), U64_C(0xDCFA000000000000),
+        U64_C(0x456D000000000000), U64_C(0x765C000000000000), U64_C(0x230F000000000000), U64_C(0x103E000000000000),
+        U64_C(0x0373000000000000), U64_C(0x3042000000000000), U64_C(0x6511000000000000), U64_C(0x5620000000000000),
+        U64_C(0xCFB7000000000000), U64_C(0xFC86000000000000), U64_C(0xA9D5000000000000), U64_C(0x9AE4000000000000),
+        U64_C(0x8ADA000000000000), U64_C(0xB9EB000000000000), U64_C(0xECB8000000000000), U64_C(0xDF89000000000000),
+        U64_C(0x461E000000000000), U64_C(0x752F000000000000), U64_C(0x207C000000000000), U64_C(0x134D000000000000),
+        U64_C(0x06E6000000000000), U64_C(0x35D7000000000000), U64_C(0x6084000000000000), U64_C(0x53B5000000000000),
+        U64_C(0xCA22000000000000), U64_C(0xF913000000000000), U64_C(0xAC40000000000000), U64_C(0x9F71000000000000),
+        U64_C(0x8F4F000000000000), U64_C(0xBC7E000000000000), U64_C(0xE92D000000000000), U64_C(0xDA1C000000000000),
+        U64_C(0x438B000000000000), U64_C(0x70BA000000000000), U64_C(0x25E9000000000000), U64_C(0x16D8000000000000),
+        U64_C(0x0595000000000000), U64_C(0x36A4000000000000), U64_C(0x63F7000000000000), U64_C(0x50C6000000000000),
+        U64_C(0xC951000000000000), U64_C(0xFA60000000000000), U64_C(0xAF33000000000000), U64_C(0x9C02000000000000),
+        U64_C(0x8C3C000000000000), U64_C(0xBF0D000000000000), U64_C(0xEA5E000000000000), U64_C(0xD96F000000000000),
+        U64_C(0x40F8000000000000), U64_C(0x73C9000000000000), U64_C(0x269A000000000000), U64_C(0x15AB000000000000),
+        U64_C(0x0DCC000000000000), U64_C(0x3EFD000000000000), U64_C(0x6BAE000000000000), U64_C(0x589F000000000000),
+        U64_C(0xC108000000000000), U64_C(0xF239000000000000), U64_C(0xA76A000000000000), U64_C(0x945B000000000000),
+        U64_C(0x8465000000000000), U64_C(0xB754000000000000), U64_C(0xE207000000000000), U64_C(0xD136000000000000),
+        U64_C(0x48A1000000000000), U64_C(0x7B90000000000000), U64_C(0x2EC3000000000000), U64_C(0x1DF2000000000000),
+        U64_C(0x0EBF000000000000), U64_C(0x3D8E000000000000), U64_C(0x68DD000000000000), U64_C(0x5BEC000000000000),
+        U64_C(0xC27B000000000000), U64_C(0xF14A000000000000), U64_C(0xA419000000000000), U64_C(0x9728000000000000),
+        U64_C(0x8716000000000000), U64_C(0xB427000000000000), U64_C(0xE174000000000000), U64_C(0xD245000000000000),
+        U64_C(0x4BD2000000000000), U64_C(0x78E3000000000000), U64_C(0x2DB0000000000000), U64_C(0x1E81000000000000),
+        U64_C(0x0B2A000000000000), U64_C(0x381B000000000000), U64_C(0x6D48000000000000), U64_C(0x5E79000000000000),
+        U64_C(0xC7EE000000000000), U64_C(0xF4DF000000000000), U64_C(0xA18C000000000000), U64_C(0x92BD000000000000),
+        U64_C(0x8283000000000000), U64_C(0xB1B2000000000000), U64_C(0xE4E1000000000000), U64_C(0xD7D0000000000000),
+        U64_C(0x4E47000000000000), U64_C(0x7D76000000000000), U64_C(0x2825000000000000), U64_C(0x1B14000000000000),
+        U64_C(0x0859000000000000), U64_C(0x3B68000000000000), U64_C(0x6E3B000000000000), U64_C(0x5D0A000000000000),
+        U64_C(0xC49D000000000000), U64_C(0xF7AC000000000000), U64_C(0xA2FF000000000000), U64_C(0x91CE000000000000),
+        U64_C(0x81F0000000000000), U64_C(0xB2C1000000000000), U64_C(0xE792000000000000), U64_C(0xD4A3000000000000),
+        U64_C(0x4D34000000000000), U64_C(0x7E05000000000000), U64_C(0x2B56000000000000), U64_C(0x1867000000000000),
+        U64_C(0x1B98000000000000), U64_C(0x28A9000000000000), U64_C(0x7DFA000000000000), U64_C(0x4ECB000000000000),
+        U64_C(0xD75C000000000000), U64_C(0xE46D000000000000), U64_C(0xB13E000000000000), U64_C(0x820F000000000000),
+        U64_C(0x9231000000000000), U64_C(0xA100000000000000), U64_C(0xF453000000000000), U64_C(0xC762000000000000),
+        U64_C(0x5EF5000000000000), U64_C(0x6DC4000000000000), U64_C(0x3897000000000000), U64_C(0x0BA6000000000000),
+        U64_C(0x18EB000000000000), U64_C(0x2BDA000000000000), U64_C(0x7E89000000000000), U64_C(0x4DB8000000000000),
+        U64_C(0xD42F000000000000), U64_C(0xE71E000000000000), U64_C(0xB24D000000000000), U64_C(0x817C000000000000),
+        U64_C(0x9142000000000000), U64_C(0xA273000000000000), U64_C(0xF720000000000000), U64_C(0xC411000000000000),
+        U64_C(0x5D86000000000000), U64_C(0x6EB7000000000000), U64_C(0x3BE4000000000000), U64_C(0x08D5000000000000),
+        U64_C(0x1D7E000000000000), U64_C(0x2E4F000000000000), U64_C(0x7B1C000000000000), U64_C(0x482D000000000000),
+        U64_C(0xD1BA000000000000), U64_C(0xE28B000000000000), U64_C(0xB7D8000000000000), U64_C(0x84E9000000000000),
+        U64_C(0x94D7000000000000), U64_C(0xA7E6000000000000), U64_C(0xF2B5000000000000), U64_C(0xC184000000000000),
+        U64_C(0x5813000000000000), U64_C(0x6B22000000000000), U64_C(0x3E71000000000000), U64_C(0x0D40000000000000),
+        U64_C(0x1E0D000000000000), U64_C(0x2D3C000000000000), U64_C(0x786F000000000000), U64_C(0x4B5E000000000000),
+        U64_C(0xD2C9000000000000), U64_C(0xE1F8000000000000), U64_C(0xB4AB000000000000), U64_C(0x879A000000000000),
+        U64_C(0x97A4000000000000), U64_C(0xA495000000000000), U64_C(0xF1C6000000000000), U64_C(0xC2F7000000000000),
+        U64_C(0x5B60000000000000), U64_C(0x6851000000000000), U64_C(0x3D02000000000000), U64_C(0x0E33000000000000),
+        U64_C(0x1654000000000000), U64_C(0x2565000000000000), U64_C(0x7036000000000000), U64_C(0x4307000000000000),
+        U64_C(0xDA90000000000000), U64_C(0xE9A1000000000000), U64_C(0xBCF2000000000000), U64_C(0x8FC3000000000000),
+        U64_C(0x9FFD000000000000), U64_C(0xACCC000000000000), U64_C(0xF99F000000000000), U64_C(0xCAAE000000000000),
+        U64_C(0x5339000000000000), U64_C(0x6008000000000000), U64_C(0x355B000000000000), U64_C(0x066A000000000000),
+        U64_C(0x1527000000000000), U64_C(0x2616000000000000), U64_C(0x7345000000000000), U64_C(0x4074000000000000),
+        U64_C(0xD9E3000000000000), U64_C(0xEAD2000000000000), U64_C(0xBF81000000000000), U64_C(0x8CB0000000000000),
+        U64_C(0x9C8E000000000000), U64_C(0xAFBF000000000000), U64_C(0xFAEC000000000000), U64_C(0xC9DD000000000000),
+        U64_C(0x504A000000000000), U64_C(0x637B000000000000), U64_C(0x3628000000000000), U64_C(0x0519000000000000),
+        U64_C(0x10B2000000000000), U64_C(0x2383000000000000), U64_C(0x76D0000000000000), U64_C(0x45E1000000000000),
+        U64_C(0xDC76000000000000), U64_C(0xEF47000000000000), U64_C(0xBA14000000000000), U64_C(0x8925000000000000),
+        U64_C(0x991B000000000000), U64_C(0xAA2A000000000000), U64_C(0xFF79000000000000), U64_C(0xCC48000000000000),
+        U64_C(0x55DF000000000000), U64_C(0x66EE000000000000), U64_C(0x33BD000000000000), U64_C(0x008C000000000000),
+        U64_C(0x13C1000000000000), U64_C(0x20F0000000000000), U64_C(0x75A3000000000000), U64_C(0x4692000000000000),
+        U64_C(0xDF05000000000000), U64_C(0xEC34000000000000), U64_C(0xB967000000000000), U64_C(0x8A56000000000000),
+        U64_C(0x9A68000000000000), U64_C(0xA959000000000000), U64_C(0xFC0A000000000000), U64_C(0xCF3B000000000000),
+        U64_C(0x56AC000000000000), U64_C(0x659D000000000000), U64_C(0x30CE000000000000), U64_C(0x03FF000000000000),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x3730000000000000), U64_C(0x6E60000000000000), U64_C(0x5950000000000000),
+        U64_C(0xDCC0000000000000), U64_C(0xEBF0000000000000), U64_C(0xB2A0000000000000), U64_C(0x8590000000000000),
+        U64_C(0xA9A1000000000000), U64_C(0x9E91000000000000), U64_C(0xC7C1000000000000), U64_C(0xF0F1000000000000),
+        U64_C(0x7561000000000000), U64_C(0x4251000000000000), U64_C(0x1B01000000000000), U64_C(0x2C31000000000000),
+        U64_C(0x4363000000000000), U64_C(0x7453000000000000), U64_C(0x2D03000000000000), U64_C(0x1A33000000000000),
+        U64_C(0x9FA3000000000000), U64_C(0xA893000000000000), U64_C(0xF1C3000000000000), U64_C(0xC6F3000000000000),
+        U64_C(0xEAC2000000000000), U64_C(0xDDF2000000000000), U64_C(0x84A2000000000000), U64_C(0xB392000000000000),
+        U64_C(0x3602000000000000), U64_C(0x0132000000000000), U64_C(0x5862000000000000), U64_C(0x6F52000000000000),
+        U64_C(0x86C6000000000000), U64_C(0xB1F6000000000000), U64_C(0xE8A6000000000000), U64_C(0xDF96000000000000),
+        U64_C(0x5A06000000000000), U64_C(0x6D36000000000000), U64_C(0x3466000000000000), U64_C(0x0356000000000000),
+        U64_C(0x2F67000000000000), U64_C(0x1857000000000000), U64_C(0x4107000000000000), U64_C(0x7637000000000000),
+        U64_C(0xF3A7000000000000), U64_C(0xC497000000000000), U64_C(0x9DC7000000000000), U64_C(0xAAF7000000000000),
+        U64_C(0xC5A5000000000000), U64_C(0xF295000000000000), U64_C(0xABC5000000000000), U64_C(0x9CF5000000000000),
+        U64_C(0x1965000000000000), U64_C(0x2E55000000000000), U64_C(0x7705000000000000), U64_C(0x4035000000000000),
+        U64_C(0x6C04000000000000), U64_C(0x5B34000000000000), U64_C(0x0264000000000000), U64_C(0x3554000000000000),
+        U64_C(0xB0C4000000000000), U64_C(0x87F4000000000000), U64_C(0xDEA4000000000000), U64_C(0xE994000000000000),
+        U64_C(0x1DAD000000000000), U64_C(0x2A9D000000000000), U64_C(0x73CD000000000000), U64_C(0x44FD000000000000),
+        U64_C(0xC16D000000000000), U64_C(0xF65D000000000000), U64_C(0xAF0D000000000000), U64_C(0x983D000000000000),
+        U64_C(0xB40C000000000000), U64_C(0x833C000000000000), U64_C(0xDA6C000000000000), U64_C(0xED5C000000000000),
+        U64_C(0x68CC000000000000), U64_C(0x5FFC000000000000), U64_C(0x06AC000000000000), U64_C(0x319C000000000000),
+        U64_C(0x5ECE000000000000), U64_C(0x69FE000000000000), U64_C(0x30AE000000000000), U64_C(0x079E000000000000),
+        U64_C(0x820E000000000000), U64_C(0xB53E000000000000), U64_C(0xEC6E000000000000), U64_C(0xDB5E000000000000),
+        U64_C(0xF76F000000000000), U64_C(0xC05F000000000000), U64_C(0x990F000000000000), U64_C(0xAE3F000000000000),
+        U64_C(0x2BAF000000000000), U64_C(0x1C9F000000000000), U64_C(0x45CF000000000000), U64_C(0x72FF000000000000),
+        U64_C(0x9B6B000000000000), U64_C(0xAC5B000000000000), U64_C(0xF50B000000000000), U64_C(0xC23B000000000000),
+        U64_C(0x47AB000000000000), U64_C(0x709B000000000000), U64_C(0x29CB000000000000), U64_C(0x1EFB000000000000),
+        U64_C(0x32CA000000000000), U64_C(0x05FA000000000000), U64_C(0x5CAA000000000000), U64_C(0x6B9A000000000000),
+        U64_C(0xEE0A000000000000), U64_C(0xD93A000000000000), U64_C(0x806A000000000000), U64_C(0xB75A000000000000),
+        U64_C(0xD808000000000000), U64_C(0xEF38000000000000), U64_C(0xB668000000000000), U64_C(0x8158000000000000),
+        U64_C(0x04C8000000000000), U64_C(0x33F8000000000000), U64_C(0x6AA8000000000000), U64_C(0x5D98000000000000),
+        U64_C(0x71A9000000000000), U64_C(0x4699000000000000), U64_C(0x1FC9000000000000), U64_C(0x28F9000000000000),
+        U64_C(0xAD69000000000000), U64_C(0x9A59000000000000), U64_C(0xC309000000000000), U64_C(0xF439000000000000),
+        U64_C(0x3B5A000000000000), U64_C(0x0C6A000000000000), U64_C(0x553A000000000000), U64_C(0x620A000000000000),
+        U64_C(0xE79A000000000000), U64_C(0xD0AA000000000000), U64_C(0x89FA000000000000), U64_C(0xBECA000000000000),
+        U64_C(0x92FB000000000000), U64_C(0xA5CB000000000000), U64_C(0xFC9B000000000000), U64_C(0xCBAB000000000000),
+        U64_C(0x4E3B000000000000), U64_C(0x790B000000000000), U64_C(0x205B000000000000), U64_C(0x176B000000000000),
+        U64_C(0x7839000000000000), U64_C(0x4F09000000000000), U64_C(0x1659000000000000), U64_C(0x2169000000000000),
+        U64_C(0xA4F9000000000000), U64_C(0x93C9000000000000), U64_C(0xCA99000000000000), U64_C(0xFDA9000000000000),
+        U64_C(0xD198000000000000), U64_C(0xE6A8000000000000), U64_C(0xBFF8000000000000), U64_C(0x88C8000000000000),
+        U64_C(0x0D58000000000000), U64_C(0x3A68000000000000), U64_C(0x6338000000000000), U64_C(0x5408000000000000),
+        U64_C(0xBD9C000000000000), U64_C(0x8AAC000000000000), U64_C(0xD3FC000000000000), U64_C(0xE4CC000000000000),
+        U64_C(0x615C000000000000), U64_C(0x566C000000000000), U64_C(0x0F3C000000000000), U64_C(0x380C000000000000),
+        U64_C(0x143D000000000000), U64_C(0x230D000000000000), U64_C(0x7A5D000000000000), U64_C(0x4D6D000000000000),
+        U64_C(0xC8FD000000000000), U64_C(0xFFCD000000000000), U64_C(0xA69D000000000000), U64_C(0x91AD000000000000),
+        U64_C(0xFEFF000000000000), U64_C(0xC9CF000000000000), U64_C(0x909F000000000000), U64_C(0xA7AF000000000000),
+        U64_C(0x223F000000000000), U64_C(0x150F000000000000), U64_C(0x4C5F000000000000), U64_C(0x7B6F000000000000),
+        U64_C(0x575E000000000000), U64_C(0x606E000000000000), U64_C(0x393E000000000000), U64_C(0x0E0E000000000000),
+        U64_C(0x8B9E000000000000), U64_C(0xBCAE000000000000), U64_C(0xE5FE000000000000), U64_C(0xD2CE000000000000),
+        U64_C(0x26F7000000000000), U64_C(0x11C7000000000000), U64_C(0x4897000000000000), U64_C(0x7FA7000000000000),
+        U64_C(0xFA37000000000000), U64_C(0xCD07000000000000), U64_C(0x9457000000000000), U64_C(0xA367000000000000),
+        U64_C(0x8F56000000000000), U64_C(0xB866000000000000), U64_C(0xE136000000000000), U64_C(0xD606000000000000),
+        U64_C(0x5396000000000000), U64_C(0x64A6000000000000), U64_C(0x3DF6000000000000), U64_C(0x0AC6000000000000),
+        U64_C(0x6594000000000000), U64_C(0x52A4000000000000), U64_C(0x0BF4000000000000), U64_C(0x3CC4000000000000),
+        U64_C(0xB954000000000000), U64_C(0x8E64000000000000), U64_C(0xD734000000000000), U64_C(0xE004000000000000),
+        U64_C(0xCC35000000000000), U64_C(0xFB05000000000000), U64_C(0xA255000000000000), U64_C(0x9565000000000000),
+        U64_C(0x10F5000000000000), U64_C(0x27C5000000000000), U64_C(0x7E95000000000000), U64_C(0x49A5000000000000),
+        U64_C(0xA031000000000000), U64_C(0x9701000000000000), U64_C(0xCE51000000000000), U64_C(0xF961000000000000),
+        U64_C(0x7CF1000000000000), U64_C(0x4BC1000000000000), U64_C(0x1291000000000000), U64_C(0x25A1000000000000),
+        U64_C(0x0990000000000000), U64_C(0x3EA0000000000000), U64_C(0x67F0000000000000), U64_C(0x50C0000000000000),
+        U64_C(0xD550000000000000), U64_C(0xE260000000000000), U64_C(0xBB30000000000000), U64_C(0x8C00000000000000),
+        U64_C(0xE352000000000000), U64_C(0xD462000000000000), U64_C(0x8D32000000000000), U64_C(0xBA02000000000000),
+        U64_C(0x3F92000000000000), U64_C(0x08A2000000000000), U64_C(0x51F2000000000000), U64_C(0x66C2000000000000),
+        U64_C(0x4AF3000000000000), U64_C(0x7DC3000000000000), U64_C(0x2493000000000000), U64_C(0x13A3000000000000),
+        U64_C(0x9633000000000000), U64_C(0xA103000000000000), U64_C(0xF853000000000000), U64_C(0xCF63000000000000),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x76B4000000000000), U64_C(0xED68000000000000), U64_C(0x9BDC000000000000),
+        U64_C(0xCAF1000000000000), U64_C(0xBC45000000000000), U64_C(0x2799000000000000), U64_C(0x512D000000000000),
+        U64_C(0x85C3000000000000), U64_C(0xF377000000000000), U64_C(0x68AB000000000000), U64_C(0x1E1F000000000000),
+        U64_C(0x4F32000000000000), U64_C(0x3986000000000000), U64_C(0xA25A000000000000), U64_C(0xD4EE000000000000),
+        U64_C(0x1BA7000000000000), U64_C(0x6D13000000000000), U64_C(0xF6CF000000000000), U64_C(0x807B000000000000),
+        U64_C(0xD156000000000000), U64_C(0xA7E2000000000000), U64_C(0x3C3E000000000000), U64_C(0x4A8A000000000000),
+        U64_C(0x9E64000000000000), U64_C(0xE8D0000000000000), U64_C(0x730C000000000000), U64_C(0x05B8000000000000),
+        U64_C(0x5495000000000000), U64_C(0x2221000000000000), U64_C(0xB9FD000000000000), U64_C(0xCF49000000000000),
+        U64_C(0x374E000000000000), U64_C(0x41FA000000000000), U64_C(0xDA26000000000000), U64_C(0xAC92000000000000),
+        U64_C(0xFDBF000000000000), U64_C(0x8B0B000000000000), U64_C(0x10D7000000000000), U64_C(0x6663000000000000),
+        U64_C(0xB28D000000000000), U64_C(0xC439000000000000), U64_C(0x5FE5000000000000), U64_C(0x2951000000000000),
+        U64_C(0x787C000000000000), U64_C(0x0EC8000000000000), U64_C(0x9514000000000000), U64_C(0xE3A0000000000000),
+        U64_C(0x2CE9000000000000), U64_C(0x5A5D000000000000), U64_C(0xC181000000000000), U64_C(0xB735000000000000),
+        U64_C(0xE618000000000000), U64_C(0x90AC000000000000), U64_C(0x0B70000000000000), U64_C(0x7DC4000000000000),
+        U64_C(0xA92A000000000000), U64_C(0xDF9E000000000000), U64_C(0x4442000000000000), U64_C(0x32F6000000000000),
+        U64_C(0x63DB000000000000), U64_C(0x156F000000000000), U64_C(0x8EB3000000000000), U64_C(0xF807000000000000),
+        U64_C(0x6E9C000000000000), U64_C(0x1828000000000000), U64_C(0x83F4000000000000), U64_C(0xF540000000000000),
+        U64_C(0xA46D000000000000), U64_C(0xD2D9000000000000), U64_C(0x4905000000000000), U64_C(0x3FB1000000000000),
+        U64_C(0xEB5F000000000000), U64_C(0x9DEB000000000000), U64_C(0x0637000000000000), U64_C(0x7083000000000000),
+        U64_C(0x21AE000000000000), U64_C(0x571A000000000000), U64_C(0xCCC6000000000000), U64_C(0xBA72000000000000),
+        U64_C(0x753B000000000000), U64_C(0x038F000000000000), U64_C(0x9853000000000000), U64_C(0xEEE7000000000000),
+        U64_C(0xBFCA000000000000), U64_C(0xC97E000000000000), U64_C(0x52A2000000000000), U64_C(0x2416000000000000),
+        U64_C(0xF0F8000000000000), U64_C(0x864C000000000000), U64_C(0x1D90000000000000), U64_C(0x6B24000000000000),
+        U64_C(0x3A09000000000000), U64_C(0x4CBD000000000000), U64_C(0xD761000000000000), U64_C(0xA1D5000000000000),
+        U64_C(0x59D2000000000000), U64_C(0x2F66000000000000), U64_C(0xB4BA000000000000), U64_C(0xC20E000000000000),
+        U64_C(0x9323000000000000), U64_C(0xE597000000000000), U64_C(0x7E4B000000000000), U64_C(0x08FF000000000000),
+        U64_C(0xDC11000000000000), U64_C(0xAAA5000000000000), U64_C(0x3179000000000000), U64_C(0x47CD000000000000),
+        U64_C(0x16E0000000000000), U64_C(0x6054000000000000), U64_C(0xFB88000000000000), U64_C(0x8D3C000000000000),
+        U64_C(0x4275000000000000), U64_C(0x34C1000000000000), U64_C(0xAF1D000000000000), U64_C(0xD9A9000000000000),
+        U64_C(0x8884000000000000), U64_C(0xFE30000000000000), U64_C(0x65EC000000000000), U64_C(0x1358000000000000),
+        U64_C(0xC7B6000000000000), U64_C(0xB102000000000000), U64_C(0x2ADE000000000000), U64_C(0x5C6A000000000000),
+        U64_C(0x0D47000000000000), U64_C(0x7BF3000000000000), U64_C(0xE02F000000000000), U64_C(0x969B000000000000),
+        U64_C(0xDD38000000000000), U64_C(0xAB8C000000000000), U64_C(0x3050000000000000), U64_C(0x46E4000000000000),
+        U64_C(0x17C9000000000000), U64_C(0x617D000000000000), U64_C(0xFAA1000000000000), U64_C(0x8C15000000000000),
+        U64_C(0x58FB000000000000), U64_C(0x2E4F000000000000), U64_C(0xB593000000000000), U64_C(0xC327000000000000),
+        U64_C(0x920A000000000000), U64_C(0xE4BE000000000000), U64_C(0x7F62000000000000), U64_C(0x09D6000000000000),
+        U64_C(0xC69F000000000000), U64_C(0xB02B000000000000), U64_C(0x2BF7000000000000), U64_C(0x5D43000000000000),
+        U64_C(0x0C6E000000000000), U64_C(0x7ADA000000000000), U64_C(0xE106000000000000), U64_C(0x97B2000000000000),
+        U64_C(0x435C000000000000), U64_C(0x35E8000000000000), U64_C(0xAE34000000000000), U64_C(0xD880000000000000),
+        U64_C(0x89AD000000000000), U64_C(0xFF19000000000000), U64_C(0x64C5000000000000), U64_C(0x1271000000000000),
+        U64_C(0xEA76000000000000), U64_C(0x9CC2000000000000), U64_C(0x071E000000000000), U64_C(0x71AA000000000000),
+        U64_C(0x2087000000000000), U64_C(0x5633000000000000), U64_C(0xCDEF000000000000), U64_C(0xBB5B000000000000),
+        U64_C(0x6FB5000000000000), U64_C(0x1901000000000000), U64_C(0x82DD000000000000), U64_C(0xF469000000000000),
+        U64_C(0xA544000000000000), U64_C(0xD3F0000000000000), U64_C(0x482C000000000000), U64_C(0x3E98000000000000),
+        U64_C(0xF1D1000000000000), U64_C(0x8765000000000000), U64_C(0x1CB9000000000000), U64_C(0x6A0D000000000000),
+        U64_C(0x3B20000000000000), U64_C(0x4D94000000000000), U64_C(0xD648000000000000), U64_C(0xA0FC000000000000),
+        U64_C(0x7412000000000000), U64_C(0x02A6000000000000), U64_C(0x997A000000000000), U64_C(0xEFCE000000000000),
+        U64_C(0xBEE3000000000000), U64_C(0xC857000000000000), U64_C(0x538B000000000000), U64_C(0x253F000000000000),
+        U64_C(0xB3A4000000000000), U64_C(0xC510000000000000), U64_C(0x5ECC000000000000), U64_C(0x2878000000000000),
+        U64_C(0x7955000000000000), U64_C(0x0FE1000000000000), U64_C(0x943D000000000000), U64_C(0xE289000000000000),
+        U64_C(0x3667000000000000), U64_C(0x40D3000000000000), U64_C(0xDB0F000000000000), U64_C(0xADBB000000000000),
+        U64_C(0xFC96000000000000), U64_C(0x8A22000000000000), U64_C(0x11FE000000000000), U64_C(0x674A000000000000),
+        U64_C(0xA803000000000000), U64_C(0xDEB7000000000000), U64_C(0x456B000000000000), U64_C(0x33DF000000000000),
+        U64_C(0x62F2000000000000), U64_C(0x1446000000000000), U64_C(0x8F9A000000000000), U64_C(0xF92E000000000000),
+        U64_C(0x2DC0000000000000), U64_C(0x5B74000000000000), U64_C(0xC0A8000000000000), U64_C(0xB61C000000000000),
+        U64_C(0xE731000000000000), U64_C(0x9185000000000000), U64_C(0x0A59000000000000), U64_C(0x7CED000000000000),
+        U64_C(0x84EA000000000000), U64_C(0xF25E000000000000), U64_C(0x6982000000000000), U64_C(0x1F36000000000000),
+        U64_C(0x4E1B000000000000), U64_C(0x38AF000000000000), U64_C(0xA373000000000000), U64_C(0xD5C7000000000000),
+        U64_C(0x0129000000000000), U64_C(0x779D000000000000), U64_C(0xEC41000000000000), U64_C(0x9AF5000000000000),
+        U64_C(0xCBD8000000000000), U64_C(0xBD6C000000000000), U64_C(0x26B0000000000000), U64_C(0x5004000000000000),
+        U64_C(0x9F4D000000000000), U64_C(0xE9F9000000000000), U64_C(0x7225000000000000), U64_C(0x0491000000000000),
+        U64_C(0x55BC000000000000), U64_C(0x2308000000000000), U64_C(0xB8D4000000000000), U64_C(0xCE60000000000000),
+        U64_C(0x1A8E000000000000), U64_C(0x6C3A000000000000), U64_C(0xF7E6000000000000), U64_C(0x8152000000000000),
+        U64_C(0xD07F000000000000), U64_C(0xA6CB000000000000), U64_C(0x3D17000000000000), U64_C(0x4BA3000000000000),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0xAA51000000000000), U64_C(0x4483000000000000), U64_C(0xEED2000000000000),
+        U64_C(0x8906000000000000), U64_C(0x2357000000000000), U64_C(0xCD85000000000000), U64_C(0x67D4000000000000),
+        U64_C(0x022D000000000000), U64_C(0xA87C000000000000), U64_C(0x46AE000000000000), U64_C(0xECFF000000000000),
+        U64_C(0x8B2B000000000000), U64_C(0x217A000000000000), U64_C(0xCFA8000000000000), U64_C(0x65F9000000000000),
+        U64_C(0x045A000000000000), U64_C(0xAE0B000000000000), U64_C(0x40D9000000000000), U64_C(0xEA88000000000000),
+        U64_C(0x8D5C000000000000), U64_C(0x270D000000000000), U64_C(0xC9DF000000000000), U64_C(0x638E000000000000),
+        U64_C(0x0677000000000000), U64_C(0xAC26000000000000), U64_C(0x42F4000000000000), U64_C(0xE8A5000000000000),
+        U64_C(0x8F71000000000000), U64_C(0x2520000000000000), U64_C(0xCBF2000000000000), U64_C(0x61A3000000000000),
+        U64_C(0x08B4000000000000), U64_C(0xA2E5000000000000), U64_C(0x4C37000000000000), U64_C(0xE666000000000000),
+        U64_C(0x81B2000000000000), U64_C(0x2BE3000000000000), U64_C(0xC531000000000000), U64_C(0x6F60000000000000),
+        U64_C(0x0A99000000000000), U64_C(0xA0C8000000000000), U64_C(0x4E1A000000000000), U64_C(0xE44B000000000000),
+        U64_C(0x839F000000000000), U64_C(0x29CE000000000000), U64_C(0xC71C000000000000), U64_C(0x6D4D000000000000),
+        U64_C(0x0CEE000000000000), U64_C(0xA6BF000000000000), U64_C(0x486D000000000000), U64_C(0xE23C000000000000),
+        U64_C(0x85E8000000000000), U64_C(0x2FB9000000000000), U64_C(0xC16B000000000000), U64_C(0x6B3A000000000000),
+        U64_C(0x0EC3000000000000), U64_C(0xA492000000000000), U64_C(0x4A40000000000000), U64_C(0xE011000000000000),
+        U64_C(0x87C5000000000000), U64_C(0x2D94000000000000), U64_C(0xC346000000000000), U64_C(0x6917000000000000),
+        U64_C(0x1168000000000000), U64_C(0xBB39000000000000), U64_C(0x55EB000000000000), U64_C(0xFFBA000000000000),
+        U64_C(0x986E000000000000), U64_C(0x323F000000000000), U64_C(0xDCED000000000000), U64_C(0x76BC000000000000),
+        U64_C(0x1345000000000000), U64_C(0xB914000000000000), U64_C(0x57C6000000000000), U64_C(0xFD97000000000000),
+        U64_C(0x9A43000000000000), U64_C(0x3012000000000000), U64_C(0xDEC0000000000000), U64_C(0x7491000000000000),
+        U64_C(0x1532000000000000), U64_C(0xBF63000000000000), U64_C(0x51B1000000000000), U64_C(0xFBE0000000000000),
+        U64_C(0x9C34000000000000), U64_C(0x3665000000000000), U64_C(0xD8B7000000000000), U64_C(0x72E6000000000000),
+        U64_C(0x171F000000000000), U64_C(0xBD4E000000000000), U64_C(0x539C000000000000), U64_C(0xF9CD000000000000),
+        U64_C(0x9E19000000000000), U64_C(0x3448000000000000), U64_C(0xDA9A000000000000), U64_C(0x70CB000000000000),
+        U64_C(0x19DC000000000000), U64_C(0xB38D000000000000), U64_C(0x5D5F000000000000), U64_C(0xF70E000000000000),
+        U64_C(0x90DA000000000000), U64_C(0x3A8B000000000000), U64_C(0xD459000000000000), U64_C(0x7E08000000000000),
+        U64_C(0x1BF1000000000000), U64_C(0xB1A0000000000000), U64_C(0x5F72000000000000), U64_C(0xF523000000000000),
+        U64_C(0x92F7000000000000), U64_C(0x38A6000000000000), U64_C(0xD674000000000000), U64_C(0x7C25000000000000),
+        U64_C(0x1D86000000000000), U64_C(0xB7D7000000000000), U64_C(0x5905000000000000), U64_C(0xF354000000000000),
+        U64_C(0x9480000000000000), U64_C(0x3ED1000000000000), U64_C(0xD003000000000000), U64_C(0x7A52000000000000),
+        U64_C(0x1FAB000000000000), U64_C(0xB5FA000000000000), U64_C(0x5B28000000000000), U64_C(0xF179000000000000),
+        U64_C(0x96AD000000000000), U64_C(0x3CFC000000000000), U64_C(0xD22E000000000000), U64_C(0x787F000000000000),
+        U64_C(0x22D0000000000000), U64_C(0x8881000000000000), U64_C(0x6653000000000000), U64_C(0xCC02000000000000),
+        U64_C(0xABD6000000000000), U64_C(0x0187000000000000), U64_C(0xEF55000000000000), U64_C(0x4504000000000000),
+        U64_C(0x20FD000000000000), U64_C(0x8AAC000000000000), U64_C(0x647E000000000000), U64_C(0xCE2F000000000000),
+        U64_C(0xA9FB000000000000), U64_C(0x03AA000000000000), U64_C(0xED78000000000000), U64_C(0x4729000000000000),
+        U64_C(0x268A000000000000), U64_C(0x8CDB000000000000), U64_C(0x6209000000000000), U64_C(0xC858000000000000),
+        U64_C(0xAF8C000000000000), U64_C(0x05DD000000000000), U64_C(0xEB0F000000000000), U64_C(0x415E000000000000),
+        U64_C(0x24A7000000000000), U64_C(0x8EF6000000000000), U64_C(0x6024000000000000), U64_C(0xCA75000000000000),
+        U64_C(0xADA1000000000000), U64_C(0x07F0000000000000), U64_C(0xE922000000000000), U64_C(0x4373000000000000),
+        U64_C(0x2A64000000000000), U64_C(0x8035000000000000), U64_C(0x6EE7000000000000), U64_C(0xC4B6000000000000),
+        U64_C(0xA362000000000000), U64_C(0x0933000000000000), U64_C(0xE7E1000000000000), U64_C(0x4DB0000000000000),
+        U64_C(0x2849000000000000), U64_C(0x8218000000000000), U64_C(0x6CCA000000000000), U64_C(0xC69B000000000000),
+        U64_C(0xA14F000000000000), U64_C(0x0B1E000000000000), U64_C(0xE5CC000000000000), U64_C(0x4F9D000000000000),
+        U64_C(0x2E3E000000000000), U64_C(0x846F000000000000), U64_C(0x6ABD000000000000), U64_C(0xC0EC000000000000),
+        U64_C(0xA738000000000000), U64_C(0x0D69000000000000), U64_C(0xE3BB000000000000), U64_C(0x49EA000000000000),
+        U64_C(0x2C13000000000000), U64_C(0x8642000000000000), U64_C(0x6890000000000000), U64_C(0xC2C1000000000000),
+        U64_C(0xA515000000000000), U64_C(0x0F44000000000000), U64_C(0xE196000000000000), U64_C(0x4BC7000000000000),
+        U64_C(0x33B8000000000000), U64_C(0x99E9000000000000), U64_C(0x773B000000000000), U64_C(0xDD6A000000000000),
+        U64_C(0xBABE000000000000), U64_C(0x10EF000000000000), U64_C(0xFE3D000000000000), U64_C(0x546C000000000000),
+        U64_C(0x3195000000000000), U64_C(0x9BC4000000000000), U64_C(0x7516000000000000), U64_C(0xDF47000000000000),
+        U64_C(0xB893000000000000), U64_C(0x12C2000000000000), U64_C(0xFC10000000000000), U64_C(0x5641000000000000),
+        U64_C(0x37E2000000000000), U64_C(0x9DB3000000000000), U64_C(0x7361000000000000), U64_C(0xD930000000000000),
+        U64_C(0xBEE4000000000000), U64_C(0x14B5000000000000), U64_C(0xFA67000000000000), U64_C(0x5036000000000000),
+        U64_C(0x35CF000000000000), U64_C(0x9F9E000000000000), U64_C(0x714C000000000000), U64_C(0xDB1D000000000000),
+        U64_C(0xBCC9000000000000), U64_C(0x1698000000000000), U64_C(0xF84A000000000000), U64_C(0x521B000000000000),
+        U64_C(0x3B0C000000000000), U64_C(0x915D000000000000), U64_C(0x7F8F000000000000), U64_C(0xD5DE000000000000),
+        U64_C(0xB20A000000000000), U64_C(0x185B000000000000), U64_C(0xF689000000000000), U64_C(0x5CD8000000000000),
+        U64_C(0x3921000000000000), U64_C(0x9370000000000000), U64_C(0x7DA2000000000000), U64_C(0xD7F3000000000000),
+        U64_C(0xB027000000000000), U64_C(0x1A76000000000000), U64_C(0xF4A4000000000000), U64_C(0x5EF5000000000000),
+        U64_C(0x3F56000000000000), U64_C(0x9507000000000000), U64_C(0x7BD5000000000000), U64_C(0xD184000000000000),
+        U64_C(0xB650000000000000), U64_C(0x1C01000000000000), U64_C(0xF2D3000000000000), U64_C(0x5882000000000000),
+        U64_C(0x3D7B000000000000), U64_C(0x972A000000000000), U64_C(0x79F8000000000000), U64_C(0xD3A9000000000000),
+        U64_C(0xB47D000000000000), U64_C(0x1E2C000000000000), U64_C(0xF0FE000000000000), U64_C(0x5AAF000000000000),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x45A0000000000000), U64_C(0x8B40000000000000), U64_C(0xCEE0000000000000),
+        U64_C(0x06A1000000000000), U64_C(0x4301000000000000), U64_C(0x8DE1000000000000), U64_C(0xC841000000000000),
+        U64_C(0x0D42000000000000), U64_C(0x48E2000000000000), U64_C(0x8602000000000000), U64_C(0xC3A2000000000000),
+        U64_C(0x0BE3000000000000), U64_C(0x4E43000000000000), U64_C(0x80A3000000000000), U64_C(0xC503000000000000),
+        U64_C(0x1A84000000000000), U64_C(0x5F24000000000000), U64_C(0x91C4000000000000), U64_C(0xD464000000000000),
+        U64_C(0x1C25000000000000), U64_C(0x5985000000000000), U64_C(0x9765000000000000), U64_C(0xD2C5000000000000),
+        U64_C(0x17C6000000000000), U64_C(0x5266000000000000), U64_C(0x9C86000000000000), U64_C(0xD926000000000000),
+        U64_C(0x1167000000000000), U64_C(0x54C7000000000000), U64_C(0x9A27000000000000), U64_C(0xDF87000000000000),
+        U64_C(0x3508000000000000), U64_C(0x70A8000000000000), U64_C(0xBE48000000000000), U64_C(0xFBE8000000000000),
+        U64_C(0x33A9000000000000), U64_C(0x7609000000000000), U64_C(0xB8E9000000000000), U64_C(0xFD49000000000000),
+        U64_C(0x384A000000000000), U64_C(0x7DEA000000000000), U64_C(0xB30A000000000000), U64_C(0xF6AA000000000000),
+        U64_C(0x3EEB000000000000), U64_C(0x7B4B000000000000), U64_C(0xB5AB000000000000), U64_C(0xF00B000000000000),
+        U64_C(0x2F8C000000000000), U64_C(0x6A2C000000000000), U64_C(0xA4CC000000000000), U64_C(0xE16C000000000000),
+        U64_C(0x292D000000000000), U64_C(0x6C8D000000000000), U64_C(0xA26D000000000000), U64_C(0xE7CD000000000000),
+        U64_C(0x22CE000000000000), U64_C(0x676E000000000000), U64_C(0xA98E000000000000), U64_C(0xEC2E000000000000),
+        U64_C(0x246F000000000000), U64_C(0x61CF000000000000), U64_C(0xAF2F000000000000), U64_C(0xEA8F000000000000),
+        U64_C(0x6A10000000000000), U64_C(0x2FB0000000000000), U64_C(0xE150000000000000), U64_C(0xA4F0000000000000),
+        U64_C(0x6CB1000000000000), U64_C(0x2911000000000000), U64_C(0xE7F1000000000000), U64_C(0xA251000000000000),
+        U64_C(0x6752000000000000), U64_C(0x22F2000000000000), U64_C(0xEC12000000000000), U64_C(0xA9B2000000000000),
+        U64_C(0x61F3000000000000), U64_C(0x2453000000000000), U64_C(0xEAB3000000000000), U64_C(0xAF13000000000000),
+        U64_C(0x7094000000000000), U64_C(0x3534000000000000), U64_C(0xFBD4000000000000), U64_C(0xBE74000000000000),
+        U64_C(0x7635000000000000), U64_C(0x3395000000000000), U64_C(0xFD75000000000000), U64_C(0xB8D5000000000000),
+        U64_C(0x7DD6000000000000), U64_C(0x3876000000000000), U64_C(0xF696000000000000), U64_C(0xB336000000000000),
+        U64_C(0x7B77000000000000), U64_C(0x3ED7000000000000), U64_C(0xF037000000000000), U64_C(0xB597000000000000),
+        U64_C(0x5F18000000000000), U64_C(0x1AB8000000000000), U64_C(0xD458000000000000), U64_C(0x91F8000000000000),
+        U64_C(0x59B9000000000000), U64_C(0x1C19000000000000), U64_C(0xD2F9000000000000), U64_C(0x9759000000000000),
+        U64_C(0x525A000000000000), U64_C(0x17FA000000000000), U64_C(0xD91A000000000000), U64_C(0x9CBA000000000000),
+        U64_C(0x54FB000000000000), U64_C(0x115B000000000000), U64_C(0xDFBB000000000000), U64_C(0x9A1B000000000000),
+        U64_C(0x459C000000000000), U64_C(0x003C000000000000), U64_C(0xCEDC000000000000), U64_C(0x8B7C000000000000),
+        U64_C(0x433D000000000000), U64_C(0x069D000000000000), U64_C(0xC87D000000000000), U64_C(0x8DDD000000000000),
+        U64_C(0x48DE000000000000), U64_C(0x0D7E000000000000), U64_C(0xC39E000000000000), U64_C(0x863E000000000000),
+        U64_C(0x4E7F000000000000), U64_C(0x0BDF000000000000), U64_C(0xC53F000000000000), U64_C(0x809F000000000000),
+        U64_C(0xD420000000000000), U64_C(0x9180000000000000), U64_C(0x5F60000000000000), U64_C(0x1AC0000000000000),
+        U64_C(0xD281000000000000), U64_C(0x9721000000000000), U64_C(0x59C1000000000000), U64_C(0x1C61000000000000),
+        U64_C(0xD962000000000000), U64_C(0x9CC2000000000000), U64_C(0x5222000000000000), U64_C(0x1782000000000000),
+        U64_C(0xDFC3000000000000), U64_C(0x9A63000000000000), U64_C(0x5483000000000000), U64_C(0x1123000000000000),
+        U64_C(0xCEA4000000000000), U64_C(0x8B04000000000000), U64_C(0x45E4000000000000), U64_C(0x0044000000000000),
+        U64_C(0xC805000000000000), U64_C(0x8DA5000000000000), U64_C(0x4345000000000000), U64_C(0x06E5000000000000),
+        U64_C(0xC3E6000000000000), U64_C(0x8646000000000000), U64_C(0x48A6000000000000), U64_C(0x0D06000000000000),
+        U64_C(0xC547000000000000), U64_C(0x80E7000000000000), U64_C(0x4E07000000000000), U64_C(0x0BA7000000000000),
+        U64_C(0xE128000000000000), U64_C(0xA488000000000000), U64_C(0x6A68000000000000), U64_C(0x2FC8000000000000),
+        U64_C(0xE789000000000000), U64_C(0xA229000000000000), U64_C(0x6CC9000000000000), U64_C(0x2969000000000000),
+        U64_C(0xEC6A000000000000), U64_C(0xA9CA000000000000), U64_C(0x672A000000000000), U64_C(0x228A000000000000),
+        U64_C(0xEACB000000000000), U64_C(0xAF6B000000000000), U64_C(0x618B000000000000), U64_C(0x242B000000000000),
+        U64_C(0xFBAC000000000000), U64_C(0xBE0C000000000000), U64_C(0x70EC000000000000), U64_C(0x354C000000000000),
+        U64_C(0xFD0D000000000000), U64_C(0xB8AD000000000000), U64_C(0x764D000000000000), U64_C(0x33ED000000000000),
+        U64_C(0xF6EE000000000000), U64_C(0xB34E000000000000), U64_C(0x7DAE000000000000), U64_C(0x380E000000000000),
+        U64_C(0xF04F000000000000), U64_C(0xB5EF000000000000), U64_C(0x7B0F000000000000), U64_C(0x3EAF000000000000),
+        U64_C(0xBE30000000000000), U64_C(0xFB90000000000000), U64_C(0x3570000000000000), U64_C(0x70D0000000000000),
+        U64_C(0xB891000000000000), U64_C(0xFD31000000000000), U64_C(0x33D1000000000000), U64_C(0x7671000000000000),
+        U64_C(0xB372000000000000), U64_C(0xF6D2000000000000), U64_C(0x3832000000000000), U64_C(0x7D92000000000000),
+        U64_C(0xB5D3000000000000), U64_C(0xF073000000000000), U64_C(0x3E93000000000000), U64_C(0x7B33000000000000),
+        U64_C(0xA4B4000000000000), U64_C(0xE114000000000000), U64_C(0x2FF4000000000000), U64_C(0x6A54000000000000),
+        U64_C(0xA215000000000000), U64_C(0xE7B5000000000000), U64_C(0x2955000000000000), U64_C(0x6CF5000000000000),
+        U64_C(0xA9F6000000000000), U64_C(0xEC56000000000000), U64_C(0x22B6000000000000), U64_C(0x6716000000000000),
+        U64_C(0xAF57000000000000), U64_C(0xEAF7000000000000), U64_C(0x2417000000000000), U64_C(0x61B7000000000000),
+        U64_C(0x8B38000000000000), U64_C(0xCE98000000000000), U64_C(0x0078000000000000), U64_C(0x45D8000000000000),
+        U64_C(0x8D99000000000000), U64_C(0xC839000000000000), U64_C(0x06D9000000000000), U64_C(0x4379000000000000),
+        U64_C(0x867A000000000000), U64_C(0xC3DA000000000000), U64_C(0x0D3A000000000000), U64_C(0x489A000000000000),
+        U64_C(0x80DB000000000000), U64_C(0xC57B000000000000), U64_C(0x0B9B000000000000), U64_C(0x4E3B000000000000),
+        U64_C(0x91BC000000000000), U64_C(0xD41C000000000000), U64_C(0x1AFC000000000000), U64_C(0x5F5C000000000000),
+        U64_C(0x971D000000000000), U64_C(0xD2BD000000000000), U64_C(0x1C5D000000000000), U64_C(0x59FD000000000000),
+        U64_C(0x9CFE000000000000), U64_C(0xD95E000000000000), U64_C(0x17BE000000000000), U64_C(0x521E000000000000),
+        U64_C(0x9A5F000000000000), U64_C(0xDFFF000000000000), U64_C(0x111F000000000000), U64_C(0x54BF000000000000),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0xB861000000000000), U64_C(0x60E3000000000000), U64_C(0xD882000000000000),
+        U64_C(0xC1C6000000000000), U64_C(0x79A7000000000000), U64_C(0xA125000000000000), U64_C(0x1944000000000000),
+        U64_C(0x93AD000000000000), U64_C(0x2BCC000000000000), U64_C(0xF34E000000000000), U64_C(0x4B2F000000000000),
+        U64_C(0x526B000000000000), U64_C(0xEA0A000000000000), U64_C(0x3288000000000000), U64_C(0x8AE9000000000000),
+        U64_C(0x377B000000000000), U64_C(0x8F1A000000000000), U64_C(0x5798000000000000), U64_C(0xEFF9000000000000),
+        U64_C(0xF6BD000000000000), U64_C(0x4EDC000000000000), U64_C(0x965E000000000000), U64_C(0x2E3F000000000000),
+        U64_C(0xA4D6000000000000), U64_C(0x1CB7000000000000), U64_C(0xC435000000000000), U64_C(0x7C54000000000000),
+        U64_C(0x6510000000000000), U64_C(0xDD71000000000000), U64_C(0x05F3000000000000), U64_C(0xBD92000000000000),
+        U64_C(0x6EF6000000000000), U64_C(0xD697000000000000), U64_C(0x0E15000000000000), U64_C(0xB674000000000000),
+        U64_C(0xAF30000000000000), U64_C(0x1751000000000000), U64_C(0xCFD3000000000000), U64_C(0x77B2000000000000),
+        U64_C(0xFD5B000000000000), U64_C(0x453A000000000000), U64_C(0x9DB8000000000000), U64_C(0x25D9000000000000),
+        U64_C(0x3C9D000000000000), U64_C(0x84FC000000000000), U64_C(0x5C7E000000000000), U64_C(0xE41F000000000000),
+        U64_C(0x598D000000000000), U64_C(0xE1EC000000000000), U64_C(0x396E000000000000), U64_C(0x810F000000000000),
+        U64_C(0x984B000000000000), U64_C(0x202A000000000000), U64_C(0xF8A8000000000000), U64_C(0x40C9000000000000),
+        U64_C(0xCA20000000000000), U64_C(0x7241000000000000), U64_C(0xAAC3000000000000), U64_C(0x12A2000000000000),
+        U64_C(0x0BE6000000000000), U64_C(0xB387000000000000), U64_C(0x6B05000000000000), U64_C(0xD364000000000000),
+        U64_C(0xDDEC000000000000), U64_C(0x658D000000000000), U64_C(0xBD0F000000000000), U64_C(0x056E000000000000),
+        U64_C(0x1C2A000000000000), U64_C(0xA44B000000000000), U64_C(0x7CC9000000000000), U64_C(0xC4A8000000000000),
+        U64_C(0x4E41000000000000), U64_C(0xF620000000000000), U64_C(0x2EA2000000000000), U64_C(0x96C3000000000000),
+        U64_C(0x8F87000000000000), U64_C(0x37E6000000000000), U64_C(0xEF64000000000000), U64_C(0x5705000000000000),
+        U64_C(0xEA97000000000000), U64_C(0x52F6000000000000), U64_C(0x8A74000000000000), U64_C(0x3215000000000000),
+        U64_C(0x2B51000000000000), U64_C(0x9330000000000000), U64_C(0x4BB2000000000000), U64_C(0xF3D3000000000000),
+        U64_C(0x793A000000000000), U64_C(0xC15B000000000000), U64_C(0x19D9000000000000), U64_C(0xA1B8000000000000),
+        U64_C(0xB8FC000000000000), U64_C(0x009D000000000000), U64_C(0xD81F000000000000), U64_C(0x607E000000000000),
+        U64_C(0xB31A000000000000), U64_C(0x0B7B000000000000), U64_C(0xD3F9000000000000), U64_C(0x6B98000000000000),
+        U64_C(0x72DC000000000000), U64_C(0xCABD000000000000), U64_C(0x123F000000000000), U64_C(0xAA5E000000000000),
+        U64_C(0x20B7000000000000), U64_C(0x98D6000000000000), U64_C(0x4054000000000000), U64_C(0xF835000000000000),
+        U64_C(0xE171000000000000), U64_C(0x5910000000000000), U64_C(0x8192000000000000), U64_C(0x39F3000000000000),
+        U64_C(0x8461000000000000), U64_C(0x3C00000000000000), U64_C(0xE482000000000000), U64_C(0x5CE3000000000000),
+        U64_C(0x45A7000000000000), U64_C(0xFDC6000000000000), U64_C(0x2544000000000000), U64_C(0x9D25000000000000),
+        U64_C(0x17CC000000000000), U64_C(0xAFAD000000000000), U64_C(0x772F000000000000), U64_C(0xCF4E000000000000),
+        U64_C(0xD60A000000000000), U64_C(0x6E6B000000000000), U64_C(0xB6E9000000000000), U64_C(0x0E88000000000000),
+        U64_C(0xABF9000000000000), U64_C(0x1398000000000000), U64_C(0xCB1A000000000000), U64_C(0x737B000000000000),
+        U64_C(0x6A3F000000000000), U64_C(0xD25E000000000000), U64_C(0x0ADC000000000000), U64_C(0xB2BD000000000000),
+        U64_C(0x3854000000000000), U64_C(0x8035000000000000), U64_C(0x58B7000000000000), U64_C(0xE0D6000000000000),
+        U64_C(0xF992000000000000), U64_C(0x41F3000000000000), U64_C(0x9971000000000000), U64_C(0x2110000000000000),
+        U64_C(0x9C82000000000000), U64_C(0x24E3000000000000), U64_C(0xFC61000000000000), U64_C(0x4400000000000000),
+        U64_C(0x5D44000000000000), U64_C(0xE525000000000000), U64_C(0x3DA7000000000000), U64_C(0x85C6000000000000),
+        U64_C(0x0F2F000000000000), U64_C(0xB74E000000000000), U64_C(0x6FCC000000000000), U64_C(0xD7AD000000000000),
+        U64_C(0xCEE9000000000000), U64_C(0x7688000000000000), U64_C(0xAE0A000000000000), U64_C(0x166B000000000000),
+        U64_C(0xC50F000000000000), U64_C(0x7D6E000000000000), U64_C(0xA5EC000000000000), U64_C(0x1D8D000000000000),
+        U64_C(0x04C9000000000000), U64_C(0xBCA8000000000000), U64_C(0x642A000000000000), U64_C(0xDC4B000000000000),
+        U64_C(0x56A2000000000000), U64_C(0xEEC3000000000000), U64_C(0x3641000000000000), U64_C(0x8E20000000000000),
+        U64_C(0x9764000000000000), U64_C(0x2F05000000000000), U64_C(0xF787000000000000), U64_C(0x4FE6000000000000),
+        U64_C(0xF274000000000000), U64_C(0x4A15000000000000), U64_C(0x9297000000000000), U64_C(0x2AF6000000000000),
+        U64_C(0x33B2000000000000), U64_C(0x8BD3000000000000), U64_C(0x5351000000000000), U64_C(0xEB30000000000000),
+        U64_C(0x61D9000000000000), U64_C(0xD9B8000000000000), U64_C(0x013A000000000000), U64_C(0xB95B000000000000),
+        U64_C(0xA01F000000000000), U64_C(0x187E000000000000), U64_C(0xC0FC000000000000), U64_C(0x789D000000000000),
+        U64_C(0x7615000000000000), U64_C(0xCE74000000000000), U64_C(0x16F6000000000000), U64_C(0xAE97000000000000),
+        U64_C(0xB7D3000000000000), U64_C(0x0FB2000000000000), U64_C(0xD730000000000000), U64_C(0x6F51000000000000),
+        U64_C(0xE5B8000000000000), U64_C(0x5DD9000000000000), U64_C(0x855B000000000000), U64_C(0x3D3A000000000000),
+        U64_C(0x247E000000000000), U64_C(0x9C1F000000000000), U64_C(0x449D000000000000), U64_C(0xFCFC000000000000),
+        U64_C(0x416E000000000000), U64_C(0xF90F000000000000), U64_C(0x218D000000000000), U64_C(0x99EC000000000000),
+        U64_C(0x80A8000000000000), U64_C(0x38C9000000000000), U64_C(0xE04B000000000000), U64_C(0x582A000000000000),
+        U64_C(0xD2C3000000000000), U64_C(0x6AA2000000000000), U64_C(0xB220000000000000), U64_C(0x0A41000000000000),
+        U64_C(0x1305000000000000), U64_C(0xAB64000000000000), U64_C(0x73E6000000000000), U64_C(0xCB87000000000000),
+        U64_C(0x18E3000000000000), U64_C(0xA082000000000000), U64_C(0x7800000000000000), U64_C(0xC061000000000000),
+        U64_C(0xD925000000000000), U64_C(0x6144000000000000), U64_C(0xB9C6000000000000), U64_C(0x01A7000000000000),
+        U64_C(0x8B4E000000000000), U64_C(0x332F000000000000), U64_C(0xEBAD000000000000), U64_C(0x53CC000000000000),
+        U64_C(0x4A88000000000000), U64_C(0xF2E9000000000000), U64_C(0x2A6B000000000000), U64_C(0x920A000000000000),
+        U64_C(0x2F98000000000000), U64_C(0x97F9000000000000), U64_C(0x4F7B000000000000), U64_C(0xF71A000000000000),
+        U64_C(0xEE5E000000000000), U64_C(0x563F000000000000), U64_C(0x8EBD000000000000), U64_C(0x36DC000000000000),
+        U64_C(0xBC35000000000000), U64_C(0x0454000000000000), U64_C(0xDCD6000000000000), U64_C(0x64B7000000000000),
+        U64_C(0x7DF3000000000000), U64_C(0xC592000000000000), U64_C(0x1D10000000000000), U64_C(0xA571000000000000),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x47D3000000000000), U64_C(0x8FA6000000000000), U64_C(0xC875000000000000),
+        U64_C(0x0F6D000000000000), U64_C(0x48BE000000000000), U64_C(0x80CB000000000000), U64_C(0xC718000000000000),
+        U64_C(0x1EDA000000000000), U64_C(0x5909000000000000), U64_C(0x917C000000000000), U64_C(0xD6AF000000000000),
+        U64_C(0x11B7000000000000), U64_C(0x5664000000000000), U64_C(0x9E11000000000000), U64_C(0xD9C2000000000000),
+        U64_C(0x3DB4000000000000), U64_C(0x7A67000000000000), U64_C(0xB212000000000000), U64_C(0xF5C1000000000000),
+        U64_C(0x32D9000000000000), U64_C(0x750A000000000000), U64_C(0xBD7F000000000000), U64_C(0xFAAC000000000000),
+        U64_C(0x236E000000000000), U64_C(0x64BD000000000000), U64_C(0xACC8000000000000), U64_C(0xEB1B000000000000),
+        U64_C(0x2C03000000000000), U64_C(0x6BD0000000000000), U64_C(0xA3A5000000000000), U64_C(0xE476000000000000),
+        U64_C(0x7B68000000000000), U64_C(0x3CBB000000000000), U64_C(0xF4CE000000000000), U64_C(0xB31D000000000000),
+        U64_C(0x7405000000000000), U64_C(0x33D6000000000000), U64_C(0xFBA3000000000000), U64_C(0xBC70000000000000),
+        U64_C(0x65B2000000000000), U64_C(0x2261000000000000), U64_C(0xEA14000000000000), U64_C(0xADC7000000000000),
+        U64_C(0x6ADF000000000000), U64_C(0x2D0C000000000000), U64_C(0xE579000000000000), U64_C(0xA2AA000000000000),
+        U64_C(0x46DC000000000000), U64_C(0x010F000000000000), U64_C(0xC97A000000000000), U64_C(0x8EA9000000000000),
+        U64_C(0x49B1000000000000), U64_C(0x0E62000000000000), U64_C(0xC617000000000000), U64_C(0x81C4000000000000),
+        U64_C(0x5806000000000000), U64_C(0x1FD5000000000000), U64_C(0xD7A0000000000000), U64_C(0x9073000000000000),
+        U64_C(0x576B000000000000), U64_C(0x10B8000000000000), U64_C(0xD8CD000000000000), U64_C(0x9F1E000000000000),
+        U64_C(0xF6D0000000000000), U64_C(0xB103000000000000), U64_C(0x7976000000000000), U64_C(0x3EA5000000000000),
+        U64_C(0xF9BD000000000000), U64_C(0xBE6E000000000000), U64_C(0x761B000000000000), U64_C(0x31C8000000000000),
+        U64_C(0xE80A000000000000), U64_C(0xAFD9000000000000), U64_C(0x67AC000000000000), U64_C(0x207F000000000000),
+        U64_C(0xE767000000000000), U64_C(0xA0B4000000000000), U64_C(0x68C1000000000000), U64_C(0x2F12000000000000),
+        U64_C(0xCB64000000000000), U64_C(0x8CB7000000000000), U64_C(0x44C2000000000000), U64_C(0x0311000000000000),
+        U64_C(0xC409000000000000), U64_C(0x83DA000000000000), U64_C(0x4BAF000000000000), U64_C(0x0C7C000000000000),
+        U64_C(0xD5BE000000000000), U64_C(0x926D000000000000), U64_C(0x5A18000000000000), U64_C(0x1DCB000000000000),
+        U64_C(0xDAD3000000000000), U64_C(0x9D00000000000000), U64_C(0x5575000000000000), U64_C(0x12A6000000000000),
+        U64_C(0x8DB8000000000000), U64_C(0xCA6B000000000000), U64_C(0x021E000000000000), U64_C(0x45CD000000000000),
+        U64_C(0x82D5000000000000), U64_C(0xC506000000000000), U64_C(0x0D73000000000000), U64_C(0x4AA0000000000000),
+        U64_C(0x9362000000000000), U64_C(0xD4B1000000000000), U64_C(0x1CC4000000000000), U64_C(0x5B17000000000000),
+        U64_C(0x9C0F000000000000), U64_C(0xDBDC000000000000), U64_C(0x13A9000000000000), U64_C(0x547A000000000000),
+        U64_C(0xB00C000000000000), U64_C(0xF7DF000000000000), U64_C(0x3FAA000000000000), U64_C(0x7879000000000000),
+        U64_C(0xBF61000000000000), U64_C(0xF8B2000000000000), U64_C(0x30C7000000000000), U64_C(0x7714000000000000),
+        U64_C(0xAED6000000000000), U64_C(0xE905000000000000), U64_C(0x2170000000000000), U64_C(0x66A3000000000000),
+        U64_C(0xA1BB000000000000), U64_C(0xE668000000000000), U64_C(0x2E1D000000000000), U64_C(0x69CE000000000000),
+        U64_C(0xFD81000000000000), U64_C(0xBA52000000000000), U64_C(0x7227000000000000), U64_C(0x35F4000000000000),
+        U64_C(0xF2EC000000000000), U64_C(0xB53F000000000000), U64_C(0x7D4A000000000000), U64_C(0x3A99000000000000),
+        U64_C(0xE35B000000000000), U64_C(0xA488000000000000), U64_C(0x6CFD000000000000), U64_C(0x2B2E000000000000),
+        U64_C(0xEC36000000000000), U64_C(0xABE5000000000000), U64_C(0x6390000000000000), U64_C(0x2443000000000000),
+        U64_C(0xC035000000000000), U64_C(0x87E6000000000000), U64_C(0x4F93000000000000), U64_C(0x0840000000000000),
+        U64_C(0xCF58000000000000), U64_C(0x888B000000000000), U64_C(0x40FE000000000000), U64_C(0x072D000000000000),
+        U64_C(0xDEEF000000000000), U64_C(0x993C000000000000), U64_C(0x5149000000000000), U64_C(0x169A000000000000),
+        U64_C(0xD182000000000000), U64_C(0x9651000000000000), U64_C(0x5E24000000000000), U64_C(0x19F7000000000000),
+        U64_C(0x86E9000000000000), U64_C(0xC13A000000000000), U64_C(0x094F000000000000), U64_C(0x4E9C000000000000),
+        U64_C(0x8984000000000000), U64_C(0xCE57000000000000), U64_C(0x0622000000000000), U64_C(0x41F1000000000000),
+        U64_C(0x9833000000000000), U64_C(0xDFE0000000000000), U64_C(0x1795000000000000), U64_C(0x5046000000000000),
+        U64_C(0x975E000000000000), U64_C(0xD08D000000000000), U64_C(0x18F8000000000000), U64_C(0x5F2B000000000000),
+        U64_C(0xBB5D000000000000), U64_C(0xFC8E000000000000), U64_C(0x34FB000000000000), U64_C(0x7328000000000000),
+        U64_C(0xB430000000000000), U64_C(0xF3E3000000000000), U64_C(0x3B96000000000000), U64_C(0x7C45000000000000),
+        U64_C(0xA587000000000000), U64_C(0xE254000000000000), U64_C(0x2A21000000000000), U64_C(0x6DF2000000000000),
+        U64_C(0xAAEA000000000000), U64_C(0xED39000000000000), U64_C(0x254C000000000000), U64_C(0x629F000000000000),
+        U64_C(0x0B51000000000000), U64_C(0x4C82000000000000), U64_C(0x84F7000000000000), U64_C(0xC324000000000000),
+        U64_C(0x043C000000000000), U64_C(0x43EF000000000000), U64_C(0x8B9A000000000000), U64_C(0xCC49000000000000),
+        U64_C(0x158B000000000000), U64_C(0x5258000000000000), U64_C(0x9A2D000000000000), U64_C(0xDDFE000000000000),
+        U64_C(0x1AE6000000000000), U64_C(0x5D35000000000000), U64_C(0x9540000000000000), U64_C(0xD293000000000000),
+        U64_C(0x36E5000000000000), U64_C(0x7136000000000000), U64_C(0xB943000000000000), U64_C(0xFE90000000000000),
+        U64_C(0x3988000000000000), U64_C(0x7E5B000000000000), U64_C(0xB62E000000000000), U64_C(0xF1FD000000000000),
+        U64_C(0x283F000000000000), U64_C(0x6FEC000000000000), U64_C(0xA799000000000000), U64_C(0xE04A000000000000),
+        U64_C(0x2752000000000000), U64_C(0x6081000000000000), U64_C(0xA8F4000000000000), U64_C(0xEF27000000000000),
+        U64_C(0x7039000000000000), U64_C(0x37EA000000000000), U64_C(0xFF9F000000000000), U64_C(0xB84C000000000000),
+        U64_C(0x7F54000000000000), U64_C(0x3887000000000000), U64_C(0xF0F2000000000000), U64_C(0xB721000000000000),
+        U64_C(0x6EE3000000000000), U64_C(0x2930000000000000), U64_C(0xE145000000000000), U64_C(0xA696000000000000),
+        U64_C(0x618E000000000000), U64_C(0x265D000000000000), U64_C(0xEE28000000000000), U64_C(0xA9FB000000000000),
+        U64_C(0x4D8D000000000000), U64_C(0x0A5E000000000000), U64_C(0xC22B000000000000), U64_C(0x85F8000000000000),
+        U64_C(0x42E0000000000000), U64_C(0x0533000000000000), U64_C(0xCD46000000000000), U64_C(0x8A95000000000000),
+        U64_C(0x5357000000000000), U64_C(0x1484000000000000), U64_C(0xDCF1000000000000), U64_C(0x9B22000000000000),
+        U64_C(0x5C3A000000000000), U64_C(0x1BE9000000000000), U64_C(0xD39C000000000000), U64_C(0x944F000000000000),
+    },
+};
+
+// CRC-16/IBM-3740 folding constants
+const crc_clmul_consts CRC16_IBM_3740_CLMUL =
+{
+    .fold128 = { U64_C(0x000000000000AEFC), U64_C(0x000000000000650B) },
+    .fold256 = { U64_C(0x0000000000008E29), U64_C(0x00000000000026AA) },
+    .fold512 = { U64_C(0x00000000000013FC), U64_C(0x0000000000008832) },
+    .fold1024 = { U64_C(0x00000000000036C4), U64_C(0x00000000000071C4) },
+    .fold2048 = { U64_C(0x000000000000FD50), U64_C(0x000000000000F17E) },
+};
+
+// CRC-16/KERMIT slicing tables (generic engine)
+const u64 CRC16_KERMIT_SLICE64_TABLE[8][256] =
+{
+    {
+        U64_C(0x0000000000000000), U64_C(0x0000000000001189), U64_C(0x0000000000002312), U64_C(0x000000000000329B),
+        U64_C(0x0000000000004624), U64_C(0x00000000000057AD), U64_C(0x0000000000006536), U64_C(0x00000000000074BF),
+        U64_C(0x0000000000008C48), U64_C(0x0000000000009DC1), U64_C(0x000000000000AF5A), U64_C(0x000000000000BED3),
+        U64_C(0x000000000000CA6C), U64_C(0x000000000000DBE5), U64_C(0x000000000000E97E), U64_C(0x000000000000F8F7),
+        U64_C(0x0000000000001081), U64_C(0x0000000000000108), U64_C(0x0000000000003393), U64_C(0x000000000000221A),
+        U64_C(0x00000000000056A5), U64_C(0x000000000000472C), U64_C(0x00000000000075B7), U64_C(0x000000000000643E),
+        U64_C(0x0000000000009CC9), U64_C(0x0000000000008D40), U64_C(0x000000000000BFDB), U64_C(0x000000000000AE52),
+        U64_C(0x000000000000DAED), U64_C(0x000000000000CB64), U64_C(0x000000000000F9FF), U64_C(0x000000000000E876),
+        U64_C(0x0000000000002102), U64_C(0x000000000000308B), U64_C(0x0000000000000210), U64_C(0x0000000000001399),
+        U64_C(0x0000000000006726), U64_C(0x00000000000076AF), U64_C(0x0000000000004434), U64_C(0x00000000000055BD),
+        U64_C(0x000000000000AD4A), U64_C(0x000000000000BCC3), U64_C(0x0000000000008E58), U64_C(0x0000000000009FD1),
+        U64_C(0x000000000000EB6E), U64_C(0x000000000000FAE7), U64_C(0x000000000000C87C), U64_C(0x000000000000D9F5),
+        U64_C(0x0000000000003183), U64_C(0x000000000000200A), U64_C(0x0000000000001291), U64_C(0x0000000000000318),
+        U64_C(0x00000000000077A7), U64_C(0x000000000000662E), U64_C(0x00000000000054B5), U64_C(0x000000000000453C),
+        U64_C(0x000000000000BDCB), U64_C(0x000000000000AC42), U64_C(0x0000000000009ED9), U64_C(0x0000000000008F50),
+        U64_C(0x000000000000FBEF), U64_C(0x000000000000EA66), U64_C(0x000000000000D8FD), U64_C(0x000000000000C974),
+        U64_C(0x0000000000004204), U64_C(0x000000000000538D), U64_C(0x0000000000006116), U64_C(0x000000000000709F),
+        U64_C(0x0000000000000420), U64_C(0x00000000000015A9), U64_C(0x0000000000002732), U64_C(0x00000000000036BB),
+        U64_C(0x000000000000CE4C), U64_C(0x000000000000DFC5), U64_C(0x000000000000ED5E), U64_C(0x000000000000FCD7),
+        U64_C(0x0000000000008868), U64_C(0x00000000000099E1), U64_C(0x000000000000AB7A), U64_C(0x000000000000BAF3),
+        U64_C(0x0000000000005285), U64_C(0x000000000000430C), U64_C(0x0000000000007197), U64_C(0x000000000000601E),
+        U64_C(0x00000000000014A1), U64_C(0x0000000000000528), U64_C(0x00000000000037B3), U64_C(0x000000000000263A),
+        U64_C(0x000000000000DECD), U64_C(0x000000000000CF44), U64_C(0x000000000000FDDF), U64_C(0x000000000000EC56),
+        U64_C(0x00000000000098E9), U64_C(0x0000000000008960), U64_C(0x000000000000BBFB), U64_C(0x000000000000AA72),
+        U64_C(0x0000000000006306), U64_C(0x000000000000728F), U64_C(0x0000000000004014), U64_C(0x000000000000519D),
+        U64_C(0x0000000000002522), U64_C(0x00000000000034AB), U64_C(0x0000000000000630), U64_C(0x00000000000017B9),
+        U64_C(0x000000000000EF4E), U64_C(0x000000000000FEC7), U64_C(0x000000000000CC5C), U64_C(0x000000000000DDD5),
+        U64_C(0x000000000000A96A), U64_C(0x000000000000B8E3), U64_C(0x0000000000008A78), U64_C(0x0000000000009BF1),
+        U64_C(0x0000000000007387), U64_C(0x000000000000620E), U64_C(0x0000000000005095), U64_C(0x000000000000411C),
+        U64_C(0x00000000000035A3), U64_C(0x000000000000242A), U64_C(0x00000000000016B1), U64_C(0x0000000000000738),
+        U64_C(0x000000000000FFCF), U64_C(0x000000000000EE46), U64_C(0x000000000000DCDD), U64_C(0x000000000000CD54),
+        U64_C(0x000000000000B9EB), U64_C(0x000000000000A862), U64_C(0x0000000000009AF9), U64_C(0x0000000000008B70),
+        U64_C(0x0000000000008408), U64_C(0x0000000000009581), U64_C(0x000000000000A71A), U64_C(0x000000000000B693),
+        U64_C(0x000000000000C22C), U64_C(0x000000000000D3A5), U64_C(0x000000000000E13E), U64_C(0x000000000000F0B7),
+        U64_C(0x0000000000000840), U64_C(0x00000000000019C9), U64_C(0x0000000000002B52), U64_C(0x0000000000003ADB),
+        U64_C(0x0000000000004E64), U64_C(0x0000000000005FED), U64_C(0x0000000000006D76), U64_C(0x0000000000007CFF),
+        U64_C(0x0000000000009489), U64_C(0x0000000000008500), U64_C(0x000000000000B79B), U64_C(0x000000000000A612),
+        U64_C(0x000000000000D2AD), U64_C(0x000000000000C324), U64_C(0x000000000000F1BF), U64_C(0x000000000000E036),
+        U64_C(0x00000000000018C1), U64_C(0x0000000000000948), U64_C(0x0000000000003BD3), U64_C(0x0000000000002A5A),
+        U64_C(0x0000000000005EE5), U64_C(0x0000000000004F6C), U64_C(0x0000000000007DF7), U64_C(0x0000000000006C7E),
+        U64_C(0x000000000000A50A), U64_C(0x000000000000B483), U64_C(0x0000000000008618), U64_C(0x0000000000009791),
+        U64_C(0x000000000000E32E), U64_C(0x000000000000F2A7), U64_C(0x000000000000C03C), U64_C(0x000000000000D1B5),
+        U64_C(0x0000000000002942), U64_C(0x00000000000038CB), U64_C(0x0000000000000A50), U64_C(0x0000000000001BD9),
+        U64_C(0x0000000000006F66), U64_C(0x0000000000007EEF), U64_C(0x0000000000004C74), U64_C(0x0000000000005DFD),
+        U64_C(0x000000000000B58B), U64_C(0x000000000000A402), U64_C(0x0000000000009699), U64_C(0x0000000000008710),
+        U64_C(0x000000000000F3AF), U64_C(0x000000000000E226), U64_C(0x000000000000D0BD), U64_C(0x000000000000C134),
+        U64_C(0x00000000000039C3), U64_C(0x000000000000284A), U64_C(0x0000000000001AD1), U64_C(0x0000000000000B58),
+        U64_C(0x0000000000007FE7), U64_C(0x0000000000006E6E), U64_C(0x0000000000005CF5), U64_C(0x0000000000004D7C),
+        U64_C(0x000000000000C60C), U64_C(0x000000000000D785), U64_C(0x000000000000E51E), U64_C(0x000000000000F497),
+        U64_C(0x0000000000008028), U64_C(0x00000000000091A1), U64_C(0x000000000000A33A), U64_C(0x000000000000B2B3),
+        U64_C(0x0000000000004A44), U64_C(0x0000000000005BCD), U64_C(0x0000000000006956), U64_C(0x00000000000078DF),
+        U64_C(0x0000000000000C60), U64_C(0x0000000000001DE9), U64_C(0x0000000000002F72), U64_C(0x0000000000003EFB),
+        U64_C(0x000000000000D68D), U64_C(0x000000000000C704), U64_C(0x000000000000F59F), U64_C(0x000000000000E416),
+        U64_C(0x00000000000090A9), U64_C(0x0000000000008120), U64_C(0x000000000000B3BB), U64_C(0x000000000000A232),
+        U64_C(0x0000000000005AC5), U64_C(0x0000000000004B4C), U64_C(0x00000000000079D7), U64_C(0x000000000000685E),
+        U64_C(0x0000000000001CE1), U64_C(0x0000000000000D68), U64_C(0x0000000000003FF3), U64_C(0x0000000000002E7A),
+        U64_C(0x000000000000E70E), U64_C(0x000000000000F687), U64_C(0x000000000000C41C), U64_C(0x000000000000D595),
+        U64_C(0x000000000000A12A), U64_C(0x000000000000B0A3), U64_C(0x0000000000008238), U64_C(0x00000000000093B1),
+        U64_C(0x0000000000006B46), U64_C(0x0000000000007ACF), U64_C(0x0000000000004854), U64_C(0x00000000000059DD),
+        U64_C(0x0000000000002D62), U64_C(0x0000000000003CEB), U64_C(0x0000000000000E70), U64_C(0x0000000000001FF9),
+        U64_C(0x000000000000F78F), U64_C(0x000000000000E606), U64_C(0x000000000000D49D), U64_C(0x000000000000C514),
+        U64_C(0x000000000000B1AB), U64_C(0x000000000000A022), U64_C(0x00000000000092B9), U64_C(0x0000000000008330),
+        U64_C(0x0000000000007BC7), U64_C(0x0000000000006A4E), U64_C(0x00000000000058D5), U64_C(0x000000000000495C),
+        U64_C(0x0000000000003DE3), U64_C(0x0000000000002C6A), U64_C(0x0000000000001EF1), U64_C(0x0000000000000F78),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x00000000000019D8), U64_C(0x00000000000033B0), U64_C(0x0000000000002A68),
+        U64_C(0x0000000000006760), U64_C(0x0000000000007EB8), U64_C(0x00000000000054D0), U64_C(0x0000000000004D08),
+        U64_C(0x000000000000CEC0), U64_C(0x000000000000D718), U64_C(0x000000000000FD70), U64_C(0x000000000000E4A8),
+        U64_C(0x000000000000A9A0), U64_C(0x000000000000B078), U64_C(0x0000000000009A10), U64_C(0x00000000000083C8),
+        U64_C(0x0000000000009591), U64_C(0x0000000000008C49), U64_C(0x000000000000A621), U64_C(0x000000000000BFF9),
+        U64_C(0x000000000000F2F1), U64_C(0x000000000000EB29), U64_C(0x000000000000C141), U64_C(0x000000000000D899),
+        U64_C(0x0000000000005B51), U64_C(0x0000000000004289), U64_C(0x00000000000068E1), U64_C(0x0000000000007139),
+        U64_C(0x0000000000003C31), U64_C(0x00000000000025E9), U64_C(0x0000000000000F81), U64_C(0x0000000000001659),
+        U64_C(0x0000000000002333), U64_C(0x0000000000003AEB), U64_C(0x0000000000001083), U64_C(0x000000000000095B),
+        U64_C(0x0000000000004453), U64_C(0x0000000000005D8B), U64_C(0x00000000000077E3), U64_C(0x0000000000006E3B),
+        U64_C(0x000000000000EDF3), U64_C(0x000000000000F42B), U64_C(0x000000000000DE43), U64_C(0x000000000000C79B),
+        U64_C(0x0000000000008A93), U64_C(0x000000000000934B), U64_C(0x000000000000B923), U64_C(0x000000000000A0FB),
+        U64_C(0x000000000000B6A2), U64_C(0x000000000000AF7A), U64_C(0x0000000000008512), U64_C(0x0000000000009CCA),
+        U64_C(0x000000000000D1C2), U64_C(0x000000000000C81A), U64_C(0x000000000000E272), U64_C(0x000000000000FBAA),
+        U64_C(0x0000000000007862), U64_C(0x00000000000061BA), U64_C(0x0000000000004BD2), U64_C(0x000000000000520A),
+        U64_C(0x0000000000001F02), U64_C(0x00000000000006DA), U64_C(0x0000000000002CB2), U64_C(0x000000000000356A),
+        U64_C(0x0000000000004666), U64_C(0x0000000000005FBE), U64_C(0x00000000000075D6), U64_C(0x0000000000006C0E),
+        U64_C(0x0000000000002106), U64_C(0x00000000000038DE), U64_C(0x00000000000012B6), U64_C(0x0000000000000B6E),
+        U64_C(0x00000000000088A6), U64_C(0x000000000000917E), U64_C(0x000000000000BB16), U64_C(0x000000000000A2CE),
+        U64_C(0x000000000000EFC6), U64_C(0x000000000000F61E), U64_C(0x000000000000DC76), U64_C(0x000000000000C5AE),
+        U64_C(0x000000000000D3F7), U64_C(0x000000000000CA2F), U64_C(0x000000000000E047), U64_C(0x000000000000F99F),
+        U64_C(0x000000000000B497), U64_C(0x000000000000AD4F), U64_C(0x0000000000008727), U64_C(0x0000000000009EFF),
+        U64_C(0x0000000000001D37), U64_C(0x00000000000004EF), U64_C(0x0000000000002E87), U64_C(0x000000000000375F),
+        U64_C(0x0000000000007A57), U64_C(0x000000000000638F), U64_C(0x00000000000049E7), U64_C(0x000000000000503F),
+        U64_C(0x0000000000006555), U64_C(0x0000000000007C8D), U64_C(0x00000000000056E5), U64_C(0x0000000000004F3D),
+        U64_C(0x0000000000000235), U64_C(0x0000000000001BED), U64_C(0x0000000000003185), U64_C(0x000000000000285D),
+        U64_C(0x000000000000AB95), U64_C(0x000000000000B24D), U64_C(0x0000000000009825), U64_C(0x00000000000081FD),
+        U64_C(0x000000000000CCF5), U64_C(0x000000000000D52D), U64_C(0x000000000000FF45), U64_C(0x000000000000E69D),
+        U64_C(0x000000000000F0C4), U64_C(0x000000000000E91C), U64_C(0x000000000000C374), U64_C(0x000000000000DAAC),
+        U64_C(0x00000000000097A4), U64_C(0x0000000000008E7C), U64_C(0x000000000000A414), U64_C(0x000000000000BDCC),
+        U64_C(0x0000000000003E04), U64_C(0x00000000000027DC), U64_C(0x0000000000000DB4), U64_C(0x000000000000146C),
+        U64_C(0x0000000000005964), U64_C(0x00000000000040BC), U64_C(0x0000000000006AD4), U64_C(0x000000000000730C),
+        U64_C(0x0000000000008CCC), U64_C(0x0000000000009514), U64_C(0x000000000000BF7C), U64_C(0x000000000000A6A4),
+        U64_C(0x000000000000EBAC), U64_C(0x000000000000F274), U64_C(0x000000000000D81C), U64_C(0x000000000000C1C4),
+        U64_C(0x000000000000420C), U64_C(0x0000000000005BD4), U64_C(0x00000000000071BC), U64_C(0x0000000000006864),
+        U64_C(0x000000000000256C), U64_C(0x0000000000003CB4), U64_C(0x00000000000016DC), U64_C(0x0000000000000F04),
+        U64_C(0x000000000000195D), U64_C(0x0000000000000085), U64_C(0x0000000000002AED), U64_C(0x0000000000003335),
+        U64_C(0x0000000000007E3D), U64_C(0x00000000000067E5), U64_C(0x0000000000004D8D), U64_C(0x0000000000005455),
+        U64_C(0x000000000000D79D), U64_C(0x000000000000CE45), U64_C(0x000000000000E42D), U64_C(0x000000000000FDF5),
+        U64_C(0x000000000000B0FD), U64_C(0x000000000000A925), U64_C(0x000000000000834D), U64_C(0x0000000000009A95),
+        U64_C(0x000000000000AFFF), U64_C(0x000000000000B627), U64_C(0x0000000000009C4F), U64_C(0x0000000000008597),
+        U64_C(0x000000000000C89F), U64_C(0x000000000000D147), U64_C(0x000000000000FB2F), U64_C(0x000000000000E2F7),
+        U64_C(0x000000000000613F), U64_C(0x00000000000078E7), U64_C(0x000000000000528F), U64_C(0x0000000000004B57),
+        U64_C(0x000000000000065F), U64_C(0x0000000000001F87), U64_C(0x00000000000035EF), U64_C(0x0000000000002C37),
+        U64_C(0x0000000000003A6E), U64_C(0x00000000000023B6), U64_C(0x00000000000009DE), U64_C(0x0000000000001006),
+        U64_C(0x0000000000005D0E), U64_C(0x00000000000044D6), U64_C(0x0000000000006EBE), U64_C(0x0000000000007766),
+        U64_C(0x000000000000F4AE), U64_C(0x000000000000ED76), U64_C(0x000000000000C71E), U64_C(0x000000000000DEC6),
+        U64_C(0x00000000000093CE), U64_C(0x0000000000008A16), U64_C(0x000000000000A07E), U64_C(0x000000000000B9A6),
+        U64_C(0x000000000000CAAA), U64_C(0x000000000000D372), U64_C(0x000000000000F91A), U64_C(0x000000000000E0C2),
+        U64_C(0x000000000000ADCA), U64_C(0x000000000000B412), U64_C(0x0000000000009E7A), U64_C(0x00000000000087A2),
+        U64_C(0x000000000000046A), U64_C(0x0000000000001DB2), U64_C(0x00000000000037DA), U64_C(0x0000000000002E02),
+        U64_C(0x000000000000630A), U64_C(0x0000000000007AD2), U64_C(0x00000000000050BA), U64_C(0x0000000000004962),
+        U64_C(0x0000000000005F3B), U64_C(0x00000000000046E3), U64_C(0x0000000000006C8B), U64_C(0x0000000000007553),
+        U64_C(0x000000000000385B), U64_C(0x0000000000002183), U64_C(0x0000000000000BEB), U64_C(0x0000000000001233),
+        U64_C(0x00000000000091FB), U64_C(0x0000000000008823), U64_C(0x000000000000A24B), U64_C(0x000000000000BB93),
+        U64_C(0x000000000000F69B), U64_C(0x000000000000EF43), U64_C(0x000000000000C52B), U64_C(0x000000000000DCF3),
+        U64_C(0x000000000000E999), U64_C(0x000000000000F041), U64_C(0x000000000000DA29), U64_C(0x000000000000C3F1),
+        U64_C(0x0000000000008EF9), U64_C(0x0000000000009721), U64_C(0x000000000000BD49), U64_C(0x000000000000A491),
+        U64_C(0x0000000000002759), U64_C(0x0000000000003E81), U64_C(0x00000000000014E9), U64_C(0x0000000000000D31),
+        U64_C(0x0000000000004039), U64_C(0x00000000000059E1), U64_C(0x0000000000007389), U64_C(0x0000000000006A51),
+        U64_C(0x0000000000007C08), U64_C(0x00000000000065D0), U64_C(0x0000000000004FB8), U64_C(0x0000000000005660),
+        U64_C(0x0000000000001B68), U64_C(0x00000000000002B0), U64_C(0x00000000000028D8), U64_C(0x0000000000003100),
+        U64_C(0x000000000000B2C8), U64_C(0x000000000000AB10), U64_C(0x0000000000008178), U64_C(0x00000000000098A0),
+        U64_C(0x000000000000D5A8), U64_C(0x000000000000CC70), U64_C(0x000000000000E618), U64_C(0x000000000000FFC0),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x0000000000005ADC), U64_C(0x000000000000B5B8), U64_C(0x000000000000EF64),
+        U64_C(0x0000000000006361), U64_C(0x00000000000039BD), U64_C(0x000000000000D6D9), U64_C(0x0000000000008C05),
+        U64_C(0x000000000000C6C2), U64_C(0x0000000000009C1E), U64_C(0x000000000000737A), U64_C(0x00000000000029A6),
+        U64_C(0x000000000000A5A3), U64_C(0x000000000000FF7F), U64_C(0x000000000000101B), U64_C(0x0000000000004AC7),
+        U64_C(0x0000000000008595), U64_C(0x000000000000DF49), U64_C(0x000000000000302D), U64_C(0x0000000000006AF1),
+        U64_C(0x000000000000E6F4), U64_C(0x000000000000BC28), U64_C(0x000000000000534C), U64_C(0x0000000000000990),
+        U64_C(0x0000000000004357), U64_C(0x000000000000198B), U64_C(0x000000000000F6EF), U64_C(0x000000000000AC33),
+        U64_C(0x0000000000002036), U64_C(0x0000000000007AEA), U64_C(0x000000000000958E), U64_C(0x000000000000CF52),
+        U64_C(0x000000000000033B), U64_C(0x00000000000059E7), U64_C(0x000000000000B683), U64_C(0x000000000000EC5F),
+        U64_C(0x000000000000605A), U64_C(0x0000000000003A86), U64_C(0x000000000000D5E2), U64_C(0x0000000000008F3E),
+        U64_C(0x000000000000C5F9), U64_C(0x0000000000009F25), U64_C(0x0000000000007041), U64_C(0x0000000000002A9D),
+        U64_C(0x000000000000A698), U64_C(0x000000000000FC44), U64_C(0x0000000000001320), U64_C(0x00000000000049FC),
+        U64_C(0x00000000000086AE), U64_C(0x000000000000DC72), U64_C(0x0000000000003316), U64_C(0x00000000000069CA),
+        U64_C(0x000000000000E5CF), U64_C(0x000000000000BF13), U64_C(0x0000000000005077), U64_C(0x0000000000000AAB),
+        U64_C(0x000000000000406C), U64_C(0x0000000000001AB0), U64_C(0x000000000000F5D4), U64_C(0x000000000000AF08),
+        U64_C(0x000000000000230D), U64_C(0x00000000000079D1), U64_C(0x00000000000096B5), U64_C(0x000000000000CC69),
+        U64_C(0x0000000000000676), U64_C(0x0000000000005CAA), U64_C(0x000000000000B3CE), U64_C(0x000000000000E912),
+        U64_C(0x0000000000006517), U64_C(0x0000000000003FCB), U64_C(0x000000000000D0AF), U64_C(0x0000000000008A73),
+        U64_C(0x000000000000C0B4), U64_C(0x0000000000009A68), U64_C(0x000000000000750C), U64_C(0x0000000000002FD0),
+        U64_C(0x000000000000A3D5), U64_C(0x000000000000F909), U64_C(0x000000000000166D), U64_C(0x0000000000004CB1),
+        U64_C(0x00000000000083E3), U64_C(0x000000000000D93F), U64_C(0x000000000000365B), U64_C(0x0000000000006C87),
+        U64_C(0x000000000000E082), U64_C(0x000000000000BA5E), U64_C(0x000000000000553A), U64_C(0x0000000000000FE6),
+        U64_C(0x0000000000004521), U64_C(0x0000000000001FFD), U64_C(0x000000000000F099), U64_C(0x000000000000AA45),
+        U64_C(0x0000000000002640), U64_C(0x0000000000007C9C), U64_C(0x00000000000093F8), U64_C(0x000000000000C924),
+        U64_C(0x000000000000054D), U64_C(0x0000000000005F91), U64_C(0x000000000000B0F5), U64_C(0x000000000000EA29),
+        U64_C(0x000000000000662C), U64_C(0x0000000000003CF0), U64_C(0x000000000000D394), U64_C(0x0000000000008948),
+        U64_C(0x000000000000C38F), U64_C(0x0000000000009953), U64_C(0x0000000000007637), U64_C(0x0000000000002CEB),
+        U64_C(0x000000000000A0EE), U64_C(0x000000000000FA32), U64_C(0x0000000000001556), U64_C(0x0000000000004F8A),
+        U64_C(0x00000000000080D8), U64_C(0x000000000000DA04), U64_C(0x0000000000003560), U64_C(0x0000000000006FBC),
+        U64_C(0x000000000000E3B9), U64_C(0x000000000000B965), U64_C(0x0000000000005601), U64_C(0x0000000000000CDD),
+        U64_C(0x000000000000461A), U64_C(0x0000000000001CC6), U64_C(0x000000000000F3A2), U64_C(0x000000000000A97E),
+        U64_C(0x000000000000257B), U64_C(0x0000000000007FA7), U64_C(0x00000000000090C3), U64_C(0x000000000000CA1F),
+        U64_C(0x0000000000000CEC), U64_C(0x0000000000005630), U64_C(0x000000000000B954), U64_C(0x000000000000E388),
+        U64_C(0x0000000000006F8D), U64_C(0x0000000000003551), U64_C(0x000000000000DA35), U64_C(0x00000000000080E9),
+        U64_C(0x000000000000CA2E), U64_C(0x00000000000090F2), U64_C(0x0000000000007F96), U64_C(0x000000000000254A),
+        U64_C(0x000000000000A94F), U64_C(0x000000000000F393), U64_C(0x0000000000001CF7), U64_C(0x000000000000462B),
+        U64_C(0x0000000000008979), U64_C(0x000000000000D3A5), U64_C(0x0000000000003CC1), U64_C(0x000000000000661D),
+        U64_C(0x000000000000EA18), U64_C(0x000000000000B0C4), U64_C(0x0000000000005FA0), U64_C(0x000000000000057C),
+        U64_C(0x0000000000004FBB), U64_C(0x0000000000001567), U64_C(0x000000000000FA03), U64_C(0x000000000000A0DF),
+        U64_C(0x0000000000002CDA), U64_C(0x0000000000007606), U64_C(0x0000000000009962), U64_C(0x000000000000C3BE),
+        U64_C(0x0000000000000FD7), U64_C(0x000000000000550B), U64_C(0x000000000000BA6F), U64_C(0x000000000000E0B3),
+        U64_C(0x0000000000006CB6), U64_C(0x000000000000366A), U64_C(0x000000000000D90E), U64_C(0x00000000000083D2),
+        U64_C(0x000000000000C915), U64_C(0x00000000000093C9), U64_C(0x0000000000007CAD), U64_C(0x0000000000002671),
+        U64_C(0x000000000000AA74), U64_C(0x000000000000F0A8), U64_C(0x0000000000001FCC), U64_C(0x0000000000004510),
+        U64_C(0x0000000000008A42), U64_C(0x000000000000D09E), U64_C(0x0000000000003FFA), U64_C(0x0000000000006526),
+        U64_C(0x000000000000E923), U64_C(0x000000000000B3FF), U64_C(0x0000000000005C9B), U64_C(0x0000000000000647),
+        U64_C(0x0000000000004C80), U64_C(0x000000000000165C), U64_C(0x000000000000F938), U64_C(0x000000000000A3E4),
+        U64_C(0x0000000000002FE1), U64_C(0x000000000000753D), U64_C(0x0000000000009A59), U64_C(0x000000000000C085),
+        U64_C(0x0000000000000A9A), U64_C(0x0000000000005046), U64_C(0x000000000000BF22), U64_C(0x000000000000E5FE),
+        U64_C(0x00000000000069FB), U64_C(0x0000000000003327), U64_C(0x000000000000DC43), U64_C(0x000000000000869F),
+        U64_C(0x000000000000CC58), U64_C(0x0000000000009684), U64_C(0x00000000000079E0), U64_C(0x000000000000233C),
+        U64_C(0x000000000000AF39), U64_C(0x000000000000F5E5), U64_C(0x0000000000001A81), U64_C(0x000000000000405D),
+        U64_C(0x0000000000008F0F), U64_C(0x000000000000D5D3), U64_C(0x0000000000003AB7), U64_C(0x000000000000606B),
+        U64_C(0x000000000000EC6E), U64_C(0x000000000000B6B2), U64_C(0x00000000000059D6), U64_C(0x000000000000030A),
+        U64_C(0x00000000000049CD), U64_C(0x0000000000001311), U64_C(0x000000000000FC75), U64_C(0x000000000000A6A9),
+        U64_C(0x0000000000002AAC), U64_C(0x0000000000007070), U64_C(0x0000000000009F14), U64_C(0x000000000000C5C8),
+        U64_C(0x00000000000009A1), U64_C(0x000000000000537D), U64_C(0x000000000000BC19), U64_C(0x000000000000E6C5),
+        U64_C(0x0000000000006AC0), U64_C(0x000000000000301C), U64_C(0x000000000000DF78), U64_C(0x00000000000085A4),
+        U64_C(0x000000000000CF63), U64_C(0x00000000000095BF), U64_C(0x0000000000007ADB), U64_C(0x0000000000002007),
+        U64_C(0x000000000000AC02), U64_C(0x000000000000F6DE), U64_C(0x00000000000019BA), U64_C(0x0000000000004366),
+        U64_C(0x0000000000008C34), U64_C(0x000000000000D6E8), U64_C(0x000000000000398C), U64_C(0x0000000000006350),
+        U64_C(0x000000000000EF55), U64_C(0x000000000000B589), U64_C(0x0000000000005AED), U64_C(0x0000000000000031),
+        U64_C(0x0000000000004AF6), U64_C(0x000000000000102A), U64_C(0x000000000000FF4E), U64_C(0x000000000000A592),
+        U64_C(0x0000000000002997), U64_C(0x000000000000734B), U64_C(0x0000000000009C2F), U64_C(0x000000000000C6F3),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x0000000000001CBB), U64_C(0x0000000000003976), U64_C(0x00000000000025CD),
+        U64_C(0x00000000000072EC), U64_C(0x0000000000006E57), U64_C(0x0000000000004B9A), U64_C(0x0000000000005721),
+        U64_C(0x000000000000E5D8), U64_C(0x000000000000F963), U64_C(0x000000000000DCAE), U64_C(0x000000000000C015),
+        U64_C(0x0000000000009734), U64_C(0x0000000000008B8F), U64_C(0x000000000000AE42), U64_C(0x000000000000B2F9),
+        U64_C(0x000000000000C3A1), U64_C(0x000000000000DF1A), U64_C(0x000000000000FAD7), U64_C(0x000000000000E66C),
+        U64_C(0x000000000000B14D), U64_C(0x000000000000ADF6), U64_C(0x000000000000883B), U64_C(0x0000000000009480),
+        U64_C(0x0000000000002679), U64_C(0x0000000000003AC2), U64_C(0x0000000000001F0F), U64_C(0x00000000000003B4),
+        U64_C(0x0000000000005495), U64_C(0x000000000000482E), U64_C(0x0000000000006DE3), U64_C(0x0000000000007158),
+        U64_C(0x0000000000008F53), U64_C(0x00000000000093E8), U64_C(0x000000000000B625), U64_C(0x000000000000AA9E),
+        U64_C(0x000000000000FDBF), U64_C(0x000000000000E104), U64_C(0x000000000000C4C9), U64_C(0x000000000000D872),
+        U64_C(0x0000000000006A8B), U64_C(0x0000000000007630), U64_C(0x00000000000053FD), U64_C(0x0000000000004F46),
+        U64_C(0x0000000000001867), U64_C(0x00000000000004DC), U64_C(0x0000000000002111), U64_C(0x0000000000003DAA),
+        U64_C(0x0000000000004CF2), U64_C(0x0000000000005049), U64_C(0x0000000000007584), U64_C(0x000000000000693F),
+        U64_C(0x0000000000003E1E), U64_C(0x00000000000022A5), U64_C(0x0000000000000768), U64_C(0x0000000000001BD3),
+        U64_C(0x000000000000A92A), U64_C(0x000000000000B591), U64_C(0x000000000000905C), U64_C(0x0000000000008CE7),
+        U64_C(0x000000000000DBC6), U64_C(0x000000000000C77D), U64_C(0x000000000000E2B0), U64_C(0x000000000000FE0B),
+        U64_C(0x00000000000016B7), U64_C(0x0000000000000A0C), U64_C(0x0000000000002FC1), U64_C(0x000000000000337A),
+        U64_C(0x000000000000645B), U64_C(0x00000000000078E0), U64_C(0x0000000000005D2D), U64_C(0x0000000000004196),
+        U64_C(0x000000000000F36F), U64_C(0x000000000000EFD4), U64_C(0x000000000000CA19), U64_C(0x000000000000D6A2),
+        U64_C(0x0000000000008183), U64_C(0x0000000000009D38), U64_C(0x000000000000B8F5), U64_C(0x000000000000A44E),
+        U64_C(0x000000000000D516), U64_C(0x000000000000C9AD), U64_C(0x000000000000EC60), U64_C(0x000000000000F0DB),
+        U64_C(0x000000000000A7FA), U64_C(0x000000000000BB41), U64_C(0x0000000000009E8C), U64_C(0x0000000000008237),
+        U64_C(0x00000000000030CE), U64_C(0x0000000000002C75), U64_C(0x00000000000009B8), U64_C(0x0000000000001503),
+        U64_C(0x0000000000004222), U64_C(0x0000000000005E99), U64_C(0x0000000000007B54), U64_C(0x00000000000067EF),
+        U64_C(0x00000000000099E4), U64_C(0x000000000000855F), U64_C(0x000000000000A092), U64_C(0x000000000000BC29),
+        U64_C(0x000000000000EB08), U64_C(0x000000000000F7B3), U64_C(0x000000000000D27E), U64_C(0x000000000000CEC5),
+        U64_C(0x0000000000007C3C), U64_C(0x0000000000006087), U64_C(0x000000000000454A), U64_C(0x00000000000059F1),
+        U64_C(0x0000000000000ED0), U64_C(0x000000000000126B), U64_C(0x00000000000037A6), U64_C(0x0000000000002B1D),
+        U64_C(0x0000000000005A45), U64_C(0x00000000000046FE), U64_C(0x0000000000006333), U64_C(0x0000000000007F88),
+        U64_C(0x00000000000028A9), U64_C(0x0000000000003412), U64_C(0x00000000000011DF), U64_C(0x0000000000000D64),
+        U64_C(0x000000000000BF9D), U64_C(0x000000000000A326), U64_C(0x00000000000086EB), U64_C(0x0000000000009A50),
+        U64_C(0x000000000000CD71), U64_C(0x000000000000D1CA), U64_C(0x000000000000F407), U64_C(0x000000000000E8BC),
+        U64_C(0x0000000000002D6E), U64_C(0x00000000000031D5), U64_C(0x0000000000001418), U64_C(0x00000000000008A3),
+        U64_C(0x0000000000005F82), U64_C(0x0000000000004339), U64_C(0x00000000000066F4), U64_C(0x0000000000007A4F),
+        U64_C(0x000000000000C8B6), U64_C(0x000000000000D40D), U64_C(0x000000000000F1C0), U64_C(0x000000000000ED7B),
+        U64_C(0x000000000000BA5A), U64_C(0x000000000000A6E1), U64_C(0x000000000000832C), U64_C(0x0000000000009F97),
+        U64_C(0x000000000000EECF), U64_C(0x000000000000F274), U64_C(0x000000000000D7B9), U64_C(0x000000000000CB02),
+        U64_C(0x0000000000009C23), U64_C(0x0000000000008098), U64_C(0x000000000000A555), U64_C(0x000000000000B9EE),
+        U64_C(0x0000000000000B17), U64_C(0x00000000000017AC), U64_C(0x0000000000003261), U64_C(0x0000000000002EDA),
+        U64_C(0x00000000000079FB), U64_C(0x0000000000006540), U64_C(0x000000000000408D), U64_C(0x0000000000005C36),
+        U64_C(0x000000000000A23D), U64_C(0x000000000000BE86), U64_C(0x0000000000009B4B), U64_C(0x00000000000087F0),
+        U64_C(0x000000000000D0D1), U64_C(0x000000000000CC6A), U64_C(0x000000000000E9A7), U64_C(0x000000000000F51C),
+        U64_C(0x00000000000047E5), U64_C(0x0000000000005B5E), U64_C(0x0000000000007E93), U64_C(0x0000000000006228),
+        U64_C(0x0000000000003509), U64_C(0x00000000000029B2), U64_C(0x0000000000000C7F), U64_C(0x00000000000010C4),
+        U64_C(0x000000000000619C), U64_C(0x0000000000007D27), U64_C(0x00000000000058EA), U64_C(0x0000000000004451),
+        U64_C(0x0000000000001370), U64_C(0x0000000000000FCB), U64_C(0x0000000000002A06), U64_C(0x00000000000036BD),
+        U64_C(0x0000000000008444), U64_C(0x00000000000098FF), U64_C(0x000000000000BD32), U64_C(0x000000000000A189),
+        U64_C(0x000000000000F6A8), U64_C(0x000000000000EA13), U64_C(0x000000000000CFDE), U64_C(0x000000000000D365),
+        U64_C(0x0000000000003BD9), U64_C(0x0000000000002762), U64_C(0x00000000000002AF), U64_C(0x0000000000001E14),
+        U64_C(0x0000000000004935), U64_C(0x000000000000558E), U64_C(0x0000000000007043), U64_C(0x0000000000006CF8),
+        U64_C(0x000000000000DE01), U64_C(0x000000000000C2BA), U64_C(0x000000000000E777), U64_C(0x000000000000FBCC),
+        U64_C(0x000000000000ACED), U64_C(0x000000000000B056), U64_C(0x000000000000959B), U64_C(0x0000000000008920),
+        U64_C(0x000000000000F878), U64_C(0x000000000000E4C3), U64_C(0x000000000000C10E), U64_C(0x000000000000DDB5),
+        U64_C(0x0000000000008A94), U64_C(0x000000000000962F), U64_C(0x000000000000B3E2), U64_C(0x000000000000AF59),
+        U64_C(0x0000000000001DA0), U64_C(0x000000000000011B), U64_C(0x00000000000024D6), U64_C(0x000000000000386D),
+        U64_C(0x0000000000006F4C), U64_C(0x00000000000073F7), U64_C(0x000000000000563A), U64_C(0x0000000000004A81),
+        U64_C(0x000000000000B48A), U64_C(0x000000000000A831), U64_C(0x0000000000008DFC), U64_C(0x0000000000009147),
+        U64_C(0x000000000000C666), U64_C(0x000000000000DADD), U64_C(0x000000000000FF10), U64_C(0x000000000000E3AB),
+        U64_C(0x0000000000005152), U64_C(0x0000000000004DE9), U64_C(0x0000000000006824), U64_C(0x000000000000749F),
+        U64_C(0x00000000000023BE), U64_C(0x0000000000003F05), U64_C(0x0000000000001AC8), U64_C(0x0000000000000673),
+        U64_C(0x000000000000772B), U64_C(0x0000000000006B90), U64_C(0x0000000000004E5D), U64_C(0x00000000000052E6),
+        U64_C(0x00000000000005C7), U64_C(0x000000000000197C), U64_C(0x0000000000003CB1), U64_C(0x000000000000200A),
+        U64_C(0x00000000000092F3), U64_C(0x0000000000008E48), U64_C(0x000000000000AB85), U64_C(0x000000000000B73E),
+        U64_C(0x000000000000E01F), U64_C(0x000000000000FCA4), U64_C(0x000000000000D969), U64_C(0x000000000000C5D2),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x0000000000000B44), U64_C(0x0000000000001688), U64_C(0x0000000000001DCC),
+        U64_C(0x0000000000002D10), U64_C(0x0000000000002654), U64_C(0x0000000000003B98), U64_C(0x00000000000030DC),
+        U64_C(0x0000000000005A20), U64_C(0x0000000000005164), U64_C(0x0000000000004CA8), U64_C(0x00000000000047EC),
+        U64_C(0x0000000000007730), U64_C(0x0000000000007C74), U64_C(0x00000000000061B8), U64_C(0x0000000000006AFC),
+        U64_C(0x000000000000B440), U64_C(0x000000000000BF04), U64_C(0x000000000000A2C8), U64_C(0x000000000000A98C),
+        U64_C(0x0000000000009950), U64_C(0x0000000000009214), U64_C(0x0000000000008FD8), U64_C(0x000000000000849C),
+        U64_C(0x000000000000EE60), U64_C(0x000000000000E524), U64_C(0x000000000000F8E8), U64_C(0x000000000000F3AC),
+        U64_C(0x000000000000C370), U64_C(0x000000000000C834), U64_C(0x000000000000D5F8), U64_C(0x000000000000DEBC),
+        U64_C(0x0000000000006091), U64_C(0x0000000000006BD5), U64_C(0x0000000000007619), U64_C(0x0000000000007D5D),
+        U64_C(0x0000000000004D81), U64_C(0x00000000000046C5), U64_C(0x0000000000005B09), U64_C(0x000000000000504D),
+        U64_C(0x0000000000003AB1), U64_C(0x00000000000031F5), U64_C(0x0000000000002C39), U64_C(0x000000000000277D),
+        U64_C(0x00000000000017A1), U64_C(0x0000000000001CE5), U64_C(0x0000000000000129), U64_C(0x0000000000000A6D),
+        U64_C(0x000000000000D4D1), U64_C(0x000000000000DF95), U64_C(0x000000000000C259), U64_C(0x000000000000C91D),
+        U64_C(0x000000000000F9C1), U64_C(0x000000000000F285), U64_C(0x000000000000EF49), U64_C(0x000000000000E40D),
+        U64_C(0x0000000000008EF1), U64_C(0x00000000000085B5), U64_C(0x0000000000009879), U64_C(0x000000000000933D),
+        U64_C(0x000000000000A3E1), U64_C(0x000000000000A8A5), U64_C(0x000000000000B569), U64_C(0x000000000000BE2D),
+        U64_C(0x000000000000C122), U64_C(0x000000000000CA66), U64_C(0x000000000000D7AA), U64_C(0x000000000000DCEE),
+        U64_C(0x000000000000EC32), U64_C(0x000000000000E776), U64_C(0x000000000000FABA), U64_C(0x000000000000F1FE),
+        U64_C(0x0000000000009B02), U64_C(0x0000000000009046), U64_C(0x0000000000008D8A), U64_C(0x00000000000086CE),
+        U64_C(0x000000000000B612), U64_C(0x000000000000BD56), U64_C(0x000000000000A09A), U64_C(0x000000000000ABDE),
+        U64_C(0x0000000000007562), U64_C(0x0000000000007E26), U64_C(0x00000000000063EA), U64_C(0x00000000000068AE),
+        U64_C(0x0000000000005872), U64_C(0x0000000000005336), U64_C(0x0000000000004EFA), U64_C(0x00000000000045BE),
+        U64_C(0x0000000000002F42), U64_C(0x0000000000002406), U64_C(0x00000000000039CA), U64_C(0x000000000000328E),
+        U64_C(0x0000000000000252), U64_C(0x0000000000000916), U64_C(0x00000000000014DA), U64_C(0x0000000000001F9E),
+        U64_C(0x000000000000A1B3), U64_C(0x000000000000AAF7), U64_C(0x000000000000B73B), U64_C(0x000000000000BC7F),
+        U64_C(0x0000000000008CA3), U64_C(0x00000000000087E7), U64_C(0x0000000000009A2B), U64_C(0x000000000000916F),
+        U64_C(0x000000000000FB93), U64_C(0x000000000000F0D7), U64_C(0x000000000000ED1B), U64_C(0x000000000000E65F),
+        U64_C(0x000000000000D683), U64_C(0x000000000000DDC7), U64_C(0x000000000000C00B), U64_C(0x000000000000CB4F),
+        U64_C(0x00000000000015F3), U64_C(0x0000000000001EB7), U64_C(0x000000000000037B), U64_C(0x000000000000083F),
+        U64_C(0x00000000000038E3), U64_C(0x00000000000033A7), U64_C(0x0000000000002E6B), U64_C(0x000000000000252F),
+        U64_C(0x0000000000004FD3), U64_C(0x0000000000004497), U64_C(0x000000000000595B), U64_C(0x000000000000521F),
+        U64_C(0x00000000000062C3), U64_C(0x0000000000006987), U64_C(0x000000000000744B), U64_C(0x0000000000007F0F),
+        U64_C(0x0000000000008A55), U64_C(0x0000000000008111), U64_C(0x0000000000009CDD), U64_C(0x0000000000009799),
+        U64_C(0x000000000000A745), U64_C(0x000000000000AC01), U64_C(0x000000000000B1CD), U64_C(0x000000000000BA89),
+        U64_C(0x000000000000D075), U64_C(0x000000000000DB31), U64_C(0x000000000000C6FD), U64_C(0x000000000000CDB9),
+        U64_C(0x000000000000FD65), U64_C(0x000000000000F621), U64_C(0x000000000000EBED), U64_C(0x000000000000E0A9),
+        U64_C(0x0000000000003E15), U64_C(0x0000000000003551), U64_C(0x000000000000289D), U64_C(0x00000000000023D9),
+        U64_C(0x0000000000001305), U64_C(0x0000000000001841), U64_C(0x000000000000058D), U64_C(0x0000000000000EC9),
+        U64_C(0x0000000000006435), U64_C(0x0000000000006F71), U64_C(0x00000000000072BD), U64_C(0x00000000000079F9),
+        U64_C(0x0000000000004925), U64_C(0x0000000000004261), U64_C(0x0000000000005FAD), U64_C(0x00000000000054E9),
+        U64_C(0x000000000000EAC4), U64_C(0x000000000000E180), U64_C(0x000000000000FC4C), U64_C(0x000000000000F708),
+        U64_C(0x000000000000C7D4), U64_C(0x000000000000CC90), U64_C(0x000000000000D15C), U64_C(0x000000000000DA18),
+        U64_C(0x000000000000B0E4), U64_C(0x000000000000BBA0), U64_C(0x000000000000A66C), U64_C(0x000000000000AD28),
+        U64_C(0x0000000000009DF4), U64_C(0x00000000000096B0), U64_C(0x0000000000008B7C), U64_C(0x0000000000008038),
+        U64_C(0x0000000000005E84), U64_C(0x00000000000055C0), U64_C(0x000000000000480C), U64_C(0x0000000000004348),
+        U64_C(0x0000000000007394), U64_C(0x00000000000078D0), U64_C(0x000000000000651C), U64_C(0x0000000000006E58),
+        U64_C(0x00000000000004A4), U64_C(0x0000000000000FE0), U64_C(0x000000000000122C), U64_C(0x0000000000001968),
+        U64_C(0x00000000000029B4), U64_C(0x00000000000022F0), U64_C(0x0000000000003F3C), U64_C(0x0000000000003478),
+        U64_C(0x0000000000004B77), U64_C(0x0000000000004033), U64_C(0x0000000000005DFF), U64_C(0x00000000000056BB),
+        U64_C(0x0000000000006667), U64_C(0x0000000000006D23), U64_C(0x00000000000070EF), U64_C(0x0000000000007BAB),
+        U64_C(0x0000000000001157), U64_C(0x0000000000001A13), U64_C(0x00000000000007DF), U64_C(0x0000000000000C9B),
+        U64_C(0x0000000000003C47), U64_C(0x0000000000003703), U64_C(0x0000000000002ACF), U64_C(0x000000000000218B),
+        U64_C(0x000000000000FF37), U64_C(0x000000000000F473), U64_C(0x000000000000E9BF), U64_C(0x000000000000E2FB),
+        U64_C(0x000000000000D227), U64_C(0x000000000000D963), U64_C(0x000000000000C4AF), U64_C(0x000000000000CFEB),
+        U64_C(0x000000000000A517), U64_C(0x000000000000AE53), U64_C(0x000000000000B39F), U64_C(0x000000000000B8DB),
+        U64_C(0x0000000000008807), U64_C(0x0000000000008343), U64_C(0x0000000000009E8F), U64_C(0x00000000000095CB),
+        U64_C(0x0000000000002BE6), U64_C(0x00000000000020A2), U64_C(0x0000000000003D6E), U64_C(0x000000000000362A),
+        U64_C(0x00000000000006F6), U64_C(0x0000000000000DB2), U64_C(0x000000000000107E), U64_C(0x0000000000001B3A),
+        U64_C(0x00000000000071C6), U64_C(0x0000000000007A82), U64_C(0x000000000000674E), U64_C(0x0000000000006C0A),
+        U64_C(0x0000000000005CD6), U64_C(0x0000000000005792), U64_C(0x0000000000004A5E), U64_C(0x000000000000411A),
+        U64_C(0x0000000000009FA6), U64_C(0x00000000000094E2), U64_C(0x000000000000892E), U64_C(0x000000000000826A),
+        U64_C(0x000000000000B2B6), U64_C(0x000000000000B9F2), U64_C(0x000000000000A43E), U64_C(0x000000000000AF7A),
+        U64_C(0x000000000000C586), U64_C(0x000000000000CEC2), U64_C(0x000000000000D30E), U64_C(0x000000000000D84A),
+        U64_C(0x000000000000E896), U64_C(0x000000000000E3D2), U64_C(0x000000000000FE1E), U64_C(0x000000000000F55A),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x000000000000042B), U64_C(0x0000000000000856), U64_C(0x0000000000000C7D),
+        U64_C(0x00000000000010AC), U64_C(0x0000000000001487), U64_C(0x00000000000018FA), U64_C(0x0000000000001CD1),
+        U64_C(0x0000000000002158), U64_C(0x0000000000002573), U64_C(0x000000000000290E), U64_C(0x0000000000002D25),
+        U64_C(0x00000000000031F4), U64_C(0x00000000000035DF), U64_C(0x00000000000039A2), U64_C(0x0000000000003D89),
+        U64_C(0x00000000000042B0), U64_C(0x000000000000469B), U64_C(0x0000000000004AE6), U64_C(0x0000000000004ECD),
+        U64_C(0x000000000000521C), U64_C(0x0000000000005637), U64_C(0x0000000000005A4A), U64_C(0x0000000000005E61),
+        U64_C(0x00000000000063E8), U64_C(0x00000000000067C3), U64_C(0x0000000000006BBE), U64_C(0x0000000000006F95),
+        U64_C(0x0000000000007344), U64_C(0x000000000000776F), U64_C(0x0000000000007B12), U64_C(0x0000000000007F39),
+        U64_C(0x0000000000008560), U64_C(0x000000000000814B), U64_C(0x0000000000008D36), U64_C(0x000000000000891D),
+        U64_C(0x00000000000095CC), U64_C(0x00000000000091E7), U64_C(0x0000000000009D9A), U64_C(0x00000000000099B1),
+        U64_C(0x000000000000A438), U64_C(0x000000000000A013), U64_C(0x000000000000AC6E), U64_C(0x000000000000A845),
+        U64_C(0x000000000000B494), U64_C(0x000000000000B0BF), U64_C(0x000000000000BCC2), U64_C(0x000000000000B8E9),
+        U64_C(0x000000000000C7D0), U64_C(0x000000000000C3FB), U64_C(0x000000000000CF86), U64_C(0x000000000000CBAD),
+        U64_C(0x000000000000D77C), U64_C(0x000000000000D357), U64_C(0x000000000000DF2A), U64_C(0x000000000000DB01),
+        U64_C(0x000000000000E688), U64_C(0x000000000000E2A3), U64_C(0x000000000000EEDE), U64_C(0x000000000000EAF5),
+        U64_C(0x000000000000F624), U64_C(0x000000000000F20F), U64_C(0x000000000000FE72), U64_C(0x000000000000FA59),
+        U64_C(0x00000000000002D1), U64_C(0x00000000000006FA), U64_C(0x0000000000000A87), U64_C(0x0000000000000EAC),
+        U64_C(0x000000000000127D), U64_C(0x0000000000001656), U64_C(0x0000000000001A2B), U64_C(0x0000000000001E00),
+        U64_C(0x0000000000002389), U64_C(0x00000000000027A2), U64_C(0x0000000000002BDF), U64_C(0x0000000000002FF4),
+        U64_C(0x0000000000003325), U64_C(0x000000000000370E), U64_C(0x0000000000003B73), U64_C(0x0000000000003F58),
+        U64_C(0x0000000000004061), U64_C(0x000000000000444A), U64_C(0x0000000000004837), U64_C(0x0000000000004C1C),
+        U64_C(0x00000000000050CD), U64_C(0x00000000000054E6), U64_C(0x000000000000589B), U64_C(0x0000000000005CB0),
+        U64_C(0x0000000000006139), U64_C(0x0000000000006512), U64_C(0x000000000000696F), U64_C(0x0000000000006D44),
+        U64_C(0x0000000000007195), U64_C(0x00000000000075BE), U64_C(0x00000000000079C3), U64_C(0x0000000000007DE8),
+        U64_C(0x00000000000087B1), U64_C(0x000000000000839A), U64_C(0x0000000000008FE7), U64_C(0x0000000000008BCC),
+        U64_C(0x000000000000971D), U64_C(0x0000000000009336), U64_C(0x0000000000009F4B), U64_C(0x0000000000009B60),
+        U64_C(0x000000000000A6E9), U64_C(0x000000000000A2C2), U64_C(0x000000000000AEBF), U64_C(0x000000000000AA94),
+        U64_C(0x000000000000B645), U64_C(0x000000000000B26E), U64_C(0x000000000000BE13), U64_C(0x000000000000BA38),
+        U64_C(0x000000000000C501), U64_C(0x000000000000C12A), U64_C(0x000000000000CD57), U64_C(0x000000000000C97C),
+        U64_C(0x000000000000D5AD), U64_C(0x000000000000D186), U64_C(0x000000000000DDFB), U64_C(0x000000000000D9D0),
+        U64_C(0x000000000000E459), U64_C(0x000000000000E072), U64_C(0x000000000000EC0F), U64_C(0x000000000000E824),
+        U64_C(0x000000000000F4F5), U64_C(0x000000000000F0DE), U64_C(0x000000000000FCA3), U64_C(0x000000000000F888),
+        U64_C(0x00000000000005A2), U64_C(0x0000000000000189), U64_C(0x0000000000000DF4), U64_C(0x00000000000009DF),
+        U64_C(0x000000000000150E), U64_C(0x0000000000001125), U64_C(0x0000000000001D58), U64_C(0x0000000000001973),
+        U64_C(0x00000000000024FA), U64_C(0x00000000000020D1), U64_C(0x0000000000002CAC), U64_C(0x0000000000002887),
+        U64_C(0x0000000000003456), U64_C(0x000000000000307D), U64_C(0x0000000000003C00), U64_C(0x000000000000382B),
+        U64_C(0x0000000000004712), U64_C(0x0000000000004339), U64_C(0x0000000000004F44), U64_C(0x0000000000004B6F),
+        U64_C(0x00000000000057BE), U64_C(0x0000000000005395), U64_C(0x0000000000005FE8), U64_C(0x0000000000005BC3),
+        U64_C(0x000000000000664A), U64_C(0x0000000000006261), U64_C(0x0000000000006E1C), U64_C(0x0000000000006A37),
+        U64_C(0x00000000000076E6), U64_C(0x00000000000072CD), U64_C(0x0000000000007EB0), U64_C(0x0000000000007A9B),
+        U64_C(0x00000000000080C2), U64_C(0x00000000000084E9), U64_C(0x0000000000008894), U64_C(0x0000000000008CBF),
+        U64_C(0x000000000000906E), U64_C(0x0000000000009445), U64_C(0x0000000000009838), U64_C(0x0000000000009C13),
+        U64_C(0x000000000000A19A), U64_C(0x000000000000A5B1), U64_C(0x000000000000A9CC), U64_C(0x000000000000ADE7),
+        U64_C(0x000000000000B136), U64_C(0x000000000000B51D), U64_C(0x000000000000B960), U64_C(0x000000000000BD4B),
+        U64_C(0x000000000000C272), U64_C(0x000000000000C659), U64_C(0x000000000000CA24), U64_C(0x000000000000CE0F),
+        U64_C(0x000000000000D2DE), U64_C(0x000000000000D6F5), U64_C(0x000000000000DA88), U64_C(0x000000000000DEA3),
+        U64_C(0x000000000000E32A), U64_C(0x000000000000E701), U64_C(0x000000000000EB7C), U64_C(0x000000000000EF57),
+        U64_C(0x000000000000F386), U64_C(0x000000000000F7AD), U64_C(0x000000000000FBD0), U64_C(0x000000000000FFFB),
+        U64_C(0x0000000000000773), U64_C(0x0000000000000358), U64_C(0x0000000000000F25), U64_C(0x0000000000000B0E),
+        U64_C(0x00000000000017DF), U64_C(0x00000000000013F4), U64_C(0x0000000000001F89), U64_C(0x0000000000001BA2),
+        U64_C(0x000000000000262B), U64_C(0x0000000000002200), U64_C(0x0000000000002E7D), U64_C(0x0000000000002A56),
+        U64_C(0x0000000000003687), U64_C(0x00000000000032AC), U64_C(0x0000000000003ED1), U64_C(0x0000000000003AFA),
+        U64_C(0x00000000000045C3), U64_C(0x00000000000041E8), U64_C(0x0000000000004D95), U64_C(0x00000000000049BE),
+        U64_C(0x000000000000556F), U64_C(0x0000000000005144), U64_C(0x0000000000005D39), U64_C(0x0000000000005912),
+        U64_C(0x000000000000649B), U64_C(0x00000000000060B0), U64_C(0x0000000000006CCD), U64_C(0x00000000000068E6),
+        U64_C(0x0000000000007437), U64_C(0x000000000000701C), U64_C(0x0000000000007C61), U64_C(0x000000000000784A),
+        U64_C(0x0000000000008213), U64_C(0x0000000000008638), U64_C(0x0000000000008A45), U64_C(0x0000000000008E6E),
+        U64_C(0x00000000000092BF), U64_C(0x0000000000009694), U64_C(0x0000000000009AE9), U64_C(0x0000000000009EC2),
+        U64_C(0x000000000000A34B), U64_C(0x000000000000A760), U64_C(0x000000000000AB1D), U64_C(0x000000000000AF36),
+        U64_C(0x000000000000B3E7), U64_C(0x000000000000B7CC), U64_C(0x000000000000BBB1), U64_C(0x000000000000BF9A),
+        U64_C(0x000000000000C0A3), U64_C(0x000000000000C488), U64_C(0x000000000000C8F5), U64_C(0x000000000000CCDE),
+        U64_C(0x000000000000D00F), U64_C(0x000000000000D424), U64_C(0x000000000000D859), U64_C(0x000000000000DC72),
+        U64_C(0x000000000000E1FB), U64_C(0x000000000000E5D0), U64_C(0x000000000000E9AD), U64_C(0x000000000000ED86),
+        U64_C(0x000000000000F157), U64_C(0x000000000000F57C), U64_C(0x000000000000F901), U64_C(0x000000000000FD2A),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x0000000000009FD5), U64_C(0x00000000000037BB), U64_C(0x000000000000A86E),
+        U64_C(0x0000000000006F76), U64_C(0x000000000000F0A3), U64_C(0x00000000000058CD), U64_C(0x000000000000C718),
+        U64_C(0x000000000000DEEC), U64_C(0x0000000000004139), U64_C(0x000000000000E957), U64_C(0x0000000000007682),
+        U64_C(0x000000000000B19A), U64_C(0x0000000000002E4F), U64_C(0x0000000000008621), U64_C(0x00000000000019F4),
+        U64_C(0x000000000000B5C9), U64_C(0x0000000000002A1C), U64_C(0x0000000000008272), U64_C(0x0000000000001DA7),
+        U64_C(0x000000000000DABF), U64_C(0x000000000000456A), U64_C(0x000000000000ED04), U64_C(0x00000000000072D1),
+        U64_C(0x0000000000006B25), U64_C(0x000000000000F4F0), U64_C(0x0000000000005C9E), U64_C(0x000000000000C34B),
+        U64_C(0x0000000000000453), U64_C(0x0000000000009B86), U64_C(0x00000000000033E8), U64_C(0x000000000000AC3D),
+        U64_C(0x0000000000006383), U64_C(0x000000000000FC56), U64_C(0x0000000000005438), U64_C(0x000000000000CBED),
+        U64_C(0x0000000000000CF5), U64_C(0x0000000000009320), U64_C(0x0000000000003B4E), U64_C(0x000000000000A49B),
+        U64_C(0x000000000000BD6F), U64_C(0x00000000000022BA), U64_C(0x0000000000008AD4), U64_C(0x0000000000001501),
+        U64_C(0x000000000000D219), U64_C(0x0000000000004DCC), U64_C(0x000000000000E5A2), U64_C(0x0000000000007A77),
+        U64_C(0x000000000000D64A), U64_C(0x000000000000499F), U64_C(0x000000000000E1F1), U64_C(0x0000000000007E24),
+        U64_C(0x000000000000B93C), U64_C(0x00000000000026E9), U64_C(0x0000000000008E87), U64_C(0x0000000000001152),
+        U64_C(0x00000000000008A6), U64_C(0x0000000000009773), U64_C(0x0000000000003F1D), U64_C(0x000000000000A0C8),
+        U64_C(0x00000000000067D0), U64_C(0x000000000000F805), U64_C(0x000000000000506B), U64_C(0x000000000000CFBE),
+        U64_C(0x000000000000C706), U64_C(0x00000000000058D3), U64_C(0x000000000000F0BD), U64_C(0x0000000000006F68),
+        U64_C(0x000000000000A870), U64_C(0x00000000000037A5), U64_C(0x0000000000009FCB), U64_C(0x000000000000001E),
+        U64_C(0x00000000000019EA), U64_C(0x000000000000863F), U64_C(0x0000000000002E51), U64_C(0x000000000000B184),
+        U64_C(0x000000000000769C), U64_C(0x000000000000E949), U64_C(0x0000000000004127), U64_C(0x000000000000DEF2),
+        U64_C(0x00000000000072CF), U64_C(0x000000000000ED1A), U64_C(0x0000000000004574), U64_C(0x000000000000DAA1),
+        U64_C(0x0000000000001DB9), U64_C(0x000000000000826C), U64_C(0x0000000000002A02), U64_C(0x000000000000B5D7),
+        U64_C(0x000000000000AC23), U64_C(0x00000000000033F6), U64_C(0x0000000000009B98), U64_C(0x000000000000044D),
+        U64_C(0x000000000000C355), U64_C(0x0000000000005C80), U64_C(0x000000000000F4EE), U64_C(0x0000000000006B3B),
+        U64_C(0x000000000000A485), U64_C(0x0000000000003B50), U64_C(0x000000000000933E), U64_C(0x0000000000000CEB),
+        U64_C(0x000000000000CBF3), U64_C(0x0000000000005426), U64_C(0x000000000000FC48), U64_C(0x000000000000639D),
+        U64_C(0x0000000000007A69), U64_C(0x000000000000E5BC), U64_C(0x0000000000004DD2), U64_C(0x000000000000D207),
+        U64_C(0x000000000000151F), U64_C(0x0000000000008ACA), U64_C(0x00000000000022A4), U64_C(0x000000000000BD71),
+        U64_C(0x000000000000114C), U64_C(0x0000000000008E99), U64_C(0x00000000000026F7), U64_C(0x000000000000B922),
+        U64_C(0x0000000000007E3A), U64_C(0x000000000000E1EF), U64_C(0x0000000000004981), U64_C(0x000000000000D654),
+        U64_C(0x000000000000CFA0), U64_C(0x0000000000005075), U64_C(0x000000000000F81B), U64_C(0x00000000000067CE),
+        U64_C(0x000000000000A0D6), U64_C(0x0000000000003F03), U64_C(0x000000000000976D), U64_C(0x00000000000008B8),
+        U64_C(0x000000000000861D), U64_C(0x00000000000019C8), U64_C(0x000000000000B1A6), U64_C(0x0000000000002E73),
+        U64_C(0x000000000000E96B), U64_C(0x00000000000076BE), U64_C(0x000000000000DED0), U64_C(0x0000000000004105),
+        U64_C(0x00000000000058F1), U64_C(0x000000000000C724), U64_C(0x0000000000006F4A), U64_C(0x000000000000F09F),
+        U64_C(0x0000000000003787), U64_C(0x000000000000A852), U64_C(0x000000000000003C), U64_C(0x0000000000009FE9),
+        U64_C(0x00000000000033D4), U64_C(0x000000000000AC01), U64_C(0x000000000000046F), U64_C(0x0000000000009BBA),
+        U64_C(0x0000000000005CA2), U64_C(0x000000000000C377), U64_C(0x0000000000006B19), U64_C(0x000000000000F4CC),
+        U64_C(0x000000000000ED38), U64_C(0x00000000000072ED), U64_C(0x000000000000DA83), U64_C(0x0000000000004556),
+        U64_C(0x000000000000824E), U64_C(0x0000000000001D9B), U64_C(0x000000000000B5F5), U64_C(0x0000000000002A20),
+        U64_C(0x000000000000E59E), U64_C(0x0000000000007A4B), U64_C(0x000000000000D225), U64_C(0x0000000000004DF0),
+        U64_C(0x0000000000008AE8), U64_C(0x000000000000153D), U64_C(0x000000000000BD53), U64_C(0x0000000000002286),
+        U64_C(0x0000000000003B72), U64_C(0x000000000000A4A7), U64_C(0x0000000000000CC9), U64_C(0x000000000000931C),
+        U64_C(0x0000000000005404), U64_C(0x000000000000CBD1), U64_C(0x00000000000063BF), U64_C(0x000000000000FC6A),
+        U64_C(0x0000000000005057), U64_C(0x000000000000CF82), U64_C(0x00000000000067EC), U64_C(0x000000000000F839),
+        U64_C(0x0000000000003F21), U64_C(0x000000000000A0F4), U64_C(0x000000000000089A), U64_C(0x000000000000974F),
+        U64_C(0x0000000000008EBB), U64_C(0x000000000000116E), U64_C(0x000000000000B900), U64_C(0x00000000000026D5),
+        U64_C(0x000000000000E1CD), U64_C(0x0000000000007E18), U64_C(0x000000000000D676), U64_C(0x00000000000049A3),
+        U64_C(0x000000000000411B), U64_C(0x000000000000DECE), U64_C(0x00000000000076A0), U64_C(0x000000000000E975),
+        U64_C(0x0000000000002E6D), U64_C(0x000000000000B1B8), U64_C(0x00000000000019D6), U64_C(0x0000000000008603),
+        U64_C(0x0000000000009FF7), U64_C(0x0000000000000022), U64_C(0x000000000000A84C), U64_C(0x0000000000003799),
+        U64_C(0x000000000000F081), U64_C(0x0000000000006F54), U64_C(0x000000000000C73A), U64_C(0x00000000000058EF),
+        U64_C(0x000000000000F4D2), U64_C(0x0000000000006B07), U64_C(0x000000000000C369), U64_C(0x0000000000005CBC),
+        U64_C(0x0000000000009BA4), U64_C(0x0000000000000471), U64_C(0x000000000000AC1F), U64_C(0x00000000000033CA),
+        U64_C(0x0000000000002A3E), U64_C(0x000000000000B5EB), U64_C(0x0000000000001D85), U64_C(0x0000000000008250),
+        U64_C(0x0000000000004548), U64_C(0x000000000000DA9D), U64_C(0x00000000000072F3), U64_C(0x000000000000ED26),
+        U64_C(0x0000000000002298), U64_C(0x000000000000BD4D), U64_C(0x0000000000001523), U64_C(0x0000000000008AF6),
+        U64_C(0x0000000000004DEE), U64_C(0x000000000000D23B), U64_C(0x0000000000007A55), U64_C(0x000000000000E580),
+        U64_C(0x000000000000FC74), U64_C(0x00000000000063A1), U64_C(0x000000000000CBCF), U64_C(0x000000000000541A),
+        U64_C(0x0000000000009302), U64_C(0x0000000000000CD7), U64_C(0x000000000000A4B9), U64_C(0x0000000000003B6C),
+        U64_C(0x0000000000009751), U64_C(0x0000000000000884), U64_C(0x000000000000A0EA), U64_C(0x0000000000003F3F),
+        U64_C(0x000000000000F827), U64_C(0x00000000000067F2), U64_C(0x000000000000CF9C), U64_C(0x0000000000005049),
+        U64_C(0x00000000000049BD), U64_C(0x000000000000D668), U64_C(0x0000000000007E06), U64_C(0x000000000000E1D3),
+        U64_C(0x00000000000026CB), U64_C(0x000000000000B91E), U64_C(0x0000000000001170), U64_C(0x0000000000008EA5),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x00000000000081BF), U64_C(0x0000000000000B6F), U64_C(0x0000000000008AD0),
+        U64_C(0x00000000000016DE), U64_C(0x0000000000009761), U64_C(0x0000000000001DB1), U64_C(0x0000000000009C0E),
+        U64_C(0x0000000000002DBC), U64_C(0x000000000000AC03), U64_C(0x00000000000026D3), U64_C(0x000000000000A76C),
+        U64_C(0x0000000000003B62), U64_C(0x000000000000BADD), U64_C(0x000000000000300D), U64_C(0x000000000000B1B2),
+        U64_C(0x0000000000005B78), U64_C(0x000000000000DAC7), U64_C(0x0000000000005017), U64_C(0x000000000000D1A8),
+        U64_C(0x0000000000004DA6), U64_C(0x000000000000CC19), U64_C(0x00000000000046C9), U64_C(0x000000000000C776),
+        U64_C(0x00000000000076C4), U64_C(0x000000000000F77B), U64_C(0x0000000000007DAB), U64_C(0x000000000000FC14),
+        U64_C(0x000000000000601A), U64_C(0x000000000000E1A5), U64_C(0x0000000000006B75), U64_C(0x000000000000EACA),
+        U64_C(0x000000000000B6F0), U64_C(0x000000000000374F), U64_C(0x000000000000BD9F), U64_C(0x0000000000003C20),
+        U64_C(0x000000000000A02E), U64_C(0x0000000000002191), U64_C(0x000000000000AB41), U64_C(0x0000000000002AFE),
+        U64_C(0x0000000000009B4C), U64_C(0x0000000000001AF3), U64_C(0x0000000000009023), U64_C(0x000000000000119C),
+        U64_C(0x0000000000008D92), U64_C(0x0000000000000C2D), U64_C(0x00000000000086FD), U64_C(0x0000000000000742),
+        U64_C(0x000000000000ED88), U64_C(0x0000000000006C37), U64_C(0x000000000000E6E7), U64_C(0x0000000000006758),
+        U64_C(0x000000000000FB56), U64_C(0x0000000000007AE9), U64_C(0x000000000000F039), U64_C(0x0000000000007186),
+        U64_C(0x000000000000C034), U64_C(0x000000000000418B), U64_C(0x000000000000CB5B), U64_C(0x0000000000004AE4),
+        U64_C(0x000000000000D6EA), U64_C(0x0000000000005755), U64_C(0x000000000000DD85), U64_C(0x0000000000005C3A),
+        U64_C(0x00000000000065F1), U64_C(0x000000000000E44E), U64_C(0x0000000000006E9E), U64_C(0x000000000000EF21),
+        U64_C(0x000000000000732F), U64_C(0x000000000000F290), U64_C(0x0000000000007840), U64_C(0x000000000000F9FF),
+        U64_C(0x000000000000484D), U64_C(0x000000000000C9F2), U64_C(0x0000000000004322), U64_C(0x000000000000C29D),
+        U64_C(0x0000000000005E93), U64_C(0x000000000000DF2C), U64_C(0x00000000000055FC), U64_C(0x000000000000D443),
+        U64_C(0x0000000000003E89), U64_C(0x000000000000BF36), U64_C(0x00000000000035E6), U64_C(0x000000000000B459),
+        U64_C(0x0000000000002857), U64_C(0x000000000000A9E8), U64_C(0x0000000000002338), U64_C(0x000000000000A287),
+        U64_C(0x0000000000001335), U64_C(0x000000000000928A), U64_C(0x000000000000185A), U64_C(0x00000000000099E5),
+        U64_C(0x00000000000005EB), U64_C(0x0000000000008454), U64_C(0x0000000000000E84), U64_C(0x0000000000008F3B),
+        U64_C(0x000000000000D301), U64_C(0x00000000000052BE), U64_C(0x000000000000D86E), U64_C(0x00000000000059D1),
+        U64_C(0x000000000000C5DF), U64_C(0x0000000000004460), U64_C(0x000000000000CEB0), U64_C(0x0000000000004F0F),
+        U64_C(0x000000000000FEBD), U64_C(0x0000000000007F02), U64_C(0x000000000000F5D2), U64_C(0x000000000000746D),
+        U64_C(0x000000000000E863), U64_C(0x00000000000069DC), U64_C(0x000000000000E30C), U64_C(0x00000000000062B3),
+        U64_C(0x0000000000008879), U64_C(0x00000000000009C6), U64_C(0x0000000000008316), U64_C(0x00000000000002A9),
+        U64_C(0x0000000000009EA7), U64_C(0x0000000000001F18), U64_C(0x00000000000095C8), U64_C(0x0000000000001477),
+        U64_C(0x000000000000A5C5), U64_C(0x000000000000247A), U64_C(0x000000000000AEAA), U64_C(0x0000000000002F15),
+        U64_C(0x000000000000B31B), U64_C(0x00000000000032A4), U64_C(0x000000000000B874), U64_C(0x00000000000039CB),
+        U64_C(0x000000000000CBE2), U64_C(0x0000000000004A5D), U64_C(0x000000000000C08D), U64_C(0x0000000000004132),
+        U64_C(0x000000000000DD3C), U64_C(0x0000000000005C83), U64_C(0x000000000000D653), U64_C(0x00000000000057EC),
+        U64_C(0x000000000000E65E), U64_C(0x00000000000067E1), U64_C(0x000000000000ED31), U64_C(0x0000000000006C8E),
+        U64_C(0x000000000000F080), U64_C(0x000000000000713F), U64_C(0x000000000000FBEF), U64_C(0x0000000000007A50),
+        U64_C(0x000000000000909A), U64_C(0x0000000000001125), U64_C(0x0000000000009BF5), U64_C(0x0000000000001A4A),
+        U64_C(0x0000000000008644), U64_C(0x00000000000007FB), U64_C(0x0000000000008D2B), U64_C(0x0000000000000C94),
+        U64_C(0x000000000000BD26), U64_C(0x0000000000003C99), U64_C(0x000000000000B649), U64_C(0x00000000000037F6),
+        U64_C(0x000000000000ABF8), U64_C(0x0000000000002A47), U64_C(0x000000000000A097), U64_C(0x0000000000002128),
+        U64_C(0x0000000000007D12), U64_C(0x000000000000FCAD), U64_C(0x000000000000767D), U64_C(0x000000000000F7C2),
+        U64_C(0x0000000000006BCC), U64_C(0x000000000000EA73), U64_C(0x00000000000060A3), U64_C(0x000000000000E11C),
+        U64_C(0x00000000000050AE), U64_C(0x000000000000D111), U64_C(0x0000000000005BC1), U64_C(0x000000000000DA7E),
+        U64_C(0x0000000000004670), U64_C(0x000000000000C7CF), U64_C(0x0000000000004D1F), U64_C(0x000000000000CCA0),
+        U64_C(0x000000000000266A), U64_C(0x000000000000A7D5), U64_C(0x0000000000002D05), U64_C(0x000000000000ACBA),
+        U64_C(0x00000000000030B4), U64_C(0x000000000000B10B), U64_C(0x0000000000003BDB), U64_C(0x000000000000BA64),
+        U64_C(0x0000000000000BD6), U64_C(0x0000000000008A69), U64_C(0x00000000000000B9), U64_C(0x0000000000008106),
+        U64_C(0x0000000000001D08), U64_C(0x0000000000009CB7), U64_C(0x0000000000001667), U64_C(0x00000000000097D8),
+        U64_C(0x000000000000AE13), U64_C(0x0000000000002FAC), U64_C(0x000000000000A57C), U64_C(0x00000000000024C3),
+        U64_C(0x000000000000B8CD), U64_C(0x0000000000003972), U64_C(0x000000000000B3A2), U64_C(0x000000000000321D),
+        U64_C(0x00000000000083AF), U64_C(0x0000000000000210), U64_C(0x00000000000088C0), U64_C(0x000000000000097F),
+        U64_C(0x0000000000009571), U64_C(0x00000000000014CE), U64_C(0x0000000000009E1E), U64_C(0x0000000000001FA1),
+        U64_C(0x000000000000F56B), U64_C(0x00000000000074D4), U64_C(0x000000000000FE04), U64_C(0x0000000000007FBB),
+        U64_C(0x000000000000E3B5), U64_C(0x000000000000620A), U64_C(0x000000000000E8DA), U64_C(0x0000000000006965),
+        U64_C(0x000000000000D8D7), U64_C(0x0000000000005968), U64_C(0x000000000000D3B8), U64_C(0x0000000000005207),
+        U64_C(0x000000000000CE09), U64_C(0x0000000000004FB6), U64_C(0x000000000000C566), U64_C(0x00000000000044D9),
+        U64_C(0x00000000000018E3), U64_C(0x000000000000995C), U64_C(0x000000000000138C), U64_C(0x0000000000009233),
+        U64_C(0x0000000000000E3D), U64_C(0x0000000000008F82), U64_C(0x0000000000000552), U64_C(0x00000000000084ED),
+        U64_C(0x000000000000355F), U64_C(0x000000000000B4E0), U64_C(0x0000000000003E30), U64_C(0x000000000000BF8F),
+        U64_C(0x0000000000002381), U64_C(0x000000000000A23E), U64_C(0x00000000000028EE), U64_C(0x000000000000A951),
+        U64_C(0x000000000000439B), U64_C(0x000000000000C224), U64_C(0x00000000000048F4), U64_C(0x000000000000C94B),
+        U64_C(0x0000000000005545), U64_C(0x000000000000D4FA), U64_C(0x0000000000005E2A), U64_C(0x000000000000DF95),
+        U64_C(0x0000000000006E27), U64_C(0x000000000000EF98), U64_C(0x0000000000006548), U64_C(0x000000000000E4F7),
+        U64_C(0x00000000000078F9), U64_C(0x000000000000F946), U64_C(0x0000000000007396), U64_C(0x000000000000F229),
+    },
+};
+
+// CRC-16/KERMIT folding constants
+const crc_clmul_consts CRC16_KERMIT_CLMUL =
+{
+    .fold128 = { U64_C(0xA95D000000000000), U64_C(0x7EEA000000000000) },
+    .fold256 = { U64_C(0xAAC8000000000000), U64_C(0x20F3000000000000) },
+    .fold512 = { U64_C(0x9822000000000000), U64_C(0x7F90000000000000) },
+    .fold1024 = { U64_C(0x471C000000000000), U64_C(0x46D8000000000000) },
+    .fold2048 = { U64_C(0xFD1E000000000000), U64_C(0x157E000000000000) },
+};
+
+// CRC-32/ISO-HDLC slicing tables (generic engine)
+const u64 CRC32_SLICE64_TABLE[8][256] =
+{
+    {
+        U64_C(0x0000000000000000), U64_C(0x0000000077073096), U64_C(0x00000000EE0E612C), U64_C(0x00000000990951BA),
+        U64_C(0x00000000076DC419), U64_C(0x00000000706AF48F), U64_C(0x00000000E963A535), U64_C(0x000000009E6495A3),
+        U64_C(0x000000000EDB8832), U64_C(0x0000000079DCB8A4), U64_C(0x00000000E0D5E91E), U64_C(0x0000000097D2D988),
+        U64_C(0x0000000009B64C2B), U64_C(0x000000007EB17CBD), U64_C(0x00000000E7B82D07), U64_C(0x0000000090BF1D91),
+        U64_C(0x000000001DB71064), U64_C(0x000000006AB020F2), U64_C(0x00000000F3B97148), U64_C(0x0000000084BE41DE),
+        U64_C(0x000000001ADAD47D), U64_C(0x000000006DDDE4EB), U64_C(0x00000000F4D4B551), U64_C(0x0000000083D385C7),
+        U64_C(0x00000000136C9856), U64_C(0x00000000646BA8C0), U64_C(0x00000000FD62F97A), U64_C(0x000000008A65C9EC),
+        U64_C(0x0000000014015C4F), U64_C(0x0000000063066CD9), U64_C(0x00000000FA0F3D63), U64_C(0x000000008D080DF5),
+        U64_C(0x000000003B6E20C8), U64_C(0x000000004C69105E), U64_C(0x00000000D56041E4), U64_C(0x00000000A2677172),
+        U64_C(0x000000003C03E4D1), U64_C(0x000000004B04D447), U64_C(0x00000000D20D85FD), U64_C(0x00000000A50AB56B),
+        U64_C(0x0000000035B5A8FA), U64_C(0x0000000042B2986C), U64_C(0x00000000DBBBC9D6), U64_C(0x00000000ACBCF940),
+        U64_C(0x0000000032D86CE3), U64_C(0x0000000045DF5C75), U64_C(0x00000000DCD60DCF), U64_C(0x00000000ABD13D59),
+        U64_C(0x0000000026D930AC), U64_C(0x0000000051DE003A), U64_C(0x00000000C8D75180), U64_C(0x00000000BFD06116),
+        U64_C(0x0000000021B4F4B5), U64_C(0x0000000056B3C423), U64_C(0x00000000CFBA9599), U64_C(0x00000000B8BDA50F),
+        U64_C(0x000000002802B89E), U64_C(0x000000005F058808), U64_C(0x00000000C60CD9B2), U64_C(0x00000000B10BE924),
+        U64_C(0x000000002F6F7C87), U64_C(0x0000000058684C11), U64_C(0x00000000C1611DAB), U64_C(0x00000000B6662D3D),
+        U64_C(0x0000000076DC4190), U64_C(0x0000000001DB7106), U64_C(0x0000000098D220BC), U64_C(0x00000000EFD5102A),
+        U64_C(0x0000000071B18589), U64_C(0x0000000006B6B51F), U64_C(0x000000009FBFE4A5), U64_C(0x00000000E8B8D433),
+        U64_C(0x000000007807C9A2), U64_C(0x000000000F00F934), U64_C(0x000000009609A88E), U64_C(0x00000000E10E9818),
+        U64_C(0x000000007F6A0DBB), U64_C(0x00000000086D3D2D), U64_C(0x0000000091646C97), U64_C(0x00000000E6635C01),
+        U64_C(0x000000006B6B51F4), U64_C(0x000000001C6C6162), U64_C(0x00000000856530D8), U64_C(0x00000000F262004E),
+        U64_C(0x000000006C0695ED), U64_C(0x000000001B01A57B), U64_C(0x000000008208F4C1), U64_C(0x00000000F50FC457),
+        U64_C(0x0000000065B0D9C6), U64_C(0x0000000012B7E950), U64_C(0x000000008BBEB8EA), U64_C(0x00000000FCB9887C),
+        U64_C(0x0000000062DD1DDF), U64_C(0x0000000015DA2D49), U64_C(0x000000008CD37CF3), U64_C(0x00000000FBD44C65),
+        U64_C(0x000000004DB26158), U64_C(0x000000003AB551CE), U64_C(0x00000000A3BC0074), U64_C(0x00000000D4BB30E2),
+        U64_C(0x000000004ADFA541), U64_C(0x000000003DD895D7), U64_C(0x00000000A4D1C46D), U64_C(0x00000000D3D6F4FB),
+        U64_C(0x000000004369E96A), U64_C(0x00000000346ED9FC), U64_C(0x00000000AD678846), U64_C(0x00000000DA60B8D0),
+        U64_C(0x0000000044042D73), U64_C(0x0000000033031DE5), U64_C(0x00000000AA0A4C5F), U64_C(0x00000000DD0D7CC9),
+        U64_C(0x000000005005713C), U64_C(0x00000000270241AA), U64_C(0x00000000BE0B1010), U64_C(0x00000000C90C2086),
+        U64_C(0x000000005768B525), U64_C(0x00000000206F85B3), U64_C(0x00000000B966D409), U64_C(0x00000000CE61E49F),
+        U64_C(0x000000005EDEF90E), U64_C(0x0000000029D9C998), U64_C(0x00000000B0D09822), U64_C(0x00000000C7D7A8B4),
+        U64_C(0x0000000059B33D17), U64_C(0x000000002EB40D81), U64_C(0x00000000B7BD5C3B), U64_C(0x00000000C0BA6CAD),
+        U64_C(0x00000000EDB88320), U64_C(0x000000009ABFB3B6), U64_C(0x0000000003B6E20C), U64_C(0x0000000074B1D29A),
+        U64_C(0x00000000EAD54739), U64_C(0x000000009DD277AF), U64_C(0x0000000004DB2615), U64_C(0x0000000073DC1683),
+        U64_C(0x00000000E3630B12), U64_C(0x0000000094643B84), U64_C(0x000000000D6D6A3E), U64_C(0x000000007A6A5AA8),
+        U64_C(0x00000000E40ECF0B), U64_C(0x000000009309FF9D), U64_C(0x000000000A00AE27), U64_C(0x000000007D079EB1),
+        U64_C(0x00000000F00F9344), U64_C(0x000000008708A3D2), U64_C(0x000000001E01F268), U64_C(0x000000006906C2FE),
+        U64_C(0x00000000F762575D), U64_C(0x00000000806567CB), U64_C(0x00000000196C3671), U64_C(0x000000006E6B06E7),
+        U64_C(0x00000000FED41B76), U64_C(0x0000000089D32BE0), U64_C(0x0000000010DA7A5A), U64_C(0x0000000067DD4ACC),
+        U64_C(0x00000000F9B9DF6F), U64_C(0x000000008EBEEFF9), U64_C(0x0000000017B7BE43), U64_C(0x0000000060B08ED5),
+        U64_C(0x00000000D6D6A3E8), U64_C(0x00000000A1D1937E), U64_C(0x0000000038D8C2C4), U64_C(0x000000004FDFF252),
+        U64_C(0x00000000D1BB67F1), U64_C(0x00000000A6BC5767), U64_C(0x000000003FB506DD), U64_C(0x0000000048B2364B),
+        U64_C(0x00000000D80D2BDA), U64_C(0x00000000AF0A1B4C), U64_C(0x0000000036034AF6), U64_C(0x0000000041047A60),
+        U64_C(0x00000000DF60EFC3), U64_C(0x00000000A867DF55), U64_C(0x00000000316E8EEF), U64_C(0x000000004669BE79),
+        U64_C(0x00000000CB61B38C), U64_C(0x00000000BC66831A), U64_C(0x00000000256FD2A0), U64_C(0x000000005268E236),
+        U64_C(0x00000000CC0C7795), U64_C(0x00000000BB0B4703), U64_C(0x00000000220216B9), U64_C(0x000000005505262F),
+        U64_C(0x00000000C5BA3BBE), U64_C(0x00000000B2BD0B28), U64_C(0x000000002BB45A92), U64_C(0x000000005CB36A04),
+        U64_C(0x00000000C2D7FFA7), U64_C(0x00000000B5D0CF31), U64_C(0x000000002CD99E8B), U64_C(0x000000005BDEAE1D),
+        U64_C(0x000000009B64C2B0), U64_C(0x00000000EC63F226), U64_C(0x00000000756AA39C), U64_C(0x00000000026D930A),
+        U64_C(0x000000009C0906A9), U64_C(0x00000000EB0E363F), U64_C(0x0000000072076785), U64_C(0x0000000005005713),
+        U64_C(0x0000000095BF4A82), U64_C(0x00000000E2B87A14), U64_C(0x000000007BB12BAE), U64_C(0x000000000CB61B38),
+        U64_C(0x0000000092D28E9B), U64_C(0x00000000E5D5BE0D), U64_C(0x000000007CDCEFB7), U64_C(0x000000000BDBDF21),
+        U64_C(0x0000000086D3D2D4), U64_C(0x00000000F1D4E242), U64_C(0x0000000068DDB3F8), U64_C(0x000000001FDA836E),
+        U64_C(0x0000000081BE16CD), U64_C(0x00000000F6B9265B), U64_C(0x000000006FB077E1), U64_C(0x0000000018B74777),
+        U64_C(0x0000000088085AE6), U64_C(0x00000000FF0F6A70), U64_C(0x0000000066063BCA), U64_C(0x0000000011010B5C),
+        U64_C(0x000000008F659EFF), U64_C(0x00000000F862AE69), U64_C(0x00000000616BFFD3), U64_C(0x00000000166CCF45),
+        U64_C(0x00000000A00AE278), U64_C(0x00000000D70DD2EE), U64_C(0x000000004E048354), U64_C(0x000000003903B3C2),
+        U64_C(0x00000000A7672661), U64_C(0x00000000D06016F7), U64_C(0x000000004969474D), U64_C(0x000000003E6E77DB),
+        U64_C(0x00000000AED16A4A), U64_C(0x00000000D9D65ADC), U64_C(0x0000000040DF0B66), U64_C(0x0000000037D83BF0),
+        U64_C(0x00000000A9BCAE53), U64_C(0x00000000DEBB9EC5), U64_C(0x0000000047B2CF7F), U64_C(0x0000000030B5FFE9),
+        U64_C(0x00000000BDBDF21C), U64_C(0x00000000CABAC28A), U64_C(0x0000000053B39330), U64_C(0x0000000024B4A3A6),
+        U64_C(0x00000000BAD03605), U64_C(0x00000000CDD70693), U64_C(0x0000000054DE5729), U64_C(0x0000000023D967BF),
+        U64_C(0x00000000B3667A2E), U64_C(0x00000000C4614AB8), U64_C(0x000000005D681B02), U64_C(0x000000002A6F2B94),
+        U64_C(0x00000000B40BBE37), U64_C(0x00000000C30C8EA1), U64_C(0x000000005A05DF1B), U64_C(0x000000002D02EF8D),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x00000000191B3141), U64_C(0x0000000032366282), U64_C(0x000000002B2D53C3),
+        U64_C(0x00000000646CC504), U64_C(0x000000007D77F445), U64_C(0x00000000565AA786), U64_C(0x000000004F4196C7),
+        U64_C(0x00000000C8D98A08), U64_C(0x00000000D1C2BB49), U64_C(0x00000000FAEFE88A), U64_C(0x00000000E3F4D9CB),
+        U64_C(0x00000000ACB54F0C), U64_C(0x00000000B5AE7E4D), U64_C(0x000000009E832D8E), U64_C(0x0000000087981CCF),
+        U64_C(0x000000004AC21251), U64_C(0x0000000053D92310), U64_C(0x0000000078F470D3), U64_C(0x0000000061EF4192),
+        U64_C(0x000000002EAED755), U64_C(0x0000000037B5E614), U64_C(0x000000001C98B5D7), U64_C(0x0000000005838496),
+        U64_C(0x00000000821B9859), U64_C(0x000000009B00A918), U64_C(0x00000000B02DFADB), U64_C(0x00000000A936CB9A),
+        U64_C(0x00000000E6775D5D), U64_C(0x00000000FF6C6C1C), U64_C(0x00000000D4413FDF), U64_C(0x00000000CD5A0E9E),
+        U64_C(0x00000000958424A2), U64_C(0x000000008C9F15E3), U64_C(0x00000000A7B24620), U64_C(0x00000000BEA97761),
+        U64_C(0x00000000F1E8E1A6), U64_C(0x00000000E8F3D0E7), U64_C(0x00000000C3DE8324), U64_C(0x00000000DAC5B265),
+        U64_C(0x000000005D5DAEAA), U64_C(0x0000000044469FEB), U64_C(0x000000006F6BCC28), U64_C(0x000000007670FD69),
+        U64_C(0x0000000039316BAE), U64_C(0x00000000202A5AEF), U64_C(0x000000000B07092C), U64_C(0x00000000121C386D),
+        U64_C(0x00000000DF4636F3), U64_C(0x00000000C65D07B2), U64_C(0x00000000ED705471), U64_C(0x00000000F46B6530),
+        U64_C(0x00000000BB2AF3F7), U64_C(0x00000000A231C2B6), U64_C(0x00000000891C9175), U64_C(0x000000009007A034),
+        U64_C(0x00000000179FBCFB), U64_C(0x000000000E848DBA), U64_C(0x0000000025A9DE79), U64_C(0x000000003CB2EF38),
+        U64_C(0x0000000073F379FF), U64_C(0x000000006AE848BE), U64_C(0x0000000041C51B7D), U64_C(0x0000000058DE2A3C),
+        U64_C(0x00000000F0794F05), U64_C(0x00000000E9627E44), U64_C(0x00000000C24F2D87), U64_C(0x00000000DB541CC6),
+        U64_C(0x0000000094158A01), U64_C(0x000000008D0EBB40), U64_C(0x00000000A623E883), U64_C(0x00000000BF38D9C2),
+        U64_C(0x0000000038A0C50D), U64_C(0x0000000021BBF44C), U64_C(0x000000000A96A78F), U64_C(0x00000000138D96CE),
+        U64_C(0x000000005CCC0009), U64_C(0x0000000045D73148), U64_C(0x000000006EFA628B), U64_C(0x0000000077E153CA),
+        U64_C(0x00000000BABB5D54), U64_C(0x00000000A3A06C15), U64_C(0x00000000888D3FD6), U64_C(0x0000000091960E97),
+        U64_C(0x00000000DED79850), U64_C(0x00000000C7CCA911), U64_C(0x00000000ECE1FAD2), U64_C(0x00000000F5FACB93),
+        U64_C(0x000000007262D75C), U64_C(0x000000006B79E61D), U64_C(0x000000004054B5DE), U64_C(0x00000000594F849F),
+        U64_C(0x00000000160E1258), U64_C(0x000000000F152319), U64_C(0x00000000243870DA), U64_C(0x000000003D23419B),
+        U64_C(0x0000000065FD6BA7), U64_C(0x000000007CE65AE6), U64_C(0x0000000057CB0925), U64_C(0x000000004ED03864),
+        U64_C(0x000000000191AEA3), U64_C(0x00000000188A9FE2), U64_C(0x0000000033A7CC21), U64_C(0x000000002ABCFD60),
+        U64_C(0x00000000AD24E1AF), U64_C(0x00000000B43FD0EE), U64_C(0x000000009F12832D), U64_C(0x000000008609B26C),
+        U64_C(0x00000000C94824AB), U64_C(0x00000000D05315EA), U64_C(0x00000000FB7E4629), U64_C(0x00000000E2657768),
+        U64_C(0x000000002F3F79F6), U64_C(0x00000000362448B7), U64_C(0x000000001D091B74), U64_C(0x0000000004122A35),
+        U64_C(0x000000004B53BCF2), U64_C(0x0000000052488DB3), U64_C(0x000000007965DE70), U64_C(0x00000000607EEF31),
+        U64_C(0x00000000E7E6F3FE), U64_C(0x00000000FEFDC2BF), U64_C(0x00000000D5D0917C), U64_C(0x00000000CCCBA03D),
+        U64_C(0x00000000838A36FA), U64_C(0x000000009A9107BB), U64_C(0x00000000B1BC5478), U64_C(0x00000000A8A76539),
+        U64_C(0x000000003B83984B), U64_C(0x000000002298A90A), U64_C(0x0000000009B5FAC9), U64_C(0x0000000010AECB88),
+        U64_C(0x000000005FEF5D4F), U64_C(0x0000000046F46C0E), U64_C(0x000000006DD93FCD), U64_C(0x0000000074C20E8C),
+        U64_C(0x00000000F35A1243), U64_C(0x00000000EA412302), U64_C(0x00000000C16C70C1), U64_C(0x00000000D8774180),
+        U64_C(0x000000009736D747), U64_C(0x000000008E2DE606), U64_C(0x00000000A500B5C5), U64_C(0x00000000BC1B8484),
+        U64_C(0x0000000071418A1A), U64_C(0x00000000685ABB5B), U64_C(0x000000004377E898), U64_C(0x000000005A6CD9D9),
+        U64_C(0x00000000152D4F1E), U64_C(0x000000000C367E5F), U64_C(0x00000000271B2D9C), U64_C(0x000000003E001CDD),
+        U64_C(0x00000000B9980012), U64_C(0x00000000A0833153), U64_C(0x000000008BAE6290), U64_C(0x0000000092B553D1),
+        U64_C(0x00000000DDF4C516), U64_C(0x00000000C4EFF457), U64_C(0x00000000EFC2A794), U64_C(0x00000000F6D996D5),
+        U64_C(0x00000000AE07BCE9), U64_C(0x00000000B71C8DA8), U64_C(0x000000009C31DE6B), U64_C(0x00000000852AEF2A),
+        U64_C(0x00000000CA6B79ED), U64_C(0x00000000D37048AC), U64_C(0x00000000F85D1B6F), U64_C(0x00000000E1462A2E),
+        U64_C(0x0000000066DE36E1), U64_C(0x000000007FC507A0), U64_C(0x0000000054E85463), U64_C(0x000000004DF36522),
+        U64_C(0x0000000002B2F3E5), U64_C(0x000000001BA9C2A4), U64_C(0x0000000030849167), U64_C(0x00000000299FA026),
+        U64_C(0x00000000E4C5AEB8), U64_C(0x00000000FDDE9FF9), U64_C(0x00000000D6F3CC3A), U64_C(0x00000000CFE8FD7B),
+        U64_C(0x0000000080A96BBC), U64_C(0x0000000099B25AFD), U64_C(0x00000000B29F093E), U64_C(0x00000000AB84387F),
+        U64_C(0x000000002C1C24B0), U64_C(0x00000000350715F1), U64_C(0x000000001E2A4632), U64_C(0x0000000007317773),
+        U64_C(0x000000004870E1B4), U64_C(0x00000000516BD0F5), U64_C(0x000000007A468336), U64_C(0x00000000635DB277),
+        U64_C(0x00000000CBFAD74E), U64_C(0x00000000D2E1E60F), U64_C(0x00000000F9CCB5CC), U64_C(0x00000000E0D7848D),
+        U64_C(0x00000000AF96124A), U64_C(0x00000000B68D230B), U64_C(0x000000009DA070C8), U64_C(0x0000000084BB4189),
+        U64_C(0x0000000003235D46), U64_C(0x000000001A386C07), U64_C(0x0000000031153FC4), U64_C(0x00000000280E0E85),
+        U64_C(0x00000000674F9842), U64_C(0x000000007E54A903), U64_C(0x000000005579FAC0), U64_C(0x000000004C62CB81),
+        U64_C(0x000000008138C51F), U64_C(0x000000009823F45E), U64_C(0x00000000B30EA79D), U64_C(0x00000000AA1596DC),
+        U64_C(0x00000000E554001B), U64_C(0x00000000FC4F315A), U64_C(0x00000000D7626299), U64_C(0x00000000CE7953D8),
+        U64_C(0x0000000049E14F17), U64_C(0x0000000050FA7E56), U64_C(0x000000007BD72D95), U64_C(0x0000000062CC1CD4),
+        U64_C(0x000000002D8D8A13), U64_C(0x000000003496BB52), U64_C(0x000000001FBBE891), U64_C(0x0000000006A0D9D0),
+        U64_C(0x000000005E7EF3EC), U64_C(0x000000004765C2AD), U64_C(0x000000006C48916E), U64_C(0x000000007553A02F),
+        U64_C(0x000000003A1236E8), U64_C(0x00000000230907A9), U64_C(0x000000000824546A), U64_C(0x00000000113F652B),
+        U64_C(0x0000000096A779E4), U64_C(0x000000008FBC48A5), U64_C(0x00000000A4911B66), U64_C(0x00000000BD8A2A27),
+        U64_C(0x00000000F2CBBCE0), U64_C(0x00000000EBD08DA1), U64_C(0x00000000C0FDDE62), U64_C(0x00000000D9E6EF23),
+        U64_C(0x0000000014BCE1BD), U64_C(0x000000000DA7D0FC), U64_C(0x00000000268A833F), U64_C(0x000000003F91B27E),
+        U64_C(0x0000000070D024B9), U64_C(0x0000000069CB15F8), U64_C(0x0000000042E6463B), U64_C(0x000000005BFD777A),
+        U64_C(0x00000000DC656BB5), U64_C(0x00000000C57E5AF4), U64_C(0x00000000EE530937), U64_C(0x00000000F7483876),
+        U64_C(0x00000000B809AEB1), U64_C(0x00000000A1129FF0), U64_C(0x000000008A3FCC33), U64_C(0x000000009324FD72),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x0000000001C26A37), U64_C(0x000000000384D46E), U64_C(0x000000000246BE59),
+        U64_C(0x000000000709A8DC), U64_C(0x0000000006CBC2EB), U64_C(0x00000000048D7CB2), U64_C(0x00000000054F1685),
+        U64_C(0x000000000E1351B8), U64_C(0x000000000FD13B8F), U64_C(0x000000000D9785D6), U64_C(0x000000000C55EFE1),
+        U64_C(0x00000000091AF964), U64_C(0x0000000008D89353), U64_C(0x000000000A9E2D0A), U64_C(0x000000000B5C473D),
+        U64_C(0x000000001C26A370), U64_C(0x000000001DE4C947), U64_C(0x000000001FA2771E), U64_C(0x000000001E601D29),
+        U64_C(0x000000001B2F0BAC), U64_C(0x000000001AED619B), U64_C(0x0000000018ABDFC2), U64_C(0x000000001969B5F5),
+        U64_C(0x000000001235F2C8), U64_C(0x0000000013F798FF), U64_C(0x0000000011B126A6), U64_C(0x0000000010734C91),
+        U64_C(0x00000000153C5A14), U64_C(0x0000000014FE3023), U64_C(0x0000000016B88E7A), U64_C(0x00000000177AE44D),
+        U64_C(0x00000000384D46E0), U64_C(0x00000000398F2CD7), U64_C(0x000000003BC9928E), U64_C(0x000000003A0BF8B9),
+        U64_C(0x000000003F44EE3C), U64_C(0x000000003E86840B), U64_C(0x000000003CC03A52), U64_C(0x000000003D025065),
+        U64_C(0x00000000365E1758), U64_C(0x00000000379C7D6F), U64_C(0x0000000035DAC336), U64_C(0x000000003418A901),
+        U64_C(0x000000003157BF84), U64_C(0x000000003095D5B3), U64_C(0x0000000032D36BEA), U64_C(0x00000000331101DD),
+        U64_C(0x00000000246BE590), U64_C(0x0000000025A98FA7), U64_C(0x0000000027EF31FE), U64_C(0x00000000262D5BC9),
+        U64_C(0x0000000023624D4C), U64_C(0x0000000022A0277B), U64_C(0x0000000020E69922), U64_C(0x000000002124F315),
+        U64_C(0x000000002A78B428), U64_C(0x000000002BBADE1F), U64_C(0x0000000029FC6046), U64_C(0x00000000283E0A71),
+        U64_C(0x000000002D711CF4), U64_C(0x000000002CB376C3), U64_C(0x000000002EF5C89A), U64_C(0x000000002F37A2AD),
+        U64_C(0x00000000709A8DC0), U64_C(0x000000007158E7F7), U64_C(0x00000000731E59AE), U64_C(0x0000000072DC3399),
+        U64_C(0x000000007793251C), U64_C(0x0000000076514F2B), U64_C(0x000000007417F172), U64_C(0x0000000075D59B45),
+        U64_C(0x000000007E89DC78), U64_C(0x000000007F4BB64F), U64_C(0x000000007D0D0816), U64_C(0x000000007CCF6221),
+        U64_C(0x00000000798074A4), U64_C(0x0000000078421E93), U64_C(0x000000007A04A0CA), U64_C(0x000000007BC6CAFD),
+        U64_C(0x000000006CBC2EB0), U64_C(0x000000006D7E4487), U64_C(0x000000006F38FADE), U64_C(0x000000006EFA90E9),
+        U64_C(0x000000006BB5866C), U64_C(0x000000006A77EC5B), U64_C(0x0000000068315202), U64_C(0x0000000069F33835),
+        U64_C(0x0000000062AF7F08), U64_C(0x00000000636D153F), U64_C(0x00000000612BAB66), U64_C(0x0000000060E9C151),
+        U64_C(0x0000000065A6D7D4), U64_C(0x000000006464BDE3), U64_C(0x00000000662203BA), U64_C(0x0000000067E0698D),
+        U64_C(0x0000000048D7CB20), U64_C(0x000000004915A117), U64_C(0x000000004B531F4E), U64_C(0x000000004A917579),
+        U64_C(0x000000004FDE63FC), U64_C(0x000000004E1C09CB), U64_C(0x000000004C5AB792), U64_C(0x000000004D98DDA5),
+        U64_C(0x0000000046C49A98), U64_C(0x000000004706F0AF), U64_C(0x0000000045404EF6), U64_C(0x00000000448224C1),
+        U64_C(0x0000000041CD3244), U64_C(0x00000000400F5873), U64_C(0x000000004249E62A), U64_C(0x00000000438B8C1D),
+        U64_C(0x0000000054F16850), U64_C(0x0000000055330267), U64_C(0x000000005775BC3E), U64_C(0x0000000056B7D609),
+        U64_C(0x0000000053F8C08C), U64_C(0x00000000523AAABB), U64_C(0x00000000507C14E2), U64_C(0x0000000051BE7ED5),
+        U64_C(0x000000005AE239E8), U64_C(0x000000005B2053DF), U64_C(0x000000005966ED86), U64_C(0x0000000058A487B1),
+        U64_C(0x000000005DEB9134), U64_C(0x000000005C29FB03), U64_C(0x000000005E6F455A), U64_C(0x000000005FAD2F6D),
+        U64_C(0x00000000E1351B80), U64_C(0x00000000E0F771B7), U64_C(0x00000000E2B1CFEE), U64_C(0x00000000E373A5D9),
+        U64_C(0x00000000E63CB35C), U64_C(0x00000000E7FED96B), U64_C(0x00000000E5B86732), U64_C(0x00000000E47A0D05),
+        U64_C(0x00000000EF264A38), U64_C(0x00000000EEE4200F), U64_C(0x00000000ECA29E56), U64_C(0x00000000ED60F461),
+        U64_C(0x00000000E82FE2E4), U64_C(0x00000000E9ED88D3), U64_C(0x00000000EBAB368A), U64_C(0x00000000EA695CBD),
+        U64_C(0x00000000FD13B8F0), U64_C(0x00000000FCD1D2C7), U64_C(0x00000000FE976C9E), U64_C(0x00000000FF5506A9),
+        U64_C(0x00000000FA1A102C), U64_C(0x00000000FBD87A1B), U64_C(0x00000000F99EC442), U64_C(0x00000000F85CAE75),
+        U64_C(0x00000000F300E948), U64_C(0x00000000F2C2837F), U64_C(0x00000000F0843D26), U64_C(0x00000000F1465711),
+        U64_C(0x00000000F4094194), U64_C(0x00000000F5CB2BA3), U64_C(0x00000000F78D95FA), U64_C(0x00000000F64FFFCD),
+        U64_C(0x00000000D9785D60), U64_C(0x00000000D8BA3757), U64_C(0x00000000DAFC890E), U64_C(0x00000000DB3EE339),
+        U64_C(0x00000000DE71F5BC), U64_C(0x00000000DFB39F8B), U64_C(0x00000000DDF521D2), U64_C(0x00000000DC374BE5),
+        U64_C(0x00000000D76B0CD8), U64_C(0x00000000D6A966EF), U64_C(0x00000000D4EFD8B6), U64_C(0x00000000D52DB281),
+        U64_C(0x00000000D062A404), U64_C(0x00000000D1A0CE33), U64_C(0x00000000D3E6706A), U64_C(0x00000000D2241A5D),
+        U64_C(0x00000000C55EFE10), U64_C(0x00000000C49C9427), U64_C(0x00000000C6DA2A7E), U64_C(0x00000000C7184049),
+        U64_C(0x00000000C25756CC), U64_C(0x00000000C3953CFB), U64_C(0x00000000C1D382A2), U64_C(0x00000000C011E895),
+        U64_C(0x00000000CB4DAFA8), U64_C(0x00000000CA8FC59F), U64_C(0x00000000C8C97BC6), U64_C(0x00000000C90B11F1),
+        U64_C(0x00000000CC440774), U64_C(0x00000000CD866D43), U64_C(0x00000000CFC0D31A), U64_C(0x00000000CE02B92D),
+        U64_C(0x0000000091AF9640), U64_C(0x00000000906DFC77), U64_C(0x00000000922B422E), U64_C(0x0000000093E92819),
+        U64_C(0x0000000096A63E9C), U64_C(0x00000000976454AB), U64_C(0x000000009522EAF2), U64_C(0x0000000094E080C5),
+        U64_C(0x000000009FBCC7F8), U64_C(0x000000009E7EADCF), U64_C(0x000000009C381396), U64_C(0x000000009DFA79A1),
+        U64_C(0x0000000098B56F24), U64_C(0x0000000099770513), U64_C(0x000000009B31BB4A), U64_C(0x000000009AF3D17D),
+        U64_C(0x000000008D893530), U64_C(0x000000008C4B5F07), U64_C(0x000000008E0DE15E), U64_C(0x000000008FCF8B69),
+        U64_C(0x000000008A809DEC), U64_C(0x000000008B42F7DB), U64_C(0x0000000089044982), U64_C(0x0000000088C623B5),
+        U64_C(0x00000000839A6488), U64_C(0x0000000082580EBF), U64_C(0x00000000801EB0E6), U64_C(0x0000000081DCDAD1),
+        U64_C(0x000000008493CC54), U64_C(0x000000008551A663), U64_C(0x000000008717183A), U64_C(0x0000000086D5720D),
+        U64_C(0x00000000A9E2D0A0), U64_C(0x00000000A820BA97), U64_C(0x00000000AA6604CE), U64_C(0x00000000ABA46EF9),
+        U64_C(0x00000000AEEB787C), U64_C(0x00000000AF29124B), U64_C(0x00000000AD6FAC12), U64_C(0x00000000ACADC625),
+        U64_C(0x00000000A7F18118), U64_C(0x00000000A633EB2F), U64_C(0x00000000A4755576), U64_C(0x00000000A5B73F41),
+        U64_C(0x00000000A0F829C4), U64_C(0x00000000A13A43F3), U64_C(0x00000000A37CFDAA), U64_C(0x00000000A2BE979D),
+        U64_C(0x00000000B5C473D0), U64_C(0x00000000B40619E7), U64_C(0x00000000B640A7BE), U64_C(0x00000000B782CD89),
+        U64_C(0x00000000B2CDDB0C), U64_C(0x00000000B30FB13B), U64_C(0x00000000B1490F62), U64_C(0x00000000B08B6555),
+        U64_C(0x00000000BBD72268), U64_C(0x00000000BA15485F), U64_C(0x00000000B853F606), U64_C(0x00000000B9919C31),
+        U64_C(0x00000000BCDE8AB4), U64_C(0x00000000BD1CE083), U64_C(0x00000000BF5A5EDA), U64_C(0x00000000BE9834ED),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x00000000B8BC6765), U64_C(0x00000000AA09C88B), U64_C(0x0000000012B5AFEE),
+        U64_C(0x000000008F629757), U64_C(0x0000000037DEF032), U64_C(0x00000000256B5FDC), U64_C(0x000000009DD738B9),
+        U64_C(0x00000000C5B428EF), U64_C(0x000000007D084F8A), U64_C(0x000000006FBDE064), U64_C(0x00000000D7018701),
+        U64_C(0x000000004AD6BFB8), U64_C(0x00000000F26AD8DD), U64_C(0x00000000E0DF7733), U64_C(0x0000000058631056),
+        U64_C(0x000000005019579F), U64_C(0x00000000E8A530FA), U64_C(0x00000000FA109F14), U64_C(0x0000000042ACF871),
+        U64_C(0x00000000DF7BC0C8), U64_C(0x0000000067C7A7AD), U64_C(0x0000000075720843), U64_C(0x00000000CDCE6F26),
+        U64_C(0x0000000095AD7F70), U64_C(0x000000002D111815), U64_C(0x000000003FA4B7FB), U64_C(0x000000008718D09E),
+        U64_C(0x000000001ACFE827), U64_C(0x00000000A2738F42), U64_C(0x00000000B0C620AC), U64_C(0x00000000087A47C9),
+        U64_C(0x00000000A032AF3E), U64_C(0x00000000188EC85B), U64_C(0x000000000A3B67B5), U64_C(0x00000000B28700D0),
+        U64_C(0x000000002F503869), U64_C(0x0000000097EC5F0C), U64_C(0x000000008559F0E2), U64_C(0x000000003DE59787),
+        U64_C(0x00000000658687D1), U64_C(0x00000000DD3AE0B4), U64_C(0x00000000CF8F4F5A), U64_C(0x000000007733283F),
+        U64_C(0x00000000EAE41086), U64_C(0x00000000525877E3), U64_C(0x0000000040EDD80D), U64_C(0x00000000F851BF68),
+        U64_C(0x00000000F02BF8A1), U64_C(0x0000000048979FC4), U64_C(0x000000005A22302A), U64_C(0x00000000E29E574F),
+        U64_C(0x000000007F496FF6), U64_C(0x00000000C7F50893), U64_C(0x00000000D540A77D), U64_C(0x000000006DFCC018),
+        U64_C(0x00000000359FD04E), U64_C(0x000000008D23B72B), U64_C(0x000000009F9618C5), U64_C(0x00000000272A7FA0),
+        U64_C(0x00000000BAFD4719), U64_C(0x000000000241207C), U64_C(0x0000000010F48F92), U64_C(0x00000000A848E8F7),
+        U64_C(0x000000009B14583D), U64_C(0x0000000023A83F58), U64_C(0x00000000311D90B6), U64_C(0x0000000089A1F7D3),
+        U64_C(0x000000001476CF6A), U64_C(0x00000000ACCAA80F), U64_C(0x00000000BE7F07E1), U64_C(0x0000000006C36084),
+        U64_C(0x000000005EA070D2), U64_C(0x00000000E61C17B7), U64_C(0x00000000F4A9B859), U64_C(0x000000004C15DF3C),
+        U64_C(0x00000000D1C2E785), U64_C(0x00000000697E80E0), U64_C(0x000000007BCB2F0E), U64_C(0x00000000C377486B),
+        U64_C(0x00000000CB0D0FA2), U64_C(0x0000000073B168C7), U64_C(0x000000006104C729), U64_C(0x00000000D9B8A04C),
+        U64_C(0x00000000446F98F5), U64_C(0x00000000FCD3FF90), U64_C(0x00000000EE66507E), U64_C(0x0000000056DA371B),
+        U64_C(0x000000000EB9274D), U64_C(0x00000000B6054028), U64_C(0x00000000A4B0EFC6), U64_C(0x000000001C0C88A3),
+        U64_C(0x0000000081DBB01A), U64_C(0x000000003967D77F), U64_C(0x000000002BD27891), U64_C(0x00000000936E1FF4),
+        U64_C(0x000000003B26F703), U64_C(0x00000000839A9066), U64_C(0x00000000912F3F88), U64_C(0x00000000299358ED),
+        U64_C(0x00000000B4446054), U64_C(0x000000000CF80731), U64_C(0x000000001E4DA8DF), U64_C(0x00000000A6F1CFBA),
+        U64_C(0x00000000FE92DFEC), U64_C(0x00000000462EB889), U64_C(0x00000000549B1767), U64_C(0x00000000EC277002),
+        U64_C(0x0000000071F048BB), U64_C(0x00000000C94C2FDE), U64_C(0x00000000DBF98030), U64_C(0x000000006345E755),
+        U64_C(0x000000006B3FA09C), U64_C(0x00000000D383C7F9), U64_C(0x00000000C1366817), U64_C(0x00000000798A0F72),
+        U64_C(0x00000000E45D37CB), U64_C(0x000000005CE150AE), U64_C(0x000000004E54FF40), U64_C(0x00000000F6E89825),
+        U64_C(0x00000000AE8B8873), U64_C(0x000000001637EF16), U64_C(0x00000000048240F8), U64_C(0x00000000BC3E279D),
+        U64_C(0x0000000021E91F24), U64_C(0x0000000099557841), U64_C(0x000000008BE0D7AF), U64_C(0x00000000335CB0CA),
+        U64_C(0x00000000ED59B63B), U64_C(0x0000000055E5D15E), U64_C(0x0000000047507EB0), U64_C(0x00000000FFEC19D5),
+        U64_C(0x00000000623B216C), U64_C(0x00000000DA874609), U64_C(0x00000000C832E9E7), U64_C(0x00000000708E8E82),
+        U64_C(0x0000000028ED9ED4), U64_C(0x000000009051F9B1), U64_C(0x0000000082E4565F), U64_C(0x000000003A58313A),
+        U64_C(0x00000000A78F0983), U64_C(0x000000001F336EE6), U64_C(0x000000000D86C108), U64_C(0x00000000B53AA66D),
+        U64_C(0x00000000BD40E1A4), U64_C(0x0000000005FC86C1), U64_C(0x000000001749292F), U64_C(0x00000000AFF54E4A),
+        U64_C(0x00000000322276F3), U64_C(0x000000008A9E1196), U64_C(0x00000000982BBE78), U64_C(0x000000002097D91D),
+        U64_C(0x0000000078F4C94B), U64_C(0x00000000C048AE2E), U64_C(0x00000000D2FD01C0), U64_C(0x000000006A4166A5),
+        U64_C(0x00000000F7965E1C), U64_C(0x000000004F2A3979), U64_C(0x000000005D9F9697), U64_C(0x00000000E523F1F2),
+        U64_C(0x000000004D6B1905), U64_C(0x00000000F5D77E60), U64_C(0x00000000E762D18E), U64_C(0x000000005FDEB6EB),
+        U64_C(0x00000000C2098E52), U64_C(0x000000007AB5E937), U64_C(0x00000000680046D9), U64_C(0x00000000D0BC21BC),
+        U64_C(0x0000000088DF31EA), U64_C(0x000000003063568F), U64_C(0x0000000022D6F961), U64_C(0x000000009A6A9E04),
+        U64_C(0x0000000007BDA6BD), U64_C(0x00000000BF01C1D8), U64_C(0x00000000ADB46E36), U64_C(0x0000000015080953),
+        U64_C(0x000000001D724E9A), U64_C(0x00000000A5CE29FF), U64_C(0x00000000B77B8611), U64_C(0x000000000FC7E174),
+        U64_C(0x000000009210D9CD), U64_C(0x000000002AACBEA8), U64_C(0x0000000038191146), U64_C(0x0000000080A57623),
+        U64_C(0x00000000D8C66675), U64_C(0x00000000607A0110), U64_C(0x0000000072CFAEFE), U64_C(0x00000000CA73C99B),
+        U64_C(0x0000000057A4F122), U64_C(0x00000000EF189647), U64_C(0x00000000FDAD39A9), U64_C(0x0000000045115ECC),
+        U64_C(0x00000000764DEE06), U64_C(0x00000000CEF18963), U64_C(0x00000000DC44268D), U64_C(0x0000000064F841E8),
+        U64_C(0x00000000F92F7951), U64_C(0x0000000041931E34), U64_C(0x000000005326B1DA), U64_C(0x00000000EB9AD6BF),
+        U64_C(0x00000000B3F9C6E9), U64_C(0x000000000B45A18C), U64_C(0x0000000019F00E62), U64_C(0x00000000A14C6907),
+        U64_C(0x000000003C9B51BE), U64_C(0x00000000842736DB), U64_C(0x0000000096929935), U64_C(0x000000002E2EFE50),
+        U64_C(0x000000002654B999), U64_C(0x000000009EE8DEFC), U64_C(0x000000008C5D7112), U64_C(0x0000000034E11677),
+        U64_C(0x00000000A9362ECE), U64_C(0x00000000118A49AB), U64_C(0x00000000033FE645), U64_C(0x00000000BB838120),
+        U64_C(0x00000000E3E09176), U64_C(0x000000005B5CF613), U64_C(0x0000000049E959FD), U64_C(0x00000000F1553E98),
+        U64_C(0x000000006C820621), U64_C(0x00000000D43E6144), U64_C(0x00000000C68BCEAA), U64_C(0x000000007E37A9CF),
+        U64_C(0x00000000D67F4138), U64_C(0x000000006EC3265D), U64_C(0x000000007C7689B3), U64_C(0x00000000C4CAEED6),
+        U64_C(0x00000000591DD66F), U64_C(0x00000000E1A1B10A), U64_C(0x00000000F3141EE4), U64_C(0x000000004BA87981),
+        U64_C(0x0000000013CB69D7), U64_C(0x00000000AB770EB2), U64_C(0x00000000B9C2A15C), U64_C(0x00000000017EC639),
+        U64_C(0x000000009CA9FE80), U64_C(0x00000000241599E5), U64_C(0x0000000036A0360B), U64_C(0x000000008E1C516E),
+        U64_C(0x00000000866616A7), U64_C(0x000000003EDA71C2), U64_C(0x000000002C6FDE2C), U64_C(0x0000000094D3B949),
+        U64_C(0x00000000090481F0), U64_C(0x00000000B1B8E695), U64_C(0x00000000A30D497B), U64_C(0x000000001BB12E1E),
+        U64_C(0x0000000043D23E48), U64_C(0x00000000FB6E592D), U64_C(0x00000000E9DBF6C3), U64_C(0x00000000516791A6),
+        U64_C(0x00000000CCB0A91F), U64_C(0x00000000740CCE7A), U64_C(0x0000000066B96194), U64_C(0x00000000DE0506F1),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x000000003D6029B0), U64_C(0x000000007AC05360), U64_C(0x0000000047A07AD0),
+        U64_C(0x00000000F580A6C0), U64_C(0x00000000C8E08F70), U64_C(0x000000008F40F5A0), U64_C(0x00000000B220DC10),
+        U64_C(0x0000000030704BC1), U64_C(0x000000000D106271), U64_C(0x000000004AB018A1), U64_C(0x0000000077D03111),
+        U64_C(0x00000000C5F0ED01), U64_C(0x00000000F890C4B1), U64_C(0x00000000BF30BE61), U64_C(0x00000000825097D1),
+        U64_C(0x0000000060E09782), U64_C(0x000000005D80BE32), U64_C(0x000000001A20C4E2), U64_C(0x000000002740ED52),
+        U64_C(0x0000000095603142), U64_C(0x00000000A80018F2), U64_C(0x00000000EFA06222), U64_C(0x00000000D2C04B92),
+        U64_C(0x000000005090DC43), U64_C(0x000000006DF0F5F3), U64_C(0x000000002A508F23), U64_C(0x000000001730A693),
+        U64_C(0x00000000A5107A83), U64_C(0x0000000098705333), U64_C(0x00000000DFD029E3), U64_C(0x00000000E2B00053),
+        U64_C(0x00000000C1C12F04), U64_C(0x00000000FCA106B4), U64_C(0x00000000BB017C64), U64_C(0x00000000866155D4),
+        U64_C(0x00000000344189C4), U64_C(0x000000000921A074), U64_C(0x000000004E81DAA4), U64_C(0x0000000073E1F314),
+        U64_C(0x00000000F1B164C5), U64_C(0x00000000CCD14D75), U64_C(0x000000008B7137A5), U64_C(0x00000000B6111E15),
+        U64_C(0x000000000431C205), U64_C(0x000000003951EBB5), U64_C(0x000000007EF19165), U64_C(0x000000004391B8D5),
+        U64_C(0x00000000A121B886), U64_C(0x000000009C419136), U64_C(0x00000000DBE1EBE6), U64_C(0x00000000E681C256),
+        U64_C(0x0000000054A11E46), U64_C(0x0000000069C137F6), U64_C(0x000000002E614D26), U64_C(0x0000000013016496),
+        U64_C(0x000000009151F347), U64_C(0x00000000AC31DAF7), U64_C(0x00000000EB91A027), U64_C(0x00000000D6F18997),
+        U64_C(0x0000000064D15587), U64_C(0x0000000059B17C37), U64_C(0x000000001E1106E7), U64_C(0x0000000023712F57),
+        U64_C(0x0000000058F35849), U64_C(0x00000000659371F9), U64_C(0x0000000022330B29), U64_C(0x000000001F532299),
+        U64_C(0x00000000AD73FE89), U64_C(0x000000009013D739), U64_C(0x00000000D7B3ADE9), U64_C(0x00000000EAD38459),
+        U64_C(0x0000000068831388), U64_C(0x0000000055E33A38), U64_C(0x00000000124340E8), U64_C(0x000000002F236958),
+        U64_C(0x000000009D03B548), U64_C(0x00000000A0639CF8), U64_C(0x00000000E7C3E628), U64_C(0x00000000DAA3CF98),
+        U64_C(0x000000003813CFCB), U64_C(0x000000000573E67B), U64_C(0x0000000042D39CAB), U64_C(0x000000007FB3B51B),
+        U64_C(0x00000000CD93690B), U64_C(0x00000000F0F340BB), U64_C(0x00000000B7533A6B), U64_C(0x000000008A3313DB),
+        U64_C(0x000000000863840A), U64_C(0x000000003503ADBA), U64_C(0x0000000072A3D76A), U64_C(0x000000004FC3FEDA),
+        U64_C(0x00000000FDE322CA), U64_C(0x00000000C0830B7A), U64_C(0x00000000872371AA), U64_C(0x00000000BA43581A),
+        U64_C(0x000000009932774D), U64_C(0x00000000A4525EFD), U64_C(0x00000000E3F2242D), U64_C(0x00000000DE920D9D),
+        U64_C(0x000000006CB2D18D), U64_C(0x0000000051D2F83D), U64_C(0x00000000167282ED), U64_C(0x000000002B12AB5D),
+        U64_C(0x00000000A9423C8C), U64_C(0x000000009422153C), U64_C(0x00000000D3826FEC), U64_C(0x00000000EEE2465C),
+        U64_C(0x000000005CC29A4C), U64_C(0x0000000061A2B3FC), U64_C(0x000000002602C92C), U64_C(0x000000001B62E09C),
+        U64_C(0x00000000F9D2E0CF), U64_C(0x00000000C4B2C97F), U64_C(0x000000008312B3AF), U64_C(0x00000000BE729A1F),
+        U64_C(0x000000000C52460F), U64_C(0x0000000031326FBF), U64_C(0x000000007692156F), U64_C(0x000000004BF23CDF),
+        U64_C(0x00000000C9A2AB0E), U64_C(0x00000000F4C282BE), U64_C(0x00000000B362F86E), U64_C(0x000000008E02D1DE),
+        U64_C(0x000000003C220DCE), U64_C(0x000000000142247E), U64_C(0x0000000046E25EAE), U64_C(0x000000007B82771E),
+        U64_C(0x00000000B1E6B092), U64_C(0x000000008C869922), U64_C(0x00000000CB26E3F2), U64_C(0x00000000F646CA42),
+        U64_C(0x0000000044661652), U64_C(0x0000000079063FE2), U64_C(0x000000003EA64532), U64_C(0x0000000003C66C82),
+        U64_C(0x000000008196FB53), U64_C(0x00000000BCF6D2E3), U64_C(0x00000000FB56A833), U64_C(0x00000000C6368183),
+        U64_C(0x0000000074165D93), U64_C(0x0000000049767423), U64_C(0x000000000ED60EF3), U64_C(0x0000000033B62743),
+        U64_C(0x00000000D1062710), U64_C(0x00000000EC660EA0), U64_C(0x00000000ABC67470), U64_C(0x0000000096A65DC0),
+        U64_C(0x00000000248681D0), U64_C(0x0000000019E6A860), U64_C(0x000000005E46D2B0), U64_C(0x000000006326FB00),
+        U64_C(0x00000000E1766CD1), U64_C(0x00000000DC164561), U64_C(0x000000009BB63FB1), U64_C(0x00000000A6D61601),
+        U64_C(0x0000000014F6CA11), U64_C(0x000000002996E3A1), U64_C(0x000000006E369971), U64_C(0x000000005356B0C1),
+        U64_C(0x0000000070279F96), U64_C(0x000000004D47B626), U64_C(0x000000000AE7CCF6), U64_C(0x000000003787E546),
+        U64_C(0x0000000085A73956), U64_C(0x00000000B8C710E6), U64_C(0x00000000FF676A36), U64_C(0x00000000C2074386),
+        U64_C(0x000000004057D457), U64_C(0x000000007D37FDE7), U64_C(0x000000003A978737), U64_C(0x0000000007F7AE87),
+        U64_C(0x00000000B5D77297), U64_C(0x0000000088B75B27), U64_C(0x00000000CF1721F7), U64_C(0x00000000F2770847),
+        U64_C(0x0000000010C70814), U64_C(0x000000002DA721A4), U64_C(0x000000006A075B74), U64_C(0x00000000576772C4),
+        U64_C(0x00000000E547AED4), U64_C(0x00000000D8278764), U64_C(0x000000009F87FDB4), U64_C(0x00000000A2E7D404),
+        U64_C(0x0000000020B743D5), U64_C(0x000000001DD76A65), U64_C(0x000000005A7710B5), U64_C(0x0000000067173905),
+        U64_C(0x00000000D537E515), U64_C(0x00000000E857CCA5), U64_C(0x00000000AFF7B675), U64_C(0x0000000092979FC5),
+        U64_C(0x00000000E915E8DB), U64_C(0x00000000D475C16B), U64_C(0x0000000093D5BBBB), U64_C(0x00000000AEB5920B),
+        U64_C(0x000000001C954E1B), U64_C(0x0000000021F567AB), U64_C(0x0000000066551D7B), U64_C(0x000000005B3534CB),
+        U64_C(0x00000000D965A31A), U64_C(0x00000000E4058AAA), U64_C(0x00000000A3A5F07A), U64_C(0x000000009EC5D9CA),
+        U64_C(0x000000002CE505DA), U64_C(0x0000000011852C6A), U64_C(0x00000000562556BA), U64_C(0x000000006B457F0A),
+        U64_C(0x0000000089F57F59), U64_C(0x00000000B49556E9), U64_C(0x00000000F3352C39), U64_C(0x00000000CE550589),
+        U64_C(0x000000007C75D999), U64_C(0x000000004115F029), U64_C(0x0000000006B58AF9), U64_C(0x000000003BD5A349),
+        U64_C(0x00000000B9853498), U64_C(0x0000000084E51D28), U64_C(0x00000000C34567F8), U64_C(0x00000000FE254E48),
+        U64_C(0x000000004C059258), U64_C(0x000000007165BBE8), U64_C(0x0000000036C5C138), U64_C(0x000000000BA5E888),
+        U64_C(0x0000000028D4C7DF), U64_C(0x0000000015B4EE6F), U64_C(0x00000000521494BF), U64_C(0x000000006F74BD0F),
+        U64_C(0x00000000DD54611F), U64_C(0x00000000E03448AF), U64_C(0x00000000A794327F), U64_C(0x000000009AF41BCF),
+        U64_C(0x0000000018A48C1E), U64_C(0x0000000025C4A5AE), U64_C(0x000000006264DF7E), U64_C(0x000000005F04F6CE),
+        U64_C(0x00000000ED242ADE), U64_C(0x00000000D044036E), U64_C(0x0000000097E479BE), U64_C(0x00000000AA84500E),
+        U64_C(0x000000004834505D), U64_C(0x00000000755479ED), U64_C(0x0000000032F4033D), U64_C(0x000000000F942A8D),
+        U64_C(0x00000000BDB4F69D), U64_C(0x0000000080D4DF2D), U64_C(0x00000000C774A5FD), U64_C(0x00000000FA148C4D),
+        U64_C(0x0000000078441B9C), U64_C(0x000000004524322C), U64_C(0x00000000028448FC), U64_C(0x000000003FE4614C),
+        U64_C(0x000000008DC4BD5C), U64_C(0x00000000B0A494EC), U64_C(0x00000000F704EE3C), U64_C(0x00000000CA64C78C),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x00000000CB5CD3A5), U64_C(0x000000004DC8A10B), U64_C(0x00000000869472AE),
+        U64_C(0x000000009B914216), U64_C(0x0000000050CD91B3), U64_C(0x00000000D659E31D), U64_C(0x000000001D0530B8),
+        U64_C(0x00000000EC53826D), U64_C(0x00000000270F51C8), U64_C(0x00000000A19B2366), U64_C(0x000000006AC7F0C3),
+        U64_C(0x0000000077C2C07B), U64_C(0x00000000BC9E13DE), U64_C(0x000000003A0A6170), U64_C(0x00000000F156B2D5),
+        U64_C(0x0000000003D6029B), U64_C(0x00000000C88AD13E), U64_C(0x000000004E1EA390), U64_C(0x0000000085427035),
+        U64_C(0x000000009847408D), U64_C(0x00000000531B9328), U64_C(0x00000000D58FE186), U64_C(0x000000001ED33223),
+        U64_C(0x00000000EF8580F6), U64_C(0x0000000024D95353), U64_C(0x00000000A24D21FD), U64_C(0x000000006911F258),
+        U64_C(0x000000007414C2E0), U64_C(0x00000000BF481145), U64_C(0x0000000039DC63EB), U64_C(0x00000000F280B04E),
+        U64_C(0x0000000007AC0536), U64_C(0x00000000CCF0D693), U64_C(0x000000004A64A43D), U64_C(0x0000000081387798),
+        U64_C(0x000000009C3D4720), U64_C(0x0000000057619485), U64_C(0x00000000D1F5E62B), U64_C(0x000000001AA9358E),
+        U64_C(0x00000000EBFF875B), U64_C(0x0000000020A354FE), U64_C(0x00000000A6372650), U64_C(0x000000006D6BF5F5),
+        U64_C(0x00000000706EC54D), U64_C(0x00000000BB3216E8), U64_C(0x000000003DA66446), U64_C(0x00000000F6FAB7E3),
+        U64_C(0x00000000047A07AD), U64_C(0x00000000CF26D408), U64_C(0x0000000049B2A6A6), U64_C(0x0000000082EE7503),
+        U64_C(0x000000009FEB45BB), U64_C(0x0000000054B7961E), U64_C(0x00000000D223E4B0), U64_C(0x00000000197F3715),
+        U64_C(0x00000000E82985C0), U64_C(0x0000000023755665), U64_C(0x00000000A5E124CB), U64_C(0x000000006EBDF76E),
+        U64_C(0x0000000073B8C7D6), U64_C(0x00000000B8E41473), U64_C(0x000000003E7066DD), U64_C(0x00000000F52CB578),
+        U64_C(0x000000000F580A6C), U64_C(0x00000000C404D9C9), U64_C(0x000000004290AB67), U64_C(0x0000000089CC78C2),
+        U64_C(0x0000000094C9487A), U64_C(0x000000005F959BDF), U64_C(0x00000000D901E971), U64_C(0x00000000125D3AD4),
+        U64_C(0x00000000E30B8801), U64_C(0x0000000028575BA4), U64_C(0x00000000AEC3290A), U64_C(0x00000000659FFAAF),
+        U64_C(0x00000000789ACA17), U64_C(0x00000000B3C619B2), U64_C(0x0000000035526B1C), U64_C(0x00000000FE0EB8B9),
+        U64_C(0x000000000C8E08F7), U64_C(0x00000000C7D2DB52), U64_C(0x000000004146A9FC), U64_C(0x000000008A1A7A59),
+        U64_C(0x00000000971F4AE1), U64_C(0x000000005C439944), U64_C(0x00000000DAD7EBEA), U64_C(0x00000000118B384F),
+        U64_C(0x00000000E0DD8A9A), U64_C(0x000000002B81593F), U64_C(0x00000000AD152B91), U64_C(0x000000006649F834),
+        U64_C(0x000000007B4CC88C), U64_C(0x00000000B0101B29), U64_C(0x0000000036846987), U64_C(0x00000000FDD8BA22),
+        U64_C(0x0000000008F40F5A), U64_C(0x00000000C3A8DCFF), U64_C(0x00000000453CAE51), U64_C(0x000000008E607DF4),
+        U64_C(0x0000000093654D4C), U64_C(0x0000000058399EE9), U64_C(0x00000000DEADEC47), U64_C(0x0000000015F13FE2),
+        U64_C(0x00000000E4A78D37), U64_C(0x000000002FFB5E92), U64_C(0x00000000A96F2C3C), U64_C(0x000000006233FF99),
+        U64_C(0x000000007F36CF21), U64_C(0x00000000B46A1C84), U64_C(0x0000000032FE6E2A), U64_C(0x00000000F9A2BD8F),
+        U64_C(0x000000000B220DC1), U64_C(0x00000000C07EDE64), U64_C(0x0000000046EAACCA), U64_C(0x000000008DB67F6F),
+        U64_C(0x0000000090B34FD7), U64_C(0x000000005BEF9C72), U64_C(0x00000000DD7BEEDC), U64_C(0x0000000016273D79),
+        U64_C(0x00000000E7718FAC), U64_C(0x000000002C2D5C09), U64_C(0x00000000AAB92EA7), U64_C(0x0000000061E5FD02),
+        U64_C(0x000000007CE0CDBA), U64_C(0x00000000B7BC1E1F), U64_C(0x0000000031286CB1), U64_C(0x00000000FA74BF14),
+        U64_C(0x000000001EB014D8), U64_C(0x00000000D5ECC77D), U64_C(0x000000005378B5D3), U64_C(0x0000000098246676),
+        U64_C(0x00000000852156CE), U64_C(0x000000004E7D856B), U64_C(0x00000000C8E9F7C5), U64_C(0x0000000003B52460),
+        U64_C(0x00000000F2E396B5), U64_C(0x0000000039BF4510), U64_C(0x00000000BF2B37BE), U64_C(0x000000007477E41B),
+        U64_C(0x000000006972D4A3), U64_C(0x00000000A22E0706), U64_C(0x0000000024BA75A8), U64_C(0x00000000EFE6A60D),
+        U64_C(0x000000001D661643), U64_C(0x00000000D63AC5E6), U64_C(0x0000000050AEB748), U64_C(0x000000009BF264ED),
+        U64_C(0x0000000086F75455), U64_C(0x000000004DAB87F0), U64_C(0x00000000CB3FF55E), U64_C(0x00000000006326FB),
+        U64_C(0x00000000F135942E), U64_C(0x000000003A69478B), U64_C(0x00000000BCFD3525), U64_C(0x0000000077A1E680),
+        U64_C(0x000000006AA4D638), U64_C(0x00000000A1F8059D), U64_C(0x00000000276C7733), U64_C(0x00000000EC30A496),
+        U64_C(0x00000000191C11EE), U64_C(0x00000000D240C24B), U64_C(0x0000000054D4B0E5), U64_C(0x000000009F886340),
+        U64_C(0x00000000828D53F8), U64_C(0x0000000049D1805D), U64_C(0x00000000CF45F2F3), U64_C(0x0000000004192156),
+        U64_C(0x00000000F54F9383), U64_C(0x000000003E134026), U64_C(0x00000000B8873288), U64_C(0x0000000073DBE12D),
+        U64_C(0x000000006EDED195), U64_C(0x00000000A5820230), U64_C(0x000000002316709E), U64_C(0x00000000E84AA33B),
+        U64_C(0x000000001ACA1375), U64_C(0x00000000D196C0D0), U64_C(0x000000005702B27E), U64_C(0x000000009C5E61DB),
+        U64_C(0x00000000815B5163), U64_C(0x000000004A0782C6), U64_C(0x00000000CC93F068), U64_C(0x0000000007CF23CD),
+        U64_C(0x00000000F6999118), U64_C(0x000000003DC542BD), U64_C(0x00000000BB513013), U64_C(0x00000000700DE3B6),
+        U64_C(0x000000006D08D30E), U64_C(0x00000000A65400AB), U64_C(0x0000000020C07205), U64_C(0x00000000EB9CA1A0),
+        U64_C(0x0000000011E81EB4), U64_C(0x00000000DAB4CD11), U64_C(0x000000005C20BFBF), U64_C(0x00000000977C6C1A),
+        U64_C(0x000000008A795CA2), U64_C(0x0000000041258F07), U64_C(0x00000000C7B1FDA9), U64_C(0x000000000CED2E0C),
+        U64_C(0x00000000FDBB9CD9), U64_C(0x0000000036E74F7C), U64_C(0x00000000B0733DD2), U64_C(0x000000007B2FEE77),
+        U64_C(0x00000000662ADECF), U64_C(0x00000000AD760D6A), U64_C(0x000000002BE27FC4), U64_C(0x00000000E0BEAC61),
+        U64_C(0x00000000123E1C2F), U64_C(0x00000000D962CF8A), U64_C(0x000000005FF6BD24), U64_C(0x0000000094AA6E81),
+        U64_C(0x0000000089AF5E39), U64_C(0x0000000042F38D9C), U64_C(0x00000000C467FF32), U64_C(0x000000000F3B2C97),
+        U64_C(0x00000000FE6D9E42), U64_C(0x0000000035314DE7), U64_C(0x00000000B3A53F49), U64_C(0x0000000078F9ECEC),
+        U64_C(0x0000000065FCDC54), U64_C(0x00000000AEA00FF1), U64_C(0x0000000028347D5F), U64_C(0x00000000E368AEFA),
+        U64_C(0x0000000016441B82), U64_C(0x00000000DD18C827), U64_C(0x000000005B8CBA89), U64_C(0x0000000090D0692C),
+        U64_C(0x000000008DD55994), U64_C(0x0000000046898A31), U64_C(0x00000000C01DF89F), U64_C(0x000000000B412B3A),
+        U64_C(0x00000000FA1799EF), U64_C(0x00000000314B4A4A), U64_C(0x00000000B7DF38E4), U64_C(0x000000007C83EB41),
+        U64_C(0x000000006186DBF9), U64_C(0x00000000AADA085C), U64_C(0x000000002C4E7AF2), U64_C(0x00000000E712A957),
+        U64_C(0x0000000015921919), U64_C(0x00000000DECECABC), U64_C(0x00000000585AB812), U64_C(0x0000000093066BB7),
+        U64_C(0x000000008E035B0F), U64_C(0x00000000455F88AA), U64_C(0x00000000C3CBFA04), U64_C(0x00000000089729A1),
+        U64_C(0x00000000F9C19B74), U64_C(0x00000000329D48D1), U64_C(0x00000000B4093A7F), U64_C(0x000000007F55E9DA),
+        U64_C(0x000000006250D962), U64_C(0x00000000A90C0AC7), U64_C(0x000000002F987869), U64_C(0x00000000E4C4ABCC),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x00000000A6770BB4), U64_C(0x00000000979F1129), U64_C(0x0000000031E81A9D),
+        U64_C(0x00000000F44F2413), U64_C(0x0000000052382FA7), U64_C(0x0000000063D0353A), U64_C(0x00000000C5A73E8E),
+        U64_C(0x0000000033EF4E67), U64_C(0x00000000959845D3), U64_C(0x00000000A4705F4E), U64_C(0x00000000020754FA),
+        U64_C(0x00000000C7A06A74), U64_C(0x0000000061D761C0), U64_C(0x00000000503F7B5D), U64_C(0x00000000F64870E9),
+        U64_C(0x0000000067DE9CCE), U64_C(0x00000000C1A9977A), U64_C(0x00000000F0418DE7), U64_C(0x0000000056368653),
+        U64_C(0x000000009391B8DD), U64_C(0x0000000035E6B369), U64_C(0x00000000040EA9F4), U64_C(0x00000000A279A240),
+        U64_C(0x000000005431D2A9), U64_C(0x00000000F246D91D), U64_C(0x00000000C3AEC380), U64_C(0x0000000065D9C834),
+        U64_C(0x00000000A07EF6BA), U64_C(0x000000000609FD0E), U64_C(0x0000000037E1E793), U64_C(0x000000009196EC27),
+        U64_C(0x00000000CFBD399C), U64_C(0x0000000069CA3228), U64_C(0x00000000582228B5), U64_C(0x00000000FE552301),
+        U64_C(0x000000003BF21D8F), U64_C(0x000000009D85163B), U64_C(0x00000000AC6D0CA6), U64_C(0x000000000A1A0712),
+        U64_C(0x00000000FC5277FB), U64_C(0x000000005A257C4F), U64_C(0x000000006BCD66D2), U64_C(0x00000000CDBA6D66),
+        U64_C(0x00000000081D53E8), U64_C(0x00000000AE6A585C), U64_C(0x000000009F8242C1), U64_C(0x0000000039F54975),
+        U64_C(0x00000000A863A552), U64_C(0x000000000E14AEE6), U64_C(0x000000003FFCB47B), U64_C(0x00000000998BBFCF),
+        U64_C(0x000000005C2C8141), U64_C(0x00000000FA5B8AF5), U64_C(0x00000000CBB39068), U64_C(0x000000006DC49BDC),
+        U64_C(0x000000009B8CEB35), U64_C(0x000000003DFBE081), U64_C(0x000000000C13FA1C), U64_C(0x00000000AA64F1A8),
+        U64_C(0x000000006FC3CF26), U64_C(0x00000000C9B4C492), U64_C(0x00000000F85CDE0F), U64_C(0x000000005E2BD5BB),
+        U64_C(0x00000000440B7579), U64_C(0x00000000E27C7ECD), U64_C(0x00000000D3946450), U64_C(0x0000000075E36FE4),
+        U64_C(0x00000000B044516A), U64_C(0x0000000016335ADE), U64_C(0x0000000027DB4043), U64_C(0x0000000081AC4BF7),
+        U64_C(0x0000000077E43B1E), U64_C(0x00000000D19330AA), U64_C(0x00000000E07B2A37), U64_C(0x00000000460C2183),
+        U64_C(0x0000000083AB1F0D), U64_C(0x0000000025DC14B9), U64_C(0x0000000014340E24), U64_C(0x00000000B2430590),
+        U64_C(0x0000000023D5E9B7), U64_C(0x0000000085A2E203), U64_C(0x00000000B44AF89E), U64_C(0x00000000123DF32A),
+        U64_C(0x00000000D79ACDA4), U64_C(0x0000000071EDC610), U64_C(0x000000004005DC8D), U64_C(0x00000000E672D739),
+        U64_C(0x00000000103AA7D0), U64_C(0x00000000B64DAC64), U64_C(0x0000000087A5B6F9), U64_C(0x0000000021D2BD4D),
+        U64_C(0x00000000E47583C3), U64_C(0x0000000042028877), U64_C(0x0000000073EA92EA), U64_C(0x00000000D59D995E),
+        U64_C(0x000000008BB64CE5), U64_C(0x000000002DC14751), U64_C(0x000000001C295DCC), U64_C(0x00000000BA5E5678),
+        U64_C(0x000000007FF968F6), U64_C(0x00000000D98E6342), U64_C(0x00000000E86679DF), U64_C(0x000000004E11726B),
+        U64_C(0x00000000B8590282), U64_C(0x000000001E2E0936), U64_C(0x000000002FC613AB), U64_C(0x0000000089B1181F),
+        U64_C(0x000000004C162691), U64_C(0x00000000EA612D25), U64_C(0x00000000DB8937B8), U64_C(0x000000007DFE3C0C),
+        U64_C(0x00000000EC68D02B), U64_C(0x000000004A1FDB9F), U64_C(0x000000007BF7C102), U64_C(0x00000000DD80CAB6),
+        U64_C(0x000000001827F438), U64_C(0x00000000BE50FF8C), U64_C(0x000000008FB8E511), U64_C(0x0000000029CFEEA5),
+        U64_C(0x00000000DF879E4C), U64_C(0x0000000079F095F8), U64_C(0x0000000048188F65), U64_C(0x00000000EE6F84D1),
+        U64_C(0x000000002BC8BA5F), U64_C(0x000000008DBFB1EB), U64_C(0x00000000BC57AB76), U64_C(0x000000001A20A0C2),
+        U64_C(0x000000008816EAF2), U64_C(0x000000002E61E146), U64_C(0x000000001F89FBDB), U64_C(0x00000000B9FEF06F),
+        U64_C(0x000000007C59CEE1), U64_C(0x00000000DA2EC555), U64_C(0x00000000EBC6DFC8), U64_C(0x000000004DB1D47C),
+        U64_C(0x00000000BBF9A495), U64_C(0x000000001D8EAF21), U64_C(0x000000002C66B5BC), U64_C(0x000000008A11BE08),
+        U64_C(0x000000004FB68086), U64_C(0x00000000E9C18B32), U64_C(0x00000000D82991AF), U64_C(0x000000007E5E9A1B),
+        U64_C(0x00000000EFC8763C), U64_C(0x0000000049BF7D88), U64_C(0x0000000078576715), U64_C(0x00000000DE206CA1),
+        U64_C(0x000000001B87522F), U64_C(0x00000000BDF0599B), U64_C(0x000000008C184306), U64_C(0x000000002A6F48B2),
+        U64_C(0x00000000DC27385B), U64_C(0x000000007A5033EF), U64_C(0x000000004BB82972), U64_C(0x00000000EDCF22C6),
+        U64_C(0x0000000028681C48), U64_C(0x000000008E1F17FC), U64_C(0x00000000BFF70D61), U64_C(0x00000000198006D5),
+        U64_C(0x0000000047ABD36E), U64_C(0x00000000E1DCD8DA), U64_C(0x00000000D034C247), U64_C(0x000000007643C9F3),
+        U64_C(0x00000000B3E4F77D), U64_C(0x000000001593FCC9), U64_C(0x00000000247BE654), U64_C(0x00000000820CEDE0),
+        U64_C(0x0000000074449D09), U64_C(0x00000000D23396BD), U64_C(0x00000000E3DB8C20), U64_C(0x0000000045AC8794),
+        U64_C(0x00000000800BB91A), U64_C(0x00000000267CB2AE), U64_C(0x000000001794A833), U64_C(0x00000000B1E3A387),
+        U64_C(0x0000000020754FA0), U64_C(0x0000000086024414), U64_C(0x00000000B7EA5E89), U64_C(0x00000000119D553D),
+        U64_C(0x00000000D43A6BB3), U64_C(0x00000000724D6007), U64_C(0x0000000043A57A9A), U64_C(0x00000000E5D2712E),
+        U64_C(0x00000000139A01C7), U64_C(0x00000000B5ED0A73), U64_C(0x00000000840510EE), U64_C(0x0000000022721B5A),
+        U64_C(0x00000000E7D525D4), U64_C(0x0000000041A22E60), U64_C(0x00000000704A34FD), U64_C(0x00000000D63D3F49),
+        U64_C(0x00000000CC1D9F8B), U64_C(0x000000006A6A943F), U64_C(0x000000005B828EA2), U64_C(0x00000000FDF58516),
+        U64_C(0x000000003852BB98), U64_C(0x000000009E25B02C), U64_C(0x00000000AFCDAAB1), U64_C(0x0000000009BAA105),
+        U64_C(0x00000000FFF2D1EC), U64_C(0x000000005985DA58), U64_C(0x00000000686DC0C5), U64_C(0x00000000CE1ACB71),
+        U64_C(0x000000000BBDF5FF), U64_C(0x00000000ADCAFE4B), U64_C(0x000000009C22E4D6), U64_C(0x000000003A55EF62),
+        U64_C(0x00000000ABC30345), U64_C(0x000000000DB408F1), U64_C(0x000000003C5C126C), U64_C(0x000000009A2B19D8),
+        U64_C(0x000000005F8C2756), U64_C(0x00000000F9FB2CE2), U64_C(0x00000000C813367F), U64_C(0x000000006E643DCB),
+        U64_C(0x00000000982C4D22), U64_C(0x000000003E5B4696), U64_C(0x000000000FB35C0B), U64_C(0x00000000A9C457BF),
+        U64_C(0x000000006C636931), U64_C(0x00000000CA146285), U64_C(0x00000000FBFC7818), U64_C(0x000000005D8B73AC),
+        U64_C(0x0000000003A0A617), U64_C(0x00000000A5D7ADA3), U64_C(0x00000000943FB73E), U64_C(0x000000003248BC8A),
+        U64_C(0x00000000F7EF8204), U64_C(0x00000000519889B0), U64_C(0x000000006070932D), U64_C(0x00000000C6079899),
+        U64_C(0x00000000304FE870), U64_C(0x000000009638E3C4), U64_C(0x00000000A7D0F959), U64_C(0x0000000001A7F2ED),
+        U64_C(0x00000000C400CC63), U64_C(0x000000006277C7D7), U64_C(0x00000000539FDD4A), U64_C(0x00000000F5E8D6FE),
+        U64_C(0x00000000647E3AD9), U64_C(0x00000000C209316D), U64_C(0x00000000F3E12BF0), U64_C(0x0000000055962044),
+        U64_C(0x0000000090311ECA), U64_C(0x000000003646157E), U64_C(0x0000000007AE0FE3), U64_C(0x00000000A1D90457),
+        U64_C(0x00000000579174BE), U64_C(0x00000000F1E67F0A), U64_C(0x00000000C00E6597), U64_C(0x0000000066796E23),
+        U64_C(0x00000000A3DE50AD), U64_C(0x0000000005A95B19), U64_C(0x0000000034414184), U64_C(0x0000000092364A30),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x00000000CCAA009E), U64_C(0x000000004225077D), U64_C(0x000000008E8F07E3),
+        U64_C(0x00000000844A0EFA), U64_C(0x0000000048E00E64), U64_C(0x00000000C66F0987), U64_C(0x000000000AC50919),
+        U64_C(0x00000000D3E51BB5), U64_C(0x000000001F4F1B2B), U64_C(0x0000000091C01CC8), U64_C(0x000000005D6A1C56),
+        U64_C(0x0000000057AF154F), U64_C(0x000000009B0515D1), U64_C(0x00000000158A1232), U64_C(0x00000000D92012AC),
+        U64_C(0x000000007CBB312B), U64_C(0x00000000B01131B5), U64_C(0x000000003E9E3656), U64_C(0x00000000F23436C8),
+        U64_C(0x00000000F8F13FD1), U64_C(0x00000000345B3F4F), U64_C(0x00000000BAD438AC), U64_C(0x00000000767E3832),
+        U64_C(0x00000000AF5E2A9E), U64_C(0x0000000063F42A00), U64_C(0x00000000ED7B2DE3), U64_C(0x0000000021D12D7D),
+        U64_C(0x000000002B142464), U64_C(0x00000000E7BE24FA), U64_C(0x0000000069312319), U64_C(0x00000000A59B2387),
+        U64_C(0x00000000F9766256), U64_C(0x0000000035DC62C8), U64_C(0x00000000BB53652B), U64_C(0x0000000077F965B5),
+        U64_C(0x000000007D3C6CAC), U64_C(0x00000000B1966C32), U64_C(0x000000003F196BD1), U64_C(0x00000000F3B36B4F),
+        U64_C(0x000000002A9379E3), U64_C(0x00000000E639797D), U64_C(0x0000000068B67E9E), U64_C(0x00000000A41C7E00),
+        U64_C(0x00000000AED97719), U64_C(0x0000000062737787), U64_C(0x00000000ECFC7064), U64_C(0x00000000205670FA),
+        U64_C(0x0000000085CD537D), U64_C(0x00000000496753E3), U64_C(0x00000000C7E85400), U64_C(0x000000000B42549E),
+        U64_C(0x0000000001875D87), U64_C(0x00000000CD2D5D19), U64_C(0x0000000043A25AFA), U64_C(0x000000008F085A64),
+        U64_C(0x00000000562848C8), U64_C(0x000000009A824856), U64_C(0x00000000140D4FB5), U64_C(0x00000000D8A74F2B),
+        U64_C(0x00000000D2624632), U64_C(0x000000001EC846AC), U64_C(0x000000009047414F), U64_C(0x000000005CED41D1),
+        U64_C(0x00000000299DC2ED), U64_C(0x00000000E537C273), U64_C(0x000000006BB8C590), U64_C(0x00000000A712C50E),
+        U64_C(0x00000000ADD7CC17), U64_C(0x00000000617DCC89), U64_C(0x00000000EFF2CB6A), U64_C(0x000000002358CBF4),
+        U64_C(0x00000000FA78D958), U64_C(0x0000000036D2D9C6), U64_C(0x00000000B85DDE25), U64_C(0x0000000074F7DEBB),
+        U64_C(0x000000007E32D7A2), U64_C(0x00000000B298D73C), U64_C(0x000000003C17D0DF), U64_C(0x00000000F0BDD041),
+        U64_C(0x000000005526F3C6), U64_C(0x00000000998CF358), U64_C(0x000000001703F4BB), U64_C(0x00000000DBA9F425),
+        U64_C(0x00000000D16CFD3C), U64_C(0x000000001DC6FDA2), U64_C(0x000000009349FA41), U64_C(0x000000005FE3FADF),
+        U64_C(0x0000000086C3E873), U64_C(0x000000004A69E8ED), U64_C(0x00000000C4E6EF0E), U64_C(0x00000000084CEF90),
+        U64_C(0x000000000289E689), U64_C(0x00000000CE23E617), U64_C(0x0000000040ACE1F4), U64_C(0x000000008C06E16A),
+        U64_C(0x00000000D0EBA0BB), U64_C(0x000000001C41A025), U64_C(0x0000000092CEA7C6), U64_C(0x000000005E64A758),
+        U64_C(0x0000000054A1AE41), U64_C(0x00000000980BAEDF), U64_C(0x000000001684A93C), U64_C(0x00000000DA2EA9A2),
+        U64_C(0x00000000030EBB0E), U64_C(0x00000000CFA4BB90), U64_C(0x00000000412BBC73), U64_C(0x000000008D81BCED),
+        U64_C(0x000000008744B5F4), U64_C(0x000000004BEEB56A), U64_C(0x00000000C561B289), U64_C(0x0000000009CBB217),
+        U64_C(0x00000000AC509190), U64_C(0x0000000060FA910E), U64_C(0x00000000EE7596ED), U64_C(0x0000000022DF9673),
+        U64_C(0x00000000281A9F6A), U64_C(0x00000000E4B09FF4), U64_C(0x000000006A3F9817), U64_C(0x00000000A6959889),
+        U64_C(0x000000007FB58A25), U64_C(0x00000000B31F8ABB), U64_C(0x000000003D908D58), U64_C(0x00000000F13A8DC6),
+        U64_C(0x00000000FBFF84DF), U64_C(0x0000000037558441), U64_C(0x00000000B9DA83A2), U64_C(0x000000007570833C),
+        U64_C(0x00000000533B85DA), U64_C(0x000000009F918544), U64_C(0x00000000111E82A7), U64_C(0x00000000DDB48239),
+        U64_C(0x00000000D7718B20), U64_C(0x000000001BDB8BBE), U64_C(0x0000000095548C5D), U64_C(0x0000000059FE8CC3),
+        U64_C(0x0000000080DE9E6F), U64_C(0x000000004C749EF1), U64_C(0x00000000C2FB9912), U64_C(0x000000000E51998C),
+        U64_C(0x0000000004949095), U64_C(0x00000000C83E900B), U64_C(0x0000000046B197E8), U64_C(0x000000008A1B9776),
+        U64_C(0x000000002F80B4F1), U64_C(0x00000000E32AB46F), U64_C(0x000000006DA5B38C), U64_C(0x00000000A10FB312),
+        U64_C(0x00000000ABCABA0B), U64_C(0x000000006760BA95), U64_C(0x00000000E9EFBD76), U64_C(0x000000002545BDE8),
+        U64_C(0x00000000FC65AF44), U64_C(0x0000000030CFAFDA), U64_C(0x00000000BE40A839), U64_C(0x0000000072EAA8A7),
+        U64_C(0x00000000782FA1BE), U64_C(0x00000000B485A120), U64_C(0x000000003A0AA6C3), U64_C(0x00000000F6A0A65D),
+        U64_C(0x00000000AA4DE78C), U64_C(0x0000000066E7E712), U64_C(0x00000000E868E0F1), U64_C(0x0000000024C2E06F),
+        U64_C(0x000000002E07E976), U64_C(0x00000000E2ADE9E8), U64_C(0x000000006C22EE0B), U64_C(0x00000000A088EE95),
+        U64_C(0x0000000079A8FC39), U64_C(0x00000000B502FCA7), U64_C(0x000000003B8DFB44), U64_C(0x00000000F727FBDA),
+        U64_C(0x00000000FDE2F2C3), U64_C(0x000000003148F25D), U64_C(0x00000000BFC7F5BE), U64_C(0x00000000736DF520),
+        U64_C(0x00000000D6F6D6A7), U64_C(0x000000001A5CD639), U64_C(0x0000000094D3D1DA), U64_C(0x000000005879D144),
+        U64_C(0x0000000052BCD85D), U64_C(0x000000009E16D8C3), U64_C(0x000000001099DF20), U64_C(0x00000000DC33DFBE),
+        U64_C(0x000000000513CD12), U64_C(0x00000000C9B9CD8C), U64_C(0x000000004736CA6F), U64_C(0x000000008B9CCAF1),
+        U64_C(0x000000008159C3E8), U64_C(0x000000004DF3C376), U64_C(0x00000000C37CC495), U64_C(0x000000000FD6C40B),
+        U64_C(0x000000007AA64737), U64_C(0x00000000B60C47A9), U64_C(0x000000003883404A), U64_C(0x00000000F42940D4),
+        U64_C(0x00000000FEEC49CD), U64_C(0x0000000032464953), U64_C(0x00000000BCC94EB0), U64_C(0x0000000070634E2E),
+        U64_C(0x00000000A9435C82), U64_C(0x0000000065E95C1C), U64_C(0x00000000EB665BFF), U64_C(0x0000000027CC5B61),
+        U64_C(0x000000002D095278), U64_C(0x00000000E1A352E6), U64_C(0x000000006F2C5505), U64_C(0x00000000A386559B),
+        U64_C(0x00000000061D761C), U64_C(0x00000000CAB77682), U64_C(0x0000000044387161), U64_C(0x00000000889271FF),
+        U64_C(0x00000000825778E6), U64_C(0x000000004EFD7878), U64_C(0x00000000C0727F9B), U64_C(0x000000000CD87F05),
+        U64_C(0x00000000D5F86DA9), U64_C(0x0000000019526D37), U64_C(0x0000000097DD6AD4), U64_C(0x000000005B776A4A),
+        U64_C(0x0000000051B26353), U64_C(0x000000009D1863CD), U64_C(0x000000001397642E), U64_C(0x00000000DF3D64B0),
+        U64_C(0x0000000083D02561), U64_C(0x000000004F7A25FF), U64_C(0x00000000C1F5221C), U64_C(0x000000000D5F2282),
+        U64_C(0x00000000079A2B9B), U64_C(0x00000000CB302B05), U64_C(0x0000000045BF2CE6), U64_C(0x0000000089152C78),
+        U64_C(0x0000000050353ED4), U64_C(0x000000009C9F3E4A), U64_C(0x00000000121039A9), U64_C(0x00000000DEBA3937),
+        U64_C(0x00000000D47F302E), U64_C(0x0000000018D530B0), U64_C(0x00000000965A3753), U64_C(0x000000005AF037CD),
+        U64_C(0x00000000FF6B144A), U64_C(0x0000000033C114D4), U64_C(0x00000000BD4E1337), U64_C(0x0000000071E413A9),
+        U64_C(0x000000007B211AB0), U64_C(0x00000000B78B1A2E), U64_C(0x0000000039041DCD), U64_C(0x00000000F5AE1D53),
+        U64_C(0x000000002C8E0FFF), U64_C(0x00000000E0240F61), U64_C(0x000000006EAB0882), U64_C(0x00000000A201081C),
+        U64_C(0x00000000A8C40105), U64_C(0x00000000646E019B), U64_C(0x00000000EAE10678), U64_C(0x00000000264B06E6),
+    },
+};
+
+// CRC-32/ISO-HDLC table
+const u32 CRC32_TABLE[256] =
+{
+    0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA,
+    0x076DC419, 0x706AF48F, 0xE963A535, 0x9E6495A3,
+    0x0EDB8832, 0x79DCB8A4, 0xE0D5E91E, 0x97D2D988,
+    0x09B64C2B, 0x7EB17CBD, 0xE7B82D07, 0x90BF1D91,
+    0x1DB71064, 0x6AB020F2, 0xF3B97148, 0x84BE41DE,
+    0x1ADAD47D, 0x6DDDE4EB, 0xF4D4B551, 0x83D385C7,
+    0x136C9856, 0x646BA8C0, 0xFD62F97A, 0x8A65C9EC,
+    0x14015C4F, 0x63066CD9, 0xFA0F3D63, 0x8D080DF5,
+    0x3B6E20C8, 0x4C69105E, 0xD56041E4, 0xA2677172,
+    0x3C03E4D1, 0x4B04D447, 0xD20D85FD, 0xA50AB56B,
+    0x35B5A8FA, 0x42B2986C, 0xDBBBC9D6, 0xACBCF940,
+    0x32D86CE3, 0x45DF5C75, 0xDCD60DCF, 0xABD13D59,
+    0x26D930AC, 0x51DE003A, 0xC8D75180, 0xBFD06116,
+    0x21B4F4B5, 0x56B3C423, 0xCFBA9599, 0xB8BDA50F,
+    0x2802B89E, 0x5F058808, 0xC60CD9B2, 0xB10BE924,
+    0x2F6F7C87, 0x58684C11, 0xC1611DAB, 0xB6662D3D,
+    0x76DC4190, 0x01DB7106, 0x98D220BC, 0xEFD5102A,
+    0x71B18589, 0x06B6B51F, 0x9FBFE4A5, 0xE8B8D433,
+    0x7807C9A2, 0x0F00F934, 0x9609A88E, 0xE10E9818,
+    0x7F6A0DBB, 0x086D3D2D, 0x91646C97, 0xE6635C01,
+    0x6B6B51F4, 0x1C6C6162, 0x856530D8, 0xF262004E,
+    0x6C0695ED, 0x1B01A57B, 0x8208F4C1, 0xF50FC457,
+    0x65B0D9C6, 0x12B7E950, 0x8BBEB8EA, 0xFCB9887C,
+    0x62DD1DDF, 0x15DA2D49, 0x8CD37CF3, 0xFBD44C65,
+    0x4DB26158, 0x3AB551CE, 0xA3BC0074, 0xD4BB30E2,
+    0x4ADFA541, 0x3DD895D7, 0xA4D1C46D, 0xD3D6F4FB,
+    0x4369E96A, 0x346ED9FC, 0xAD678846, 0xDA60B8D0,
+    0x44042D73, 0x33031DE5, 0xAA0A4C5F, 0xDD0D7CC9,
+    0x5005713C, 0x270241AA, 0xBE0B1010, 0xC90C2086,
+    0x5768B525, 0x206F85B3, 0xB966D409, 0xCE61E49F,
+    0x5EDEF90E, 0x29D9C998, 0xB0D09822, 0xC7D7A8B4,
+    0x59B33D17, 0x2EB40D81, 0xB7BD5C3B, 0xC0BA6CAD,
+    0xEDB88320, 0x9ABFB3B6, 0x03B6E20C, 0x74B1D29A,
+    0xEAD54739, 0x9DD277AF, 0x04DB2615, 0x73DC1683,
+    0xE3630B12, 0x94643B84, 0x0D6D6A3E, 0x7A6A5AA8,
+    0xE40ECF0B, 0x9309FF9D, 0x0A00AE27, 0x7D079EB1,
+    0xF00F9344, 0x8708A3D2, 0x1E01F268, 0x6906C2FE,
+    0xF762575D, 0x806567CB, 0x196C3671, 0x6E6B06E7,
+    0xFED41B76, 0x89D32BE0, 0x10DA7A5A, 0x67DD4ACC,
+    0xF9B9DF6F, 0x8EBEEFF9, 0x17B7BE43, 0x60B08ED5,
+    0xD6D6A3E8, 0xA1D1937E, 0x38D8C2C4, 0x4FDFF252,
+    0xD1BB67F1, 0xA6BC5767, 0x3FB506DD, 0x48B2364B,
+    0xD80D2BDA, 0xAF0A1B4C, 0x36034AF6, 0x41047A60,
+    0xDF60EFC3, 0xA867DF55, 0x316E8EEF, 0x4669BE79,
+    0xCB61B38C, 0xBC66831A, 0x256FD2A0, 0x5268E236,
+    0xCC0C7795, 0xBB0B4703, 0x220216B9, 0x5505262F,
+    0xC5BA3BBE, 0xB2BD0B28, 0x2BB45A92, 0x5CB36A04,
+    0xC2D7FFA7, 0xB5D0CF31, 0x2CD99E8B, 0x5BDEAE1D,
+    0x9B64C2B0, 0xEC63F226, 0x756AA39C, 0x026D930A,
+    0x9C0906A9, 0xEB0E363F, 0x72076785, 0x05005713,
+    0x95BF4A82, 0xE2B87A14, 0x7BB12BAE, 0x0CB61B38,
+    0x92D28E9B, 0xE5D5BE0D, 0x7CDCEFB7, 0x0BDBDF21,
+    0x86D3D2D4, 0xF1D4E242, 0x68DDB3F8, 0x1FDA836E,
+    0x81BE16CD, 0xF6B9265B, 0x6FB077E1, 0x18B74777,
+    0x88085AE6, 0xFF0F6A70, 0x66063BCA, 0x11010B5C,
+    0x8F659EFF, 0xF862AE69, 0x616BFFD3, 0x166CCF45,
+    0xA00AE278, 0xD70DD2EE, 0x4E048354, 0x3903B3C2,
+    0xA7672661, 0xD06016F7, 0x4969474D, 0x3E6E77DB,
+    0xAED16A4A, 0xD9D65ADC, 0x40DF0B66, 0x37D83BF0,
+    0xA9BCAE53, 0xDEBB9EC5, 0x47B2CF7F, 0x30B5FFE9,
+    0xBDBDF21C, 0xCABAC28A, 0x53B39330, 0x24B4A3A6,
+    0xBAD03605, 0xCDD70693, 0x54DE5729, 0x23D967BF,
+    0xB3667A2E, 0xC4614AB8, 0x5D681B02, 0x2A6F2B94,
+    0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B, 0x2D02EF8D,
+};
+
+// CRC-32/ISO-HDLC slicing tables
+const u32 CRC32_SLICE_TABLE[16][256] =
+{
+    {
+        0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA,
+        0x076DC419, 0x706AF48F, 0xE963A535, 0x9E6495A3,
+        0x0EDB8832, 0x79DCB8A4, 0xE0D5E91E, 0x97D2D988,
+        0x09B64C2B, 0x7EB17CBD, 0xE7B82D07, 0x90BF1D91,
+        0x1DB71064, 0x6AB020F2, 0xF3B97148, 0x84BE41DE,
+        0x1ADAD47D, 0x6DDDE4EB, 0xF4D4B551, 0x83D385C7,
+        0x136C9856, 0x646BA8C0, 0xFD62F97A, 0x8A65C9EC,
+        0x14015C4F, 0x63066CD9, 0xFA0F3D63, 0x8D080DF5,
+        0x3B6E20C8, 0x4C69105E, 0xD56041E4, 0xA2677172,
+        0x3C03E4D1, 0x4B04D447, 0xD20D85FD, 0xA50AB56B,
+        0x35B5A8FA, 0x42B2986C, 0xDBBBC9D6, 0xACBCF940,
+        0x32D86CE3, 0x45DF5C75, 0xDCD60DCF, 0xABD13D59,
+        0x26D930AC, 0x51DE003A, 0xC8D75180, 0xBFD06116,
+        0x21B4F4B5, 0x56B3C423, 0xCFBA9599, 0xB8BDA50F,
+        0x2802B89E, 0x5F058808, 0xC60CD9B2, 0xB10BE924,
+        0x2F6F7C87, 0x58684C11, 0xC1611DAB, 0xB6662D3D,
+        0x76DC4190, 0x01DB7106, 0x98D220BC, 0xEFD5102A,
+        0x71B18589, 0x06B6B51F, 0x9FBFE4A5, 0xE8B8D433,
+        0x7807C9A2, 0x0F00F934, 0x9609A88E, 0xE10E9818,
+        0x7F6A0DBB, 0x086D3D2D, 0x91646C97, 0xE6635C01,
+        0x6B6B51F4, 0x1C6C6162, 0x856530D8, 0xF262004E,
+        0x6C0695ED, 0x1B01A57B, 0x8208F4C1, 0xF50FC457,
+        0x65B0D9C6, 0x12B7E950, 0x8BBEB8EA, 0xFCB9887C,
+        0x62DD1DDF, 0x15DA2D49, 0x8CD37CF3, 0xFBD44C65,
+        0x4DB26158, 0x3AB551CE, 0xA3BC0074, 0xD4BB30E2,
+        0x4ADFA541, 0x3DD895D7, 0xA4D1C46D, 0xD3D6F4FB,
+        0x4369E96A, 0x346ED9FC, 0xAD678846, 0xDA60B8D0,
+        0x44042D73, 0x33031DE5, 0xAA0A4C5F, 0xDD0D7CC9,
+        0x5005713C, 0x270241AA, 0xBE0B1010, 0xC90C2086,
+        0x5768B525, 0x206F85B3, 0xB966D409, 0xCE61E49F,
+        0x5EDEF90E, 0x29D9C998, 0xB0D09822, 0xC7D7A8B4,
+        0x59B33D17, 0x2EB40D81, 0xB7BD5C3B, 0xC0BA6CAD,
+        0xEDB88320, 0x9ABFB3B6, 0x03B6E20C, 0x74B1D29A,
+        0xEAD54739, 0x9DD277AF, 0x04DB2615, 0x73DC1683,
+        0xE3630B12, 0x94643B84, 0x0D6D6A3E, 0x7A6A5AA8,
+        0xE40ECF0B, 0x9309FF9D, 0x0A00AE27, 0x7D079EB1,
+        0xF00F9344, 0x8708A3D2, 0x1E01F268, 0x6906C2FE,
+        0xF762575D, 0x806567CB, 0x196C3671, 0x6E6B06E7,
+        0xFED41B76, 0x89D32BE0, 0x10DA7A5A, 0x67DD4ACC,
+        0xF9B9DF6F, 0x8EBEEFF9, 0x17B7BE43, 0x60B08ED5,
+        0xD6D6A3E8, 0xA1D1937E, 0x38D8C2C4, 0x4FDFF252,
+        0xD1BB67F1, 0xA6BC5767, 0x3FB506DD, 0x48B2364B,
+        0xD80D2BDA, 0xAF0A1B4C, 0x36034AF6, 0x41047A60,
+        0xDF60EFC3, 0xA867DF55, 0x316E8EEF, 0x4669BE79,
+        0xCB61B38C, 0xBC66831A, 0x256FD2A0, 0x5268E236,
+        0xCC0C7795, 0xBB0B4703, 0x220216B9, 0x5505262F,
+        0xC5BA3BBE, 0xB2BD0B28, 0x2BB45A92, 0x5CB36A04,
+        0xC2D7FFA7, 0xB5D0CF31, 0x2CD99E8B, 0x5BDEAE1D,
+        0x9B64C2B0, 0xEC63F226, 0x756AA39C, 0x026D930A,
+        0x9C0906A9, 0xEB0E363F, 0x72076785, 0x05005713,
+        0x95BF4A82, 0xE2B87A14, 0x7BB12BAE, 0x0CB61B38,
+        0x92D28E9B, 0xE5D5BE0D, 0x7CDCEFB7, 0x0BDBDF21,
+        0x86D3D2D4, 0xF1D4E242, 0x68DDB3F8, 0x1FDA836E,
+        0x81BE16CD, 0xF6B9265B, 0x6FB077E1, 0x18B74777,
+        0x88085AE6, 0xFF0F6A70, 0x66063BCA, 0x11010B5C,
+        0x8F659EFF, 0xF862AE69, 0x616BFFD3, 0x166CCF45,
+        0xA00AE278, 0xD70DD2EE, 0x4E048354, 0x3903B3C2,
+        0xA7672661, 0xD06016F7, 0x4969474D, 0x3E6E77DB,
+        0xAED16A4A, 0xD9D65ADC, 0x40DF0B66, 0x37D83BF0,
+        0xA9BCAE53, 0xDEBB9EC5, 0x47B2CF7F, 0x30B5FFE9,
+        0xBDBDF21C, 0xCABAC28A, 0x53B39330, 0x24B4A3A6,
+        0xBAD03605, 0xCDD70693, 0x54DE5729, 0x23D967BF,
+        0xB3667A2E, 0xC4614AB8, 0x5D681B02, 0x2A6F2B94,
+        0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B, 0x2D02EF8D,
+    },
+    {
+        0x00000000, 0x191B3141, 0x32366282, 0x2B2D53C3,
+        0x646CC504, 0x7D77F445, 0x565AA786, 0x4F4196C7,
+        0xC8D98A08, 0xD1C2BB49, 0xFAEFE88A, 0xE3F4D9CB,
+        0xACB54F0C, 0xB5AE7E4D, 0x9E832D8E, 0x87981CCF,
+        0x4AC21251, 0x53D92310, 0x78F470D3, 0x61EF4192,
+        0x2EAED755, 0x37B5E614, 0x1C98B5D7, 0x05838496,
+        0x821B9859, 0x9B00A918, 0xB02DFADB, 0xA936CB9A,
+        0xE6775D5D, 0xFF6C6C1C, 0xD4413FDF, 0xCD5A0E9E,
+        0x958424A2, 0x8C9F15E3, 0xA7B24620, 0xBEA97761,
+        0xF1E8E1A6, 0xE8F3D0E7, 0xC3DE8324, 0xDAC5B265,
+        0x5D5DAEAA, 0x44469FEB, 0x6F6BCC28, 0x7670FD69,
+        0x39316BAE, 0x202A5AEF, 0x0B07092C, 0x121C386D,
+        0xDF4636F3, 0xC65D07B2, 0xED705471, 0xF46B6530,
+        0xBB2AF3F7, 0xA231C2B6, 0x891C9175, 0x9007A034,
+        0x179FBCFB, 0x0E848DBA, 0x25A9DE79, 0x3CB2EF38,
+        0x73F379FF, 0x6AE848BE, 0x41C51B7D, 0x58DE2A3C,
+        0xF0794F05, 0xE9627E44, 0xC24F2D87, 0xDB541CC6,
+        0x94158A01, 0x8D0EBB40, 0xA623E883, 0xBF38D9C2,
+        0x38A0C50D, 0x21BBF44C, 0x0A96A78F, 0x138D96CE,
+        0x5CCC0009, 0x45D73148, 0x6EFA628B, 0x77E153CA,
+        0xBABB5D54, 0xA3A06C15, 0x888D3FD6, 0x91960E97,
+        0xDED79850, 0xC7CCA911, 0xECE1FAD2, 0xF5FACB93,
+        0x7262D75C, 0x6B79E61D, 0x4054B5DE, 0x594F849F,
+        0x160E1258, 0x0F152319, 0x243870DA, 0x3D23419B,
+        0x65FD6BA7, 0x7CE65AE6, 0x57CB0925, 0x4ED03864,
+        0x0191AEA3, 0x188A9FE2, 0x33A7CC21, 0x2ABCFD60,
+        0xAD24E1AF, 0xB43FD0EE, 0x9F12832D, 0x8609B26C,
+        0xC94824AB, 0xD05315EA, 0xFB7E4629, 0xE2657768,
+        0x2F3F79F6, 0x362448B7, 0x1D091B74, 0x04122A35,
+        0x4B53BCF2, 0x52488DB3, 0x7965DE70, 0x607EEF31,
+        0xE7E6F3FE, 0xFEFDC2BF, 0xD5D0917C, 0xCCCBA03D,
+        0x838A36FA, 0x9A9107BB, 0xB1BC5478, 0xA8A76539,
+        0x3B83984B, 0x2298A90A, 0x09B5FAC9, 0x10AECB88,
+        0x5FEF5D4F, 0x46F46C0E, 0x6DD93FCD, 0x74C20E8C,
+        0xF35A1243, 0xEA412302, 0xC16C70C1, 0xD8774180,
+        0x9736D747, 0x8E2DE606, 0xA500B5C5, 0xBC1B8484,
+        0x71418A1A, 0x685ABB5B, 0x4377E898, 0x5A6CD9D9,
+        0x152D4F1E, 0x0C367E5F, 0x271B2D9C, 0x3E001CDD,
+        0xB9980012, 0xA0833153, 0x8BAE6290, 0x92B553D1,
+        0xDDF4C516, 0xC4EFF457, 0xEFC2A794, 0xF6D996D5,
+        0xAE07BCE9, 0xB71C8DA8, 0x9C31DE6B, 0x852AEF2A,
+        0xCA6B79ED, 0xD37048AC, 0xF85D1B6F, 0xE1462A2E,
+        0x66DE36E1, 0x7FC507A0, 0x54E85463, 0x4DF36522,
+        0x02B2F3E5, 0x1BA9C2A4, 0x30849167, 0x299FA026,
+        0xE4C5AEB8, 0xFDDE9FF9, 0xD6F3CC3A, 0xCFE8FD7B,
+        0x80A96BBC, 0x99B25AFD, 0xB29F093E, 0xAB84387F,
+        0x2C1C24B0, 0x350715F1, 0x1E2A4632, 0x07317773,
+        0x4870E1B4, 0x516BD0F5, 0x7A468336, 0x635DB277,
+        0xCBFAD74E, 0xD2E1E60F, 0xF9CCB5CC, 0xE0D7848D,
+        0xAF96124A, 0xB68D230B, 0x9DA070C8, 0x84BB4189,
+        0x03235D46, 0x1A386C07, 0x31153FC4, 0x280E0E85,
+        0x674F9842, 0x7E54A903, 0x5579FAC0, 0x4C62CB81,
+        0x8138C51F, 0x9823F45E, 0xB30EA79D, 0xAA1596DC,
+        0xE554001B, 0xFC4F315A, 0xD7626299, 0xCE7953D8,
+        0x49E14F17, 0x50FA7E56, 0x7BD72D95, 0x62CC1CD4,
+        0x2D8D8A13, 0x3496BB52, 0x1FBBE891, 0x06A0D9D0,
+        0x5E7EF3EC, 0x4765C2AD, 0x6C48916E, 0x7553A02F,
+        0x3A1236E8, 0x230907A9, 0x0824546A, 0x113F652B,
+        0x96A779E4, 0x8FBC48A5, 0xA4911B66, 0xBD8A2A27,
+        0xF2CBBCE0, 0xEBD08DA1, 0xC0FDDE62, 0xD9E6EF23,
+        0x14BCE1BD, 0x0DA7D0FC, 0x268A833F, 0x3F91B27E,
+        0x70D024B9, 0x69CB15F8, 0x42E6463B, 0x5BFD777A,
+        0xDC656BB5, 0xC57E5AF4, 0xEE530937, 0xF7483876,
+        0xB809AEB1, 0xA1129FF0, 0x8A3FCC33, 0x9324FD72,
+    },
+    {
+        0x00000000, 0x01C26A37, 0x0384D46E, 0x0246BE59,
+        0x0709A8DC, 0x06CBC2EB, 0x048D7CB2, 0x054F1685,
+        0x0E1351B8, 0x0FD13B8F, 0x0D9785D6, 0x0C55EFE1,
+        0x091AF964, 0x08D89353, 0x0A9E2D0A, 0x0B5C473D,
+        0x1C26A370, 0x1DE4C947, 0x1FA2771E, 0x1E601D29,
+        0x1B2F0BAC, 0x1AED619B, 0x18ABDFC2, 0x1969B5F5,
+        0x1235F2C8, 0x13F798FF, 0x11B126A6, 0x10734C91,
+        0x153C5A14, 0x14FE3023, 0x16B88E7A, 0x177AE44D,
+        0x384D46E0, 0x398F2CD7, 0x3BC9928E, 0x3A0BF8B9,
+        0x3F44EE3C, 0x3E86840B, 0x3CC03A52, 0x3D025065,
+        0x365E1758, 0x379C7D6F, 0x35DAC336, 0x3418A901,
+        0x3157BF84, 0x3095D5B3, 0x32D36BEA, 0x331101DD,
+        0x246BE590, 0x25A98FA7, 0x27EF31FE, 0x262D5BC9,
+        0x23624D4C, 0x22A0277B, 0x20E69922, 0x2124F315,
+        0x2A78B428, 0x2BBADE1F, 0x29FC6046, 0x283E0A71,
+        0x2D711CF4, 0x2CB376C3, 0x2EF5C89A, 0x2F37A2AD,
+        0x709A8DC0, 0x7158E7F7, 0x731E59AE, 0x72DC3399,
+        0x7793251C, 0x76514F2B, 0x7417F172, 0x75D59B45,
+        0x7E89DC78, 0x7F4BB64F, 0x7D0D0816, 0x7CCF6221,
+        0x798074A4, 0x78421E93, 0x7A04A0CA, 0x7BC6CAFD,
+        0x6CBC2EB0, 0x6D7E4487, 0x6F38FADE, 0x6EFA90E9,
+        0x6BB5866C, 0x6A77EC5B, 0x68315202, 0x69F33835,
+        0x62AF7F08, 0x636D153F, 0x612BAB66, 0x60E9C151,
+        0x65A6D7D4, 0x6464BDE3, 0x662203BA, 0x67E0698D,
+        0x48D7CB20, 0x4915A117, 0x4B531F4E, 0x4A917579,
+        0x4FDE63FC, 0x4E1C09CB, 0x4C5AB792, 0x4D98DDA5,
+        0x46C49A98, 0x4706F0AF, 0x45404EF6, 0x448224C1,
+        0x41CD3244, 0x400F5873, 0x4249E62A, 0x438B8C1D,
+        0x54F16850, 0x55330267, 0x5775BC3E, 0x56B7D609,
+        0x53F8C08C, 0x523AAABB, 0x507C14E2, 0x51BE7ED5,
+        0x5AE239E8, 0x5B2053DF, 0x5966ED86, 0x58A487B1,
+        0x5DEB9134, 0x5C29FB03, 0x5E6F455A, 0x5FAD2F6D,
+        0xE1351B80, 0xE0F771B7, 0xE2B1CFEE, 0xE373A5D9,
+        0xE63CB35C, 0xE7FED96B, 0xE5B86732, 0xE47A0D05,
+        0xEF264A38, 0xEEE4200F, 0xECA29E56, 0xED60F461,
+        0xE82FE2E4, 0xE9ED88D3, 0xEBAB368A, 0xEA695CBD,
+        0xFD13B8F0, 0xFCD1D2C7, 0xFE976C9E, 0xFF5506A9,
+        0xFA1A102C, 0xFBD87A1B, 0xF99EC442, 0xF85CAE75,
+        0xF300E948, 0xF2C2837F, 0xF0843D26, 0xF1465711,
+        0xF4094194, 0xF5CB2BA3, 0xF78D95FA, 0xF64FFFCD,
+        0xD9785D60, 0xD8BA3757, 0xDAFC890E, 0xDB3EE339,
+        0xDE71F5BC, 0xDFB39F8B, 0xDDF521D2, 0xDC374BE5,
+        0xD76B0CD8, 0xD6A966EF, 0xD4EFD8B6, 0xD52DB281,
+        0xD062A404, 0xD1A0CE33, 0xD3E6706A, 0xD2241A5D,
+        0xC55EFE10, 0xC49C9427, 0xC6DA2A7E, 0xC7184049,
+        0xC25756CC, 0xC3953CFB, 0xC1D382A2, 0xC011E895,
+        0xCB4DAFA8, 0xCA8FC59F, 0xC8C97BC6, 0xC90B11F1,
+        0xCC440774, 0xCD866D43, 0xCFC0D31A, 0xCE02B92D,
+        0x91AF9640, 0x906DFC77, 0x922B422E, 0x93E92819,
+        0x96A63E9C, 0x976454AB, 0x9522EAF2, 0x94E080C5,
+        0x9FBCC7F8, 0x9E7EADCF, 0x9C381396, 0x9DFA79A1,
+        0x98B56F24, 0x99770513, 0x9B31BB4A, 0x9AF3D17D,
+        0x8D893530, 0x8C4B5F07, 0x8E0DE15E, 0x8FCF8B69,
+        0x8A809DEC, 0x8B42F7DB, 0x89044982, 0x88C623B5,
+        0x839A6488, 0x82580EBF, 0x801EB0E6, 0x81DCDAD1,
+        0x8493CC54, 0x8551A663, 0x8717183A, 0x86D5720D,
+        0xA9E2D0A0, 0xA820BA97, 0xAA6604CE, 0xABA46EF9,
+        0xAEEB787C, 0xAF29124B, 0xAD6FAC12, 0xACADC625,
+        0xA7F18118, 0xA633EB2F, 0xA4755576, 0xA5B73F41,
+        0xA0F829C4, 0xA13A43F3, 0xA37CFDAA, 0xA2BE979D,
+        0xB5C473D0, 0xB40619E7, 0xB640A7BE, 0xB782CD89,
+        0xB2CDDB0C, 0xB30FB13B, 0xB1490F62, 0xB08B6555,
+        0xBBD72268, 0xBA15485F, 0xB853F606, 0xB9919C31,
+        0xBCDE8AB4, 0xBD1CE083, 0xBF5A5EDA, 0xBE9834ED,
+    },
+    {
+        0x00000000, 0xB8BC6765, 0xAA09C88B, 0x12B5AFEE,
+        0x8F629757, 0x37DEF032, 0x256B5FDC, 0x9DD738B9,
+        0xC5B428EF, 0x7D084F8A, 0x6FBDE064, 0xD7018701,
+        0x4AD6BFB8, 0xF26AD8DD, 0xE0DF7733, 0x58631056,
+        0x5019579F, 0xE8A530FA, 0xFA109F14, 0x42ACF871,
+        0xDF7BC0C8, 0x67C7A7AD, 0x75720843, 0xCDCE6F26,
+        0x95AD7F70, 0x2D111815, 0x3FA4B7FB, 0x8718D09E,
+        0x1ACFE827, 0xA2738F42, 0xB0C620AC, 0x087A47C9,
+        0xA032AF3E, 0x188EC85B, 0x0A3B67B5, 0xB28700D0,
+        0x2F503869, 0x97EC5F0C, 0x8559F0E2, 0x3DE59787,
+        0x658687D1, 0xDD3AE0B4, 0xCF8F4F5A, 0x7733283F,
+        0xEAE41086, 0x525877E3, 0x40EDD80D, 0xF851BF68,
+        0xF02BF8A1, 0x48979FC4, 0x5A22302A, 0xE29E574F,
+        0x7F496FF6, 0xC7F50893, 0xD540A77D, 0x6DFCC018,
+        0x359FD04E, 0x8D23B72B, 0x9F9618C5, 0x272A7FA0,
+        0xBAFD4719, 0x0241207C, 0x10F48F92, 0xA848E8F7,
+        0x9B14583D, 0x23A83F58, 0x311D90B6, 0x89A1F7D3,
+        0x1476CF6A, 0xACCAA80F, 0xBE7F07E1, 0x06C36084,
+        0x5EA070D2, 0xE61C17B7, 0xF4A9B859, 0x4C15DF3C,
+        0xD1C2E785, 0x697E80E0, 0x7BCB2F0E, 0xC377486B,
+        0xCB0D0FA2, 0x73B168C7, 0x6104C729, 0xD9B8A04C,
+        0x446F98F5, 0xFCD3FF90, 0xEE66507E, 0x56DA371B,
+        0x0EB9274D, 0xB6054028, 0xA4B0EFC6, 0x1C0C88A3,
+        0x81DBB01A, 0x3967D77F, 0x2BD27891, 0x936E1FF4,
+        0x3B26F703, 0x839A9066, 0x912F3F88, 0x299358ED,
+        0xB4446054, 0x0CF80731, 0x1E4DA8DF, 0xA6F1CFBA,
+        0xFE92DFEC, 0x462EB889, 0x549B1767, 0xEC277002,
+        0x71F048BB, 0xC94C2FDE, 0xDBF98030, 0x6345E755,
+        0x6B3FA09C, 0xD383C7F9, 0xC1366817, 0x798A0F72,
+        0xE45D37CB, 0x5CE150AE, 0x4E54FF40, 0xF6E89825,
+        0xAE8B8873, 0x1637EF16, 0x048240F8, 0xBC3E279D,
+        0x21E91F24, 0x99557841, 0x8BE0D7AF, 0x335CB0CA,
+        0xED59B63B, 0x55E5D15E, 0x47507EB0, 0xFFEC19D5,
+        0x623B216C, 0xDA874609, 0xC832E9E7, 0x708E8E82,
+        0x28ED9ED4, 0x9051F9B1, 0x82E4565F, 0x3A58313A,
+        0xA78F0983, 0x1F336EE6, 0x0D86C108, 0xB53AA66D,
+        0xBD40E1A4, 0x05FC86C1, 0x1749292F, 0xAFF54E4A,
+        0x322276F3, 0x8A9E1196, 0x982BBE78, 0x2097D91D,
+        0x78F4C94B, 0xC048AE2E, 0xD2FD01C0, 0x6A4166A5,
+        0xF7965E1C, 0x4F2A3979, 0x5D9F9697, 0xE523F1F2,
+        0x4D6B1905, 0xF5D77E60, 0xE762D18E, 0x5FDEB6EB,
+        0xC2098E52, 0x7AB5E937, 0x680046D9, 0xD0BC21BC,
+        0x88DF31EA, 0x3063568F, 0x22D6F961, 0x9A6A9E04,
+        0x07BDA6BD, 0xBF01C1D8, 0xADB46E36, 0x15080953,
+        0x1D724E9A, 0xA5CE29FF, 0xB77B8611, 0x0FC7E174,
+        0x9210D9CD, 0x2AACBEA8, 0x38191146, 0x80A57623,
+        0xD8C66675, 0x607A0110, 0x72CFAEFE, 0xCA73C99B,
+        0x57A4F122, 0xEF189647, 0xFDAD39A9, 0x45115ECC,
+        0x764DEE06, 0xCEF18963, 0xDC44268D, 0x64F841E8,
+        0xF92F7951, 0x41931E34, 0x5326B1DA, 0xEB9AD6BF,
+        0xB3F9C6E9, 0x0B45A18C, 0x19F00E62, 0xA14C6907,
+        0x3C9B51BE, 0x842736DB, 0x96929935, 0x2E2EFE50,
+        0x2654B999, 0x9EE8DEFC, 0x8C5D7112, 0x34E11677,
+        0xA9362ECE, 0x118A49AB, 0x033FE645, 0xBB838120,
+        0xE3E09176, 0x5B5CF613, 0x49E959FD, 0xF1553E98,
+        0x6C820621, 0xD43E6144, 0xC68BCEAA, 0x7E37A9CF,
+        0xD67F4138, 0x6EC3265D, 0x7C7689B3, 0xC4CAEED6,
+        0x591DD66F, 0xE1A1B10A, 0xF3141EE4, 0x4BA87981,
+        0x13CB69D7, 0xAB770EB2, 0xB9C2A15C, 0x017EC639,
+        0x9CA9FE80, 0x241599E5, 0x36A0360B, 0x8E1C516E,
+        0x866616A7, 0x3EDA71C2, 0x2C6FDE2C, 0x94D3B949,
+        0x090481F0, 0xB1B8E695, 0xA30D497B, 0x1BB12E1E,
+        0x43D23E48, 0xFB6E592D, 0xE9DBF6C3, 0x516791A6,
+        0xCCB0A91F, 0x740CCE7A, 0x66B96194, 0xDE0506F1,
+    },
+    {
+        0x00000000, 0x3D6029B0, 0x7AC05360, 0x47A07AD0,
+        0xF580A6C0, 0xC8E08F70, 0x8F40F5A0, 0xB220DC10,
+        0x30704BC1, 0x0D106271, 0x4AB018A1, 0x77D03111,
+        0xC5F0ED01, 0xF890C4B1, 0xBF30BE61, 0x825097D1,
+        0x60E09782, 0x5D80BE32, 0x1A20C4E2, 0x2740ED52,
+        0x95603142, 0xA80018F2, 0xEFA06222, 0xD2C04B92,
+        0x5090DC43, 0x6DF0F5F3, 0x2A508F23, 0x1730A693,
+        0xA5107A83, 0x98705333, 0xDFD029E3, 0xE2B00053,
+        0xC1C12F04, 0xFCA106B4, 0xBB017C64, 0x866155D4,
+        0x344189C4, 0x0921A074, 0x4E81DAA4, 0x73E1F314,
+        0xF1B164C5, 0xCCD14D75, 0x8B7137A5, 0xB6111E15,
+        0x0431C205, 0x3951EBB5, 0x7EF19165, 0x4391B8D5,
+        0xA121B886, 0x9C419136, 0xDBE1EBE6, 0xE681C256,
+        0x54A11E46, 0x69C137F6, 0x2E614D26, 0x13016496,
+        0x9151F347, 0xAC31DAF7, 0xEB91A027, 0xD6F18997,
+        0x64D15587, 0x59B17C37, 0x1E1106E7, 0x23712F57,
+        0x58F35849, 0x659371F9, 0x22330B29, 0x1F532299,
+        0xAD73FE89, 0x9013D739, 0xD7B3ADE9, 0xEAD38459,
+        0x68831388, 0x55E33A38, 0x124340E8, 0x2F236958,
+        0x9D03B548, 0xA0639CF8, 0xE7C3E628, 0xDAA3CF98,
+        0x3813CFCB, 0x0573E67B, 0x42D39CAB, 0x7FB3B51B,
+        0xCD93690B, 0xF0F340BB, 0xB7533A6B, 0x8A3313DB,
+        0x0863840A, 0x3503ADBA, 0x72A3D76A, 0x4FC3FEDA,
+        0xFDE322CA, 0xC0830B7A, 0x872371AA, 0xBA43581A,
+        0x9932774D, 0xA4525EFD, 0xE3F2242D, 0xDE920D9D,
+        0x6CB2D18D, 0x51D2F83D, 0x167282ED, 0x2B12AB5D,
+        0xA9423C8C, 0x9422153C, 0xD3826FEC, 0xEEE2465C,
+        0x5CC29A4C, 0x61A2B3FC, 0x2602C92C, 0x1B62E09C,
+        0xF9D2E0CF, 0xC4B2C97F, 0x8312B3AF, 0xBE729A1F,
+        0x0C52460F, 0x31326FBF, 0x7692156F, 0x4BF23CDF,
+        0xC9A2AB0E, 0xF4C282BE, 0xB362F86E, 0x8E02D1DE,
+        0x3C220DCE, 0x0142247E, 0x46E25EAE, 0x7B82771E,
+        0xB1E6B092, 0x8C869922, 0xCB26E3F2, 0xF646CA42,
+        0x44661652, 0x79063FE2, 0x3EA64532, 0x03C66C82,
+        0x8196FB53, 0xBCF6D2E3, 0xFB56A833, 0xC6368183,
+        0x74165D93, 0x49767423, 0x0ED60EF3, 0x33B62743,
+        0xD1062710, 0xEC660EA0, 0xABC67470, 0x96A65DC0,
+        0x248681D0, 0x19E6A860, 0x5E46D2B0, 0x6326FB00,
+        0xE1766CD1, 0xDC164561, 0x9BB63FB1, 0xA6D61601,
+        0x14F6CA11, 0x2996E3A1, 0x6E369971, 0x5356B0C1,
+        0x70279F96, 0x4D47B626, 0x0AE7CCF6, 0x3787E546,
+        0x85A73956, 0xB8C710E6, 0xFF676A36, 0xC2074386,
+        0x4057D457, 0x7D37FDE7, 0x3A978737, 0x07F7AE87,
+        0xB5D77297, 0x88B75B27, 0xCF1721F7, 0xF2770847,
+        0x10C70814, 0x2DA721A4, 0x6A075B74, 0x576772C4,
+        0xE547AED4, 0xD8278764, 0x9F87FDB4, 0xA2E7D404,
+        0x20B743D5, 0x1DD76A65, 0x5A7710B5, 0x67173905,
+        0xD537E515, 0xE857CCA5, 0xAFF7B675, 0x92979FC5,
+        0xE915E8DB, 0xD475C16B, 0x93D5BBBB, 0xAEB5920B,
+        0x1C954E1B, 0x21F567AB, 0x66551D7B, 0x5B3534CB,
+        0xD965A31A, 0xE4058AAA, 0xA3A5F07A, 0x9EC5D9CA,
+        0x2CE505DA, 0x11852C6A, 0x562556BA, 0x6B457F0A,
+        0x89F57F59, 0xB49556E9, 0xF3352C39, 0xCE550589,
+        0x7C75D999, 0x4115F029, 0x06B58AF9, 0x3BD5A349,
+        0xB9853498, 0x84E51D28, 0xC34567F8, 0xFE254E48,
+        0x4C059258, 0x7165BBE8, 0x36C5C138, 0x0BA5E888,
+        0x28D4C7DF, 0x15B4EE6F, 0x521494BF, 0x6F74BD0F,
+        0xDD54611F, 0xE03448AF, 0xA794327F, 0x9AF41BCF,
+        0x18A48C1E, 0x25C4A5AE, 0x6264DF7E, 0x5F04F6CE,
+        0xED242ADE, 0xD044036E, 0x97E479BE, 0xAA84500E,
+        0x4834505D, 0x755479ED, 0x32F4033D, 0x0F942A8D,
+        0xBDB4F69D, 0x80D4DF2D, 0xC774A5FD, 0xFA148C4D,
+        0x78441B9C, 0x4524322C, 0x028448FC, 0x3FE4614C,
+        0x8DC4BD5C, 0xB0A494EC, 0xF704EE3C, 0xCA64C78C,
+    },
+    {
+        0x00000000, 0xCB5CD3A5, 0x4DC8A10B, 0x869472AE,
+        0x9B914216, 0x50CD91B3, 0xD659E31D, 0x1D0530B8,
+        0xEC53826D, 0x270F51C8, 0xA19B2366, 0x6AC7F0C3,
+        0x77C2C07B, 0xBC9E13DE, 0x3A0A6170, 0xF156B2D5,
+        0x03D6029B, 0xC88AD13E, 0x4E1EA390, 0x85427035,
+        0x9847408D, 0x531B9328, 0xD58FE186, 0x1ED33223,
+        0xEF8580F6, 0x24D95353, 0xA24D21FD, 0x6911F258,
+        0x7414C2E0, 0xBF481145, 0x39DC63EB, 0xF280B04E,
+        0x07AC0536, 0xCCF0D693, 0x4A64A43D, 0x81387798,
+        0x9C3D4720, 0x57619485, 0xD1F5E62B, 0x1AA9358E,
+        0xEBFF875B, 0x20A354FE, 0xA6372650, 0x6D6BF5F5,
+        0x706EC54D, 0xBB3216E8, 0x3DA66446, 0xF6FAB7E3,
+        0x047A07AD, 0xCF26D408, 0x49B2A6A6, 0x82EE7503,
+        0x9FEB45BB, 0x54B7961E, 0xD223E4B0, 0x197F3715,
+        0xE82985C0, 0x23755665, 0xA5E124CB, 0x6EBDF76E,
+        0x73B8C7D6, 0xB8E41473, 0x3E7066DD, 0xF52CB578,
+        0x0F580A6C, 0xC404D9C9, 0x4290AB67, 0x89CC78C2,
+        0x94C9487A, 0x5F959BDF, 0xD901E971, 0x125D3AD4,
+        0xE30B8801, 0x28575BA4, 0xAEC3290A, 0x659FFAAF,
+        0x789ACA17, 0xB3C619B2, 0x35526B1C, 0xFE0EB8B9,
+        0x0C8E08F7, 0xC7D2DB52, 0x4146A9FC, 0x8A1A7A59,
+        0x971F4AE1, 0x5C439944, 0xDAD7EBEA, 0x118B384F,
+        0xE0DD8A9A, 0x2B81593F, 0xAD152B91, 0x6649F834,
+        0x7B4CC88C, 0xB0101B29, 0x36846987, 0xFDD8BA22,
+        0x08F40F5A, 0xC3A8DCFF, 0x453CAE51, 0x8E607DF4,
+        0x93654D4C, 0x58399EE9, 0xDEADEC47, 0x15F13FE2,
+        0xE4A78D37, 0x2FFB5E92, 0xA96F2C3C, 0x6233FF99,
+        0x7F36CF21, 0xB46A1C84, 0x32FE6E2A, 0xF9A2BD8F,
+        0x0B220DC1, 0xC07EDE64, 0x46EAACCA, 0x8DB67F6F,
+        0x90B34FD7, 0x5BEF9C72, 0xDD7BEEDC, 0x16273D79,
+        0xE7718FAC, 0x2C2D5C09, 0xAAB92EA7, 0x61E5FD02,
+        0x7CE0CDBA, 0xB7BC1E1F, 0x31286CB1, 0xFA74BF14,
+        0x1EB014D8, 0xD5ECC77D, 0x5378B5D3, 0x98246676,
+        0x852156CE, 0x4E7D856B, 0xC8E9F7C5, 0x03B52460,
+        0xF2E396B5, 0x39BF4510, 0xBF2B37BE, 0x7477E41B,
+        0x6972D4A3, 0xA22E0706, 0x24BA75A8, 0xEFE6A60D,
+        0x1D661643, 0xD63AC5E6, 0x50AEB748, 0x9BF264ED,
+        0x86F75455, 0x4DAB87F0, 0xCB3FF55E, 0x006326FB,
+        0xF135942E, 0x3A69478B, 0xBCFD3525, 0x77A1E680,
+        0x6AA4D638, 0xA1F8059D, 0x276C7733, 0xEC30A496,
+        0x191C11EE, 0xD240C24B, 0x54D4B0E5, 0x9F886340,
+        0x828D53F8, 0x49D1805D, 0xCF45F2F3, 0x04192156,
+        0xF54F9383, 0x3E134026, 0xB8873288, 0x73DBE12D,
+        0x6EDED195, 0xA5820230, 0x2316709E, 0xE84AA33B,
+        0x1ACA1375, 0xD196C0D0, 0x5702B27E, 0x9C5E61DB,
+        0x815B5163, 0x4A0782C6, 0xCC93F068, 0x07CF23CD,
+        0xF6999118, 0x3DC542BD, 0xBB513013, 0x700DE3B6,
+        0x6D08D30E, 0xA65400AB, 0x20C07205, 0xEB9CA1A0,
+        0x11E81EB4, 0xDAB4CD11, 0x5C20BFBF, 0x977C6C1A,
+        0x8A795CA2, 0x41258F07, 0xC7B1FDA9, 0x0CED2E0C,
+        0xFDBB9CD9, 0x36E74F7C, 0xB0733DD2, 0x7B2FEE77,
+        0x662ADECF, 0xAD760D6A, 0x2BE27FC4, 0xE0BEAC61,
+        0x123E1C2F, 0xD962CF8A, 0x5FF6BD24, 0x94AA6E81,
+        0x89AF5E39, 0x42F38D9C, 0xC467FF32, 0x0F3B2C97,
+        0xFE6D9E42, 0x35314DE7, 0xB3A53F49, 0x78F9ECEC,
+        0x65FCDC54, 0xAEA00FF1, 0x28347D5F, 0xE368AEFA,
+        0x16441B82, 0xDD18C827, 0x5B8CBA89, 0x90D0692C,
+        0x8DD55994, 0x46898A31, 0xC01DF89F, 0x0B412B3A,
+        0xFA1799EF, 0x314B4A4A, 0xB7DF38E4, 0x7C83EB41,
+        0x6186DBF9, 0xAADA085C, 0x2C4E7AF2, 0xE712A957,
+        0x15921919, 0xDECECABC, 0x585AB812, 0x93066BB7,
+        0x8E035B0F, 0x455F88AA, 0xC3CBFA04, 0x089729A1,
+        0xF9C19B74, 0x329D48D1, 0xB4093A7F, 0x7F55E9DA,
+        0x6250D962, 0xA90C0AC7, 0x2F987869, 0xE4C4ABCC,
+    },
+    {
+        0x00000000, 0xA6770BB4, 0x979F1129, 0x31E81A9D,
+        0xF44F2413, 0x52382FA7, 0x63D0353A, 0xC5A73E8E,
+        0x33EF4E67, 0x959845D3, 0xA4705F4E, 0x020754FA,
+        0xC7A06A74, 0x61D761C0, 0x503F7B5D, 0xF64870E9,
+        0x67DE9CCE, 0xC1A9977A, 0xF0418DE7, 0x56368653,
+        0x9391B8DD, 0x35E6B369, 0x040EA9F4, 0xA279A240,
+        0x5431D2A9, 0xF246D91D, 0xC3AEC380, 0x65D9C834,
+        0xA07EF6BA, 0x0609FD0E, 0x37E1E793, 0x9196EC27,
+        0xCFBD399C, 0x69CA3228, 0x582228B5, 0xFE552301,
+        0x3BF21D8F, 0x9D85163B, 0xAC6D0CA6, 0x0A1A0712,
+        0xFC5277FB, 0x5A257C4F, 0x6BCD66D2, 0xCDBA6D66,
+        0x081D53E8, 0xAE6A585C, 0x9F8242C1, 0x39F54975,
+        0xA863A552, 0x0E14AEE6, 0x3FFCB47B, 0x998BBFCF,
+        0x5C2C8141, 0xFA5B8AF5, 0xCBB39068, 0x6DC49BDC,
+        0x9B8CEB35, 0x3DFBE081, 0x0C13FA1C, 0xAA64F1A8,
+        0x6FC3CF26, 0xC9B4C492, 0xF85CDE0F, 0x5E2BD5BB,
+        0x440B7579, 0xE27C7ECD, 0xD3946450, 0x75E36FE4,
+        0xB044516A, 0x16335ADE, 0x27DB4043, 0x81AC4BF7,
+        0x77E43B1E, 0xD19330AA, 0xE07B2A37, 0x460C2183,
+        0x83AB1F0D, 0x25DC14B9, 0x14340E24, 0xB2430590,
+        0x23D5E9B7, 0x85A2E203, 0xB44AF89E, 0x123DF32A,
+        0xD79ACDA4, 0x71EDC610, 0x4005DC8D, 0xE672D739,
+        0x103AA7D0, 0xB64DAC64, 0x87A5B6F9, 0x21D2BD4D,
+        0xE47583C3, 0x42028877, 0x73EA92EA, 0xD59D995E,
+        0x8BB64CE5, 0x2DC14751, 0x1C295DCC, 0xBA5E5678,
+        0x7FF968F6, 0xD98E6342, 0xE86679DF, 0x4E11726B,
+        0xB8590282, 0x1E2E0936, 0x2FC613AB, 0x89B1181F,
+        0x4C162691, 0xEA612D25, 0xDB8937B8, 0x7DFE3C0C,
+        0xEC68D02B, 0x4A1FDB9F, 0x7BF7C102, 0xDD80CAB6,
+        0x1827F438, 0xBE50FF8C, 0x8FB8E511, 0x29CFEEA5,
+        0xDF879E4C, 0x79F095F8, 0x48188F65, 0xEE6F84D1,
+        0x2BC8BA5F, 0x8DBFB1EB, 0xBC57AB76, 0x1A20A0C2,
+        0x8816EAF2, 0x2E61E146, 0x1F89FBDB, 0xB9FEF06F,
+        0x7C59CEE1, 0xDA2EC555, 0xEBC6DFC8, 0x4DB1D47C,
+        0xBBF9A495, 0x1D8EAF21, 0x2C66B5BC, 0x8A11BE08,
+        0x4FB68086, 0xE9C18B32, 0xD82991AF, 0x7E5E9A1B,
+        0xEFC8763C, 0x49BF7D88, 0x78576715, 0xDE206CA1,
+        0x1B87522F, 0xBDF0599B, 0x8C184306, 0x2A6F48B2,
+        0xDC27385B, 0x7A5033EF, 0x4BB82972, 0xEDCF22C6,
+        0x28681C48, 0x8E1F17FC, 0xBFF70D61, 0x198006D5,
+        0x47ABD36E, 0xE1DCD8DA, 0xD034C247, 0x7643C9F3,
+        0xB3E4F77D, 0x1593FCC9, 0x247BE654, 0x820CEDE0,
+        0x74449D09, 0xD23396BD, 0xE3DB8C20, 0x45AC8794,
+        0x800BB91A, 0x267CB2AE, 0x1794A833, 0xB1E3A387,
+        0x20754FA0, 0x86024414, 0xB7EA5E89, 0x119D553D,
+        0xD43A6BB3, 0x724D6007, 0x43A57A9A, 0xE5D2712E,
+        0x139A01C7, 0xB5ED0A73, 0x840510EE, 0x22721B5A,
+        0xE7D525D4, 0x41A22E60, 0x704A34FD, 0xD63D3F49,
+        0xCC1D9F8B, 0x6A6A943F, 0x5B828EA2, 0xFDF58516,
+        0x3852BB98, 0x9E25B02C, 0xAFCDAAB1, 0x09BAA105,
+        0xFFF2D1EC, 0x5985DA58, 0x686DC0C5, 0xCE1ACB71,
+        0x0BBDF5FF, 0xADCAFE4B, 0x9C22E4D6, 0x3A55EF62,
+        0xABC30345, 0x0DB408F1, 0x3C5C126C, 0x9A2B19D8,
+        0x5F8C2756, 0xF9FB2CE2, 0xC813367F, 0x6E643DCB,
+        0x982C4D22, 0x3E5B4696, 0x0FB35C0B, 0xA9C457BF,
+        0x6C636931, 0xCA146285, 0xFBFC7818, 0x5D8B73AC,
+        0x03A0A617, 0xA5D7ADA3, 0x943FB73E, 0x3248BC8A,
+        0xF7EF8204, 0x519889B0, 0x6070932D, 0xC6079899,
+        0x304FE870, 0x9638E3C4, 0xA7D0F959, 0x01A7F2ED,
+        0xC400CC63, 0x6277C7D7, 0x539FDD4A, 0xF5E8D6FE,
+        0x647E3AD9, 0xC209316D, 0xF3E12BF0, 0x55962044,
+        0x90311ECA, 0x3646157E, 0x07AE0FE3, 0xA1D90457,
+        0x579174BE, 0xF1E67F0A, 0xC00E6597, 0x66796E23,
+        0xA3DE50AD, 0x05A95B19, 0x34414184, 0x92364A30,
+    },
+    {
+        0x00000000, 0xCCAA009E, 0x4225077D, 0x8E8F07E3,
+        0x844A0EFA, 0x48E00E64, 0xC66F0987, 0x0AC50919,
+        0xD3E51BB5, 0x1F4F1B2B, 0x91C01CC8, 0x5D6A1C56,
+        0x57AF154F, 0x9B0515D1, 0x158A1232, 0xD92012AC,
+        0x7CBB312B, 0xB01131B5, 0x3E9E3656, 0xF23436C8,
+        0xF8F13FD1, 0x345B3F4F, 0xBAD438AC, 0x767E3832,
+        0xAF5E2A9E, 0x63F42A00, 0xED7B2DE3, 0x21D12D7D,
+        0x2B142464, 0xE7BE24FA, 0x69312319, 0xA59B2387,
+        0xF9766256, 0x35DC62C8, 0xBB53652B, 0x77F965B5,
+        0x7D3C6CAC, 0xB1966C32, 0x3F196BD1, 0xF3B36B4F,
+        0x2A9379E3, 0xE639797D, 0x68B67E9E, 0xA41C7E00,
+        0xAED97719, 0x62737787, 0xECFC7064, 0x205670FA,
+        0x85CD537D, 0x496753E3, 0xC7E85400, 0x0B42549E,
+        0x01875D87, 0xCD2D5D19, 0x43A25AFA, 0x8F085A64,
+        0x562848C8, 0x9A824856, 0x140D4FB5, 0xD8A74F2B,
+        0xD2624632, 0x1EC846AC, 0x9047414F, 0x5CED41D1,
+        0x299DC2ED, 0xE537C273, 0x6BB8C590, 0xA712C50E,
+        0xADD7CC17, 0x617DCC89, 0xEFF2CB6A, 0x2358CBF4,
+        0xFA78D958, 0x36D2D9C6, 0xB85DDE25, 0x74F7DEBB,
+        0x7E32D7A2, 0xB298D73C, 0x3C17D0DF, 0xF0BDD041,
+        0x5526F3C6, 0x998CF358, 0x1703F4BB, 0xDBA9F425,
+        0xD16CFD3C, 0x1DC6FDA2, 0x9349FA41, 0x5FE3FADF,
+        0x86C3E873, 0x4A69E8ED, 0xC4E6EF0E, 0x084CEF90,
+        0x0289E689, 0xCE23E617, 0x40ACE1F4, 0x8C06E16A,
+        0xD0EBA0BB, 0x1C41A025, 0x92CEA7C6, 0x5E64A758,
+        0x54A1AE41, 0x980BAEDF, 0x1684A93C, 0xDA2EA9A2,
+        0x030EBB0E, 0xCFA4BB90, 0x412BBC73, 0x8D81BCED,
+        0x8744B5F4, 0x4BEEB56A, 0xC561B289, 0x09CBB217,
+        0xAC509190, 0x60FA910E, 0xEE7596ED, 0x22DF9673,
+        0x281A9F6A, 0xE4B09FF4, 0x6A3F9817, 0xA6959889,
+        0x7FB58A25, 0xB31F8ABB, 0x3D908D58, 0xF13A8DC6,
+        0xFBFF84DF, 0x37558441, 0xB9DA83A2, 0x7570833C,
+        0x533B85DA, 0x9F918544, 0x111E82A7, 0xDDB48239,
+        0xD7718B20, 0x1BDB8BBE, 0x95548C5D, 0x59FE8CC3,
+        0x80DE9E6F, 0x4C749EF1, 0xC2FB9912, 0x0E51998C,
+        0x04949095, 0xC83E900B, 0x46B197E8, 0x8A1B9776,
+        0x2F80B4F1, 0xE32AB46F, 0x6DA5B38C, 0xA10FB312,
+        0xABCABA0B, 0x6760BA95, 0xE9EFBD76, 0x2545BDE8,
+        0xFC65AF44, 0x30CFAFDA, 0xBE40A839, 0x72EAA8A7,
+        0x782FA1BE, 0xB485A120, 0x3A0AA6C3, 0xF6A0A65D,
+        0xAA4DE78C, 0x66E7E712, 0xE868E0F1, 0x24C2E06F,
+        0x2E07E976, 0xE2ADE9E8, 0x6C22EE0B, 0xA088EE95,
+        0x79A8FC39, 0xB502FCA7, 0x3B8DFB44, 0xF727FBDA,
+        0xFDE2F2C3, 0x3148F25D, 0xBFC7F5BE, 0x736DF520,
+        0xD6F6D6A7, 0x1A5CD639, 0x94D3D1DA, 0x5879D144,
+        0x52BCD85D, 0x9E16D8C3, 0x1099DF20, 0xDC33DFBE,
+        0x0513CD12, 0xC9B9CD8C, 0x4736CA6F, 0x8B9CCAF1,
+        0x8159C3E8, 0x4DF3C376, 0xC37CC495, 0x0FD6C40B,
+        0x7AA64737, 0xB60C47A9, 0x3883404A, 0xF42940D4,
+        0xFEEC49CD, 0x32464953, 0xBCC94EB0, 0x70634E2E,
+        0xA9435C82, 0x65E95C1C, 0xEB665BFF, 0x27CC5B61,
+        0x2D095278, 0xE1A352E6, 0x6F2C5505, 0xA386559B,
+        0x061D761C, 0xCAB77682, 0x44387161, 0x889271FF,
+        0x825778E6, 0x4EFD7878, 0xC0727F9B, 0x0CD87F05,
+        0xD5F86DA9, 0x19526D37, 0x97DD6AD4, 0x5B776A4A,
+        0x51B26353, 0x9D1863CD, 0x1397642E, 0xDF3D64B0,
+        0x83D02561, 0x4F7A25FF, 0xC1F5221C, 0x0D5F2282,
+        0x079A2B9B, 0xCB302B05, 0x45BF2CE6, 0x89152C78,
+        0x50353ED4, 0x9C9F3E4A, 0x121039A9, 0xDEBA3937,
+        0xD47F302E, 0x18D530B0, 0x965A3753, 0x5AF037CD,
+        0xFF6B144A, 0x33C114D4, 0xBD4E1337, 0x71E413A9,
+        0x7B211AB0, 0xB78B1A2E, 0x39041DCD, 0xF5AE1D53,
+        0x2C8E0FFF, 0xE0240F61, 0x6EAB0882, 0xA201081C,
+        0xA8C40105, 0x646E019B, 0xEAE10678, 0x264B06E6,
+    },
+    {
+        0x00000000, 0x177B1443, 0x2EF62886, 0x398D3CC5,
+        0x5DEC510C, 0x4A97454F, 0x731A798A, 0x64616DC9,
+        0xBBD8A218, 0xACA3B65B, 0x952E8A9E, 0x82559EDD,
+        0xE634F314, 0xF14FE757, 0xC8C2DB92, 0xDFB9CFD1,
+        0xACC04271, 0xBBBB5632, 0x82366AF7, 0x954D7EB4,
+        0xF12C137D, 0xE657073E, 0xDFDA3BFB, 0xC8A12FB8,
+        0x1718E069, 0x0063F42A, 0x39EEC8EF, 0x2E95DCAC,
+        0x4AF4B165, 0x5D8FA526, 0x640299E3, 0x73798DA0,
+        0x82F182A3, 0x958A96E0, 0xAC07AA25, 0xBB7CBE66,
+        0xDF1DD3AF, 0xC866C7EC, 0xF1EBFB29, 0xE690EF6A,
+        0x392920BB, 0x2E5234F8, 0x17DF083D, 0x00A41C7E,
+        0x64C571B7, 0x73BE65F4, 0x4A335931, 0x5D484D72,
+        0x2E31C0D2, 0x394AD491, 0x00C7E854, 0x17BCFC17,
+        0x73DD91DE, 0x64A6859D, 0x5D2BB958, 0x4A50AD1B,
+        0x95E962CA, 0x82927689, 0xBB1F4A4C, 0xAC645E0F,
+        0xC80533C6, 0xDF7E2785, 0xE6F31B40, 0xF1880F03,
+        0xDE920307, 0xC9E91744, 0xF0642B81, 0xE71F3FC2,
+        0x837E520B, 0x94054648, 0xAD887A8D, 0xBAF36ECE,
+        0x654AA11F, 0x7231B55C, 0x4BBC8999, 0x5CC79DDA,
+        0x38A6F013, 0x2FDDE450, 0x1650D895, 0x012BCCD6,
+        0x72524176, 0x65295535, 0x5CA469F0, 0x4BDF7DB3,
+        0x2FBE107A, 0x38C50439, 0x014838FC, 0x16332CBF,
+        0xC98AE36E, 0xDEF1F72D, 0xE77CCBE8, 0xF007DFAB,
+        0x9466B262, 0x831DA621, 0xBA909AE4, 0xADEB8EA7,
+        0x5C6381A4, 0x4B1895E7, 0x7295A922, 0x65EEBD61,
+        0x018FD0A8, 0x16F4C4EB, 0x2F79F82E, 0x3802EC6D,
+        0xE7BB23BC, 0xF0C037FF, 0xC94D0B3A, 0xDE361F79,
+        0xBA5772B0, 0xAD2C66F3, 0x94A15A36, 0x83DA4E75,
+        0xF0A3C3D5, 0xE7D8D796, 0xDE55EB53, 0xC92EFF10,
+        0xAD4F92D9, 0xBA34869A, 0x83B9BA5F, 0x94C2AE1C,
+        0x4B7B61CD, 0x5C00758E, 0x658D494B, 0x72F65D08,
+        0x169730C1, 0x01EC2482, 0x38611847, 0x2F1A0C04,
+        0x6655004F, 0x712E140C, 0x48A328C9, 0x5FD83C8A,
+        0x3BB95143, 0x2CC24500, 0x154F79C5, 0x02346D86,
+        0xDD8DA257, 0xCAF6B614, 0xF37B8AD1, 0xE4009E92,
+        0x8061F35B, 0x971AE718, 0xAE97DBDD, 0xB9ECCF9E,
+        0xCA95423E, 0xDDEE567D, 0xE4636AB8, 0xF3187EFB,
+        0x97791332, 0x80020771, 0xB98F3BB4, 0xAEF42FF7,
+        0x714DE026, 0x6636F465, 0x5FBBC8A0, 0x48C0DCE3,
+        0x2CA1B12A, 0x3BDAA569, 0x025799AC, 0x152C8DEF,
+        0xE4A482EC, 0xF3DF96AF, 0xCA52AA6A, 0xDD29BE29,
+        0xB948D3E0, 0xAE33C7A3, 0x97BEFB66, 0x80C5EF25,
+        0x5F7C20F4, 0x480734B7, 0x718A0872, 0x66F11C31,
+        0x029071F8, 0x15EB65BB, 0x2C66597E, 0x3B1D4D3D,
+        0x4864C09D, 0x5F1FD4DE, 0x6692E81B, 0x71E9FC58,
+        0x15889191, 0x02F385D2, 0x3B7EB917, 0x2C05AD54,
+        0xF3BC6285, 0xE4C776C6, 0xDD4A4A03, 0xCA315E40,
+        0xAE503389, 0xB92B27CA, 0x80A61B0F, 0x97DD0F4C,
+        0xB8C70348, 0xAFBC170B, 0x96312BCE, 0x814A3F8D,
+        0xE52B5244, 0xF2504607, 0xCBDD7AC2, 0xDCA66E81,
+        0x031FA150, 0x1464B513, 0x2DE989D6, 0x3A929D95,
+        0x5EF3F05C, 0x4988E41F, 0x7005D8DA, 0x677ECC99,
+        0x14074139, 0x037C557A, 0x3AF169BF, 0x2D8A7DFC,
+        0x49EB1035, 0x5E900476, 0x671D38B3, 0x70662CF0,
+        0xAFDFE321, 0xB8A4F762, 0x8129CBA7, 0x9652DFE4,
+        0xF233B22D, 0xE548A66E, 0xDCC59AAB, 0xCBBE8EE8,
+        0x3A3681EB, 0x2D4D95A8, 0x14C0A96D, 0x03BBBD2E,
+        0x67DAD0E7, 0x70A1C4A4, 0x492CF861, 0x5E57EC22,
+        0x81EE23F3, 0x969537B0, 0xAF180B75, 0xB8631F36,
+        0xDC0272FF, 0xCB7966BC, 0xF2F45A79, 0xE58F4E3A,
+        0x96F6C39A, 0x818DD7D9, 0xB800EB1C, 0xAF7BFF5F,
+        0xCB1A9296, 0xDC6186D5, 0xE5ECBA10, 0xF297AE53,
+        0x2D2E6182, 0x3A5575C1, 0x03D84904, 0x14A35D47,
+        0x70C2308E, 0x67B924CD, 0x5E341808, 0x494F0C4B,
+    },
+    {
+        0x00000000, 0xEFC26B3E, 0x04F5D03D, 0xEB37BB03,
+        0x09EBA07A, 0xE629CB44, 0x0D1E7047, 0xE2DC1B79,
+        0x13D740F4, 0xFC152BCA, 0x172290C9, 0xF8E0FBF7,
+        0x1A3CE08E, 0xF5FE8BB0, 0x1EC930B3, 0xF10B5B8D,
+        0x27AE81E8, 0xC86CEAD6, 0x235B51D5, 0xCC993AEB,
+        0x2E452192, 0xC1874AAC, 0x2AB0F1AF, 0xC5729A91,
+        0x3479C11C, 0xDBBBAA22, 0x308C1121, 0xDF4E7A1F,
+        0x3D926166, 0xD2500A58, 0x3967B15B, 0xD6A5DA65,
+        0x4F5D03D0, 0xA09F68EE, 0x4BA8D3ED, 0xA46AB8D3,
+        0x46B6A3AA, 0xA974C894, 0x42437397, 0xAD8118A9,
+        0x5C8A4324, 0xB348281A, 0x587F9319, 0xB7BDF827,
+        0x5561E35E, 0xBAA38860, 0x51943363, 0xBE56585D,
+        0x68F38238, 0x8731E906, 0x6C065205, 0x83C4393B,
+        0x61182242, 0x8EDA497C, 0x65EDF27F, 0x8A2F9941,
+        0x7B24C2CC, 0x94E6A9F2, 0x7FD112F1, 0x901379CF,
+        0x72CF62B6, 0x9D0D0988, 0x763AB28B, 0x99F8D9B5,
+        0x9EBA07A0, 0x71786C9E, 0x9A4FD79D, 0x758DBCA3,
+        0x9751A7DA, 0x7893CCE4, 0x93A477E7, 0x7C661CD9,
+        0x8D6D4754, 0x62AF2C6A, 0x89989769, 0x665AFC57,
+        0x8486E72E, 0x6B448C10, 0x80733713, 0x6FB15C2D,
+        0xB9148648, 0x56D6ED76, 0xBDE15675, 0x52233D4B,
+        0xB0FF2632, 0x5F3D4D0C, 0xB40AF60F, 0x5BC89D31,
+        0xAAC3C6BC, 0x4501AD82, 0xAE361681, 0x41F47DBF,
+        0xA32866C6, 0x4CEA0DF8, 0xA7DDB6FB, 0x481FDDC5,
+        0xD1E70470, 0x3E256F4E, 0xD512D44D, 0x3AD0BF73,
+        0xD80CA40A, 0x37CECF34, 0xDCF97437, 0x333B1F09,
+        0xC2304484, 0x2DF22FBA, 0xC6C594B9, 0x2907FF87,
+        0xCBDBE4FE, 0x24198FC0, 0xCF2E34C3, 0x20EC5FFD,
+        0xF6498598, 0x198BEEA6, 0xF2BC55A5, 0x1D7E3E9B,
+        0xFFA225E2, 0x10604EDC, 0xFB57F5DF, 0x14959EE1,
+        0xE59EC56C, 0x0A5CAE52, 0xE16B1551, 0x0EA97E6F,
+        0xEC756516, 0x03B70E28, 0xE880B52B, 0x0742DE15,
+        0xE6050901, 0x09C7623F, 0xE2F0D93C, 0x0D32B202,
+        0xEFEEA97B, 0x002CC245, 0xEB1B7946, 0x04D91278,
+        0xF5D249F5, 0x1A1022CB, 0xF12799C8, 0x1EE5F2F6,
+        0xFC39E98F, 0x13FB82B1, 0xF8CC39B2, 0x170E528C,
+        0xC1AB88E9, 0x2E69E3D7, 0xC55E58D4, 0x2A9C33EA,
+        0xC8402893, 0x278243AD, 0xCCB5F8AE, 0x23779390,
+        0xD27CC81D, 0x3DBEA323, 0xD6891820, 0x394B731E,
+        0xDB976867, 0x34550359, 0xDF62B85A, 0x30A0D364,
+        0xA9580AD1, 0x469A61EF, 0xADADDAEC, 0x426FB1D2,
+        0xA0B3AAAB, 0x4F71C195, 0xA4467A96, 0x4B8411A8,
+        0xBA8F4A25, 0x554D211B, 0xBE7A9A18, 0x51B8F126,
+        0xB364EA5F, 0x5CA68161, 0xB7913A62, 0x5853515C,
+        0x8EF68B39, 0x6134E007, 0x8A035B04, 0x65C1303A,
+        0x871D2B43, 0x68DF407D, 0x83E8FB7E, 0x6C2A9040,
+        0x9D21CBCD, 0x72E3A0F3, 0x99D41BF0, 0x761670CE,
+        0x94CA6BB7, 0x7B080089, 0x903FBB8A, 0x7FFDD0B4,
+        0x78BF0EA1, 0x977D659F, 0x7C4ADE9C, 0x9388B5A2,
+        0x7154AEDB, 0x9E96C5E5, 0x75A17EE6, 0x9A6315D8,
+        0x6B684E55, 0x84AA256B, 0x6F9D9E68, 0x805FF556,
+        0x6283EE2F, 0x8D418511, 0x66763E12, 0x89B4552C,
+        0x5F118F49, 0xB0D3E477, 0x5BE45F74, 0xB426344A,
+        0x56FA2F33, 0xB938440D, 0x520FFF0E, 0xBDCD9430,
+        0x4CC6CFBD, 0xA304A483, 0x48331F80, 0xA7F174BE,
+        0x452D6FC7, 0xAAEF04F9, 0x41D8BFFA, 0xAE1AD4C4,
+        0x37E20D71, 0xD820664F, 0x3317DD4C, 0xDCD5B672,
+        0x3E09AD0B, 0xD1CBC635, 0x3AFC7D36, 0xD53E1608,
+        0x24354D85, 0xCBF726BB, 0x20C09DB8, 0xCF02F686,
+        0x2DDEEDFF, 0xC21C86C1, 0x292B3DC2, 0xC6E956FC,
+        0x104C8C99, 0xFF8EE7A7, 0x14B95CA4, 0xFB7B379A,
+        0x19A72CE3, 0xF66547DD, 0x1D52FCDE, 0xF29097E0,
+        0x039BCC6D, 0xEC59A753, 0x076E1C50, 0xE8AC776E,
+        0x0A706C17, 0xE5B20729, 0x0E85BC2A, 0xE147D714,
+    },
+    {
+        0x00000000, 0xC18EDFC0, 0x586CB9C1, 0x99E26601,
+        0xB0D97382, 0x7157AC42, 0xE8B5CA43, 0x293B1583,
+        0xBAC3E145, 0x7B4D3E85, 0xE2AF5884, 0x23218744,
+        0x0A1A92C7, 0xCB944D07, 0x52762B06, 0x93F8F4C6,
+        0xAEF6C4CB, 0x6F781B0B, 0xF69A7D0A, 0x3714A2CA,
+        0x1E2FB749, 0xDFA16889, 0x46430E88, 0x87CDD148,
+        0x1435258E, 0xD5BBFA4E, 0x4C599C4F, 0x8DD7438F,
+        0xA4EC560C, 0x656289CC, 0xFC80EFCD, 0x3D0E300D,
+        0x869C8FD7, 0x47125017, 0xDEF03616, 0x1F7EE9D6,
+        0x3645FC55, 0xF7CB2395, 0x6E294594, 0xAFA79A54,
+        0x3C5F6E92, 0xFDD1B152, 0x6433D753, 0xA5BD0893,
+        0x8C861D10, 0x4D08C2D0, 0xD4EAA4D1, 0x15647B11,
+        0x286A4B1C, 0xE9E494DC, 0x7006F2DD, 0xB1882D1D,
+        0x98B3389E, 0x593DE75E, 0xC0DF815F, 0x01515E9F,
+        0x92A9AA59, 0x53277599, 0xCAC51398, 0x0B4BCC58,
+        0x2270D9DB, 0xE3FE061B, 0x7A1C601A, 0xBB92BFDA,
+        0xD64819EF, 0x17C6C62F, 0x8E24A02E, 0x4FAA7FEE,
+        0x66916A6D, 0xA71FB5AD, 0x3EFDD3AC, 0xFF730C6C,
+        0x6C8BF8AA, 0xAD05276A, 0x34E7416B, 0xF5699EAB,
+        0xDC528B28, 0x1DDC54E8, 0x843E32E9, 0x45B0ED29,
+        0x78BEDD24, 0xB93002E4, 0x20D264E5, 0xE15CBB25,
+        0xC867AEA6, 0x09E97166, 0x900B1767, 0x5185C8A7,
+        0xC27D3C61, 0x03F3E3A1, 0x9A1185A0, 0x5B9F5A60,
+        0x72A44FE3, 0xB32A9023, 0x2AC8F622, 0xEB4629E2,
+        0x50D49638, 0x915A49F8, 0x08B82FF9, 0xC936F039,
+        0xE00DE5BA, 0x21833A7A, 0xB8615C7B, 0x79EF83BB,
+        0xEA17777D, 0x2B99A8BD, 0xB27BCEBC, 0x73F5117C,
+        0x5ACE04FF, 0x9B40DB3F, 0x02A2BD3E, 0xC32C62FE,
+        0xFE2252F3, 0x3FAC8D33, 0xA64EEB32, 0x67C034F2,
+        0x4EFB2171, 0x8F75FEB1, 0x169798B0, 0xD7194770,
+        0x44E1B3B6, 0x856F6C76, 0x1C8D0A77, 0xDD03D5B7,
+        0xF438C034, 0x35B61FF4, 0xAC5479F5, 0x6DDAA635,
+        0x77E1359F, 0xB66FEA5F, 0x2F8D8C5E, 0xEE03539E,
+        0xC738461D, 0x06B699DD, 0x9F54FFDC, 0x5EDA201C,
+        0xCD22D4DA, 0x0CAC0B1A, 0x954E6D1B, 0x54C0B2DB,
+        0x7DFBA758, 0xBC757898, 0x25971E99, 0xE419C159,
+        0xD917F154, 0x18992E94, 0x817B4895, 0x40F59755,
+        0x69CE82D6, 0xA8405D16, 0x31A23B17, 0xF02CE4D7,
+        0x63D41011, 0xA25ACFD1, 0x3BB8A9D0, 0xFA367610,
+        0xD30D6393, 0x1283BC53, 0x8B61DA52, 0x4AEF0592,
+        0xF17DBA48, 0x30F36588, 0xA9110389, 0x689FDC49,
+        0x41A4C9CA, 0x802A160A, 0x19C8700B, 0xD846AFCB,
+        0x4BBE5B0D, 0x8A3084CD, 0x13D2E2CC, 0xD25C3D0C,
+        0xFB67288F, 0x3AE9F74F, 0xA30B914E, 0x62854E8E,
+        0x5F8B7E83, 0x9E05A143, 0x07E7C742, 0xC6691882,
+        0xEF520D01, 0x2EDCD2C1, 0xB73EB4C0, 0x76B06B00,
+        0xE5489FC6, 0x24C64006, 0xBD242607, 0x7CAAF9C7,
+        0x5591EC44, 0x941F3384, 0x0DFD5585, 0xCC738A45,
+        0xA1A92C70, 0x6027F3B0, 0xF9C595B1, 0x384B4A71,
+        0x11705FF2, 0xD0FE8032, 0x491CE633, 0x889239F3,
+        0x1B6ACD35, 0xDAE412F5, 0x430674F4, 0x8288AB34,
+        0xABB3BEB7, 0x6A3D6177, 0xF3DF0776, 0x3251D8B6,
+        0x0F5FE8BB, 0xCED1377B, 0x5733517A, 0x96BD8EBA,
+        0xBF869B39, 0x7E0844F9, 0xE7EA22F8, 0x2664FD38,
+        0xB59C09FE, 0x7412D63E, 0xEDF0B03F, 0x2C7E6FFF,
+        0x05457A7C, 0xC4CBA5BC, 0x5D29C3BD, 0x9CA71C7D,
+        0x2735A3A7, 0xE6BB7C67, 0x7F591A66, 0xBED7C5A6,
+        0x97ECD025, 0x56620FE5, 0xCF8069E4, 0x0E0EB624,
+        0x9DF642E2, 0x5C789D22, 0xC59AFB23, 0x041424E3,
+        0x2D2F3160, 0xECA1EEA0, 0x754388A1, 0xB4CD5761,
+        0x89C3676C, 0x484DB8AC, 0xD1AFDEAD, 0x1021016D,
+        0x391A14EE, 0xF894CB2E, 0x6176AD2F, 0xA0F872EF,
+        0x33008629, 0xF28E59E9, 0x6B6C3FE8, 0xAAE2E028,
+        0x83D9F5AB, 0x42572A6B, 0xDBB54C6A, 0x1A3B93AA,
+    },
+    {
+        0x00000000, 0x9BA54C6F, 0xEC3B9E9F, 0x779ED2F0,
+        0x03063B7F, 0x98A37710, 0xEF3DA5E0, 0x7498E98F,
+        0x060C76FE, 0x9DA93A91, 0xEA37E861, 0x7192A40E,
+        0x050A4D81, 0x9EAF01EE, 0xE931D31E, 0x72949F71,
+        0x0C18EDFC, 0x97BDA193, 0xE0237363, 0x7B863F0C,
+        0x0F1ED683, 0x94BB9AEC, 0xE325481C, 0x78800473,
+        0x0A149B02, 0x91B1D76D, 0xE62F059D, 0x7D8A49F2,
+        0x0912A07D, 0x92B7EC12, 0xE5293EE2, 0x7E8C728D,
+        0x1831DBF8, 0x83949797, 0xF40A4567, 0x6FAF0908,
+        0x1B37E087, 0x8092ACE8, 0xF70C7E18, 0x6CA93277,
+        0x1E3DAD06, 0x8598E169, 0xF2063399, 0x69A37FF6,
+        0x1D3B9679, 0x869EDA16, 0xF10008E6, 0x6AA54489,
+        0x14293604, 0x8F8C7A6B, 0xF812A89B, 0x63B7E4F4,
+        0x172F0D7B, 0x8C8A4114, 0xFB1493E4, 0x60B1DF8B,
+        0x122540FA, 0x89800C95, 0xFE1EDE65, 0x65BB920A,
+        0x11237B85, 0x8A8637EA, 0xFD18E51A, 0x66BDA975,
+        0x3063B7F0, 0xABC6FB9F, 0xDC58296F, 0x47FD6500,
+        0x33658C8F, 0xA8C0C0E0, 0xDF5E1210, 0x44FB5E7F,
+        0x366FC10E, 0xADCA8D61, 0xDA545F91, 0x41F113FE,
+        0x3569FA71, 0xAECCB61E, 0xD95264EE, 0x42F72881,
+        0x3C7B5A0C, 0xA7DE1663, 0xD040C493, 0x4BE588FC,
+        0x3F7D6173, 0xA4D82D1C, 0xD346FFEC, 0x48E3B383,
+        0x3A772CF2, 0xA1D2609D, 0xD64CB26D, 0x4DE9FE02,
+        0x3971178D, 0xA2D45BE2, 0xD54A8912, 0x4EEFC57D,
+        0x28526C08, 0xB3F72067, 0xC469F297, 0x5FCCBEF8,
+        0x2B545777, 0xB0F11B18, 0xC76FC9E8, 0x5CCA8587,
+        0x2E5E1AF6, 0xB5FB5699, 0xC2658469, 0x59C0C806,
+        0x2D582189, 0xB6FD6DE6, 0xC163BF16, 0x5AC6F379,
+        0x244A81F4, 0xBFEFCD9B, 0xC8711F6B, 0x53D45304,
+        0x274CBA8B, 0xBCE9F6E4, 0xCB772414, 0x50D2687B,
+        0x2246F70A, 0xB9E3BB65, 0xCE7D6995, 0x55D825FA,
+        0x2140CC75, 0xBAE5801A, 0xCD7B52EA, 0x56DE1E85,
+        0x60C76FE0, 0xFB62238F, 0x8CFCF17F, 0x1759BD10,
+        0x63C1549F, 0xF86418F0, 0x8FFACA00, 0x145F866F,
+        0x66CB191E, 0xFD6E5571, 0x8AF08781, 0x1155CBEE,
+        0x65CD2261, 0xFE686E0E, 0x89F6BCFE, 0x1253F091,
+        0x6CDF821C, 0xF77ACE73, 0x80E41C83, 0x1B4150EC,
+        0x6FD9B963, 0xF47CF50C, 0x83E227FC, 0x18476B93,
+        0x6AD3F4E2, 0xF176B88D, 0x86E86A7D, 0x1D4D2612,
+        0x69D5CF9D, 0xF27083F2, 0x85EE5102, 0x1E4B1D6D,
+        0x78F6B418, 0xE353F877, 0x94CD2A87, 0x0F6866E8,
+        0x7BF08F67, 0xE055C308, 0x97CB11F8, 0x0C6E5D97,
+        0x7EFAC2E6, 0xE55F8E89, 0x92C15C79, 0x09641016,
+        0x7DFCF999, 0xE659B5F6, 0x91C76706, 0x0A622B69,
+        0x74EE59E4, 0xEF4B158B, 0x98D5C77B, 0x03708B14,
+        0x77E8629B, 0xEC4D2EF4, 0x9BD3FC04, 0x0076B06B,
+        0x72E22F1A, 0xE9476375, 0x9ED9B185, 0x057CFDEA,
+        0x71E41465, 0xEA41580A, 0x9DDF8AFA, 0x067AC695,
+        0x50A4D810, 0xCB01947F, 0xBC9F468F, 0x273A0AE0,
+        0x53A2E36F, 0xC807AF00, 0xBF997DF0, 0x243C319F,
+        0x56A8AEEE, 0xCD0DE281, 0xBA933071, 0x21367C1E,
+        0x55AE9591, 0xCE0BD9FE, 0xB9950B0E, 0x22304761,
+        0x5CBC35EC, 0xC7197983, 0xB087AB73, 0x2B22E71C,
+        0x5FBA0E93, 0xC41F42FC, 0xB381900C, 0x2824DC63,
+        0x5AB04312, 0xC1150F7D, 0xB68BDD8D, 0x2D2E91E2,
+        0x59B6786D, 0xC2133402, 0xB58DE6F2, 0x2E28AA9D,
+        0x489503E8, 0xD3304F87, 0xA4AE9D77, 0x3F0BD118,
+        0x4B933897, 0xD03674F8, 0xA7A8A608, 0x3C0DEA67,
+        0x4E997516, 0xD53C3979, 0xA2A2EB89, 0x3907A7E6,
+        0x4D9F4E69, 0xD63A0206, 0xA1A4D0F6, 0x3A019C99,
+        0x448DEE14, 0xDF28A27B, 0xA8B6708B, 0x33133CE4,
+        0x478BD56B, 0xDC2E9904, 0xABB04BF4, 0x3015079B,
+        0x428198EA, 0xD924D485, 0xAEBA0675, 0x351F4A1A,
+        0x4187A395, 0xDA22EFFA, 0xADBC3D0A, 0x36197165,
+    },
+    {
+        0x00000000, 0xDD96D985, 0x605CB54B, 0xBDCA6CCE,
+        0xC0B96A96, 0x1D2FB313, 0xA0E5DFDD, 0x7D730658,
+        0x5A03D36D, 0x87950AE8, 0x3A5F6626, 0xE7C9BFA3,
+        0x9ABAB9FB, 0x472C607E, 0xFAE60CB0, 0x2770D535,
+        0xB407A6DA, 0x69917F5F, 0xD45B1391, 0x09CDCA14,
+        0x74BECC4C, 0xA92815C9, 0x14E27907, 0xC974A082,
+        0xEE0475B7, 0x3392AC32, 0x8E58C0FC, 0x53CE1979,
+        0x2EBD1F21, 0xF32BC6A4, 0x4EE1AA6A, 0x937773EF,
+        0xB37E4BF5, 0x6EE89270, 0xD322FEBE, 0x0EB4273B,
+        0x73C72163, 0xAE51F8E6, 0x139B9428, 0xCE0D4DAD,
+        0xE97D9898, 0x34EB411D, 0x89212DD3, 0x54B7F456,
+        0x29C4F20E, 0xF4522B8B, 0x49984745, 0x940E9EC0,
+        0x0779ED2F, 0xDAEF34AA, 0x67255864, 0xBAB381E1,
+        0xC7C087B9, 0x1A565E3C, 0xA79C32F2, 0x7A0AEB77,
+        0x5D7A3E42, 0x80ECE7C7, 0x3D268B09, 0xE0B0528C,
+        0x9DC354D4, 0x40558D51, 0xFD9FE19F, 0x2009381A,
+        0xBD8D91AB, 0x601B482E, 0xDDD124E0, 0x0047FD65,
+        0x7D34FB3D, 0xA0A222B8, 0x1D684E76, 0xC0FE97F3,
+        0xE78E42C6, 0x3A189B43, 0x87D2F78D, 0x5A442E08,
+        0x27372850, 0xFAA1F1D5, 0x476B9D1B, 0x9AFD449E,
+        0x098A3771, 0xD41CEEF4, 0x69D6823A, 0xB4405BBF,
+        0xC9335DE7, 0x14A58462, 0xA96FE8AC, 0x74F93129,
+        0x5389E41C, 0x8E1F3D99, 0x33D55157, 0xEE4388D2,
+        0x93308E8A, 0x4EA6570F, 0xF36C3BC1, 0x2EFAE244,
+        0x0EF3DA5E, 0xD36503DB, 0x6EAF6F15, 0xB339B690,
+        0xCE4AB0C8, 0x13DC694D, 0xAE160583, 0x7380DC06,
+        0x54F00933, 0x8966D0B6, 0x34ACBC78, 0xE93A65FD,
+        0x944963A5, 0x49DFBA20, 0xF415D6EE, 0x29830F6B,
+        0xBAF47C84, 0x6762A501, 0xDAA8C9CF, 0x073E104A,
+        0x7A4D1612, 0xA7DBCF97, 0x1A11A359, 0xC7877ADC,
+        0xE0F7AFE9, 0x3D61766C, 0x80AB1AA2, 0x5D3DC327,
+        0x204EC57F, 0xFDD81CFA, 0x40127034, 0x9D84A9B1,
+        0xA06A2517, 0x7DFCFC92, 0xC036905C, 0x1DA049D9,
+        0x60D34F81, 0xBD459604, 0x008FFACA, 0xDD19234F,
+        0xFA69F67A, 0x27FF2FFF, 0x9A354331, 0x47A39AB4,
+        0x3AD09CEC, 0xE7464569, 0x5A8C29A7, 0x871AF022,
+        0x146D83CD, 0xC9FB5A48, 0x74313686, 0xA9A7EF03,
+        0xD4D4E95B, 0x094230DE, 0xB4885C10, 0x691E8595,
+        0x4E6E50A0, 0x93F88925, 0x2E32E5EB, 0xF3A43C6E,
+        0x8ED73A36, 0x5341E3B3, 0xEE8B8F7D, 0x331D56F8,
+        0x13146EE2, 0xCE82B767, 0x7348DBA9, 0xAEDE022C,
+        0xD3AD0474, 0x0E3BDDF1, 0xB3F1B13F, 0x6E6768BA,
+        0x4917BD8F, 0x9481640A, 0x294B08C4, 0xF4DDD141,
+        0x89AED719, 0x54380E9C, 0xE9F26252, 0x3464BBD7,
+        0xA713C838, 0x7A8511BD, 0xC74F7D73, 0x1AD9A4F6,
+        0x67AAA2AE, 0xBA3C7B2B, 0x07F617E5, 0xDA60CE60,
+        0xFD101B55, 0x2086C2D0, 0x9D4CAE1E, 0x40DA779B,
+        0x3DA971C3, 0xE03FA846, 0x5DF5C488, 0x80631D0D,
+        0x1DE7B4BC, 0xC0716D39, 0x7DBB01F7, 0xA02DD872,
+        0xDD5EDE2A, 0x00C807AF, 0xBD026B61, 0x6094B2E4,
+        0x47E467D1, 0x9A72BE54, 0x27B8D29A, 0xFA2E0B1F,
+        0x875D0D47, 0x5ACBD4C2, 0xE701B80C, 0x3A976189,
+        0xA9E01266, 0x7476CBE3, 0xC9BCA72D, 0x142A7EA8,
+        0x695978F0, 0xB4CFA175, 0x0905CDBB, 0xD493143E,
+        0xF3E3C10B, 0x2E75188E, 0x93BF7440, 0x4E29ADC5,
+        0x335AAB9D, 0xEECC7218, 0x53061ED6, 0x8E90C753,
+        0xAE99FF49, 0x730F26CC, 0xCEC54A02, 0x13539387,
+        0x6E2095DF, 0xB3B64C5A, 0x0E7C2094, 0xD3EAF911,
+        0xF49A2C24, 0x290CF5A1, 0x94C6996F, 0x495040EA,
+        0x342346B2, 0xE9B59F37, 0x547FF3F9, 0x89E92A7C,
+        0x1A9E5993, 0xC7088016, 0x7AC2ECD8, 0xA754355D,
+        0xDA273305, 0x07B1EA80, 0xBA7B864E, 0x67ED5FCB,
+        0x409D8AFE, 0x9D0B537B, 0x20C13FB5, 0xFD57E630,
+        0x8024E068, 0x5DB239ED, 0xE0785523, 0x3DEE8CA6,
+    },
+    {
+        0x00000000, 0x9D0FE176, 0xE16EC4AD, 0x7C6125DB,
+        0x19AC8F1B, 0x84A36E6D, 0xF8C24BB6, 0x65CDAAC0,
+        0x33591E36, 0xAE56FF40, 0xD237DA9B, 0x4F383BED,
+        0x2AF5912D, 0xB7FA705B, 0xCB9B5580, 0x5694B4F6,
+        0x66B23C6C, 0xFBBDDD1A, 0x87DCF8C1, 0x1AD319B7,
+        0x7F1EB377, 0xE2115201, 0x9E7077DA, 0x037F96AC,
+        0x55EB225A, 0xC8E4C32C, 0xB485E6F7, 0x298A0781,
+        0x4C47AD41, 0xD1484C37, 0xAD2969EC, 0x3026889A,
+        0xCD6478D8, 0x506B99AE, 0x2C0ABC75, 0xB1055D03,
+        0xD4C8F7C3, 0x49C716B5, 0x35A6336E, 0xA8A9D218,
+        0xFE3D66EE, 0x63328798, 0x1F53A243, 0x825C4335,
+        0xE791E9F5, 0x7A9E0883, 0x06FF2D58, 0x9BF0CC2E,
+        0xABD644B4, 0x36D9A5C2, 0x4AB88019, 0xD7B7616F,
+        0xB27ACBAF, 0x2F752AD9, 0x53140F02, 0xCE1BEE74,
+        0x988F5A82, 0x0580BBF4, 0x79E19E2F, 0xE4EE7F59,
+        0x8123D599, 0x1C2C34EF, 0x604D1134, 0xFD42F042,
+        0x41B9F7F1, 0xDCB61687, 0xA0D7335C, 0x3DD8D22A,
+        0x581578EA, 0xC51A999C, 0xB97BBC47, 0x24745D31,
+        0x72E0E9C7, 0xEFEF08B1, 0x938E2D6A, 0x0E81CC1C,
+        0x6B4C66DC, 0xF64387AA, 0x8A22A271, 0x172D4307,
+        0x270BCB9D, 0xBA042AEB, 0xC6650F30, 0x5B6AEE46,
+        0x3EA74486, 0xA3A8A5F0, 0xDFC9802B, 0x42C6615D,
+        0x1452D5AB, 0x895D34DD, 0xF53C1106, 0x6833F070,
+        0x0DFE5AB0, 0x90F1BBC6, 0xEC909E1D, 0x719F7F6B,
+        0x8CDD8F29, 0x11D26E5F, 0x6DB34B84, 0xF0BCAAF2,
+        0x95710032, 0x087EE144, 0x741FC49F, 0xE91025E9,
+        0xBF84911F, 0x228B7069, 0x5EEA55B2, 0xC3E5B4C4,
+        0xA6281E04, 0x3B27FF72, 0x4746DAA9, 0xDA493BDF,
+        0xEA6FB345, 0x77605233, 0x0B0177E8, 0x960E969E,
+        0xF3C33C5E, 0x6ECCDD28, 0x12ADF8F3, 0x8FA21985,
+        0xD936AD73, 0x44394C05, 0x385869DE, 0xA55788A8,
+        0xC09A2268, 0x5D95C31E, 0x21F4E6C5, 0xBCFB07B3,
+        0x8373EFE2, 0x1E7C0E94, 0x621D2B4F, 0xFF12CA39,
+        0x9ADF60F9, 0x07D0818F, 0x7BB1A454, 0xE6BE4522,
+        0xB02AF1D4, 0x2D2510A2, 0x51443579, 0xCC4BD40F,
+        0xA9867ECF, 0x34899FB9, 0x48E8BA62, 0xD5E75B14,
+        0xE5C1D38E, 0x78CE32F8, 0x04AF1723, 0x99A0F655,
+        0xFC6D5C95, 0x6162BDE3, 0x1D039838, 0x800C794E,
+        0xD698CDB8, 0x4B972CCE, 0x37F60915, 0xAAF9E863,
+        0xCF3442A3, 0x523BA3D5, 0x2E5A860E, 0xB3556778,
+        0x4E17973A, 0xD318764C, 0xAF795397, 0x3276B2E1,
+        0x57BB1821, 0xCAB4F957, 0xB6D5DC8C, 0x2BDA3DFA,
+        0x7D4E890C, 0xE041687A, 0x9C204DA1, 0x012FACD7,
+        0x64E20617, 0xF9EDE761, 0x858CC2BA, 0x188323CC,
+        0x28A5AB56, 0xB5AA4A20, 0xC9CB6FFB, 0x54C48E8D,
+        0x3109244D, 0xAC06C53B, 0xD067E0E0, 0x4D680196,
+        0x1BFCB560, 0x86F35416, 0xFA9271CD, 0x679D90BB,
+        0x02503A7B, 0x9F5FDB0D, 0xE33EFED6, 0x7E311FA0,
+        0xC2CA1813, 0x5FC5F965, 0x23A4DCBE, 0xBEAB3DC8,
+        0xDB669708, 0x4669767E, 0x3A0853A5, 0xA707B2D3,
+        0xF1930625, 0x6C9CE753, 0x10FDC288, 0x8DF223FE,
+        0xE83F893E, 0x75306848, 0x09514D93, 0x945EACE5,
+        0xA478247F, 0x3977C509, 0x4516E0D2, 0xD81901A4,
+        0xBDD4AB64, 0x20DB4A12, 0x5CBA6FC9, 0xC1B58EBF,
+        0x97213A49, 0x0A2EDB3F, 0x764FFEE4, 0xEB401F92,
+        0x8E8DB552, 0x13825424, 0x6FE371FF, 0xF2EC9089,
+        0x0FAE60CB, 0x92A181BD, 0xEEC0A466, 0x73CF4510,
+        0x1602EFD0, 0x8B0D0EA6, 0xF76C2B7D, 0x6A63CA0B,
+        0x3CF77EFD, 0xA1F89F8B, 0xDD99BA50, 0x40965B26,
+        0x255BF1E6, 0xB8541090, 0xC435354B, 0x593AD43D,
+        0x691C5CA7, 0xF413BDD1, 0x8872980A, 0x157D797C,
+        0x70B0D3BC, 0xEDBF32CA, 0x91DE1711, 0x0CD1F667,
+        0x5A454291, 0xC74AA3E7, 0xBB2B863C, 0x2624674A,
+        0x43E9CD8A, 0xDEE62CFC, 0xA2870927, 0x3F88E851,
+    },
+    {
+        0x00000000, 0xB9FBDBE8, 0xA886B191, 0x117D6A79,
+        0x8A7C6563, 0x3387BE8B, 0x22FAD4F2, 0x9B010F1A,
+        0xCF89CC87, 0x7672176F, 0x670F7D16, 0xDEF4A6FE,
+        0x45F5A9E4, 0xFC0E720C, 0xED731875, 0x5488C39D,
+        0x44629F4F, 0xFD9944A7, 0xECE42EDE, 0x551FF536,
+        0xCE1EFA2C, 0x77E521C4, 0x66984BBD, 0xDF639055,
+        0x8BEB53C8, 0x32108820, 0x236DE259, 0x9A9639B1,
+        0x019736AB, 0xB86CED43, 0xA911873A, 0x10EA5CD2,
+        0x88C53E9E, 0x313EE576, 0x20438F0F, 0x99B854E7,
+        0x02B95BFD, 0xBB428015, 0xAA3FEA6C, 0x13C43184,
+        0x474CF219, 0xFEB729F1, 0xEFCA4388, 0x56319860,
+        0xCD30977A, 0x74CB4C92, 0x65B626EB, 0xDC4DFD03,
+        0xCCA7A1D1, 0x755C7A39, 0x64211040, 0xDDDACBA8,
+        0x46DBC4B2, 0xFF201F5A, 0xEE5D7523, 0x57A6AECB,
+        0x032E6D56, 0xBAD5B6BE, 0xABA8DCC7, 0x1253072F,
+        0x89520835, 0x30A9D3DD, 0x21D4B9A4, 0x982F624C,
+        0xCAFB7B7D, 0x7300A095, 0x627DCAEC, 0xDB861104,
+        0x40871E1E, 0xF97CC5F6, 0xE801AF8F, 0x51FA7467,
+        0x0572B7FA, 0xBC896C12, 0xADF4066B, 0x140FDD83,
+        0x8F0ED299, 0x36F50971, 0x27886308, 0x9E73B8E0,
+        0x8E99E432, 0x37623FDA, 0x261F55A3, 0x9FE48E4B,
+        0x04E58151, 0xBD1E5AB9, 0xAC6330C0, 0x1598EB28,
+        0x411028B5, 0xF8EBF35D, 0xE9969924, 0x506D42CC,
+        0xCB6C4DD6, 0x7297963E, 0x63EAFC47, 0xDA1127AF,
+        0x423E45E3, 0xFBC59E0B, 0xEAB8F472, 0x53432F9A,
+        0xC8422080, 0x71B9FB68, 0x60C49111, 0xD93F4AF9,
+        0x8DB78964, 0x344C528C, 0x253138F5, 0x9CCAE31D,
+        0x07CBEC07, 0xBE3037EF, 0xAF4D5D96, 0x16B6867E,
+        0x065CDAAC, 0xBFA70144, 0xAEDA6B3D, 0x1721B0D5,
+        0x8C20BFCF, 0x35DB6427, 0x24A60E5E, 0x9D5DD5B6,
+        0xC9D5162B, 0x702ECDC3, 0x6153A7BA, 0xD8A87C52,
+        0x43A97348, 0xFA52A8A0, 0xEB2FC2D9, 0x52D41931,
+        0x4E87F0BB, 0xF77C2B53, 0xE601412A, 0x5FFA9AC2,
+        0xC4FB95D8, 0x7D004E30, 0x6C7D2449, 0xD586FFA1,
+        0x810E3C3C, 0x38F5E7D4, 0x29888DAD, 0x90735645,
+        0x0B72595F, 0xB28982B7, 0xA3F4E8CE, 0x1A0F3326,
+        0x0AE56FF4, 0xB31EB41C, 0xA263DE65, 0x1B98058D,
+        0x80990A97, 0x3962D17F, 0x281FBB06, 0x91E460EE,
+        0xC56CA373, 0x7C97789B, 0x6DEA12E2, 0xD411C90A,
+        0x4F10C610, 0xF6EB1DF8, 0xE7967781, 0x5E6DAC69,
+        0xC642CE25, 0x7FB915CD, 0x6EC47FB4, 0xD73FA45C,
+        0x4C3EAB46, 0xF5C570AE, 0xE4B81AD7, 0x5D43C13F,
+        0x09CB02A2, 0xB030D94A, 0xA14DB333, 0x18B668DB,
+        0x83B767C1, 0x3A4CBC29, 0x2B31D650, 0x92CA0DB8,
+        0x8220516A, 0x3BDB8A82, 0x2AA6E0FB, 0x935D3B13,
+        0x085C3409, 0xB1A7EFE1, 0xA0DA8598, 0x19215E70,
+        0x4DA99DED, 0xF4524605, 0xE52F2C7C, 0x5CD4F794,
+        0xC7D5F88E, 0x7E2E2366, 0x6F53491F, 0xD6A892F7,
+        0x847C8BC6, 0x3D87502E, 0x2CFA3A57, 0x9501E1BF,
+        0x0E00EEA5, 0xB7FB354D, 0xA6865F34, 0x1F7D84DC,
+        0x4BF54741, 0xF20E9CA9, 0xE373F6D0, 0x5A882D38,
+        0xC1892222, 0x7872F9CA, 0x690F93B3, 0xD0F4485B,
+        0xC01E1489, 0x79E5CF61, 0x6898A518, 0xD1637EF0,
+        0x4A6271EA, 0xF399AA02, 0xE2E4C07B, 0x5B1F1B93,
+        0x0F97D80E, 0xB66C03E6, 0xA711699F, 0x1EEAB277,
+        0x85EBBD6D, 0x3C106685, 0x2D6D0CFC, 0x9496D714,
+        0x0CB9B558, 0xB5426EB0, 0xA43F04C9, 0x1DC4DF21,
+        0x86C5D03B, 0x3F3E0BD3, 0x2E4361AA, 0x97B8BA42,
+        0xC33079DF, 0x7ACBA237, 0x6BB6C84E, 0xD24D13A6,
+        0x494C1CBC, 0xF0B7C754, 0xE1CAAD2D, 0x583176C5,
+        0x48DB2A17, 0xF120F1FF, 0xE05D9B86, 0x59A6406E,
+        0xC2A74F74, 0x7B5C949C, 0x6A21FEE5, 0xD3DA250D,
+        0x8752E690, 0x3EA93D78, 0x2FD45701, 0x962F8CE9,
+        0x0D2E83F3, 0xB4D5581B, 0xA5A83262, 0x1C53E98A,
+    },
+    {
+        0x00000000, 0xAE689191, 0x87A02563, 0x29C8B4F2,
+        0xD4314C87, 0x7A59DD16, 0x539169E4, 0xFDF9F875,
+        0x73139F4F, 0xDD7B0EDE, 0xF4B3BA2C, 0x5ADB2BBD,
+        0xA722D3C8, 0x094A4259, 0x2082F6AB, 0x8EEA673A,
+        0xE6273E9E, 0x484FAF0F, 0x61871BFD, 0xCFEF8A6C,
+        0x32167219, 0x9C7EE388, 0xB5B6577A, 0x1BDEC6EB,
+        0x9534A1D1, 0x3B5C3040, 0x129484B2, 0xBCFC1523,
+        0x4105ED56, 0xEF6D7CC7, 0xC6A5C835, 0x68CD59A4,
+        0x173F7B7D, 0xB957EAEC, 0x909F5E1E, 0x3EF7CF8F,
+        0xC30E37FA, 0x6D66A66B, 0x44AE1299, 0xEAC68308,
+        0x642CE432, 0xCA4475A3, 0xE38CC151, 0x4DE450C0,
+        0xB01DA8B5, 0x1E753924, 0x37BD8DD6, 0x99D51C47,
+        0xF11845E3, 0x5F70D472, 0x76B86080, 0xD8D0F111,
+        0x25290964, 0x8B4198F5, 0xA2892C07, 0x0CE1BD96,
+        0x820BDAAC, 0x2C634B3D, 0x05ABFFCF, 0xABC36E5E,
+        0x563A962B, 0xF85207BA, 0xD19AB348, 0x7FF222D9,
+        0x2E7EF6FA, 0x8016676B, 0xA9DED399, 0x07B64208,
+        0xFA4FBA7D, 0x54272BEC, 0x7DEF9F1E, 0xD3870E8F,
+        0x5D6D69B5, 0xF305F824, 0xDACD4CD6, 0x74A5DD47,
+        0x895C2532, 0x2734B4A3, 0x0EFC0051, 0xA09491C0,
+        0xC859C864, 0x663159F5, 0x4FF9ED07, 0xE1917C96,
+        0x1C6884E3, 0xB2001572, 0x9BC8A180, 0x35A03011,
+        0xBB4A572B, 0x1522C6BA, 0x3CEA7248, 0x9282E3D9,
+        0x6F7B1BAC, 0xC1138A3D, 0xE8DB3ECF, 0x46B3AF5E,
+        0x39418D87, 0x97291C16, 0xBEE1A8E4, 0x10893975,
+        0xED70C100, 0x43185091, 0x6AD0E463, 0xC4B875F2,
+        0x4A5212C8, 0xE43A8359, 0xCDF237AB, 0x639AA63A,
+        0x9E635E4F, 0x300BCFDE, 0x19C37B2C, 0xB7ABEABD,
+        0xDF66B319, 0x710E2288, 0x58C6967A, 0xF6AE07EB,
+        0x0B57FF9E, 0xA53F6E0F, 0x8CF7DAFD, 0x229F4B6C,
+        0xAC752C56, 0x021DBDC7, 0x2BD50935, 0x85BD98A4,
+        0x784460D1, 0xD62CF140, 0xFFE445B2, 0x518CD423,
+        0x5CFDEDF4, 0xF2957C65, 0xDB5DC897, 0x75355906,
+        0x88CCA173, 0x26A430E2, 0x0F6C8410, 0xA1041581,
+        0x2FEE72BB, 0x8186E32A, 0xA84E57D8, 0x0626C649,
+        0xFBDF3E3C, 0x55B7AFAD, 0x7C7F1B5F, 0xD2178ACE,
+        0xBADAD36A, 0x14B242FB, 0x3D7AF609, 0x93126798,
+        0x6EEB9FED, 0xC0830E7C, 0xE94BBA8E, 0x47232B1F,
+        0xC9C94C25, 0x67A1DDB4, 0x4E696946, 0xE001F8D7,
+        0x1DF800A2, 0xB3909133, 0x9A5825C1, 0x3430B450,
+        0x4BC29689, 0xE5AA0718, 0xCC62B3EA, 0x620A227B,
+        0x9FF3DA0E, 0x319B4B9F, 0x1853FF6D, 0xB63B6EFC,
+        0x38D109C6, 0x96B99857, 0xBF712CA5, 0x1119BD34,
+        0xECE04541, 0x4288D4D0, 0x6B406022, 0xC528F1B3,
+        0xADE5A817, 0x038D3986, 0x2A458D74, 0x842D1CE5,
+        0x79D4E490, 0xD7BC7501, 0xFE74C1F3, 0x501C5062,
+        0xDEF63758, 0x709EA6C9, 0x5956123B, 0xF73E83AA,
+        0x0AC77BDF, 0xA4AFEA4E, 0x8D675EBC, 0x230FCF2D,
+        0x72831B0E, 0xDCEB8A9F, 0xF5233E6D, 0x5B4BAFFC,
+        0xA6B25789, 0x08DAC618, 0x211272EA, 0x8F7AE37B,
+        0x01908441, 0xAFF815D0, 0x8630A122, 0x285830B3,
+        0xD5A1C8C6, 0x7BC95957, 0x5201EDA5, 0xFC697C34,
+        0x94A42590, 0x3ACCB401, 0x130400F3, 0xBD6C9162,
+        0x40956917, 0xEEFDF886, 0xC7354C74, 0x695DDDE5,
+        0xE7B7BADF, 0x49DF2B4E, 0x60179FBC, 0xCE7F0E2D,
+        0x3386F658, 0x9DEE67C9, 0xB426D33B, 0x1A4E42AA,
+        0x65BC6073, 0xCBD4F1E2, 0xE21C4510, 0x4C74D481,
+        0xB18D2CF4, 0x1FE5BD65, 0x362D0997, 0x98459806,
+        0x16AFFF3C, 0xB8C76EAD, 0x910FDA5F, 0x3F674BCE,
+        0xC29EB3BB, 0x6CF6222A, 0x453E96D8, 0xEB560749,
+        0x839B5EED, 0x2DF3CF7C, 0x043B7B8E, 0xAA53EA1F,
+        0x57AA126A, 0xF9C283FB, 0xD00A3709, 0x7E62A698,
+        0xF088C1A2, 0x5EE05033, 0x7728E4C1, 0xD9407550,
+        0x24B98D25, 0x8AD11CB4, 0xA319A846, 0x0D7139D7,
+    },
+};
+
+// CRC-32/ISO-HDLC powers x^(2^k) mod P (reflected)
+const u32 CRC32_X2N_TABLE[64] =
+{
+    0x40000000, 0x20000000, 0x08000000, 0x00800000,
+    0x00008000, 0xEDB88320, 0xB1E6B092, 0xA06A2517,
+    0xED627DAE, 0x88D14467, 0xD7BBFE6A, 0xEC447F11,
+    0x8E7EA170, 0x6427800E, 0x4D47BAE0, 0x09FE548F,
+    0x83852D0F, 0x30362F1A, 0x7B5A9CC3, 0x31FEC169,
+    0x9FEC022A, 0x6C8DEDC4, 0x15D6874D, 0x5FDE7A4E,
+    0xBAD90E37, 0x2E4E5EEF, 0x4EABA214, 0xA8A472C0,
+    0x429A969E, 0x148D302A, 0xC40BA6D0, 0xC4E22C3C,
+    0x40000000, 0x20000000, 0x08000000, 0x00800000,
+    0x00008000, 0xEDB88320, 0xB1E6B092, 0xA06A2517,
+    0xED627DAE, 0x88D14467, 0xD7BBFE6A, 0xEC447F11,
+    0x8E7EA170, 0x6427800E, 0x4D47BAE0, 0x09FE548F,
+    0x83852D0F, 0x30362F1A, 0x7B5A9CC3, 0x31FEC169,
+    0x9FEC022A, 0x6C8DEDC4, 0x15D6874D, 0x5FDE7A4E,
+    0xBAD90E37, 0x2E4E5EEF, 0x4EABA214, 0xA8A472C0,
+    0x429A969E, 0x148D302A, 0xC40BA6D0, 0xC4E22C3C,
+};
+
+// CRC-32/ISO-HDLC folding constants
+const crc_clmul_consts CRC32_CLMUL =
+{
+    .fold128 = { U64_C(0x65673B4600000000), U64_C(0x9BA54C6F00000000) },
+    .fold256 = { U64_C(0x9570D49500000000), U64_C(0x01B5FD1D00000000) },
+    .fold512 = { U64_C(0x653D982200000000), U64_C(0xCAD38E8F00000000) },
+    .fold1024 = { U64_C(0x7D657A1000000000), U64_C(0x7406FA9500000000) },
+    .fold2048 = { U64_C(0x7CC8E1E700000000), U64_C(0x03F9F86300000000) },
+    .reduce = { U64_C(0xCCAA009E00000000), U64_C(0x00000000B8BC6765) },
+    .barrett = { U64_C(0xFB808B2080000000), U64_C(0xEDB8832080000000) },
+};
+
+// CRC-32/ISCSI slicing tables (generic engine)
+const u64 CRC32C_SLICE64_TABLE[8][256] =
+{
+    {
+        U64_C(0x0000000000000000), U64_C(0x00000000F26B8303), U64_C(0x00000000E13B70F7), U64_C(0x000000001350F3F4),
+        U64_C(0x00000000C79A971F), U64_C(0x0000000035F1141C), U64_C(0x0000000026A1E7E8), U64_C(0x00000000D4CA64EB),
+        U64_C(0x000000008AD958CF), U64_C(0x0000000078B2DBCC), U64_C(0x000000006BE22838), U64_C(0x000000009989AB3B),
+        U64_C(0x000000004D43CFD0), U64_C(0x00000000BF284CD3), U64_C(0x00000000AC78BF27), U64_C(0x000000005E133C24),
+        U64_C(0x00000000105EC76F), U64_C(0x00000000E235446C), U64_C(0x00000000F165B798), U64_C(0x00000000030E349B),
+        U64_C(0x00000000D7C45070), U64_C(0x0000000025AFD373), U64_C(0x0000000036FF2087), U64_C(0x00000000C494A384),
+        U64_C(0x000000009A879FA0), U64_C(0x0000000068EC1CA3), U64_C(0x000000007BBCEF57), U64_C(0x0000000089D76C54),
+        U64_C(0x000000005D1D08BF), U64_C(0x00000000AF768BBC), U64_C(0x00000000BC267848), U64_C(0x000000004E4DFB4B),
+        U64_C(0x0000000020BD8EDE), U64_C(0x00000000D2D60DDD), U64_C(0x00000000C186FE29), U64_C(0x0000000033ED7D2A),
+        U64_C(0x00000000E72719C1), U64_C(0x00000000154C9AC2), U64_C(0x00000000061C6936), U64_C(0x00000000F477EA35),
+        U64_C(0x00000000AA64D611), U64_C(0x00000000580F5512), U64_C(0x000000004B5FA6E6), U64_C(0x00000000B93425E5),
+        U64_C(0x000000006DFE410E), U64_C(0x000000009F95C20D), U64_C(0x000000008CC531F9), U64_C(0x000000007EAEB2FA),
+        U64_C(0x0000000030E349B1), U64_C(0x00000000C288CAB2), U64_C(0x00000000D1D83946), U64_C(0x0000000023B3BA45),
+        U64_C(0x00000000F779DEAE), U64_C(0x0000000005125DAD), U64_C(0x000000001642AE59), U64_C(0x00000000E4292D5A),
+        U64_C(0x00000000BA3A117E), U64_C(0x000000004851927D), U64_C(0x000000005B016189), U64_C(0x00000000A96AE28A),
+        U64_C(0x000000007DA08661), U64_C(0x000000008FCB0562), U64_C(0x000000009C9BF696), U64_C(0x000000006EF07595),
+        U64_C(0x00000000417B1DBC), U64_C(0x00000000B3109EBF), U64_C(0x00000000A0406D4B), U64_C(0x00000000522BEE48),
+        U64_C(0x0000000086E18AA3), U64_C(0x00000000748A09A0), U64_C(0x0000000067DAFA54), U64_C(0x0000000095B17957),
+        U64_C(0x00000000CBA24573), U64_C(0x0000000039C9C670), U64_C(0x000000002A993584), U64_C(0x00000000D8F2B687),
+        U64_C(0x000000000C38D26C), U64_C(0x00000000FE53516F), U64_C(0x00000000ED03A29B), U64_C(0x000000001F682198),
+        U64_C(0x000000005125DAD3), U64_C(0x00000000A34E59D0), U64_C(0x00000000B01EAA24), U64_C(0x0000000042752927),
+        U64_C(0x0000000096BF4DCC), U64_C(0x0000000064D4CECF), U64_C(0x0000000077843D3B), U64_C(0x0000000085EFBE38),
+        U64_C(0x00000000DBFC821C), U64_C(0x000000002997011F), U64_C(0x000000003AC7F2EB), U64_C(0x00000000C8AC71E8),
+        U64_C(0x000000001C661503), U64_C(0x00000000EE0D9600), U64_C(0x00000000FD5D65F4), U64_C(0x000000000F36E6F7),
+        U64_C(0x0000000061C69362), U64_C(0x0000000093AD1061), U64_C(0x0000000080FDE395), U64_C(0x0000000072966096),
+        U64_C(0x00000000A65C047D), U64_C(0x000000005437877E), U64_C(0x000000004767748A), U64_C(0x00000000B50CF789),
+        U64_C(0x00000000EB1FCBAD), U64_C(0x00000000197448AE), U64_C(0x000000000A24BB5A), U64_C(0x00000000F84F3859),
+        U64_C(0x000000002C855CB2), U64_C(0x00000000DEEEDFB1), U64_C(0x00000000CDBE2C45), U64_C(0x000000003FD5AF46),
+        U64_C(0x000000007198540D), U64_C(0x0000000083F3D70E), U64_C(0x0000000090A324FA), U64_C(0x0000000062C8A7F9),
+        U64_C(0x00000000B602C312), U64_C(0x0000000044694011), U64_C(0x000000005739B3E5), U64_C(0x00000000A55230E6),
+        U64_C(0x00000000FB410CC2), U64_C(0x00000000092A8FC1), U64_C(0x000000001A7A7C35), U64_C(0x00000000E811FF36),
+        U64_C(0x000000003CDB9BDD), U64_C(0x00000000CEB018DE), U64_C(0x00000000DDE0EB2A), U64_C(0x000000002F8B6829),
+        U64_C(0x0000000082F63B78), U64_C(0x00000000709DB87B), U64_C(0x0000000063CD4B8F), U64_C(0x0000000091A6C88C),
+        U64_C(0x00000000456CAC67), U64_C(0x00000000B7072F64), U64_C(0x00000000A457DC90), U64_C(0x00000000563C5F93),
+        U64_C(0x00000000082F63B7), U64_C(0x00000000FA44E0B4), U64_C(0x00000000E9141340), U64_C(0x000000001B7F9043),
+        U64_C(0x00000000CFB5F4A8), U64_C(0x000000003DDE77AB), U64_C(0x000000002E8E845F), U64_C(0x00000000DCE5075C),
+        U64_C(0x0000000092A8FC17), U64_C(0x0000000060C37F14), U64_C(0x0000000073938CE0), U64_C(0x0000000081F80FE3),
+        U64_C(0x0000000055326B08), U64_C(0x00000000A759E80B), U64_C(0x00000000B4091BFF), U64_C(0x00000000466298FC),
+        U64_C(0x000000001871A4D8), U64_C(0x00000000EA1A27DB), U64_C(0x00000000F94AD42F), U64_C(0x000000000B21572C),
+        U64_C(0x00000000DFEB33C7), U64_C(0x000000002D80B0C4), U64_C(0x000000003ED04330), U64_C(0x00000000CCBBC033),
+        U64_C(0x00000000A24BB5A6), U64_C(0x00000000502036A5), U64_C(0x000000004370C551), U64_C(0x00000000B11B4652),
+        U64_C(0x0000000065D122B9), U64_C(0x0000000097BAA1BA), U64_C(0x0000000084EA524E), U64_C(0x000000007681D14D),
+        U64_C(0x000000002892ED69), U64_C(0x00000000DAF96E6A), U64_C(0x00000000C9A99D9E), U64_C(0x000000003BC21E9D),
+        U64_C(0x00000000EF087A76), U64_C(0x000000001D63F975), U64_C(0x000000000E330A81), U64_C(0x00000000FC588982),
+        U64_C(0x00000000B21572C9), U64_C(0x00000000407EF1CA), U64_C(0x00000000532E023E), U64_C(0x00000000A145813D),
+        U64_C(0x00000000758FE5D6), U64_C(0x0000000087E466D5), U64_C(0x0000000094B49521), U64_C(0x0000000066DF1622),
+        U64_C(0x0000000038CC2A06), U64_C(0x00000000CAA7A905), U64_C(0x00000000D9F75AF1), U64_C(0x000000002B9CD9F2),
+        U64_C(0x00000000FF56BD19), U64_C(0x000000000D3D3E1A), U64_C(0x000000001E6DCDEE), U64_C(0x00000000EC064EED),
+        U64_C(0x00000000C38D26C4), U64_C(0x0000000031E6A5C7), U64_C(0x0000000022B65633), U64_C(0x00000000D0DDD530),
+        U64_C(0x000000000417B1DB), U64_C(0x00000000F67C32D8), U64_C(0x00000000E52CC12C), U64_C(0x000000001747422F),
+        U64_C(0x0000000049547E0B), U64_C(0x00000000BB3FFD08), U64_C(0x00000000A86F0EFC), U64_C(0x000000005A048DFF),
+        U64_C(0x000000008ECEE914), U64_C(0x000000007CA56A17), U64_C(0x000000006FF599E3), U64_C(0x000000009D9E1AE0),
+        U64_C(0x00000000D3D3E1AB), U64_C(0x0000000021B862A8), U64_C(0x0000000032E8915C), U64_C(0x00000000C083125F),
+        U64_C(0x00000000144976B4), U64_C(0x00000000E622F5B7), U64_C(0x00000000F5720643), U64_C(0x0000000007198540),
+        U64_C(0x00000000590AB964), U64_C(0x00000000AB613A67), U64_C(0x00000000B831C993), U64_C(0x000000004A5A4A90),
+        U64_C(0x000000009E902E7B), U64_C(0x000000006CFBAD78), U64_C(0x000000007FAB5E8C), U64_C(0x000000008DC0DD8F),
+        U64_C(0x00000000E330A81A), U64_C(0x00000000115B2B19), U64_C(0x00000000020BD8ED), U64_C(0x00000000F0605BEE),
+        U64_C(0x0000000024AA3F05), U64_C(0x00000000D6C1BC06), U64_C(0x00000000C5914FF2), U64_C(0x0000000037FACCF1),
+        U64_C(0x0000000069E9F0D5), U64_C(0x000000009B8273D6), U64_C(0x0000000088D28022), U64_C(0x000000007AB90321),
+        U64_C(0x00000000AE7367CA), U64_C(0x000000005C18E4C9), U64_C(0x000000004F48173D), U64_C(0x00000000BD23943E),
+        U64_C(0x00000000F36E6F75), U64_C(0x000000000105EC76), U64_C(0x0000000012551F82), U64_C(0x00000000E03E9C81),
+        U64_C(0x0000000034F4F86A), U64_C(0x00000000C69F7B69), U64_C(0x00000000D5CF889D), U64_C(0x0000000027A40B9E),
+        U64_C(0x0000000079B737BA), U64_C(0x000000008BDCB4B9), U64_C(0x00000000988C474D), U64_C(0x000000006AE7C44E),
+        U64_C(0x00000000BE2DA0A5), U64_C(0x000000004C4623A6), U64_C(0x000000005F16D052), U64_C(0x00000000AD7D5351),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x0000000013A29877), U64_C(0x00000000274530EE), U64_C(0x0000000034E7A899),
+        U64_C(0x000000004E8A61DC), U64_C(0x000000005D28F9AB), U64_C(0x0000000069CF5132), U64_C(0x000000007A6DC945),
+        U64_C(0x000000009D14C3B8), U64_C(0x000000008EB65BCF), U64_C(0x00000000BA51F356), U64_C(0x00000000A9F36B21),
+        U64_C(0x00000000D39EA264), U64_C(0x00000000C03C3A13), U64_C(0x00000000F4DB928A), U64_C(0x00000000E7790AFD),
+        U64_C(0x000000003FC5F181), U64_C(0x000000002C6769F6), U64_C(0x000000001880C16F), U64_C(0x000000000B225918),
+        U64_C(0x00000000714F905D), U64_C(0x0000000062ED082A), U64_C(0x00000000560AA0B3), U64_C(0x0000000045A838C4),
+        U64_C(0x00000000A2D13239), U64_C(0x00000000B173AA4E), U64_C(0x00000000859402D7), U64_C(0x0000000096369AA0),
+        U64_C(0x00000000EC5B53E5), U64_C(0x00000000FFF9CB92), U64_C(0x00000000CB1E630B), U64_C(0x00000000D8BCFB7C),
+        U64_C(0x000000007F8BE302), U64_C(0x000000006C297B75), U64_C(0x0000000058CED3EC), U64_C(0x000000004B6C4B9B),
+        U64_C(0x00000000310182DE), U64_C(0x0000000022A31AA9), U64_C(0x000000001644B230), U64_C(0x0000000005E62A47),
+        U64_C(0x00000000E29F20BA), U64_C(0x00000000F13DB8CD), U64_C(0x00000000C5DA1054), U64_C(0x00000000D6788823),
+        U64_C(0x00000000AC154166), U64_C(0x00000000BFB7D911), U64_C(0x000000008B507188), U64_C(0x0000000098F2E9FF),
+        U64_C(0x00000000404E1283), U64_C(0x0000000053EC8AF4), U64_C(0x00000000670B226D), U64_C(0x0000000074A9BA1A),
+        U64_C(0x000000000EC4735F), U64_C(0x000000001D66EB28), U64_C(0x00000000298143B1), U64_C(0x000000003A23DBC6),
+        U64_C(0x00000000DD5AD13B), U64_C(0x00000000CEF8494C), U64_C(0x00000000FA1FE1D5), U64_C(0x00000000E9BD79A2),
+        U64_C(0x0000000093D0B0E7), U64_C(0x0000000080722890), U64_C(0x00000000B4958009), U64_C(0x00000000A737187E),
+        U64_C(0x00000000FF17C604), U64_C(0x00000000ECB55E73), U64_C(0x00000000D852F6EA), U64_C(0x00000000CBF06E9D),
+        U64_C(0x00000000B19DA7D8), U64_C(0x00000000A23F3FAF), U64_C(0x0000000096D89736), U64_C(0x00000000857A0F41),
+        U64_C(0x00000000620305BC), U64_C(0x0000000071A19DCB), U64_C(0x0000000045463552), U64_C(0x0000000056E4AD25),
+        U64_C(0x000000002C896460), U64_C(0x000000003F2BFC17), U64_C(0x000000000BCC548E), U64_C(0x00000000186ECCF9),
+        U64_C(0x00000000C0D23785), U64_C(0x00000000D370AFF2), U64_C(0x00000000E797076B), U64_C(0x00000000F4359F1C),
+        U64_C(0x000000008E585659), U64_C(0x000000009DFACE2E), U64_C(0x00000000A91D66B7), U64_C(0x00000000BABFFEC0),
+        U64_C(0x000000005DC6F43D), U64_C(0x000000004E646C4A), U64_C(0x000000007A83C4D3), U64_C(0x0000000069215CA4),
+        U64_C(0x00000000134C95E1), U64_C(0x0000000000EE0D96), U64_C(0x000000003409A50F), U64_C(0x0000000027AB3D78),
+        U64_C(0x00000000809C2506), U64_C(0x00000000933EBD71), U64_C(0x00000000A7D915E8), U64_C(0x00000000B47B8D9F),
+        U64_C(0x00000000CE1644DA), U64_C(0x00000000DDB4DCAD), U64_C(0x00000000E9537434), U64_C(0x00000000FAF1EC43),
+        U64_C(0x000000001D88E6BE), U64_C(0x000000000E2A7EC9), U64_C(0x000000003ACDD650), U64_C(0x00000000296F4E27),
+        U64_C(0x0000000053028762), U64_C(0x0000000040A01F15), U64_C(0x000000007447B78C), U64_C(0x0000000067E52FFB),
+        U64_C(0x00000000BF59D487), U64_C(0x00000000ACFB4CF0), U64_C(0x00000000981CE469), U64_C(0x000000008BBE7C1E),
+        U64_C(0x00000000F1D3B55B), U64_C(0x00000000E2712D2C), U64_C(0x00000000D69685B5), U64_C(0x00000000C5341DC2),
+        U64_C(0x00000000224D173F), U64_C(0x0000000031EF8F48), U64_C(0x00000000050827D1), U64_C(0x0000000016AABFA6),
+        U64_C(0x000000006CC776E3), U64_C(0x000000007F65EE94), U64_C(0x000000004B82460D), U64_C(0x000000005820DE7A),
+        U64_C(0x00000000FBC3FAF9), U64_C(0x00000000E861628E), U64_C(0x00000000DC86CA17), U64_C(0x00000000CF245260),
+        U64_C(0x00000000B5499B25), U64_C(0x00000000A6EB0352), U64_C(0x00000000920CABCB), U64_C(0x0000000081AE33BC),
+        U64_C(0x0000000066D73941), U64_C(0x000000007575A136), U64_C(0x00000000419209AF), U64_C(0x00000000523091D8),
+        U64_C(0x00000000285D589D), U64_C(0x000000003BFFC0EA), U64_C(0x000000000F186873), U64_C(0x000000001CBAF004),
+        U64_C(0x00000000C4060B78), U64_C(0x00000000D7A4930F), U64_C(0x00000000E3433B96), U64_C(0x00000000F0E1A3E1),
+        U64_C(0x000000008A8C6AA4), U64_C(0x00000000992EF2D3), U64_C(0x00000000ADC95A4A), U64_C(0x00000000BE6BC23D),
+        U64_C(0x000000005912C8C0), U64_C(0x000000004AB050B7), U64_C(0x000000007E57F82E), U64_C(0x000000006DF56059),
+        U64_C(0x000000001798A91C), U64_C(0x00000000043A316B), U64_C(0x0000000030DD99F2), U64_C(0x00000000237F0185),
+        U64_C(0x00000000844819FB), U64_C(0x0000000097EA818C), U64_C(0x00000000A30D2915), U64_C(0x00000000B0AFB162),
+        U64_C(0x00000000CAC27827), U64_C(0x00000000D960E050), U64_C(0x00000000ED8748C9), U64_C(0x00000000FE25D0BE),
+        U64_C(0x00000000195CDA43), U64_C(0x000000000AFE4234), U64_C(0x000000003E19EAAD), U64_C(0x000000002DBB72DA),
+        U64_C(0x0000000057D6BB9F), U64_C(0x00000000447423E8), U64_C(0x0000000070938B71), U64_C(0x0000000063311306),
+        U64_C(0x00000000BB8DE87A), U64_C(0x00000000A82F700D), U64_C(0x000000009CC8D894), U64_C(0x000000008F6A40E3),
+        U64_C(0x00000000F50789A6), U64_C(0x00000000E6A511D1), U64_C(0x00000000D242B948), U64_C(0x00000000C1E0213F),
+        U64_C(0x0000000026992BC2), U64_C(0x00000000353BB3B5), U64_C(0x0000000001DC1B2C), U64_C(0x00000000127E835B),
+        U64_C(0x0000000068134A1E), U64_C(0x000000007BB1D269), U64_C(0x000000004F567AF0), U64_C(0x000000005CF4E287),
+        U64_C(0x0000000004D43CFD), U64_C(0x000000001776A48A), U64_C(0x0000000023910C13), U64_C(0x0000000030339464),
+        U64_C(0x000000004A5E5D21), U64_C(0x0000000059FCC556), U64_C(0x000000006D1B6DCF), U64_C(0x000000007EB9F5B8),
+        U64_C(0x0000000099C0FF45), U64_C(0x000000008A626732), U64_C(0x00000000BE85CFAB), U64_C(0x00000000AD2757DC),
+        U64_C(0x00000000D74A9E99), U64_C(0x00000000C4E806EE), U64_C(0x00000000F00FAE77), U64_C(0x00000000E3AD3600),
+        U64_C(0x000000003B11CD7C), U64_C(0x0000000028B3550B), U64_C(0x000000001C54FD92), U64_C(0x000000000FF665E5),
+        U64_C(0x00000000759BACA0), U64_C(0x00000000663934D7), U64_C(0x0000000052DE9C4E), U64_C(0x00000000417C0439),
+        U64_C(0x00000000A6050EC4), U64_C(0x00000000B5A796B3), U64_C(0x0000000081403E2A), U64_C(0x0000000092E2A65D),
+        U64_C(0x00000000E88F6F18), U64_C(0x00000000FB2DF76F), U64_C(0x00000000CFCA5FF6), U64_C(0x00000000DC68C781),
+        U64_C(0x000000007B5FDFFF), U64_C(0x0000000068FD4788), U64_C(0x000000005C1AEF11), U64_C(0x000000004FB87766),
+        U64_C(0x0000000035D5BE23), U64_C(0x0000000026772654), U64_C(0x0000000012908ECD), U64_C(0x00000000013216BA),
+        U64_C(0x00000000E64B1C47), U64_C(0x00000000F5E98430), U64_C(0x00000000C10E2CA9), U64_C(0x00000000D2ACB4DE),
+        U64_C(0x00000000A8C17D9B), U64_C(0x00000000BB63E5EC), U64_C(0x000000008F844D75), U64_C(0x000000009C26D502),
+        U64_C(0x00000000449A2E7E), U64_C(0x000000005738B609), U64_C(0x0000000063DF1E90), U64_C(0x00000000707D86E7),
+        U64_C(0x000000000A104FA2), U64_C(0x0000000019B2D7D5), U64_C(0x000000002D557F4C), U64_C(0x000000003EF7E73B),
+        U64_C(0x00000000D98EEDC6), U64_C(0x00000000CA2C75B1), U64_C(0x00000000FECBDD28), U64_C(0x00000000ED69455F),
+        U64_C(0x0000000097048C1A), U64_C(0x0000000084A6146D), U64_C(0x00000000B041BCF4), U64_C(0x00000000A3E32483),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x00000000A541927E), U64_C(0x000000004F6F520D), U64_C(0x00000000EA2EC073),
+        U64_C(0x000000009EDEA41A), U64_C(0x000000003B9F3664), U64_C(0x00000000D1B1F617), U64_C(0x0000000074F06469),
+        U64_C(0x0000000038513EC5), U64_C(0x000000009D10ACBB), U64_C(0x00000000773E6CC8), U64_C(0x00000000D27FFEB6),
+        U64_C(0x00000000A68F9ADF), U64_C(0x0000000003CE08A1), U64_C(0x00000000E9E0C8D2), U64_C(0x000000004CA15AAC),
+        U64_C(0x0000000070A27D8A), U64_C(0x00000000D5E3EFF4), U64_C(0x000000003FCD2F87), U64_C(0x000000009A8CBDF9),
+        U64_C(0x00000000EE7CD990), U64_C(0x000000004B3D4BEE), U64_C(0x00000000A1138B9D), U64_C(0x00000000045219E3),
+        U64_C(0x0000000048F3434F), U64_C(0x00000000EDB2D131), U64_C(0x00000000079C1142), U64_C(0x00000000A2DD833C),
+        U64_C(0x00000000D62DE755), U64_C(0x00000000736C752B), U64_C(0x000000009942B558), U64_C(0x000000003C032726),
+        U64_C(0x00000000E144FB14), U64_C(0x000000004405696A), U64_C(0x00000000AE2BA919), U64_C(0x000000000B6A3B67),
+        U64_C(0x000000007F9A5F0E), U64_C(0x00000000DADBCD70), U64_C(0x0000000030F50D03), U64_C(0x0000000095B49F7D),
+        U64_C(0x00000000D915C5D1), U64_C(0x000000007C5457AF), U64_C(0x00000000967A97DC), U64_C(0x00000000333B05A2),
+        U64_C(0x0000000047CB61CB), U64_C(0x00000000E28AF3B5), U64_C(0x0000000008A433C6), U64_C(0x00000000ADE5A1B8),
+        U64_C(0x0000000091E6869E), U64_C(0x0000000034A714E0), U64_C(0x00000000DE89D493), U64_C(0x000000007BC846ED),
+        U64_C(0x000000000F382284), U64_C(0x00000000AA79B0FA), U64_C(0x0000000040577089), U64_C(0x00000000E516E2F7),
+        U64_C(0x00000000A9B7B85B), U64_C(0x000000000CF62A25), U64_C(0x00000000E6D8EA56), U64_C(0x0000000043997828),
+        U64_C(0x0000000037691C41), U64_C(0x0000000092288E3F), U64_C(0x0000000078064E4C), U64_C(0x00000000DD47DC32),
+        U64_C(0x00000000C76580D9), U64_C(0x00000000622412A7), U64_C(0x00000000880AD2D4), U64_C(0x000000002D4B40AA),
+        U64_C(0x0000000059BB24C3), U64_C(0x00000000FCFAB6BD), U64_C(0x0000000016D476CE), U64_C(0x00000000B395E4B0),
+        U64_C(0x00000000FF34BE1C), U64_C(0x000000005A752C62), U64_C(0x00000000B05BEC11), U64_C(0x00000000151A7E6F),
+        U64_C(0x0000000061EA1A06), U64_C(0x00000000C4AB8878), U64_C(0x000000002E85480B), U64_C(0x000000008BC4DA75),
+        U64_C(0x00000000B7C7FD53), U64_C(0x0000000012866F2D), U64_C(0x00000000F8A8AF5E), U64_C(0x000000005DE93D20),
+        U64_C(0x0000000029195949), U64_C(0x000000008C58CB37), U64_C(0x0000000066760B44), U64_C(0x00000000C337993A),
+        U64_C(0x000000008F96C396), U64_C(0x000000002AD751E8), U64_C(0x00000000C0F9919B), U64_C(0x0000000065B803E5),
+        U64_C(0x000000001148678C), U64_C(0x00000000B409F5F2), U64_C(0x000000005E273581), U64_C(0x00000000FB66A7FF),
+        U64_C(0x0000000026217BCD), U64_C(0x000000008360E9B3), U64_C(0x00000000694E29C0), U64_C(0x00000000CC0FBBBE),
+        U64_C(0x00000000B8FFDFD7), U64_C(0x000000001DBE4DA9), U64_C(0x00000000F7908DDA), U64_C(0x0000000052D11FA4),
+        U64_C(0x000000001E704508), U64_C(0x00000000BB31D776), U64_C(0x00000000511F1705), U64_C(0x00000000F45E857B),
+        U64_C(0x0000000080AEE112), U64_C(0x0000000025EF736C), U64_C(0x00000000CFC1B31F), U64_C(0x000000006A802161),
+        U64_C(0x0000000056830647), U64_C(0x00000000F3C29439), U64_C(0x0000000019EC544A), U64_C(0x00000000BCADC634),
+        U64_C(0x00000000C85DA25D), U64_C(0x000000006D1C3023), U64_C(0x000000008732F050), U64_C(0x000000002273622E),
+        U64_C(0x000000006ED23882), U64_C(0x00000000CB93AAFC), U64_C(0x0000000021BD6A8F), U64_C(0x0000000084FCF8F1),
+        U64_C(0x00000000F00C9C98), U64_C(0x00000000554D0EE6), U64_C(0x00000000BF63CE95), U64_C(0x000000001A225CEB),
+        U64_C(0x000000008B277743), U64_C(0x000000002E66E53D), U64_C(0x00000000C448254E), U64_C(0x000000006109B730),
+        U64_C(0x0000000015F9D359), U64_C(0x00000000B0B84127), U64_C(0x000000005A968154), U64_C(0x00000000FFD7132A),
+        U64_C(0x00000000B3764986), U64_C(0x000000001637DBF8), U64_C(0x00000000FC191B8B), U64_C(0x00000000595889F5),
+        U64_C(0x000000002DA8ED9C), U64_C(0x0000000088E97FE2), U64_C(0x0000000062C7BF91), U64_C(0x00000000C7862DEF),
+        U64_C(0x00000000FB850AC9), U64_C(0x000000005EC498B7), U64_C(0x00000000B4EA58C4), U64_C(0x0000000011ABCABA),
+        U64_C(0x00000000655BAED3), U64_C(0x00000000C01A3CAD), U64_C(0x000000002A34FCDE), U64_C(0x000000008F756EA0),
+        U64_C(0x00000000C3D4340C), U64_C(0x000000006695A672), U64_C(0x000000008CBB6601), U64_C(0x0000000029FAF47F),
+        U64_C(0x000000005D0A9016), U64_C(0x00000000F84B0268), U64_C(0x000000001265C21B), U64_C(0x00000000B7245065),
+        U64_C(0x000000006A638C57), U64_C(0x00000000CF221E29), U64_C(0x00000000250CDE5A), U64_C(0x00000000804D4C24),
+        U64_C(0x00000000F4BD284D), U64_C(0x0000000051FCBA33), U64_C(0x00000000BBD27A40), U64_C(0x000000001E93E83E),
+        U64_C(0x000000005232B292), U64_C(0x00000000F77320EC), U64_C(0x000000001D5DE09F), U64_C(0x00000000B81C72E1),
+        U64_C(0x00000000CCEC1688), U64_C(0x0000000069AD84F6), U64_C(0x0000000083834485), U64_C(0x0000000026C2D6FB),
+        U64_C(0x000000001AC1F1DD), U64_C(0x00000000BF8063A3), U64_C(0x0000000055AEA3D0), U64_C(0x00000000F0EF31AE),
+        U64_C(0x00000000841F55C7), U64_C(0x00000000215EC7B9), U64_C(0x00000000CB7007CA), U64_C(0x000000006E3195B4),
+        U64_C(0x000000002290CF18), U64_C(0x0000000087D15D66), U64_C(0x000000006DFF9D15), U64_C(0x00000000C8BE0F6B),
+        U64_C(0x00000000BC4E6B02), U64_C(0x00000000190FF97C), U64_C(0x00000000F321390F), U64_C(0x000000005660AB71),
+        U64_C(0x000000004C42F79A), U64_C(0x00000000E90365E4), U64_C(0x00000000032DA597), U64_C(0x00000000A66C37E9),
+        U64_C(0x00000000D29C5380), U64_C(0x0000000077DDC1FE), U64_C(0x000000009DF3018D), U64_C(0x0000000038B293F3),
+        U64_C(0x000000007413C95F), U64_C(0x00000000D1525B21), U64_C(0x000000003B7C9B52), U64_C(0x000000009E3D092C),
+        U64_C(0x00000000EACD6D45), U64_C(0x000000004F8CFF3B), U64_C(0x00000000A5A23F48), U64_C(0x0000000000E3AD36),
+        U64_C(0x000000003CE08A10), U64_C(0x0000000099A1186E), U64_C(0x00000000738FD81D), U64_C(0x00000000D6CE4A63),
+        U64_C(0x00000000A23E2E0A), U64_C(0x00000000077FBC74), U64_C(0x00000000ED517C07), U64_C(0x000000004810EE79),
+        U64_C(0x0000000004B1B4D5), U64_C(0x00000000A1F026AB), U64_C(0x000000004BDEE6D8), U64_C(0x00000000EE9F74A6),
+        U64_C(0x000000009A6F10CF), U64_C(0x000000003F2E82B1), U64_C(0x00000000D50042C2), U64_C(0x000000007041D0BC),
+        U64_C(0x00000000AD060C8E), U64_C(0x0000000008479EF0), U64_C(0x00000000E2695E83), U64_C(0x000000004728CCFD),
+        U64_C(0x0000000033D8A894), U64_C(0x0000000096993AEA), U64_C(0x000000007CB7FA99), U64_C(0x00000000D9F668E7),
+        U64_C(0x000000009557324B), U64_C(0x000000003016A035), U64_C(0x00000000DA386046), U64_C(0x000000007F79F238),
+        U64_C(0x000000000B899651), U64_C(0x00000000AEC8042F), U64_C(0x0000000044E6C45C), U64_C(0x00000000E1A75622),
+        U64_C(0x00000000DDA47104), U64_C(0x0000000078E5E37A), U64_C(0x0000000092CB2309), U64_C(0x00000000378AB177),
+        U64_C(0x00000000437AD51E), U64_C(0x00000000E63B4760), U64_C(0x000000000C158713), U64_C(0x00000000A954156D),
+        U64_C(0x00000000E5F54FC1), U64_C(0x0000000040B4DDBF), U64_C(0x00000000AA9A1DCC), U64_C(0x000000000FDB8FB2),
+        U64_C(0x000000007B2BEBDB), U64_C(0x00000000DE6A79A5), U64_C(0x000000003444B9D6), U64_C(0x0000000091052BA8),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x00000000DD45AAB8), U64_C(0x00000000BF672381), U64_C(0x0000000062228939),
+        U64_C(0x000000007B2231F3), U64_C(0x00000000A6679B4B), U64_C(0x00000000C4451272), U64_C(0x000000001900B8CA),
+        U64_C(0x00000000F64463E6), U64_C(0x000000002B01C95E), U64_C(0x0000000049234067), U64_C(0x000000009466EADF),
+        U64_C(0x000000008D665215), U64_C(0x000000005023F8AD), U64_C(0x0000000032017194), U64_C(0x00000000EF44DB2C),
+        U64_C(0x00000000E964B13D), U64_C(0x0000000034211B85), U64_C(0x00000000560392BC), U64_C(0x000000008B463804),
+        U64_C(0x00000000924680CE), U64_C(0x000000004F032A76), U64_C(0x000000002D21A34F), U64_C(0x00000000F06409F7),
+        U64_C(0x000000001F20D2DB), U64_C(0x00000000C2657863), U64_C(0x00000000A047F15A), U64_C(0x000000007D025BE2),
+        U64_C(0x000000006402E328), U64_C(0x00000000B9474990), U64_C(0x00000000DB65C0A9), U64_C(0x0000000006206A11),
+        U64_C(0x00000000D725148B), U64_C(0x000000000A60BE33), U64_C(0x000000006842370A), U64_C(0x00000000B5079DB2),
+        U64_C(0x00000000AC072578), U64_C(0x0000000071428FC0), U64_C(0x00000000136006F9), U64_C(0x00000000CE25AC41),
+        U64_C(0x000000002161776D), U64_C(0x00000000FC24DDD5), U64_C(0x000000009E0654EC), U64_C(0x000000004343FE54),
+        U64_C(0x000000005A43469E), U64_C(0x000000008706EC26), U64_C(0x00000000E524651F), U64_C(0x000000003861CFA7),
+        U64_C(0x000000003E41A5B6), U64_C(0x00000000E3040F0E), U64_C(0x0000000081268637), U64_C(0x000000005C632C8F),
+        U64_C(0x0000000045639445), U64_C(0x0000000098263EFD), U64_C(0x00000000FA04B7C4), U64_C(0x0000000027411D7C),
+        U64_C(0x00000000C805C650), U64_C(0x0000000015406CE8), U64_C(0x000000007762E5D1), U64_C(0x00000000AA274F69),
+        U64_C(0x00000000B327F7A3), U64_C(0x000000006E625D1B), U64_C(0x000000000C40D422), U64_C(0x00000000D1057E9A),
+        U64_C(0x00000000ABA65FE7), U64_C(0x0000000076E3F55F), U64_C(0x0000000014C17C66), U64_C(0x00000000C984D6DE),
+        U64_C(0x00000000D0846E14), U64_C(0x000000000DC1C4AC), U64_C(0x000000006FE34D95), U64_C(0x00000000B2A6E72D),
+        U64_C(0x000000005DE23C01), U64_C(0x0000000080A796B9), U64_C(0x00000000E2851F80), U64_C(0x000000003FC0B538),
+        U64_C(0x0000000026C00DF2), U64_C(0x00000000FB85A74A), U64_C(0x0000000099A72E73), U64_C(0x0000000044E284CB),
+        U64_C(0x0000000042C2EEDA), U64_C(0x000000009F874462), U64_C(0x00000000FDA5CD5B), U64_C(0x0000000020E067E3),
+        U64_C(0x0000000039E0DF29), U64_C(0x00000000E4A57591), U64_C(0x000000008687FCA8), U64_C(0x000000005BC25610),
+        U64_C(0x00000000B4868D3C), U64_C(0x0000000069C32784), U64_C(0x000000000BE1AEBD), U64_C(0x00000000D6A40405),
+        U64_C(0x00000000CFA4BCCF), U64_C(0x0000000012E11677), U64_C(0x0000000070C39F4E), U64_C(0x00000000AD8635F6),
+        U64_C(0x000000007C834B6C), U64_C(0x00000000A1C6E1D4), U64_C(0x00000000C3E468ED), U64_C(0x000000001EA1C255),
+        U64_C(0x0000000007A17A9F), U64_C(0x00000000DAE4D027), U64_C(0x00000000B8C6591E), U64_C(0x000000006583F3A6),
+        U64_C(0x000000008AC7288A), U64_C(0x0000000057828232), U64_C(0x0000000035A00B0B), U64_C(0x00000000E8E5A1B3),
+        U64_C(0x00000000F1E51979), U64_C(0x000000002CA0B3C1), U64_C(0x000000004E823AF8), U64_C(0x0000000093C79040),
+        U64_C(0x0000000095E7FA51), U64_C(0x0000000048A250E9), U64_C(0x000000002A80D9D0), U64_C(0x00000000F7C57368),
+        U64_C(0x00000000EEC5CBA2), U64_C(0x000000003380611A), U64_C(0x0000000051A2E823), U64_C(0x000000008CE7429B),
+        U64_C(0x0000000063A399B7), U64_C(0x00000000BEE6330F), U64_C(0x00000000DCC4BA36), U64_C(0x000000000181108E),
+        U64_C(0x000000001881A844), U64_C(0x00000000C5C402FC), U64_C(0x00000000A7E68BC5), U64_C(0x000000007AA3217D),
+        U64_C(0x0000000052A0C93F), U64_C(0x000000008FE56387), U64_C(0x00000000EDC7EABE), U64_C(0x0000000030824006),
+        U64_C(0x000000002982F8CC), U64_C(0x00000000F4C75274), U64_C(0x0000000096E5DB4D), U64_C(0x000000004BA071F5),
+        U64_C(0x00000000A4E4AAD9), U64_C(0x0000000079A10061), U64_C(0x000000001B838958), U64_C(0x00000000C6C623E0),
+        U64_C(0x00000000DFC69B2A), U64_C(0x0000000002833192), U64_C(0x0000000060A1B8AB), U64_C(0x00000000BDE41213),
+        U64_C(0x00000000BBC47802), U64_C(0x000000006681D2BA), U64_C(0x0000000004A35B83), U64_C(0x00000000D9E6F13B),
+        U64_C(0x00000000C0E649F1), U64_C(0x000000001DA3E349), U64_C(0x000000007F816A70), U64_C(0x00000000A2C4C0C8),
+        U64_C(0x000000004D801BE4), U64_C(0x0000000090C5B15C), U64_C(0x00000000F2E73865), U64_C(0x000000002FA292DD),
+        U64_C(0x0000000036A22A17), U64_C(0x00000000EBE780AF), U64_C(0x0000000089C50996), U64_C(0x000000005480A32E),
+        U64_C(0x000000008585DDB4), U64_C(0x0000000058C0770C), U64_C(0x000000003AE2FE35), U64_C(0x00000000E7A7548D),
+        U64_C(0x00000000FEA7EC47), U64_C(0x0000000023E246FF), U64_C(0x0000000041C0CFC6), U64_C(0x000000009C85657E),
+        U64_C(0x0000000073C1BE52), U64_C(0x00000000AE8414EA), U64_C(0x00000000CCA69DD3), U64_C(0x0000000011E3376B),
+        U64_C(0x0000000008E38FA1), U64_C(0x00000000D5A62519), U64_C(0x00000000B784AC20), U64_C(0x000000006AC10698),
+        U64_C(0x000000006CE16C89), U64_C(0x00000000B1A4C631), U64_C(0x00000000D3864F08), U64_C(0x000000000EC3E5B0),
+        U64_C(0x0000000017C35D7A), U64_C(0x00000000CA86F7C2), U64_C(0x00000000A8A47EFB), U64_C(0x0000000075E1D443),
+        U64_C(0x000000009AA50F6F), U64_C(0x0000000047E0A5D7), U64_C(0x0000000025C22CEE), U64_C(0x00000000F8878656),
+        U64_C(0x00000000E1873E9C), U64_C(0x000000003CC29424), U64_C(0x000000005EE01D1D), U64_C(0x0000000083A5B7A5),
+        U64_C(0x00000000F90696D8), U64_C(0x0000000024433C60), U64_C(0x000000004661B559), U64_C(0x000000009B241FE1),
+        U64_C(0x000000008224A72B), U64_C(0x000000005F610D93), U64_C(0x000000003D4384AA), U64_C(0x00000000E0062E12),
+        U64_C(0x000000000F42F53E), U64_C(0x00000000D2075F86), U64_C(0x00000000B025D6BF), U64_C(0x000000006D607C07),
+        U64_C(0x000000007460C4CD), U64_C(0x00000000A9256E75), U64_C(0x00000000CB07E74C), U64_C(0x0000000016424DF4),
+        U64_C(0x00000000106227E5), U64_C(0x00000000CD278D5D), U64_C(0x00000000AF050464), U64_C(0x000000007240AEDC),
+        U64_C(0x000000006B401616), U64_C(0x00000000B605BCAE), U64_C(0x00000000D4273597), U64_C(0x0000000009629F2F),
+        U64_C(0x00000000E6264403), U64_C(0x000000003B63EEBB), U64_C(0x0000000059416782), U64_C(0x000000008404CD3A),
+        U64_C(0x000000009D0475F0), U64_C(0x000000004041DF48), U64_C(0x0000000022635671), U64_C(0x00000000FF26FCC9),
+        U64_C(0x000000002E238253), U64_C(0x00000000F36628EB), U64_C(0x000000009144A1D2), U64_C(0x000000004C010B6A),
+        U64_C(0x000000005501B3A0), U64_C(0x0000000088441918), U64_C(0x00000000EA669021), U64_C(0x0000000037233A99),
+        U64_C(0x00000000D867E1B5), U64_C(0x0000000005224B0D), U64_C(0x000000006700C234), U64_C(0x00000000BA45688C),
+        U64_C(0x00000000A345D046), U64_C(0x000000007E007AFE), U64_C(0x000000001C22F3C7), U64_C(0x00000000C167597F),
+        U64_C(0x00000000C747336E), U64_C(0x000000001A0299D6), U64_C(0x00000000782010EF), U64_C(0x00000000A565BA57),
+        U64_C(0x00000000BC65029D), U64_C(0x000000006120A825), U64_C(0x000000000302211C), U64_C(0x00000000DE478BA4),
+        U64_C(0x0000000031035088), U64_C(0x00000000EC46FA30), U64_C(0x000000008E647309), U64_C(0x000000005321D9B1),
+        U64_C(0x000000004A21617B), U64_C(0x000000009764CBC3), U64_C(0x00000000F54642FA), U64_C(0x000000002803E842),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x0000000038116FAC), U64_C(0x000000007022DF58), U64_C(0x000000004833B0F4),
+        U64_C(0x00000000E045BEB0), U64_C(0x00000000D854D11C), U64_C(0x00000000906761E8), U64_C(0x00000000A8760E44),
+        U64_C(0x00000000C5670B91), U64_C(0x00000000FD76643D), U64_C(0x00000000B545D4C9), U64_C(0x000000008D54BB65),
+        U64_C(0x000000002522B521), U64_C(0x000000001D33DA8D), U64_C(0x0000000055006A79), U64_C(0x000000006D1105D5),
+        U64_C(0x000000008F2261D3), U64_C(0x00000000B7330E7F), U64_C(0x00000000FF00BE8B), U64_C(0x00000000C711D127),
+        U64_C(0x000000006F67DF63), U64_C(0x000000005776B0CF), U64_C(0x000000001F45003B), U64_C(0x0000000027546F97),
+        U64_C(0x000000004A456A42), U64_C(0x00000000725405EE), U64_C(0x000000003A67B51A), U64_C(0x000000000276DAB6),
+        U64_C(0x00000000AA00D4F2), U64_C(0x000000009211BB5E), U64_C(0x00000000DA220BAA), U64_C(0x00000000E2336406),
+        U64_C(0x000000001BA8B557), U64_C(0x0000000023B9DAFB), U64_C(0x000000006B8A6A0F), U64_C(0x00000000539B05A3),
+        U64_C(0x00000000FBED0BE7), U64_C(0x00000000C3FC644B), U64_C(0x000000008BCFD4BF), U64_C(0x00000000B3DEBB13),
+        U64_C(0x00000000DECFBEC6), U64_C(0x00000000E6DED16A), U64_C(0x00000000AEED619E), U64_C(0x0000000096FC0E32),
+        U64_C(0x000000003E8A0076), U64_C(0x00000000069B6FDA), U64_C(0x000000004EA8DF2E), U64_C(0x0000000076B9B082),
+        U64_C(0x00000000948AD484), U64_C(0x00000000AC9BBB28), U64_C(0x00000000E4A80BDC), U64_C(0x00000000DCB96470),
+        U64_C(0x0000000074CF6A34), U64_C(0x000000004CDE0598), U64_C(0x0000000004EDB56C), U64_C(0x000000003CFCDAC0),
+        U64_C(0x0000000051EDDF15), U64_C(0x0000000069FCB0B9), U64_C(0x0000000021CF004D), U64_C(0x0000000019DE6FE1),
+        U64_C(0x00000000B1A861A5), U64_C(0x0000000089B90E09), U64_C(0x00000000C18ABEFD), U64_C(0x00000000F99BD151),
+        U64_C(0x0000000037516AAE), U64_C(0x000000000F400502), U64_C(0x000000004773B5F6), U64_C(0x000000007F62DA5A),
+        U64_C(0x00000000D714D41E), U64_C(0x00000000EF05BBB2), U64_C(0x00000000A7360B46), U64_C(0x000000009F2764EA),
+        U64_C(0x00000000F236613F), U64_C(0x00000000CA270E93), U64_C(0x000000008214BE67), U64_C(0x00000000BA05D1CB),
+        U64_C(0x000000001273DF8F), U64_C(0x000000002A62B023), U64_C(0x00000000625100D7), U64_C(0x000000005A406F7B),
+        U64_C(0x00000000B8730B7D), U64_C(0x00000000806264D1), U64_C(0x00000000C851D425), U64_C(0x00000000F040BB89),
+        U64_C(0x000000005836B5CD), U64_C(0x000000006027DA61), U64_C(0x0000000028146A95), U64_C(0x0000000010050539),
+        U64_C(0x000000007D1400EC), U64_C(0x0000000045056F40), U64_C(0x000000000D36DFB4), U64_C(0x000000003527B018),
+        U64_C(0x000000009D51BE5C), U64_C(0x00000000A540D1F0), U64_C(0x00000000ED736104), U64_C(0x00000000D5620EA8),
+        U64_C(0x000000002CF9DFF9), U64_C(0x0000000014E8B055), U64_C(0x000000005CDB00A1), U64_C(0x0000000064CA6F0D),
+        U64_C(0x00000000CCBC6149), U64_C(0x00000000F4AD0EE5), U64_C(0x00000000BC9EBE11), U64_C(0x00000000848FD1BD),
+        U64_C(0x00000000E99ED468), U64_C(0x00000000D18FBBC4), U64_C(0x0000000099BC0B30), U64_C(0x00000000A1AD649C),
+        U64_C(0x0000000009DB6AD8), U64_C(0x0000000031CA0574), U64_C(0x0000000079F9B580), U64_C(0x0000000041E8DA2C),
+        U64_C(0x00000000A3DBBE2A), U64_C(0x000000009BCAD186), U64_C(0x00000000D3F96172), U64_C(0x00000000EBE80EDE),
+        U64_C(0x00000000439E009A), U64_C(0x000000007B8F6F36), U64_C(0x0000000033BCDFC2), U64_C(0x000000000BADB06E),
+        U64_C(0x0000000066BCB5BB), U64_C(0x000000005EADDA17), U64_C(0x00000000169E6AE3), U64_C(0x000000002E8F054F),
+        U64_C(0x0000000086F90B0B), U64_C(0x00000000BEE864A7), U64_C(0x00000000F6DBD453), U64_C(0x00000000CECABBFF),
+        U64_C(0x000000006EA2D55C), U64_C(0x0000000056B3BAF0), U64_C(0x000000001E800A04), U64_C(0x00000000269165A8),
+        U64_C(0x000000008EE76BEC), U64_C(0x00000000B6F60440), U64_C(0x00000000FEC5B4B4), U64_C(0x00000000C6D4DB18),
+        U64_C(0x00000000ABC5DECD), U64_C(0x0000000093D4B161), U64_C(0x00000000DBE70195), U64_C(0x00000000E3F66E39),
+        U64_C(0x000000004B80607D), U64_C(0x0000000073910FD1), U64_C(0x000000003BA2BF25), U64_C(0x0000000003B3D089),
+        U64_C(0x00000000E180B48F), U64_C(0x00000000D991DB23), U64_C(0x0000000091A26BD7), U64_C(0x00000000A9B3047B),
+        U64_C(0x0000000001C50A3F), U64_C(0x0000000039D46593), U64_C(0x0000000071E7D567), U64_C(0x0000000049F6BACB),
+        U64_C(0x0000000024E7BF1E), U64_C(0x000000001CF6D0B2), U64_C(0x0000000054C56046), U64_C(0x000000006CD40FEA),
+        U64_C(0x00000000C4A201AE), U64_C(0x00000000FCB36E02), U64_C(0x00000000B480DEF6), U64_C(0x000000008C91B15A),
+        U64_C(0x00000000750A600B), U64_C(0x000000004D1B0FA7), U64_C(0x000000000528BF53), U64_C(0x000000003D39D0FF),
+        U64_C(0x00000000954FDEBB), U64_C(0x00000000AD5EB117), U64_C(0x00000000E56D01E3), U64_C(0x00000000DD7C6E4F),
+        U64_C(0x00000000B06D6B9A), U64_C(0x00000000887C0436), U64_C(0x00000000C04FB4C2), U64_C(0x00000000F85EDB6E),
+        U64_C(0x000000005028D52A), U64_C(0x000000006839BA86), U64_C(0x00000000200A0A72), U64_C(0x00000000181B65DE),
+        U64_C(0x00000000FA2801D8), U64_C(0x00000000C2396E74), U64_C(0x000000008A0ADE80), U64_C(0x00000000B21BB12C),
+        U64_C(0x000000001A6DBF68), U64_C(0x00000000227CD0C4), U64_C(0x000000006A4F6030), U64_C(0x00000000525E0F9C),
+        U64_C(0x000000003F4F0A49), U64_C(0x00000000075E65E5), U64_C(0x000000004F6DD511), U64_C(0x00000000777CBABD),
+        U64_C(0x00000000DF0AB4F9), U64_C(0x00000000E71BDB55), U64_C(0x00000000AF286BA1), U64_C(0x000000009739040D),
+        U64_C(0x0000000059F3BFF2), U64_C(0x0000000061E2D05E), U64_C(0x0000000029D160AA), U64_C(0x0000000011C00F06),
+        U64_C(0x00000000B9B60142), U64_C(0x0000000081A76EEE), U64_C(0x00000000C994DE1A), U64_C(0x00000000F185B1B6),
+        U64_C(0x000000009C94B463), U64_C(0x00000000A485DBCF), U64_C(0x00000000ECB66B3B), U64_C(0x00000000D4A70497),
+        U64_C(0x000000007CD10AD3), U64_C(0x0000000044C0657F), U64_C(0x000000000CF3D58B), U64_C(0x0000000034E2BA27),
+        U64_C(0x00000000D6D1DE21), U64_C(0x00000000EEC0B18D), U64_C(0x00000000A6F30179), U64_C(0x000000009EE26ED5),
+        U64_C(0x0000000036946091), U64_C(0x000000000E850F3D), U64_C(0x0000000046B6BFC9), U64_C(0x000000007EA7D065),
+        U64_C(0x0000000013B6D5B0), U64_C(0x000000002BA7BA1C), U64_C(0x0000000063940AE8), U64_C(0x000000005B856544),
+        U64_C(0x00000000F3F36B00), U64_C(0x00000000CBE204AC), U64_C(0x0000000083D1B458), U64_C(0x00000000BBC0DBF4),
+        U64_C(0x00000000425B0AA5), U64_C(0x000000007A4A6509), U64_C(0x000000003279D5FD), U64_C(0x000000000A68BA51),
+        U64_C(0x00000000A21EB415), U64_C(0x000000009A0FDBB9), U64_C(0x00000000D23C6B4D), U64_C(0x00000000EA2D04E1),
+        U64_C(0x00000000873C0134), U64_C(0x00000000BF2D6E98), U64_C(0x00000000F71EDE6C), U64_C(0x00000000CF0FB1C0),
+        U64_C(0x000000006779BF84), U64_C(0x000000005F68D028), U64_C(0x00000000175B60DC), U64_C(0x000000002F4A0F70),
+        U64_C(0x00000000CD796B76), U64_C(0x00000000F56804DA), U64_C(0x00000000BD5BB42E), U64_C(0x00000000854ADB82),
+        U64_C(0x000000002D3CD5C6), U64_C(0x00000000152DBA6A), U64_C(0x000000005D1E0A9E), U64_C(0x00000000650F6532),
+        U64_C(0x00000000081E60E7), U64_C(0x00000000300F0F4B), U64_C(0x00000000783CBFBF), U64_C(0x00000000402DD013),
+        U64_C(0x00000000E85BDE57), U64_C(0x00000000D04AB1FB), U64_C(0x000000009879010F), U64_C(0x00000000A0686EA3),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x00000000EF306B19), U64_C(0x00000000DB8CA0C3), U64_C(0x0000000034BCCBDA),
+        U64_C(0x00000000B2F53777), U64_C(0x000000005DC55C6E), U64_C(0x00000000697997B4), U64_C(0x000000008649FCAD),
+        U64_C(0x000000006006181F), U64_C(0x000000008F367306), U64_C(0x00000000BB8AB8DC), U64_C(0x0000000054BAD3C5),
+        U64_C(0x00000000D2F32F68), U64_C(0x000000003DC34471), U64_C(0x00000000097F8FAB), U64_C(0x00000000E64FE4B2),
+        U64_C(0x00000000C00C303E), U64_C(0x000000002F3C5B27), U64_C(0x000000001B8090FD), U64_C(0x00000000F4B0FBE4),
+        U64_C(0x0000000072F90749), U64_C(0x000000009DC96C50), U64_C(0x00000000A975A78A), U64_C(0x000000004645CC93),
+        U64_C(0x00000000A00A2821), U64_C(0x000000004F3A4338), U64_C(0x000000007B8688E2), U64_C(0x0000000094B6E3FB),
+        U64_C(0x0000000012FF1F56), U64_C(0x00000000FDCF744F), U64_C(0x00000000C973BF95), U64_C(0x000000002643D48C),
+        U64_C(0x0000000085F4168D), U64_C(0x000000006AC47D94), U64_C(0x000000005E78B64E), U64_C(0x00000000B148DD57),
+        U64_C(0x00000000370121FA), U64_C(0x00000000D8314AE3), U64_C(0x00000000EC8D8139), U64_C(0x0000000003BDEA20),
+        U64_C(0x00000000E5F20E92), U64_C(0x000000000AC2658B), U64_C(0x000000003E7EAE51), U64_C(0x00000000D14EC548),
+        U64_C(0x00000000570739E5), U64_C(0x00000000B83752FC), U64_C(0x000000008C8B9926), U64_C(0x0000000063BBF23F),
+        U64_C(0x0000000045F826B3), U64_C(0x00000000AAC84DAA), U64_C(0x000000009E748670), U64_C(0x000000007144ED69),
+        U64_C(0x00000000F70D11C4), U64_C(0x00000000183D7ADD), U64_C(0x000000002C81B107), U64_C(0x00000000C3B1DA1E),
+        U64_C(0x0000000025FE3EAC), U64_C(0x00000000CACE55B5), U64_C(0x00000000FE729E6F), U64_C(0x000000001142F576),
+        U64_C(0x00000000970B09DB), U64_C(0x00000000783B62C2), U64_C(0x000000004C87A918), U64_C(0x00000000A3B7C201),
+        U64_C(0x000000000E045BEB), U64_C(0x00000000E13430F2), U64_C(0x00000000D588FB28), U64_C(0x000000003AB89031),
+        U64_C(0x00000000BCF16C9C), U64_C(0x0000000053C10785), U64_C(0x00000000677DCC5F), U64_C(0x00000000884DA746),
+        U64_C(0x000000006E0243F4), U64_C(0x00000000813228ED), U64_C(0x00000000B58EE337), U64_C(0x000000005ABE882E),
+        U64_C(0x00000000DCF77483), U64_C(0x0000000033C71F9A), U64_C(0x00000000077BD440), U64_C(0x00000000E84BBF59),
+        U64_C(0x00000000CE086BD5), U64_C(0x00000000213800CC), U64_C(0x000000001584CB16), U64_C(0x00000000FAB4A00F),
+        U64_C(0x000000007CFD5CA2), U64_C(0x0000000093CD37BB), U64_C(0x00000000A771FC61), U64_C(0x0000000048419778),
+        U64_C(0x00000000AE0E73CA), U64_C(0x00000000413E18D3), U64_C(0x000000007582D309), U64_C(0x000000009AB2B810),
+        U64_C(0x000000001CFB44BD), U64_C(0x00000000F3CB2FA4), U64_C(0x00000000C777E47E), U64_C(0x0000000028478F67),
+        U64_C(0x000000008BF04D66), U64_C(0x0000000064C0267F), U64_C(0x00000000507CEDA5), U64_C(0x00000000BF4C86BC),
+        U64_C(0x0000000039057A11), U64_C(0x00000000D6351108), U64_C(0x00000000E289DAD2), U64_C(0x000000000DB9B1CB),
+        U64_C(0x00000000EBF65579), U64_C(0x0000000004C63E60), U64_C(0x00000000307AF5BA), U64_C(0x00000000DF4A9EA3),
+        U64_C(0x000000005903620E), U64_C(0x00000000B6330917), U64_C(0x00000000828FC2CD), U64_C(0x000000006DBFA9D4),
+        U64_C(0x000000004BFC7D58), U64_C(0x00000000A4CC1641), U64_C(0x000000009070DD9B), U64_C(0x000000007F40B682),
+        U64_C(0x00000000F9094A2F), U64_C(0x0000000016392136), U64_C(0x000000002285EAEC), U64_C(0x00000000CDB581F5),
+        U64_C(0x000000002BFA6547), U64_C(0x00000000C4CA0E5E), U64_C(0x00000000F076C584), U64_C(0x000000001F46AE9D),
+        U64_C(0x00000000990F5230), U64_C(0x00000000763F3929), U64_C(0x000000004283F2F3), U64_C(0x00000000ADB399EA),
+        U64_C(0x000000001C08B7D6), U64_C(0x00000000F338DCCF), U64_C(0x00000000C7841715), U64_C(0x0000000028B47C0C),
+        U64_C(0x00000000AEFD80A1), U64_C(0x0000000041CDEBB8), U64_C(0x0000000075712062), U64_C(0x000000009A414B7B),
+        U64_C(0x000000007C0EAFC9), U64_C(0x00000000933EC4D0), U64_C(0x00000000A7820F0A), U64_C(0x0000000048B26413),
+        U64_C(0x00000000CEFB98BE), U64_C(0x0000000021CBF3A7), U64_C(0x000000001577387D), U64_C(0x00000000FA475364),
+        U64_C(0x00000000DC0487E8), U64_C(0x000000003334ECF1), U64_C(0x000000000788272B), U64_C(0x00000000E8B84C32),
+        U64_C(0x000000006EF1B09F), U64_C(0x0000000081C1DB86), U64_C(0x00000000B57D105C), U64_C(0x000000005A4D7B45),
+        U64_C(0x00000000BC029FF7), U64_C(0x000000005332F4EE), U64_C(0x00000000678E3F34), U64_C(0x0000000088BE542D),
+        U64_C(0x000000000EF7A880), U64_C(0x00000000E1C7C399), U64_C(0x00000000D57B0843), U64_C(0x000000003A4B635A),
+        U64_C(0x0000000099FCA15B), U64_C(0x0000000076CCCA42), U64_C(0x0000000042700198), U64_C(0x00000000AD406A81),
+        U64_C(0x000000002B09962C), U64_C(0x00000000C439FD35), U64_C(0x00000000F08536EF), U64_C(0x000000001FB55DF6),
+        U64_C(0x00000000F9FAB944), U64_C(0x0000000016CAD25D), U64_C(0x0000000022761987), U64_C(0x00000000CD46729E),
+        U64_C(0x000000004B0F8E33), U64_C(0x00000000A43FE52A), U64_C(0x0000000090832EF0), U64_C(0x000000007FB345E9),
+        U64_C(0x0000000059F09165), U64_C(0x00000000B6C0FA7C), U64_C(0x00000000827C31A6), U64_C(0x000000006D4C5ABF),
+        U64_C(0x00000000EB05A612), U64_C(0x000000000435CD0B), U64_C(0x00000000308906D1), U64_C(0x00000000DFB96DC8),
+        U64_C(0x0000000039F6897A), U64_C(0x00000000D6C6E263), U64_C(0x00000000E27A29B9), U64_C(0x000000000D4A42A0),
+        U64_C(0x000000008B03BE0D), U64_C(0x000000006433D514), U64_C(0x00000000508F1ECE), U64_C(0x00000000BFBF75D7),
+        U64_C(0x00000000120CEC3D), U64_C(0x00000000FD3C8724), U64_C(0x00000000C9804CFE), U64_C(0x0000000026B027E7),
+        U64_C(0x00000000A0F9DB4A), U64_C(0x000000004FC9B053), U64_C(0x000000007B757B89), U64_C(0x0000000094451090),
+        U64_C(0x00000000720AF422), U64_C(0x000000009D3A9F3B), U64_C(0x00000000A98654E1), U64_C(0x0000000046B63FF8),
+        U64_C(0x00000000C0FFC355), U64_C(0x000000002FCFA84C), U64_C(0x000000001B736396), U64_C(0x00000000F443088F),
+        U64_C(0x00000000D200DC03), U64_C(0x000000003D30B71A), U64_C(0x00000000098C7CC0), U64_C(0x00000000E6BC17D9),
+        U64_C(0x0000000060F5EB74), U64_C(0x000000008FC5806D), U64_C(0x00000000BB794BB7), U64_C(0x00000000544920AE),
+        U64_C(0x00000000B206C41C), U64_C(0x000000005D36AF05), U64_C(0x00000000698A64DF), U64_C(0x0000000086BA0FC6),
+        U64_C(0x0000000000F3F36B), U64_C(0x00000000EFC39872), U64_C(0x00000000DB7F53A8), U64_C(0x00000000344F38B1),
+        U64_C(0x0000000097F8FAB0), U64_C(0x0000000078C891A9), U64_C(0x000000004C745A73), U64_C(0x00000000A344316A),
+        U64_C(0x00000000250DCDC7), U64_C(0x00000000CA3DA6DE), U64_C(0x00000000FE816D04), U64_C(0x0000000011B1061D),
+        U64_C(0x00000000F7FEE2AF), U64_C(0x0000000018CE89B6), U64_C(0x000000002C72426C), U64_C(0x00000000C3422975),
+        U64_C(0x00000000450BD5D8), U64_C(0x00000000AA3BBEC1), U64_C(0x000000009E87751B), U64_C(0x0000000071B71E02),
+        U64_C(0x0000000057F4CA8E), U64_C(0x00000000B8C4A197), U64_C(0x000000008C786A4D), U64_C(0x0000000063480154),
+        U64_C(0x00000000E501FDF9), U64_C(0x000000000A3196E0), U64_C(0x000000003E8D5D3A), U64_C(0x00000000D1BD3623),
+        U64_C(0x0000000037F2D291), U64_C(0x00000000D8C2B988), U64_C(0x00000000EC7E7252), U64_C(0x00000000034E194B),
+        U64_C(0x000000008507E5E6), U64_C(0x000000006A378EFF), U64_C(0x000000005E8B4525), U64_C(0x00000000B1BB2E3C),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x0000000068032CC8), U64_C(0x00000000D0065990), U64_C(0x00000000B8057558),
+        U64_C(0x00000000A5E0C5D1), U64_C(0x00000000CDE3E919), U64_C(0x0000000075E69C41), U64_C(0x000000001DE5B089),
+        U64_C(0x000000004E2DFD53), U64_C(0x00000000262ED19B), U64_C(0x000000009E2BA4C3), U64_C(0x00000000F628880B),
+        U64_C(0x00000000EBCD3882), U64_C(0x0000000083CE144A), U64_C(0x000000003BCB6112), U64_C(0x0000000053C84DDA),
+        U64_C(0x000000009C5BFAA6), U64_C(0x00000000F458D66E), U64_C(0x000000004C5DA336), U64_C(0x00000000245E8FFE),
+        U64_C(0x0000000039BB3F77), U64_C(0x0000000051B813BF), U64_C(0x00000000E9BD66E7), U64_C(0x0000000081BE4A2F),
+        U64_C(0x00000000D27607F5), U64_C(0x00000000BA752B3D), U64_C(0x0000000002705E65), U64_C(0x000000006A7372AD),
+        U64_C(0x000000007796C224), U64_C(0x000000001F95EEEC), U64_C(0x00000000A7909BB4), U64_C(0x00000000CF93B77C),
+        U64_C(0x000000003D5B83BD), U64_C(0x000000005558AF75), U64_C(0x00000000ED5DDA2D), U64_C(0x00000000855EF6E5),
+        U64_C(0x0000000098BB466C), U64_C(0x00000000F0B86AA4), U64_C(0x0000000048BD1FFC), U64_C(0x0000000020BE3334),
+        U64_C(0x0000000073767EEE), U64_C(0x000000001B755226), U64_C(0x00000000A370277E), U64_C(0x00000000CB730BB6),
+        U64_C(0x00000000D696BB3F), U64_C(0x00000000BE9597F7), U64_C(0x000000000690E2AF), U64_C(0x000000006E93CE67),
+        U64_C(0x00000000A100791B), U64_C(0x00000000C90355D3), U64_C(0x000000007106208B), U64_C(0x0000000019050C43),
+        U64_C(0x0000000004E0BCCA), U64_C(0x000000006CE39002), U64_C(0x00000000D4E6E55A), U64_C(0x00000000BCE5C992),
+        U64_C(0x00000000EF2D8448), U64_C(0x00000000872EA880), U64_C(0x000000003F2BDDD8), U64_C(0x000000005728F110),
+        U64_C(0x000000004ACD4199), U64_C(0x0000000022CE6D51), U64_C(0x000000009ACB1809), U64_C(0x00000000F2C834C1),
+        U64_C(0x000000007AB7077A), U64_C(0x0000000012B42BB2), U64_C(0x00000000AAB15EEA), U64_C(0x00000000C2B27222),
+        U64_C(0x00000000DF57C2AB), U64_C(0x00000000B754EE63), U64_C(0x000000000F519B3B), U64_C(0x000000006752B7F3),
+        U64_C(0x00000000349AFA29), U64_C(0x000000005C99D6E1), U64_C(0x00000000E49CA3B9), U64_C(0x000000008C9F8F71),
+        U64_C(0x00000000917A3FF8), U64_C(0x00000000F9791330), U64_C(0x00000000417C6668), U64_C(0x00000000297F4AA0),
+        U64_C(0x00000000E6ECFDDC), U64_C(0x000000008EEFD114), U64_C(0x0000000036EAA44C), U64_C(0x000000005EE98884),
+        U64_C(0x00000000430C380D), U64_C(0x000000002B0F14C5), U64_C(0x00000000930A619D), U64_C(0x00000000FB094D55),
+        U64_C(0x00000000A8C1008F), U64_C(0x00000000C0C22C47), U64_C(0x0000000078C7591F), U64_C(0x0000000010C475D7),
+        U64_C(0x000000000D21C55E), U64_C(0x000000006522E996), U64_C(0x00000000DD279CCE), U64_C(0x00000000B524B006),
+        U64_C(0x0000000047EC84C7), U64_C(0x000000002FEFA80F), U64_C(0x0000000097EADD57), U64_C(0x00000000FFE9F19F),
+        U64_C(0x00000000E20C4116), U64_C(0x000000008A0F6DDE), U64_C(0x00000000320A1886), U64_C(0x000000005A09344E),
+        U64_C(0x0000000009C17994), U64_C(0x0000000061C2555C), U64_C(0x00000000D9C72004), U64_C(0x00000000B1C40CCC),
+        U64_C(0x00000000AC21BC45), U64_C(0x00000000C422908D), U64_C(0x000000007C27E5D5), U64_C(0x000000001424C91D),
+        U64_C(0x00000000DBB77E61), U64_C(0x00000000B3B452A9), U64_C(0x000000000BB127F1), U64_C(0x0000000063B20B39),
+        U64_C(0x000000007E57BBB0), U64_C(0x0000000016549778), U64_C(0x00000000AE51E220), U64_C(0x00000000C652CEE8),
+        U64_C(0x00000000959A8332), U64_C(0x00000000FD99AFFA), U64_C(0x00000000459CDAA2), U64_C(0x000000002D9FF66A),
+        U64_C(0x00000000307A46E3), U64_C(0x0000000058796A2B), U64_C(0x00000000E07C1F73), U64_C(0x00000000887F33BB),
+        U64_C(0x00000000F56E0EF4), U64_C(0x000000009D6D223C), U64_C(0x0000000025685764), U64_C(0x000000004D6B7BAC),
+        U64_C(0x00000000508ECB25), U64_C(0x00000000388DE7ED), U64_C(0x00000000808892B5), U64_C(0x00000000E88BBE7D),
+        U64_C(0x00000000BB43F3A7), U64_C(0x00000000D340DF6F), U64_C(0x000000006B45AA37), U64_C(0x00000000034686FF),
+        U64_C(0x000000001EA33676), U64_C(0x0000000076A01ABE), U64_C(0x00000000CEA56FE6), U64_C(0x00000000A6A6432E),
+        U64_C(0x000000006935F452), U64_C(0x000000000136D89A), U64_C(0x00000000B933ADC2), U64_C(0x00000000D130810A),
+        U64_C(0x00000000CCD53183), U64_C(0x00000000A4D61D4B), U64_C(0x000000001CD36813), U64_C(0x0000000074D044DB),
+        U64_C(0x0000000027180901), U64_C(0x000000004F1B25C9), U64_C(0x00000000F71E5091), U64_C(0x000000009F1D7C59),
+        U64_C(0x0000000082F8CCD0), U64_C(0x00000000EAFBE018), U64_C(0x0000000052FE9540), U64_C(0x000000003AFDB988),
+        U64_C(0x00000000C8358D49), U64_C(0x00000000A036A181), U64_C(0x000000001833D4D9), U64_C(0x000000007030F811),
+        U64_C(0x000000006DD54898), U64_C(0x0000000005D66450), U64_C(0x00000000BDD31108), U64_C(0x00000000D5D03DC0),
+        U64_C(0x000000008618701A), U64_C(0x00000000EE1B5CD2), U64_C(0x00000000561E298A), U64_C(0x000000003E1D0542),
+        U64_C(0x0000000023F8B5CB), U64_C(0x000000004BFB9903), U64_C(0x00000000F3FEEC5B), U64_C(0x000000009BFDC093),
+        U64_C(0x00000000546E77EF), U64_C(0x000000003C6D5B27), U64_C(0x0000000084682E7F), U64_C(0x00000000EC6B02B7),
+        U64_C(0x00000000F18EB23E), U64_C(0x00000000998D9EF6), U64_C(0x000000002188EBAE), U64_C(0x00000000498BC766),
+        U64_C(0x000000001A438ABC), U64_C(0x000000007240A674), U64_C(0x00000000CA45D32C), U64_C(0x00000000A246FFE4),
+        U64_C(0x00000000BFA34F6D), U64_C(0x00000000D7A063A5), U64_C(0x000000006FA516FD), U64_C(0x0000000007A63A35),
+        U64_C(0x000000008FD9098E), U64_C(0x00000000E7DA2546), U64_C(0x000000005FDF501E), U64_C(0x0000000037DC7CD6),
+        U64_C(0x000000002A39CC5F), U64_C(0x00000000423AE097), U64_C(0x00000000FA3F95CF), U64_C(0x00000000923CB907),
+        U64_C(0x00000000C1F4F4DD), U64_C(0x00000000A9F7D815), U64_C(0x0000000011F2AD4D), U64_C(0x0000000079F18185),
+        U64_C(0x000000006414310C), U64_C(0x000000000C171DC4), U64_C(0x00000000B412689C), U64_C(0x00000000DC114454),
+        U64_C(0x000000001382F328), U64_C(0x000000007B81DFE0), U64_C(0x00000000C384AAB8), U64_C(0x00000000AB878670),
+        U64_C(0x00000000B66236F9), U64_C(0x00000000DE611A31), U64_C(0x0000000066646F69), U64_C(0x000000000E6743A1),
+        U64_C(0x000000005DAF0E7B), U64_C(0x0000000035AC22B3), U64_C(0x000000008DA957EB), U64_C(0x00000000E5AA7B23),
+        U64_C(0x00000000F84FCBAA), U64_C(0x00000000904CE762), U64_C(0x000000002849923A), U64_C(0x00000000404ABEF2),
+        U64_C(0x00000000B2828A33), U64_C(0x00000000DA81A6FB), U64_C(0x000000006284D3A3), U64_C(0x000000000A87FF6B),
+        U64_C(0x0000000017624FE2), U64_C(0x000000007F61632A), U64_C(0x00000000C7641672), U64_C(0x00000000AF673ABA),
+        U64_C(0x00000000FCAF7760), U64_C(0x0000000094AC5BA8), U64_C(0x000000002CA92EF0), U64_C(0x0000000044AA0238),
+        U64_C(0x00000000594FB2B1), U64_C(0x00000000314C9E79), U64_C(0x000000008949EB21), U64_C(0x00000000E14AC7E9),
+        U64_C(0x000000002ED97095), U64_C(0x0000000046DA5C5D), U64_C(0x00000000FEDF2905), U64_C(0x0000000096DC05CD),
+        U64_C(0x000000008B39B544), U64_C(0x00000000E33A998C), U64_C(0x000000005B3FECD4), U64_C(0x00000000333CC01C),
+        U64_C(0x0000000060F48DC6), U64_C(0x0000000008F7A10E), U64_C(0x00000000B0F2D456), U64_C(0x00000000D8F1F89E),
+        U64_C(0x00000000C5144817), U64_C(0x00000000AD1764DF), U64_C(0x0000000015121187), U64_C(0x000000007D113D4F),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x00000000493C7D27), U64_C(0x000000009278FA4E), U64_C(0x00000000DB448769),
+        U64_C(0x00000000211D826D), U64_C(0x000000006821FF4A), U64_C(0x00000000B3657823), U64_C(0x00000000FA590504),
+        U64_C(0x00000000423B04DA), U64_C(0x000000000B0779FD), U64_C(0x00000000D043FE94), U64_C(0x00000000997F83B3),
+        U64_C(0x00000000632686B7), U64_C(0x000000002A1AFB90), U64_C(0x00000000F15E7CF9), U64_C(0x00000000B86201DE),
+        U64_C(0x00000000847609B4), U64_C(0x00000000CD4A7493), U64_C(0x00000000160EF3FA), U64_C(0x000000005F328EDD),
+        U64_C(0x00000000A56B8BD9), U64_C(0x00000000EC57F6FE), U64_C(0x0000000037137197), U64_C(0x000000007E2F0CB0),
+        U64_C(0x00000000C64D0D6E), U64_C(0x000000008F717049), U64_C(0x000000005435F720), U64_C(0x000000001D098A07),
+        U64_C(0x00000000E7508F03), U64_C(0x00000000AE6CF224), U64_C(0x000000007528754D), U64_C(0x000000003C14086A),
+        U64_C(0x000000000D006599), U64_C(0x00000000443C18BE), U64_C(0x000000009F789FD7), U64_C(0x00000000D644E2F0),
+        U64_C(0x000000002C1DE7F4), U64_C(0x0000000065219AD3), U64_C(0x00000000BE651DBA), U64_C(0x00000000F759609D),
+        U64_C(0x000000004F3B6143), U64_C(0x0000000006071C64), U64_C(0x00000000DD439B0D), U64_C(0x00000000947FE62A),
+        U64_C(0x000000006E26E32E), U64_C(0x00000000271A9E09), U64_C(0x00000000FC5E1960), U64_C(0x00000000B5626447),
+        U64_C(0x0000000089766C2D), U64_C(0x00000000C04A110A), U64_C(0x000000001B0E9663), U64_C(0x000000005232EB44),
+        U64_C(0x00000000A86BEE40), U64_C(0x00000000E1579367), U64_C(0x000000003A13140E), U64_C(0x00000000732F6929),
+        U64_C(0x00000000CB4D68F7), U64_C(0x00000000827115D0), U64_C(0x00000000593592B9), U64_C(0x000000001009EF9E),
+        U64_C(0x00000000EA50EA9A), U64_C(0x00000000A36C97BD), U64_C(0x00000000782810D4), U64_C(0x0000000031146DF3),
+        U64_C(0x000000001A00CB32), U64_C(0x00000000533CB615), U64_C(0x000000008878317C), U64_C(0x00000000C1444C5B),
+        U64_C(0x000000003B1D495F), U64_C(0x0000000072213478), U64_C(0x00000000A965B311), U64_C(0x00000000E059CE36),
+        U64_C(0x00000000583BCFE8), U64_C(0x000000001107B2CF), U64_C(0x00000000CA4335A6), U64_C(0x00000000837F4881),
+        U64_C(0x0000000079264D85), U64_C(0x00000000301A30A2), U64_C(0x00000000EB5EB7CB), U64_C(0x00000000A262CAEC),
+        U64_C(0x000000009E76C286), U64_C(0x00000000D74ABFA1), U64_C(0x000000000C0E38C8), U64_C(0x00000000453245EF),
+        U64_C(0x00000000BF6B40EB), U64_C(0x00000000F6573DCC), U64_C(0x000000002D13BAA5), U64_C(0x00000000642FC782),
+        U64_C(0x00000000DC4DC65C), U64_C(0x000000009571BB7B), U64_C(0x000000004E353C12), U64_C(0x0000000007094135),
+        U64_C(0x00000000FD504431), U64_C(0x00000000B46C3916), U64_C(0x000000006F28BE7F), U64_C(0x000000002614C358),
+        U64_C(0x000000001700AEAB), U64_C(0x000000005E3CD38C), U64_C(0x00000000857854E5), U64_C(0x00000000CC4429C2),
+        U64_C(0x00000000361D2CC6), U64_C(0x000000007F2151E1), U64_C(0x00000000A465D688), U64_C(0x00000000ED59ABAF),
+        U64_C(0x00000000553BAA71), U64_C(0x000000001C07D756), U64_C(0x00000000C743503F), U64_C(0x000000008E7F2D18),
+        U64_C(0x000000007426281C), U64_C(0x000000003D1A553B), U64_C(0x00000000E65ED252), U64_C(0x00000000AF62AF75),
+        U64_C(0x000000009376A71F), U64_C(0x00000000DA4ADA38), U64_C(0x00000000010E5D51), U64_C(0x0000000048322076),
+        U64_C(0x00000000B26B2572), U64_C(0x00000000FB575855), U64_C(0x000000002013DF3C), U64_C(0x00000000692FA21B),
+        U64_C(0x00000000D14DA3C5), U64_C(0x000000009871DEE2), U64_C(0x000000004335598B), U64_C(0x000000000A0924AC),
+        U64_C(0x00000000F05021A8), U64_C(0x00000000B96C5C8F), U64_C(0x000000006228DBE6), U64_C(0x000000002B14A6C1),
+        U64_C(0x0000000034019664), U64_C(0x000000007D3DEB43), U64_C(0x00000000A6796C2A), U64_C(0x00000000EF45110D),
+        U64_C(0x00000000151C1409), U64_C(0x000000005C20692E), U64_C(0x000000008764EE47), U64_C(0x00000000CE589360),
+        U64_C(0x00000000763A92BE), U64_C(0x000000003F06EF99), U64_C(0x00000000E44268F0), U64_C(0x00000000AD7E15D7),
+        U64_C(0x00000000572710D3), U64_C(0x000000001E1B6DF4), U64_C(0x00000000C55FEA9D), U64_C(0x000000008C6397BA),
+        U64_C(0x00000000B0779FD0), U64_C(0x00000000F94BE2F7), U64_C(0x00000000220F659E), U64_C(0x000000006B3318B9),
+        U64_C(0x00000000916A1DBD), U64_C(0x00000000D856609A), U64_C(0x000000000312E7F3), U64_C(0x000000004A2E9AD4),
+        U64_C(0x00000000F24C9B0A), U64_C(0x00000000BB70E62D), U64_C(0x0000000060346144), U64_C(0x0000000029081C63),
+        U64_C(0x00000000D3511967), U64_C(0x000000009A6D6440), U64_C(0x000000004129E329), U64_C(0x0000000008159E0E),
+        U64_C(0x000000003901F3FD), U64_C(0x00000000703D8EDA), U64_C(0x00000000AB7909B3), U64_C(0x00000000E2457494),
+        U64_C(0x00000000181C7190), U64_C(0x0000000051200CB7), U64_C(0x000000008A648BDE), U64_C(0x00000000C358F6F9),
+        U64_C(0x000000007B3AF727), U64_C(0x0000000032068A00), U64_C(0x00000000E9420D69), U64_C(0x00000000A07E704E),
+        U64_C(0x000000005A27754A), U64_C(0x00000000131B086D), U64_C(0x00000000C85F8F04), U64_C(0x000000008163F223),
+        U64_C(0x00000000BD77FA49), U64_C(0x00000000F44B876E), U64_C(0x000000002F0F0007), U64_C(0x0000000066337D20),
+        U64_C(0x000000009C6A7824), U64_C(0x00000000D5560503), U64_C(0x000000000E12826A), U64_C(0x00000000472EFF4D),
+        U64_C(0x00000000FF4CFE93), U64_C(0x00000000B67083B4), U64_C(0x000000006D3404DD), U64_C(0x00000000240879FA),
+        U64_C(0x00000000DE517CFE), U64_C(0x00000000976D01D9), U64_C(0x000000004C2986B0), U64_C(0x000000000515FB97),
+        U64_C(0x000000002E015D56), U64_C(0x00000000673D2071), U64_C(0x00000000BC79A718), U64_C(0x00000000F545DA3F),
+        U64_C(0x000000000F1CDF3B), U64_C(0x000000004620A21C), U64_C(0x000000009D642575), U64_C(0x00000000D4585852),
+        U64_C(0x000000006C3A598C), U64_C(0x00000000250624AB), U64_C(0x00000000FE42A3C2), U64_C(0x00000000B77EDEE5),
+        U64_C(0x000000004D27DBE1), U64_C(0x00000000041BA6C6), U64_C(0x00000000DF5F21AF), U64_C(0x0000000096635C88),
+        U64_C(0x00000000AA7754E2), U64_C(0x00000000E34B29C5), U64_C(0x00000000380FAEAC), U64_C(0x000000007133D38B),
+        U64_C(0x000000008B6AD68F), U64_C(0x00000000C256ABA8), U64_C(0x0000000019122CC1), U64_C(0x00000000502E51E6),
+        U64_C(0x00000000E84C5038), U64_C(0x00000000A1702D1F), U64_C(0x000000007A34AA76), U64_C(0x000000003308D751),
+        U64_C(0x00000000C951D255), U64_C(0x00000000806DAF72), U64_C(0x000000005B29281B), U64_C(0x000000001215553C),
+        U64_C(0x00000000230138CF), U64_C(0x000000006A3D45E8), U64_C(0x00000000B179C281), U64_C(0x00000000F845BFA6),
+        U64_C(0x00000000021CBAA2), U64_C(0x000000004B20C785), U64_C(0x00000000906440EC), U64_C(0x00000000D9583DCB),
+        U64_C(0x00000000613A3C15), U64_C(0x0000000028064132), U64_C(0x00000000F342C65B), U64_C(0x00000000BA7EBB7C),
+        U64_C(0x000000004027BE78), U64_C(0x00000000091BC35F), U64_C(0x00000000D25F4436), U64_C(0x000000009B633911),
+        U64_C(0x00000000A777317B), U64_C(0x00000000EE4B4C5C), U64_C(0x00000000350FCB35), U64_C(0x000000007C33B612),
+        U64_C(0x00000000866AB316), U64_C(0x00000000CF56CE31), U64_C(0x0000000014124958), U64_C(0x000000005D2E347F),
+        U64_C(0x00000000E54C35A1), U64_C(0x00000000AC704886), U64_C(0x000000007734CFEF), U64_C(0x000000003E08B2C8),
+        U64_C(0x00000000C451B7CC), U64_C(0x000000008D6DCAEB), U64_C(0x0000000056294D82), U64_C(0x000000001F1530A5),
+    },
+};
+
+// CRC-32/ISCSI table
+const u32 CRC32C_TABLE[256] =
+{
+    0x00000000, 0xF26B8303, 0xE13B70F7, 0x1350F3F4,
+    0xC79A971F, 0x35F1141C, 0x26A1E7E8, 0xD4CA64EB,
+    0x8AD958CF, 0x78B2DBCC, 0x6BE22838, 0x9989AB3B,
+    0x4D43CFD0, 0xBF284CD3, 0xAC78BF27, 0x5E133C24,
+    0x105EC76F, 0xE235446C, 0xF165B798, 0x030E349B,
+    0xD7C45070, 0x25AFD373, 0x36FF2087, 0xC494A384,
+    0x9A879FA0, 0x68EC1CA3, 0x7BBCEF57, 0x89D76C54,
+    0x5D1D08BF, 0xAF768BBC, 0xBC267848, 0x4E4DFB4B,
+    0x20BD8EDE, 0xD2D60DDD, 0xC186FE29, 0x33ED7D2A,
+    0xE72719C1, 0x154C9AC2, 0x061C6936, 0xF477EA35,
+    0xAA64D611, 0x580F5512, 0x4B5FA6E6, 0xB93425E5,
+    0x6DFE410E, 0x9F95C20D, 0x8CC531F9, 0x7EAEB2FA,
+    0x30E349B1, 0xC288CAB2, 0xD1D83946, 0x23B3BA45,
+    0xF779DEAE, 0x05125DAD, 0x1642AE59, 0xE4292D5A,
+    0xBA3A117E, 0x4851927D, 0x5B016189, 0xA96AE28A,
+    0x7DA08661, 0x8FCB0562, 0x9C9BF696, 0x6EF07595,
+    0x417B1DBC, 0xB3109EBF, 0xA0406D4B, 0x522BEE48,
+    0x86E18AA3, 0x748A09A0, 0x67DAFA54, 0x95B17957,
+    0xCBA24573, 0x39C9C670, 0x2A993584, 0xD8F2B687,
+    0x0C38D26C, 0xFE53516F, 0xED03A29B, 0x1F682198,
+    0x5125DAD3, 0xA34E59D0, 0xB01EAA24, 0x42752927,
+    0x96BF4DCC, 0x64D4CECF, 0x77843D3B, 0x85EFBE38,
+    0xDBFC821C, 0x2997011F, 0x3AC7F2EB, 0xC8AC71E8,
+    0x1C661503, 0xEE0D9600, 0xFD5D65F4, 0x0F36E6F7,
+    0x61C69362, 0x93AD1061, 0x80FDE395, 0x72966096,
+    0xA65C047D, 0x5437877E, 0x4767748A, 0xB50CF789,
+    0xEB1FCBAD, 0x197448AE, 0x0A24BB5A, 0xF84F3859,
+    0x2C855CB2, 0xDEEEDFB1, 0xCDBE2C45, 0x3FD5AF46,
+    0x7198540D, 0x83F3D70E, 0x90A324FA, 0x62C8A7F9,
+    0xB602C312, 0x44694011, 0x5739B3E5, 0xA55230E6,
+    0xFB410CC2, 0x092A8FC1, 0x1A7A7C35, 0xE811FF36,
+    0x3CDB9BDD, 0xCEB018DE, 0xDDE0EB2A, 0x2F8B6829,
+    0x82F63B78, 0x709DB87B, 0x63CD4B8F, 0x91A6C88C,
+    0x456CAC67, 0xB7072F64, 0xA457DC90, 0x563C5F93,
+    0x082F63B7, 0xFA44E0B4, 0xE9141340, 0x1B7F9043,
+    0xCFB5F4A8, 0x3DDE77AB, 0x2E8E845F, 0xDCE5075C,
+    0x92A8FC17, 0x60C37F14, 0x73938CE0, 0x81F80FE3,
+    0x55326B08, 0xA759E80B, 0xB4091BFF, 0x466298FC,
+    0x1871A4D8, 0xEA1A27DB, 0xF94AD42F, 0x0B21572C,
+    0xDFEB33C7, 0x2D80B0C4, 0x3ED04330, 0xCCBBC033,
+    0xA24BB5A6, 0x502036A5, 0x4370C551, 0xB11B4652,
+    0x65D122B9, 0x97BAA1BA, 0x84EA524E, 0x7681D14D,
+    0x2892ED69, 0xDAF96E6A, 0xC9A99D9E, 0x3BC21E9D,
+    0xEF087A76, 0x1D63F975, 0x0E330A81, 0xFC588982,
+    0xB21572C9, 0x407EF1CA, 0x532E023E, 0xA145813D,
+    0x758FE5D6, 0x87E466D5, 0x94B49521, 0x66DF1622,
+    0x38CC2A06, 0xCAA7A905, 0xD9F75AF1, 0x2B9CD9F2,
+    0xFF56BD19, 0x0D3D3E1A, 0x1E6DCDEE, 0xEC064EED,
+    0xC38D26C4, 0x31E6A5C7, 0x22B65633, 0xD0DDD530,
+    0x0417B1DB, 0xF67C32D8, 0xE52CC12C, 0x1747422F,
+    0x49547E0B, 0xBB3FFD08, 0xA86F0EFC, 0x5A048DFF,
+    0x8ECEE914, 0x7CA56A17, 0x6FF599E3, 0x9D9E1AE0,
+    0xD3D3E1AB, 0x21B862A8, 0x32E8915C, 0xC083125F,
+    0x144976B4, 0xE622F5B7, 0xF5720643, 0x07198540,
+    0x590AB964, 0xAB613A67, 0xB831C993, 0x4A5A4A90,
+    0x9E902E7B, 0x6CFBAD78, 0x7FAB5E8C, 0x8DC0DD8F,
+    0xE330A81A, 0x115B2B19, 0x020BD8ED, 0xF0605BEE,
+    0x24AA3F05, 0xD6C1BC06, 0xC5914FF2, 0x37FACCF1,
+    0x69E9F0D5, 0x9B8273D6, 0x88D28022, 0x7AB90321,
+    0xAE7367CA, 0x5C18E4C9, 0x4F48173D, 0xBD23943E,
+    0xF36E6F75, 0x0105EC76, 0x12551F82, 0xE03E9C81,
+    0x34F4F86A, 0xC69F7B69, 0xD5CF889D, 0x27A40B9E,
+    0x79B737BA, 0x8BDCB4B9, 0x988C474D, 0x6AE7C44E,
+    0xBE2DA0A5, 0x4C4623A6, 0x5F16D052, 0xAD7D5351,
+};
+
+// CRC-32/ISCSI slicing tables
+const u32 CRC32C_SLICE_TABLE[16][256] =
+{
+    {
+        0x00000000, 0xF26B8303, 0xE13B70F7, 0x1350F3F4,
+        0xC79A971F, 0x35F1141C, 0x26A1E7E8, 0xD4CA64EB,
+        0x8AD958CF, 0x78B2DBCC, 0x6BE22838, 0x9989AB3B,
+        0x4D43CFD0, 0xBF284CD3, 0xAC78BF27, 0x5E133C24,
+        0x105EC76F, 0xE235446C, 0xF165B798, 0x030E349B,
+        0xD7C45070, 0x25AFD373, 0x36FF2087, 0xC494A384,
+        0x9A879FA0, 0x68EC1CA3, 0x7BBCEF57, 0x89D76C54,
+        0x5D1D08BF, 0xAF768BBC, 0xBC267848, 0x4E4DFB4B,
+        0x20BD8EDE, 0xD2D60DDD, 0xC186FE29, 0x33ED7D2A,
+        0xE72719C1, 0x154C9AC2, 0x061C6936, 0xF477EA35,
+        0xAA64D611, 0x580F5512, 0x4B5FA6E6, 0xB93425E5,
+        0x6DFE410E, 0x9F95C20D, 0x8CC531F9, 0x7EAEB2FA,
+        0x30E349B1, 0xC288CAB2, 0xD1D83946, 0x23B3BA45,
+        0xF779DEAE, 0x05125DAD, 0x1642AE59, 0xE4292D5A,
+        0xBA3A117E, 0x4851927D, 0x5B016189, 0xA96AE28A,
+        0x7DA08661, 0x8FCB0562, 0x9C9BF696, 0x6EF07595,
+        0x417B1DBC, 0xB3109EBF, 0xA0406D4B, 0x522BEE48,
+        0x86E18AA3, 0x748A09A0, 0x67DAFA54, 0x95B17957,
+        0xCBA24573, 0x39C9C670, 0x2A993584, 0xD8F2B687,
+        0x0C38D26C, 0xFE53516F, 0xED03A29B, 0x1F682198,
+        0x5125DAD3, 0xA34E59D0, 0xB01EAA24, 0x42752927,
+        0x96BF4DCC, 0x64D4CECF, 0x77843D3B, 0x85EFBE38,
+        0xDBFC821C, 0x2997011F, 0x3AC7F2EB, 0xC8AC71E8,
+        0x1C661503, 0xEE0D9600, 0xFD5D65F4, 0x0F36E6F7,
+        0x61C69362, 0x93AD1061, 0x80FDE395, 0x72966096,
+        0xA65C047D, 0x5437877E, 0x4767748A, 0xB50CF789,
+        0xEB1FCBAD, 0x197448AE, 0x0A24BB5A, 0xF84F3859,
+        0x2C855CB2, 0xDEEEDFB1, 0xCDBE2C45, 0x3FD5AF46,
+        0x7198540D, 0x83F3D70E, 0x90A324FA, 0x62C8A7F9,
+        0xB602C312, 0x44694011, 0x5739B3E5, 0xA55230E6,
+        0xFB410CC2, 0x092A8FC1, 0x1A7A7C35, 0xE811FF36,
+        0x3CDB9BDD, 0xCEB018DE, 0xDDE0EB2A, 0x2F8B6829,
+        0x82F63B78, 0x709DB87B, 0x63CD4B8F, 0x91A6C88C,
+        0x456CAC67, 0xB7072F64, 0xA457DC90, 0x563C5F93,
+        0x082F63B7, 0xFA44E0B4, 0xE9141340, 0x1B7F9043,
+        0xCFB5F4A8, 0x3DDE77AB, 0x2E8E845F, 0xDCE5075C,
+        0x92A8FC17, 0x60C37F14, 0x73938CE0, 0x81F80FE3,
+        0x55326B08, 0xA759E80B, 0xB4091BFF, 0x466298FC,
+        0x1871A4D8, 0xEA1A27DB, 0xF94AD42F, 0x0B21572C,
+        0xDFEB33C7, 0x2D80B0C4, 0x3ED04330, 0xCCBBC033,
+        0xA24BB5A6, 0x502036A5, 0x4370C551, 0xB11B4652,
+        0x65D122B9, 0x97BAA1BA, 0x84EA524E, 0x7681D14D,
+        0x2892ED69, 0xDAF96E6A, 0xC9A99D9E, 0x3BC21E9D,
+        0xEF087A76, 0x1D63F975, 0x0E330A81, 0xFC588982,
+        0xB21572C9, 0x407EF1CA, 0x532E023E, 0xA145813D,
+        0x758FE5D6, 0x87E466D5, 0x94B49521, 0x66DF1622,
+        0x38CC2A06, 0xCAA7A905, 0xD9F75AF1, 0x2B9CD9F2,
+        0xFF56BD19, 0x0D3D3E1A, 0x1E6DCDEE, 0xEC064EED,
+        0xC38D26C4, 0x31E6A5C7, 0x22B65633, 0xD0DDD530,
+        0x0417B1DB, 0xF67C32D8, 0xE52CC12C, 0x1747422F,
+        0x49547E0B, 0xBB3FFD08, 0xA86F0EFC, 0x5A048DFF,
+        0x8ECEE914, 0x7CA56A17, 0x6FF599E3, 0x9D9E1AE0,
+        0xD3D3E1AB, 0x21B862A8, 0x32E8915C, 0xC083125F,
+        0x144976B4, 0xE622F5B7, 0xF5720643, 0x07198540,
+        0x590AB964, 0xAB613A67, 0xB831C993, 0x4A5A4A90,
+        0x9E902E7B, 0x6CFBAD78, 0x7FAB5E8C, 0x8DC0DD8F,
+        0xE330A81A, 0x115B2B19, 0x020BD8ED, 0xF0605BEE,
+        0x24AA3F05, 0xD6C1BC06, 0xC5914FF2, 0x37FACCF1,
+        0x69E9F0D5, 0x9B8273D6, 0x88D28022, 0x7AB90321,
+        0xAE7367CA, 0x5C18E4C9, 0x4F48173D, 0xBD23943E,
+        0xF36E6F75, 0x0105EC76, 0x12551F82, 0xE03E9C81,
+        0x34F4F86A, 0xC69F7B69, 0xD5CF889D, 0x27A40B9E,
+        0x79B737BA, 0x8BDCB4B9, 0x988C474D, 0x6AE7C44E,
+        0xBE2DA0A5, 0x4C4623A6, 0x5F16D052, 0xAD7D5351,
+    },
+    {
+        0x00000000, 0x13A29877, 0x274530EE, 0x34E7A899,
+        0x4E8A61DC, 0x5D28F9AB, 0x69CF5132, 0x7A6DC945,
+        0x9D14C3B8, 0x8EB65BCF, 0xBA51F356, 0xA9F36B21,
+        0xD39EA264, 0xC03C3A13, 0xF4DB928A, 0xE7790AFD,
+        0x3FC5F181, 0x2C6769F6, 0x1880C16F, 0x0B225918,
+        0x714F905D, 0x62ED082A, 0x560AA0B3, 0x45A838C4,
+        0xA2D13239, 0xB173AA4E, 0x859402D7, 0x96369AA0,
+        0xEC5B53E5, 0xFFF9CB92, 0xCB1E630B, 0xD8BCFB7C,
+        0x7F8BE302, 0x6C297B75, 0x58CED3EC, 0x4B6C4B9B,
+        0x310182DE, 0x22A31AA9, 0x1644B230, 0x05E62A47,
+        0xE29F20BA, 0xF13DB8CD, 0xC5DA1054, 0xD6788823,
+        0xAC154166, 0xBFB7D911, 0x8B507188, 0x98F2E9FF,
+        0x404E1283, 0x53EC8AF4, 0x670B226D, 0x74A9BA1A,
+        0x0EC4735F, 0x1D66EB28, 0x298143B1, 0x3A23DBC6,
+        0xDD5AD13B, 0xCEF8494C, 0xFA1FE1D5, 0xE9BD79A2,
+        0x93D0B0E7, 0x80722890, 0xB4958009, 0xA737187E,
+        0xFF17C604, 0xECB55E73, 0xD852F6EA, 0xCBF06E9D,
+        0xB19DA7D8, 0xA23F3FAF, 0x96D89736, 0x857A0F41,
+        0x620305BC, 0x71A19DCB, 0x45463552, 0x56E4AD25,
+        0x2C896460, 0x3F2BFC17, 0x0BCC548E, 0x186ECCF9,
+        0xC0D23785, 0xD370AFF2, 0xE797076B, 0xF4359F1C,
+        0x8E585659, 0x9DFACE2E, 0xA91D66B7, 0xBABFFEC0,
+        0x5DC6F43D, 0x4E646C4A, 0x7A83C4D3, 0x69215CA4,
+        0x134C95E1, 0x00EE0D96, 0x3409A50F, 0x27AB3D78,
+        0x809C2506, 0x933EBD71, 0xA7D915E8, 0xB47B8D9F,
+        0xCE1644DA, 0xDDB4DCAD, 0xE9537434, 0xFAF1EC43,
+        0x1D88E6BE, 0x0E2A7EC9, 0x3ACDD650, 0x296F4E27,
+        0x53028762, 0x40A01F15, 0x7447B78C, 0x67E52FFB,
+        0xBF59D487, 0xACFB4CF0, 0x981CE469, 0x8BBE7C1E,
+        0xF1D3B55B, 0xE2712D2C, 0xD69685B5, 0xC5341DC2,
+        0x224D173F, 0x31EF8F48, 0x050827D1, 0x16AABFA6,
+        0x6CC776E3, 0x7F65EE94, 0x4B82460D, 0x5820DE7A,
+        0xFBC3FAF9, 0xE861628E, 0xDC86CA17, 0xCF245260,
+        0xB5499B25, 0xA6EB0352, 0x920CABCB, 0x81AE33BC,
+        0x66D73941, 0x7575A136, 0x419209AF, 0x523091D8,
+        0x285D589D, 0x3BFFC0EA, 0x0F186873, 0x1CBAF004,
+        0xC4060B78, 0xD7A4930F, 0xE3433B96, 0xF0E1A3E1,
+        0x8A8C6AA4, 0x992EF2D3, 0xADC95A4A, 0xBE6BC23D,
+        0x5912C8C0, 0x4AB050B7, 0x7E57F82E, 0x6DF56059,
+        0x1798A91C, 0x043A316B, 0x30DD99F2, 0x237F0185,
+        0x844819FB, 0x97EA818C, 0xA30D2915, 0xB0AFB162,
+        0xCAC27827, 0xD960E050, 0xED8748C9, 0xFE25D0BE,
+        0x195CDA43, 0x0AFE4234, 0x3E19EAAD, 0x2DBB72DA,
+        0x57D6BB9F, 0x447423E8, 0x70938B71, 0x63311306,
+        0xBB8DE87A, 0xA82F700D, 0x9CC8D894, 0x8F6A40E3,
+        0xF50789A6, 0xE6A511D1, 0xD242B948, 0xC1E0213F,
+        0x26992BC2, 0x353BB3B5, 0x01DC1B2C, 0x127E835B,
+        0x68134A1E, 0x7BB1D269, 0x4F567AF0, 0x5CF4E287,
+        0x04D43CFD, 0x1776A48A, 0x23910C13, 0x30339464,
+        0x4A5E5D21, 0x59FCC556, 0x6D1B6DCF, 0x7EB9F5B8,
+        0x99C0FF45, 0x8A626732, 0xBE85CFAB, 0xAD2757DC,
+        0xD74A9E99, 0xC4E806EE, 0xF00FAE77, 0xE3AD3600,
+        0x3B11CD7C, 0x28B3550B, 0x1C54FD92, 0x0FF665E5,
+        0x759BACA0, 0x663934D7, 0x52DE9C4E, 0x417C0439,
+        0xA6050EC4, 0xB5A796B3, 0x81403E2A, 0x92E2A65D,
+        0xE88F6F18, 0xFB2DF76F, 0xCFCA5FF6, 0xDC68C781,
+        0x7B5FDFFF, 0x68FD4788, 0x5C1AEF11, 0x4FB87766,
+        0x35D5BE23, 0x26772654, 0x12908ECD, 0x013216BA,
+        0xE64B1C47, 0xF5E98430, 0xC10E2CA9, 0xD2ACB4DE,
+        0xA8C17D9B, 0xBB63E5EC, 0x8F844D75, 0x9C26D502,
+        0x449A2E7E, 0x5738B609, 0x63DF1E90, 0x707D86E7,
+        0x0A104FA2, 0x19B2D7D5, 0x2D557F4C, 0x3EF7E73B,
+        0xD98EEDC6, 0xCA2C75B1, 0xFECBDD28, 0xED69455F,
+        0x97048C1A, 0x84A6146D, 0xB041BCF4, 0xA3E32483,
+    },
+    {
+        0x00000000, 0xA541927E, 0x4F6F520D, 0xEA2EC073,
+        0x9EDEA41A, 0x3B9F3664, 0xD1B1F617, 0x74F06469,
+        0x38513EC5, 0x9D10ACBB, 0x773E6CC8, 0xD27FFEB6,
+        0xA68F9ADF, 0x03CE08A1, 0xE9E0C8D2, 0x4CA15AAC,
+        0x70A27D8A, 0xD5E3EFF4, 0x3FCD2F87, 0x9A8CBDF9,
+        0xEE7CD990, 0x4B3D4BEE, 0xA1138B9D, 0x045219E3,
+        0x48F3434F, 0xEDB2D131, 0x079C1142, 0xA2DD833C,
+        0xD62DE755, 0x736C752B, 0x9942B558, 0x3C032726,
+        0xE144FB14, 0x4405696A, 0xAE2BA919, 0x0B6A3B67,
+        0x7F9A5F0E, 0xDADBCD70, 0x30F50D03, 0x95B49F7D,
+        0xD915C5D1, 0x7C5457AF, 0x967A97DC, 0x333B05A2,
+        0x47CB61CB, 0xE28AF3B5, 0x08A433C6, 0xADE5A1B8,
+        0x91E6869E, 0x34A714E0, 0xDE89D493, 0x7BC846ED,
+        0x0F382284, 0xAA79B0FA, 0x40577089, 0xE516E2F7,
+        0xA9B7B85B, 0x0CF62A25, 0xE6D8EA56, 0x43997828,
+        0x37691C41, 0x92288E3F, 0x78064E4C, 0xDD47DC32,
+        0xC76580D9, 0x622412A7, 0x880AD2D4, 0x2D4B40AA,
+        0x59BB24C3, 0xFCFAB6BD, 0x16D476CE, 0xB395E4B0,
+        0xFF34BE1C, 0x5A752C62, 0xB05BEC11, 0x151A7E6F,
+        0x61EA1A06, 0xC4AB8878, 0x2E85480B, 0x8BC4DA75,
+        0xB7C7FD53, 0x12866F2D, 0xF8A8AF5E, 0x5DE93D20,
+        0x29195949, 0x8C58CB37, 0x66760B44, 0xC337993A,
+        0x8F96C396, 0x2AD751E8, 0xC0F9919B, 0x65B803E5,
+        0x1148678C, 0xB409F5F2, 0x5E273581, 0xFB66A7FF,
+        0x26217BCD, 0x8360E9B3, 0x694E29C0, 0xCC0FBBBE,
+        0xB8FFDFD7, 0x1DBE4DA9, 0xF7908DDA, 0x52D11FA4,
+        0x1E704508, 0xBB31D776, 0x511F1705, 0xF45E857B,
+        0x80AEE112, 0x25EF736C, 0xCFC1B31F, 0x6A802161,
+        0x56830647, 0xF3C29439, 0x19EC544A, 0xBCADC634,
+        0xC85DA25D, 0x6D1C3023, 0x8732F050, 0x2273622E,
+        0x6ED23882, 0xCB93AAFC, 0x21BD6A8F, 0x84FCF8F1,
+        0xF00C9C98, 0x554D0EE6, 0xBF63CE95, 0x1A225CEB,
+        0x8B277743, 0x2E66E53D, 0xC448254E, 0x6109B730,
+        0x15F9D359, 0xB0B84127, 0x5A968154, 0xFFD7132A,
+        0xB3764986, 0x1637DBF8, 0xFC191B8B, 0x595889F5,
+        0x2DA8ED9C, 0x88E97FE2, 0x62C7BF91, 0xC7862DEF,
+        0xFB850AC9, 0x5EC498B7, 0xB4EA58C4, 0x11ABCABA,
+        0x655BAED3, 0xC01A3CAD, 0x2A34FCDE, 0x8F756EA0,
+        0xC3D4340C, 0x6695A672, 0x8CBB6601, 0x29FAF47F,
+        0x5D0A9016, 0xF84B0268, 0x1265C21B, 0xB7245065,
+        0x6A638C57, 0xCF221E29, 0x250CDE5A, 0x804D4C24,
+        0xF4BD284D, 0x51FCBA33, 0xBBD27A40, 0x1E93E83E,
+        0x5232B292, 0xF77320EC, 0x1D5DE09F, 0xB81C72E1,
+        0xCCEC1688, 0x69AD84F6, 0x83834485, 0x26C2D6FB,
+        0x1AC1F1DD, 0xBF8063A3, 0x55AEA3D0, 0xF0EF31AE,
+        0x841F55C7, 0x215EC7B9, 0xCB7007CA, 0x6E3195B4,
+        0x2290CF18, 0x87D15D66, 0x6DFF9D15, 0xC8BE0F6B,
+        0xBC4E6B02, 0x190FF97C, 0xF321390F, 0x5660AB71,
+        0x4C42F79A, 0xE90365E4, 0x032DA597, 0xA66C37E9,
+        0xD29C5380, 0x77DDC1FE, 0x9DF3018D, 0x38B293F3,
+        0x7413C95F, 0xD1525B21, 0x3B7C9B52, 0x9E3D092C,
+        0xEACD6D45, 0x4F8CFF3B, 0xA5A23F48, 0x00E3AD36,
+        0x3CE08A10, 0x99A1186E, 0x738FD81D, 0xD6CE4A63,
+        0xA23E2E0A, 0x077FBC74, 0xED517C07, 0x4810EE79,
+        0x04B1B4D5, 0xA1F026AB, 0x4BDEE6D8, 0xEE9F74A6,
+        0x9A6F10CF, 0x3F2E82B1, 0xD50042C2, 0x7041D0BC,
+        0xAD060C8E, 0x08479EF0, 0xE2695E83, 0x4728CCFD,
+        0x33D8A894, 0x96993AEA, 0x7CB7FA99, 0xD9F668E7,
+        0x9557324B, 0x3016A035, 0xDA386046, 0x7F79F238,
+        0x0B899651, 0xAEC8042F, 0x44E6C45C, 0xE1A75622,
+        0xDDA47104, 0x78E5E37A, 0x92CB2309, 0x378AB177,
+        0x437AD51E, 0xE63B4760, 0x0C158713, 0xA954156D,
+        0xE5F54FC1, 0x40B4DDBF, 0xAA9A1DCC, 0x0FDB8FB2,
+        0x7B2BEBDB, 0xDE6A79A5, 0x3444B9D6, 0x91052BA8,
+    },
+    {
+        0x00000000, 0xDD45AAB8, 0xBF672381, 0x62228939,
+        0x7B2231F3, 0xA6679B4B, 0xC4451272, 0x1900B8CA,
+        0xF64463E6, 0x2B01C95E, 0x49234067, 0x9466EADF,
+        0x8D665215, 0x5023F8AD, 0x32017194, 0xEF44DB2C,
+        0xE964B13D, 0x34211B85, 0x560392BC, 0x8B463804,
+        0x924680CE, 0x4F032A76, 0x2D21A34F, 0xF06409F7,
+        0x1F20D2DB, 0xC2657863, 0xA047F15A, 0x7D025BE2,
+        0x6402E328, 0xB9474990, 0xDB65C0A9, 0x06206A11,
+        0xD725148B, 0x0A60BE33, 0x6842370A, 0xB5079DB2,
+        0xAC072578, 0x71428FC0, 0x136006F9, 0xCE25AC41,
+        0x2161776D, 0xFC24DDD5, 0x9E0654EC, 0x4343FE54,
+        0x5A43469E, 0x8706EC26, 0xE524651F, 0x3861CFA7,
+        0x3E41A5B6, 0xE3040F0E, 0x81268637, 0x5C632C8F,
+        0x45639445, 0x98263EFD, 0xFA04B7C4, 0x27411D7C,
+        0xC805C650, 0x15406CE8, 0x7762E5D1, 0xAA274F69,
+        0xB327F7A3, 0x6E625D1B, 0x0C40D422, 0xD1057E9A,
+        0xABA65FE7, 0x76E3F55F, 0x14C17C66, 0xC984D6DE,
+        0xD0846E14, 0x0DC1C4AC, 0x6FE34D95, 0xB2A6E72D,
+        0x5DE23C01, 0x80A796B9, 0xE2851F80, 0x3FC0B538,
+        0x26C00DF2, 0xFB85A74A, 0x99A72E73, 0x44E284CB,
+        0x42C2EEDA, 0x9F874462, 0xFDA5CD5B, 0x20E067E3,
+        0x39E0DF29, 0xE4A57591, 0x8687FCA8, 0x5BC25610,
+        0xB4868D3C, 0x69C32784, 0x0BE1AEBD, 0xD6A40405,
+        0xCFA4BCCF, 0x12E11677, 0x70C39F4E, 0xAD8635F6,
+        0x7C834B6C, 0xA1C6E1D4, 0xC3E468ED, 0x1EA1C255,
+        0x07A17A9F, 0xDAE4D027, 0xB8C6591E, 0x6583F3A6,
+        0x8AC7288A, 0x57828232, 0x35A00B0B, 0xE8E5A1B3,
+        0xF1E51979, 0x2CA0B3C1, 0x4E823AF8, 0x93C79040,
+        0x95E7FA51, 0x48A250E9, 0x2A80D9D0, 0xF7C57368,
+        0xEEC5CBA2, 0x3380611A, 0x51A2E823, 0x8CE7429B,
+        0x63A399B7, 0xBEE6330F, 0xDCC4BA36, 0x0181108E,
+        0x1881A844, 0xC5C402FC, 0xA7E68BC5, 0x7AA3217D,
+        0x52A0C93F, 0x8FE56387, 0xEDC7EABE, 0x30824006,
+        0x2982F8CC, 0xF4C75274, 0x96E5DB4D, 0x4BA071F5,
+        0xA4E4AAD9, 0x79A10061, 0x1B838958, 0xC6C623E0,
+        0xDFC69B2A, 0x02833192, 0x60A1B8AB, 0xBDE41213,
+        0xBBC47802, 0x6681D2BA, 0x04A35B83, 0xD9E6F13B,
+        0xC0E649F1, 0x1DA3E349, 0x7F816A70, 0xA2C4C0C8,
+        0x4D801BE4, 0x90C5B15C, 0xF2E73865, 0x2FA292DD,
+        0x36A22A17, 0xEBE780AF, 0x89C50996, 0x5480A32E,
+        0x8585DDB4, 0x58C0770C, 0x3AE2FE35, 0xE7A7548D,
+        0xFEA7EC47, 0x23E246FF, 0x41C0CFC6, 0x9C85657E,
+        0x73C1BE52, 0xAE8414EA, 0xCCA69DD3, 0x11E3376B,
+        0x08E38FA1, 0xD5A62519, 0xB784AC20, 0x6AC10698,
+        0x6CE16C89, 0xB1A4C631, 0xD3864F08, 0x0EC3E5B0,
+        0x17C35D7A, 0xCA86F7C2, 0xA8A47EFB, 0x75E1D443,
+        0x9AA50F6F, 0x47E0A5D7, 0x25C22CEE, 0xF8878656,
+        0xE1873E9C, 0x3CC29424, 0x5EE01D1D, 0x83A5B7A5,
+        0xF90696D8, 0x24433C60, 0x4661B559, 0x9B241FE1,
+        0x8224A72B, 0x5F610D93, 0x3D4384AA, 0xE0062E12,
+        0x0F42F53E, 0xD2075F86, 0xB025D6BF, 0x6D607C07,
+        0x7460C4CD, 0xA9256E75, 0xCB07E74C, 0x16424DF4,
+        0x106227E5, 0xCD278D5D, 0xAF050464, 0x7240AEDC,
+        0x6B401616, 0xB605BCAE, 0xD4273597, 0x09629F2F,
+        0xE6264403, 0x3B63EEBB, 0x59416782, 0x8404CD3A,
+        0x9D0475F0, 0x4041DF48, 0x22635671, 0xFF26FCC9,
+        0x2E238253, 0xF36628EB, 0x9144A1D2, 0x4C010B6A,
+        0x5501B3A0, 0x88441918, 0xEA669021, 0x37233A99,
+        0xD867E1B5, 0x05224B0D, 0x6700C234, 0xBA45688C,
+        0xA345D046, 0x7E007AFE, 0x1C22F3C7, 0xC167597F,
+        0xC747336E, 0x1A0299D6, 0x782010EF, 0xA565BA57,
+        0xBC65029D, 0x6120A825, 0x0302211C, 0xDE478BA4,
+        0x31035088, 0xEC46FA30, 0x8E647309, 0x5321D9B1,
+        0x4A21617B, 0x9764CBC3, 0xF54642FA, 0x2803E842,
+    },
+    {
+        0x00000000, 0x38116FAC, 0x7022DF58, 0x4833B0F4,
+        0xE045BEB0, 0xD854D11C, 0x906761E8, 0xA8760E44,
+        0xC5670B91, 0xFD76643D, 0xB545D4C9, 0x8D54BB65,
+        0x2522B521, 0x1D33DA8D, 0x55006A79, 0x6D1105D5,
+        0x8F2261D3, 0xB7330E7F, 0xFF00BE8B, 0xC711D127,
+        0x6F67DF63, 0x5776B0CF, 0x1F45003B, 0x27546F97,
+        0x4A456A42, 0x725405EE, 0x3A67B51A, 0x0276DAB6,
+        0xAA00D4F2, 0x9211BB5E, 0xDA220BAA, 0xE2336406,
+        0x1BA8B557, 0x23B9DAFB, 0x6B8A6A0F, 0x539B05A3,
+        0xFBED0BE7, 0xC3FC644B, 0x8BCFD4BF, 0xB3DEBB13,
+        0xDECFBEC6, 0xE6DED16A, 0xAEED619E, 0x96FC0E32,
+        0x3E8A0076, 0x069B6FDA, 0x4EA8DF2E, 0x76B9B082,
+        0x948AD484, 0xAC9BBB28, 0xE4A80BDC, 0xDCB96470,
+        0x74CF6A34, 0x4CDE0598, 0x04EDB56C, 0x3CFCDAC0,
+        0x51EDDF15, 0x69FCB0B9, 0x21CF004D, 0x19DE6FE1,
+        0xB1A861A5, 0x89B90E09, 0xC18ABEFD, 0xF99BD151,
+        0x37516AAE, 0x0F400502, 0x4773B5F6, 0x7F62DA5A,
+        0xD714D41E, 0xEF05BBB2, 0xA7360B46, 0x9F2764EA,
+        0xF236613F, 0xCA270E93, 0x8214BE67, 0xBA05D1CB,
+        0x1273DF8F, 0x2A62B023, 0x625100D7, 0x5A406F7B,
+        0xB8730B7D, 0x806264D1, 0xC851D425, 0xF040BB89,
+        0x5836B5CD, 0x6027DA61, 0x28146A95, 0x10050539,
+        0x7D1400EC, 0x45056F40, 0x0D36DFB4, 0x3527B018,
+        0x9D51BE5C, 0xA540D1F0, 0xED736104, 0xD5620EA8,
+        0x2CF9DFF9, 0x14E8B055, 0x5CDB00A1, 0x64CA6F0D,
+        0xCCBC6149, 0xF4AD0EE5, 0xBC9EBE11, 0x848FD1BD,
+        0xE99ED468, 0xD18FBBC4, 0x99BC0B30, 0xA1AD649C,
+        0x09DB6AD8, 0x31CA0574, 0x79F9B580, 0x41E8DA2C,
+        0xA3DBBE2A, 0x9BCAD186, 0xD3F96172, 0xEBE80EDE,
+        0x439E009A, 0x7B8F6F36, 0x33BCDFC2, 0x0BADB06E,
+        0x66BCB5BB, 0x5EADDA17, 0x169E6AE3, 0x2E8F054F,
+        0x86F90B0B, 0xBEE864A7, 0xF6DBD453, 0xCECABBFF,
+        0x6EA2D55C, 0x56B3BAF0, 0x1E800A04, 0x269165A8,
+        0x8EE76BEC, 0xB6F60440, 0xFEC5B4B4, 0xC6D4DB18,
+        0xABC5DECD, 0x93D4B161, 0xDBE70195, 0xE3F66E39,
+        0x4B80607D, 0x73910FD1, 0x3BA2BF25, 0x03B3D089,
+        0xE180B48F, 0xD991DB23, 0x91A26BD7, 0xA9B3047B,
+        0x01C50A3F, 0x39D46593, 0x71E7D567, 0x49F6BACB,
+        0x24E7BF1E, 0x1CF6D0B2, 0x54C56046, 0x6CD40FEA,
+        0xC4A201AE, 0xFCB36E02, 0xB480DEF6, 0x8C91B15A,
+        0x750A600B, 0x4D1B0FA7, 0x0528BF53, 0x3D39D0FF,
+        0x954FDEBB, 0xAD5EB117, 0xE56D01E3, 0xDD7C6E4F,
+        0xB06D6B9A, 0x887C0436, 0xC04FB4C2, 0xF85EDB6E,
+        0x5028D52A, 0x6839BA86, 0x200A0A72, 0x181B65DE,
+        0xFA2801D8, 0xC2396E74, 0x8A0ADE80, 0xB21BB12C,
+        0x1A6DBF68, 0x227CD0C4, 0x6A4F6030, 0x525E0F9C,
+        0x3F4F0A49, 0x075E65E5, 0x4F6DD511, 0x777CBABD,
+        0xDF0AB4F9, 0xE71BDB55, 0xAF286BA1, 0x9739040D,
+        0x59F3BFF2, 0x61E2D05E, 0x29D160AA, 0x11C00F06,
+        0xB9B60142, 0x81A76EEE, 0xC994DE1A, 0xF185B1B6,
+        0x9C94B463, 0xA485DBCF, 0xECB66B3B, 0xD4A70497,
+        0x7CD10AD3, 0x44C0657F, 0x0CF3D58B, 0x34E2BA27,
+        0xD6D1DE21, 0xEEC0B18D, 0xA6F30179, 0x9EE26ED5,
+        0x36946091, 0x0E850F3D, 0x46B6BFC9, 0x7EA7D065,
+        0x13B6D5B0, 0x2BA7BA1C, 0x63940AE8, 0x5B856544,
+        0xF3F36B00, 0xCBE204AC, 0x83D1B458, 0xBBC0DBF4,
+        0x425B0AA5, 0x7A4A6509, 0x3279D5FD, 0x0A68BA51,
+        0xA21EB415, 0x9A0FDBB9, 0xD23C6B4D, 0xEA2D04E1,
+        0x873C0134, 0xBF2D6E98, 0xF71EDE6C, 0xCF0FB1C0,
+        0x6779BF84, 0x5F68D028, 0x175B60DC, 0x2F4A0F70,
+        0xCD796B76, 0xF56804DA, 0xBD5BB42E, 0x854ADB82,
+        0x2D3CD5C6, 0x152DBA6A, 0x5D1E0A9E, 0x650F6532,
+        0x081E60E7, 0x300F0F4B, 0x783CBFBF, 0x402DD013,
+        0xE85BDE57, 0xD04AB1FB, 0x9879010F, 0xA0686EA3,
+    },
+    {
+        0x00000000, 0xEF306B19, 0xDB8CA0C3, 0x34BCCBDA,
+        0xB2F53777, 0x5DC55C6E, 0x697997B4, 0x8649FCAD,
+        0x6006181F, 0x8F367306, 0xBB8AB8DC, 0x54BAD3C5,
+        0xD2F32F68, 0x3DC34471, 0x097F8FAB, 0xE64FE4B2,
+        0xC00C303E, 0x2F3C5B27, 0x1B8090FD, 0xF4B0FBE4,
+        0x72F90749, 0x9DC96C50, 0xA975A78A, 0x4645CC93,
+        0xA00A2821, 0x4F3A4338, 0x7B8688E2, 0x94B6E3FB,
+        0x12FF1F56, 0xFDCF744F, 0xC973BF95, 0x2643D48C,
+        0x85F4168D, 0x6AC47D94, 0x5E78B64E, 0xB148DD57,
+        0x370121FA, 0xD8314AE3, 0xEC8D8139, 0x03BDEA20,
+        0xE5F20E92, 0x0AC2658B, 0x3E7EAE51, 0xD14EC548,
+        0x570739E5, 0xB83752FC, 0x8C8B9926, 0x63BBF23F,
+        0x45F826B3, 0xAAC84DAA, 0x9E748670, 0x7144ED69,
+        0xF70D11C4, 0x183D7ADD, 0x2C81B107, 0xC3B1DA1E,
+        0x25FE3EAC, 0xCACE55B5, 0xFE729E6F, 0x1142F576,
+        0x970B09DB, 0x783B62C2, 0x4C87A918, 0xA3B7C201,
+        0x0E045BEB, 0xE13430F2, 0xD588FB28, 0x3AB89031,
+        0xBCF16C9C, 0x53C10785, 0x677DCC5F, 0x884DA746,
+        0x6E0243F4, 0x813228ED, 0xB58EE337, 0x5ABE882E,
+        0xDCF77483, 0x33C71F9A, 0x077BD440, 0xE84BBF59,
+        0xCE086BD5, 0x213800CC, 0x1584CB16, 0xFAB4A00F,
+        0x7CFD5CA2, 0x93CD37BB, 0xA771FC61, 0x48419778,
+        0xAE0E73CA, 0x413E18D3, 0x7582D309, 0x9AB2B810,
+        0x1CFB44BD, 0xF3CB2FA4, 0xC777E47E, 0x28478F67,
+        0x8BF04D66, 0x64C0267F, 0x507CEDA5, 0xBF4C86BC,
+        0x39057A11, 0xD6351108, 0xE289DAD2, 0x0DB9B1CB,
+        0xEBF65579, 0x04C63E60, 0x307AF5BA, 0xDF4A9EA3,
+        0x5903620E, 0xB6330917, 0x828FC2CD, 0x6DBFA9D4,
+        0x4BFC7D58, 0xA4CC1641, 0x9070DD9B, 0x7F40B682,
+        0xF9094A2F, 0x16392136, 0x2285EAEC, 0xCDB581F5,
+        0x2BFA6547, 0xC4CA0E5E, 0xF076C584, 0x1F46AE9D,
+        0x990F5230, 0x763F3929, 0x4283F2F3, 0xADB399EA,
+        0x1C08B7D6, 0xF338DCCF, 0xC7841715, 0x28B47C0C,
+        0xAEFD80A1, 0x41CDEBB8, 0x75712062, 0x9A414B7B,
+        0x7C0EAFC9, 0x933EC4D0, 0xA7820F0A, 0x48B26413,
+        0xCEFB98BE, 0x21CBF3A7, 0x1577387D, 0xFA475364,
+        0xDC0487E8, 0x3334ECF1, 0x0788272B, 0xE8B84C32,
+        0x6EF1B09F, 0x81C1DB86, 0xB57D105C, 0x5A4D7B45,
+        0xBC029FF7, 0x5332F4EE, 0x678E3F34, 0x88BE542D,
+        0x0EF7A880, 0xE1C7C399, 0xD57B0843, 0x3A4B635A,
+        0x99FCA15B, 0x76CCCA42, 0x42700198, 0xAD406A81,
+        0x2B09962C, 0xC439FD35, 0xF08536EF, 0x1FB55DF6,
+        0xF9FAB944, 0x16CAD25D, 0x22761987, 0xCD46729E,
+        0x4B0F8E33, 0xA43FE52A, 0x90832EF0, 0x7FB345E9,
+        0x59F09165, 0xB6C0FA7C, 0x827C31A6, 0x6D4C5ABF,
+        0xEB05A612, 0x0435CD0B, 0x308906D1, 0xDFB96DC8,
+        0x39F6897A, 0xD6C6E263, 0xE27A29B9, 0x0D4A42A0,
+        0x8B03BE0D, 0x6433D514, 0x508F1ECE, 0xBFBF75D7,
+        0x120CEC3D, 0xFD3C8724, 0xC9804CFE, 0x26B027E7,
+        0xA0F9DB4A, 0x4FC9B053, 0x7B757B89, 0x94451090,
+        0x720AF422, 0x9D3A9F3B, 0xA98654E1, 0x46B63FF8,
+        0xC0FFC355, 0x2FCFA84C, 0x1B736396, 0xF443088F,
+        0xD200DC03, 0x3D30B71A, 0x098C7CC0, 0xE6BC17D9,
+        0x60F5EB74, 0x8FC5806D, 0xBB794BB7, 0x544920AE,
+        0xB206C41C, 0x5D36AF05, 0x698A64DF, 0x86BA0FC6,
+        0x00F3F36B, 0xEFC39872, 0xDB7F53A8, 0x344F38B1,
+        0x97F8FAB0, 0x78C891A9, 0x4C745A73, 0xA344316A,
+        0x250DCDC7, 0xCA3DA6DE, 0xFE816D04, 0x11B1061D,
+        0xF7FEE2AF, 0x18CE89B6, 0x2C72426C, 0xC3422975,
+        0x450BD5D8, 0xAA3BBEC1, 0x9E87751B, 0x71B71E02,
+        0x57F4CA8E, 0xB8C4A197, 0x8C786A4D, 0x63480154,
+        0xE501FDF9, 0x0A3196E0, 0x3E8D5D3A, 0xD1BD3623,
+        0x37F2D291, 0xD8C2B988, 0xEC7E7252, 0x034E194B,
+        0x8507E5E6, 0x6A378EFF, 0x5E8B4525, 0xB1BB2E3C,
+    },
+    {
+        0x00000000, 0x68032CC8, 0xD0065990, 0xB8057558,
+        0xA5E0C5D1, 0xCDE3E919, 0x75E69C41, 0x1DE5B089,
+        0x4E2DFD53, 0x262ED19B, 0x9E2BA4C3, 0xF628880B,
+        0xEBCD3882, 0x83CE144A, 0x3BCB6112, 0x53C84DDA,
+        0x9C5BFAA6, 0xF458D66E, 0x4C5DA336, 0x245E8FFE,
+        0x39BB3F77, 0x51B813BF, 0xE9BD66E7, 0x81BE4A2F,
+        0xD27607F5, 0xBA752B3D, 0x02705E65, 0x6A7372AD,
+        0x7796C224, 0x1F95EEEC, 0xA7909BB4, 0xCF93B77C,
+        0x3D5B83BD, 0x5558AF75, 0xED5DDA2D, 0x855EF6E5,
+        0x98BB466C, 0xF0B86AA4, 0x48BD1FFC, 0x20BE3334,
+        0x73767EEE, 0x1B755226, 0xA370277E, 0xCB730BB6,
+        0xD696BB3F, 0xBE9597F7, 0x0690E2AF, 0x6E93CE67,
+        0xA100791B, 0xC90355D3, 0x7106208B, 0x19050C43,
+        0x04E0BCCA, 0x6CE39002, 0xD4E6E55A, 0xBCE5C992,
+        0xEF2D8448, 0x872EA880, 0x3F2BDDD8, 0x5728F110,
+        0x4ACD4199, 0x22CE6D51, 0x9ACB1809, 0xF2C834C1,
+        0x7AB7077A, 0x12B42BB2, 0xAAB15EEA, 0xC2B27222,
+        0xDF57C2AB, 0xB754EE63, 0x0F519B3B, 0x6752B7F3,
+        0x349AFA29, 0x5C99D6E1, 0xE49CA3B9, 0x8C9F8F71,
+        0x917A3FF8, 0xF9791330, 0x417C6668, 0x297F4AA0,
+        0xE6ECFDDC, 0x8EEFD114, 0x36EAA44C, 0x5EE98884,
+        0x430C380D, 0x2B0F14C5, 0x930A619D, 0xFB094D55,
+        0xA8C1008F, 0xC0C22C47, 0x78C7591F, 0x10C475D7,
+        0x0D21C55E, 0x6522E996, 0xDD279CCE, 0xB524B006,
+        0x47EC84C7, 0x2FEFA80F, 0x97EADD57, 0xFFE9F19F,
+        0xE20C4116, 0x8A0F6DDE, 0x320A1886, 0x5A09344E,
+        0x09C17994, 0x61C2555C, 0xD9C72004, 0xB1C40CCC,
+        0xAC21BC45, 0xC422908D, 0x7C27E5D5, 0x1424C91D,
+        0xDBB77E61, 0xB3B452A9, 0x0BB127F1, 0x63B20B39,
+        0x7E57BBB0, 0x16549778, 0xAE51E220, 0xC652CEE8,
+        0x959A8332, 0xFD99AFFA, 0x459CDAA2, 0x2D9FF66A,
+        0x307A46E3, 0x58796A2B, 0xE07C1F73, 0x887F33BB,
+        0xF56E0EF4, 0x9D6D223C, 0x25685764, 0x4D6B7BAC,
+        0x508ECB25, 0x388DE7ED, 0x808892B5, 0xE88BBE7D,
+        0xBB43F3A7, 0xD340DF6F, 0x6B45AA37, 0x034686FF,
+        0x1EA33676, 0x76A01ABE, 0xCEA56FE6, 0xA6A6432E,
+        0x6935F452, 0x0136D89A, 0xB933ADC2, 0xD130810A,
+        0xCCD53183, 0xA4D61D4B, 0x1CD36813, 0x74D044DB,
+        0x27180901, 0x4F1B25C9, 0xF71E5091, 0x9F1D7C59,
+        0x82F8CCD0, 0xEAFBE018, 0x52FE9540, 0x3AFDB988,
+        0xC8358D49, 0xA036A181, 0x1833D4D9, 0x7030F811,
+        0x6DD54898, 0x05D66450, 0xBDD31108, 0xD5D03DC0,
+        0x8618701A, 0xEE1B5CD2, 0x561E298A, 0x3E1D0542,
+        0x23F8B5CB, 0x4BFB9903, 0xF3FEEC5B, 0x9BFDC093,
+        0x546E77EF, 0x3C6D5B27, 0x84682E7F, 0xEC6B02B7,
+        0xF18EB23E, 0x998D9EF6, 0x2188EBAE, 0x498BC766,
+        0x1A438ABC, 0x7240A674, 0xCA45D32C, 0xA246FFE4,
+        0xBFA34F6D, 0xD7A063A5, 0x6FA516FD, 0x07A63A35,
+        0x8FD9098E, 0xE7DA2546, 0x5FDF501E, 0x37DC7CD6,
+        0x2A39CC5F, 0x423AE097, 0xFA3F95CF, 0x923CB907,
+        0xC1F4F4DD, 0xA9F7D815, 0x11F2AD4D, 0x79F18185,
+        0x6414310C, 0x0C171DC4, 0xB412689C, 0xDC114454,
+        0x1382F328, 0x7B81DFE0, 0xC384AAB8, 0xAB878670,
+        0xB66236F9, 0xDE611A31, 0x66646F69, 0x0E6743A1,
+        0x5DAF0E7B, 0x35AC22B3, 0x8DA957EB, 0xE5AA7B23,
+        0xF84FCBAA, 0x904CE762, 0x2849923A, 0x404ABEF2,
+        0xB2828A33, 0xDA81A6FB, 0x6284D3A3, 0x0A87FF6B,
+        0x17624FE2, 0x7F61632A, 0xC7641672, 0xAF673ABA,
+        0xFCAF7760, 0x94AC5BA8, 0x2CA92EF0, 0x44AA0238,
+        0x594FB2B1, 0x314C9E79, 0x8949EB21, 0xE14AC7E9,
+        0x2ED97095, 0x46DA5C5D, 0xFEDF2905, 0x96DC05CD,
+        0x8B39B544, 0xE33A998C, 0x5B3FECD4, 0x333CC01C,
+        0x60F48DC6, 0x08F7A10E, 0xB0F2D456, 0xD8F1F89E,
+        0xC5144817, 0xAD1764DF, 0x15121187, 0x7D113D4F,
+    },
+    {
+        0x00000000, 0x493C7D27, 0x9278FA4E, 0xDB448769,
+        0x211D826D, 0x6821FF4A, 0xB3657823, 0xFA590504,
+        0x423B04DA, 0x0B0779FD, 0xD043FE94, 0x997F83B3,
+        0x632686B7, 0x2A1AFB90, 0xF15E7CF9, 0xB86201DE,
+        0x847609B4, 0xCD4A7493, 0x160EF3FA, 0x5F328EDD,
+        0xA56B8BD9, 0xEC57F6FE, 0x37137197, 0x7E2F0CB0,
+        0xC64D0D6E, 0x8F717049, 0x5435F720, 0x1D098A07,
+        0xE7508F03, 0xAE6CF224, 0x7528754D, 0x3C14086A,
+        0x0D006599, 0x443C18BE, 0x9F789FD7, 0xD644E2F0,
+        0x2C1DE7F4, 0x65219AD3, 0xBE651DBA, 0xF759609D,
+        0x4F3B6143, 0x06071C64, 0xDD439B0D, 0x947FE62A,
+        0x6E26E32E, 0x271A9E09, 0xFC5E1960, 0xB5626447,
+        0x89766C2D, 0xC04A110A, 0x1B0E9663, 0x5232EB44,
+        0xA86BEE40, 0xE1579367, 0x3A13140E, 0x732F6929,
+        0xCB4D68F7, 0x827115D0, 0x593592B9, 0x1009EF9E,
+        0xEA50EA9A, 0xA36C97BD, 0x782810D4, 0x31146DF3,
+        0x1A00CB32, 0x533CB615, 0x8878317C, 0xC1444C5B,
+        0x3B1D495F, 0x72213478, 0xA965B311, 0xE059CE36,
+        0x583BCFE8, 0x1107B2CF, 0xCA4335A6, 0x837F4881,
+        0x79264D85, 0x301A30A2, 0xEB5EB7CB, 0xA262CAEC,
+        0x9E76C286, 0xD74ABFA1, 0x0C0E38C8, 0x453245EF,
+        0xBF6B40EB, 0xF6573DCC, 0x2D13BAA5, 0x642FC782,
+        0xDC4DC65C, 0x9571BB7B, 0x4E353C12, 0x07094135,
+        0xFD504431, 0xB46C3916, 0x6F28BE7F, 0x2614C358,
+        0x1700AEAB, 0x5E3CD38C, 0x857854E5, 0xCC4429C2,
+        0x361D2CC6, 0x7F2151E1, 0xA465D688, 0xED59ABAF,
+        0x553BAA71, 0x1C07D756, 0xC743503F, 0x8E7F2D18,
+        0x7426281C, 0x3D1A553B, 0xE65ED252, 0xAF62AF75,
+        0x9376A71F, 0xDA4ADA38, 0x010E5D51, 0x48322076,
+        0xB26B2572, 0xFB575855, 0x2013DF3C, 0x692FA21B,
+        0xD14DA3C5, 0x9871DEE2, 0x4335598B, 0x0A0924AC,
+        0xF05021A8, 0xB96C5C8F, 0x6228DBE6, 0x2B14A6C1,
+        0x34019664, 0x7D3DEB43, 0xA6796C2A, 0xEF45110D,
+        0x151C1409, 0x5C20692E, 0x8764EE47, 0xCE589360,
+        0x763A92BE, 0x3F06EF99, 0xE44268F0, 0xAD7E15D7,
+        0x572710D3, 0x1E1B6DF4, 0xC55FEA9D, 0x8C6397BA,
+        0xB0779FD0, 0xF94BE2F7, 0x220F659E, 0x6B3318B9,
+        0x916A1DBD, 0xD856609A, 0x0312E7F3, 0x4A2E9AD4,
+        0xF24C9B0A, 0xBB70E62D, 0x60346144, 0x29081C63,
+        0xD3511967, 0x9A6D6440, 0x4129E329, 0x08159E0E,
+        0x3901F3FD, 0x703D8EDA, 0xAB7909B3, 0xE2457494,
+        0x181C7190, 0x51200CB7, 0x8A648BDE, 0xC358F6F9,
+        0x7B3AF727, 0x32068A00, 0xE9420D69, 0xA07E704E,
+        0x5A27754A, 0x131B086D, 0xC85F8F04, 0x8163F223,
+        0xBD77FA49, 0xF44B876E, 0x2F0F0007, 0x66337D20,
+        0x9C6A7824, 0xD5560503, 0x0E12826A, 0x472EFF4D,
+        0xFF4CFE93, 0xB67083B4, 0x6D3404DD, 0x240879FA,
+        0xDE517CFE, 0x976D01D9, 0x4C2986B0, 0x0515FB97,
+        0x2E015D56, 0x673D2071, 0xBC79A718, 0xF545DA3F,
+        0x0F1CDF3B, 0x4620A21C, 0x9D642575, 0xD4585852,
+        0x6C3A598C, 0x250624AB, 0xFE42A3C2, 0xB77EDEE5,
+        0x4D27DBE1, 0x041BA6C6, 0xDF5F21AF, 0x96635C88,
+        0xAA7754E2, 0xE34B29C5, 0x380FAEAC, 0x7133D38B,
+        0x8B6AD68F, 0xC256ABA8, 0x19122CC1, 0x502E51E6,
+        0xE84C5038, 0xA1702D1F, 0x7A34AA76, 0x3308D751,
+        0xC951D255, 0x806DAF72, 0x5B29281B, 0x1215553C,
+        0x230138CF, 0x6A3D45E8, 0xB179C281, 0xF845BFA6,
+        0x021CBAA2, 0x4B20C785, 0x906440EC, 0xD9583DCB,
+        0x613A3C15, 0x28064132, 0xF342C65B, 0xBA7EBB7C,
+        0x4027BE78, 0x091BC35F, 0xD25F4436, 0x9B633911,
+        0xA777317B, 0xEE4B4C5C, 0x350FCB35, 0x7C33B612,
+        0x866AB316, 0xCF56CE31, 0x14124958, 0x5D2E347F,
+        0xE54C35A1, 0xAC704886, 0x7734CFEF, 0x3E08B2C8,
+        0xC451B7CC, 0x8D6DCAEB, 0x56294D82, 0x1F1530A5,
+    },
+    {
+        0x00000000, 0xF43ED648, 0xED91DA61, 0x19AF0C29,
+        0xDECFC233, 0x2AF1147B, 0x335E1852, 0xC760CE1A,
+        0xB873F297, 0x4C4D24DF, 0x55E228F6, 0xA1DCFEBE,
+        0x66BC30A4, 0x9282E6EC, 0x8B2DEAC5, 0x7F133C8D,
+        0x750B93DF, 0x81354597, 0x989A49BE, 0x6CA49FF6,
+        0xABC451EC, 0x5FFA87A4, 0x46558B8D, 0xB26B5DC5,
+        0xCD786148, 0x3946B700, 0x20E9BB29, 0xD4D76D61,
+        0x13B7A37B, 0xE7897533, 0xFE26791A, 0x0A18AF52,
+        0xEA1727BE, 0x1E29F1F6, 0x0786FDDF, 0xF3B82B97,
+        0x34D8E58D, 0xC0E633C5, 0xD9493FEC, 0x2D77E9A4,
+        0x5264D529, 0xA65A0361, 0xBFF50F48, 0x4BCBD900,
+        0x8CAB171A, 0x7895C152, 0x613ACD7B, 0x95041B33,
+        0x9F1CB461, 0x6B226229, 0x728D6E00, 0x86B3B848,
+        0x41D37652, 0xB5EDA01A, 0xAC42AC33, 0x587C7A7B,
+        0x276F46F6, 0xD35190BE, 0xCAFE9C97, 0x3EC04ADF,
+        0xF9A084C5, 0x0D9E528D, 0x14315EA4, 0xE00F88EC,
+        0xD1C2398D, 0x25FCEFC5, 0x3C53E3EC, 0xC86D35A4,
+        0x0F0DFBBE, 0xFB332DF6, 0xE29C21DF, 0x16A2F797,
+        0x69B1CB1A, 0x9D8F1D52, 0x8420117B, 0x701EC733,
+        0xB77E0929, 0x4340DF61, 0x5AEFD348, 0xAED10500,
+        0xA4C9AA52, 0x50F77C1A, 0x49587033, 0xBD66A67B,
+        0x7A066861, 0x8E38BE29, 0x9797B200, 0x63A96448,
+        0x1CBA58C5, 0xE8848E8D, 0xF12B82A4, 0x051554EC,
+        0xC2759AF6, 0x364B4CBE, 0x2FE44097, 0xDBDA96DF,
+        0x3BD51E33, 0xCFEBC87B, 0xD644C452, 0x227A121A,
+        0xE51ADC00, 0x11240A48, 0x088B0661, 0xFCB5D029,
+        0x83A6ECA4, 0x77983AEC, 0x6E3736C5, 0x9A09E08D,
+        0x5D692E97, 0xA957F8DF, 0xB0F8F4F6, 0x44C622BE,
+        0x4EDE8DEC, 0xBAE05BA4, 0xA34F578D, 0x577181C5,
+        0x90114FDF, 0x642F9997, 0x7D8095BE, 0x89BE43F6,
+        0xF6AD7F7B, 0x0293A933, 0x1B3CA51A, 0xEF027352,
+        0x2862BD48, 0xDC5C6B00, 0xC5F36729, 0x31CDB161,
+        0xA66805EB, 0x5256D3A3, 0x4BF9DF8A, 0xBFC709C2,
+        0x78A7C7D8, 0x8C991190, 0x95361DB9, 0x6108CBF1,
+        0x1E1BF77C, 0xEA252134, 0xF38A2D1D, 0x07B4FB55,
+        0xC0D4354F, 0x34EAE307, 0x2D45EF2E, 0xD97B3966,
+        0xD3639634, 0x275D407C, 0x3EF24C55, 0xCACC9A1D,
+        0x0DAC5407, 0xF992824F, 0xE03D8E66, 0x1403582E,
+        0x6B1064A3, 0x9F2EB2EB, 0x8681BEC2, 0x72BF688A,
+        0xB5DFA690, 0x41E170D8, 0x584E7CF1, 0xAC70AAB9,
+        0x4C7F2255, 0xB841F41D, 0xA1EEF834, 0x55D02E7C,
+        0x92B0E066, 0x668E362E, 0x7F213A07, 0x8B1FEC4F,
+        0xF40CD0C2, 0x0032068A, 0x199D0AA3, 0xEDA3DCEB,
+        0x2AC312F1, 0xDEFDC4B9, 0xC752C890, 0x336C1ED8,
+        0x3974B18A, 0xCD4A67C2, 0xD4E56BEB, 0x20DBBDA3,
+        0xE7BB73B9, 0x1385A5F1, 0x0A2AA9D8, 0xFE147F90,
+        0x8107431D, 0x75399555, 0x6C96997C, 0x98A84F34,
+        0x5FC8812E, 0xABF65766, 0xB2595B4F, 0x46678D07,
+        0x77AA3C66, 0x8394EA2E, 0x9A3BE607, 0x6E05304F,
+        0xA965FE55, 0x5D5B281D, 0x44F42434, 0xB0CAF27C,
+        0xCFD9CEF1, 0x3BE718B9, 0x22481490, 0xD676C2D8,
+        0x11160CC2, 0xE528DA8A, 0xFC87D6A3, 0x08B900EB,
+        0x02A1AFB9, 0xF69F79F1, 0xEF3075D8, 0x1B0EA390,
+        0xDC6E6D8A, 0x2850BBC2, 0x31FFB7EB, 0xC5C161A3,
+        0xBAD25D2E, 0x4EEC8B66, 0x5743874F, 0xA37D5107,
+        0x641D9F1D, 0x90234955, 0x898C457C, 0x7DB29334,
+        0x9DBD1BD8, 0x6983CD90, 0x702CC1B9, 0x841217F1,
+        0x4372D9EB, 0xB74C0FA3, 0xAEE3038A, 0x5ADDD5C2,
+        0x25CEE94F, 0xD1F03F07, 0xC85F332E, 0x3C61E566,
+        0xFB012B7C, 0x0F3FFD34, 0x1690F11D, 0xE2AE2755,
+        0xE8B68807, 0x1C885E4F, 0x05275266, 0xF119842E,
+        0x36794A34, 0xC2479C7C, 0xDBE89055, 0x2FD6461D,
+        0x50C57A90, 0xA4FBACD8, 0xBD54A0F1, 0x496A76B9,
+        0x8E0AB8A3, 0x7A346EEB, 0x639B62C2, 0x97A5B48A,
+    },
+    {
+        0x00000000, 0xCB567BA5, 0x934081BB, 0x5816FA1E,
+        0x236D7587, 0xE83B0E22, 0xB02DF43C, 0x7B7B8F99,
+        0x46DAEB0E, 0x8D8C90AB, 0xD59A6AB5, 0x1ECC1110,
+        0x65B79E89, 0xAEE1E52C, 0xF6F71F32, 0x3DA16497,
+        0x8DB5D61C, 0x46E3ADB9, 0x1EF557A7, 0xD5A32C02,
+        0xAED8A39B, 0x658ED83E, 0x3D982220, 0xF6CE5985,
+        0xCB6F3D12, 0x003946B7, 0x582FBCA9, 0x9379C70C,
+        0xE8024895, 0x23543330, 0x7B42C92E, 0xB014B28B,
+        0x1E87DAC9, 0xD5D1A16C, 0x8DC75B72, 0x469120D7,
+        0x3DEAAF4E, 0xF6BCD4EB, 0xAEAA2EF5, 0x65FC5550,
+        0x585D31C7, 0x930B4A62, 0xCB1DB07C, 0x004BCBD9,
+        0x7B304440, 0xB0663FE5, 0xE870C5FB, 0x2326BE5E,
+        0x93320CD5, 0x58647770, 0x00728D6E, 0xCB24F6CB,
+        0xB05F7952, 0x7B0902F7, 0x231FF8E9, 0xE849834C,
+        0xD5E8E7DB, 0x1EBE9C7E, 0x46A86660, 0x8DFE1DC5,
+        0xF685925C, 0x3DD3E9F9, 0x65C513E7, 0xAE936842,
+        0x3D0FB592, 0xF659CE37, 0xAE4F3429, 0x65194F8C,
+        0x1E62C015, 0xD534BBB0, 0x8D2241AE, 0x46743A0B,
+        0x7BD55E9C, 0xB0832539, 0xE895DF27, 0x23C3A482,
+        0x58B82B1B, 0x93EE50BE, 0xCBF8AAA0, 0x00AED105,
+        0xB0BA638E, 0x7BEC182B, 0x23FAE235, 0xE8AC9990,
+        0x93D71609, 0x58816DAC, 0x009797B2, 0xCBC1EC17,
+        0xF6608880, 0x3D36F325, 0x6520093B, 0xAE76729E,
+        0xD50DFD07, 0x1E5B86A2, 0x464D7CBC, 0x8D1B0719,
+        0x23886F5B, 0xE8DE14FE, 0xB0C8EEE0, 0x7B9E9545,
+        0x00E51ADC, 0xCBB36179, 0x93A59B67, 0x58F3E0C2,
+        0x65528455, 0xAE04FFF0, 0xF61205EE, 0x3D447E4B,
+        0x463FF1D2, 0x8D698A77, 0xD57F7069, 0x1E290BCC,
+        0xAE3DB947, 0x656BC2E2, 0x3D7D38FC, 0xF62B4359,
+        0x8D50CCC0, 0x4606B765, 0x1E104D7B, 0xD54636DE,
+        0xE8E75249, 0x23B129EC, 0x7BA7D3F2, 0xB0F1A857,
+        0xCB8A27CE, 0x00DC5C6B, 0x58CAA675, 0x939CDDD0,
+        0x7A1F6B24, 0xB1491081, 0xE95FEA9F, 0x2209913A,
+        0x59721EA3, 0x92246506, 0xCA329F18, 0x0164E4BD,
+        0x3CC5802A, 0xF793FB8F, 0xAF850191, 0x64D37A34,
+        0x1FA8F5AD, 0xD4FE8E08, 0x8CE87416, 0x47BE0FB3,
+        0xF7AABD38, 0x3CFCC69D, 0x64EA3C83, 0xAFBC4726,
+        0xD4C7C8BF, 0x1F91B31A, 0x47874904, 0x8CD132A1,
+        0xB1705636, 0x7A262D93, 0x2230D78D, 0xE966AC28,
+        0x921D23B1, 0x594B5814, 0x015DA20A, 0xCA0BD9AF,
+        0x6498B1ED, 0xAFCECA48, 0xF7D83056, 0x3C8E4BF3,
+        0x47F5C46A, 0x8CA3BFCF, 0xD4B545D1, 0x1FE33E74,
+        0x22425AE3, 0xE9142146, 0xB102DB58, 0x7A54A0FD,
+        0x012F2F64, 0xCA7954C1, 0x926FAEDF, 0x5939D57A,
+        0xE92D67F1, 0x227B1C54, 0x7A6DE64A, 0xB13B9DEF,
+        0xCA401276, 0x011669D3, 0x590093CD, 0x9256E868,
+        0xAFF78CFF, 0x64A1F75A, 0x3CB70D44, 0xF7E176E1,
+        0x8C9AF978, 0x47CC82DD, 0x1FDA78C3, 0xD48C0366,
+        0x4710DEB6, 0x8C46A513, 0xD4505F0D, 0x1F0624A8,
+        0x647DAB31, 0xAF2BD094, 0xF73D2A8A, 0x3C6B512F,
+        0x01CA35B8, 0xCA9C4E1D, 0x928AB403, 0x59DCCFA6,
+        0x22A7403F, 0xE9F13B9A, 0xB1E7C184, 0x7AB1BA21,
+        0xCAA508AA, 0x01F3730F, 0x59E58911, 0x92B3F2B4,
+        0xE9C87D2D, 0x229E0688, 0x7A88FC96, 0xB1DE8733,
+        0x8C7FE3A4, 0x47299801, 0x1F3F621F, 0xD46919BA,
+        0xAF129623, 0x6444ED86, 0x3C521798, 0xF7046C3D,
+        0x5997047F, 0x92C17FDA, 0xCAD785C4, 0x0181FE61,
+        0x7AFA71F8, 0xB1AC0A5D, 0xE9BAF043, 0x22EC8BE6,
+        0x1F4DEF71, 0xD41B94D4, 0x8C0D6ECA, 0x475B156F,
+        0x3C209AF6, 0xF776E153, 0xAF601B4D, 0x643660E8,
+        0xD422D263, 0x1F74A9C6, 0x476253D8, 0x8C34287D,
+        0xF74FA7E4, 0x3C19DC41, 0x640F265F, 0xAF595DFA,
+        0x92F8396D, 0x59AE42C8, 0x01B8B8D6, 0xCAEEC373,
+        0xB1954CEA, 0x7AC3374F, 0x22D5CD51, 0xE983B6F4,
+    },
+    {
+        0x00000000, 0x9771F7C1, 0x2B0F9973, 0xBC7E6EB2,
+        0x561F32E6, 0xC16EC527, 0x7D10AB95, 0xEA615C54,
+        0xAC3E65CC, 0x3B4F920D, 0x8731FCBF, 0x10400B7E,
+        0xFA21572A, 0x6D50A0EB, 0xD12ECE59, 0x465F3998,
+        0x5D90BD69, 0xCAE14AA8, 0x769F241A, 0xE1EED3DB,
+        0x0B8F8F8F, 0x9CFE784E, 0x208016FC, 0xB7F1E13D,
+        0xF1AED8A5, 0x66DF2F64, 0xDAA141D6, 0x4DD0B617,
+        0xA7B1EA43, 0x30C01D82, 0x8CBE7330, 0x1BCF84F1,
+        0xBB217AD2, 0x2C508D13, 0x902EE3A1, 0x075F1460,
+        0xED3E4834, 0x7A4FBFF5, 0xC631D147, 0x51402686,
+        0x171F1F1E, 0x806EE8DF, 0x3C10866D, 0xAB6171AC,
+        0x41002DF8, 0xD671DA39, 0x6A0FB48B, 0xFD7E434A,
+        0xE6B1C7BB, 0x71C0307A, 0xCDBE5EC8, 0x5ACFA909,
+        0xB0AEF55D, 0x27DF029C, 0x9BA16C2E, 0x0CD09BEF,
+        0x4A8FA277, 0xDDFE55B6, 0x61803B04, 0xF6F1CCC5,
+        0x1C909091, 0x8BE16750, 0x379F09E2, 0xA0EEFE23,
+        0x73AE8355, 0xE4DF7494, 0x58A11A26, 0xCFD0EDE7,
+        0x25B1B1B3, 0xB2C04672, 0x0EBE28C0, 0x99CFDF01,
+        0xDF90E699, 0x48E11158, 0xF49F7FEA, 0x63EE882B,
+        0x898FD47F, 0x1EFE23BE, 0xA2804D0C, 0x35F1BACD,
+        0x2E3E3E3C, 0xB94FC9FD, 0x0531A74F, 0x9240508E,
+        0x78210CDA, 0xEF50FB1B, 0x532E95A9, 0xC45F6268,
+        0x82005BF0, 0x1571AC31, 0xA90FC283, 0x3E7E3542,
+        0xD41F6916, 0x436E9ED7, 0xFF10F065, 0x686107A4,
+        0xC88FF987, 0x5FFE0E46, 0xE38060F4, 0x74F19735,
+        0x9E90CB61, 0x09E13CA0, 0xB59F5212, 0x22EEA5D3,
+        0x64B19C4B, 0xF3C06B8A, 0x4FBE0538, 0xD8CFF2F9,
+        0x32AEAEAD, 0xA5DF596C, 0x19A137DE, 0x8ED0C01F,
+        0x951F44EE, 0x026EB32F, 0xBE10DD9D, 0x29612A5C,
+        0xC3007608, 0x547181C9, 0xE80FEF7B, 0x7F7E18BA,
+        0x39212122, 0xAE50D6E3, 0x122EB851, 0x855F4F90,
+        0x6F3E13C4, 0xF84FE405, 0x44318AB7, 0xD3407D76,
+        0xE75D06AA, 0x702CF16B, 0xCC529FD9, 0x5B236818,
+        0xB142344C, 0x2633C38D, 0x9A4DAD3F, 0x0D3C5AFE,
+        0x4B636366, 0xDC1294A7, 0x606CFA15, 0xF71D0DD4,
+        0x1D7C5180, 0x8A0DA641, 0x3673C8F3, 0xA1023F32,
+        0xBACDBBC3, 0x2DBC4C02, 0x91C222B0, 0x06B3D571,
+        0xECD28925, 0x7BA37EE4, 0xC7DD1056, 0x50ACE797,
+        0x16F3DE0F, 0x818229CE, 0x3DFC477C, 0xAA8DB0BD,
+        0x40ECECE9, 0xD79D1B28, 0x6BE3759A, 0xFC92825B,
+        0x5C7C7C78, 0xCB0D8BB9, 0x7773E50B, 0xE00212CA,
+        0x0A634E9E, 0x9D12B95F, 0x216CD7ED, 0xB61D202C,
+        0xF04219B4, 0x6733EE75, 0xDB4D80C7, 0x4C3C7706,
+        0xA65D2B52, 0x312CDC93, 0x8D52B221, 0x1A2345E0,
+        0x01ECC111, 0x969D36D0, 0x2AE35862, 0xBD92AFA3,
+        0x57F3F3F7, 0xC0820436, 0x7CFC6A84, 0xEB8D9D45,
+        0xADD2A4DD, 0x3AA3531C, 0x86DD3DAE, 0x11ACCA6F,
+        0xFBCD963B, 0x6CBC61FA, 0xD0C20F48, 0x47B3F889,
+        0x94F385FF, 0x0382723E, 0xBFFC1C8C, 0x288DEB4D,
+        0xC2ECB719, 0x559D40D8, 0xE9E32E6A, 0x7E92D9AB,
+        0x38CDE033, 0xAFBC17F2, 0x13C27940, 0x84B38E81,
+        0x6ED2D2D5, 0xF9A32514, 0x45DD4BA6, 0xD2ACBC67,
+        0xC9633896, 0x5E12CF57, 0xE26CA1E5, 0x751D5624,
+        0x9F7C0A70, 0x080DFDB1, 0xB4739303, 0x230264C2,
+        0x655D5D5A, 0xF22CAA9B, 0x4E52C429, 0xD92333E8,
+        0x33426FBC, 0xA433987D, 0x184DF6CF, 0x8F3C010E,
+        0x2FD2FF2D, 0xB8A308EC, 0x04DD665E, 0x93AC919F,
+        0x79CDCDCB, 0xEEBC3A0A, 0x52C254B8, 0xC5B3A379,
+        0x83EC9AE1, 0x149D6D20, 0xA8E30392, 0x3F92F453,
+        0xD5F3A807, 0x42825FC6, 0xFEFC3174, 0x698DC6B5,
+        0x72424244, 0xE533B585, 0x594DDB37, 0xCE3C2CF6,
+        0x245D70A2, 0xB32C8763, 0x0F52E9D1, 0x98231E10,
+        0xDE7C2788, 0x490DD049, 0xF573BEFB, 0x6202493A,
+        0x8863156E, 0x1F12E2AF, 0xA36C8C1D, 0x341D7BDC,
+    },
+    {
+        0x00000000, 0x3171D430, 0x62E3A860, 0x53927C50,
+        0xC5C750C0, 0xF4B684F0, 0xA724F8A0, 0x96552C90,
+        0x8E62D771, 0xBF130341, 0xEC817F11, 0xDDF0AB21,
+        0x4BA587B1, 0x7AD45381, 0x29462FD1, 0x1837FBE1,
+        0x1929D813, 0x28580C23, 0x7BCA7073, 0x4ABBA443,
+        0xDCEE88D3, 0xED9F5CE3, 0xBE0D20B3, 0x8F7CF483,
+        0x974B0F62, 0xA63ADB52, 0xF5A8A702, 0xC4D97332,
+        0x528C5FA2, 0x63FD8B92, 0x306FF7C2, 0x011E23F2,
+        0x3253B026, 0x03226416, 0x50B01846, 0x61C1CC76,
+        0xF794E0E6, 0xC6E534D6, 0x95774886, 0xA4069CB6,
+        0xBC316757, 0x8D40B367, 0xDED2CF37, 0xEFA31B07,
+        0x79F63797, 0x4887E3A7, 0x1B159FF7, 0x2A644BC7,
+        0x2B7A6835, 0x1A0BBC05, 0x4999C055, 0x78E81465,
+        0xEEBD38F5, 0xDFCCECC5, 0x8C5E9095, 0xBD2F44A5,
+        0xA518BF44, 0x94696B74, 0xC7FB1724, 0xF68AC314,
+        0x60DFEF84, 0x51AE3BB4, 0x023C47E4, 0x334D93D4,
+        0x64A7604C, 0x55D6B47C, 0x0644C82C, 0x37351C1C,
+        0xA160308C, 0x9011E4BC, 0xC38398EC, 0xF2F24CDC,
+        0xEAC5B73D, 0xDBB4630D, 0x88261F5D, 0xB957CB6D,
+        0x2F02E7FD, 0x1E7333CD, 0x4DE14F9D, 0x7C909BAD,
+        0x7D8EB85F, 0x4CFF6C6F, 0x1F6D103F, 0x2E1CC40F,
+        0xB849E89F, 0x89383CAF, 0xDAAA40FF, 0xEBDB94CF,
+        0xF3EC6F2E, 0xC29DBB1E, 0x910FC74E, 0xA07E137E,
+        0x362B3FEE, 0x075AEBDE, 0x54C8978E, 0x65B943BE,
+        0x56F4D06A, 0x6785045A, 0x3417780A, 0x0566AC3A,
+        0x933380AA, 0xA242549A, 0xF1D028CA, 0xC0A1FCFA,
+        0xD896071B, 0xE9E7D32B, 0xBA75AF7B, 0x8B047B4B,
+        0x1D5157DB, 0x2C2083EB, 0x7FB2FFBB, 0x4EC32B8B,
+        0x4FDD0879, 0x7EACDC49, 0x2D3EA019, 0x1C4F7429,
+        0x8A1A58B9, 0xBB6B8C89, 0xE8F9F0D9, 0xD98824E9,
+        0xC1BFDF08, 0xF0CE0B38, 0xA35C7768, 0x922DA358,
+        0x04788FC8, 0x35095BF8, 0x669B27A8, 0x57EAF398,
+        0xC94EC098, 0xF83F14A8, 0xABAD68F8, 0x9ADCBCC8,
+        0x0C899058, 0x3DF84468, 0x6E6A3838, 0x5F1BEC08,
+        0x472C17E9, 0x765DC3D9, 0x25CFBF89, 0x14BE6BB9,
+        0x82EB4729, 0xB39A9319, 0xE008EF49, 0xD1793B79,
+        0xD067188B, 0xE116CCBB, 0xB284B0EB, 0x83F564DB,
+        0x15A0484B, 0x24D19C7B, 0x7743E02B, 0x4632341B,
+        0x5E05CFFA, 0x6F741BCA, 0x3CE6679A, 0x0D97B3AA,
+        0x9BC29F3A, 0xAAB34B0A, 0xF921375A, 0xC850E36A,
+        0xFB1D70BE, 0xCA6CA48E, 0x99FED8DE, 0xA88F0CEE,
+        0x3EDA207E, 0x0FABF44E, 0x5C39881E, 0x6D485C2E,
+        0x757FA7CF, 0x440E73FF, 0x179C0FAF, 0x26EDDB9F,
+        0xB0B8F70F, 0x81C9233F, 0xD25B5F6F, 0xE32A8B5F,
+        0xE234A8AD, 0xD3457C9D, 0x80D700CD, 0xB1A6D4FD,
+        0x27F3F86D, 0x16822C5D, 0x4510500D, 0x7461843D,
+        0x6C567FDC, 0x5D27ABEC, 0x0EB5D7BC, 0x3FC4038C,
+        0xA9912F1C, 0x98E0FB2C, 0xCB72877C, 0xFA03534C,
+        0xADE9A0D4, 0x9C9874E4, 0xCF0A08B4, 0xFE7BDC84,
+        0x682EF014, 0x595F2424, 0x0ACD5874, 0x3BBC8C44,
+        0x238B77A5, 0x12FAA395, 0x4168DFC5, 0x70190BF5,
+        0xE64C2765, 0xD73DF355, 0x84AF8F05, 0xB5DE5B35,
+        0xB4C078C7, 0x85B1ACF7, 0xD623D0A7, 0xE7520497,
+        0x71072807, 0x4076FC37, 0x13E48067, 0x22955457,
+        0x3AA2AFB6, 0x0BD37B86, 0x584107D6, 0x6930D3E6,
+        0xFF65FF76, 0xCE142B46, 0x9D865716, 0xACF78326,
+        0x9FBA10F2, 0xAECBC4C2, 0xFD59B892, 0xCC286CA2,
+        0x5A7D4032, 0x6B0C9402, 0x389EE852, 0x09EF3C62,
+        0x11D8C783, 0x20A913B3, 0x733B6FE3, 0x424ABBD3,
+        0xD41F9743, 0xE56E4373, 0xB6FC3F23, 0x878DEB13,
+        0x8693C8E1, 0xB7E21CD1, 0xE4706081, 0xD501B4B1,
+        0x43549821, 0x72254C11, 0x21B73041, 0x10C6E471,
+        0x08F11F90, 0x3980CBA0, 0x6A12B7F0, 0x5B6363C0,
+        0xCD364F50, 0xFC479B60, 0xAFD5E730, 0x9EA43300,
+    },
+    {
+        0x00000000, 0x30D23865, 0x61A470CA, 0x517648AF,
+        0xC348E194, 0xF39AD9F1, 0xA2EC915E, 0x923EA93B,
+        0x837DB5D9, 0xB3AF8DBC, 0xE2D9C513, 0xD20BFD76,
+        0x4035544D, 0x70E76C28, 0x21912487, 0x11431CE2,
+        0x03171D43, 0x33C52526, 0x62B36D89, 0x526155EC,
+        0xC05FFCD7, 0xF08DC4B2, 0xA1FB8C1D, 0x9129B478,
+        0x806AA89A, 0xB0B890FF, 0xE1CED850, 0xD11CE035,
+        0x4322490E, 0x73F0716B, 0x228639C4, 0x125401A1,
+        0x062E3A86, 0x36FC02E3, 0x678A4A4C, 0x57587229,
+        0xC566DB12, 0xF5B4E377, 0xA4C2ABD8, 0x941093BD,
+        0x85538F5F, 0xB581B73A, 0xE4F7FF95, 0xD425C7F0,
+        0x461B6ECB, 0x76C956AE, 0x27BF1E01, 0x176D2664,
+        0x053927C5, 0x35EB1FA0, 0x649D570F, 0x544F6F6A,
+        0xC671C651, 0xF6A3FE34, 0xA7D5B69B, 0x97078EFE,
+        0x8644921C, 0xB696AA79, 0xE7E0E2D6, 0xD732DAB3,
+        0x450C7388, 0x75DE4BED, 0x24A80342, 0x147A3B27,
+        0x0C5C750C, 0x3C8E4D69, 0x6DF805C6, 0x5D2A3DA3,
+        0xCF149498, 0xFFC6ACFD, 0xAEB0E452, 0x9E62DC37,
+        0x8F21C0D5, 0xBFF3F8B0, 0xEE85B01F, 0xDE57887A,
+        0x4C692141, 0x7CBB1924, 0x2DCD518B, 0x1D1F69EE,
+        0x0F4B684F, 0x3F99502A, 0x6EEF1885, 0x5E3D20E0,
+        0xCC0389DB, 0xFCD1B1BE, 0xADA7F911, 0x9D75C174,
+        0x8C36DD96, 0xBCE4E5F3, 0xED92AD5C, 0xDD409539,
+        0x4F7E3C02, 0x7FAC0467, 0x2EDA4CC8, 0x1E0874AD,
+        0x0A724F8A, 0x3AA077EF, 0x6BD63F40, 0x5B040725,
+        0xC93AAE1E, 0xF9E8967B, 0xA89EDED4, 0x984CE6B1,
+        0x890FFA53, 0xB9DDC236, 0xE8AB8A99, 0xD879B2FC,
+        0x4A471BC7, 0x7A9523A2, 0x2BE36B0D, 0x1B315368,
+        0x096552C9, 0x39B76AAC, 0x68C12203, 0x58131A66,
+        0xCA2DB35D, 0xFAFF8B38, 0xAB89C397, 0x9B5BFBF2,
+        0x8A18E710, 0xBACADF75, 0xEBBC97DA, 0xDB6EAFBF,
+        0x49500684, 0x79823EE1, 0x28F4764E, 0x18264E2B,
+        0x18B8EA18, 0x286AD27D, 0x791C9AD2, 0x49CEA2B7,
+        0xDBF00B8C, 0xEB2233E9, 0xBA547B46, 0x8A864323,
+        0x9BC55FC1, 0xAB1767A4, 0xFA612F0B, 0xCAB3176E,
+        0x588DBE55, 0x685F8630, 0x3929CE9F, 0x09FBF6FA,
+        0x1BAFF75B, 0x2B7DCF3E, 0x7A0B8791, 0x4AD9BFF4,
+        0xD8E716CF, 0xE8352EAA, 0xB9436605, 0x89915E60,
+        0x98D24282, 0xA8007AE7, 0xF9763248, 0xC9A40A2D,
+        0x5B9AA316, 0x6B489B73, 0x3A3ED3DC, 0x0AECEBB9,
+        0x1E96D09E, 0x2E44E8FB, 0x7F32A054, 0x4FE09831,
+        0xDDDE310A, 0xED0C096F, 0xBC7A41C0, 0x8CA879A5,
+        0x9DEB6547, 0xAD395D22, 0xFC4F158D, 0xCC9D2DE8,
+        0x5EA384D3, 0x6E71BCB6, 0x3F07F419, 0x0FD5CC7C,
+        0x1D81CDDD, 0x2D53F5B8, 0x7C25BD17, 0x4CF78572,
+        0xDEC92C49, 0xEE1B142C, 0xBF6D5C83, 0x8FBF64E6,
+        0x9EFC7804, 0xAE2E4061, 0xFF5808CE, 0xCF8A30AB,
+        0x5DB49990, 0x6D66A1F5, 0x3C10E95A, 0x0CC2D13F,
+        0x14E49F14, 0x2436A771, 0x7540EFDE, 0x4592D7BB,
+        0xD7AC7E80, 0xE77E46E5, 0xB6080E4A, 0x86DA362F,
+        0x97992ACD, 0xA74B12A8, 0xF63D5A07, 0xC6EF6262,
+        0x54D1CB59, 0x6403F33C, 0x3575BB93, 0x05A783F6,
+        0x17F38257, 0x2721BA32, 0x7657F29D, 0x4685CAF8,
+        0xD4BB63C3, 0xE4695BA6, 0xB51F1309, 0x85CD2B6C,
+        0x948E378E, 0xA45C0FEB, 0xF52A4744, 0xC5F87F21,
+        0x57C6D61A, 0x6714EE7F, 0x3662A6D0, 0x06B09EB5,
+        0x12CAA592, 0x22189DF7, 0x736ED558, 0x43BCED3D,
+        0xD1824406, 0xE1507C63, 0xB02634CC, 0x80F40CA9,
+        0x91B7104B, 0xA165282E, 0xF0136081, 0xC0C158E4,
+        0x52FFF1DF, 0x622DC9BA, 0x335B8115, 0x0389B970,
+        0x11DDB8D1, 0x210F80B4, 0x7079C81B, 0x40ABF07E,
+        0xD2955945, 0xE2476120, 0xB331298F, 0x83E311EA,
+        0x92A00D08, 0xA272356D, 0xF3047DC2, 0xC3D645A7,
+        0x51E8EC9C, 0x613AD4F9, 0x304C9C56, 0x009EA433,
+    },
+    {
+        0x00000000, 0x54075546, 0xA80EAA8C, 0xFC09FFCA,
+        0x55F123E9, 0x01F676AF, 0xFDFF8965, 0xA9F8DC23,
+        0xABE247D2, 0xFFE51294, 0x03ECED5E, 0x57EBB818,
+        0xFE13643B, 0xAA14317D, 0x561DCEB7, 0x021A9BF1,
+        0x5228F955, 0x062FAC13, 0xFA2653D9, 0xAE21069F,
+        0x07D9DABC, 0x53DE8FFA, 0xAFD77030, 0xFBD02576,
+        0xF9CABE87, 0xADCDEBC1, 0x51C4140B, 0x05C3414D,
+        0xAC3B9D6E, 0xF83CC828, 0x043537E2, 0x503262A4,
+        0xA451F2AA, 0xF056A7EC, 0x0C5F5826, 0x58580D60,
+        0xF1A0D143, 0xA5A78405, 0x59AE7BCF, 0x0DA92E89,
+        0x0FB3B578, 0x5BB4E03E, 0xA7BD1FF4, 0xF3BA4AB2,
+        0x5A429691, 0x0E45C3D7, 0xF24C3C1D, 0xA64B695B,
+        0xF6790BFF, 0xA27E5EB9, 0x5E77A173, 0x0A70F435,
+        0xA3882816, 0xF78F7D50, 0x0B86829A, 0x5F81D7DC,
+        0x5D9B4C2D, 0x099C196B, 0xF595E6A1, 0xA192B3E7,
+        0x086A6FC4, 0x5C6D3A82, 0xA064C548, 0xF463900E,
+        0x4D4F93A5, 0x1948C6E3, 0xE5413929, 0xB1466C6F,
+        0x18BEB04C, 0x4CB9E50A, 0xB0B01AC0, 0xE4B74F86,
+        0xE6ADD477, 0xB2AA8131, 0x4EA37EFB, 0x1AA42BBD,
+        0xB35CF79E, 0xE75BA2D8, 0x1B525D12, 0x4F550854,
+        0x1F676AF0, 0x4B603FB6, 0xB769C07C, 0xE36E953A,
+        0x4A964919, 0x1E911C5F, 0xE298E395, 0xB69FB6D3,
+        0xB4852D22, 0xE0827864, 0x1C8B87AE, 0x488CD2E8,
+        0xE1740ECB, 0xB5735B8D, 0x497AA447, 0x1D7DF101,
+        0xE91E610F, 0xBD193449, 0x4110CB83, 0x15179EC5,
+        0xBCEF42E6, 0xE8E817A0, 0x14E1E86A, 0x40E6BD2C,
+        0x42FC26DD, 0x16FB739B, 0xEAF28C51, 0xBEF5D917,
+        0x170D0534, 0x430A5072, 0xBF03AFB8, 0xEB04FAFE,
+        0xBB36985A, 0xEF31CD1C, 0x133832D6, 0x473F6790,
+        0xEEC7BBB3, 0xBAC0EEF5, 0x46C9113F, 0x12CE4479,
+        0x10D4DF88, 0x44D38ACE, 0xB8DA7504, 0xECDD2042,
+        0x4525FC61, 0x1122A927, 0xED2B56ED, 0xB92C03AB,
+        0x9A9F274A, 0xCE98720C, 0x32918DC6, 0x6696D880,
+        0xCF6E04A3, 0x9B6951E5, 0x6760AE2F, 0x3367FB69,
+        0x317D6098, 0x657A35DE, 0x9973CA14, 0xCD749F52,
+        0x648C4371, 0x308B1637, 0xCC82E9FD, 0x9885BCBB,
+        0xC8B7DE1F, 0x9CB08B59, 0x60B97493, 0x34BE21D5,
+        0x9D46FDF6, 0xC941A8B0, 0x3548577A, 0x614F023C,
+        0x635599CD, 0x3752CC8B, 0xCB5B3341, 0x9F5C6607,
+        0x36A4BA24, 0x62A3EF62, 0x9EAA10A8, 0xCAAD45EE,
+        0x3ECED5E0, 0x6AC980A6, 0x96C07F6C, 0xC2C72A2A,
+        0x6B3FF609, 0x3F38A34F, 0xC3315C85, 0x973609C3,
+        0x952C9232, 0xC12BC774, 0x3D2238BE, 0x69256DF8,
+        0xC0DDB1DB, 0x94DAE49D, 0x68D31B57, 0x3CD44E11,
+        0x6CE62CB5, 0x38E179F3, 0xC4E88639, 0x90EFD37F,
+        0x39170F5C, 0x6D105A1A, 0x9119A5D0, 0xC51EF096,
+        0xC7046B67, 0x93033E21, 0x6F0AC1EB, 0x3B0D94AD,
+        0x92F5488E, 0xC6F21DC8, 0x3AFBE202, 0x6EFCB744,
+        0xD7D0B4EF, 0x83D7E1A9, 0x7FDE1E63, 0x2BD94B25,
+        0x82219706, 0xD626C240, 0x2A2F3D8A, 0x7E2868CC,
+        0x7C32F33D, 0x2835A67B, 0xD43C59B1, 0x803B0CF7,
+        0x29C3D0D4, 0x7DC48592, 0x81CD7A58, 0xD5CA2F1E,
+        0x85F84DBA, 0xD1FF18FC, 0x2DF6E736, 0x79F1B270,
+        0xD0096E53, 0x840E3B15, 0x7807C4DF, 0x2C009199,
+        0x2E1A0A68, 0x7A1D5F2E, 0x8614A0E4, 0xD213F5A2,
+        0x7BEB2981, 0x2FEC7CC7, 0xD3E5830D, 0x87E2D64B,
+        0x73814645, 0x27861303, 0xDB8FECC9, 0x8F88B98F,
+        0x267065AC, 0x727730EA, 0x8E7ECF20, 0xDA799A66,
+        0xD8630197, 0x8C6454D1, 0x706DAB1B, 0x246AFE5D,
+        0x8D92227E, 0xD9957738, 0x259C88F2, 0x719BDDB4,
+        0x21A9BF10, 0x75AEEA56, 0x89A7159C, 0xDDA040DA,
+        0x74589CF9, 0x205FC9BF, 0xDC563675, 0x88516333,
+        0x8A4BF8C2, 0xDE4CAD84, 0x2245524E, 0x76420708,
+        0xDFBADB2B, 0x8BBD8E6D, 0x77B471A7, 0x23B324E1,
+    },
+    {
+        0x00000000, 0x678EFD01, 0xCF1DFA02, 0xA8930703,
+        0x9BD782F5, 0xFC597FF4, 0x54CA78F7, 0x334485F6,
+        0x3243731B, 0x55CD8E1A, 0xFD5E8919, 0x9AD07418,
+        0xA994F1EE, 0xCE1A0CEF, 0x66890BEC, 0x0107F6ED,
+        0x6486E636, 0x03081B37, 0xAB9B1C34, 0xCC15E135,
+        0xFF5164C3, 0x98DF99C2, 0x304C9EC1, 0x57C263C0,
+        0x56C5952D, 0x314B682C, 0x99D86F2F, 0xFE56922E,
+        0xCD1217D8, 0xAA9CEAD9, 0x020FEDDA, 0x658110DB,
+        0xC90DCC6C, 0xAE83316D, 0x0610366E, 0x619ECB6F,
+        0x52DA4E99, 0x3554B398, 0x9DC7B49B, 0xFA49499A,
+        0xFB4EBF77, 0x9CC04276, 0x34534575, 0x53DDB874,
+        0x60993D82, 0x0717C083, 0xAF84C780, 0xC80A3A81,
+        0xAD8B2A5A, 0xCA05D75B, 0x6296D058, 0x05182D59,
+        0x365CA8AF, 0x51D255AE, 0xF94152AD, 0x9ECFAFAC,
+        0x9FC85941, 0xF846A440, 0x50D5A343, 0x375B5E42,
+        0x041FDBB4, 0x639126B5, 0xCB0221B6, 0xAC8CDCB7,
+        0x97F7EE29, 0xF0791328, 0x58EA142B, 0x3F64E92A,
+        0x0C206CDC, 0x6BAE91DD, 0xC33D96DE, 0xA4B36BDF,
+        0xA5B49D32, 0xC23A6033, 0x6AA96730, 0x0D279A31,
+        0x3E631FC7, 0x59EDE2C6, 0xF17EE5C5, 0x96F018C4,
+        0xF371081F, 0x94FFF51E, 0x3C6CF21D, 0x5BE20F1C,
+        0x68A68AEA, 0x0F2877EB, 0xA7BB70E8, 0xC0358DE9,
+        0xC1327B04, 0xA6BC8605, 0x0E2F8106, 0x69A17C07,
+        0x5AE5F9F1, 0x3D6B04F0, 0x95F803F3, 0xF276FEF2,
+        0x5EFA2245, 0x3974DF44, 0x91E7D847, 0xF6692546,
+        0xC52DA0B0, 0xA2A35DB1, 0x0A305AB2, 0x6DBEA7B3,
+        0x6CB9515E, 0x0B37AC5F, 0xA3A4AB5C, 0xC42A565D,
+        0xF76ED3AB, 0x90E02EAA, 0x387329A9, 0x5FFDD4A8,
+        0x3A7CC473, 0x5DF23972, 0xF5613E71, 0x92EFC370,
+        0xA1AB4686, 0xC625BB87, 0x6EB6BC84, 0x09384185,
+        0x083FB768, 0x6FB14A69, 0xC7224D6A, 0xA0ACB06B,
+        0x93E8359D, 0xF466C89C, 0x5CF5CF9F, 0x3B7B329E,
+        0x2A03AAA3, 0x4D8D57A2, 0xE51E50A1, 0x8290ADA0,
+        0xB1D42856, 0xD65AD557, 0x7EC9D254, 0x19472F55,
+        0x1840D9B8, 0x7FCE24B9, 0xD75D23BA, 0xB0D3DEBB,
+        0x83975B4D, 0xE419A64C, 0x4C8AA14F, 0x2B045C4E,
+        0x4E854C95, 0x290BB194, 0x8198B697, 0xE6164B96,
+        0xD552CE60, 0xB2DC3361, 0x1A4F3462, 0x7DC1C963,
+        0x7CC63F8E, 0x1B48C28F, 0xB3DBC58C, 0xD455388D,
+        0xE711BD7B, 0x809F407A, 0x280C4779, 0x4F82BA78,
+        0xE30E66CF, 0x84809BCE, 0x2C139CCD, 0x4B9D61CC,
+        0x78D9E43A, 0x1F57193B, 0xB7C41E38, 0xD04AE339,
+        0xD14D15D4, 0xB6C3E8D5, 0x1E50EFD6, 0x79DE12D7,
+        0x4A9A9721, 0x2D146A20, 0x85876D23, 0xE2099022,
+        0x878880F9, 0xE0067DF8, 0x48957AFB, 0x2F1B87FA,
+        0x1C5F020C, 0x7BD1FF0D, 0xD342F80E, 0xB4CC050F,
+        0xB5CBF3E2, 0xD2450EE3, 0x7AD609E0, 0x1D58F4E1,
+        0x2E1C7117, 0x49928C16, 0xE1018B15, 0x868F7614,
+        0xBDF4448A, 0xDA7AB98B, 0x72E9BE88, 0x15674389,
+        0x2623C67F, 0x41AD3B7E, 0xE93E3C7D, 0x8EB0C17C,
+        0x8FB73791, 0xE839CA90, 0x40AACD93, 0x27243092,
+        0x1460B564, 0x73EE4865, 0xDB7D4F66, 0xBCF3B267,
+        0xD972A2BC, 0xBEFC5FBD, 0x166F58BE, 0x71E1A5BF,
+        0x42A52049, 0x252BDD48, 0x8DB8DA4B, 0xEA36274A,
+        0xEB31D1A7, 0x8CBF2CA6, 0x242C2BA5, 0x43A2D6A4,
+        0x70E65352, 0x1768AE53, 0xBFFBA950, 0xD8755451,
+        0x74F988E6, 0x137775E7, 0xBBE472E4, 0xDC6A8FE5,
+        0xEF2E0A13, 0x88A0F712, 0x2033F011, 0x47BD0D10,
+        0x46BAFBFD, 0x213406FC, 0x89A701FF, 0xEE29FCFE,
+        0xDD6D7908, 0xBAE38409, 0x1270830A, 0x75FE7E0B,
+        0x107F6ED0, 0x77F193D1, 0xDF6294D2, 0xB8EC69D3,
+        0x8BA8EC25, 0xEC261124, 0x44B51627, 0x233BEB26,
+        0x223C1DCB, 0x45B2E0CA, 0xED21E7C9, 0x8AAF1AC8,
+        0xB9EB9F3E, 0xDE65623F, 0x76F6653C, 0x1178983D,
+    },
+    {
+        0x00000000, 0xF20C0DFE, 0xE1F46D0D, 0x13F860F3,
+        0xC604ACEB, 0x3408A115, 0x27F0C1E6, 0xD5FCCC18,
+        0x89E52F27, 0x7BE922D9, 0x6811422A, 0x9A1D4FD4,
+        0x4FE183CC, 0xBDED8E32, 0xAE15EEC1, 0x5C19E33F,
+        0x162628BF, 0xE42A2541, 0xF7D245B2, 0x05DE484C,
+        0xD0228454, 0x222E89AA, 0x31D6E959, 0xC3DAE4A7,
+        0x9FC30798, 0x6DCF0A66, 0x7E376A95, 0x8C3B676B,
+        0x59C7AB73, 0xABCBA68D, 0xB833C67E, 0x4A3FCB80,
+        0x2C4C517E, 0xDE405C80, 0xCDB83C73, 0x3FB4318D,
+        0xEA48FD95, 0x1844F06B, 0x0BBC9098, 0xF9B09D66,
+        0xA5A97E59, 0x57A573A7, 0x445D1354, 0xB6511EAA,
+        0x63ADD2B2, 0x91A1DF4C, 0x8259BFBF, 0x7055B241,
+        0x3A6A79C1, 0xC866743F, 0xDB9E14CC, 0x29921932,
+        0xFC6ED52A, 0x0E62D8D4, 0x1D9AB827, 0xEF96B5D9,
+        0xB38F56E6, 0x41835B18, 0x527B3BEB, 0xA0773615,
+        0x758BFA0D, 0x8787F7F3, 0x947F9700, 0x66739AFE,
+        0x5898A2FC, 0xAA94AF02, 0xB96CCFF1, 0x4B60C20F,
+        0x9E9C0E17, 0x6C9003E9, 0x7F68631A, 0x8D646EE4,
+        0xD17D8DDB, 0x23718025, 0x3089E0D6, 0xC285ED28,
+        0x17792130, 0xE5752CCE, 0xF68D4C3D, 0x048141C3,
+        0x4EBE8A43, 0xBCB287BD, 0xAF4AE74E, 0x5D46EAB0,
+        0x88BA26A8, 0x7AB62B56, 0x694E4BA5, 0x9B42465B,
+        0xC75BA564, 0x3557A89A, 0x26AFC869, 0xD4A3C597,
+        0x015F098F, 0xF3530471, 0xE0AB6482, 0x12A7697C,
+        0x74D4F382, 0x86D8FE7C, 0x95209E8F, 0x672C9371,
+        0xB2D05F69, 0x40DC5297, 0x53243264, 0xA1283F9A,
+        0xFD31DCA5, 0x0F3DD15B, 0x1CC5B1A8, 0xEEC9BC56,
+        0x3B35704E, 0xC9397DB0, 0xDAC11D43, 0x28CD10BD,
+        0x62F2DB3D, 0x90FED6C3, 0x8306B630, 0x710ABBCE,
+        0xA4F677D6, 0x56FA7A28, 0x45021ADB, 0xB70E1725,
+        0xEB17F41A, 0x191BF9E4, 0x0AE39917, 0xF8EF94E9,
+        0x2D1358F1, 0xDF1F550F, 0xCCE735FC, 0x3EEB3802,
+        0xB13145F8, 0x433D4806, 0x50C528F5, 0xA2C9250B,
+        0x7735E913, 0x8539E4ED, 0x96C1841E, 0x64CD89E0,
+        0x38D46ADF, 0xCAD86721, 0xD92007D2, 0x2B2C0A2C,
+        0xFED0C634, 0x0CDCCBCA, 0x1F24AB39, 0xED28A6C7,
+        0xA7176D47, 0x551B60B9, 0x46E3004A, 0xB4EF0DB4,
+        0x6113C1AC, 0x931FCC52, 0x80E7ACA1, 0x72EBA15F,
+        0x2EF24260, 0xDCFE4F9E, 0xCF062F6D, 0x3D0A2293,
+        0xE8F6EE8B, 0x1AFAE375, 0x09028386, 0xFB0E8E78,
+        0x9D7D1486, 0x6F711978, 0x7C89798B, 0x8E857475,
+        0x5B79B86D, 0xA975B593, 0xBA8DD560, 0x4881D89E,
+        0x14983BA1, 0xE694365F, 0xF56C56AC, 0x07605B52,
+        0xD29C974A, 0x20909AB4, 0x3368FA47, 0xC164F7B9,
+        0x8B5B3C39, 0x795731C7, 0x6AAF5134, 0x98A35CCA,
+        0x4D5F90D2, 0xBF539D2C, 0xACABFDDF, 0x5EA7F021,
+        0x02BE131E, 0xF0B21EE0, 0xE34A7E13, 0x114673ED,
+        0xC4BABFF5, 0x36B6B20B, 0x254ED2F8, 0xD742DF06,
+        0xE9A9E704, 0x1BA5EAFA, 0x085D8A09, 0xFA5187F7,
+        0x2FAD4BEF, 0xDDA14611, 0xCE5926E2, 0x3C552B1C,
+        0x604CC823, 0x9240C5DD, 0x81B8A52E, 0x73B4A8D0,
+        0xA64864C8, 0x54446936, 0x47BC09C5, 0xB5B0043B,
+        0xFF8FCFBB, 0x0D83C245, 0x1E7BA2B6, 0xEC77AF48,
+        0x398B6350, 0xCB876EAE, 0xD87F0E5D, 0x2A7303A3,
+        0x766AE09C, 0x8466ED62, 0x979E8D91, 0x6592806F,
+        0xB06E4C77, 0x42624189, 0x519A217A, 0xA3962C84,
+        0xC5E5B67A, 0x37E9BB84, 0x2411DB77, 0xD61DD689,
+        0x03E11A91, 0xF1ED176F, 0xE215779C, 0x10197A62,
+        0x4C00995D, 0xBE0C94A3, 0xADF4F450, 0x5FF8F9AE,
+        0x8A0435B6, 0x78083848, 0x6BF058BB, 0x99FC5545,
+        0xD3C39EC5, 0x21CF933B, 0x3237F3C8, 0xC03BFE36,
+        0x15C7322E, 0xE7CB3FD0, 0xF4335F23, 0x063F52DD,
+        0x5A26B1E2, 0xA82ABC1C, 0xBBD2DCEF, 0x49DED111,
+        0x9C221D09, 0x6E2E10F7, 0x7DD67004, 0x8FDA7DFA,
+    },
+};
+
+// CRC-32/ISCSI powers x^(2^k) mod P (reflected)
+const u32 CRC32C_X2N_TABLE[64] =
+{
+    0x40000000, 0x20000000, 0x08000000, 0x00800000,
+    0x00008000, 0x82F63B78, 0x6EA2D55C, 0x18B8EA18,
+    0x510AC59A, 0xB82BE955, 0xB8FDB1E7, 0x88E56F72,
+    0x74C360A4, 0xE4172B16, 0x0D65762A, 0x35D73A62,
+    0x28461564, 0xBF455269, 0xE2EA32DC, 0xFE7740E6,
+    0xF946610B, 0x3C204F8F, 0x538586E3, 0x59726915,
+    0x734D5309, 0xBC1AC763, 0x7D0722CC, 0xD289CABE,
+    0xE94CA9BC, 0x05B74F3F, 0xA51E1F42, 0x40000000,
+    0x20000000, 0x08000000, 0x00800000, 0x00008000,
+    0x82F63B78, 0x6EA2D55C, 0x18B8EA18, 0x510AC59A,
+    0xB82BE955, 0xB8FDB1E7, 0x88E56F72, 0x74C360A4,
+    0xE4172B16, 0x0D65762A, 0x35D73A62, 0x28461564,
+    0xBF455269, 0xE2EA32DC, 0xFE7740E6, 0xF946610B,
+    0x3C204F8F, 0x538586E3, 0x59726915, 0x734D5309,
+    0xBC1AC763, 0x7D0722CC, 0xD289CABE, 0xE94CA9BC,
+    0x05B74F3F, 0xA51E1F42, 0x40000000, 0x20000000,
+};
+
+// CRC-32/ISCSI folding constants
+const crc_clmul_consts CRC32C_CLMUL =
+{
+    .fold128 = { U64_C(0x3743F7BD00000000), U64_C(0x3171D43000000000) },
+    .fold256 = { U64_C(0x33CCBBBC00000000), U64_C(0xA2158B3400000000) },
+    .fold512 = { U64_C(0x1C19243B00000000), U64_C(0x75BBA45B00000000) },
+    .fold1024 = { U64_C(0x6577B24500000000), U64_C(0x7417153F00000000) },
+    .fold2048 = { U64_C(0xE9A5D8BE00000000), U64_C(0x1426A81500000000) },
+    .reduce = { U64_C(0x493C7D2700000000), U64_C(0x00000000DD45AAB8) },
+    .barrett = { U64_C(0x6F5389F880000000), U64_C(0x82F63B7880000000) },
+};
+
+// CRC-64/ECMA-182 slicing tables (generic engine)
+const u64 CRC64_ECMA_182_SLICE64_TABLE[8][256] =
+{
+    {
+        U64_C(0x0000000000000000), U64_C(0x42F0E1EBA9EA3693), U64_C(0x85E1C3D753D46D26), U64_C(0xC711223CFA3E5BB5),
+        U64_C(0x493366450E42ECDF), U64_C(0x0BC387AEA7A8DA4C), U64_C(0xCCD2A5925D9681F9), U64_C(0x8E224479F47CB76A),
+        U64_C(0x9266CC8A1C85D9BE), U64_C(0xD0962D61B56FEF2D), U64_C(0x17870F5D4F51B498), U64_C(0x5577EEB6E6BB820B),
+        U64_C(0xDB55AACF12C73561), U64_C(0x99A54B24BB2D03F2), U64_C(0x5EB4691841135847), U64_C(0x1C4488F3E8F96ED4),
+        U64_C(0x663D78FF90E185EF), U64_C(0x24CD9914390BB37C), U64_C(0xE3DCBB28C335E8C9), U64_C(0xA12C5AC36ADFDE5A),
+        U64_C(0x2F0E1EBA9EA36930), U64_C(0x6DFEFF5137495FA3), U64_C(0xAAEFDD6DCD770416), U64_C(0xE81F3C86649D3285),
+        U64_C(0xF45BB4758C645C51), U64_C(0xB6AB559E258E6AC2), U64_C(0x71BA77A2DFB03177), U64_C(0x334A9649765A07E4),
+        U64_C(0xBD68D2308226B08E), U64_C(0xFF9833DB2BCC861D), U64_C(0x388911E7D1F2DDA8), U64_C(0x7A79F00C7818EB3B),
+        U64_C(0xCC7AF1FF21C30BDE), U64_C(0x8E8A101488293D4D), U64_C(0x499B3228721766F8), U64_C(0x0B6BD3C3DBFD506B),
+        U64_C(0x854997BA2F81E701), U64_C(0xC7B97651866BD192), U64_C(0x00A8546D7C558A27), U64_C(0x4258B586D5BFBCB4),
+        U64_C(0x5E1C3D753D46D260), U64_C(0x1CECDC9E94ACE4F3), U64_C(0xDBFDFEA26E92BF46), U64_C(0x990D1F49C77889D5),
+        U64_C(0x172F5B3033043EBF), U64_C(0x55DFBADB9AEE082C), U64_C(0x92CE98E760D05399), U64_C(0xD03E790CC93A650A),
+        U64_C(0xAA478900B1228E31), U64_C(0xE8B768EB18C8B8A2), U64_C(0x2FA64AD7E2F6E317), U64_C(0x6D56AB3C4B1CD584),
+        U64_C(0xE374EF45BF6062EE), U64_C(0xA1840EAE168A547D), U64_C(0x66952C92ECB40FC8), U64_C(0x2465CD79455E395B),
+        U64_C(0x3821458AADA7578F), U64_C(0x7AD1A461044D611C), U64_C(0xBDC0865DFE733AA9), U64_C(0xFF3067B657990C3A),
+        U64_C(0x711223CFA3E5BB50), U64_C(0x33E2C2240A0F8DC3), U64_C(0xF4F3E018F031D676), U64_C(0xB60301F359DBE0E5),
+        U64_C(0xDA050215EA6C212F), U64_C(0x98F5E3FE438617BC), U64_C(0x5FE4C1C2B9B84C09), U64_C(0x1D14202910527A9A),
+        U64_C(0x93366450E42ECDF0), U64_C(0xD1C685BB4DC4FB63), U64_C(0x16D7A787B7FAA0D6), U64_C(0x5427466C1E109645),
+        U64_C(0x4863CE9FF6E9F891), U64_C(0x0A932F745F03CE02), U64_C(0xCD820D48A53D95B7), U64_C(0x8F72ECA30CD7A324),
+        U64_C(0x0150A8DAF8AB144E), U64_C(0x43A04931514122DD), U64_C(0x84B16B0DAB7F7968), U64_C(0xC6418AE602954FFB),
+        U64_C(0xBC387AEA7A8DA4C0), U64_C(0xFEC89B01D3679253), U64_C(0x39D9B93D2959C9E6), U64_C(0x7B2958D680B3FF75),
+        U64_C(0xF50B1CAF74CF481F), U64_C(0xB7FBFD44DD257E8C), U64_C(0x70EADF78271B2539), U64_C(0x321A3E938EF113AA),
+        U64_C(0x2E5EB66066087D7E), U64_C(0x6CAE578BCFE24BED), U64_C(0xABBF75B735DC1058), U64_C(0xE94F945C9C3626CB),
+        U64_C(0x676DD025684A91A1), U64_C(0x259D31CEC1A0A732), U64_C(0xE28C13F23B9EFC87), U64_C(0xA07CF2199274CA14),
+        U64_C(0x167FF3EACBAF2AF1), U64_C(0x548F120162451C62), U64_C(0x939E303D987B47D7), U64_C(0xD16ED1D631917144),
+        U64_C(0x5F4C95AFC5EDC62E), U64_C(0x1DBC74446C07F0BD), U64_C(0xDAAD56789639AB08), U64_C(0x985DB7933FD39D9B),
+        U64_C(0x84193F60D72AF34F), U64_C(0xC6E9DE8B7EC0C5DC), U64_C(0x01F8FCB784FE9E69), U64_C(0x43081D5C2D14A8FA),
+        U64_C(0xCD2A5925D9681F90), U64_C(0x8FDAB8CE70822903), U64_C(0x48CB9AF28ABC72B6), U64_C(0x0A3B7B1923564425),
+        U64_C(0x70428B155B4EAF1E), U64_C(0x32B26AFEF2A4998D), U64_C(0xF5A348C2089AC238), U64_C(0xB753A929A170F4AB),
+        U64_C(0x3971ED50550C43C1), U64_C(0x7B810CBBFCE67552), U64_C(0xBC902E8706D82EE7), U64_C(0xFE60CF6CAF321874),
+        U64_C(0xE224479F47CB76A0), U64_C(0xA0D4A674EE214033), U64_C(0x67C58448141F1B86), U64_C(0x253565A3BDF52D15),
+        U64_C(0xAB1721DA49899A7F), U64_C(0xE9E7C031E063ACEC), U64_C(0x2EF6E20D1A5DF759), U64_C(0x6C0603E6B3B7C1CA),
+        U64_C(0xF6FAE5C07D3274CD), U64_C(0xB40A042BD4D8425E), U64_C(0x731B26172EE619EB), U64_C(0x31EBC7FC870C2F78),
+        U64_C(0xBFC9838573709812), U64_C(0xFD39626EDA9AAE81), U64_C(0x3A28405220A4F534), U64_C(0x78D8A1B9894EC3A7),
+        U64_C(0x649C294A61B7AD73), U64_C(0x266CC8A1C85D9BE0), U64_C(0xE17DEA9D3263C055), U64_C(0xA38D0B769B89F6C6),
+        U64_C(0x2DAF4F0F6FF541AC), U64_C(0x6F5FAEE4C61F773F), U64_C(0xA84E8CD83C212C8A), U64_C(0xEABE6D3395CB1A19),
+        U64_C(0x90C79D3FEDD3F122), U64_C(0xD2377CD44439C7B1), U64_C(0x15265EE8BE079C04), U64_C(0x57D6BF0317EDAA97),
+        U64_C(0xD9F4FB7AE3911DFD), U64_C(0x9B041A914A7B2B6E), U64_C(0x5C1538ADB04570DB), U64_C(0x1EE5D94619AF4648),
+        U64_C(0x02A151B5F156289C), U64_C(0x4051B05E58BC1E0F), U64_C(0x87409262A28245BA), U64_C(0xC5B073890B687329),
+        U64_C(0x4B9237F0FF14C443), U64_C(0x0962D61B56FEF2D0), U64_C(0xCE73F427ACC0A965), U64_C(0x8C8315CC052A9FF6),
+        U64_C(0x3A80143F5CF17F13), U64_C(0x7870F5D4F51B4980), U64_C(0xBF61D7E80F251235), U64_C(0xFD913603A6CF24A6),
+        U64_C(0x73B3727A52B393CC), U64_C(0x31439391FB59A55F), U64_C(0xF652B1AD0167FEEA), U64_C(0xB4A25046A88DC879),
+        U64_C(0xA8E6D8B54074A6AD), U64_C(0xEA16395EE99E903E), U64_C(0x2D071B6213A0CB8B), U64_C(0x6FF7FA89BA4AFD18),
+        U64_C(0xE1D5BEF04E364A72), U64_C(0xA3255F1BE7DC7CE1), U64_C(0x64347D271DE22754), U64_C(0x26C49CCCB40811C7),
+        U64_C(0x5CBD6CC0CC10FAFC), U64_C(0x1E4D8D2B65FACC6F), U64_C(0xD95CAF179FC497DA), U64_C(0x9BAC4EFC362EA149),
+        U64_C(0x158E0A85C2521623), U64_C(0x577EEB6E6BB820B0), U64_C(0x906FC95291867B05), U64_C(0xD29F28B9386C4D96),
+        U64_C(0xCEDBA04AD0952342), U64_C(0x8C2B41A1797F15D1), U64_C(0x4B3A639D83414E64), U64_C(0x09CA82762AAB78F7),
+        U64_C(0x87E8C60FDED7CF9D), U64_C(0xC51827E4773DF90E), U64_C(0x020905D88D03A2BB), U64_C(0x40F9E43324E99428),
+        U64_C(0x2CFFE7D5975E55E2), U64_C(0x6E0F063E3EB46371), U64_C(0xA91E2402C48A38C4), U64_C(0xEBEEC5E96D600E57),
+        U64_C(0x65CC8190991CB93D), U64_C(0x273C607B30F68FAE), U64_C(0xE02D4247CAC8D41B), U64_C(0xA2DDA3AC6322E288),
+        U64_C(0xBE992B5F8BDB8C5C), U64_C(0xFC69CAB42231BACF), U64_C(0x3B78E888D80FE17A), U64_C(0x7988096371E5D7E9),
+        U64_C(0xF7AA4D1A85996083), U64_C(0xB55AACF12C735610), U64_C(0x724B8ECDD64D0DA5), U64_C(0x30BB6F267FA73B36),
+        U64_C(0x4AC29F2A07BFD00D), U64_C(0x08327EC1AE55E69E), U64_C(0xCF235CFD546BBD2B), U64_C(0x8DD3BD16FD818BB8),
+        U64_C(0x03F1F96F09FD3CD2), U64_C(0x41011884A0170A41), U64_C(0x86103AB85A2951F4), U64_C(0xC4E0DB53F3C36767),
+        U64_C(0xD8A453A01B3A09B3), U64_C(0x9A54B24BB2D03F20), U64_C(0x5D45907748EE6495), U64_C(0x1FB5719CE1045206),
+        U64_C(0x919735E51578E56C), U64_C(0xD367D40EBC92D3FF), U64_C(0x1476F63246AC884A), U64_C(0x568617D9EF46BED9),
+        U64_C(0xE085162AB69D5E3C), U64_C(0xA275F7C11F7768AF), U64_C(0x6564D5FDE549331A), U64_C(0x279434164CA30589),
+        U64_C(0xA9B6706FB8DFB2E3), U64_C(0xEB46918411358470), U64_C(0x2C57B3B8EB0BDFC5), U64_C(0x6EA7525342E1E956),
+        U64_C(0x72E3DAA0AA188782), U64_C(0x30133B4B03F2B111), U64_C(0xF7021977F9CCEAA4), U64_C(0xB5F2F89C5026DC37),
+        U64_C(0x3BD0BCE5A45A6B5D), U64_C(0x79205D0E0DB05DCE), U64_C(0xBE317F32F78E067B), U64_C(0xFCC19ED95E6430E8),
+        U64_C(0x86B86ED5267CDBD3), U64_C(0xC4488F3E8F96ED40), U64_C(0x0359AD0275A8B6F5), U64_C(0x41A94CE9DC428066),
+        U64_C(0xCF8B0890283E370C), U64_C(0x8D7BE97B81D4019F), U64_C(0x4A6ACB477BEA5A2A), U64_C(0x089A2AACD2006CB9),
+        U64_C(0x14DEA25F3AF9026D), U64_C(0x562E43B4931334FE), U64_C(0x913F6188692D6F4B), U64_C(0xD3CF8063C0C759D8),
+        U64_C(0x5DEDC41A34BBEEB2), U64_C(0x1F1D25F19D51D821), U64_C(0xD80C07CD676F8394), U64_C(0x9AFCE626CE85B507),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0xAF052A6B538EDF09), U64_C(0x1CFAB53D0EF78881), U64_C(0xB3FF9F565D795788),
+        U64_C(0x39F56A7A1DEF1102), U64_C(0x96F040114E61CE0B), U64_C(0x250FDF4713189983), U64_C(0x8A0AF52C4096468A),
+        U64_C(0x73EAD4F43BDE2204), U64_C(0xDCEFFE9F6850FD0D), U64_C(0x6F1061C93529AA85), U64_C(0xC0154BA266A7758C),
+        U64_C(0x4A1FBE8E26313306), U64_C(0xE51A94E575BFEC0F), U64_C(0x56E50BB328C6BB87), U64_C(0xF9E021D87B48648E),
+        U64_C(0xE7D5A9E877BC4408), U64_C(0x48D0838324329B01), U64_C(0xFB2F1CD5794BCC89), U64_C(0x542A36BE2AC51380),
+        U64_C(0xDE20C3926A53550A), U64_C(0x7125E9F939DD8A03), U64_C(0xC2DA76AF64A4DD8B), U64_C(0x6DDF5CC4372A0282),
+        U64_C(0x943F7D1C4C62660C), U64_C(0x3B3A57771FECB905), U64_C(0x88C5C8214295EE8D), U64_C(0x27C0E24A111B3184),
+        U64_C(0xADCA1766518D770E), U64_C(0x02CF3D0D0203A807), U64_C(0xB130A25B5F7AFF8F), U64_C(0x1E3588300CF42086),
+        U64_C(0x8D5BB23B4692BE83), U64_C(0x225E9850151C618A), U64_C(0x91A1070648653602), U64_C(0x3EA42D6D1BEBE90B),
+        U64_C(0xB4AED8415B7DAF81), U64_C(0x1BABF22A08F37088), U64_C(0xA8546D7C558A2700), U64_C(0x075147170604F809),
+        U64_C(0xFEB166CF7D4C9C87), U64_C(0x51B44CA42EC2438E), U64_C(0xE24BD3F273BB1406), U64_C(0x4D4EF9992035CB0F),
+        U64_C(0xC7440CB560A38D85), U64_C(0x684126DE332D528C), U64_C(0xDBBEB9886E540504), U64_C(0x74BB93E33DDADA0D),
+        U64_C(0x6A8E1BD3312EFA8B), U64_C(0xC58B31B862A02582), U64_C(0x7674AEEE3FD9720A), U64_C(0xD97184856C57AD03),
+        U64_C(0x537B71A92CC1EB89), U64_C(0xFC7E5BC27F4F3480), U64_C(0x4F81C49422366308), U64_C(0xE084EEFF71B8BC01),
+        U64_C(0x1964CF270AF0D88F), U64_C(0xB661E54C597E0786), U64_C(0x059E7A1A0407500E), U64_C(0xAA9B507157898F07),
+        U64_C(0x2091A55D171FC98D), U64_C(0x8F948F3644911684), U64_C(0x3C6B106019E8410C), U64_C(0x936E3A0B4A669E05),
+        U64_C(0x5847859D24CF4B95), U64_C(0xF742AFF67741949C), U64_C(0x44BD30A02A38C314), U64_C(0xEBB81ACB79B61C1D),
+        U64_C(0x61B2EFE739205A97), U64_C(0xCEB7C58C6AAE859E), U64_C(0x7D485ADA37D7D216), U64_C(0xD24D70B164590D1F),
+        U64_C(0x2BAD51691F116991), U64_C(0x84A87B024C9FB698), U64_C(0x3757E45411E6E110), U64_C(0x9852CE3F42683E19),
+        U64_C(0x12583B1302FE7893), U64_C(0xBD5D11785170A79A), U64_C(0x0EA28E2E0C09F012), U64_C(0xA1A7A4455F872F1B),
+        U64_C(0xBF922C7553730F9D), U64_C(0x1097061E00FDD094), U64_C(0xA36899485D84871C), U64_C(0x0C6DB3230E0A5815),
+        U64_C(0x8667460F4E9C1E9F), U64_C(0x29626C641D12C196), U64_C(0x9A9DF332406B961E), U64_C(0x3598D95913E54917),
+        U64_C(0xCC78F88168AD2D99), U64_C(0x637DD2EA3B23F290), U64_C(0xD0824DBC665AA518), U64_C(0x7F8767D735D47A11),
+        U64_C(0xF58D92FB75423C9B), U64_C(0x5A88B89026CCE392), U64_C(0xE97727C67BB5B41A), U64_C(0x46720DAD283B6B13),
+        U64_C(0xD51C37A6625DF516), U64_C(0x7A191DCD31D32A1F), U64_C(0xC9E6829B6CAA7D97), U64_C(0x66E3A8F03F24A29E),
+        U64_C(0xECE95DDC7FB2E414), U64_C(0x43EC77B72C3C3B1D), U64_C(0xF013E8E171456C95), U64_C(0x5F16C28A22CBB39C),
+        U64_C(0xA6F6E3525983D712), U64_C(0x09F3C9390A0D081B), U64_C(0xBA0C566F57745F93), U64_C(0x15097C0404FA809A),
+        U64_C(0x9F038928446CC610), U64_C(0x3006A34317E21919), U64_C(0x83F93C154A9B4E91), U64_C(0x2CFC167E19159198),
+        U64_C(0x32C99E4E15E1B11E), U64_C(0x9DCCB425466F6E17), U64_C(0x2E332B731B16399F), U64_C(0x813601184898E696),
+        U64_C(0x0B3CF434080EA01C), U64_C(0xA439DE5F5B807F15), U64_C(0x17C6410906F9289D), U64_C(0xB8C36B625577F794),
+        U64_C(0x41234ABA2E3F931A), U64_C(0xEE2660D17DB14C13), U64_C(0x5DD9FF8720C81B9B), U64_C(0xF2DCD5EC7346C492),
+        U64_C(0x78D620C033D08218), U64_C(0xD7D30AAB605E5D11), U64_C(0x642C95FD3D270A99), U64_C(0xCB29BF966EA9D590),
+        U64_C(0xB08F0B3A499E972A), U64_C(0x1F8A21511A104823), U64_C(0xAC75BE0747691FAB), U64_C(0x0370946C14E7C0A2),
+        U64_C(0x897A614054718628), U64_C(0x267F4B2B07FF5921), U64_C(0x9580D47D5A860EA9), U64_C(0x3A85FE160908D1A0),
+        U64_C(0xC365DFCE7240B52E), U64_C(0x6C60F5A521CE6A27), U64_C(0xDF9F6AF37CB73DAF), U64_C(0x709A40982F39E2A6),
+        U64_C(0xFA90B5B46FAFA42C), U64_C(0x55959FDF3C217B25), U64_C(0xE66A008961582CAD), U64_C(0x496F2AE232D6F3A4),
+        U64_C(0x575AA2D23E22D322), U64_C(0xF85F88B96DAC0C2B), U64_C(0x4BA017EF30D55BA3), U64_C(0xE4A53D84635B84AA),
+        U64_C(0x6EAFC8A823CDC220), U64_C(0xC1AAE2C370431D29), U64_C(0x72557D952D3A4AA1), U64_C(0xDD5057FE7EB495A8),
+        U64_C(0x24B0762605FCF126), U64_C(0x8BB55C4D56722E2F), U64_C(0x384AC31B0B0B79A7), U64_C(0x974FE9705885A6AE),
+        U64_C(0x1D451C5C1813E024), U64_C(0xB24036374B9D3F2D), U64_C(0x01BFA96116E468A5), U64_C(0xAEBA830A456AB7AC),
+        U64_C(0x3DD4B9010F0C29A9), U64_C(0x92D1936A5C82F6A0), U64_C(0x212E0C3C01FBA128), U64_C(0x8E2B265752757E21),
+        U64_C(0x0421D37B12E338AB), U64_C(0xAB24F910416DE7A2), U64_C(0x18DB66461C14B02A), U64_C(0xB7DE4C2D4F9A6F23),
+        U64_C(0x4E3E6DF534D20BAD), U64_C(0xE13B479E675CD4A4), U64_C(0x52C4D8C83A25832C), U64_C(0xFDC1F2A369AB5C25),
+        U64_C(0x77CB078F293D1AAF), U64_C(0xD8CE2DE47AB3C5A6), U64_C(0x6B31B2B227CA922E), U64_C(0xC43498D974444D27),
+        U64_C(0xDA0110E978B06DA1), U64_C(0x75043A822B3EB2A8), U64_C(0xC6FBA5D47647E520), U64_C(0x69FE8FBF25C93A29),
+        U64_C(0xE3F47A93655F7CA3), U64_C(0x4CF150F836D1A3AA), U64_C(0xFF0ECFAE6BA8F422), U64_C(0x500BE5C538262B2B),
+        U64_C(0xA9EBC41D436E4FA5), U64_C(0x06EEEE7610E090AC), U64_C(0xB51171204D99C724), U64_C(0x1A145B4B1E17182D),
+        U64_C(0x901EAE675E815EA7), U64_C(0x3F1B840C0D0F81AE), U64_C(0x8CE41B5A5076D626), U64_C(0x23E1313103F8092F),
+        U64_C(0xE8C88EA76D51DCBF), U64_C(0x47CDA4CC3EDF03B6), U64_C(0xF4323B9A63A6543E), U64_C(0x5B3711F130288B37),
+        U64_C(0xD13DE4DD70BECDBD), U64_C(0x7E38CEB6233012B4), U64_C(0xCDC751E07E49453C), U64_C(0x62C27B8B2DC79A35),
+        U64_C(0x9B225A53568FFEBB), U64_C(0x34277038050121B2), U64_C(0x87D8EF6E5878763A), U64_C(0x28DDC5050BF6A933),
+        U64_C(0xA2D730294B60EFB9), U64_C(0x0DD21A4218EE30B0), U64_C(0xBE2D851445976738), U64_C(0x1128AF7F1619B831),
+        U64_C(0x0F1D274F1AED98B7), U64_C(0xA0180D24496347BE), U64_C(0x13E79272141A1036), U64_C(0xBCE2B8194794CF3F),
+        U64_C(0x36E84D35070289B5), U64_C(0x99ED675E548C56BC), U64_C(0x2A12F80809F50134), U64_C(0x8517D2635A7BDE3D),
+        U64_C(0x7CF7F3BB2133BAB3), U64_C(0xD3F2D9D072BD65BA), U64_C(0x600D46862FC43232), U64_C(0xCF086CED7C4AED3B),
+        U64_C(0x450299C13CDCABB1), U64_C(0xEA07B3AA6F5274B8), U64_C(0x59F82CFC322B2330), U64_C(0xF6FD069761A5FC39),
+        U64_C(0x65933C9C2BC3623C), U64_C(0xCA9616F7784DBD35), U64_C(0x796989A12534EABD), U64_C(0xD66CA3CA76BA35B4),
+        U64_C(0x5C6656E6362C733E), U64_C(0xF3637C8D65A2AC37), U64_C(0x409CE3DB38DBFBBF), U64_C(0xEF99C9B06B5524B6),
+        U64_C(0x1679E868101D4038), U64_C(0xB97CC20343939F31), U64_C(0x0A835D551EEAC8B9), U64_C(0xA586773E4D6417B0),
+        U64_C(0x2F8C82120DF2513A), U64_C(0x8089A8795E7C8E33), U64_C(0x3376372F0305D9BB), U64_C(0x9C731D44508B06B2),
+        U64_C(0x824695745C7F2634), U64_C(0x2D43BF1F0FF1F93D), U64_C(0x9EBC20495288AEB5), U64_C(0x31B90A22010671BC),
+        U64_C(0xBBB3FF0E41903736), U64_C(0x14B6D565121EE83F), U64_C(0xA7494A334F67BFB7), U64_C(0x084C60581CE960BE),
+        U64_C(0xF1AC418067A10430), U64_C(0x5EA96BEB342FDB39), U64_C(0xED56F4BD69568CB1), U64_C(0x4253DED63AD853B8),
+        U64_C(0xC8592BFA7A4E1532), U64_C(0x675C019129C0CA3B), U64_C(0xD4A39EC774B99DB3), U64_C(0x7BA6B4AC273742BA),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x23EEF79F3AD718C7), U64_C(0x47DDEF3E75AE318E), U64_C(0x643318A14F792949),
+        U64_C(0x8FBBDE7CEB5C631C), U64_C(0xAC5529E3D18B7BDB), U64_C(0xC86631429EF25292), U64_C(0xEB88C6DDA4254A55),
+        U64_C(0x5D875D127F52F0AB), U64_C(0x7E69AA8D4585E86C), U64_C(0x1A5AB22C0AFCC125), U64_C(0x39B445B3302BD9E2),
+        U64_C(0xD23C836E940E93B7), U64_C(0xF1D274F1AED98B70), U64_C(0x95E16C50E1A0A239), U64_C(0xB60F9BCFDB77BAFE),
+        U64_C(0xBB0EBA24FEA5E156), U64_C(0x98E04DBBC472F991), U64_C(0xFCD3551A8B0BD0D8), U64_C(0xDF3DA285B1DCC81F),
+        U64_C(0x34B5645815F9824A), U64_C(0x175B93C72F2E9A8D), U64_C(0x73688B666057B3C4), U64_C(0x50867CF95A80AB03),
+        U64_C(0xE689E73681F711FD), U64_C(0xC56710A9BB20093A), U64_C(0xA1540808F4592073), U64_C(0x82BAFF97CE8E38B4),
+        U64_C(0x6932394A6AAB72E1), U64_C(0x4ADCCED5507C6A26), U64_C(0x2EEFD6741F05436F), U64_C(0x0D0121EB25D25BA8),
+        U64_C(0x34ED95A254A1F43F), U64_C(0x1703623D6E76ECF8), U64_C(0x73307A9C210FC5B1), U64_C(0x50DE8D031BD8DD76),
+        U64_C(0xBB564BDEBFFD9723), U64_C(0x98B8BC41852A8FE4), U64_C(0xFC8BA4E0CA53A6AD), U64_C(0xDF65537FF084BE6A),
+        U64_C(0x696AC8B02BF30494), U64_C(0x4A843F2F11241C53), U64_C(0x2EB7278E5E5D351A), U64_C(0x0D59D011648A2DDD),
+        U64_C(0xE6D116CCC0AF6788), U64_C(0xC53FE153FA787F4F), U64_C(0xA10CF9F2B5015606), U64_C(0x82E20E6D8FD64EC1),
+        U64_C(0x8FE32F86AA041569), U64_C(0xAC0DD81990D30DAE), U64_C(0xC83EC0B8DFAA24E7), U64_C(0xEBD03727E57D3C20),
+        U64_C(0x0058F1FA41587675), U64_C(0x23B606657B8F6EB2), U64_C(0x47851EC434F647FB), U64_C(0x646BE95B0E215F3C),
+        U64_C(0xD2647294D556E5C2), U64_C(0xF18A850BEF81FD05), U64_C(0x95B99DAAA0F8D44C), U64_C(0xB6576A359A2FCC8B),
+        U64_C(0x5DDFACE83E0A86DE), U64_C(0x7E315B7704DD9E19), U64_C(0x1A0243D64BA4B750), U64_C(0x39ECB4497173AF97),
+        U64_C(0x69DB2B44A943E87E), U64_C(0x4A35DCDB9394F0B9), U64_C(0x2E06C47ADCEDD9F0), U64_C(0x0DE833E5E63AC137),
+        U64_C(0xE660F538421F8B62), U64_C(0xC58E02A778C893A5), U64_C(0xA1BD1A0637B1BAEC), U64_C(0x8253ED990D66A22B),
+        U64_C(0x345C7656D61118D5), U64_C(0x17B281C9ECC60012), U64_C(0x73819968A3BF295B), U64_C(0x506F6EF79968319C),
+        U64_C(0xBBE7A82A3D4D7BC9), U64_C(0x98095FB5079A630E), U64_C(0xFC3A471448E34A47), U64_C(0xDFD4B08B72345280),
+        U64_C(0xD2D5916057E60928), U64_C(0xF13B66FF6D3111EF), U64_C(0x95087E5E224838A6), U64_C(0xB6E689C1189F2061),
+        U64_C(0x5D6E4F1CBCBA6A34), U64_C(0x7E80B883866D72F3), U64_C(0x1AB3A022C9145BBA), U64_C(0x395D57BDF3C3437D),
+        U64_C(0x8F52CC7228B4F983), U64_C(0xACBC3BED1263E144), U64_C(0xC88F234C5D1AC80D), U64_C(0xEB61D4D367CDD0CA),
+        U64_C(0x00E9120EC3E89A9F), U64_C(0x2307E591F93F8258), U64_C(0x4734FD30B646AB11), U64_C(0x64DA0AAF8C91B3D6),
+        U64_C(0x5D36BEE6FDE21C41), U64_C(0x7ED84979C7350486), U64_C(0x1AEB51D8884C2DCF), U64_C(0x3905A647B29B3508),
+        U64_C(0xD28D609A16BE7F5D), U64_C(0xF16397052C69679A), U64_C(0x95508FA463104ED3), U64_C(0xB6BE783B59C75614),
+        U64_C(0x00B1E3F482B0ECEA), U64_C(0x235F146BB867F42D), U64_C(0x476C0CCAF71EDD64), U64_C(0x6482FB55CDC9C5A3),
+        U64_C(0x8F0A3D8869EC8FF6), U64_C(0xACE4CA17533B9731), U64_C(0xC8D7D2B61C42BE78), U64_C(0xEB3925292695A6BF),
+        U64_C(0xE63804C20347FD17), U64_C(0xC5D6F35D3990E5D0), U64_C(0xA1E5EBFC76E9CC99), U64_C(0x820B1C634C3ED45E),
+        U64_C(0x6983DABEE81B9E0B), U64_C(0x4A6D2D21D2CC86CC), U64_C(0x2E5E35809DB5AF85), U64_C(0x0DB0C21FA762B742),
+        U64_C(0xBBBF59D07C150DBC), U64_C(0x9851AE4F46C2157B), U64_C(0xFC62B6EE09BB3C32), U64_C(0xDF8C4171336C24F5),
+        U64_C(0x340487AC97496EA0), U64_C(0x17EA7033AD9E7667), U64_C(0x73D96892E2E75F2E), U64_C(0x50379F0DD83047E9),
+        U64_C(0xD3B656895287D0FC), U64_C(0xF058A1166850C83B), U64_C(0x946BB9B72729E172), U64_C(0xB7854E281DFEF9B5),
+        U64_C(0x5C0D88F5B9DBB3E0), U64_C(0x7FE37F6A830CAB27), U64_C(0x1BD067CBCC75826E), U64_C(0x383E9054F6A29AA9),
+        U64_C(0x8E310B9B2DD52057), U64_C(0xADDFFC0417023890), U64_C(0xC9ECE4A5587B11D9), U64_C(0xEA02133A62AC091E),
+        U64_C(0x018AD5E7C689434B), U64_C(0x22642278FC5E5B8C), U64_C(0x46573AD9B32772C5), U64_C(0x65B9CD4689F06A02),
+        U64_C(0x68B8ECADAC2231AA), U64_C(0x4B561B3296F5296D), U64_C(0x2F650393D98C0024), U64_C(0x0C8BF40CE35B18E3),
+        U64_C(0xE70332D1477E52B6), U64_C(0xC4EDC54E7DA94A71), U64_C(0xA0DEDDEF32D06338), U64_C(0x83302A7008077BFF),
+        U64_C(0x353FB1BFD370C101), U64_C(0x16D14620E9A7D9C6), U64_C(0x72E25E81A6DEF08F), U64_C(0x510CA91E9C09E848),
+        U64_C(0xBA846FC3382CA21D), U64_C(0x996A985C02FBBADA), U64_C(0xFD5980FD4D829393), U64_C(0xDEB7776277558B54),
+        U64_C(0xE75BC32B062624C3), U64_C(0xC4B534B43CF13C04), U64_C(0xA0862C157388154D), U64_C(0x8368DB8A495F0D8A),
+        U64_C(0x68E01D57ED7A47DF), U64_C(0x4B0EEAC8D7AD5F18), U64_C(0x2F3DF26998D47651), U64_C(0x0CD305F6A2036E96),
+        U64_C(0xBADC9E397974D468), U64_C(0x993269A643A3CCAF), U64_C(0xFD0171070CDAE5E6), U64_C(0xDEEF8698360DFD21),
+        U64_C(0x356740459228B774), U64_C(0x1689B7DAA8FFAFB3), U64_C(0x72BAAF7BE78686FA), U64_C(0x515458E4DD519E3D),
+        U64_C(0x5C55790FF883C595), U64_C(0x7FBB8E90C254DD52), U64_C(0x1B8896318D2DF41B), U64_C(0x386661AEB7FAECDC),
+        U64_C(0xD3EEA77313DFA689), U64_C(0xF00050EC2908BE4E), U64_C(0x9433484D66719707), U64_C(0xB7DDBFD25CA68FC0),
+        U64_C(0x01D2241D87D1353E), U64_C(0x223CD382BD062DF9), U64_C(0x460FCB23F27F04B0), U64_C(0x65E13CBCC8A81C77),
+        U64_C(0x8E69FA616C8D5622), U64_C(0xAD870DFE565A4EE5), U64_C(0xC9B4155F192367AC), U64_C(0xEA5AE2C023F47F6B),
+        U64_C(0xBA6D7DCDFBC43882), U64_C(0x99838A52C1132045), U64_C(0xFDB092F38E6A090C), U64_C(0xDE5E656CB4BD11CB),
+        U64_C(0x35D6A3B110985B9E), U64_C(0x1638542E2A4F4359), U64_C(0x720B4C8F65366A10), U64_C(0x51E5BB105FE172D7),
+        U64_C(0xE7EA20DF8496C829), U64_C(0xC404D740BE41D0EE), U64_C(0xA037CFE1F138F9A7), U64_C(0x83D9387ECBEFE160),
+        U64_C(0x6851FEA36FCAAB35), U64_C(0x4BBF093C551DB3F2), U64_C(0x2F8C119D1A649ABB), U64_C(0x0C62E60220B3827C),
+        U64_C(0x0163C7E90561D9D4), U64_C(0x228D30763FB6C113), U64_C(0x46BE28D770CFE85A), U64_C(0x6550DF484A18F09D),
+        U64_C(0x8ED81995EE3DBAC8), U64_C(0xAD36EE0AD4EAA20F), U64_C(0xC905F6AB9B938B46), U64_C(0xEAEB0134A1449381),
+        U64_C(0x5CE49AFB7A33297F), U64_C(0x7F0A6D6440E431B8), U64_C(0x1B3975C50F9D18F1), U64_C(0x38D7825A354A0036),
+        U64_C(0xD35F4487916F4A63), U64_C(0xF0B1B318ABB852A4), U64_C(0x9482ABB9E4C17BED), U64_C(0xB76C5C26DE16632A),
+        U64_C(0x8E80E86FAF65CCBD), U64_C(0xAD6E1FF095B2D47A), U64_C(0xC95D0751DACBFD33), U64_C(0xEAB3F0CEE01CE5F4),
+        U64_C(0x013B36134439AFA1), U64_C(0x22D5C18C7EEEB766), U64_C(0x46E6D92D31979E2F), U64_C(0x65082EB20B4086E8),
+        U64_C(0xD307B57DD0373C16), U64_C(0xF0E942E2EAE024D1), U64_C(0x94DA5A43A5990D98), U64_C(0xB734ADDC9F4E155F),
+        U64_C(0x5CBC6B013B6B5F0A), U64_C(0x7F529C9E01BC47CD), U64_C(0x1B61843F4EC56E84), U64_C(0x388F73A074127643),
+        U64_C(0x358E524B51C02DEB), U64_C(0x1660A5D46B17352C), U64_C(0x7253BD75246E1C65), U64_C(0x51BD4AEA1EB904A2),
+        U64_C(0xBA358C37BA9C4EF7), U64_C(0x99DB7BA8804B5630), U64_C(0xFDE86309CF327F79), U64_C(0xDE069496F5E567BE),
+        U64_C(0x68090F592E92DD40), U64_C(0x4BE7F8C61445C587), U64_C(0x2FD4E0675B3CECCE), U64_C(0x0C3A17F861EBF409),
+        U64_C(0xE7B2D125C5CEBE5C), U64_C(0xC45C26BAFF19A69B), U64_C(0xA06F3E1BB0608FD2), U64_C(0x8381C9848AB79715),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0xE59C4CF90CE5976B), U64_C(0x89C87819B0211845), U64_C(0x6C5434E0BCC48F2E),
+        U64_C(0x516011D8C9A80619), U64_C(0xB4FC5D21C54D9172), U64_C(0xD8A869C179891E5C), U64_C(0x3D342538756C8937),
+        U64_C(0xA2C023B193500C32), U64_C(0x475C6F489FB59B59), U64_C(0x2B085BA823711477), U64_C(0xCE9417512F94831C),
+        U64_C(0xF3A032695AF80A2B), U64_C(0x163C7E90561D9D40), U64_C(0x7A684A70EAD9126E), U64_C(0x9FF40689E63C8505),
+        U64_C(0x0770A6888F4A2EF7), U64_C(0xE2ECEA7183AFB99C), U64_C(0x8EB8DE913F6B36B2), U64_C(0x6B249268338EA1D9),
+        U64_C(0x5610B75046E228EE), U64_C(0xB38CFBA94A07BF85), U64_C(0xDFD8CF49F6C330AB), U64_C(0x3A4483B0FA26A7C0),
+        U64_C(0xA5B085391C1A22C5), U64_C(0x402CC9C010FFB5AE), U64_C(0x2C78FD20AC3B3A80), U64_C(0xC9E4B1D9A0DEADEB),
+        U64_C(0xF4D094E1D5B224DC), U64_C(0x114CD818D957B3B7), U64_C(0x7D18ECF865933C99), U64_C(0x9884A0016976ABF2),
+        U64_C(0x0EE14D111E945DEE), U64_C(0xEB7D01E81271CA85), U64_C(0x87293508AEB545AB), U64_C(0x62B579F1A250D2C0),
+        U64_C(0x5F815CC9D73C5BF7), U64_C(0xBA1D1030DBD9CC9C), U64_C(0xD64924D0671D43B2), U64_C(0x33D568296BF8D4D9),
+        U64_C(0xAC216EA08DC451DC), U64_C(0x49BD22598121C6B7), U64_C(0x25E916B93DE54999), U64_C(0xC0755A403100DEF2),
+        U64_C(0xFD417F78446C57C5), U64_C(0x18DD33814889C0AE), U64_C(0x74890761F44D4F80), U64_C(0x91154B98F8A8D8EB),
+        U64_C(0x0991EB9991DE7319), U64_C(0xEC0DA7609D3BE472), U64_C(0x8059938021FF6B5C), U64_C(0x65C5DF792D1AFC37),
+        U64_C(0x58F1FA4158767500), U64_C(0xBD6DB6B85493E26B), U64_C(0xD1398258E8576D45), U64_C(0x34A5CEA1E4B2FA2E),
+        U64_C(0xAB51C828028E7F2B), U64_C(0x4ECD84D10E6BE840), U64_C(0x2299B031B2AF676E), U64_C(0xC705FCC8BE4AF005),
+        U64_C(0xFA31D9F0CB267932), U64_C(0x1FAD9509C7C3EE59), U64_C(0x73F9A1E97B076177), U64_C(0x9665ED1077E2F61C),
+        U64_C(0x1DC29A223D28BBDC), U64_C(0xF85ED6DB31CD2CB7), U64_C(0x940AE23B8D09A399), U64_C(0x7196AEC281EC34F2),
+        U64_C(0x4CA28BFAF480BDC5), U64_C(0xA93EC703F8652AAE), U64_C(0xC56AF3E344A1A580), U64_C(0x20F6BF1A484432EB),
+        U64_C(0xBF02B993AE78B7EE), U64_C(0x5A9EF56AA29D2085), U64_C(0x36CAC18A1E59AFAB), U64_C(0xD3568D7312BC38C0),
+        U64_C(0xEE62A84B67D0B1F7), U64_C(0x0BFEE4B26B35269C), U64_C(0x67AAD052D7F1A9B2), U64_C(0x82369CABDB143ED9),
+        U64_C(0x1AB23CAAB262952B), U64_C(0xFF2E7053BE870240), U64_C(0x937A44B302438D6E), U64_C(0x76E6084A0EA61A05),
+        U64_C(0x4BD22D727BCA9332), U64_C(0xAE4E618B772F0459), U64_C(0xC21A556BCBEB8B77), U64_C(0x27861992C70E1C1C),
+        U64_C(0xB8721F1B21329919), U64_C(0x5DEE53E22DD70E72), U64_C(0x31BA67029113815C), U64_C(0xD4262BFB9DF61637),
+        U64_C(0xE9120EC3E89A9F00), U64_C(0x0C8E423AE47F086B), U64_C(0x60DA76DA58BB8745), U64_C(0x85463A23545E102E),
+        U64_C(0x1323D73323BCE632), U64_C(0xF6BF9BCA2F597159), U64_C(0x9AEBAF2A939DFE77), U64_C(0x7F77E3D39F78691C),
+        U64_C(0x4243C6EBEA14E02B), U64_C(0xA7DF8A12E6F17740), U64_C(0xCB8BBEF25A35F86E), U64_C(0x2E17F20B56D06F05),
+        U64_C(0xB1E3F482B0ECEA00), U64_C(0x547FB87BBC097D6B), U64_C(0x382B8C9B00CDF245), U64_C(0xDDB7C0620C28652E),
+        U64_C(0xE083E55A7944EC19), U64_C(0x051FA9A375A17B72), U64_C(0x694B9D43C965F45C), U64_C(0x8CD7D1BAC5806337),
+        U64_C(0x145371BBACF6C8C5), U64_C(0xF1CF3D42A0135FAE), U64_C(0x9D9B09A21CD7D080), U64_C(0x7807455B103247EB),
+        U64_C(0x45336063655ECEDC), U64_C(0xA0AF2C9A69BB59B7), U64_C(0xCCFB187AD57FD699), U64_C(0x29675483D99A41F2),
+        U64_C(0xB693520A3FA6C4F7), U64_C(0x530F1EF33343539C), U64_C(0x3F5B2A138F87DCB2), U64_C(0xDAC766EA83624BD9),
+        U64_C(0xE7F343D2F60EC2EE), U64_C(0x026F0F2BFAEB5585), U64_C(0x6E3B3BCB462FDAAB), U64_C(0x8BA777324ACA4DC0),
+        U64_C(0x3B8534447A5177B8), U64_C(0xDE1978BD76B4E0D3), U64_C(0xB24D4C5DCA706FFD), U64_C(0x57D100A4C695F896),
+        U64_C(0x6AE5259CB3F971A1), U64_C(0x8F796965BF1CE6CA), U64_C(0xE32D5D8503D869E4), U64_C(0x06B1117C0F3DFE8F),
+        U64_C(0x994517F5E9017B8A), U64_C(0x7CD95B0CE5E4ECE1), U64_C(0x108D6FEC592063CF), U64_C(0xF511231555C5F4A4),
+        U64_C(0xC825062D20A97D93), U64_C(0x2DB94AD42C4CEAF8), U64_C(0x41ED7E34908865D6), U64_C(0xA47132CD9C6DF2BD),
+        U64_C(0x3CF592CCF51B594F), U64_C(0xD969DE35F9FECE24), U64_C(0xB53DEAD5453A410A), U64_C(0x50A1A62C49DFD661),
+        U64_C(0x6D9583143CB35F56), U64_C(0x8809CFED3056C83D), U64_C(0xE45DFB0D8C924713), U64_C(0x01C1B7F48077D078),
+        U64_C(0x9E35B17D664B557D), U64_C(0x7BA9FD846AAEC216), U64_C(0x17FDC964D66A4D38), U64_C(0xF261859DDA8FDA53),
+        U64_C(0xCF55A0A5AFE35364), U64_C(0x2AC9EC5CA306C40F), U64_C(0x469DD8BC1FC24B21), U64_C(0xA30194451327DC4A),
+        U64_C(0x3564795564C52A56), U64_C(0xD0F835AC6820BD3D), U64_C(0xBCAC014CD4E43213), U64_C(0x59304DB5D801A578),
+        U64_C(0x6404688DAD6D2C4F), U64_C(0x81982474A188BB24), U64_C(0xEDCC10941D4C340A), U64_C(0x08505C6D11A9A361),
+        U64_C(0x97A45AE4F7952664), U64_C(0x7238161DFB70B10F), U64_C(0x1E6C22FD47B43E21), U64_C(0xFBF06E044B51A94A),
+        U64_C(0xC6C44B3C3E3D207D), U64_C(0x235807C532D8B716), U64_C(0x4F0C33258E1C3838), U64_C(0xAA907FDC82F9AF53),
+        U64_C(0x3214DFDDEB8F04A1), U64_C(0xD7889324E76A93CA), U64_C(0xBBDCA7C45BAE1CE4), U64_C(0x5E40EB3D574B8B8F),
+        U64_C(0x6374CE05222702B8), U64_C(0x86E882FC2EC295D3), U64_C(0xEABCB61C92061AFD), U64_C(0x0F20FAE59EE38D96),
+        U64_C(0x90D4FC6C78DF0893), U64_C(0x7548B095743A9FF8), U64_C(0x191C8475C8FE10D6), U64_C(0xFC80C88CC41B87BD),
+        U64_C(0xC1B4EDB4B1770E8A), U64_C(0x2428A14DBD9299E1), U64_C(0x487C95AD015616CF), U64_C(0xADE0D9540DB381A4),
+        U64_C(0x2647AE664779CC64), U64_C(0xC3DBE29F4B9C5B0F), U64_C(0xAF8FD67FF758D421), U64_C(0x4A139A86FBBD434A),
+        U64_C(0x7727BFBE8ED1CA7D), U64_C(0x92BBF34782345D16), U64_C(0xFEEFC7A73EF0D238), U64_C(0x1B738B5E32154553),
+        U64_C(0x84878DD7D429C056), U64_C(0x611BC12ED8CC573D), U64_C(0x0D4FF5CE6408D813), U64_C(0xE8D3B93768ED4F78),
+        U64_C(0xD5E79C0F1D81C64F), U64_C(0x307BD0F611645124), U64_C(0x5C2FE416ADA0DE0A), U64_C(0xB9B3A8EFA1454961),
+        U64_C(0x213708EEC833E293), U64_C(0xC4AB4417C4D675F8), U64_C(0xA8FF70F77812FAD6), U64_C(0x4D633C0E74F76DBD),
+        U64_C(0x70571936019BE48A), U64_C(0x95CB55CF0D7E73E1), U64_C(0xF99F612FB1BAFCCF), U64_C(0x1C032DD6BD5F6BA4),
+        U64_C(0x83F72B5F5B63EEA1), U64_C(0x666B67A6578679CA), U64_C(0x0A3F5346EB42F6E4), U64_C(0xEFA31FBFE7A7618F),
+        U64_C(0xD2973A8792CBE8B8), U64_C(0x370B767E9E2E7FD3), U64_C(0x5B5F429E22EAF0FD), U64_C(0xBEC30E672E0F6796),
+        U64_C(0x28A6E37759ED918A), U64_C(0xCD3AAF8E550806E1), U64_C(0xA16E9B6EE9CC89CF), U64_C(0x44F2D797E5291EA4),
+        U64_C(0x79C6F2AF90459793), U64_C(0x9C5ABE569CA000F8), U64_C(0xF00E8AB620648FD6), U64_C(0x1592C64F2C8118BD),
+        U64_C(0x8A66C0C6CABD9DB8), U64_C(0x6FFA8C3FC6580AD3), U64_C(0x03AEB8DF7A9C85FD), U64_C(0xE632F42676791296),
+        U64_C(0xDB06D11E03159BA1), U64_C(0x3E9A9DE70FF00CCA), U64_C(0x52CEA907B33483E4), U64_C(0xB752E5FEBFD1148F),
+        U64_C(0x2FD645FFD6A7BF7D), U64_C(0xCA4A0906DA422816), U64_C(0xA61E3DE66686A738), U64_C(0x4382711F6A633053),
+        U64_C(0x7EB654271F0FB964), U64_C(0x9B2A18DE13EA2E0F), U64_C(0xF77E2C3EAF2EA121), U64_C(0x12E260C7A3CB364A),
+        U64_C(0x8D16664E45F7B34F), U64_C(0x688A2AB749122424), U64_C(0x04DE1E57F5D6AB0A), U64_C(0xE14252AEF9333C61),
+        U64_C(0xDC7677968C5FB556), U64_C(0x39EA3B6F80BA223D), U64_C(0x55BE0F8F3C7EAD13), U64_C(0xB0224376309B3A78),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x770A6888F4A2EF70), U64_C(0xEE14D111E945DEE0), U64_C(0x991EB9991DE73190),
+        U64_C(0x9ED943C87B618B53), U64_C(0xE9D32B408FC36423), U64_C(0x70CD92D9922455B3), U64_C(0x07C7FA516686BAC3),
+        U64_C(0x7F42667B5F292035), U64_C(0x08480EF3AB8BCF45), U64_C(0x9156B76AB66CFED5), U64_C(0xE65CDFE242CE11A5),
+        U64_C(0xE19B25B32448AB66), U64_C(0x96914D3BD0EA4416), U64_C(0x0F8FF4A2CD0D7586), U64_C(0x78859C2A39AF9AF6),
+        U64_C(0xFE84CCF6BE52406A), U64_C(0x898EA47E4AF0AF1A), U64_C(0x10901DE757179E8A), U64_C(0x679A756FA3B571FA),
+        U64_C(0x605D8F3EC533CB39), U64_C(0x1757E7B631912449), U64_C(0x8E495E2F2C7615D9), U64_C(0xF94336A7D8D4FAA9),
+        U64_C(0x81C6AA8DE17B605F), U64_C(0xF6CCC20515D98F2F), U64_C(0x6FD27B9C083EBEBF), U64_C(0x18D81314FC9C51CF),
+        U64_C(0x1F1FE9459A1AEB0C), U64_C(0x681581CD6EB8047C), U64_C(0xF10B3854735F35EC), U64_C(0x860150DC87FDDA9C),
+        U64_C(0xBFF97806D54EB647), U64_C(0xC8F3108E21EC5937), U64_C(0x51EDA9173C0B68A7), U64_C(0x26E7C19FC8A987D7),
+        U64_C(0x21203BCEAE2F3D14), U64_C(0x562A53465A8DD264), U64_C(0xCF34EADF476AE3F4), U64_C(0xB83E8257B3C80C84),
+        U64_C(0xC0BB1E7D8A679672), U64_C(0xB7B176F57EC57902), U64_C(0x2EAFCF6C63224892), U64_C(0x59A5A7E49780A7E2),
+        U64_C(0x5E625DB5F1061D21), U64_C(0x2968353D05A4F251), U64_C(0xB0768CA41843C3C1), U64_C(0xC77CE42CECE12CB1),
+        U64_C(0x417DB4F06B1CF62D), U64_C(0x3677DC789FBE195D), U64_C(0xAF6965E1825928CD), U64_C(0xD8630D6976FBC7BD),
+        U64_C(0xDFA4F738107D7D7E), U64_C(0xA8AE9FB0E4DF920E), U64_C(0x31B02629F938A39E), U64_C(0x46BA4EA10D9A4CEE),
+        U64_C(0x3E3FD28B3435D618), U64_C(0x4935BA03C0973968), U64_C(0xD02B039ADD7008F8), U64_C(0xA7216B1229D2E788),
+        U64_C(0xA0E691434F545D4B), U64_C(0xD7ECF9CBBBF6B23B), U64_C(0x4EF24052A61183AB), U64_C(0x39F828DA52B36CDB),
+        U64_C(0x3D0211E603775A1D), U64_C(0x4A08796EF7D5B56D), U64_C(0xD316C0F7EA3284FD), U64_C(0xA41CA87F1E906B8D),
+        U64_C(0xA3DB522E7816D14E), U64_C(0xD4D13AA68CB43E3E), U64_C(0x4DCF833F91530FAE), U64_C(0x3AC5EBB765F1E0DE),
+        U64_C(0x4240779D5C5E7A28), U64_C(0x354A1F15A8FC9558), U64_C(0xAC54A68CB51BA4C8), U64_C(0xDB5ECE0441B94BB8),
+        U64_C(0xDC993455273FF17B), U64_C(0xAB935CDDD39D1E0B), U64_C(0x328DE544CE7A2F9B), U64_C(0x45878DCC3AD8C0EB),
+        U64_C(0xC386DD10BD251A77), U64_C(0xB48CB5984987F507), U64_C(0x2D920C015460C497), U64_C(0x5A986489A0C22BE7),
+        U64_C(0x5D5F9ED8C6449124), U64_C(0x2A55F65032E67E54), U64_C(0xB34B4FC92F014FC4), U64_C(0xC4412741DBA3A0B4),
+        U64_C(0xBCC4BB6BE20C3A42), U64_C(0xCBCED3E316AED532), U64_C(0x52D06A7A0B49E4A2), U64_C(0x25DA02F2FFEB0BD2),
+        U64_C(0x221DF8A3996DB111), U64_C(0x5517902B6DCF5E61), U64_C(0xCC0929B270286FF1), U64_C(0xBB03413A848A8081),
+        U64_C(0x82FB69E0D639EC5A), U64_C(0xF5F10168229B032A), U64_C(0x6CEFB8F13F7C32BA), U64_C(0x1BE5D079CBDEDDCA),
+        U64_C(0x1C222A28AD586709), U64_C(0x6B2842A059FA8879), U64_C(0xF236FB39441DB9E9), U64_C(0x853C93B1B0BF5699),
+        U64_C(0xFDB90F9B8910CC6F), U64_C(0x8AB367137DB2231F), U64_C(0x13ADDE8A6055128F), U64_C(0x64A7B60294F7FDFF),
+        U64_C(0x63604C53F271473C), U64_C(0x146A24DB06D3A84C), U64_C(0x8D749D421B3499DC), U64_C(0xFA7EF5CAEF9676AC),
+        U64_C(0x7C7FA516686BAC30), U64_C(0x0B75CD9E9CC94340), U64_C(0x926B7407812E72D0), U64_C(0xE5611C8F758C9DA0),
+        U64_C(0xE2A6E6DE130A2763), U64_C(0x95AC8E56E7A8C813), U64_C(0x0CB237CFFA4FF983), U64_C(0x7BB85F470EED16F3),
+        U64_C(0x033DC36D37428C05), U64_C(0x7437ABE5C3E06375), U64_C(0xED29127CDE0752E5), U64_C(0x9A237AF42AA5BD95),
+        U64_C(0x9DE480A54C230756), U64_C(0xEAEEE82DB881E826), U64_C(0x73F051B4A566D9B6), U64_C(0x04FA393C51C436C6),
+        U64_C(0x7A0423CC06EEB43A), U64_C(0x0D0E4B44F24C5B4A), U64_C(0x9410F2DDEFAB6ADA), U64_C(0xE31A9A551B0985AA),
+        U64_C(0xE4DD60047D8F3F69), U64_C(0x93D7088C892DD019), U64_C(0x0AC9B11594CAE189), U64_C(0x7DC3D99D60680EF9),
+        U64_C(0x054645B759C7940F), U64_C(0x724C2D3FAD657B7F), U64_C(0xEB5294A6B0824AEF), U64_C(0x9C58FC2E4420A59F),
+        U64_C(0x9B9F067F22A61F5C), U64_C(0xEC956EF7D604F02C), U64_C(0x758BD76ECBE3C1BC), U64_C(0x0281BFE63F412ECC),
+        U64_C(0x8480EF3AB8BCF450), U64_C(0xF38A87B24C1E1B20), U64_C(0x6A943E2B51F92AB0), U64_C(0x1D9E56A3A55BC5C0),
+        U64_C(0x1A59ACF2C3DD7F03), U64_C(0x6D53C47A377F9073), U64_C(0xF44D7DE32A98A1E3), U64_C(0x8347156BDE3A4E93),
+        U64_C(0xFBC28941E795D465), U64_C(0x8CC8E1C913373B15), U64_C(0x15D658500ED00A85), U64_C(0x62DC30D8FA72E5F5),
+        U64_C(0x651BCA899CF45F36), U64_C(0x1211A2016856B046), U64_C(0x8B0F1B9875B181D6), U64_C(0xFC05731081136EA6),
+        U64_C(0xC5FD5BCAD3A0027D), U64_C(0xB2F733422702ED0D), U64_C(0x2BE98ADB3AE5DC9D), U64_C(0x5CE3E253CE4733ED),
+        U64_C(0x5B241802A8C1892E), U64_C(0x2C2E708A5C63665E), U64_C(0xB530C913418457CE), U64_C(0xC23AA19BB526B8BE),
+        U64_C(0xBABF3DB18C892248), U64_C(0xCDB55539782BCD38), U64_C(0x54ABECA065CCFCA8), U64_C(0x23A18428916E13D8),
+        U64_C(0x24667E79F7E8A91B), U64_C(0x536C16F1034A466B), U64_C(0xCA72AF681EAD77FB), U64_C(0xBD78C7E0EA0F988B),
+        U64_C(0x3B79973C6DF24217), U64_C(0x4C73FFB49950AD67), U64_C(0xD56D462D84B79CF7), U64_C(0xA2672EA570157387),
+        U64_C(0xA5A0D4F41693C944), U64_C(0xD2AABC7CE2312634), U64_C(0x4BB405E5FFD617A4), U64_C(0x3CBE6D6D0B74F8D4),
+        U64_C(0x443BF14732DB6222), U64_C(0x333199CFC6798D52), U64_C(0xAA2F2056DB9EBCC2), U64_C(0xDD2548DE2F3C53B2),
+        U64_C(0xDAE2B28F49BAE971), U64_C(0xADE8DA07BD180601), U64_C(0x34F6639EA0FF3791), U64_C(0x43FC0B16545DD8E1),
+        U64_C(0x4706322A0599EE27), U64_C(0x300C5AA2F13B0157), U64_C(0xA912E33BECDC30C7), U64_C(0xDE188BB3187EDFB7),
+        U64_C(0xD9DF71E27EF86574), U64_C(0xAED5196A8A5A8A04), U64_C(0x37CBA0F397BDBB94), U64_C(0x40C1C87B631F54E4),
+        U64_C(0x384454515AB0CE12), U64_C(0x4F4E3CD9AE122162), U64_C(0xD6508540B3F510F2), U64_C(0xA15AEDC84757FF82),
+        U64_C(0xA69D179921D14541), U64_C(0xD1977F11D573AA31), U64_C(0x4889C688C8949BA1), U64_C(0x3F83AE003C3674D1),
+        U64_C(0xB982FEDCBBCBAE4D), U64_C(0xCE8896544F69413D), U64_C(0x57962FCD528E70AD), U64_C(0x209C4745A62C9FDD),
+        U64_C(0x275BBD14C0AA251E), U64_C(0x5051D59C3408CA6E), U64_C(0xC94F6C0529EFFBFE), U64_C(0xBE45048DDD4D148E),
+        U64_C(0xC6C098A7E4E28E78), U64_C(0xB1CAF02F10406108), U64_C(0x28D449B60DA75098), U64_C(0x5FDE213EF905BFE8),
+        U64_C(0x5819DB6F9F83052B), U64_C(0x2F13B3E76B21EA5B), U64_C(0xB60D0A7E76C6DBCB), U64_C(0xC10762F6826434BB),
+        U64_C(0xF8FF4A2CD0D75860), U64_C(0x8FF522A42475B710), U64_C(0x16EB9B3D39928680), U64_C(0x61E1F3B5CD3069F0),
+        U64_C(0x662609E4ABB6D333), U64_C(0x112C616C5F143C43), U64_C(0x8832D8F542F30DD3), U64_C(0xFF38B07DB651E2A3),
+        U64_C(0x87BD2C578FFE7855), U64_C(0xF0B744DF7B5C9725), U64_C(0x69A9FD4666BBA6B5), U64_C(0x1EA395CE921949C5),
+        U64_C(0x19646F9FF49FF306), U64_C(0x6E6E0717003D1C76), U64_C(0xF770BE8E1DDA2DE6), U64_C(0x807AD606E978C296),
+        U64_C(0x067B86DA6E85180A), U64_C(0x7171EE529A27F77A), U64_C(0xE86F57CB87C0C6EA), U64_C(0x9F653F437362299A),
+        U64_C(0x98A2C51215E49359), U64_C(0xEFA8AD9AE1467C29), U64_C(0x76B61403FCA14DB9), U64_C(0x01BC7C8B0803A2C9),
+        U64_C(0x7939E0A131AC383F), U64_C(0x0E338829C50ED74F), U64_C(0x972D31B0D8E9E6DF), U64_C(0xE02759382C4B09AF),
+        U64_C(0xE7E0A3694ACDB36C), U64_C(0x90EACBE1BE6F5C1C), U64_C(0x09F47278A3886D8C), U64_C(0x7EFE1AF0572A82FC),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0xF40847980DDD6874), U64_C(0xAAE06EDBB250E67B), U64_C(0x5EE82943BF8D8E0F),
+        U64_C(0x17303C5CCD4BFA65), U64_C(0xE3387BC4C0969211), U64_C(0xBDD052877F1B1C1E), U64_C(0x49D8151F72C6746A),
+        U64_C(0x2E6078B99A97F4CA), U64_C(0xDA683F21974A9CBE), U64_C(0x8480166228C712B1), U64_C(0x708851FA251A7AC5),
+        U64_C(0x395044E557DC0EAF), U64_C(0xCD58037D5A0166DB), U64_C(0x93B02A3EE58CE8D4), U64_C(0x67B86DA6E85180A0),
+        U64_C(0x5CC0F173352FE994), U64_C(0xA8C8B6EB38F281E0), U64_C(0xF6209FA8877F0FEF), U64_C(0x0228D8308AA2679B),
+        U64_C(0x4BF0CD2FF86413F1), U64_C(0xBFF88AB7F5B97B85), U64_C(0xE110A3F44A34F58A), U64_C(0x1518E46C47E99DFE),
+        U64_C(0x72A089CAAFB81D5E), U64_C(0x86A8CE52A265752A), U64_C(0xD840E7111DE8FB25), U64_C(0x2C48A08910359351),
+        U64_C(0x6590B59662F3E73B), U64_C(0x9198F20E6F2E8F4F), U64_C(0xCF70DB4DD0A30140), U64_C(0x3B789CD5DD7E6934),
+        U64_C(0xB981E2E66A5FD328), U64_C(0x4D89A57E6782BB5C), U64_C(0x13618C3DD80F3553), U64_C(0xE769CBA5D5D25D27),
+        U64_C(0xAEB1DEBAA714294D), U64_C(0x5AB99922AAC94139), U64_C(0x0451B0611544CF36), U64_C(0xF059F7F91899A742),
+        U64_C(0x97E19A5FF0C827E2), U64_C(0x63E9DDC7FD154F96), U64_C(0x3D01F4844298C199), U64_C(0xC909B31C4F45A9ED),
+        U64_C(0x80D1A6033D83DD87), U64_C(0x74D9E19B305EB5F3), U64_C(0x2A31C8D88FD33BFC), U64_C(0xDE398F40820E5388),
+        U64_C(0xE54113955F703ABC), U64_C(0x1149540D52AD52C8), U64_C(0x4FA17D4EED20DCC7), U64_C(0xBBA93AD6E0FDB4B3),
+        U64_C(0xF2712FC9923BC0D9), U64_C(0x067968519FE6A8AD), U64_C(0x58914112206B26A2), U64_C(0xAC99068A2DB64ED6),
+        U64_C(0xCB216B2CC5E7CE76), U64_C(0x3F292CB4C83AA602), U64_C(0x61C105F777B7280D), U64_C(0x95C9426F7A6A4079),
+        U64_C(0xDC11577008AC3413), U64_C(0x281910E805715C67), U64_C(0x76F139ABBAFCD268), U64_C(0x82F97E33B721BA1C),
+        U64_C(0x31F324277D5590C3), U64_C(0xC5FB63BF7088F8B7), U64_C(0x9B134AFCCF0576B8), U64_C(0x6F1B0D64C2D81ECC),
+        U64_C(0x26C3187BB01E6AA6), U64_C(0xD2CB5FE3BDC302D2), U64_C(0x8C2376A0024E8CDD), U64_C(0x782B31380F93E4A9),
+        U64_C(0x1F935C9EE7C26409), U64_C(0xEB9B1B06EA1F0C7D), U64_C(0xB573324555928272), U64_C(0x417B75DD584FEA06),
+        U64_C(0x08A360C22A899E6C), U64_C(0xFCAB275A2754F618), U64_C(0xA2430E1998D97817), U64_C(0x564B498195041063),
+        U64_C(0x6D33D554487A7957), U64_C(0x993B92CC45A71123), U64_C(0xC7D3BB8FFA2A9F2C), U64_C(0x33DBFC17F7F7F758),
+        U64_C(0x7A03E90885318332), U64_C(0x8E0BAE9088ECEB46), U64_C(0xD0E387D337616549), U64_C(0x24EBC04B3ABC0D3D),
+        U64_C(0x4353ADEDD2ED8D9D), U64_C(0xB75BEA75DF30E5E9), U64_C(0xE9B3C33660BD6BE6), U64_C(0x1DBB84AE6D600392),
+        U64_C(0x546391B11FA677F8), U64_C(0xA06BD629127B1F8C), U64_C(0xFE83FF6AADF69183), U64_C(0x0A8BB8F2A02BF9F7),
+        U64_C(0x8872C6C1170A43EB), U64_C(0x7C7A81591AD72B9F), U64_C(0x2292A81AA55AA590), U64_C(0xD69AEF82A887CDE4),
+        U64_C(0x9F42FA9DDA41B98E), U64_C(0x6B4ABD05D79CD1FA), U64_C(0x35A2944668115FF5), U64_C(0xC1AAD3DE65CC3781),
+        U64_C(0xA612BE788D9DB721), U64_C(0x521AF9E08040DF55), U64_C(0x0CF2D0A33FCD515A), U64_C(0xF8FA973B3210392E),
+        U64_C(0xB122822440D64D44), U64_C(0x452AC5BC4D0B2530), U64_C(0x1BC2ECFFF286AB3F), U64_C(0xEFCAAB67FF5BC34B),
+        U64_C(0xD4B237B22225AA7F), U64_C(0x20BA702A2FF8C20B), U64_C(0x7E52596990754C04), U64_C(0x8A5A1EF19DA82470),
+        U64_C(0xC3820BEEEF6E501A), U64_C(0x378A4C76E2B3386E), U64_C(0x696265355D3EB661), U64_C(0x9D6A22AD50E3DE15),
+        U64_C(0xFAD24F0BB8B25EB5), U64_C(0x0EDA0893B56F36C1), U64_C(0x503221D00AE2B8CE), U64_C(0xA43A6648073FD0BA),
+        U64_C(0xEDE2735775F9A4D0), U64_C(0x19EA34CF7824CCA4), U64_C(0x47021D8CC7A942AB), U64_C(0xB30A5A14CA742ADF),
+        U64_C(0x63E6484EFAAB2186), U64_C(0x97EE0FD6F77649F2), U64_C(0xC906269548FBC7FD), U64_C(0x3D0E610D4526AF89),
+        U64_C(0x74D6741237E0DBE3), U64_C(0x80DE338A3A3DB397), U64_C(0xDE361AC985B03D98), U64_C(0x2A3E5D51886D55EC),
+        U64_C(0x4D8630F7603CD54C), U64_C(0xB98E776F6DE1BD38), U64_C(0xE7665E2CD26C3337), U64_C(0x136E19B4DFB15B43),
+        U64_C(0x5AB60CABAD772F29), U64_C(0xAEBE4B33A0AA475D), U64_C(0xF05662701F27C952), U64_C(0x045E25E812FAA126),
+        U64_C(0x3F26B93DCF84C812), U64_C(0xCB2EFEA5C259A066), U64_C(0x95C6D7E67DD42E69), U64_C(0x61CE907E7009461D),
+        U64_C(0x2816856102CF3277), U64_C(0xDC1EC2F90F125A03), U64_C(0x82F6EBBAB09FD40C), U64_C(0x76FEAC22BD42BC78),
+        U64_C(0x1146C18455133CD8), U64_C(0xE54E861C58CE54AC), U64_C(0xBBA6AF5FE743DAA3), U64_C(0x4FAEE8C7EA9EB2D7),
+        U64_C(0x0676FDD89858C6BD), U64_C(0xF27EBA409585AEC9), U64_C(0xAC9693032A0820C6), U64_C(0x589ED49B27D548B2),
+        U64_C(0xDA67AAA890F4F2AE), U64_C(0x2E6FED309D299ADA), U64_C(0x7087C47322A414D5), U64_C(0x848F83EB2F797CA1),
+        U64_C(0xCD5796F45DBF08CB), U64_C(0x395FD16C506260BF), U64_C(0x67B7F82FEFEFEEB0), U64_C(0x93BFBFB7E23286C4),
+        U64_C(0xF407D2110A630664), U64_C(0x000F958907BE6E10), U64_C(0x5EE7BCCAB833E01F), U64_C(0xAAEFFB52B5EE886B),
+        U64_C(0xE337EE4DC728FC01), U64_C(0x173FA9D5CAF59475), U64_C(0x49D7809675781A7A), U64_C(0xBDDFC70E78A5720E),
+        U64_C(0x86A75BDBA5DB1B3A), U64_C(0x72AF1C43A806734E), U64_C(0x2C473500178BFD41), U64_C(0xD84F72981A569535),
+        U64_C(0x919767876890E15F), U64_C(0x659F201F654D892B), U64_C(0x3B77095CDAC00724), U64_C(0xCF7F4EC4D71D6F50),
+        U64_C(0xA8C723623F4CEFF0), U64_C(0x5CCF64FA32918784), U64_C(0x02274DB98D1C098B), U64_C(0xF62F0A2180C161FF),
+        U64_C(0xBFF71F3EF2071595), U64_C(0x4BFF58A6FFDA7DE1), U64_C(0x151771E54057F3EE), U64_C(0xE11F367D4D8A9B9A),
+        U64_C(0x52156C6987FEB145), U64_C(0xA61D2BF18A23D931), U64_C(0xF8F502B235AE573E), U64_C(0x0CFD452A38733F4A),
+        U64_C(0x452550354AB54B20), U64_C(0xB12D17AD47682354), U64_C(0xEFC53EEEF8E5AD5B), U64_C(0x1BCD7976F538C52F),
+        U64_C(0x7C7514D01D69458F), U64_C(0x887D534810B42DFB), U64_C(0xD6957A0BAF39A3F4), U64_C(0x229D3D93A2E4CB80),
+        U64_C(0x6B45288CD022BFEA), U64_C(0x9F4D6F14DDFFD79E), U64_C(0xC1A5465762725991), U64_C(0x35AD01CF6FAF31E5),
+        U64_C(0x0ED59D1AB2D158D1), U64_C(0xFADDDA82BF0C30A5), U64_C(0xA435F3C10081BEAA), U64_C(0x503DB4590D5CD6DE),
+        U64_C(0x19E5A1467F9AA2B4), U64_C(0xEDEDE6DE7247CAC0), U64_C(0xB305CF9DCDCA44CF), U64_C(0x470D8805C0172CBB),
+        U64_C(0x20B5E5A32846AC1B), U64_C(0xD4BDA23B259BC46F), U64_C(0x8A558B789A164A60), U64_C(0x7E5DCCE097CB2214),
+        U64_C(0x3785D9FFE50D567E), U64_C(0xC38D9E67E8D03E0A), U64_C(0x9D65B724575DB005), U64_C(0x696DF0BC5A80D871),
+        U64_C(0xEB948E8FEDA1626D), U64_C(0x1F9CC917E07C0A19), U64_C(0x4174E0545FF18416), U64_C(0xB57CA7CC522CEC62),
+        U64_C(0xFCA4B2D320EA9808), U64_C(0x08ACF54B2D37F07C), U64_C(0x5644DC0892BA7E73), U64_C(0xA24C9B909F671607),
+        U64_C(0xC5F4F636773696A7), U64_C(0x31FCB1AE7AEBFED3), U64_C(0x6F1498EDC56670DC), U64_C(0x9B1CDF75C8BB18A8),
+        U64_C(0xD2C4CA6ABA7D6CC2), U64_C(0x26CC8DF2B7A004B6), U64_C(0x7824A4B1082D8AB9), U64_C(0x8C2CE32905F0E2CD),
+        U64_C(0xB7547FFCD88E8BF9), U64_C(0x435C3864D553E38D), U64_C(0x1DB411276ADE6D82), U64_C(0xE9BC56BF670305F6),
+        U64_C(0xA06443A015C5719C), U64_C(0x546C0438181819E8), U64_C(0x0A842D7BA79597E7), U64_C(0xFE8C6AE3AA48FF93),
+        U64_C(0x9934074542197F33), U64_C(0x6D3C40DD4FC41747), U64_C(0x33D4699EF0499948), U64_C(0xC7DC2E06FD94F13C),
+        U64_C(0x8E043B198F528556), U64_C(0x7A0C7C81828FED22), U64_C(0x24E455C23D02632D), U64_C(0xD0EC125A30DF0B59),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0xC7CC909DF556430C), U64_C(0xCD69C0D04346B08B), U64_C(0x0AA5504DB610F387),
+        U64_C(0xD823604B2F675785), U64_C(0x1FEFF0D6DA311489), U64_C(0x154AA09B6C21E70E), U64_C(0xD28630069977A402),
+        U64_C(0xF2B6217DF7249999), U64_C(0x357AB1E00272DA95), U64_C(0x3FDFE1ADB4622912), U64_C(0xF813713041346A1E),
+        U64_C(0x2A954136D843CE1C), U64_C(0xED59D1AB2D158D10), U64_C(0xE7FC81E69B057E97), U64_C(0x2030117B6E533D9B),
+        U64_C(0xA79CA31047A305A1), U64_C(0x6050338DB2F546AD), U64_C(0x6AF563C004E5B52A), U64_C(0xAD39F35DF1B3F626),
+        U64_C(0x7FBFC35B68C45224), U64_C(0xB87353C69D921128), U64_C(0xB2D6038B2B82E2AF), U64_C(0x751A9316DED4A1A3),
+        U64_C(0x552A826DB0879C38), U64_C(0x92E612F045D1DF34), U64_C(0x984342BDF3C12CB3), U64_C(0x5F8FD22006976FBF),
+        U64_C(0x8D09E2269FE0CBBD), U64_C(0x4AC572BB6AB688B1), U64_C(0x406022F6DCA67B36), U64_C(0x87ACB26B29F0383A),
+        U64_C(0x0DC9A7CB26AC3DD1), U64_C(0xCA053756D3FA7EDD), U64_C(0xC0A0671B65EA8D5A), U64_C(0x076CF78690BCCE56),
+        U64_C(0xD5EAC78009CB6A54), U64_C(0x1226571DFC9D2958), U64_C(0x188307504A8DDADF), U64_C(0xDF4F97CDBFDB99D3),
+        U64_C(0xFF7F86B6D188A448), U64_C(0x38B3162B24DEE744), U64_C(0x3216466692CE14C3), U64_C(0xF5DAD6FB679857CF),
+        U64_C(0x275CE6FDFEEFF3CD), U64_C(0xE09076600BB9B0C1), U64_C(0xEA35262DBDA94346), U64_C(0x2DF9B6B048FF004A),
+        U64_C(0xAA5504DB610F3870), U64_C(0x6D99944694597B7C), U64_C(0x673CC40B224988FB), U64_C(0xA0F05496D71FCBF7),
+        U64_C(0x727664904E686FF5), U64_C(0xB5BAF40DBB3E2CF9), U64_C(0xBF1FA4400D2EDF7E), U64_C(0x78D334DDF8789C72),
+        U64_C(0x58E325A6962BA1E9), U64_C(0x9F2FB53B637DE2E5), U64_C(0x958AE576D56D1162), U64_C(0x524675EB203B526E),
+        U64_C(0x80C045EDB94CF66C), U64_C(0x470CD5704C1AB560), U64_C(0x4DA9853DFA0A46E7), U64_C(0x8A6515A00F5C05EB),
+        U64_C(0x1B934F964D587BA2), U64_C(0xDC5FDF0BB80E38AE), U64_C(0xD6FA8F460E1ECB29), U64_C(0x11361FDBFB488825),
+        U64_C(0xC3B02FDD623F2C27), U64_C(0x047CBF4097696F2B), U64_C(0x0ED9EF0D21799CAC), U64_C(0xC9157F90D42FDFA0),
+        U64_C(0xE9256EEBBA7CE23B), U64_C(0x2EE9FE764F2AA137), U64_C(0x244CAE3BF93A52B0), U64_C(0xE3803EA60C6C11BC),
+        U64_C(0x31060EA0951BB5BE), U64_C(0xF6CA9E3D604DF6B2), U64_C(0xFC6FCE70D65D0535), U64_C(0x3BA35EED230B4639),
+        U64_C(0xBC0FEC860AFB7E03), U64_C(0x7BC37C1BFFAD3D0F), U64_C(0x71662C5649BDCE88), U64_C(0xB6AABCCBBCEB8D84),
+        U64_C(0x642C8CCD259C2986), U64_C(0xA3E01C50D0CA6A8A), U64_C(0xA9454C1D66DA990D), U64_C(0x6E89DC80938CDA01),
+        U64_C(0x4EB9CDFBFDDFE79A), U64_C(0x89755D660889A496), U64_C(0x83D00D2BBE995711), U64_C(0x441C9DB64BCF141D),
+        U64_C(0x969AADB0D2B8B01F), U64_C(0x51563D2D27EEF313), U64_C(0x5BF36D6091FE0094), U64_C(0x9C3FFDFD64A84398),
+        U64_C(0x165AE85D6BF44673), U64_C(0xD19678C09EA2057F), U64_C(0xDB33288D28B2F6F8), U64_C(0x1CFFB810DDE4B5F4),
+        U64_C(0xCE798816449311F6), U64_C(0x09B5188BB1C552FA), U64_C(0x031048C607D5A17D), U64_C(0xC4DCD85BF283E271),
+        U64_C(0xE4ECC9209CD0DFEA), U64_C(0x232059BD69869CE6), U64_C(0x298509F0DF966F61), U64_C(0xEE49996D2AC02C6D),
+        U64_C(0x3CCFA96BB3B7886F), U64_C(0xFB0339F646E1CB63), U64_C(0xF1A669BBF0F138E4), U64_C(0x366AF92605A77BE8),
+        U64_C(0xB1C64B4D2C5743D2), U64_C(0x760ADBD0D90100DE), U64_C(0x7CAF8B9D6F11F359), U64_C(0xBB631B009A47B055),
+        U64_C(0x69E52B0603301457), U64_C(0xAE29BB9BF666575B), U64_C(0xA48CEBD64076A4DC), U64_C(0x63407B4BB520E7D0),
+        U64_C(0x43706A30DB73DA4B), U64_C(0x84BCFAAD2E259947), U64_C(0x8E19AAE098356AC0), U64_C(0x49D53A7D6D6329CC),
+        U64_C(0x9B530A7BF4148DCE), U64_C(0x5C9F9AE60142CEC2), U64_C(0x563ACAABB7523D45), U64_C(0x91F65A3642047E49),
+        U64_C(0x37269F2C9AB0F744), U64_C(0xF0EA0FB16FE6B448), U64_C(0xFA4F5FFCD9F647CF), U64_C(0x3D83CF612CA004C3),
+        U64_C(0xEF05FF67B5D7A0C1), U64_C(0x28C96FFA4081E3CD), U64_C(0x226C3FB7F691104A), U64_C(0xE5A0AF2A03C75346),
+        U64_C(0xC590BE516D946EDD), U64_C(0x025C2ECC98C22DD1), U64_C(0x08F97E812ED2DE56), U64_C(0xCF35EE1CDB849D5A),
+        U64_C(0x1DB3DE1A42F33958), U64_C(0xDA7F4E87B7A57A54), U64_C(0xD0DA1ECA01B589D3), U64_C(0x17168E57F4E3CADF),
+        U64_C(0x90BA3C3CDD13F2E5), U64_C(0x5776ACA12845B1E9), U64_C(0x5DD3FCEC9E55426E), U64_C(0x9A1F6C716B030162),
+        U64_C(0x48995C77F274A560), U64_C(0x8F55CCEA0722E66C), U64_C(0x85F09CA7B13215EB), U64_C(0x423C0C3A446456E7),
+        U64_C(0x620C1D412A376B7C), U64_C(0xA5C08DDCDF612870), U64_C(0xAF65DD916971DBF7), U64_C(0x68A94D0C9C2798FB),
+        U64_C(0xBA2F7D0A05503CF9), U64_C(0x7DE3ED97F0067FF5), U64_C(0x7746BDDA46168C72), U64_C(0xB08A2D47B340CF7E),
+        U64_C(0x3AEF38E7BC1CCA95), U64_C(0xFD23A87A494A8999), U64_C(0xF786F837FF5A7A1E), U64_C(0x304A68AA0A0C3912),
+        U64_C(0xE2CC58AC937B9D10), U64_C(0x2500C831662DDE1C), U64_C(0x2FA5987CD03D2D9B), U64_C(0xE86908E1256B6E97),
+        U64_C(0xC859199A4B38530C), U64_C(0x0F958907BE6E1000), U64_C(0x0530D94A087EE387), U64_C(0xC2FC49D7FD28A08B),
+        U64_C(0x107A79D1645F0489), U64_C(0xD7B6E94C91094785), U64_C(0xDD13B9012719B402), U64_C(0x1ADF299CD24FF70E),
+        U64_C(0x9D739BF7FBBFCF34), U64_C(0x5ABF0B6A0EE98C38), U64_C(0x501A5B27B8F97FBF), U64_C(0x97D6CBBA4DAF3CB3),
+        U64_C(0x4550FBBCD4D898B1), U64_C(0x829C6B21218EDBBD), U64_C(0x88393B6C979E283A), U64_C(0x4FF5ABF162C86B36),
+        U64_C(0x6FC5BA8A0C9B56AD), U64_C(0xA8092A17F9CD15A1), U64_C(0xA2AC7A5A4FDDE626), U64_C(0x6560EAC7BA8BA52A),
+        U64_C(0xB7E6DAC123FC0128), U64_C(0x702A4A5CD6AA4224), U64_C(0x7A8F1A1160BAB1A3), U64_C(0xBD438A8C95ECF2AF),
+        U64_C(0x2CB5D0BAD7E88CE6), U64_C(0xEB79402722BECFEA), U64_C(0xE1DC106A94AE3C6D), U64_C(0x261080F761F87F61),
+        U64_C(0xF496B0F1F88FDB63), U64_C(0x335A206C0DD9986F), U64_C(0x39FF7021BBC96BE8), U64_C(0xFE33E0BC4E9F28E4),
+        U64_C(0xDE03F1C720CC157F), U64_C(0x19CF615AD59A5673), U64_C(0x136A3117638AA5F4), U64_C(0xD4A6A18A96DCE6F8),
+        U64_C(0x0620918C0FAB42FA), U64_C(0xC1EC0111FAFD01F6), U64_C(0xCB49515C4CEDF271), U64_C(0x0C85C1C1B9BBB17D),
+        U64_C(0x8B2973AA904B8947), U64_C(0x4CE5E337651DCA4B), U64_C(0x4640B37AD30D39CC), U64_C(0x818C23E7265B7AC0),
+        U64_C(0x530A13E1BF2CDEC2), U64_C(0x94C6837C4A7A9DCE), U64_C(0x9E63D331FC6A6E49), U64_C(0x59AF43AC093C2D45),
+        U64_C(0x799F52D7676F10DE), U64_C(0xBE53C24A923953D2), U64_C(0xB4F692072429A055), U64_C(0x733A029AD17FE359),
+        U64_C(0xA1BC329C4808475B), U64_C(0x6670A201BD5E0457), U64_C(0x6CD5F24C0B4EF7D0), U64_C(0xAB1962D1FE18B4DC),
+        U64_C(0x217C7771F144B137), U64_C(0xE6B0E7EC0412F23B), U64_C(0xEC15B7A1B20201BC), U64_C(0x2BD9273C475442B0),
+        U64_C(0xF95F173ADE23E6B2), U64_C(0x3E9387A72B75A5BE), U64_C(0x3436D7EA9D655639), U64_C(0xF3FA477768331535),
+        U64_C(0xD3CA560C066028AE), U64_C(0x1406C691F3366BA2), U64_C(0x1EA396DC45269825), U64_C(0xD96F0641B070DB29),
+        U64_C(0x0BE9364729077F2B), U64_C(0xCC25A6DADC513C27), U64_C(0xC680F6976A41CFA0), U64_C(0x014C660A9F178CAC),
+        U64_C(0x86E0D461B6E7B496), U64_C(0x412C44FC43B1F79A), U64_C(0x4B8914B1F5A1041D), U64_C(0x8C45842C00F74711),
+        U64_C(0x5EC3B42A9980E313), U64_C(0x990F24B76CD6A01F), U64_C(0x93AA74FADAC65398), U64_C(0x5466E4672F901094),
+        U64_C(0x7456F51C41C32D0F), U64_C(0xB39A6581B4956E03), U64_C(0xB93F35CC02859D84), U64_C(0x7EF3A551F7D3DE88),
+        U64_C(0xAC7595576EA47A8A), U64_C(0x6BB905CA9BF23986), U64_C(0x611C55872DE2CA01), U64_C(0xA6D0C51AD8B4890D),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x6E4D3E593561EE88), U64_C(0xDC9A7CB26AC3DD10), U64_C(0xB2D742EB5FA23398),
+        U64_C(0xFBC4188F7C6D8CB3), U64_C(0x958926D6490C623B), U64_C(0x275E643D16AE51A3), U64_C(0x49135A6423CFBF2B),
+        U64_C(0xB578D0F551312FF5), U64_C(0xDB35EEAC6450C17D), U64_C(0x69E2AC473BF2F2E5), U64_C(0x07AF921E0E931C6D),
+        U64_C(0x4EBCC87A2D5CA346), U64_C(0x20F1F623183D4DCE), U64_C(0x9226B4C8479F7E56), U64_C(0xFC6B8A9172FE90DE),
+        U64_C(0x280140010B886979), U64_C(0x464C7E583EE987F1), U64_C(0xF49B3CB3614BB469), U64_C(0x9AD602EA542A5AE1),
+        U64_C(0xD3C5588E77E5E5CA), U64_C(0xBD8866D742840B42), U64_C(0x0F5F243C1D2638DA), U64_C(0x61121A652847D652),
+        U64_C(0x9D7990F45AB9468C), U64_C(0xF334AEAD6FD8A804), U64_C(0x41E3EC46307A9B9C), U64_C(0x2FAED21F051B7514),
+        U64_C(0x66BD887B26D4CA3F), U64_C(0x08F0B62213B524B7), U64_C(0xBA27F4C94C17172F), U64_C(0xD46ACA907976F9A7),
+        U64_C(0x500280021710D2F2), U64_C(0x3E4FBE5B22713C7A), U64_C(0x8C98FCB07DD30FE2), U64_C(0xE2D5C2E948B2E16A),
+        U64_C(0xABC6988D6B7D5E41), U64_C(0xC58BA6D45E1CB0C9), U64_C(0x775CE43F01BE8351), U64_C(0x1911DA6634DF6DD9),
+        U64_C(0xE57A50F74621FD07), U64_C(0x8B376EAE7340138F), U64_C(0x39E02C452CE22017), U64_C(0x57AD121C1983CE9F),
+        U64_C(0x1EBE48783A4C71B4), U64_C(0x70F376210F2D9F3C), U64_C(0xC22434CA508FACA4), U64_C(0xAC690A9365EE422C),
+        U64_C(0x7803C0031C98BB8B), U64_C(0x164EFE5A29F95503), U64_C(0xA499BCB1765B669B), U64_C(0xCAD482E8433A8813),
+        U64_C(0x83C7D88C60F53738), U64_C(0xED8AE6D55594D9B0), U64_C(0x5F5DA43E0A36EA28), U64_C(0x31109A673F5704A0),
+        U64_C(0xCD7B10F64DA9947E), U64_C(0xA3362EAF78C87AF6), U64_C(0x11E16C44276A496E), U64_C(0x7FAC521D120BA7E6),
+        U64_C(0x36BF087931C418CD), U64_C(0x58F2362004A5F645), U64_C(0xEA2574CB5B07C5DD), U64_C(0x84684A926E662B55),
+        U64_C(0xA00500042E21A5E4), U64_C(0xCE483E5D1B404B6C), U64_C(0x7C9F7CB644E278F4), U64_C(0x12D242EF7183967C),
+        U64_C(0x5BC1188B524C2957), U64_C(0x358C26D2672DC7DF), U64_C(0x875B6439388FF447), U64_C(0xE9165A600DEE1ACF),
+        U64_C(0x157DD0F17F108A11), U64_C(0x7B30EEA84A716499), U64_C(0xC9E7AC4315D35701), U64_C(0xA7AA921A20B2B989),
+        U64_C(0xEEB9C87E037D06A2), U64_C(0x80F4F627361CE82A), U64_C(0x3223B4CC69BEDBB2), U64_C(0x5C6E8A955CDF353A),
+        U64_C(0x8804400525A9CC9D), U64_C(0xE6497E5C10C82215), U64_C(0x549E3CB74F6A118D), U64_C(0x3AD302EE7A0BFF05),
+        U64_C(0x73C0588A59C4402E), U64_C(0x1D8D66D36CA5AEA6), U64_C(0xAF5A243833079D3E), U64_C(0xC1171A61066673B6),
+        U64_C(0x3D7C90F07498E368), U64_C(0x5331AEA941F90DE0), U64_C(0xE1E6EC421E5B3E78), U64_C(0x8FABD21B2B3AD0F0),
+        U64_C(0xC6B8887F08F56FDB), U64_C(0xA8F5B6263D948153), U64_C(0x1A22F4CD6236B2CB), U64_C(0x746FCA9457575C43),
+        U64_C(0xF007800639317716), U64_C(0x9E4ABE5F0C50999E), U64_C(0x2C9DFCB453F2AA06), U64_C(0x42D0C2ED6693448E),
+        U64_C(0x0BC39889455CFBA5), U64_C(0x658EA6D0703D152D), U64_C(0xD759E43B2F9F26B5), U64_C(0xB914DA621AFEC83D),
+        U64_C(0x457F50F3680058E3), U64_C(0x2B326EAA5D61B66B), U64_C(0x99E52C4102C385F3), U64_C(0xF7A8121837A26B7B),
+        U64_C(0xBEBB487C146DD450), U64_C(0xD0F67625210C3AD8), U64_C(0x622134CE7EAE0940), U64_C(0x0C6C0A974BCFE7C8),
+        U64_C(0xD806C00732B91E6F), U64_C(0xB64BFE5E07D8F0E7), U64_C(0x049CBCB5587AC37F), U64_C(0x6AD182EC6D1B2DF7),
+        U64_C(0x23C2D8884ED492DC), U64_C(0x4D8FE6D17BB57C54), U64_C(0xFF58A43A24174FCC), U64_C(0x91159A631176A144),
+        U64_C(0x6D7E10F26388319A), U64_C(0x03332EAB56E9DF12), U64_C(0xB1E46C40094BEC8A), U64_C(0xDFA952193C2A0202),
+        U64_C(0x96BA087D1FE5BD29), U64_C(0xF8F736242A8453A1), U64_C(0x4A2074CF75266039), U64_C(0x246D4A9640478EB1),
+        U64_C(0x02FAE1E3F5A97D5B), U64_C(0x6CB7DFBAC0C893D3), U64_C(0xDE609D519F6AA04B), U64_C(0xB02DA308AA0B4EC3),
+        U64_C(0xF93EF96C89C4F1E8), U64_C(0x9773C735BCA51F60), U64_C(0x25A485DEE3072CF8), U64_C(0x4BE9BB87D666C270),
+        U64_C(0xB7823116A49852AE), U64_C(0xD9CF0F4F91F9BC26), U64_C(0x6B184DA4CE5B8FBE), U64_C(0x055573FDFB3A6136),
+        U64_C(0x4C462999D8F5DE1D), U64_C(0x220B17C0ED943095), U64_C(0x90DC552BB236030D), U64_C(0xFE916B728757ED85),
+        U64_C(0x2AFBA1E2FE211422), U64_C(0x44B69FBBCB40FAAA), U64_C(0xF661DD5094E2C932), U64_C(0x982CE309A18327BA),
+        U64_C(0xD13FB96D824C9891), U64_C(0xBF728734B72D7619), U64_C(0x0DA5C5DFE88F4581), U64_C(0x63E8FB86DDEEAB09),
+        U64_C(0x9F837117AF103BD7), U64_C(0xF1CE4F4E9A71D55F), U64_C(0x43190DA5C5D3E6C7), U64_C(0x2D5433FCF0B2084F),
+        U64_C(0x64476998D37DB764), U64_C(0x0A0A57C1E61C59EC), U64_C(0xB8DD152AB9BE6A74), U64_C(0xD6902B738CDF84FC),
+        U64_C(0x52F861E1E2B9AFA9), U64_C(0x3CB55FB8D7D84121), U64_C(0x8E621D53887A72B9), U64_C(0xE02F230ABD1B9C31),
+        U64_C(0xA93C796E9ED4231A), U64_C(0xC7714737ABB5CD92), U64_C(0x75A605DCF417FE0A), U64_C(0x1BEB3B85C1761082),
+        U64_C(0xE780B114B388805C), U64_C(0x89CD8F4D86E96ED4), U64_C(0x3B1ACDA6D94B5D4C), U64_C(0x5557F3FFEC2AB3C4),
+        U64_C(0x1C44A99BCFE50CEF), U64_C(0x720997C2FA84E267), U64_C(0xC0DED529A526D1FF), U64_C(0xAE93EB7090473F77),
+        U64_C(0x7AF921E0E931C6D0), U64_C(0x14B41FB9DC502858), U64_C(0xA6635D5283F21BC0), U64_C(0xC82E630BB693F548),
+        U64_C(0x813D396F955C4A63), U64_C(0xEF700736A03DA4EB), U64_C(0x5DA745DDFF9F9773), U64_C(0x33EA7B84CAFE79FB),
+        U64_C(0xCF81F115B800E925), U64_C(0xA1CCCF4C8D6107AD), U64_C(0x131B8DA7D2C33435), U64_C(0x7D56B3FEE7A2DABD),
+        U64_C(0x3445E99AC46D6596), U64_C(0x5A08D7C3F10C8B1E), U64_C(0xE8DF9528AEAEB886), U64_C(0x8692AB719BCF560E),
+        U64_C(0xA2FFE1E7DB88D8BF), U64_C(0xCCB2DFBEEEE93637), U64_C(0x7E659D55B14B05AF), U64_C(0x1028A30C842AEB27),
+        U64_C(0x593BF968A7E5540C), U64_C(0x3776C7319284BA84), U64_C(0x85A185DACD26891C), U64_C(0xEBECBB83F8476794),
+        U64_C(0x178731128AB9F74A), U64_C(0x79CA0F4BBFD819C2), U64_C(0xCB1D4DA0E07A2A5A), U64_C(0xA55073F9D51BC4D2),
+        U64_C(0xEC43299DF6D47BF9), U64_C(0x820E17C4C3B59571), U64_C(0x30D9552F9C17A6E9), U64_C(0x5E946B76A9764861),
+        U64_C(0x8AFEA1E6D000B1C6), U64_C(0xE4B39FBFE5615F4E), U64_C(0x5664DD54BAC36CD6), U64_C(0x3829E30D8FA2825E),
+        U64_C(0x713AB969AC6D3D75), U64_C(0x1F778730990CD3FD), U64_C(0xADA0C5DBC6AEE065), U64_C(0xC3EDFB82F3CF0EED),
+        U64_C(0x3F86711381319E33), U64_C(0x51CB4F4AB45070BB), U64_C(0xE31C0DA1EBF24323), U64_C(0x8D5133F8DE93ADAB),
+        U64_C(0xC442699CFD5C1280), U64_C(0xAA0F57C5C83DFC08), U64_C(0x18D8152E979FCF90), U64_C(0x76952B77A2FE2118),
+        U64_C(0xF2FD61E5CC980A4D), U64_C(0x9CB05FBCF9F9E4C5), U64_C(0x2E671D57A65BD75D), U64_C(0x402A230E933A39D5),
+        U64_C(0x0939796AB0F586FE), U64_C(0x6774473385946876), U64_C(0xD5A305D8DA365BEE), U64_C(0xBBEE3B81EF57B566),
+        U64_C(0x4785B1109DA925B8), U64_C(0x29C88F49A8C8CB30), U64_C(0x9B1FCDA2F76AF8A8), U64_C(0xF552F3FBC20B1620),
+        U64_C(0xBC41A99FE1C4A90B), U64_C(0xD20C97C6D4A54783), U64_C(0x60DBD52D8B07741B), U64_C(0x0E96EB74BE669A93),
+        U64_C(0xDAFC21E4C7106334), U64_C(0xB4B11FBDF2718DBC), U64_C(0x06665D56ADD3BE24), U64_C(0x682B630F98B250AC),
+        U64_C(0x2138396BBB7DEF87), U64_C(0x4F7507328E1C010F), U64_C(0xFDA245D9D1BE3297), U64_C(0x93EF7B80E4DFDC1F),
+        U64_C(0x6F84F11196214CC1), U64_C(0x01C9CF48A340A249), U64_C(0xB31E8DA3FCE291D1), U64_C(0xDD53B3FAC9837F59),
+        U64_C(0x9440E99EEA4CC072), U64_C(0xFA0DD7C7DF2D2EFA), U64_C(0x48DA952C808F1D62), U64_C(0x2697AB75B5EEF3EA),
+    },
+};
+
+// CRC-64/ECMA-182 folding constants
+const crc_clmul_consts CRC64_ECMA_182_CLMUL =
+{
+    .fold128 = { U64_C(0x05F5C3C7EB52FAB6), U64_C(0x4EB938A7D257740E) },
+    .fold256 = { U64_C(0x571BEE0A227EF92B), U64_C(0x44BEF2A201B5200C) },
+    .fold512 = { U64_C(0x5F6843CA540DF020), U64_C(0xDDF4B6981205B83F) },
+    .fold1024 = { U64_C(0x05CF79DEA9AC37D6), U64_C(0x001067E571D7D5C2) },
+    .fold2048 = { U64_C(0x7F52691A60DDC70D), U64_C(0x7036B0389F6A0C82) },
+};
+
+// CRC-64/XZ slicing tables (generic engine)
+const u64 CRC64_XZ_SLICE64_TABLE[8][256] =
+{
+    {
+        U64_C(0x0000000000000000), U64_C(0xB32E4CBE03A75F6F), U64_C(0xF4843657A840A05B), U64_C(0x47AA7AE9ABE7FF34),
+        U64_C(0x7BD0C384FF8F5E33), U64_C(0xC8FE8F3AFC28015C), U64_C(0x8F54F5D357CFFE68), U64_C(0x3C7AB96D5468A107),
+        U64_C(0xF7A18709FF1EBC66), U64_C(0x448FCBB7FCB9E309), U64_C(0x0325B15E575E1C3D), U64_C(0xB00BFDE054F94352),
+        U64_C(0x8C71448D0091E255), U64_C(0x3F5F08330336BD3A), U64_C(0x78F572DAA8D1420E), U64_C(0xCBDB3E64AB761D61),
+        U64_C(0x7D9BA13851336649), U64_C(0xCEB5ED8652943926), U64_C(0x891F976FF973C612), U64_C(0x3A31DBD1FAD4997D),
+        U64_C(0x064B62BCAEBC387A), U64_C(0xB5652E02AD1B6715), U64_C(0xF2CF54EB06FC9821), U64_C(0x41E11855055BC74E),
+        U64_C(0x8A3A2631AE2DDA2F), U64_C(0x39146A8FAD8A8540), U64_C(0x7EBE1066066D7A74), U64_C(0xCD905CD805CA251B),
+        U64_C(0xF1EAE5B551A2841C), U64_C(0x42C4A90B5205DB73), U64_C(0x056ED3E2F9E22447), U64_C(0xB6409F5CFA457B28),
+        U64_C(0xFB374270A266CC92), U64_C(0x48190ECEA1C193FD), U64_C(0x0FB374270A266CC9), U64_C(0xBC9D3899098133A6),
+        U64_C(0x80E781F45DE992A1), U64_C(0x33C9CD4A5E4ECDCE), U64_C(0x7463B7A3F5A932FA), U64_C(0xC74DFB1DF60E6D95),
+        U64_C(0x0C96C5795D7870F4), U64_C(0xBFB889C75EDF2F9B), U64_C(0xF812F32EF538D0AF), U64_C(0x4B3CBF90F69F8FC0),
+        U64_C(0x774606FDA2F72EC7), U64_C(0xC4684A43A15071A8), U64_C(0x83C230AA0AB78E9C), U64_C(0x30EC7C140910D1F3),
+        U64_C(0x86ACE348F355AADB), U64_C(0x3582AFF6F0F2F5B4), U64_C(0x7228D51F5B150A80), U64_C(0xC10699A158B255EF),
+        U64_C(0xFD7C20CC0CDAF4E8), U64_C(0x4E526C720F7DAB87), U64_C(0x09F8169BA49A54B3), U64_C(0xBAD65A25A73D0BDC),
+        U64_C(0x710D64410C4B16BD), U64_C(0xC22328FF0FEC49D2), U64_C(0x85895216A40BB6E6), U64_C(0x36A71EA8A7ACE989),
+        U64_C(0x0ADDA7C5F3C4488E), U64_C(0xB9F3EB7BF06317E1), U64_C(0xFE5991925B84E8D5), U64_C(0x4D77DD2C5823B7BA),
+        U64_C(0x64B62BCAEBC387A1), U64_C(0xD7986774E864D8CE), U64_C(0x90321D9D438327FA), U64_C(0x231C512340247895),
+        U64_C(0x1F66E84E144CD992), U64_C(0xAC48A4F017EB86FD), U64_C(0xEBE2DE19BC0C79C9), U64_C(0x58CC92A7BFAB26A6),
+        U64_C(0x9317ACC314DD3BC7), U64_C(0x2039E07D177A64A8), U64_C(0x67939A94BC9D9B9C), U64_C(0xD4BDD62ABF3AC4F3),
+        U64_C(0xE8C76F47EB5265F4), U64_C(0x5BE923F9E8F53A9B), U64_C(0x1C4359104312C5AF), U64_C(0xAF6D15AE40B59AC0),
+        U64_C(0x192D8AF2BAF0E1E8), U64_C(0xAA03C64CB957BE87), U64_C(0xEDA9BCA512B041B3), U64_C(0x5E87F01B11171EDC),
+        U64_C(0x62FD4976457FBFDB), U64_C(0xD1D305C846D8E0B4), U64_C(0x96797F21ED3F1F80), U64_C(0x2557339FEE9840EF),
+        U64_C(0xEE8C0DFB45EE5D8E), U64_C(0x5DA24145464902E1), U64_C(0x1A083BACEDAEFDD5), U64_C(0xA9267712EE09A2BA),
+        U64_C(0x955CCE7FBA6103BD), U64_C(0x267282C1B9C65CD2), U64_C(0x61D8F8281221A3E6), U64_C(0xD2F6B4961186FC89),
+        U64_C(0x9F8169BA49A54B33), U64_C(0x2CAF25044A02145C), U64_C(0x6B055FEDE1E5EB68), U64_C(0xD82B1353E242B407),
+        U64_C(0xE451AA3EB62A1500), U64_C(0x577FE680B58D4A6F), U64_C(0x10D59C691E6AB55B), U64_C(0xA3FBD0D71DCDEA34),
+        U64_C(0x6820EEB3B6BBF755), U64_C(0xDB0EA20DB51CA83A), U64_C(0x9CA4D8E41EFB570E), U64_C(0x2F8A945A1D5C0861),
+        U64_C(0x13F02D374934A966), U64_C(0xA0DE61894A93F609), U64_C(0xE7741B60E174093D), U64_C(0x545A57DEE2D35652),
+        U64_C(0xE21AC88218962D7A), U64_C(0x5134843C1B317215), U64_C(0x169EFED5B0D68D21), U64_C(0xA5B0B26BB371D24E),
+        U64_C(0x99CA0B06E7197349), U64_C(0x2AE447B8E4BE2C26), U64_C(0x6D4E3D514F59D312), U64_C(0xDE6071EF4CFE8C7D),
+        U64_C(0x15BB4F8BE788911C), U64_C(0xA6950335E42FCE73), U64_C(0xE13F79DC4FC83147), U64_C(0x521135624C6F6E28),
+        U64_C(0x6E6B8C0F1807CF2F), U64_C(0xDD45C0B11BA09040), U64_C(0x9AEFBA58B0476F74), U64_C(0x29C1F6E6B3E0301B),
+        U64_C(0xC96C5795D7870F42), U64_C(0x7A421B2BD420502D), U64_C(0x3DE861C27FC7AF19), U64_C(0x8EC62D7C7C60F076),
+        U64_C(0xB2BC941128085171), U64_C(0x0192D8AF2BAF0E1E), U64_C(0x4638A2468048F12A), U64_C(0xF516EEF883EFAE45),
+        U64_C(0x3ECDD09C2899B324), U64_C(0x8DE39C222B3EEC4B), U64_C(0xCA49E6CB80D9137F), U64_C(0x7967AA75837E4C10),
+        U64_C(0x451D1318D716ED17), U64_C(0xF6335FA6D4B1B278), U64_C(0xB199254F7F564D4C), U64_C(0x02B769F17CF11223),
+        U64_C(0xB4F7F6AD86B4690B), U64_C(0x07D9BA1385133664), U64_C(0x4073C0FA2EF4C950), U64_C(0xF35D8C442D53963F),
+        U64_C(0xCF273529793B3738), U64_C(0x7C0979977A9C6857), U64_C(0x3BA3037ED17B9763), U64_C(0x888D4FC0D2DCC80C),
+        U64_C(0x435671A479AAD56D), U64_C(0xF0783D1A7A0D8A02), U64_C(0xB7D247F3D1EA7536), U64_C(0x04FC0B4DD24D2A59),
+        U64_C(0x3886B22086258B5E), U64_C(0x8BA8FE9E8582D431), U64_C(0xCC0284772E652B05), U64_C(0x7F2CC8C92DC2746A),
+        U64_C(0x325B15E575E1C3D0), U64_C(0x8175595B76469CBF), U64_C(0xC6DF23B2DDA1638B), U64_C(0x75F16F0CDE063CE4),
+        U64_C(0x498BD6618A6E9DE3), U64_C(0xFAA59ADF89C9C28C), U64_C(0xBD0FE036222E3DB8), U64_C(0x0E21AC88218962D7),
+        U64_C(0xC5FA92EC8AFF7FB6), U64_C(0x76D4DE52895820D9), U64_C(0x317EA4BB22BFDFED), U64_C(0x8250E80521188082),
+        U64_C(0xBE2A516875702185), U64_C(0x0D041DD676D77EEA), U64_C(0x4AAE673FDD3081DE), U64_C(0xF9802B81DE97DEB1),
+        U64_C(0x4FC0B4DD24D2A599), U64_C(0xFCEEF8632775FAF6), U64_C(0xBB44828A8C9205C2), U64_C(0x086ACE348F355AAD),
+        U64_C(0x34107759DB5DFBAA), U64_C(0x873E3BE7D8FAA4C5), U64_C(0xC094410E731D5BF1), U64_C(0x73BA0DB070BA049E),
+        U64_C(0xB86133D4DBCC19FF), U64_C(0x0B4F7F6AD86B4690), U64_C(0x4CE50583738CB9A4), U64_C(0xFFCB493D702BE6CB),
+        U64_C(0xC3B1F050244347CC), U64_C(0x709FBCEE27E418A3), U64_C(0x3735C6078C03E797), U64_C(0x841B8AB98FA4B8F8),
+        U64_C(0xADDA7C5F3C4488E3), U64_C(0x1EF430E13FE3D78C), U64_C(0x595E4A08940428B8), U64_C(0xEA7006B697A377D7),
+        U64_C(0xD60ABFDBC3CBD6D0), U64_C(0x6524F365C06C89BF), U64_C(0x228E898C6B8B768B), U64_C(0x91A0C532682C29E4),
+        U64_C(0x5A7BFB56C35A3485), U64_C(0xE955B7E8C0FD6BEA), U64_C(0xAEFFCD016B1A94DE), U64_C(0x1DD181BF68BDCBB1),
+        U64_C(0x21AB38D23CD56AB6), U64_C(0x9285746C3F7235D9), U64_C(0xD52F0E859495CAED), U64_C(0x6601423B97329582),
+        U64_C(0xD041DD676D77EEAA), U64_C(0x636F91D96ED0B1C5), U64_C(0x24C5EB30C5374EF1), U64_C(0x97EBA78EC690119E),
+        U64_C(0xAB911EE392F8B099), U64_C(0x18BF525D915FEFF6), U64_C(0x5F1528B43AB810C2), U64_C(0xEC3B640A391F4FAD),
+        U64_C(0x27E05A6E926952CC), U64_C(0x94CE16D091CE0DA3), U64_C(0xD3646C393A29F297), U64_C(0x604A2087398EADF8),
+        U64_C(0x5C3099EA6DE60CFF), U64_C(0xEF1ED5546E415390), U64_C(0xA8B4AFBDC5A6ACA4), U64_C(0x1B9AE303C601F3CB),
+        U64_C(0x56ED3E2F9E224471), U64_C(0xE5C372919D851B1E), U64_C(0xA26908783662E42A), U64_C(0x114744C635C5BB45),
+        U64_C(0x2D3DFDAB61AD1A42), U64_C(0x9E13B115620A452D), U64_C(0xD9B9CBFCC9EDBA19), U64_C(0x6A978742CA4AE576),
+        U64_C(0xA14CB926613CF817), U64_C(0x1262F598629BA778), U64_C(0x55C88F71C97C584C), U64_C(0xE6E6C3CFCADB0723),
+        U64_C(0xDA9C7AA29EB3A624), U64_C(0x69B2361C9D14F94B), U64_C(0x2E184CF536F3067F), U64_C(0x9D36004B35545910),
+        U64_C(0x2B769F17CF112238), U64_C(0x9858D3A9CCB67D57), U64_C(0xDFF2A94067518263), U64_C(0x6CDCE5FE64F6DD0C),
+        U64_C(0x50A65C93309E7C0B), U64_C(0xE388102D33392364), U64_C(0xA4226AC498DEDC50), U64_C(0x170C267A9B79833F),
+        U64_C(0xDCD7181E300F9E5E), U64_C(0x6FF954A033A8C131), U64_C(0x28532E49984F3E05), U64_C(0x9B7D62F79BE8616A),
+        U64_C(0xA707DB9ACF80C06D), U64_C(0x14299724CC279F02), U64_C(0x5383EDCD67C06036), U64_C(0xE0ADA17364673F59),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x54E979925CD0F10D), U64_C(0xA9D2F324B9A1E21A), U64_C(0xFD3B8AB6E5711317),
+        U64_C(0xC17D4962DC4DDAB1), U64_C(0x959430F0809D2BBC), U64_C(0x68AFBA4665EC38AB), U64_C(0x3C46C3D4393CC9A6),
+        U64_C(0x10223DEE1795ABE7), U64_C(0x44CB447C4B455AEA), U64_C(0xB9F0CECAAE3449FD), U64_C(0xED19B758F2E4B8F0),
+        U64_C(0xD15F748CCBD87156), U64_C(0x85B60D1E9708805B), U64_C(0x788D87A87279934C), U64_C(0x2C64FE3A2EA96241),
+        U64_C(0x20447BDC2F2B57CE), U64_C(0x74AD024E73FBA6C3), U64_C(0x899688F8968AB5D4), U64_C(0xDD7FF16ACA5A44D9),
+        U64_C(0xE13932BEF3668D7F), U64_C(0xB5D04B2CAFB67C72), U64_C(0x48EBC19A4AC76F65), U64_C(0x1C02B80816179E68),
+        U64_C(0x3066463238BEFC29), U64_C(0x648F3FA0646E0D24), U64_C(0x99B4B516811F1E33), U64_C(0xCD5DCC84DDCFEF3E),
+        U64_C(0xF11B0F50E4F32698), U64_C(0xA5F276C2B823D795), U64_C(0x58C9FC745D52C482), U64_C(0x0C2085E60182358F),
+        U64_C(0x4088F7B85E56AF9C), U64_C(0x14618E2A02865E91), U64_C(0xE95A049CE7F74D86), U64_C(0xBDB37D0EBB27BC8B),
+        U64_C(0x81F5BEDA821B752D), U64_C(0xD51CC748DECB8420), U64_C(0x28274DFE3BBA9737), U64_C(0x7CCE346C676A663A),
+        U64_C(0x50AACA5649C3047B), U64_C(0x0443B3C41513F576), U64_C(0xF9783972F062E661), U64_C(0xAD9140E0ACB2176C),
+        U64_C(0x91D78334958EDECA), U64_C(0xC53EFAA6C95E2FC7), U64_C(0x380570102C2F3CD0), U64_C(0x6CEC098270FFCDDD),
+        U64_C(0x60CC8C64717DF852), U64_C(0x3425F5F62DAD095F), U64_C(0xC91E7F40C8DC1A48), U64_C(0x9DF706D2940CEB45),
+        U64_C(0xA1B1C506AD3022E3), U64_C(0xF558BC94F1E0D3EE), U64_C(0x086336221491C0F9), U64_C(0x5C8A4FB0484131F4),
+        U64_C(0x70EEB18A66E853B5), U64_C(0x2407C8183A38A2B8), U64_C(0xD93C42AEDF49B1AF), U64_C(0x8DD53B3C839940A2),
+        U64_C(0xB193F8E8BAA58904), U64_C(0xE57A817AE6757809), U64_C(0x18410BCC03046B1E), U64_C(0x4CA8725E5FD49A13),
+        U64_C(0x8111EF70BCAD5F38), U64_C(0xD5F896E2E07DAE35), U64_C(0x28C31C54050CBD22), U64_C(0x7C2A65C659DC4C2F),
+        U64_C(0x406CA61260E08589), U64_C(0x1485DF803C307484), U64_C(0xE9BE5536D9416793), U64_C(0xBD572CA48591969E),
+        U64_C(0x9133D29EAB38F4DF), U64_C(0xC5DAAB0CF7E805D2), U64_C(0x38E121BA129916C5), U64_C(0x6C0858284E49E7C8),
+        U64_C(0x504E9BFC77752E6E), U64_C(0x04A7E26E2BA5DF63), U64_C(0xF99C68D8CED4CC74), U64_C(0xAD75114A92043D79),
+        U64_C(0xA15594AC938608F6), U64_C(0xF5BCED3ECF56F9FB), U64_C(0x088767882A27EAEC), U64_C(0x5C6E1E1A76F71BE1),
+        U64_C(0x6028DDCE4FCBD247), U64_C(0x34C1A45C131B234A), U64_C(0xC9FA2EEAF66A305D), U64_C(0x9D135778AABAC150),
+        U64_C(0xB177A9428413A311), U64_C(0xE59ED0D0D8C3521C), U64_C(0x18A55A663DB2410B), U64_C(0x4C4C23F46162B006),
+        U64_C(0x700AE020585E79A0), U64_C(0x24E399B2048E88AD), U64_C(0xD9D81304E1FF9BBA), U64_C(0x8D316A96BD2F6AB7),
+        U64_C(0xC19918C8E2FBF0A4), U64_C(0x9570615ABE2B01A9), U64_C(0x684BEBEC5B5A12BE), U64_C(0x3CA2927E078AE3B3),
+        U64_C(0x00E451AA3EB62A15), U64_C(0x540D28386266DB18), U64_C(0xA936A28E8717C80F), U64_C(0xFDDFDB1CDBC73902),
+        U64_C(0xD1BB2526F56E5B43), U64_C(0x85525CB4A9BEAA4E), U64_C(0x7869D6024CCFB959), U64_C(0x2C80AF90101F4854),
+        U64_C(0x10C66C44292381F2), U64_C(0x442F15D675F370FF), U64_C(0xB9149F60908263E8), U64_C(0xEDFDE6F2CC5292E5),
+        U64_C(0xE1DD6314CDD0A76A), U64_C(0xB5341A8691005667), U64_C(0x480F903074714570), U64_C(0x1CE6E9A228A1B47D),
+        U64_C(0x20A02A76119D7DDB), U64_C(0x744953E44D4D8CD6), U64_C(0x8972D952A83C9FC1), U64_C(0xDD9BA0C0F4EC6ECC),
+        U64_C(0xF1FF5EFADA450C8D), U64_C(0xA51627688695FD80), U64_C(0x582DADDE63E4EE97), U64_C(0x0CC4D44C3F341F9A),
+        U64_C(0x308217980608D63C), U64_C(0x646B6E0A5AD82731), U64_C(0x9950E4BCBFA93426), U64_C(0xCDB99D2EE379C52B),
+        U64_C(0x90FB71CAD654A0F5), U64_C(0xC41208588A8451F8), U64_C(0x392982EE6FF542EF), U64_C(0x6DC0FB7C3325B3E2),
+        U64_C(0x518638A80A197A44), U64_C(0x056F413A56C98B49), U64_C(0xF854CB8CB3B8985E), U64_C(0xACBDB21EEF686953),
+        U64_C(0x80D94C24C1C10B12), U64_C(0xD43035B69D11FA1F), U64_C(0x290BBF007860E908), U64_C(0x7DE2C69224B01805),
+        U64_C(0x41A405461D8CD1A3), U64_C(0x154D7CD4415C20AE), U64_C(0xE876F662A42D33B9), U64_C(0xBC9F8FF0F8FDC2B4),
+        U64_C(0xB0BF0A16F97FF73B), U64_C(0xE4567384A5AF0636), U64_C(0x196DF93240DE1521), U64_C(0x4D8480A01C0EE42C),
+        U64_C(0x71C2437425322D8A), U64_C(0x252B3AE679E2DC87), U64_C(0xD810B0509C93CF90), U64_C(0x8CF9C9C2C0433E9D),
+        U64_C(0xA09D37F8EEEA5CDC), U64_C(0xF4744E6AB23AADD1), U64_C(0x094FC4DC574BBEC6), U64_C(0x5DA6BD4E0B9B4FCB),
+        U64_C(0x61E07E9A32A7866D), U64_C(0x350907086E777760), U64_C(0xC8328DBE8B066477), U64_C(0x9CDBF42CD7D6957A),
+        U64_C(0xD073867288020F69), U64_C(0x849AFFE0D4D2FE64), U64_C(0x79A1755631A3ED73), U64_C(0x2D480CC46D731C7E),
+        U64_C(0x110ECF10544FD5D8), U64_C(0x45E7B682089F24D5), U64_C(0xB8DC3C34EDEE37C2), U64_C(0xEC3545A6B13EC6CF),
+        U64_C(0xC051BB9C9F97A48E), U64_C(0x94B8C20EC3475583), U64_C(0x698348B826364694), U64_C(0x3D6A312A7AE6B799),
+        U64_C(0x012CF2FE43DA7E3F), U64_C(0x55C58B6C1F0A8F32), U64_C(0xA8FE01DAFA7B9C25), U64_C(0xFC177848A6AB6D28),
+        U64_C(0xF037FDAEA72958A7), U64_C(0xA4DE843CFBF9A9AA), U64_C(0x59E50E8A1E88BABD), U64_C(0x0D0C771842584BB0),
+        U64_C(0x314AB4CC7B648216), U64_C(0x65A3CD5E27B4731B), U64_C(0x989847E8C2C5600C), U64_C(0xCC713E7A9E159101),
+        U64_C(0xE015C040B0BCF340), U64_C(0xB4FCB9D2EC6C024D), U64_C(0x49C73364091D115A), U64_C(0x1D2E4AF655CDE057),
+        U64_C(0x216889226CF129F1), U64_C(0x7581F0B03021D8FC), U64_C(0x88BA7A06D550CBEB), U64_C(0xDC53039489803AE6),
+        U64_C(0x11EA9EBA6AF9FFCD), U64_C(0x4503E72836290EC0), U64_C(0xB8386D9ED3581DD7), U64_C(0xECD1140C8F88ECDA),
+        U64_C(0xD097D7D8B6B4257C), U64_C(0x847EAE4AEA64D471), U64_C(0x794524FC0F15C766), U64_C(0x2DAC5D6E53C5366B),
+        U64_C(0x01C8A3547D6C542A), U64_C(0x5521DAC621BCA527), U64_C(0xA81A5070C4CDB630), U64_C(0xFCF329E2981D473D),
+        U64_C(0xC0B5EA36A1218E9B), U64_C(0x945C93A4FDF17F96), U64_C(0x6967191218806C81), U64_C(0x3D8E608044509D8C),
+        U64_C(0x31AEE56645D2A803), U64_C(0x65479CF41902590E), U64_C(0x987C1642FC734A19), U64_C(0xCC956FD0A0A3BB14),
+        U64_C(0xF0D3AC04999F72B2), U64_C(0xA43AD596C54F83BF), U64_C(0x59015F20203E90A8), U64_C(0x0DE826B27CEE61A5),
+        U64_C(0x218CD888524703E4), U64_C(0x7565A11A0E97F2E9), U64_C(0x885E2BACEBE6E1FE), U64_C(0xDCB7523EB73610F3),
+        U64_C(0xE0F191EA8E0AD955), U64_C(0xB418E878D2DA2858), U64_C(0x492362CE37AB3B4F), U64_C(0x1DCA1B5C6B7BCA42),
+        U64_C(0x5162690234AF5051), U64_C(0x058B1090687FA15C), U64_C(0xF8B09A268D0EB24B), U64_C(0xAC59E3B4D1DE4346),
+        U64_C(0x901F2060E8E28AE0), U64_C(0xC4F659F2B4327BED), U64_C(0x39CDD344514368FA), U64_C(0x6D24AAD60D9399F7),
+        U64_C(0x414054EC233AFBB6), U64_C(0x15A92D7E7FEA0ABB), U64_C(0xE892A7C89A9B19AC), U64_C(0xBC7BDE5AC64BE8A1),
+        U64_C(0x803D1D8EFF772107), U64_C(0xD4D4641CA3A7D00A), U64_C(0x29EFEEAA46D6C31D), U64_C(0x7D0697381A063210),
+        U64_C(0x712612DE1B84079F), U64_C(0x25CF6B4C4754F692), U64_C(0xD8F4E1FAA225E585), U64_C(0x8C1D9868FEF51488),
+        U64_C(0xB05B5BBCC7C9DD2E), U64_C(0xE4B2222E9B192C23), U64_C(0x1989A8987E683F34), U64_C(0x4D60D10A22B8CE39),
+        U64_C(0x61042F300C11AC78), U64_C(0x35ED56A250C15D75), U64_C(0xC8D6DC14B5B04E62), U64_C(0x9C3FA586E960BF6F),
+        U64_C(0xA0796652D05C76C9), U64_C(0xF4901FC08C8C87C4), U64_C(0x09AB957669FD94D3), U64_C(0x5D42ECE4352D65DE),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x3F0BE14A916A6DCB), U64_C(0x7E17C29522D4DB96), U64_C(0x411C23DFB3BEB65D),
+        U64_C(0xFC2F852A45A9B72C), U64_C(0xC3246460D4C3DAE7), U64_C(0x823847BF677D6CBA), U64_C(0xBD33A6F5F6170171),
+        U64_C(0x6A87A57F245D70DD), U64_C(0x558C4435B5371D16), U64_C(0x149067EA0689AB4B), U64_C(0x2B9B86A097E3C680),
+        U64_C(0x96A8205561F4C7F1), U64_C(0xA9A3C11FF09EAA3A), U64_C(0xE8BFE2C043201C67), U64_C(0xD7B4038AD24A71AC),
+        U64_C(0xD50F4AFE48BAE1BA), U64_C(0xEA04ABB4D9D08C71), U64_C(0xAB18886B6A6E3A2C), U64_C(0x94136921FB0457E7),
+        U64_C(0x2920CFD40D135696), U64_C(0x162B2E9E9C793B5D), U64_C(0x57370D412FC78D00), U64_C(0x683CEC0BBEADE0CB),
+        U64_C(0xBF88EF816CE79167), U64_C(0x80830ECBFD8DFCAC), U64_C(0xC19F2D144E334AF1), U64_C(0xFE94CC5EDF59273A),
+        U64_C(0x43A76AAB294E264B), U64_C(0x7CAC8BE1B8244B80), U64_C(0x3DB0A83E0B9AFDDD), U64_C(0x02BB49749AF09016),
+        U64_C(0x38C63AD73E7BDDF1), U64_C(0x07CDDB9DAF11B03A), U64_C(0x46D1F8421CAF0667), U64_C(0x79DA19088DC56BAC),
+        U64_C(0xC4E9BFFD7BD26ADD), U64_C(0xFBE25EB7EAB80716), U64_C(0xBAFE7D685906B14B), U64_C(0x85F59C22C86CDC80),
+        U64_C(0x52419FA81A26AD2C), U64_C(0x6D4A7EE28B4CC0E7), U64_C(0x2C565D3D38F276BA), U64_C(0x135DBC77A9981B71),
+        U64_C(0xAE6E1A825F8F1A00), U64_C(0x9165FBC8CEE577CB), U64_C(0xD079D8177D5BC196), U64_C(0xEF72395DEC31AC5D),
+        U64_C(0xEDC9702976C13C4B), U64_C(0xD2C29163E7AB5180), U64_C(0x93DEB2BC5415E7DD), U64_C(0xACD553F6C57F8A16),
+        U64_C(0x11E6F50333688B67), U64_C(0x2EED1449A202E6AC), U64_C(0x6FF1379611BC50F1), U64_C(0x50FAD6DC80D63D3A),
+        U64_C(0x874ED556529C4C96), U64_C(0xB845341CC3F6215D), U64_C(0xF95917C370489700), U64_C(0xC652F689E122FACB),
+        U64_C(0x7B61507C1735FBBA), U64_C(0x446AB136865F9671), U64_C(0x057692E935E1202C), U64_C(0x3A7D73A3A48B4DE7),
+        U64_C(0x718C75AE7CF7BBE2), U64_C(0x4E8794E4ED9DD629), U64_C(0x0F9BB73B5E236074), U64_C(0x30905671CF490DBF),
+        U64_C(0x8DA3F084395E0CCE), U64_C(0xB2A811CEA8346105), U64_C(0xF3B432111B8AD758), U64_C(0xCCBFD35B8AE0BA93),
+        U64_C(0x1B0BD0D158AACB3F), U64_C(0x2400319BC9C0A6F4), U64_C(0x651C12447A7E10A9), U64_C(0x5A17F30EEB147D62),
+        U64_C(0xE72455FB1D037C13), U64_C(0xD82FB4B18C6911D8), U64_C(0x9933976E3FD7A785), U64_C(0xA6387624AEBDCA4E),
+        U64_C(0xA4833F50344D5A58), U64_C(0x9B88DE1AA5273793), U64_C(0xDA94FDC5169981CE), U64_C(0xE59F1C8F87F3EC05),
+        U64_C(0x58ACBA7A71E4ED74), U64_C(0x67A75B30E08E80BF), U64_C(0x26BB78EF533036E2), U64_C(0x19B099A5C25A5B29),
+        U64_C(0xCE049A2F10102A85), U64_C(0xF10F7B65817A474E), U64_C(0xB01358BA32C4F113), U64_C(0x8F18B9F0A3AE9CD8),
+        U64_C(0x322B1F0555B99DA9), U64_C(0x0D20FE4FC4D3F062), U64_C(0x4C3CDD90776D463F), U64_C(0x73373CDAE6072BF4),
+        U64_C(0x494A4F79428C6613), U64_C(0x7641AE33D3E60BD8), U64_C(0x375D8DEC6058BD85), U64_C(0x08566CA6F132D04E),
+        U64_C(0xB565CA530725D13F), U64_C(0x8A6E2B19964FBCF4), U64_C(0xCB7208C625F10AA9), U64_C(0xF479E98CB49B6762),
+        U64_C(0x23CDEA0666D116CE), U64_C(0x1CC60B4CF7BB7B05), U64_C(0x5DDA28934405CD58), U64_C(0x62D1C9D9D56FA093),
+        U64_C(0xDFE26F2C2378A1E2), U64_C(0xE0E98E66B212CC29), U64_C(0xA1F5ADB901AC7A74), U64_C(0x9EFE4CF390C617BF),
+        U64_C(0x9C4505870A3687A9), U64_C(0xA34EE4CD9B5CEA62), U64_C(0xE252C71228E25C3F), U64_C(0xDD592658B98831F4),
+        U64_C(0x606A80AD4F9F3085), U64_C(0x5F6161E7DEF55D4E), U64_C(0x1E7D42386D4BEB13), U64_C(0x2176A372FC2186D8),
+        U64_C(0xF6C2A0F82E6BF774), U64_C(0xC9C941B2BF019ABF), U64_C(0x88D5626D0CBF2CE2), U64_C(0xB7DE83279DD54129),
+        U64_C(0x0AED25D26BC24058), U64_C(0x35E6C498FAA82D93), U64_C(0x74FAE74749169BCE), U64_C(0x4BF1060DD87CF605),
+        U64_C(0xE318EB5CF9EF77C4), U64_C(0xDC130A1668851A0F), U64_C(0x9D0F29C9DB3BAC52), U64_C(0xA204C8834A51C199),
+        U64_C(0x1F376E76BC46C0E8), U64_C(0x203C8F3C2D2CAD23), U64_C(0x6120ACE39E921B7E), U64_C(0x5E2B4DA90FF876B5),
+        U64_C(0x899F4E23DDB20719), U64_C(0xB694AF694CD86AD2), U64_C(0xF7888CB6FF66DC8F), U64_C(0xC8836DFC6E0CB144),
+        U64_C(0x75B0CB09981BB035), U64_C(0x4ABB2A430971DDFE), U64_C(0x0BA7099CBACF6BA3), U64_C(0x34ACE8D62BA50668),
+        U64_C(0x3617A1A2B155967E), U64_C(0x091C40E8203FFBB5), U64_C(0x4800633793814DE8), U64_C(0x770B827D02EB2023),
+        U64_C(0xCA382488F4FC2152), U64_C(0xF533C5C265964C99), U64_C(0xB42FE61DD628FAC4), U64_C(0x8B2407574742970F),
+        U64_C(0x5C9004DD9508E6A3), U64_C(0x639BE59704628B68), U64_C(0x2287C648B7DC3D35), U64_C(0x1D8C270226B650FE),
+        U64_C(0xA0BF81F7D0A1518F), U64_C(0x9FB460BD41CB3C44), U64_C(0xDEA84362F2758A19), U64_C(0xE1A3A228631FE7D2),
+        U64_C(0xDBDED18BC794AA35), U64_C(0xE4D530C156FEC7FE), U64_C(0xA5C9131EE54071A3), U64_C(0x9AC2F254742A1C68),
+        U64_C(0x27F154A1823D1D19), U64_C(0x18FAB5EB135770D2), U64_C(0x59E69634A0E9C68F), U64_C(0x66ED777E3183AB44),
+        U64_C(0xB15974F4E3C9DAE8), U64_C(0x8E5295BE72A3B723), U64_C(0xCF4EB661C11D017E), U64_C(0xF045572B50776CB5),
+        U64_C(0x4D76F1DEA6606DC4), U64_C(0x727D1094370A000F), U64_C(0x3361334B84B4B652), U64_C(0x0C6AD20115DEDB99),
+        U64_C(0x0ED19B758F2E4B8F), U64_C(0x31DA7A3F1E442644), U64_C(0x70C659E0ADFA9019), U64_C(0x4FCDB8AA3C90FDD2),
+        U64_C(0xF2FE1E5FCA87FCA3), U64_C(0xCDF5FF155BED9168), U64_C(0x8CE9DCCAE8532735), U64_C(0xB3E23D8079394AFE),
+        U64_C(0x64563E0AAB733B52), U64_C(0x5B5DDF403A195699), U64_C(0x1A41FC9F89A7E0C4), U64_C(0x254A1DD518CD8D0F),
+        U64_C(0x9879BB20EEDA8C7E), U64_C(0xA7725A6A7FB0E1B5), U64_C(0xE66E79B5CC0E57E8), U64_C(0xD96598FF5D643A23),
+        U64_C(0x92949EF28518CC26), U64_C(0xAD9F7FB81472A1ED), U64_C(0xEC835C67A7CC17B0), U64_C(0xD388BD2D36A67A7B),
+        U64_C(0x6EBB1BD8C0B17B0A), U64_C(0x51B0FA9251DB16C1), U64_C(0x10ACD94DE265A09C), U64_C(0x2FA73807730FCD57),
+        U64_C(0xF8133B8DA145BCFB), U64_C(0xC718DAC7302FD130), U64_C(0x8604F9188391676D), U64_C(0xB90F185212FB0AA6),
+        U64_C(0x043CBEA7E4EC0BD7), U64_C(0x3B375FED7586661C), U64_C(0x7A2B7C32C638D041), U64_C(0x45209D785752BD8A),
+        U64_C(0x479BD40CCDA22D9C), U64_C(0x789035465CC84057), U64_C(0x398C1699EF76F60A), U64_C(0x0687F7D37E1C9BC1),
+        U64_C(0xBBB45126880B9AB0), U64_C(0x84BFB06C1961F77B), U64_C(0xC5A393B3AADF4126), U64_C(0xFAA872F93BB52CED),
+        U64_C(0x2D1C7173E9FF5D41), U64_C(0x121790397895308A), U64_C(0x530BB3E6CB2B86D7), U64_C(0x6C0052AC5A41EB1C),
+        U64_C(0xD133F459AC56EA6D), U64_C(0xEE3815133D3C87A6), U64_C(0xAF2436CC8E8231FB), U64_C(0x902FD7861FE85C30),
+        U64_C(0xAA52A425BB6311D7), U64_C(0x9559456F2A097C1C), U64_C(0xD44566B099B7CA41), U64_C(0xEB4E87FA08DDA78A),
+        U64_C(0x567D210FFECAA6FB), U64_C(0x6976C0456FA0CB30), U64_C(0x286AE39ADC1E7D6D), U64_C(0x176102D04D7410A6),
+        U64_C(0xC0D5015A9F3E610A), U64_C(0xFFDEE0100E540CC1), U64_C(0xBEC2C3CFBDEABA9C), U64_C(0x81C922852C80D757),
+        U64_C(0x3CFA8470DA97D626), U64_C(0x03F1653A4BFDBBED), U64_C(0x42ED46E5F8430DB0), U64_C(0x7DE6A7AF6929607B),
+        U64_C(0x7F5DEEDBF3D9F06D), U64_C(0x40560F9162B39DA6), U64_C(0x014A2C4ED10D2BFB), U64_C(0x3E41CD0440674630),
+        U64_C(0x83726BF1B6704741), U64_C(0xBC798ABB271A2A8A), U64_C(0xFD65A96494A49CD7), U64_C(0xC26E482E05CEF11C),
+        U64_C(0x15DA4BA4D78480B0), U64_C(0x2AD1AAEE46EEED7B), U64_C(0x6BCD8931F5505B26), U64_C(0x54C6687B643A36ED),
+        U64_C(0xE9F5CE8E922D379C), U64_C(0xD6FE2FC403475A57), U64_C(0x97E20C1BB0F9EC0A), U64_C(0xA8E9ED51219381C1),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x1DEE8A5E222CA1DC), U64_C(0x3BDD14BC445943B8), U64_C(0x26339EE26675E264),
+        U64_C(0x77BA297888B28770), U64_C(0x6A54A326AA9E26AC), U64_C(0x4C673DC4CCEBC4C8), U64_C(0x5189B79AEEC76514),
+        U64_C(0xEF7452F111650EE0), U64_C(0xF29AD8AF3349AF3C), U64_C(0xD4A9464D553C4D58), U64_C(0xC947CC137710EC84),
+        U64_C(0x98CE7B8999D78990), U64_C(0x8520F1D7BBFB284C), U64_C(0xA3136F35DD8ECA28), U64_C(0xBEFDE56BFFA26BF4),
+        U64_C(0x4C300AC98DC40345), U64_C(0x51DE8097AFE8A299), U64_C(0x77ED1E75C99D40FD), U64_C(0x6A03942BEBB1E121),
+        U64_C(0x3B8A23B105768435), U64_C(0x2664A9EF275A25E9), U64_C(0x0057370D412FC78D), U64_C(0x1DB9BD5363036651),
+        U64_C(0xA34458389CA10DA5), U64_C(0xBEAAD266BE8DAC79), U64_C(0x98994C84D8F84E1D), U64_C(0x8577C6DAFAD4EFC1),
+        U64_C(0xD4FE714014138AD5), U64_C(0xC910FB1E363F2B09), U64_C(0xEF2365FC504AC96D), U64_C(0xF2CDEFA2726668B1),
+        U64_C(0x986015931B88068A), U64_C(0x858E9FCD39A4A756), U64_C(0xA3BD012F5FD14532), U64_C(0xBE538B717DFDE4EE),
+        U64_C(0xEFDA3CEB933A81FA), U64_C(0xF234B6B5B1162026), U64_C(0xD4072857D763C242), U64_C(0xC9E9A209F54F639E),
+        U64_C(0x771447620AED086A), U64_C(0x6AFACD3C28C1A9B6), U64_C(0x4CC953DE4EB44BD2), U64_C(0x5127D9806C98EA0E),
+        U64_C(0x00AE6E1A825F8F1A), U64_C(0x1D40E444A0732EC6), U64_C(0x3B737AA6C606CCA2), U64_C(0x269DF0F8E42A6D7E),
+        U64_C(0xD4501F5A964C05CF), U64_C(0xC9BE9504B460A413), U64_C(0xEF8D0BE6D2154677), U64_C(0xF26381B8F039E7AB),
+        U64_C(0xA3EA36221EFE82BF), U64_C(0xBE04BC7C3CD22363), U64_C(0x9837229E5AA7C107), U64_C(0x85D9A8C0788B60DB),
+        U64_C(0x3B244DAB87290B2F), U64_C(0x26CAC7F5A505AAF3), U64_C(0x00F95917C3704897), U64_C(0x1D17D349E15CE94B),
+        U64_C(0x4C9E64D30F9B8C5F), U64_C(0x5170EE8D2DB72D83), U64_C(0x7743706F4BC2CFE7), U64_C(0x6AADFA3169EE6E3B),
+        U64_C(0xA218840D981E1391), U64_C(0xBFF60E53BA32B24D), U64_C(0x99C590B1DC475029), U64_C(0x842B1AEFFE6BF1F5),
+        U64_C(0xD5A2AD7510AC94E1), U64_C(0xC84C272B3280353D), U64_C(0xEE7FB9C954F5D759), U64_C(0xF391339776D97685),
+        U64_C(0x4D6CD6FC897B1D71), U64_C(0x50825CA2AB57BCAD), U64_C(0x76B1C240CD225EC9), U64_C(0x6B5F481EEF0EFF15),
+        U64_C(0x3AD6FF8401C99A01), U64_C(0x273875DA23E53BDD), U64_C(0x010BEB384590D9B9), U64_C(0x1CE5616667BC7865),
+        U64_C(0xEE288EC415DA10D4), U64_C(0xF3C6049A37F6B108), U64_C(0xD5F59A785183536C), U64_C(0xC81B102673AFF2B0),
+        U64_C(0x9992A7BC9D6897A4), U64_C(0x847C2DE2BF443678), U64_C(0xA24FB300D931D41C), U64_C(0xBFA1395EFB1D75C0),
+        U64_C(0x015CDC3504BF1E34), U64_C(0x1CB2566B2693BFE8), U64_C(0x3A81C88940E65D8C), U64_C(0x276F42D762CAFC50),
+        U64_C(0x76E6F54D8C0D9944), U64_C(0x6B087F13AE213898), U64_C(0x4D3BE1F1C854DAFC), U64_C(0x50D56BAFEA787B20),
+        U64_C(0x3A78919E8396151B), U64_C(0x27961BC0A1BAB4C7), U64_C(0x01A58522C7CF56A3), U64_C(0x1C4B0F7CE5E3F77F),
+        U64_C(0x4DC2B8E60B24926B), U64_C(0x502C32B8290833B7), U64_C(0x761FAC5A4F7DD1D3), U64_C(0x6BF126046D51700F),
+        U64_C(0xD50CC36F92F31BFB), U64_C(0xC8E24931B0DFBA27), U64_C(0xEED1D7D3D6AA5843), U64_C(0xF33F5D8DF486F99F),
+        U64_C(0xA2B6EA171A419C8B), U64_C(0xBF586049386D3D57), U64_C(0x996BFEAB5E18DF33), U64_C(0x848574F57C347EEF),
+        U64_C(0x76489B570E52165E), U64_C(0x6BA611092C7EB782), U64_C(0x4D958FEB4A0B55E6), U64_C(0x507B05B56827F43A),
+        U64_C(0x01F2B22F86E0912E), U64_C(0x1C1C3871A4CC30F2), U64_C(0x3A2FA693C2B9D296), U64_C(0x27C12CCDE095734A),
+        U64_C(0x993CC9A61F3718BE), U64_C(0x84D243F83D1BB962), U64_C(0xA2E1DD1A5B6E5B06), U64_C(0xBF0F57447942FADA),
+        U64_C(0xEE86E0DE97859FCE), U64_C(0xF3686A80B5A93E12), U64_C(0xD55BF462D3DCDC76), U64_C(0xC8B57E3CF1F07DAA),
+        U64_C(0xD6E9A7309F3239A7), U64_C(0xCB072D6EBD1E987B), U64_C(0xED34B38CDB6B7A1F), U64_C(0xF0DA39D2F947DBC3),
+        U64_C(0xA1538E481780BED7), U64_C(0xBCBD041635AC1F0B), U64_C(0x9A8E9AF453D9FD6F), U64_C(0x876010AA71F55CB3),
+        U64_C(0x399DF5C18E573747), U64_C(0x24737F9FAC7B969B), U64_C(0x0240E17DCA0E74FF), U64_C(0x1FAE6B23E822D523),
+        U64_C(0x4E27DCB906E5B037), U64_C(0x53C956E724C911EB), U64_C(0x75FAC80542BCF38F), U64_C(0x6814425B60905253),
+        U64_C(0x9AD9ADF912F63AE2), U64_C(0x873727A730DA9B3E), U64_C(0xA104B94556AF795A), U64_C(0xBCEA331B7483D886),
+        U64_C(0xED6384819A44BD92), U64_C(0xF08D0EDFB8681C4E), U64_C(0xD6BE903DDE1DFE2A), U64_C(0xCB501A63FC315FF6),
+        U64_C(0x75ADFF0803933402), U64_C(0x6843755621BF95DE), U64_C(0x4E70EBB447CA77BA), U64_C(0x539E61EA65E6D666),
+        U64_C(0x0217D6708B21B372), U64_C(0x1FF95C2EA90D12AE), U64_C(0x39CAC2CCCF78F0CA), U64_C(0x24244892ED545116),
+        U64_C(0x4E89B2A384BA3F2D), U64_C(0x536738FDA6969EF1), U64_C(0x7554A61FC0E37C95), U64_C(0x68BA2C41E2CFDD49),
+        U64_C(0x39339BDB0C08B85D), U64_C(0x24DD11852E241981), U64_C(0x02EE8F674851FBE5), U64_C(0x1F0005396A7D5A39),
+        U64_C(0xA1FDE05295DF31CD), U64_C(0xBC136A0CB7F39011), U64_C(0x9A20F4EED1867275), U64_C(0x87CE7EB0F3AAD3A9),
+        U64_C(0xD647C92A1D6DB6BD), U64_C(0xCBA943743F411761), U64_C(0xED9ADD965934F505), U64_C(0xF07457C87B1854D9),
+        U64_C(0x02B9B86A097E3C68), U64_C(0x1F5732342B529DB4), U64_C(0x3964ACD64D277FD0), U64_C(0x248A26886F0BDE0C),
+        U64_C(0x7503911281CCBB18), U64_C(0x68ED1B4CA3E01AC4), U64_C(0x4EDE85AEC595F8A0), U64_C(0x53300FF0E7B9597C),
+        U64_C(0xEDCDEA9B181B3288), U64_C(0xF02360C53A379354), U64_C(0xD610FE275C427130), U64_C(0xCBFE74797E6ED0EC),
+        U64_C(0x9A77C3E390A9B5F8), U64_C(0x879949BDB2851424), U64_C(0xA1AAD75FD4F0F640), U64_C(0xBC445D01F6DC579C),
+        U64_C(0x74F1233D072C2A36), U64_C(0x691FA96325008BEA), U64_C(0x4F2C37814375698E), U64_C(0x52C2BDDF6159C852),
+        U64_C(0x034B0A458F9EAD46), U64_C(0x1EA5801BADB20C9A), U64_C(0x38961EF9CBC7EEFE), U64_C(0x257894A7E9EB4F22),
+        U64_C(0x9B8571CC164924D6), U64_C(0x866BFB923465850A), U64_C(0xA05865705210676E), U64_C(0xBDB6EF2E703CC6B2),
+        U64_C(0xEC3F58B49EFBA3A6), U64_C(0xF1D1D2EABCD7027A), U64_C(0xD7E24C08DAA2E01E), U64_C(0xCA0CC656F88E41C2),
+        U64_C(0x38C129F48AE82973), U64_C(0x252FA3AAA8C488AF), U64_C(0x031C3D48CEB16ACB), U64_C(0x1EF2B716EC9DCB17),
+        U64_C(0x4F7B008C025AAE03), U64_C(0x52958AD220760FDF), U64_C(0x74A614304603EDBB), U64_C(0x69489E6E642F4C67),
+        U64_C(0xD7B57B059B8D2793), U64_C(0xCA5BF15BB9A1864F), U64_C(0xEC686FB9DFD4642B), U64_C(0xF186E5E7FDF8C5F7),
+        U64_C(0xA00F527D133FA0E3), U64_C(0xBDE1D8233113013F), U64_C(0x9BD246C15766E35B), U64_C(0x863CCC9F754A4287),
+        U64_C(0xEC9136AE1CA42CBC), U64_C(0xF17FBCF03E888D60), U64_C(0xD74C221258FD6F04), U64_C(0xCAA2A84C7AD1CED8),
+        U64_C(0x9B2B1FD69416ABCC), U64_C(0x86C59588B63A0A10), U64_C(0xA0F60B6AD04FE874), U64_C(0xBD188134F26349A8),
+        U64_C(0x03E5645F0DC1225C), U64_C(0x1E0BEE012FED8380), U64_C(0x383870E3499861E4), U64_C(0x25D6FABD6BB4C038),
+        U64_C(0x745F4D278573A52C), U64_C(0x69B1C779A75F04F0), U64_C(0x4F82599BC12AE694), U64_C(0x526CD3C5E3064748),
+        U64_C(0xA0A13C6791602FF9), U64_C(0xBD4FB639B34C8E25), U64_C(0x9B7C28DBD5396C41), U64_C(0x8692A285F715CD9D),
+        U64_C(0xD71B151F19D2A889), U64_C(0xCAF59F413BFE0955), U64_C(0xECC601A35D8BEB31), U64_C(0xF1288BFD7FA74AED),
+        U64_C(0x4FD56E9680052119), U64_C(0x523BE4C8A22980C5), U64_C(0x74087A2AC45C62A1), U64_C(0x69E6F074E670C37D),
+        U64_C(0x386F47EE08B7A669), U64_C(0x2581CDB02A9B07B5), U64_C(0x03B253524CEEE5D1), U64_C(0x1E5CD90C6EC2440D),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x5C2D776033C4205E), U64_C(0xB85AEEC0678840BC), U64_C(0xE47799A0544C60E2),
+        U64_C(0xE26D72AB601E9FFD), U64_C(0xBE4005CB53DABFA3), U64_C(0x5A379C6B0796DF41), U64_C(0x061AEB0B3452FF1F),
+        U64_C(0x56024A7D6F33217F), U64_C(0x0A2F3D1D5CF70121), U64_C(0xEE58A4BD08BB61C3), U64_C(0xB275D3DD3B7F419D),
+        U64_C(0xB46F38D60F2DBE82), U64_C(0xE8424FB63CE99EDC), U64_C(0x0C35D61668A5FE3E), U64_C(0x5018A1765B61DE60),
+        U64_C(0xAC0494FADE6642FE), U64_C(0xF029E39AEDA262A0), U64_C(0x145E7A3AB9EE0242), U64_C(0x48730D5A8A2A221C),
+        U64_C(0x4E69E651BE78DD03), U64_C(0x124491318DBCFD5D), U64_C(0xF6330891D9F09DBF), U64_C(0xAA1E7FF1EA34BDE1),
+        U64_C(0xFA06DE87B1556381), U64_C(0xA62BA9E7829143DF), U64_C(0x425C3047D6DD233D), U64_C(0x1E714727E5190363),
+        U64_C(0x186BAC2CD14BFC7C), U64_C(0x4446DB4CE28FDC22), U64_C(0xA03142ECB6C3BCC0), U64_C(0xFC1C358C85079C9E),
+        U64_C(0xCAD186DE13C29B79), U64_C(0x96FCF1BE2006BB27), U64_C(0x728B681E744ADBC5), U64_C(0x2EA61F7E478EFB9B),
+        U64_C(0x28BCF47573DC0484), U64_C(0x74918315401824DA), U64_C(0x90E61AB514544438), U64_C(0xCCCB6DD527906466),
+        U64_C(0x9CD3CCA37CF1BA06), U64_C(0xC0FEBBC34F359A58), U64_C(0x248922631B79FABA), U64_C(0x78A4550328BDDAE4),
+        U64_C(0x7EBEBE081CEF25FB), U64_C(0x2293C9682F2B05A5), U64_C(0xC6E450C87B676547), U64_C(0x9AC927A848A34519),
+        U64_C(0x66D51224CDA4D987), U64_C(0x3AF86544FE60F9D9), U64_C(0xDE8FFCE4AA2C993B), U64_C(0x82A28B8499E8B965),
+        U64_C(0x84B8608FADBA467A), U64_C(0xD89517EF9E7E6624), U64_C(0x3CE28E4FCA3206C6), U64_C(0x60CFF92FF9F62698),
+        U64_C(0x30D75859A297F8F8), U64_C(0x6CFA2F399153D8A6), U64_C(0x888DB699C51FB844), U64_C(0xD4A0C1F9F6DB981A),
+        U64_C(0xD2BA2AF2C2896705), U64_C(0x8E975D92F14D475B), U64_C(0x6AE0C432A50127B9), U64_C(0x36CDB35296C507E7),
+        U64_C(0x077BA297888B2877), U64_C(0x5B56D5F7BB4F0829), U64_C(0xBF214C57EF0368CB), U64_C(0xE30C3B37DCC74895),
+        U64_C(0xE516D03CE895B78A), U64_C(0xB93BA75CDB5197D4), U64_C(0x5D4C3EFC8F1DF736), U64_C(0x0161499CBCD9D768),
+        U64_C(0x5179E8EAE7B80908), U64_C(0x0D549F8AD47C2956), U64_C(0xE923062A803049B4), U64_C(0xB50E714AB3F469EA),
+        U64_C(0xB3149A4187A696F5), U64_C(0xEF39ED21B462B6AB), U64_C(0x0B4E7481E02ED649), U64_C(0x576303E1D3EAF617),
+        U64_C(0xAB7F366D56ED6A89), U64_C(0xF752410D65294AD7), U64_C(0x1325D8AD31652A35), U64_C(0x4F08AFCD02A10A6B),
+        U64_C(0x491244C636F3F574), U64_C(0x153F33A60537D52A), U64_C(0xF148AA06517BB5C8), U64_C(0xAD65DD6662BF9596),
+        U64_C(0xFD7D7C1039DE4BF6), U64_C(0xA1500B700A1A6BA8), U64_C(0x452792D05E560B4A), U64_C(0x190AE5B06D922B14),
+        U64_C(0x1F100EBB59C0D40B), U64_C(0x433D79DB6A04F455), U64_C(0xA74AE07B3E4894B7), U64_C(0xFB67971B0D8CB4E9),
+        U64_C(0xCDAA24499B49B30E), U64_C(0x91875329A88D9350), U64_C(0x75F0CA89FCC1F3B2), U64_C(0x29DDBDE9CF05D3EC),
+        U64_C(0x2FC756E2FB572CF3), U64_C(0x73EA2182C8930CAD), U64_C(0x979DB8229CDF6C4F), U64_C(0xCBB0CF42AF1B4C11),
+        U64_C(0x9BA86E34F47A9271), U64_C(0xC7851954C7BEB22F), U64_C(0x23F280F493F2D2CD), U64_C(0x7FDFF794A036F293),
+        U64_C(0x79C51C9F94640D8C), U64_C(0x25E86BFFA7A02DD2), U64_C(0xC19FF25FF3EC4D30), U64_C(0x9DB2853FC0286D6E),
+        U64_C(0x61AEB0B3452FF1F0), U64_C(0x3D83C7D376EBD1AE), U64_C(0xD9F45E7322A7B14C), U64_C(0x85D9291311639112),
+        U64_C(0x83C3C21825316E0D), U64_C(0xDFEEB57816F54E53), U64_C(0x3B992CD842B92EB1), U64_C(0x67B45BB8717D0EEF),
+        U64_C(0x37ACFACE2A1CD08F), U64_C(0x6B818DAE19D8F0D1), U64_C(0x8FF6140E4D949033), U64_C(0xD3DB636E7E50B06D),
+        U64_C(0xD5C188654A024F72), U64_C(0x89ECFF0579C66F2C), U64_C(0x6D9B66A52D8A0FCE), U64_C(0x31B611C51E4E2F90),
+        U64_C(0x0EF7452F111650EE), U64_C(0x52DA324F22D270B0), U64_C(0xB6ADABEF769E1052), U64_C(0xEA80DC8F455A300C),
+        U64_C(0xEC9A37847108CF13), U64_C(0xB0B740E442CCEF4D), U64_C(0x54C0D94416808FAF), U64_C(0x08EDAE242544AFF1),
+        U64_C(0x58F50F527E257191), U64_C(0x04D878324DE151CF), U64_C(0xE0AFE19219AD312D), U64_C(0xBC8296F22A691173),
+        U64_C(0xBA987DF91E3BEE6C), U64_C(0xE6B50A992DFFCE32), U64_C(0x02C2933979B3AED0), U64_C(0x5EEFE4594A778E8E),
+        U64_C(0xA2F3D1D5CF701210), U64_C(0xFEDEA6B5FCB4324E), U64_C(0x1AA93F15A8F852AC), U64_C(0x468448759B3C72F2),
+        U64_C(0x409EA37EAF6E8DED), U64_C(0x1CB3D41E9CAAADB3), U64_C(0xF8C44DBEC8E6CD51), U64_C(0xA4E93ADEFB22ED0F),
+        U64_C(0xF4F19BA8A043336F), U64_C(0xA8DCECC893871331), U64_C(0x4CAB7568C7CB73D3), U64_C(0x10860208F40F538D),
+        U64_C(0x169CE903C05DAC92), U64_C(0x4AB19E63F3998CCC), U64_C(0xAEC607C3A7D5EC2E), U64_C(0xF2EB70A39411CC70),
+        U64_C(0xC426C3F102D4CB97), U64_C(0x980BB4913110EBC9), U64_C(0x7C7C2D31655C8B2B), U64_C(0x20515A515698AB75),
+        U64_C(0x264BB15A62CA546A), U64_C(0x7A66C63A510E7434), U64_C(0x9E115F9A054214D6), U64_C(0xC23C28FA36863488),
+        U64_C(0x9224898C6DE7EAE8), U64_C(0xCE09FEEC5E23CAB6), U64_C(0x2A7E674C0A6FAA54), U64_C(0x7653102C39AB8A0A),
+        U64_C(0x7049FB270DF97515), U64_C(0x2C648C473E3D554B), U64_C(0xC81315E76A7135A9), U64_C(0x943E628759B515F7),
+        U64_C(0x6822570BDCB28969), U64_C(0x340F206BEF76A937), U64_C(0xD078B9CBBB3AC9D5), U64_C(0x8C55CEAB88FEE98B),
+        U64_C(0x8A4F25A0BCAC1694), U64_C(0xD66252C08F6836CA), U64_C(0x3215CB60DB245628), U64_C(0x6E38BC00E8E07676),
+        U64_C(0x3E201D76B381A816), U64_C(0x620D6A1680458848), U64_C(0x867AF3B6D409E8AA), U64_C(0xDA5784D6E7CDC8F4),
+        U64_C(0xDC4D6FDDD39F37EB), U64_C(0x806018BDE05B17B5), U64_C(0x6417811DB4177757), U64_C(0x383AF67D87D35709),
+        U64_C(0x098CE7B8999D7899), U64_C(0x55A190D8AA5958C7), U64_C(0xB1D60978FE153825), U64_C(0xEDFB7E18CDD1187B),
+        U64_C(0xEBE19513F983E764), U64_C(0xB7CCE273CA47C73A), U64_C(0x53BB7BD39E0BA7D8), U64_C(0x0F960CB3ADCF8786),
+        U64_C(0x5F8EADC5F6AE59E6), U64_C(0x03A3DAA5C56A79B8), U64_C(0xE7D443059126195A), U64_C(0xBBF93465A2E23904),
+        U64_C(0xBDE3DF6E96B0C61B), U64_C(0xE1CEA80EA574E645), U64_C(0x05B931AEF13886A7), U64_C(0x599446CEC2FCA6F9),
+        U64_C(0xA588734247FB3A67), U64_C(0xF9A50422743F1A39), U64_C(0x1DD29D8220737ADB), U64_C(0x41FFEAE213B75A85),
+        U64_C(0x47E501E927E5A59A), U64_C(0x1BC87689142185C4), U64_C(0xFFBFEF29406DE526), U64_C(0xA392984973A9C578),
+        U64_C(0xF38A393F28C81B18), U64_C(0xAFA74E5F1B0C3B46), U64_C(0x4BD0D7FF4F405BA4), U64_C(0x17FDA09F7C847BFA),
+        U64_C(0x11E74B9448D684E5), U64_C(0x4DCA3CF47B12A4BB), U64_C(0xA9BDA5542F5EC459), U64_C(0xF590D2341C9AE407),
+        U64_C(0xC35D61668A5FE3E0), U64_C(0x9F701606B99BC3BE), U64_C(0x7B078FA6EDD7A35C), U64_C(0x272AF8C6DE138302),
+        U64_C(0x213013CDEA417C1D), U64_C(0x7D1D64ADD9855C43), U64_C(0x996AFD0D8DC93CA1), U64_C(0xC5478A6DBE0D1CFF),
+        U64_C(0x955F2B1BE56CC29F), U64_C(0xC9725C7BD6A8E2C1), U64_C(0x2D05C5DB82E48223), U64_C(0x7128B2BBB120A27D),
+        U64_C(0x773259B085725D62), U64_C(0x2B1F2ED0B6B67D3C), U64_C(0xCF68B770E2FA1DDE), U64_C(0x9345C010D13E3D80),
+        U64_C(0x6F59F59C5439A11E), U64_C(0x337482FC67FD8140), U64_C(0xD7031B5C33B1E1A2), U64_C(0x8B2E6C3C0075C1FC),
+        U64_C(0x8D34873734273EE3), U64_C(0xD119F05707E31EBD), U64_C(0x356E69F753AF7E5F), U64_C(0x69431E97606B5E01),
+        U64_C(0x395BBFE13B0A8061), U64_C(0x6576C88108CEA03F), U64_C(0x810151215C82C0DD), U64_C(0xDD2C26416F46E083),
+        U64_C(0xDB36CD4A5B141F9C), U64_C(0x871BBA2A68D03FC2), U64_C(0x636C238A3C9C5F20), U64_C(0x3F4154EA0F587F7E),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x6184D55F721267C6), U64_C(0xC309AABEE424CF8C), U64_C(0xA28D7FE19636A84A),
+        U64_C(0x14CBFA566747819D), U64_C(0x754F2F091555E65B), U64_C(0xD7C250E883634E11), U64_C(0xB64685B7F17129D7),
+        U64_C(0x2997F4ACCE8F033A), U64_C(0x481321F3BC9D64FC), U64_C(0xEA9E5E122AABCCB6), U64_C(0x8B1A8B4D58B9AB70),
+        U64_C(0x3D5C0EFAA9C882A7), U64_C(0x5CD8DBA5DBDAE561), U64_C(0xFE55A4444DEC4D2B), U64_C(0x9FD1711B3FFE2AED),
+        U64_C(0x532FE9599D1E0674), U64_C(0x32AB3C06EF0C61B2), U64_C(0x902643E7793AC9F8), U64_C(0xF1A296B80B28AE3E),
+        U64_C(0x47E4130FFA5987E9), U64_C(0x2660C650884BE02F), U64_C(0x84EDB9B11E7D4865), U64_C(0xE5696CEE6C6F2FA3),
+        U64_C(0x7AB81DF55391054E), U64_C(0x1B3CC8AA21836288), U64_C(0xB9B1B74BB7B5CAC2), U64_C(0xD8356214C5A7AD04),
+        U64_C(0x6E73E7A334D684D3), U64_C(0x0FF732FC46C4E315), U64_C(0xAD7A4D1DD0F24B5F), U64_C(0xCCFE9842A2E02C99),
+        U64_C(0xA65FD2B33A3C0CE8), U64_C(0xC7DB07EC482E6B2E), U64_C(0x6556780DDE18C364), U64_C(0x04D2AD52AC0AA4A2),
+        U64_C(0xB29428E55D7B8D75), U64_C(0xD310FDBA2F69EAB3), U64_C(0x719D825BB95F42F9), U64_C(0x10195704CB4D253F),
+        U64_C(0x8FC8261FF4B30FD2), U64_C(0xEE4CF34086A16814), U64_C(0x4CC18CA11097C05E), U64_C(0x2D4559FE6285A798),
+        U64_C(0x9B03DC4993F48E4F), U64_C(0xFA870916E1E6E989), U64_C(0x580A76F777D041C3), U64_C(0x398EA3A805C22605),
+        U64_C(0xF5703BEAA7220A9C), U64_C(0x94F4EEB5D5306D5A), U64_C(0x367991544306C510), U64_C(0x57FD440B3114A2D6),
+        U64_C(0xE1BBC1BCC0658B01), U64_C(0x803F14E3B277ECC7), U64_C(0x22B26B022441448D), U64_C(0x4336BE5D5653234B),
+        U64_C(0xDCE7CF4669AD09A6), U64_C(0xBD631A191BBF6E60), U64_C(0x1FEE65F88D89C62A), U64_C(0x7E6AB0A7FF9BA1EC),
+        U64_C(0xC82C35100EEA883B), U64_C(0xA9A8E04F7CF8EFFD), U64_C(0x0B259FAEEACE47B7), U64_C(0x6AA14AF198DC2071),
+        U64_C(0xDE670A4DDB760755), U64_C(0xBFE3DF12A9646093), U64_C(0x1D6EA0F33F52C8D9), U64_C(0x7CEA75AC4D40AF1F),
+        U64_C(0xCAACF01BBC3186C8), U64_C(0xAB282544CE23E10E), U64_C(0x09A55AA558154944), U64_C(0x68218FFA2A072E82),
+        U64_C(0xF7F0FEE115F9046F), U64_C(0x96742BBE67EB63A9), U64_C(0x34F9545FF1DDCBE3), U64_C(0x557D810083CFAC25),
+        U64_C(0xE33B04B772BE85F2), U64_C(0x82BFD1E800ACE234), U64_C(0x2032AE09969A4A7E), U64_C(0x41B67B56E4882DB8),
+        U64_C(0x8D48E31446680121), U64_C(0xECCC364B347A66E7), U64_C(0x4E4149AAA24CCEAD), U64_C(0x2FC59CF5D05EA96B),
+        U64_C(0x99831942212F80BC), U64_C(0xF807CC1D533DE77A), U64_C(0x5A8AB3FCC50B4F30), U64_C(0x3B0E66A3B71928F6),
+        U64_C(0xA4DF17B888E7021B), U64_C(0xC55BC2E7FAF565DD), U64_C(0x67D6BD066CC3CD97), U64_C(0x065268591ED1AA51),
+        U64_C(0xB014EDEEEFA08386), U64_C(0xD19038B19DB2E440), U64_C(0x731D47500B844C0A), U64_C(0x1299920F79962BCC),
+        U64_C(0x7838D8FEE14A0BBD), U64_C(0x19BC0DA193586C7B), U64_C(0xBB317240056EC431), U64_C(0xDAB5A71F777CA3F7),
+        U64_C(0x6CF322A8860D8A20), U64_C(0x0D77F7F7F41FEDE6), U64_C(0xAFFA8816622945AC), U64_C(0xCE7E5D49103B226A),
+        U64_C(0x51AF2C522FC50887), U64_C(0x302BF90D5DD76F41), U64_C(0x92A686ECCBE1C70B), U64_C(0xF32253B3B9F3A0CD),
+        U64_C(0x4564D6044882891A), U64_C(0x24E0035B3A90EEDC), U64_C(0x866D7CBAACA64696), U64_C(0xE7E9A9E5DEB42150),
+        U64_C(0x2B1731A77C540DC9), U64_C(0x4A93E4F80E466A0F), U64_C(0xE81E9B199870C245), U64_C(0x899A4E46EA62A583),
+        U64_C(0x3FDCCBF11B138C54), U64_C(0x5E581EAE6901EB92), U64_C(0xFCD5614FFF3743D8), U64_C(0x9D51B4108D25241E),
+        U64_C(0x0280C50BB2DB0EF3), U64_C(0x63041054C0C96935), U64_C(0xC1896FB556FFC17F), U64_C(0xA00DBAEA24EDA6B9),
+        U64_C(0x164B3F5DD59C8F6E), U64_C(0x77CFEA02A78EE8A8), U64_C(0xD54295E331B840E2), U64_C(0xB4C640BC43AA2724),
+        U64_C(0x2E16BBB019E2102F), U64_C(0x4F926EEF6BF077E9), U64_C(0xED1F110EFDC6DFA3), U64_C(0x8C9BC4518FD4B865),
+        U64_C(0x3ADD41E67EA591B2), U64_C(0x5B5994B90CB7F674), U64_C(0xF9D4EB589A815E3E), U64_C(0x98503E07E89339F8),
+        U64_C(0x07814F1CD76D1315), U64_C(0x66059A43A57F74D3), U64_C(0xC488E5A23349DC99), U64_C(0xA50C30FD415BBB5F),
+        U64_C(0x134AB54AB02A9288), U64_C(0x72CE6015C238F54E), U64_C(0xD0431FF4540E5D04), U64_C(0xB1C7CAAB261C3AC2),
+        U64_C(0x7D3952E984FC165B), U64_C(0x1CBD87B6F6EE719D), U64_C(0xBE30F85760D8D9D7), U64_C(0xDFB42D0812CABE11),
+        U64_C(0x69F2A8BFE3BB97C6), U64_C(0x08767DE091A9F000), U64_C(0xAAFB0201079F584A), U64_C(0xCB7FD75E758D3F8C),
+        U64_C(0x54AEA6454A731561), U64_C(0x352A731A386172A7), U64_C(0x97A70CFBAE57DAED), U64_C(0xF623D9A4DC45BD2B),
+        U64_C(0x40655C132D3494FC), U64_C(0x21E1894C5F26F33A), U64_C(0x836CF6ADC9105B70), U64_C(0xE2E823F2BB023CB6),
+        U64_C(0x8849690323DE1CC7), U64_C(0xE9CDBC5C51CC7B01), U64_C(0x4B40C3BDC7FAD34B), U64_C(0x2AC416E2B5E8B48D),
+        U64_C(0x9C82935544999D5A), U64_C(0xFD06460A368BFA9C), U64_C(0x5F8B39EBA0BD52D6), U64_C(0x3E0FECB4D2AF3510),
+        U64_C(0xA1DE9DAFED511FFD), U64_C(0xC05A48F09F43783B), U64_C(0x62D737110975D071), U64_C(0x0353E24E7B67B7B7),
+        U64_C(0xB51567F98A169E60), U64_C(0xD491B2A6F804F9A6), U64_C(0x761CCD476E3251EC), U64_C(0x179818181C20362A),
+        U64_C(0xDB66805ABEC01AB3), U64_C(0xBAE25505CCD27D75), U64_C(0x186F2AE45AE4D53F), U64_C(0x79EBFFBB28F6B2F9),
+        U64_C(0xCFAD7A0CD9879B2E), U64_C(0xAE29AF53AB95FCE8), U64_C(0x0CA4D0B23DA354A2), U64_C(0x6D2005ED4FB13364),
+        U64_C(0xF2F174F6704F1989), U64_C(0x9375A1A9025D7E4F), U64_C(0x31F8DE48946BD605), U64_C(0x507C0B17E679B1C3),
+        U64_C(0xE63A8EA017089814), U64_C(0x87BE5BFF651AFFD2), U64_C(0x2533241EF32C5798), U64_C(0x44B7F141813E305E),
+        U64_C(0xF071B1FDC294177A), U64_C(0x91F564A2B08670BC), U64_C(0x33781B4326B0D8F6), U64_C(0x52FCCE1C54A2BF30),
+        U64_C(0xE4BA4BABA5D396E7), U64_C(0x853E9EF4D7C1F121), U64_C(0x27B3E11541F7596B), U64_C(0x4637344A33E53EAD),
+        U64_C(0xD9E645510C1B1440), U64_C(0xB862900E7E097386), U64_C(0x1AEFEFEFE83FDBCC), U64_C(0x7B6B3AB09A2DBC0A),
+        U64_C(0xCD2DBF076B5C95DD), U64_C(0xACA96A58194EF21B), U64_C(0x0E2415B98F785A51), U64_C(0x6FA0C0E6FD6A3D97),
+        U64_C(0xA35E58A45F8A110E), U64_C(0xC2DA8DFB2D9876C8), U64_C(0x6057F21ABBAEDE82), U64_C(0x01D32745C9BCB944),
+        U64_C(0xB795A2F238CD9093), U64_C(0xD61177AD4ADFF755), U64_C(0x749C084CDCE95F1F), U64_C(0x1518DD13AEFB38D9),
+        U64_C(0x8AC9AC0891051234), U64_C(0xEB4D7957E31775F2), U64_C(0x49C006B67521DDB8), U64_C(0x2844D3E90733BA7E),
+        U64_C(0x9E02565EF64293A9), U64_C(0xFF8683018450F46F), U64_C(0x5D0BFCE012665C25), U64_C(0x3C8F29BF60743BE3),
+        U64_C(0x562E634EF8A81B92), U64_C(0x37AAB6118ABA7C54), U64_C(0x9527C9F01C8CD41E), U64_C(0xF4A31CAF6E9EB3D8),
+        U64_C(0x42E599189FEF9A0F), U64_C(0x23614C47EDFDFDC9), U64_C(0x81EC33A67BCB5583), U64_C(0xE068E6F909D93245),
+        U64_C(0x7FB997E2362718A8), U64_C(0x1E3D42BD44357F6E), U64_C(0xBCB03D5CD203D724), U64_C(0xDD34E803A011B0E2),
+        U64_C(0x6B726DB451609935), U64_C(0x0AF6B8EB2372FEF3), U64_C(0xA87BC70AB54456B9), U64_C(0xC9FF1255C756317F),
+        U64_C(0x05018A1765B61DE6), U64_C(0x64855F4817A47A20), U64_C(0xC60820A98192D26A), U64_C(0xA78CF5F6F380B5AC),
+        U64_C(0x11CA704102F19C7B), U64_C(0x704EA51E70E3FBBD), U64_C(0xD2C3DAFFE6D553F7), U64_C(0xB3470FA094C73431),
+        U64_C(0x2C967EBBAB391EDC), U64_C(0x4D12ABE4D92B791A), U64_C(0xEF9FD4054F1DD150), U64_C(0x8E1B015A3D0FB696),
+        U64_C(0x385D84EDCC7E9F41), U64_C(0x59D951B2BE6CF887), U64_C(0xFB542E53285A50CD), U64_C(0x9AD0FB0C5A48370B),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x22EF0D5934F964EC), U64_C(0x45DE1AB269F2C9D8), U64_C(0x673117EB5D0BAD34),
+        U64_C(0x8BBC3564D3E593B0), U64_C(0xA953383DE71CF75C), U64_C(0xCE622FD6BA175A68), U64_C(0xEC8D228F8EEE3E84),
+        U64_C(0x85A0C5E208C539E5), U64_C(0xA74FC8BB3C3C5D09), U64_C(0xC07EDF506137F03D), U64_C(0xE291D20955CE94D1),
+        U64_C(0x0E1CF086DB20AA55), U64_C(0x2CF3FDDFEFD9CEB9), U64_C(0x4BC2EA34B2D2638D), U64_C(0x692DE76D862B0761),
+        U64_C(0x999924EFBE846D4F), U64_C(0xBB7629B68A7D09A3), U64_C(0xDC473E5DD776A497), U64_C(0xFEA83304E38FC07B),
+        U64_C(0x1225118B6D61FEFF), U64_C(0x30CA1CD259989A13), U64_C(0x57FB0B3904933727), U64_C(0x75140660306A53CB),
+        U64_C(0x1C39E10DB64154AA), U64_C(0x3ED6EC5482B83046), U64_C(0x59E7FBBFDFB39D72), U64_C(0x7B08F6E6EB4AF99E),
+        U64_C(0x9785D46965A4C71A), U64_C(0xB56AD930515DA3F6), U64_C(0xD25BCEDB0C560EC2), U64_C(0xF0B4C38238AF6A2E),
+        U64_C(0xA1EAE6F4D206C41B), U64_C(0x8305EBADE6FFA0F7), U64_C(0xE434FC46BBF40DC3), U64_C(0xC6DBF11F8F0D692F),
+        U64_C(0x2A56D39001E357AB), U64_C(0x08B9DEC9351A3347), U64_C(0x6F88C92268119E73), U64_C(0x4D67C47B5CE8FA9F),
+        U64_C(0x244A2316DAC3FDFE), U64_C(0x06A52E4FEE3A9912), U64_C(0x619439A4B3313426), U64_C(0x437B34FD87C850CA),
+        U64_C(0xAFF6167209266E4E), U64_C(0x8D191B2B3DDF0AA2), U64_C(0xEA280CC060D4A796), U64_C(0xC8C70199542DC37A),
+        U64_C(0x3873C21B6C82A954), U64_C(0x1A9CCF42587BCDB8), U64_C(0x7DADD8A90570608C), U64_C(0x5F42D5F031890460),
+        U64_C(0xB3CFF77FBF673AE4), U64_C(0x9120FA268B9E5E08), U64_C(0xF611EDCDD695F33C), U64_C(0xD4FEE094E26C97D0),
+        U64_C(0xBDD307F9644790B1), U64_C(0x9F3C0AA050BEF45D), U64_C(0xF80D1D4B0DB55969), U64_C(0xDAE21012394C3D85),
+        U64_C(0x366F329DB7A20301), U64_C(0x14803FC4835B67ED), U64_C(0x73B1282FDE50CAD9), U64_C(0x515E2576EAA9AE35),
+        U64_C(0xD10D62C20B0396B3), U64_C(0xF3E26F9B3FFAF25F), U64_C(0x94D3787062F15F6B), U64_C(0xB63C752956083B87),
+        U64_C(0x5AB157A6D8E60503), U64_C(0x785E5AFFEC1F61EF), U64_C(0x1F6F4D14B114CCDB), U64_C(0x3D80404D85EDA837),
+        U64_C(0x54ADA72003C6AF56), U64_C(0x7642AA79373FCBBA), U64_C(0x1173BD926A34668E), U64_C(0x339CB0CB5ECD0262),
+        U64_C(0xDF119244D0233CE6), U64_C(0xFDFE9F1DE4DA580A), U64_C(0x9ACF88F6B9D1F53E), U64_C(0xB82085AF8D2891D2),
+        U64_C(0x4894462DB587FBFC), U64_C(0x6A7B4B74817E9F10), U64_C(0x0D4A5C9FDC753224), U64_C(0x2FA551C6E88C56C8),
+        U64_C(0xC32873496662684C), U64_C(0xE1C77E10529B0CA0), U64_C(0x86F669FB0F90A194), U64_C(0xA41964A23B69C578),
+        U64_C(0xCD3483CFBD42C219), U64_C(0xEFDB8E9689BBA6F5), U64_C(0x88EA997DD4B00BC1), U64_C(0xAA059424E0496F2D),
+        U64_C(0x4688B6AB6EA751A9), U64_C(0x6467BBF25A5E3545), U64_C(0x0356AC1907559871), U64_C(0x21B9A14033ACFC9D),
+        U64_C(0x70E78436D90552A8), U64_C(0x5208896FEDFC3644), U64_C(0x35399E84B0F79B70), U64_C(0x17D693DD840EFF9C),
+        U64_C(0xFB5BB1520AE0C118), U64_C(0xD9B4BC0B3E19A5F4), U64_C(0xBE85ABE0631208C0), U64_C(0x9C6AA6B957EB6C2C),
+        U64_C(0xF54741D4D1C06B4D), U64_C(0xD7A84C8DE5390FA1), U64_C(0xB0995B66B832A295), U64_C(0x9276563F8CCBC679),
+        U64_C(0x7EFB74B00225F8FD), U64_C(0x5C1479E936DC9C11), U64_C(0x3B256E026BD73125), U64_C(0x19CA635B5F2E55C9),
+        U64_C(0xE97EA0D967813FE7), U64_C(0xCB91AD8053785B0B), U64_C(0xACA0BA6B0E73F63F), U64_C(0x8E4FB7323A8A92D3),
+        U64_C(0x62C295BDB464AC57), U64_C(0x402D98E4809DC8BB), U64_C(0x271C8F0FDD96658F), U64_C(0x05F38256E96F0163),
+        U64_C(0x6CDE653B6F440602), U64_C(0x4E3168625BBD62EE), U64_C(0x29007F8906B6CFDA), U64_C(0x0BEF72D0324FAB36),
+        U64_C(0xE762505FBCA195B2), U64_C(0xC58D5D068858F15E), U64_C(0xA2BC4AEDD5535C6A), U64_C(0x805347B4E1AA3886),
+        U64_C(0x30C26AAFB90933E3), U64_C(0x122D67F68DF0570F), U64_C(0x751C701DD0FBFA3B), U64_C(0x57F37D44E4029ED7),
+        U64_C(0xBB7E5FCB6AECA053), U64_C(0x999152925E15C4BF), U64_C(0xFEA04579031E698B), U64_C(0xDC4F482037E70D67),
+        U64_C(0xB562AF4DB1CC0A06), U64_C(0x978DA21485356EEA), U64_C(0xF0BCB5FFD83EC3DE), U64_C(0xD253B8A6ECC7A732),
+        U64_C(0x3EDE9A29622999B6), U64_C(0x1C31977056D0FD5A), U64_C(0x7B00809B0BDB506E), U64_C(0x59EF8DC23F223482),
+        U64_C(0xA95B4E40078D5EAC), U64_C(0x8BB4431933743A40), U64_C(0xEC8554F26E7F9774), U64_C(0xCE6A59AB5A86F398),
+        U64_C(0x22E77B24D468CD1C), U64_C(0x0008767DE091A9F0), U64_C(0x67396196BD9A04C4), U64_C(0x45D66CCF89636028),
+        U64_C(0x2CFB8BA20F486749), U64_C(0x0E1486FB3BB103A5), U64_C(0x6925911066BAAE91), U64_C(0x4BCA9C495243CA7D),
+        U64_C(0xA747BEC6DCADF4F9), U64_C(0x85A8B39FE8549015), U64_C(0xE299A474B55F3D21), U64_C(0xC076A92D81A659CD),
+        U64_C(0x91288C5B6B0FF7F8), U64_C(0xB3C781025FF69314), U64_C(0xD4F696E902FD3E20), U64_C(0xF6199BB036045ACC),
+        U64_C(0x1A94B93FB8EA6448), U64_C(0x387BB4668C1300A4), U64_C(0x5F4AA38DD118AD90), U64_C(0x7DA5AED4E5E1C97C),
+        U64_C(0x148849B963CACE1D), U64_C(0x366744E05733AAF1), U64_C(0x5156530B0A3807C5), U64_C(0x73B95E523EC16329),
+        U64_C(0x9F347CDDB02F5DAD), U64_C(0xBDDB718484D63941), U64_C(0xDAEA666FD9DD9475), U64_C(0xF8056B36ED24F099),
+        U64_C(0x08B1A8B4D58B9AB7), U64_C(0x2A5EA5EDE172FE5B), U64_C(0x4D6FB206BC79536F), U64_C(0x6F80BF5F88803783),
+        U64_C(0x830D9DD0066E0907), U64_C(0xA1E2908932976DEB), U64_C(0xC6D387626F9CC0DF), U64_C(0xE43C8A3B5B65A433),
+        U64_C(0x8D116D56DD4EA352), U64_C(0xAFFE600FE9B7C7BE), U64_C(0xC8CF77E4B4BC6A8A), U64_C(0xEA207ABD80450E66),
+        U64_C(0x06AD58320EAB30E2), U64_C(0x2442556B3A52540E), U64_C(0x437342806759F93A), U64_C(0x619C4FD953A09DD6),
+        U64_C(0xE1CF086DB20AA550), U64_C(0xC320053486F3C1BC), U64_C(0xA41112DFDBF86C88), U64_C(0x86FE1F86EF010864),
+        U64_C(0x6A733D0961EF36E0), U64_C(0x489C30505516520C), U64_C(0x2FAD27BB081DFF38), U64_C(0x0D422AE23CE49BD4),
+        U64_C(0x646FCD8FBACF9CB5), U64_C(0x4680C0D68E36F859), U64_C(0x21B1D73DD33D556D), U64_C(0x035EDA64E7C43181),
+        U64_C(0xEFD3F8EB692A0F05), U64_C(0xCD3CF5B25DD36BE9), U64_C(0xAA0DE25900D8C6DD), U64_C(0x88E2EF003421A231),
+        U64_C(0x78562C820C8EC81F), U64_C(0x5AB921DB3877ACF3), U64_C(0x3D883630657C01C7), U64_C(0x1F673B695185652B),
+        U64_C(0xF3EA19E6DF6B5BAF), U64_C(0xD10514BFEB923F43), U64_C(0xB6340354B6999277), U64_C(0x94DB0E0D8260F69B),
+        U64_C(0xFDF6E960044BF1FA), U64_C(0xDF19E43930B29516), U64_C(0xB828F3D26DB93822), U64_C(0x9AC7FE8B59405CCE),
+        U64_C(0x764ADC04D7AE624A), U64_C(0x54A5D15DE35706A6), U64_C(0x3394C6B6BE5CAB92), U64_C(0x117BCBEF8AA5CF7E),
+        U64_C(0x4025EE99600C614B), U64_C(0x62CAE3C054F505A7), U64_C(0x05FBF42B09FEA893), U64_C(0x2714F9723D07CC7F),
+        U64_C(0xCB99DBFDB3E9F2FB), U64_C(0xE976D6A487109617), U64_C(0x8E47C14FDA1B3B23), U64_C(0xACA8CC16EEE25FCF),
+        U64_C(0xC5852B7B68C958AE), U64_C(0xE76A26225C303C42), U64_C(0x805B31C9013B9176), U64_C(0xA2B43C9035C2F59A),
+        U64_C(0x4E391E1FBB2CCB1E), U64_C(0x6CD613468FD5AFF2), U64_C(0x0BE704ADD2DE02C6), U64_C(0x290809F4E627662A),
+        U64_C(0xD9BCCA76DE880C04), U64_C(0xFB53C72FEA7168E8), U64_C(0x9C62D0C4B77AC5DC), U64_C(0xBE8DDD9D8383A130),
+        U64_C(0x5200FF120D6D9FB4), U64_C(0x70EFF24B3994FB58), U64_C(0x17DEE5A0649F566C), U64_C(0x3531E8F950663280),
+        U64_C(0x5C1C0F94D64D35E1), U64_C(0x7EF302CDE2B4510D), U64_C(0x19C21526BFBFFC39), U64_C(0x3B2D187F8B4698D5),
+        U64_C(0xD7A03AF005A8A651), U64_C(0xF54F37A93151C2BD), U64_C(0x927E20426C5A6F89), U64_C(0xB0912D1B58A30B65),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0xDABE95AFC7875F40), U64_C(0x27A584742000A005), U64_C(0xFD1B11DBE787FF45),
+        U64_C(0x4F4B08E84001400A), U64_C(0x95F59D4787861F4A), U64_C(0x68EE8C9C6001E00F), U64_C(0xB2501933A786BF4F),
+        U64_C(0x9E9611D080028014), U64_C(0x4428847F4785DF54), U64_C(0xB93395A4A0022011), U64_C(0x638D000B67857F51),
+        U64_C(0xD1DD1938C003C01E), U64_C(0x0B638C9707849F5E), U64_C(0xF6789D4CE003601B), U64_C(0x2CC608E327843F5B),
+        U64_C(0xAFF48C8AAF0B1EAD), U64_C(0x754A1925688C41ED), U64_C(0x885108FE8F0BBEA8), U64_C(0x52EF9D51488CE1E8),
+        U64_C(0xE0BF8462EF0A5EA7), U64_C(0x3A0111CD288D01E7), U64_C(0xC71A0016CF0AFEA2), U64_C(0x1DA495B9088DA1E2),
+        U64_C(0x31629D5A2F099EB9), U64_C(0xEBDC08F5E88EC1F9), U64_C(0x16C7192E0F093EBC), U64_C(0xCC798C81C88E61FC),
+        U64_C(0x7E2995B26F08DEB3), U64_C(0xA497001DA88F81F3), U64_C(0x598C11C64F087EB6), U64_C(0x83328469888F21F6),
+        U64_C(0xCD31B63EF11823DF), U64_C(0x178F2391369F7C9F), U64_C(0xEA94324AD11883DA), U64_C(0x302AA7E5169FDC9A),
+        U64_C(0x827ABED6B11963D5), U64_C(0x58C42B79769E3C95), U64_C(0xA5DF3AA29119C3D0), U64_C(0x7F61AF0D569E9C90),
+        U64_C(0x53A7A7EE711AA3CB), U64_C(0x89193241B69DFC8B), U64_C(0x7402239A511A03CE), U64_C(0xAEBCB635969D5C8E),
+        U64_C(0x1CECAF06311BE3C1), U64_C(0xC6523AA9F69CBC81), U64_C(0x3B492B72111B43C4), U64_C(0xE1F7BEDDD69C1C84),
+        U64_C(0x62C53AB45E133D72), U64_C(0xB87BAF1B99946232), U64_C(0x4560BEC07E139D77), U64_C(0x9FDE2B6FB994C237),
+        U64_C(0x2D8E325C1E127D78), U64_C(0xF730A7F3D9952238), U64_C(0x0A2BB6283E12DD7D), U64_C(0xD0952387F995823D),
+        U64_C(0xFC532B64DE11BD66), U64_C(0x26EDBECB1996E226), U64_C(0xDBF6AF10FE111D63), U64_C(0x01483ABF39964223),
+        U64_C(0xB318238C9E10FD6C), U64_C(0x69A6B6235997A22C), U64_C(0x94BDA7F8BE105D69), U64_C(0x4E03325779970229),
+        U64_C(0x08BBC3564D3E593B), U64_C(0xD20556F98AB9067B), U64_C(0x2F1E47226D3EF93E), U64_C(0xF5A0D28DAAB9A67E),
+        U64_C(0x47F0CBBE0D3F1931), U64_C(0x9D4E5E11CAB84671), U64_C(0x60554FCA2D3FB934), U64_C(0xBAEBDA65EAB8E674),
+        U64_C(0x962DD286CD3CD92F), U64_C(0x4C9347290ABB866F), U64_C(0xB18856F2ED3C792A), U64_C(0x6B36C35D2ABB266A),
+        U64_C(0xD966DA6E8D3D9925), U64_C(0x03D84FC14ABAC665), U64_C(0xFEC35E1AAD3D3920), U64_C(0x247DCBB56ABA6660),
+        U64_C(0xA74F4FDCE2354796), U64_C(0x7DF1DA7325B218D6), U64_C(0x80EACBA8C235E793), U64_C(0x5A545E0705B2B8D3),
+        U64_C(0xE8044734A234079C), U64_C(0x32BAD29B65B358DC), U64_C(0xCFA1C3408234A799), U64_C(0x151F56EF45B3F8D9),
+        U64_C(0x39D95E0C6237C782), U64_C(0xE367CBA3A5B098C2), U64_C(0x1E7CDA7842376787), U64_C(0xC4C24FD785B038C7),
+        U64_C(0x769256E422368788), U64_C(0xAC2CC34BE5B1D8C8), U64_C(0x5137D2900236278D), U64_C(0x8B89473FC5B178CD),
+        U64_C(0xC58A7568BC267AE4), U64_C(0x1F34E0C77BA125A4), U64_C(0xE22FF11C9C26DAE1), U64_C(0x389164B35BA185A1),
+        U64_C(0x8AC17D80FC273AEE), U64_C(0x507FE82F3BA065AE), U64_C(0xAD64F9F4DC279AEB), U64_C(0x77DA6C5B1BA0C5AB),
+        U64_C(0x5B1C64B83C24FAF0), U64_C(0x81A2F117FBA3A5B0), U64_C(0x7CB9E0CC1C245AF5), U64_C(0xA6077563DBA305B5),
+        U64_C(0x14576C507C25BAFA), U64_C(0xCEE9F9FFBBA2E5BA), U64_C(0x33F2E8245C251AFF), U64_C(0xE94C7D8B9BA245BF),
+        U64_C(0x6A7EF9E2132D6449), U64_C(0xB0C06C4DD4AA3B09), U64_C(0x4DDB7D96332DC44C), U64_C(0x9765E839F4AA9B0C),
+        U64_C(0x2535F10A532C2443), U64_C(0xFF8B64A594AB7B03), U64_C(0x0290757E732C8446), U64_C(0xD82EE0D1B4ABDB06),
+        U64_C(0xF4E8E832932FE45D), U64_C(0x2E567D9D54A8BB1D), U64_C(0xD34D6C46B32F4458), U64_C(0x09F3F9E974A81B18),
+        U64_C(0xBBA3E0DAD32EA457), U64_C(0x611D757514A9FB17), U64_C(0x9C0664AEF32E0452), U64_C(0x46B8F10134A95B12),
+        U64_C(0x117786AC9A7CB276), U64_C(0xCBC913035DFBED36), U64_C(0x36D202D8BA7C1273), U64_C(0xEC6C97777DFB4D33),
+        U64_C(0x5E3C8E44DA7DF27C), U64_C(0x84821BEB1DFAAD3C), U64_C(0x79990A30FA7D5279), U64_C(0xA3279F9F3DFA0D39),
+        U64_C(0x8FE1977C1A7E3262), U64_C(0x555F02D3DDF96D22), U64_C(0xA84413083A7E9267), U64_C(0x72FA86A7FDF9CD27),
+        U64_C(0xC0AA9F945A7F7268), U64_C(0x1A140A3B9DF82D28), U64_C(0xE70F1BE07A7FD26D), U64_C(0x3DB18E4FBDF88D2D),
+        U64_C(0xBE830A263577ACDB), U64_C(0x643D9F89F2F0F39B), U64_C(0x99268E5215770CDE), U64_C(0x43981BFDD2F0539E),
+        U64_C(0xF1C802CE7576ECD1), U64_C(0x2B769761B2F1B391), U64_C(0xD66D86BA55764CD4), U64_C(0x0CD3131592F11394),
+        U64_C(0x20151BF6B5752CCF), U64_C(0xFAAB8E5972F2738F), U64_C(0x07B09F8295758CCA), U64_C(0xDD0E0A2D52F2D38A),
+        U64_C(0x6F5E131EF5746CC5), U64_C(0xB5E086B132F33385), U64_C(0x48FB976AD574CCC0), U64_C(0x924502C512F39380),
+        U64_C(0xDC4630926B6491A9), U64_C(0x06F8A53DACE3CEE9), U64_C(0xFBE3B4E64B6431AC), U64_C(0x215D21498CE36EEC),
+        U64_C(0x930D387A2B65D1A3), U64_C(0x49B3ADD5ECE28EE3), U64_C(0xB4A8BC0E0B6571A6), U64_C(0x6E1629A1CCE22EE6),
+        U64_C(0x42D02142EB6611BD), U64_C(0x986EB4ED2CE14EFD), U64_C(0x6575A536CB66B1B8), U64_C(0xBFCB30990CE1EEF8),
+        U64_C(0x0D9B29AAAB6751B7), U64_C(0xD725BC056CE00EF7), U64_C(0x2A3EADDE8B67F1B2), U64_C(0xF08038714CE0AEF2),
+        U64_C(0x73B2BC18C46F8F04), U64_C(0xA90C29B703E8D044), U64_C(0x5417386CE46F2F01), U64_C(0x8EA9ADC323E87041),
+        U64_C(0x3CF9B4F0846ECF0E), U64_C(0xE647215F43E9904E), U64_C(0x1B5C3084A46E6F0B), U64_C(0xC1E2A52B63E9304B),
+        U64_C(0xED24ADC8446D0F10), U64_C(0x379A386783EA5050), U64_C(0xCA8129BC646DAF15), U64_C(0x103FBC13A3EAF055),
+        U64_C(0xA26FA520046C4F1A), U64_C(0x78D1308FC3EB105A), U64_C(0x85CA2154246CEF1F), U64_C(0x5F74B4FBE3EBB05F),
+        U64_C(0x19CC45FAD742EB4D), U64_C(0xC372D05510C5B40D), U64_C(0x3E69C18EF7424B48), U64_C(0xE4D7542130C51408),
+        U64_C(0x56874D129743AB47), U64_C(0x8C39D8BD50C4F407), U64_C(0x7122C966B7430B42), U64_C(0xAB9C5CC970C45402),
+        U64_C(0x875A542A57406B59), U64_C(0x5DE4C18590C73419), U64_C(0xA0FFD05E7740CB5C), U64_C(0x7A4145F1B0C7941C),
+        U64_C(0xC8115CC217412B53), U64_C(0x12AFC96DD0C67413), U64_C(0xEFB4D8B637418B56), U64_C(0x350A4D19F0C6D416),
+        U64_C(0xB638C9707849F5E0), U64_C(0x6C865CDFBFCEAAA0), U64_C(0x919D4D04584955E5), U64_C(0x4B23D8AB9FCE0AA5),
+        U64_C(0xF973C1983848B5EA), U64_C(0x23CD5437FFCFEAAA), U64_C(0xDED645EC184815EF), U64_C(0x0468D043DFCF4AAF),
+        U64_C(0x28AED8A0F84B75F4), U64_C(0xF2104D0F3FCC2AB4), U64_C(0x0F0B5CD4D84BD5F1), U64_C(0xD5B5C97B1FCC8AB1),
+        U64_C(0x67E5D048B84A35FE), U64_C(0xBD5B45E77FCD6ABE), U64_C(0x4040543C984A95FB), U64_C(0x9AFEC1935FCDCABB),
+        U64_C(0xD4FDF3C4265AC892), U64_C(0x0E43666BE1DD97D2), U64_C(0xF35877B0065A6897), U64_C(0x29E6E21FC1DD37D7),
+        U64_C(0x9BB6FB2C665B8898), U64_C(0x41086E83A1DCD7D8), U64_C(0xBC137F58465B289D), U64_C(0x66ADEAF781DC77DD),
+        U64_C(0x4A6BE214A6584886), U64_C(0x90D577BB61DF17C6), U64_C(0x6DCE66608658E883), U64_C(0xB770F3CF41DFB7C3),
+        U64_C(0x0520EAFCE659088C), U64_C(0xDF9E7F5321DE57CC), U64_C(0x22856E88C659A889), U64_C(0xF83BFB2701DEF7C9),
+        U64_C(0x7B097F4E8951D63F), U64_C(0xA1B7EAE14ED6897F), U64_C(0x5CACFB3AA951763A), U64_C(0x86126E956ED6297A),
+        U64_C(0x344277A6C9509635), U64_C(0xEEFCE2090ED7C975), U64_C(0x13E7F3D2E9503630), U64_C(0xC959667D2ED76970),
+        U64_C(0xE59F6E9E0953562B), U64_C(0x3F21FB31CED4096B), U64_C(0xC23AEAEA2953F62E), U64_C(0x18847F45EED4A96E),
+        U64_C(0xAAD4667649521621), U64_C(0x706AF3D98ED54961), U64_C(0x8D71E2026952B624), U64_C(0x57CF77ADAED5E964),
+    },
+};
+
+// CRC-64/XZ folding constants
+const crc_clmul_consts CRC64_XZ_CLMUL =
+{
+    .fold128 = { U64_C(0xE05DD497CA393AE4), U64_C(0xDABE95AFC7875F40) },
+    .fold256 = { U64_C(0x60095B008A9EFA44), U64_C(0x3BE653A30FE1AF51) },
+    .fold512 = { U64_C(0x6AE3EFBB9DD441F3), U64_C(0x081F6054A7842DF4) },
+    .fold1024 = { U64_C(0x8757D71D4FCC1000), U64_C(0xD7D86B2AF73DE740) },
+    .fold2048 = { U64_C(0x8260ADF2381AD81C), U64_C(0xF31FD9271E228B79) },
+};
+
+// CRC-64/NVME slicing tables (generic engine)
+const u64 CRC64_NVME_SLICE64_TABLE[8][256] =
+{
+    {
+        U64_C(0x0000000000000000), U64_C(0x7F6EF0C830358979), U64_C(0xFEDDE190606B12F2), U64_C(0x81B31158505E9B8B),
+        U64_C(0xC962E5739841B68F), U64_C(0xB60C15BBA8743FF6), U64_C(0x37BF04E3F82AA47D), U64_C(0x48D1F42BC81F2D04),
+        U64_C(0xA61CECB46814FE75), U64_C(0xD9721C7C5821770C), U64_C(0x58C10D24087FEC87), U64_C(0x27AFFDEC384A65FE),
+        U64_C(0x6F7E09C7F05548FA), U64_C(0x1010F90FC060C183), U64_C(0x91A3E857903E5A08), U64_C(0xEECD189FA00BD371),
+        U64_C(0x78E0FF3B88BE6F81), U64_C(0x078E0FF3B88BE6F8), U64_C(0x863D1EABE8D57D73), U64_C(0xF953EE63D8E0F40A),
+        U64_C(0xB1821A4810FFD90E), U64_C(0xCEECEA8020CA5077), U64_C(0x4F5FFBD87094CBFC), U64_C(0x30310B1040A14285),
+        U64_C(0xDEFC138FE0AA91F4), U64_C(0xA192E347D09F188D), U64_C(0x2021F21F80C18306), U64_C(0x5F4F02D7B0F40A7F),
+        U64_C(0x179EF6FC78EB277B), U64_C(0x68F0063448DEAE02), U64_C(0xE943176C18803589), U64_C(0x962DE7A428B5BCF0),
+        U64_C(0xF1C1FE77117CDF02), U64_C(0x8EAF0EBF2149567B), U64_C(0x0F1C1FE77117CDF0), U64_C(0x7072EF2F41224489),
+        U64_C(0x38A31B04893D698D), U64_C(0x47CDEBCCB908E0F4), U64_C(0xC67EFA94E9567B7F), U64_C(0xB9100A5CD963F206),
+        U64_C(0x57DD12C379682177), U64_C(0x28B3E20B495DA80E), U64_C(0xA900F35319033385), U64_C(0xD66E039B2936BAFC),
+        U64_C(0x9EBFF7B0E12997F8), U64_C(0xE1D10778D11C1E81), U64_C(0x606216208142850A), U64_C(0x1F0CE6E8B1770C73),
+        U64_C(0x8921014C99C2B083), U64_C(0xF64FF184A9F739FA), U64_C(0x77FCE0DCF9A9A271), U64_C(0x08921014C99C2B08),
+        U64_C(0x4043E43F0183060C), U64_C(0x3F2D14F731B68F75), U64_C(0xBE9E05AF61E814FE), U64_C(0xC1F0F56751DD9D87),
+        U64_C(0x2F3DEDF8F1D64EF6), U64_C(0x50531D30C1E3C78F), U64_C(0xD1E00C6891BD5C04), U64_C(0xAE8EFCA0A188D57D),
+        U64_C(0xE65F088B6997F879), U64_C(0x9931F84359A27100), U64_C(0x1882E91B09FCEA8B), U64_C(0x67EC19D339C963F2),
+        U64_C(0xD75ADABD7A6E2D6F), U64_C(0xA8342A754A5BA416), U64_C(0x29873B2D1A053F9D), U64_C(0x56E9CBE52A30B6E4),
+        U64_C(0x1E383FCEE22F9BE0), U64_C(0x6156CF06D21A1299), U64_C(0xE0E5DE5E82448912), U64_C(0x9F8B2E96B271006B),
+        U64_C(0x71463609127AD31A), U64_C(0x0E28C6C1224F5A63), U64_C(0x8F9BD7997211C1E8), U64_C(0xF0F5275142244891),
+        U64_C(0xB824D37A8A3B6595), U64_C(0xC74A23B2BA0EECEC), U64_C(0x46F932EAEA507767), U64_C(0x3997C222DA65FE1E),
+        U64_C(0xAFBA2586F2D042EE), U64_C(0xD0D4D54EC2E5CB97), U64_C(0x5167C41692BB501C), U64_C(0x2E0934DEA28ED965),
+        U64_C(0x66D8C0F56A91F461), U64_C(0x19B6303D5AA47D18), U64_C(0x980521650AFAE693), U64_C(0xE76BD1AD3ACF6FEA),
+        U64_C(0x09A6C9329AC4BC9B), U64_C(0x76C839FAAAF135E2), U64_C(0xF77B28A2FAAFAE69), U64_C(0x8815D86ACA9A2710),
+        U64_C(0xC0C42C4102850A14), U64_C(0xBFAADC8932B0836D), U64_C(0x3E19CDD162EE18E6), U64_C(0x41773D1952DB919F),
+        U64_C(0x269B24CA6B12F26D), U64_C(0x59F5D4025B277B14), U64_C(0xD846C55A0B79E09F), U64_C(0xA72835923B4C69E6),
+        U64_C(0xEFF9C1B9F35344E2), U64_C(0x90973171C366CD9B), U64_C(0x1124202993385610), U64_C(0x6E4AD0E1A30DDF69),
+        U64_C(0x8087C87E03060C18), U64_C(0xFFE938B633338561), U64_C(0x7E5A29EE636D1EEA), U64_C(0x0134D92653589793),
+        U64_C(0x49E52D0D9B47BA97), U64_C(0x368BDDC5AB7233EE), U64_C(0xB738CC9DFB2CA865), U64_C(0xC8563C55CB19211C),
+        U64_C(0x5E7BDBF1E3AC9DEC), U64_C(0x21152B39D3991495), U64_C(0xA0A63A6183C78F1E), U64_C(0xDFC8CAA9B3F20667),
+        U64_C(0x97193E827BED2B63), U64_C(0xE877CE4A4BD8A21A), U64_C(0x69C4DF121B863991), U64_C(0x16AA2FDA2BB3B0E8),
+        U64_C(0xF86737458BB86399), U64_C(0x8709C78DBB8DEAE0), U64_C(0x06BAD6D5EBD3716B), U64_C(0x79D4261DDBE6F812),
+        U64_C(0x3105D23613F9D516), U64_C(0x4E6B22FE23CC5C6F), U64_C(0xCFD833A67392C7E4), U64_C(0xB0B6C36E43A74E9D),
+        U64_C(0x9A6C9329AC4BC9B5), U64_C(0xE50263E19C7E40CC), U64_C(0x64B172B9CC20DB47), U64_C(0x1BDF8271FC15523E),
+        U64_C(0x530E765A340A7F3A), U64_C(0x2C608692043FF643), U64_C(0xADD397CA54616DC8), U64_C(0xD2BD67026454E4B1),
+        U64_C(0x3C707F9DC45F37C0), U64_C(0x431E8F55F46ABEB9), U64_C(0xC2AD9E0DA4342532), U64_C(0xBDC36EC59401AC4B),
+        U64_C(0xF5129AEE5C1E814F), U64_C(0x8A7C6A266C2B0836), U64_C(0x0BCF7B7E3C7593BD), U64_C(0x74A18BB60C401AC4),
+        U64_C(0xE28C6C1224F5A634), U64_C(0x9DE29CDA14C02F4D), U64_C(0x1C518D82449EB4C6), U64_C(0x633F7D4A74AB3DBF),
+        U64_C(0x2BEE8961BCB410BB), U64_C(0x548079A98C8199C2), U64_C(0xD53368F1DCDF0249), U64_C(0xAA5D9839ECEA8B30),
+        U64_C(0x449080A64CE15841), U64_C(0x3BFE706E7CD4D138), U64_C(0xBA4D61362C8A4AB3), U64_C(0xC52391FE1CBFC3CA),
+        U64_C(0x8DF265D5D4A0EECE), U64_C(0xF29C951DE49567B7), U64_C(0x732F8445B4CBFC3C), U64_C(0x0C41748D84FE7545),
+        U64_C(0x6BAD6D5EBD3716B7), U64_C(0x14C39D968D029FCE), U64_C(0x95708CCEDD5C0445), U64_C(0xEA1E7C06ED698D3C),
+        U64_C(0xA2CF882D2576A038), U64_C(0xDDA178E515432941), U64_C(0x5C1269BD451DB2CA), U64_C(0x237C997575283BB3),
+        U64_C(0xCDB181EAD523E8C2), U64_C(0xB2DF7122E51661BB), U64_C(0x336C607AB548FA30), U64_C(0x4C0290B2857D7349),
+        U64_C(0x04D364994D625E4D), U64_C(0x7BBD94517D57D734), U64_C(0xFA0E85092D094CBF), U64_C(0x856075C11D3CC5C6),
+        U64_C(0x134D926535897936), U64_C(0x6C2362AD05BCF04F), U64_C(0xED9073F555E26BC4), U64_C(0x92FE833D65D7E2BD),
+        U64_C(0xDA2F7716ADC8CFB9), U64_C(0xA54187DE9DFD46C0), U64_C(0x24F29686CDA3DD4B), U64_C(0x5B9C664EFD965432),
+        U64_C(0xB5517ED15D9D8743), U64_C(0xCA3F8E196DA80E3A), U64_C(0x4B8C9F413DF695B1), U64_C(0x34E26F890DC31CC8),
+        U64_C(0x7C339BA2C5DC31CC), U64_C(0x035D6B6AF5E9B8B5), U64_C(0x82EE7A32A5B7233E), U64_C(0xFD808AFA9582AA47),
+        U64_C(0x4D364994D625E4DA), U64_C(0x3258B95CE6106DA3), U64_C(0xB3EBA804B64EF628), U64_C(0xCC8558CC867B7F51),
+        U64_C(0x8454ACE74E645255), U64_C(0xFB3A5C2F7E51DB2C), U64_C(0x7A894D772E0F40A7), U64_C(0x05E7BDBF1E3AC9DE),
+        U64_C(0xEB2AA520BE311AAF), U64_C(0x944455E88E0493D6), U64_C(0x15F744B0DE5A085D), U64_C(0x6A99B478EE6F8124),
+        U64_C(0x224840532670AC20), U64_C(0x5D26B09B16452559), U64_C(0xDC95A1C3461BBED2), U64_C(0xA3FB510B762E37AB),
+        U64_C(0x35D6B6AF5E9B8B5B), U64_C(0x4AB846676EAE0222), U64_C(0xCB0B573F3EF099A9), U64_C(0xB465A7F70EC510D0),
+        U64_C(0xFCB453DCC6DA3DD4), U64_C(0x83DAA314F6EFB4AD), U64_C(0x0269B24CA6B12F26), U64_C(0x7D0742849684A65F),
+        U64_C(0x93CA5A1B368F752E), U64_C(0xECA4AAD306BAFC57), U64_C(0x6D17BB8B56E467DC), U64_C(0x12794B4366D1EEA5),
+        U64_C(0x5AA8BF68AECEC3A1), U64_C(0x25C64FA09EFB4AD8), U64_C(0xA4755EF8CEA5D153), U64_C(0xDB1BAE30FE90582A),
+        U64_C(0xBCF7B7E3C7593BD8), U64_C(0xC399472BF76CB2A1), U64_C(0x422A5673A732292A), U64_C(0x3D44A6BB9707A053),
+        U64_C(0x759552905F188D57), U64_C(0x0AFBA2586F2D042E), U64_C(0x8B48B3003F739FA5), U64_C(0xF42643C80F4616DC),
+        U64_C(0x1AEB5B57AF4DC5AD), U64_C(0x6585AB9F9F784CD4), U64_C(0xE436BAC7CF26D75F), U64_C(0x9B584A0FFF135E26),
+        U64_C(0xD389BE24370C7322), U64_C(0xACE74EEC0739FA5B), U64_C(0x2D545FB4576761D0), U64_C(0x523AAF7C6752E8A9),
+        U64_C(0xC41748D84FE75459), U64_C(0xBB79B8107FD2DD20), U64_C(0x3ACAA9482F8C46AB), U64_C(0x45A459801FB9CFD2),
+        U64_C(0x0D75ADABD7A6E2D6), U64_C(0x721B5D63E7936BAF), U64_C(0xF3A84C3BB7CDF024), U64_C(0x8CC6BCF387F8795D),
+        U64_C(0x620BA46C27F3AA2C), U64_C(0x1D6554A417C62355), U64_C(0x9CD645FC4798B8DE), U64_C(0xE3B8B53477AD31A7),
+        U64_C(0xAB69411FBFB21CA3), U64_C(0xD407B1D78F8795DA), U64_C(0x55B4A08FDFD90E51), U64_C(0x2ADA5047EFEC8728),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x8776A97D73BDDF69), U64_C(0x3A3474A9BFEC2DB9), U64_C(0xBD42DDD4CC51F2D0),
+        U64_C(0x7468E9537FD85B72), U64_C(0xF31E402E0C65841B), U64_C(0x4E5C9DFAC03476CB), U64_C(0xC92A3487B389A9A2),
+        U64_C(0xE8D1D2A6FFB0B6E4), U64_C(0x6FA77BDB8C0D698D), U64_C(0xD2E5A60F405C9B5D), U64_C(0x55930F7233E14434),
+        U64_C(0x9CB93BF58068ED96), U64_C(0x1BCF9288F3D532FF), U64_C(0xA68D4F5C3F84C02F), U64_C(0x21FBE6214C391F46),
+        U64_C(0xE57A831EA7F6FEA3), U64_C(0x620C2A63D44B21CA), U64_C(0xDF4EF7B7181AD31A), U64_C(0x58385ECA6BA70C73),
+        U64_C(0x91126A4DD82EA5D1), U64_C(0x1664C330AB937AB8), U64_C(0xAB261EE467C28868), U64_C(0x2C50B799147F5701),
+        U64_C(0x0DAB51B858464847), U64_C(0x8ADDF8C52BFB972E), U64_C(0x379F2511E7AA65FE), U64_C(0xB0E98C6C9417BA97),
+        U64_C(0x79C3B8EB279E1335), U64_C(0xFEB511965423CC5C), U64_C(0x43F7CC4298723E8C), U64_C(0xC481653FEBCFE1E5),
+        U64_C(0xFE2C206E177A6E2D), U64_C(0x795A891364C7B144), U64_C(0xC41854C7A8964394), U64_C(0x436EFDBADB2B9CFD),
+        U64_C(0x8A44C93D68A2355F), U64_C(0x0D3260401B1FEA36), U64_C(0xB070BD94D74E18E6), U64_C(0x370614E9A4F3C78F),
+        U64_C(0x16FDF2C8E8CAD8C9), U64_C(0x918B5BB59B7707A0), U64_C(0x2CC986615726F570), U64_C(0xABBF2F1C249B2A19),
+        U64_C(0x62951B9B971283BB), U64_C(0xE5E3B2E6E4AF5CD2), U64_C(0x58A16F3228FEAE02), U64_C(0xDFD7C64F5B43716B),
+        U64_C(0x1B56A370B08C908E), U64_C(0x9C200A0DC3314FE7), U64_C(0x2162D7D90F60BD37), U64_C(0xA6147EA47CDD625E),
+        U64_C(0x6F3E4A23CF54CBFC), U64_C(0xE848E35EBCE91495), U64_C(0x550A3E8A70B8E645), U64_C(0xD27C97F70305392C),
+        U64_C(0xF38771D64F3C266A), U64_C(0x74F1D8AB3C81F903), U64_C(0xC9B3057FF0D00BD3), U64_C(0x4EC5AC02836DD4BA),
+        U64_C(0x87EF988530E47D18), U64_C(0x009931F84359A271), U64_C(0xBDDBEC2C8F0850A1), U64_C(0x3AAD4551FCB58FC8),
+        U64_C(0xC881668F76634F31), U64_C(0x4FF7CFF205DE9058), U64_C(0xF2B51226C98F6288), U64_C(0x75C3BB5BBA32BDE1),
+        U64_C(0xBCE98FDC09BB1443), U64_C(0x3B9F26A17A06CB2A), U64_C(0x86DDFB75B65739FA), U64_C(0x01AB5208C5EAE693),
+        U64_C(0x2050B42989D3F9D5), U64_C(0xA7261D54FA6E26BC), U64_C(0x1A64C080363FD46C), U64_C(0x9D1269FD45820B05),
+        U64_C(0x54385D7AF60BA2A7), U64_C(0xD34EF40785B67DCE), U64_C(0x6E0C29D349E78F1E), U64_C(0xE97A80AE3A5A5077),
+        U64_C(0x2DFBE591D195B192), U64_C(0xAA8D4CECA2286EFB), U64_C(0x17CF91386E799C2B), U64_C(0x90B938451DC44342),
+        U64_C(0x59930CC2AE4DEAE0), U64_C(0xDEE5A5BFDDF03589), U64_C(0x63A7786B11A1C759), U64_C(0xE4D1D116621C1830),
+        U64_C(0xC52A37372E250776), U64_C(0x425C9E4A5D98D81F), U64_C(0xFF1E439E91C92ACF), U64_C(0x7868EAE3E274F5A6),
+        U64_C(0xB142DE6451FD5C04), U64_C(0x363477192240836D), U64_C(0x8B76AACDEE1171BD), U64_C(0x0C0003B09DACAED4),
+        U64_C(0x36AD46E16119211C), U64_C(0xB1DBEF9C12A4FE75), U64_C(0x0C993248DEF50CA5), U64_C(0x8BEF9B35AD48D3CC),
+        U64_C(0x42C5AFB21EC17A6E), U64_C(0xC5B306CF6D7CA507), U64_C(0x78F1DB1BA12D57D7), U64_C(0xFF877266D29088BE),
+        U64_C(0xDE7C94479EA997F8), U64_C(0x590A3D3AED144891), U64_C(0xE448E0EE2145BA41), U64_C(0x633E499352F86528),
+        U64_C(0xAA147D14E171CC8A), U64_C(0x2D62D46992CC13E3), U64_C(0x902009BD5E9DE133), U64_C(0x1756A0C02D203E5A),
+        U64_C(0xD3D7C5FFC6EFDFBF), U64_C(0x54A16C82B55200D6), U64_C(0xE9E3B1567903F206), U64_C(0x6E95182B0ABE2D6F),
+        U64_C(0xA7BF2CACB93784CD), U64_C(0x20C985D1CA8A5BA4), U64_C(0x9D8B580506DBA974), U64_C(0x1AFDF1787566761D),
+        U64_C(0x3B061759395F695B), U64_C(0xBC70BE244AE2B632), U64_C(0x013263F086B344E2), U64_C(0x8644CA8DF50E9B8B),
+        U64_C(0x4F6EFE0A46873229), U64_C(0xC8185777353AED40), U64_C(0x755A8AA3F96B1F90), U64_C(0xF22C23DE8AD6C0F9),
+        U64_C(0xA5DBEB4DB4510D09), U64_C(0x22AD4230C7ECD260), U64_C(0x9FEF9FE40BBD20B0), U64_C(0x189936997800FFD9),
+        U64_C(0xD1B3021ECB89567B), U64_C(0x56C5AB63B8348912), U64_C(0xEB8776B774657BC2), U64_C(0x6CF1DFCA07D8A4AB),
+        U64_C(0x4D0A39EB4BE1BBED), U64_C(0xCA7C9096385C6484), U64_C(0x773E4D42F40D9654), U64_C(0xF048E43F87B0493D),
+        U64_C(0x3962D0B83439E09F), U64_C(0xBE1479C547843FF6), U64_C(0x0356A4118BD5CD26), U64_C(0x84200D6CF868124F),
+        U64_C(0x40A1685313A7F3AA), U64_C(0xC7D7C12E601A2CC3), U64_C(0x7A951CFAAC4BDE13), U64_C(0xFDE3B587DFF6017A),
+        U64_C(0x34C981006C7FA8D8), U64_C(0xB3BF287D1FC277B1), U64_C(0x0EFDF5A9D3938561), U64_C(0x898B5CD4A02E5A08),
+        U64_C(0xA870BAF5EC17454E), U64_C(0x2F0613889FAA9A27), U64_C(0x9244CE5C53FB68F7), U64_C(0x153267212046B79E),
+        U64_C(0xDC1853A693CF1E3C), U64_C(0x5B6EFADBE072C155), U64_C(0xE62C270F2C233385), U64_C(0x615A8E725F9EECEC),
+        U64_C(0x5BF7CB23A32B6324), U64_C(0xDC81625ED096BC4D), U64_C(0x61C3BF8A1CC74E9D), U64_C(0xE6B516F76F7A91F4),
+        U64_C(0x2F9F2270DCF33856), U64_C(0xA8E98B0DAF4EE73F), U64_C(0x15AB56D9631F15EF), U64_C(0x92DDFFA410A2CA86),
+        U64_C(0xB32619855C9BD5C0), U64_C(0x3450B0F82F260AA9), U64_C(0x89126D2CE377F879), U64_C(0x0E64C45190CA2710),
+        U64_C(0xC74EF0D623438EB2), U64_C(0x403859AB50FE51DB), U64_C(0xFD7A847F9CAFA30B), U64_C(0x7A0C2D02EF127C62),
+        U64_C(0xBE8D483D04DD9D87), U64_C(0x39FBE140776042EE), U64_C(0x84B93C94BB31B03E), U64_C(0x03CF95E9C88C6F57),
+        U64_C(0xCAE5A16E7B05C6F5), U64_C(0x4D93081308B8199C), U64_C(0xF0D1D5C7C4E9EB4C), U64_C(0x77A77CBAB7543425),
+        U64_C(0x565C9A9BFB6D2B63), U64_C(0xD12A33E688D0F40A), U64_C(0x6C68EE32448106DA), U64_C(0xEB1E474F373CD9B3),
+        U64_C(0x223473C884B57011), U64_C(0xA542DAB5F708AF78), U64_C(0x180007613B595DA8), U64_C(0x9F76AE1C48E482C1),
+        U64_C(0x6D5A8DC2C2324238), U64_C(0xEA2C24BFB18F9D51), U64_C(0x576EF96B7DDE6F81), U64_C(0xD01850160E63B0E8),
+        U64_C(0x19326491BDEA194A), U64_C(0x9E44CDECCE57C623), U64_C(0x23061038020634F3), U64_C(0xA470B94571BBEB9A),
+        U64_C(0x858B5F643D82F4DC), U64_C(0x02FDF6194E3F2BB5), U64_C(0xBFBF2BCD826ED965), U64_C(0x38C982B0F1D3060C),
+        U64_C(0xF1E3B637425AAFAE), U64_C(0x76951F4A31E770C7), U64_C(0xCBD7C29EFDB68217), U64_C(0x4CA16BE38E0B5D7E),
+        U64_C(0x88200EDC65C4BC9B), U64_C(0x0F56A7A1167963F2), U64_C(0xB2147A75DA289122), U64_C(0x3562D308A9954E4B),
+        U64_C(0xFC48E78F1A1CE7E9), U64_C(0x7B3E4EF269A13880), U64_C(0xC67C9326A5F0CA50), U64_C(0x410A3A5BD64D1539),
+        U64_C(0x60F1DC7A9A740A7F), U64_C(0xE7877507E9C9D516), U64_C(0x5AC5A8D3259827C6), U64_C(0xDDB301AE5625F8AF),
+        U64_C(0x14993529E5AC510D), U64_C(0x93EF9C5496118E64), U64_C(0x2EAD41805A407CB4), U64_C(0xA9DBE8FD29FDA3DD),
+        U64_C(0x9376ADACD5482C15), U64_C(0x140004D1A6F5F37C), U64_C(0xA942D9056AA401AC), U64_C(0x2E3470781919DEC5),
+        U64_C(0xE71E44FFAA907767), U64_C(0x6068ED82D92DA80E), U64_C(0xDD2A3056157C5ADE), U64_C(0x5A5C992B66C185B7),
+        U64_C(0x7BA77F0A2AF89AF1), U64_C(0xFCD1D67759454598), U64_C(0x41930BA39514B748), U64_C(0xC6E5A2DEE6A96821),
+        U64_C(0x0FCF96595520C183), U64_C(0x88B93F24269D1EEA), U64_C(0x35FBE2F0EACCEC3A), U64_C(0xB28D4B8D99713353),
+        U64_C(0x760C2EB272BED2B6), U64_C(0xF17A87CF01030DDF), U64_C(0x4C385A1BCD52FF0F), U64_C(0xCB4EF366BEEF2066),
+        U64_C(0x0264C7E10D6689C4), U64_C(0x85126E9C7EDB56AD), U64_C(0x3850B348B28AA47D), U64_C(0xBF261A35C1377B14),
+        U64_C(0x9EDDFC148D0E6452), U64_C(0x19AB5569FEB3BB3B), U64_C(0xA4E988BD32E249EB), U64_C(0x239F21C0415F9682),
+        U64_C(0xEAB51547F2D63F20), U64_C(0x6DC3BC3A816BE049), U64_C(0xD08161EE4D3A1299), U64_C(0x57F7C8933E87CDF0),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0xFF6E4E1F4E4038BE), U64_C(0xCA05BA6DC417E217), U64_C(0x356BF4728A57DAA9),
+        U64_C(0xA0D25288D0B85745), U64_C(0x5FBC1C979EF86FFB), U64_C(0x6AD7E8E514AFB552), U64_C(0x95B9A6FA5AEF8DEC),
+        U64_C(0x757D8342F9E73DE1), U64_C(0x8A13CD5DB7A7055F), U64_C(0xBF78392F3DF0DFF6), U64_C(0x4016773073B0E748),
+        U64_C(0xD5AFD1CA295F6AA4), U64_C(0x2AC19FD5671F521A), U64_C(0x1FAA6BA7ED4888B3), U64_C(0xE0C425B8A308B00D),
+        U64_C(0xEAFB0685F3CE7BC2), U64_C(0x1595489ABD8E437C), U64_C(0x20FEBCE837D999D5), U64_C(0xDF90F2F77999A16B),
+        U64_C(0x4A29540D23762C87), U64_C(0xB5471A126D361439), U64_C(0x802CEE60E761CE90), U64_C(0x7F42A07FA921F62E),
+        U64_C(0x9F8685C70A294623), U64_C(0x60E8CBD844697E9D), U64_C(0x55833FAACE3EA434), U64_C(0xAAED71B5807E9C8A),
+        U64_C(0x3F54D74FDA911166), U64_C(0xC03A995094D129D8), U64_C(0xF5516D221E86F371), U64_C(0x0A3F233D50C6CBCF),
+        U64_C(0xE12F2B58BF0B64EF), U64_C(0x1E416547F14B5C51), U64_C(0x2B2A91357B1C86F8), U64_C(0xD444DF2A355CBE46),
+        U64_C(0x41FD79D06FB333AA), U64_C(0xBE9337CF21F30B14), U64_C(0x8BF8C3BDABA4D1BD), U64_C(0x74968DA2E5E4E903),
+        U64_C(0x9452A81A46EC590E), U64_C(0x6B3CE60508AC61B0), U64_C(0x5E57127782FBBB19), U64_C(0xA1395C68CCBB83A7),
+        U64_C(0x3480FA9296540E4B), U64_C(0xCBEEB48DD81436F5), U64_C(0xFE8540FF5243EC5C), U64_C(0x01EB0EE01C03D4E2),
+        U64_C(0x0BD42DDD4CC51F2D), U64_C(0xF4BA63C202852793), U64_C(0xC1D197B088D2FD3A), U64_C(0x3EBFD9AFC692C584),
+        U64_C(0xAB067F559C7D4868), U64_C(0x5468314AD23D70D6), U64_C(0x6103C538586AAA7F), U64_C(0x9E6D8B27162A92C1),
+        U64_C(0x7EA9AE9FB52222CC), U64_C(0x81C7E080FB621A72), U64_C(0xB4AC14F27135C0DB), U64_C(0x4BC25AED3F75F865),
+        U64_C(0xDE7BFC17659A7589), U64_C(0x2115B2082BDA4D37), U64_C(0x147E467AA18D979E), U64_C(0xEB100865EFCDAF20),
+        U64_C(0xF68770E226815AB5), U64_C(0x09E93EFD68C1620B), U64_C(0x3C82CA8FE296B8A2), U64_C(0xC3EC8490ACD6801C),
+        U64_C(0x5655226AF6390DF0), U64_C(0xA93B6C75B879354E), U64_C(0x9C509807322EEFE7), U64_C(0x633ED6187C6ED759),
+        U64_C(0x83FAF3A0DF666754), U64_C(0x7C94BDBF91265FEA), U64_C(0x49FF49CD1B718543), U64_C(0xB69107D25531BDFD),
+        U64_C(0x2328A1280FDE3011), U64_C(0xDC46EF37419E08AF), U64_C(0xE92D1B45CBC9D206), U64_C(0x1643555A8589EAB8),
+        U64_C(0x1C7C7667D54F2177), U64_C(0xE31238789B0F19C9), U64_C(0xD679CC0A1158C360), U64_C(0x291782155F18FBDE),
+        U64_C(0xBCAE24EF05F77632), U64_C(0x43C06AF04BB74E8C), U64_C(0x76AB9E82C1E09425), U64_C(0x89C5D09D8FA0AC9B),
+        U64_C(0x6901F5252CA81C96), U64_C(0x966FBB3A62E82428), U64_C(0xA3044F48E8BFFE81), U64_C(0x5C6A0157A6FFC63F),
+        U64_C(0xC9D3A7ADFC104BD3), U64_C(0x36BDE9B2B250736D), U64_C(0x03D61DC03807A9C4), U64_C(0xFCB853DF7647917A),
+        U64_C(0x17A85BBA998A3E5A), U64_C(0xE8C615A5D7CA06E4), U64_C(0xDDADE1D75D9DDC4D), U64_C(0x22C3AFC813DDE4F3),
+        U64_C(0xB77A09324932691F), U64_C(0x4814472D077251A1), U64_C(0x7D7FB35F8D258B08), U64_C(0x8211FD40C365B3B6),
+        U64_C(0x62D5D8F8606D03BB), U64_C(0x9DBB96E72E2D3B05), U64_C(0xA8D06295A47AE1AC), U64_C(0x57BE2C8AEA3AD912),
+        U64_C(0xC2078A70B0D554FE), U64_C(0x3D69C46FFE956C40), U64_C(0x0802301D74C2B6E9), U64_C(0xF76C7E023A828E57),
+        U64_C(0xFD535D3F6A444598), U64_C(0x023D132024047D26), U64_C(0x3756E752AE53A78F), U64_C(0xC838A94DE0139F31),
+        U64_C(0x5D810FB7BAFC12DD), U64_C(0xA2EF41A8F4BC2A63), U64_C(0x9784B5DA7EEBF0CA), U64_C(0x68EAFBC530ABC874),
+        U64_C(0x882EDE7D93A37879), U64_C(0x77409062DDE340C7), U64_C(0x422B641057B49A6E), U64_C(0xBD452A0F19F4A2D0),
+        U64_C(0x28FC8CF5431B2F3C), U64_C(0xD792C2EA0D5B1782), U64_C(0xE2F93698870CCD2B), U64_C(0x1D977887C94CF595),
+        U64_C(0xD9D7C79715952601), U64_C(0x26B989885BD51EBF), U64_C(0x13D27DFAD182C416), U64_C(0xECBC33E59FC2FCA8),
+        U64_C(0x7905951FC52D7144), U64_C(0x866BDB008B6D49FA), U64_C(0xB3002F72013A9353), U64_C(0x4C6E616D4F7AABED),
+        U64_C(0xACAA44D5EC721BE0), U64_C(0x53C40ACAA232235E), U64_C(0x66AFFEB82865F9F7), U64_C(0x99C1B0A76625C149),
+        U64_C(0x0C78165D3CCA4CA5), U64_C(0xF3165842728A741B), U64_C(0xC67DAC30F8DDAEB2), U64_C(0x3913E22FB69D960C),
+        U64_C(0x332CC112E65B5DC3), U64_C(0xCC428F0DA81B657D), U64_C(0xF9297B7F224CBFD4), U64_C(0x064735606C0C876A),
+        U64_C(0x93FE939A36E30A86), U64_C(0x6C90DD8578A33238), U64_C(0x59FB29F7F2F4E891), U64_C(0xA69567E8BCB4D02F),
+        U64_C(0x465142501FBC6022), U64_C(0xB93F0C4F51FC589C), U64_C(0x8C54F83DDBAB8235), U64_C(0x733AB62295EBBA8B),
+        U64_C(0xE68310D8CF043767), U64_C(0x19ED5EC781440FD9), U64_C(0x2C86AAB50B13D570), U64_C(0xD3E8E4AA4553EDCE),
+        U64_C(0x38F8ECCFAA9E42EE), U64_C(0xC796A2D0E4DE7A50), U64_C(0xF2FD56A26E89A0F9), U64_C(0x0D9318BD20C99847),
+        U64_C(0x982ABE477A2615AB), U64_C(0x6744F05834662D15), U64_C(0x522F042ABE31F7BC), U64_C(0xAD414A35F071CF02),
+        U64_C(0x4D856F8D53797F0F), U64_C(0xB2EB21921D3947B1), U64_C(0x8780D5E0976E9D18), U64_C(0x78EE9BFFD92EA5A6),
+        U64_C(0xED573D0583C1284A), U64_C(0x1239731ACD8110F4), U64_C(0x2752876847D6CA5D), U64_C(0xD83CC9770996F2E3),
+        U64_C(0xD203EA4A5950392C), U64_C(0x2D6DA45517100192), U64_C(0x180650279D47DB3B), U64_C(0xE7681E38D307E385),
+        U64_C(0x72D1B8C289E86E69), U64_C(0x8DBFF6DDC7A856D7), U64_C(0xB8D402AF4DFF8C7E), U64_C(0x47BA4CB003BFB4C0),
+        U64_C(0xA77E6908A0B704CD), U64_C(0x58102717EEF73C73), U64_C(0x6D7BD36564A0E6DA), U64_C(0x92159D7A2AE0DE64),
+        U64_C(0x07AC3B80700F5388), U64_C(0xF8C2759F3E4F6B36), U64_C(0xCDA981EDB418B19F), U64_C(0x32C7CFF2FA588921),
+        U64_C(0x2F50B77533147CB4), U64_C(0xD03EF96A7D54440A), U64_C(0xE5550D18F7039EA3), U64_C(0x1A3B4307B943A61D),
+        U64_C(0x8F82E5FDE3AC2BF1), U64_C(0x70ECABE2ADEC134F), U64_C(0x45875F9027BBC9E6), U64_C(0xBAE9118F69FBF158),
+        U64_C(0x5A2D3437CAF34155), U64_C(0xA5437A2884B379EB), U64_C(0x90288E5A0EE4A342), U64_C(0x6F46C04540A49BFC),
+        U64_C(0xFAFF66BF1A4B1610), U64_C(0x059128A0540B2EAE), U64_C(0x30FADCD2DE5CF407), U64_C(0xCF9492CD901CCCB9),
+        U64_C(0xC5ABB1F0C0DA0776), U64_C(0x3AC5FFEF8E9A3FC8), U64_C(0x0FAE0B9D04CDE561), U64_C(0xF0C045824A8DDDDF),
+        U64_C(0x6579E37810625033), U64_C(0x9A17AD675E22688D), U64_C(0xAF7C5915D475B224), U64_C(0x5012170A9A358A9A),
+        U64_C(0xB0D632B2393D3A97), U64_C(0x4FB87CAD777D0229), U64_C(0x7AD388DFFD2AD880), U64_C(0x85BDC6C0B36AE03E),
+        U64_C(0x1004603AE9856DD2), U64_C(0xEF6A2E25A7C5556C), U64_C(0xDA01DA572D928FC5), U64_C(0x256F944863D2B77B),
+        U64_C(0xCE7F9C2D8C1F185B), U64_C(0x3111D232C25F20E5), U64_C(0x047A26404808FA4C), U64_C(0xFB14685F0648C2F2),
+        U64_C(0x6EADCEA55CA74F1E), U64_C(0x91C380BA12E777A0), U64_C(0xA4A874C898B0AD09), U64_C(0x5BC63AD7D6F095B7),
+        U64_C(0xBB021F6F75F825BA), U64_C(0x446C51703BB81D04), U64_C(0x7107A502B1EFC7AD), U64_C(0x8E69EB1DFFAFFF13),
+        U64_C(0x1BD04DE7A54072FF), U64_C(0xE4BE03F8EB004A41), U64_C(0xD1D5F78A615790E8), U64_C(0x2EBBB9952F17A856),
+        U64_C(0x24849AA87FD16399), U64_C(0xDBEAD4B731915B27), U64_C(0xEE8120C5BBC6818E), U64_C(0x11EF6EDAF586B930),
+        U64_C(0x8456C820AF6934DC), U64_C(0x7B38863FE1290C62), U64_C(0x4E53724D6B7ED6CB), U64_C(0xB13D3C52253EEE75),
+        U64_C(0x51F919EA86365E78), U64_C(0xAE9757F5C87666C6), U64_C(0x9BFCA3874221BC6F), U64_C(0x6492ED980C6184D1),
+        U64_C(0xF12B4B62568E093D), U64_C(0x0E45057D18CE3183), U64_C(0x3B2EF10F9299EB2A), U64_C(0xC440BF10DCD9D394),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x8211147CBAF96306), U64_C(0x30FB0EAA2D655567), U64_C(0xB2EA1AD6979C3661),
+        U64_C(0x61F61D545ACAAACE), U64_C(0xE3E70928E033C9C8), U64_C(0x510D13FE77AFFFA9), U64_C(0xD31C0782CD569CAF),
+        U64_C(0xC3EC3AA8B595559C), U64_C(0x41FD2ED40F6C369A), U64_C(0xF317340298F000FB), U64_C(0x7106207E220963FD),
+        U64_C(0xA21A27FCEF5FFF52), U64_C(0x200B338055A69C54), U64_C(0x92E12956C23AAA35), U64_C(0x10F03D2A78C3C933),
+        U64_C(0xB301530233BD3853), U64_C(0x3110477E89445B55), U64_C(0x83FA5DA81ED86D34), U64_C(0x01EB49D4A4210E32),
+        U64_C(0xD2F74E566977929D), U64_C(0x50E65A2AD38EF19B), U64_C(0xE20C40FC4412C7FA), U64_C(0x601D5480FEEBA4FC),
+        U64_C(0x70ED69AA86286DCF), U64_C(0xF2FC7DD63CD10EC9), U64_C(0x40166700AB4D38A8), U64_C(0xC207737C11B45BAE),
+        U64_C(0x111B74FEDCE2C701), U64_C(0x930A6082661BA407), U64_C(0x21E07A54F1879266), U64_C(0xA3F16E284B7EF160),
+        U64_C(0x52DB80573FEDE3CD), U64_C(0xD0CA942B851480CB), U64_C(0x62208EFD1288B6AA), U64_C(0xE0319A81A871D5AC),
+        U64_C(0x332D9D0365274903), U64_C(0xB13C897FDFDE2A05), U64_C(0x03D693A948421C64), U64_C(0x81C787D5F2BB7F62),
+        U64_C(0x9137BAFF8A78B651), U64_C(0x1326AE833081D557), U64_C(0xA1CCB455A71DE336), U64_C(0x23DDA0291DE48030),
+        U64_C(0xF0C1A7ABD0B21C9F), U64_C(0x72D0B3D76A4B7F99), U64_C(0xC03AA901FDD749F8), U64_C(0x422BBD7D472E2AFE),
+        U64_C(0xE1DAD3550C50DB9E), U64_C(0x63CBC729B6A9B898), U64_C(0xD121DDFF21358EF9), U64_C(0x5330C9839BCCEDFF),
+        U64_C(0x802CCE01569A7150), U64_C(0x023DDA7DEC631256), U64_C(0xB0D7C0AB7BFF2437), U64_C(0x32C6D4D7C1064731),
+        U64_C(0x2236E9FDB9C58E02), U64_C(0xA027FD81033CED04), U64_C(0x12CDE75794A0DB65), U64_C(0x90DCF32B2E59B863),
+        U64_C(0x43C0F4A9E30F24CC), U64_C(0xC1D1E0D559F647CA), U64_C(0x733BFA03CE6A71AB), U64_C(0xF12AEE7F749312AD),
+        U64_C(0xA5B700AE7FDBC79A), U64_C(0x27A614D2C522A49C), U64_C(0x954C0E0452BE92FD), U64_C(0x175D1A78E847F1FB),
+        U64_C(0xC4411DFA25116D54), U64_C(0x465009869FE80E52), U64_C(0xF4BA135008743833), U64_C(0x76AB072CB28D5B35),
+        U64_C(0x665B3A06CA4E9206), U64_C(0xE44A2E7A70B7F100), U64_C(0x56A034ACE72BC761), U64_C(0xD4B120D05DD2A467),
+        U64_C(0x07AD2752908438C8), U64_C(0x85BC332E2A7D5BCE), U64_C(0x375629F8BDE16DAF), U64_C(0xB5473D8407180EA9),
+        U64_C(0x16B653AC4C66FFC9), U64_C(0x94A747D0F69F9CCF), U64_C(0x264D5D066103AAAE), U64_C(0xA45C497ADBFAC9A8),
+        U64_C(0x77404EF816AC5507), U64_C(0xF5515A84AC553601), U64_C(0x47BB40523BC90060), U64_C(0xC5AA542E81306366),
+        U64_C(0xD55A6904F9F3AA55), U64_C(0x574B7D78430AC953), U64_C(0xE5A167AED496FF32), U64_C(0x67B073D26E6F9C34),
+        U64_C(0xB4AC7450A339009B), U64_C(0x36BD602C19C0639D), U64_C(0x84577AFA8E5C55FC), U64_C(0x06466E8634A536FA),
+        U64_C(0xF76C80F940362457), U64_C(0x757D9485FACF4751), U64_C(0xC7978E536D537130), U64_C(0x45869A2FD7AA1236),
+        U64_C(0x969A9DAD1AFC8E99), U64_C(0x148B89D1A005ED9F), U64_C(0xA66193073799DBFE), U64_C(0x2470877B8D60B8F8),
+        U64_C(0x3480BA51F5A371CB), U64_C(0xB691AE2D4F5A12CD), U64_C(0x047BB4FBD8C624AC), U64_C(0x866AA087623F47AA),
+        U64_C(0x5576A705AF69DB05), U64_C(0xD767B3791590B803), U64_C(0x658DA9AF820C8E62), U64_C(0xE79CBDD338F5ED64),
+        U64_C(0x446DD3FB738B1C04), U64_C(0xC67CC787C9727F02), U64_C(0x7496DD515EEE4963), U64_C(0xF687C92DE4172A65),
+        U64_C(0x259BCEAF2941B6CA), U64_C(0xA78ADAD393B8D5CC), U64_C(0x1560C0050424E3AD), U64_C(0x9771D479BEDD80AB),
+        U64_C(0x8781E953C61E4998), U64_C(0x0590FD2F7CE72A9E), U64_C(0xB77AE7F9EB7B1CFF), U64_C(0x356BF38551827FF9),
+        U64_C(0xE677F4079CD4E356), U64_C(0x6466E07B262D8050), U64_C(0xD68CFAADB1B1B631), U64_C(0x549DEED10B48D537),
+        U64_C(0x7FB7270FA7201C5F), U64_C(0xFDA633731DD97F59), U64_C(0x4F4C29A58A454938), U64_C(0xCD5D3DD930BC2A3E),
+        U64_C(0x1E413A5BFDEAB691), U64_C(0x9C502E274713D597), U64_C(0x2EBA34F1D08FE3F6), U64_C(0xACAB208D6A7680F0),
+        U64_C(0xBC5B1DA712B549C3), U64_C(0x3E4A09DBA84C2AC5), U64_C(0x8CA0130D3FD01CA4), U64_C(0x0EB1077185297FA2),
+        U64_C(0xDDAD00F3487FE30D), U64_C(0x5FBC148FF286800B), U64_C(0xED560E59651AB66A), U64_C(0x6F471A25DFE3D56C),
+        U64_C(0xCCB6740D949D240C), U64_C(0x4EA760712E64470A), U64_C(0xFC4D7AA7B9F8716B), U64_C(0x7E5C6EDB0301126D),
+        U64_C(0xAD406959CE578EC2), U64_C(0x2F517D2574AEEDC4), U64_C(0x9DBB67F3E332DBA5), U64_C(0x1FAA738F59CBB8A3),
+        U64_C(0x0F5A4EA521087190), U64_C(0x8D4B5AD99BF11296), U64_C(0x3FA1400F0C6D24F7), U64_C(0xBDB05473B69447F1),
+        U64_C(0x6EAC53F17BC2DB5E), U64_C(0xECBD478DC13BB858), U64_C(0x5E575D5B56A78E39), U64_C(0xDC464927EC5EED3F),
+        U64_C(0x2D6CA75898CDFF92), U64_C(0xAF7DB32422349C94), U64_C(0x1D97A9F2B5A8AAF5), U64_C(0x9F86BD8E0F51C9F3),
+        U64_C(0x4C9ABA0CC207555C), U64_C(0xCE8BAE7078FE365A), U64_C(0x7C61B4A6EF62003B), U64_C(0xFE70A0DA559B633D),
+        U64_C(0xEE809DF02D58AA0E), U64_C(0x6C91898C97A1C908), U64_C(0xDE7B935A003DFF69), U64_C(0x5C6A8726BAC49C6F),
+        U64_C(0x8F7680A4779200C0), U64_C(0x0D6794D8CD6B63C6), U64_C(0xBF8D8E0E5AF755A7), U64_C(0x3D9C9A72E00E36A1),
+        U64_C(0x9E6DF45AAB70C7C1), U64_C(0x1C7CE0261189A4C7), U64_C(0xAE96FAF0861592A6), U64_C(0x2C87EE8C3CECF1A0),
+        U64_C(0xFF9BE90EF1BA6D0F), U64_C(0x7D8AFD724B430E09), U64_C(0xCF60E7A4DCDF3868), U64_C(0x4D71F3D866265B6E),
+        U64_C(0x5D81CEF21EE5925D), U64_C(0xDF90DA8EA41CF15B), U64_C(0x6D7AC0583380C73A), U64_C(0xEF6BD4248979A43C),
+        U64_C(0x3C77D3A6442F3893), U64_C(0xBE66C7DAFED65B95), U64_C(0x0C8CDD0C694A6DF4), U64_C(0x8E9DC970D3B30EF2),
+        U64_C(0xDA0027A1D8FBDBC5), U64_C(0x581133DD6202B8C3), U64_C(0xEAFB290BF59E8EA2), U64_C(0x68EA3D774F67EDA4),
+        U64_C(0xBBF63AF58231710B), U64_C(0x39E72E8938C8120D), U64_C(0x8B0D345FAF54246C), U64_C(0x091C202315AD476A),
+        U64_C(0x19EC1D096D6E8E59), U64_C(0x9BFD0975D797ED5F), U64_C(0x291713A3400BDB3E), U64_C(0xAB0607DFFAF2B838),
+        U64_C(0x781A005D37A42497), U64_C(0xFA0B14218D5D4791), U64_C(0x48E10EF71AC171F0), U64_C(0xCAF01A8BA03812F6),
+        U64_C(0x690174A3EB46E396), U64_C(0xEB1060DF51BF8090), U64_C(0x59FA7A09C623B6F1), U64_C(0xDBEB6E757CDAD5F7),
+        U64_C(0x08F769F7B18C4958), U64_C(0x8AE67D8B0B752A5E), U64_C(0x380C675D9CE91C3F), U64_C(0xBA1D732126107F39),
+        U64_C(0xAAED4E0B5ED3B60A), U64_C(0x28FC5A77E42AD50C), U64_C(0x9A1640A173B6E36D), U64_C(0x180754DDC94F806B),
+        U64_C(0xCB1B535F04191CC4), U64_C(0x490A4723BEE07FC2), U64_C(0xFBE05DF5297C49A3), U64_C(0x79F1498993852AA5),
+        U64_C(0x88DBA7F6E7163808), U64_C(0x0ACAB38A5DEF5B0E), U64_C(0xB820A95CCA736D6F), U64_C(0x3A31BD20708A0E69),
+        U64_C(0xE92DBAA2BDDC92C6), U64_C(0x6B3CAEDE0725F1C0), U64_C(0xD9D6B40890B9C7A1), U64_C(0x5BC7A0742A40A4A7),
+        U64_C(0x4B379D5E52836D94), U64_C(0xC9268922E87A0E92), U64_C(0x7BCC93F47FE638F3), U64_C(0xF9DD8788C51F5BF5),
+        U64_C(0x2AC1800A0849C75A), U64_C(0xA8D09476B2B0A45C), U64_C(0x1A3A8EA0252C923D), U64_C(0x982B9ADC9FD5F13B),
+        U64_C(0x3BDAF4F4D4AB005B), U64_C(0xB9CBE0886E52635D), U64_C(0x0B21FA5EF9CE553C), U64_C(0x8930EE224337363A),
+        U64_C(0x5A2CE9A08E61AA95), U64_C(0xD83DFDDC3498C993), U64_C(0x6AD7E70AA304FFF2), U64_C(0xE8C6F37619FD9CF4),
+        U64_C(0xF836CE5C613E55C7), U64_C(0x7A27DA20DBC736C1), U64_C(0xC8CDC0F64C5B00A0), U64_C(0x4ADCD48AF6A263A6),
+        U64_C(0x99C0D3083BF4FF09), U64_C(0x1BD1C774810D9C0F), U64_C(0xA93BDDA21691AA6E), U64_C(0x2B2AC9DEAC68C968),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x373D15F784905D1E), U64_C(0x6E7A2BEF0920BA3C), U64_C(0x59473E188DB0E722),
+        U64_C(0xDCF457DE12417478), U64_C(0xEBC9422996D12966), U64_C(0xB28E7C311B61CE44), U64_C(0x85B369C69FF1935A),
+        U64_C(0x8D3189EF7C157B9B), U64_C(0xBA0C9C18F8852685), U64_C(0xE34BA2007535C1A7), U64_C(0xD476B7F7F1A59CB9),
+        U64_C(0x51C5DE316E540FE3), U64_C(0x66F8CBC6EAC452FD), U64_C(0x3FBFF5DE6774B5DF), U64_C(0x0882E029E3E4E8C1),
+        U64_C(0x2EBA358DA0BD645D), U64_C(0x1987207A242D3943), U64_C(0x40C01E62A99DDE61), U64_C(0x77FD0B952D0D837F),
+        U64_C(0xF24E6253B2FC1025), U64_C(0xC57377A4366C4D3B), U64_C(0x9C3449BCBBDCAA19), U64_C(0xAB095C4B3F4CF707),
+        U64_C(0xA38BBC62DCA81FC6), U64_C(0x94B6A995583842D8), U64_C(0xCDF1978DD588A5FA), U64_C(0xFACC827A5118F8E4),
+        U64_C(0x7F7FEBBCCEE96BBE), U64_C(0x4842FE4B4A7936A0), U64_C(0x1105C053C7C9D182), U64_C(0x2638D5A443598C9C),
+        U64_C(0x5D746B1B417AC8BA), U64_C(0x6A497EECC5EA95A4), U64_C(0x330E40F4485A7286), U64_C(0x04335503CCCA2F98),
+        U64_C(0x81803CC5533BBCC2), U64_C(0xB6BD2932D7ABE1DC), U64_C(0xEFFA172A5A1B06FE), U64_C(0xD8C702DDDE8B5BE0),
+        U64_C(0xD045E2F43D6FB321), U64_C(0xE778F703B9FFEE3F), U64_C(0xBE3FC91B344F091D), U64_C(0x8902DCECB0DF5403),
+        U64_C(0x0CB1B52A2F2EC759), U64_C(0x3B8CA0DDABBE9A47), U64_C(0x62CB9EC5260E7D65), U64_C(0x55F68B32A29E207B),
+        U64_C(0x73CE5E96E1C7ACE7), U64_C(0x44F34B616557F1F9), U64_C(0x1DB47579E8E716DB), U64_C(0x2A89608E6C774BC5),
+        U64_C(0xAF3A0948F386D89F), U64_C(0x98071CBF77168581), U64_C(0xC14022A7FAA662A3), U64_C(0xF67D37507E363FBD),
+        U64_C(0xFEFFD7799DD2D77C), U64_C(0xC9C2C28E19428A62), U64_C(0x9085FC9694F26D40), U64_C(0xA7B8E9611062305E),
+        U64_C(0x220B80A78F93A304), U64_C(0x153695500B03FE1A), U64_C(0x4C71AB4886B31938), U64_C(0x7B4CBEBF02234426),
+        U64_C(0xBAE8D63682F59174), U64_C(0x8DD5C3C10665CC6A), U64_C(0xD492FDD98BD52B48), U64_C(0xE3AFE82E0F457656),
+        U64_C(0x661C81E890B4E50C), U64_C(0x5121941F1424B812), U64_C(0x0866AA0799945F30), U64_C(0x3F5BBFF01D04022E),
+        U64_C(0x37D95FD9FEE0EAEF), U64_C(0x00E44A2E7A70B7F1), U64_C(0x59A37436F7C050D3), U64_C(0x6E9E61C173500DCD),
+        U64_C(0xEB2D0807ECA19E97), U64_C(0xDC101DF06831C389), U64_C(0x855723E8E58124AB), U64_C(0xB26A361F611179B5),
+        U64_C(0x9452E3BB2248F529), U64_C(0xA36FF64CA6D8A837), U64_C(0xFA28C8542B684F15), U64_C(0xCD15DDA3AFF8120B),
+        U64_C(0x48A6B46530098151), U64_C(0x7F9BA192B499DC4F), U64_C(0x26DC9F8A39293B6D), U64_C(0x11E18A7DBDB96673),
+        U64_C(0x19636A545E5D8EB2), U64_C(0x2E5E7FA3DACDD3AC), U64_C(0x771941BB577D348E), U64_C(0x4024544CD3ED6990),
+        U64_C(0xC5973D8A4C1CFACA), U64_C(0xF2AA287DC88CA7D4), U64_C(0xABED1665453C40F6), U64_C(0x9CD00392C1AC1DE8),
+        U64_C(0xE79CBD2DC38F59CE), U64_C(0xD0A1A8DA471F04D0), U64_C(0x89E696C2CAAFE3F2), U64_C(0xBEDB83354E3FBEEC),
+        U64_C(0x3B68EAF3D1CE2DB6), U64_C(0x0C55FF04555E70A8), U64_C(0x5512C11CD8EE978A), U64_C(0x622FD4EB5C7ECA94),
+        U64_C(0x6AAD34C2BF9A2255), U64_C(0x5D9021353B0A7F4B), U64_C(0x04D71F2DB6BA9869), U64_C(0x33EA0ADA322AC577),
+        U64_C(0xB659631CADDB562D), U64_C(0x816476EB294B0B33), U64_C(0xD82348F3A4FBEC11), U64_C(0xEF1E5D04206BB10F),
+        U64_C(0xC92688A063323D93), U64_C(0xFE1B9D57E7A2608D), U64_C(0xA75CA34F6A1287AF), U64_C(0x9061B6B8EE82DAB1),
+        U64_C(0x15D2DF7E717349EB), U64_C(0x22EFCA89F5E314F5), U64_C(0x7BA8F4917853F3D7), U64_C(0x4C95E166FCC3AEC9),
+        U64_C(0x4417014F1F274608), U64_C(0x732A14B89BB71B16), U64_C(0x2A6D2AA01607FC34), U64_C(0x1D503F579297A12A),
+        U64_C(0x98E356910D663270), U64_C(0xAFDE436689F66F6E), U64_C(0xF6997D7E0446884C), U64_C(0xC1A4688980D6D552),
+        U64_C(0x41088A3E5D7CB183), U64_C(0x76359FC9D9ECEC9D), U64_C(0x2F72A1D1545C0BBF), U64_C(0x184FB426D0CC56A1),
+        U64_C(0x9DFCDDE04F3DC5FB), U64_C(0xAAC1C817CBAD98E5), U64_C(0xF386F60F461D7FC7), U64_C(0xC4BBE3F8C28D22D9),
+        U64_C(0xCC3903D12169CA18), U64_C(0xFB041626A5F99706), U64_C(0xA243283E28497024), U64_C(0x957E3DC9ACD92D3A),
+        U64_C(0x10CD540F3328BE60), U64_C(0x27F041F8B7B8E37E), U64_C(0x7EB77FE03A08045C), U64_C(0x498A6A17BE985942),
+        U64_C(0x6FB2BFB3FDC1D5DE), U64_C(0x588FAA44795188C0), U64_C(0x01C8945CF4E16FE2), U64_C(0x36F581AB707132FC),
+        U64_C(0xB346E86DEF80A1A6), U64_C(0x847BFD9A6B10FCB8), U64_C(0xDD3CC382E6A01B9A), U64_C(0xEA01D67562304684),
+        U64_C(0xE283365C81D4AE45), U64_C(0xD5BE23AB0544F35B), U64_C(0x8CF91DB388F41479), U64_C(0xBBC408440C644967),
+        U64_C(0x3E7761829395DA3D), U64_C(0x094A747517058723), U64_C(0x500D4A6D9AB56001), U64_C(0x67305F9A1E253D1F),
+        U64_C(0x1C7CE1251C067939), U64_C(0x2B41F4D298962427), U64_C(0x7206CACA1526C305), U64_C(0x453BDF3D91B69E1B),
+        U64_C(0xC088B6FB0E470D41), U64_C(0xF7B5A30C8AD7505F), U64_C(0xAEF29D140767B77D), U64_C(0x99CF88E383F7EA63),
+        U64_C(0x914D68CA601302A2), U64_C(0xA6707D3DE4835FBC), U64_C(0xFF3743256933B89E), U64_C(0xC80A56D2EDA3E580),
+        U64_C(0x4DB93F14725276DA), U64_C(0x7A842AE3F6C22BC4), U64_C(0x23C314FB7B72CCE6), U64_C(0x14FE010CFFE291F8),
+        U64_C(0x32C6D4A8BCBB1D64), U64_C(0x05FBC15F382B407A), U64_C(0x5CBCFF47B59BA758), U64_C(0x6B81EAB0310BFA46),
+        U64_C(0xEE328376AEFA691C), U64_C(0xD90F96812A6A3402), U64_C(0x8048A899A7DAD320), U64_C(0xB775BD6E234A8E3E),
+        U64_C(0xBFF75D47C0AE66FF), U64_C(0x88CA48B0443E3BE1), U64_C(0xD18D76A8C98EDCC3), U64_C(0xE6B0635F4D1E81DD),
+        U64_C(0x63030A99D2EF1287), U64_C(0x543E1F6E567F4F99), U64_C(0x0D792176DBCFA8BB), U64_C(0x3A4434815F5FF5A5),
+        U64_C(0xFBE05C08DF8920F7), U64_C(0xCCDD49FF5B197DE9), U64_C(0x959A77E7D6A99ACB), U64_C(0xA2A762105239C7D5),
+        U64_C(0x27140BD6CDC8548F), U64_C(0x10291E2149580991), U64_C(0x496E2039C4E8EEB3), U64_C(0x7E5335CE4078B3AD),
+        U64_C(0x76D1D5E7A39C5B6C), U64_C(0x41ECC010270C0672), U64_C(0x18ABFE08AABCE150), U64_C(0x2F96EBFF2E2CBC4E),
+        U64_C(0xAA258239B1DD2F14), U64_C(0x9D1897CE354D720A), U64_C(0xC45FA9D6B8FD9528), U64_C(0xF362BC213C6DC836),
+        U64_C(0xD55A69857F3444AA), U64_C(0xE2677C72FBA419B4), U64_C(0xBB20426A7614FE96), U64_C(0x8C1D579DF284A388),
+        U64_C(0x09AE3E5B6D7530D2), U64_C(0x3E932BACE9E56DCC), U64_C(0x67D415B464558AEE), U64_C(0x50E90043E0C5D7F0),
+        U64_C(0x586BE06A03213F31), U64_C(0x6F56F59D87B1622F), U64_C(0x3611CB850A01850D), U64_C(0x012CDE728E91D813),
+        U64_C(0x849FB7B411604B49), U64_C(0xB3A2A24395F01657), U64_C(0xEAE59C5B1840F175), U64_C(0xDDD889AC9CD0AC6B),
+        U64_C(0xA69437139EF3E84D), U64_C(0x91A922E41A63B553), U64_C(0xC8EE1CFC97D35271), U64_C(0xFFD3090B13430F6F),
+        U64_C(0x7A6060CD8CB29C35), U64_C(0x4D5D753A0822C12B), U64_C(0x141A4B2285922609), U64_C(0x23275ED501027B17),
+        U64_C(0x2BA5BEFCE2E693D6), U64_C(0x1C98AB0B6676CEC8), U64_C(0x45DF9513EBC629EA), U64_C(0x72E280E46F5674F4),
+        U64_C(0xF751E922F0A7E7AE), U64_C(0xC06CFCD57437BAB0), U64_C(0x992BC2CDF9875D92), U64_C(0xAE16D73A7D17008C),
+        U64_C(0x882E029E3E4E8C10), U64_C(0xBF131769BADED10E), U64_C(0xE6542971376E362C), U64_C(0xD1693C86B3FE6B32),
+        U64_C(0x54DA55402C0FF868), U64_C(0x63E740B7A89FA576), U64_C(0x3AA07EAF252F4254), U64_C(0x0D9D6B58A1BF1F4A),
+        U64_C(0x051F8B71425BF78B), U64_C(0x32229E86C6CBAA95), U64_C(0x6B65A09E4B7B4DB7), U64_C(0x5C58B569CFEB10A9),
+        U64_C(0xD9EBDCAF501A83F3), U64_C(0xEED6C958D48ADEED), U64_C(0xB791F740593A39CF), U64_C(0x80ACE2B7DDAA64D1),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0xE9742A79EF04A5D4), U64_C(0xE63172A0869ED8C3), U64_C(0x0F4558D9699A7D17),
+        U64_C(0xF8BBC31255AA22ED), U64_C(0x11CFE96BBAAE8739), U64_C(0x1E8AB1B2D334FA2E), U64_C(0xF7FE9BCB3C305FFA),
+        U64_C(0xC5AEA077F3C3D6B1), U64_C(0x2CDA8A0E1CC77365), U64_C(0x239FD2D7755D0E72), U64_C(0xCAEBF8AE9A59ABA6),
+        U64_C(0x3D156365A669F45C), U64_C(0xD461491C496D5188), U64_C(0xDB2411C520F72C9F), U64_C(0x32503BBCCFF3894B),
+        U64_C(0xBF8466BCBF103E09), U64_C(0x56F04CC550149BDD), U64_C(0x59B5141C398EE6CA), U64_C(0xB0C13E65D68A431E),
+        U64_C(0x473FA5AEEABA1CE4), U64_C(0xAE4B8FD705BEB930), U64_C(0xA10ED70E6C24C427), U64_C(0x487AFD77832061F3),
+        U64_C(0x7A2AC6CB4CD3E8B8), U64_C(0x935EECB2A3D74D6C), U64_C(0x9C1BB46BCA4D307B), U64_C(0x756F9E12254995AF),
+        U64_C(0x829105D91979CA55), U64_C(0x6BE52FA0F67D6F81), U64_C(0x64A077799FE71296), U64_C(0x8DD45D0070E3B742),
+        U64_C(0x4BD1EB2A26B7EF79), U64_C(0xA2A5C153C9B34AAD), U64_C(0xADE0998AA02937BA), U64_C(0x4494B3F34F2D926E),
+        U64_C(0xB36A2838731DCD94), U64_C(0x5A1E02419C196840), U64_C(0x555B5A98F5831557), U64_C(0xBC2F70E11A87B083),
+        U64_C(0x8E7F4B5DD57439C8), U64_C(0x670B61243A709C1C), U64_C(0x684E39FD53EAE10B), U64_C(0x813A1384BCEE44DF),
+        U64_C(0x76C4884F80DE1B25), U64_C(0x9FB0A2366FDABEF1), U64_C(0x90F5FAEF0640C3E6), U64_C(0x7981D096E9446632),
+        U64_C(0xF4558D9699A7D170), U64_C(0x1D21A7EF76A374A4), U64_C(0x1264FF361F3909B3), U64_C(0xFB10D54FF03DAC67),
+        U64_C(0x0CEE4E84CC0DF39D), U64_C(0xE59A64FD23095649), U64_C(0xEADF3C244A932B5E), U64_C(0x03AB165DA5978E8A),
+        U64_C(0x31FB2DE16A6407C1), U64_C(0xD88F07988560A215), U64_C(0xD7CA5F41ECFADF02), U64_C(0x3EBE753803FE7AD6),
+        U64_C(0xC940EEF33FCE252C), U64_C(0x2034C48AD0CA80F8), U64_C(0x2F719C53B950FDEF), U64_C(0xC605B62A5654583B),
+        U64_C(0x97A3D6544D6FDEF2), U64_C(0x7ED7FC2DA26B7B26), U64_C(0x7192A4F4CBF10631), U64_C(0x98E68E8D24F5A3E5),
+        U64_C(0x6F18154618C5FC1F), U64_C(0x866C3F3FF7C159CB), U64_C(0x892967E69E5B24DC), U64_C(0x605D4D9F715F8108),
+        U64_C(0x520D7623BEAC0843), U64_C(0xBB795C5A51A8AD97), U64_C(0xB43C04833832D080), U64_C(0x5D482EFAD7367554),
+        U64_C(0xAAB6B531EB062AAE), U64_C(0x43C29F4804028F7A), U64_C(0x4C87C7916D98F26D), U64_C(0xA5F3EDE8829C57B9),
+        U64_C(0x2827B0E8F27FE0FB), U64_C(0xC1539A911D7B452F), U64_C(0xCE16C24874E13838), U64_C(0x2762E8319BE59DEC),
+        U64_C(0xD09C73FAA7D5C216), U64_C(0x39E8598348D167C2), U64_C(0x36AD015A214B1AD5), U64_C(0xDFD92B23CE4FBF01),
+        U64_C(0xED89109F01BC364A), U64_C(0x04FD3AE6EEB8939E), U64_C(0x0BB8623F8722EE89), U64_C(0xE2CC484668264B5D),
+        U64_C(0x1532D38D541614A7), U64_C(0xFC46F9F4BB12B173), U64_C(0xF303A12DD288CC64), U64_C(0x1A778B543D8C69B0),
+        U64_C(0xDC723D7E6BD8318B), U64_C(0x3506170784DC945F), U64_C(0x3A434FDEED46E948), U64_C(0xD33765A702424C9C),
+        U64_C(0x24C9FE6C3E721366), U64_C(0xCDBDD415D176B6B2), U64_C(0xC2F88CCCB8ECCBA5), U64_C(0x2B8CA6B557E86E71),
+        U64_C(0x19DC9D09981BE73A), U64_C(0xF0A8B770771F42EE), U64_C(0xFFEDEFA91E853FF9), U64_C(0x1699C5D0F1819A2D),
+        U64_C(0xE1675E1BCDB1C5D7), U64_C(0x0813746222B56003), U64_C(0x07562CBB4B2F1D14), U64_C(0xEE2206C2A42BB8C0),
+        U64_C(0x63F65BC2D4C80F82), U64_C(0x8A8271BB3BCCAA56), U64_C(0x85C729625256D741), U64_C(0x6CB3031BBD527295),
+        U64_C(0x9B4D98D081622D6F), U64_C(0x7239B2A96E6688BB), U64_C(0x7D7CEA7007FCF5AC), U64_C(0x9408C009E8F85078),
+        U64_C(0xA658FBB5270BD933), U64_C(0x4F2CD1CCC80F7CE7), U64_C(0x40698915A19501F0), U64_C(0xA91DA36C4E91A424),
+        U64_C(0x5EE338A772A1FBDE), U64_C(0xB79712DE9DA55E0A), U64_C(0xB8D24A07F43F231D), U64_C(0x51A6607E1B3B86C9),
+        U64_C(0x1B9E8AFBC2482E8F), U64_C(0xF2EAA0822D4C8B5B), U64_C(0xFDAFF85B44D6F64C), U64_C(0x14DBD222ABD25398),
+        U64_C(0xE32549E997E20C62), U64_C(0x0A51639078E6A9B6), U64_C(0x05143B49117CD4A1), U64_C(0xEC601130FE787175),
+        U64_C(0xDE302A8C318BF83E), U64_C(0x374400F5DE8F5DEA), U64_C(0x3801582CB71520FD), U64_C(0xD175725558118529),
+        U64_C(0x268BE99E6421DAD3), U64_C(0xCFFFC3E78B257F07), U64_C(0xC0BA9B3EE2BF0210), U64_C(0x29CEB1470DBBA7C4),
+        U64_C(0xA41AEC477D581086), U64_C(0x4D6EC63E925CB552), U64_C(0x422B9EE7FBC6C845), U64_C(0xAB5FB49E14C26D91),
+        U64_C(0x5CA12F5528F2326B), U64_C(0xB5D5052CC7F697BF), U64_C(0xBA905DF5AE6CEAA8), U64_C(0x53E4778C41684F7C),
+        U64_C(0x61B44C308E9BC637), U64_C(0x88C06649619F63E3), U64_C(0x87853E9008051EF4), U64_C(0x6EF114E9E701BB20),
+        U64_C(0x990F8F22DB31E4DA), U64_C(0x707BA55B3435410E), U64_C(0x7F3EFD825DAF3C19), U64_C(0x964AD7FBB2AB99CD),
+        U64_C(0x504F61D1E4FFC1F6), U64_C(0xB93B4BA80BFB6422), U64_C(0xB67E137162611935), U64_C(0x5F0A39088D65BCE1),
+        U64_C(0xA8F4A2C3B155E31B), U64_C(0x418088BA5E5146CF), U64_C(0x4EC5D06337CB3BD8), U64_C(0xA7B1FA1AD8CF9E0C),
+        U64_C(0x95E1C1A6173C1747), U64_C(0x7C95EBDFF838B293), U64_C(0x73D0B30691A2CF84), U64_C(0x9AA4997F7EA66A50),
+        U64_C(0x6D5A02B4429635AA), U64_C(0x842E28CDAD92907E), U64_C(0x8B6B7014C408ED69), U64_C(0x621F5A6D2B0C48BD),
+        U64_C(0xEFCB076D5BEFFFFF), U64_C(0x06BF2D14B4EB5A2B), U64_C(0x09FA75CDDD71273C), U64_C(0xE08E5FB4327582E8),
+        U64_C(0x1770C47F0E45DD12), U64_C(0xFE04EE06E14178C6), U64_C(0xF141B6DF88DB05D1), U64_C(0x18359CA667DFA005),
+        U64_C(0x2A65A71AA82C294E), U64_C(0xC3118D6347288C9A), U64_C(0xCC54D5BA2EB2F18D), U64_C(0x2520FFC3C1B65459),
+        U64_C(0xD2DE6408FD860BA3), U64_C(0x3BAA4E711282AE77), U64_C(0x34EF16A87B18D360), U64_C(0xDD9B3CD1941C76B4),
+        U64_C(0x8C3D5CAF8F27F07D), U64_C(0x654976D6602355A9), U64_C(0x6A0C2E0F09B928BE), U64_C(0x83780476E6BD8D6A),
+        U64_C(0x74869FBDDA8DD290), U64_C(0x9DF2B5C435897744), U64_C(0x92B7ED1D5C130A53), U64_C(0x7BC3C764B317AF87),
+        U64_C(0x4993FCD87CE426CC), U64_C(0xA0E7D6A193E08318), U64_C(0xAFA28E78FA7AFE0F), U64_C(0x46D6A401157E5BDB),
+        U64_C(0xB1283FCA294E0421), U64_C(0x585C15B3C64AA1F5), U64_C(0x57194D6AAFD0DCE2), U64_C(0xBE6D671340D47936),
+        U64_C(0x33B93A133037CE74), U64_C(0xDACD106ADF336BA0), U64_C(0xD58848B3B6A916B7), U64_C(0x3CFC62CA59ADB363),
+        U64_C(0xCB02F901659DEC99), U64_C(0x2276D3788A99494D), U64_C(0x2D338BA1E303345A), U64_C(0xC447A1D80C07918E),
+        U64_C(0xF6179A64C3F418C5), U64_C(0x1F63B01D2CF0BD11), U64_C(0x1026E8C4456AC006), U64_C(0xF952C2BDAA6E65D2),
+        U64_C(0x0EAC5976965E3A28), U64_C(0xE7D8730F795A9FFC), U64_C(0xE89D2BD610C0E2EB), U64_C(0x01E901AFFFC4473F),
+        U64_C(0xC7ECB785A9901F04), U64_C(0x2E989DFC4694BAD0), U64_C(0x21DDC5252F0EC7C7), U64_C(0xC8A9EF5CC00A6213),
+        U64_C(0x3F577497FC3A3DE9), U64_C(0xD6235EEE133E983D), U64_C(0xD96606377AA4E52A), U64_C(0x30122C4E95A040FE),
+        U64_C(0x024217F25A53C9B5), U64_C(0xEB363D8BB5576C61), U64_C(0xE4736552DCCD1176), U64_C(0x0D074F2B33C9B4A2),
+        U64_C(0xFAF9D4E00FF9EB58), U64_C(0x138DFE99E0FD4E8C), U64_C(0x1CC8A6408967339B), U64_C(0xF5BC8C396663964F),
+        U64_C(0x7868D1391680210D), U64_C(0x911CFB40F98484D9), U64_C(0x9E59A399901EF9CE), U64_C(0x772D89E07F1A5C1A),
+        U64_C(0x80D3122B432A03E0), U64_C(0x69A73852AC2EA634), U64_C(0x66E2608BC5B4DB23), U64_C(0x8F964AF22AB07EF7),
+        U64_C(0xBDC6714EE543F7BC), U64_C(0x54B25B370A475268), U64_C(0x5BF703EE63DD2F7F), U64_C(0xB28329978CD98AAB),
+        U64_C(0x457DB25CB0E9D551), U64_C(0xAC0998255FED7085), U64_C(0xA34CC0FC36770D92), U64_C(0x4A38EA85D973A846),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0xFC5D27F6BF353971), U64_C(0xCC6369BE26FDE189), U64_C(0x303E4E4899C8D8F8),
+        U64_C(0xAC1FF52F156C5079), U64_C(0x5042D2D9AA596908), U64_C(0x607C9C913391B1F0), U64_C(0x9C21BB678CA48881),
+        U64_C(0x6CE6CC0D724F3399), U64_C(0x90BBEBFBCD7A0AE8), U64_C(0xA085A5B354B2D210), U64_C(0x5CD88245EB87EB61),
+        U64_C(0xC0F93922672363E0), U64_C(0x3CA41ED4D8165A91), U64_C(0x0C9A509C41DE8269), U64_C(0xF0C7776AFEEBBB18),
+        U64_C(0xD9CD981AE49E6732), U64_C(0x2590BFEC5BAB5E43), U64_C(0x15AEF1A4C26386BB), U64_C(0xE9F3D6527D56BFCA),
+        U64_C(0x75D26D35F1F2374B), U64_C(0x898F4AC34EC70E3A), U64_C(0xB9B1048BD70FD6C2), U64_C(0x45EC237D683AEFB3),
+        U64_C(0xB52B541796D154AB), U64_C(0x497673E129E46DDA), U64_C(0x79483DA9B02CB522), U64_C(0x85151A5F0F198C53),
+        U64_C(0x1934A13883BD04D2), U64_C(0xE56986CE3C883DA3), U64_C(0xD557C886A540E55B), U64_C(0x290AEF701A75DC2A),
+        U64_C(0x8742166691AB5D0F), U64_C(0x7B1F31902E9E647E), U64_C(0x4B217FD8B756BC86), U64_C(0xB77C582E086385F7),
+        U64_C(0x2B5DE34984C70D76), U64_C(0xD700C4BF3BF23407), U64_C(0xE73E8AF7A23AECFF), U64_C(0x1B63AD011D0FD58E),
+        U64_C(0xEBA4DA6BE3E46E96), U64_C(0x17F9FD9D5CD157E7), U64_C(0x27C7B3D5C5198F1F), U64_C(0xDB9A94237A2CB66E),
+        U64_C(0x47BB2F44F6883EEF), U64_C(0xBBE608B249BD079E), U64_C(0x8BD846FAD075DF66), U64_C(0x7785610C6F40E617),
+        U64_C(0x5E8F8E7C75353A3D), U64_C(0xA2D2A98ACA00034C), U64_C(0x92ECE7C253C8DBB4), U64_C(0x6EB1C034ECFDE2C5),
+        U64_C(0xF2907B5360596A44), U64_C(0x0ECD5CA5DF6C5335), U64_C(0x3EF312ED46A48BCD), U64_C(0xC2AE351BF991B2BC),
+        U64_C(0x32694271077A09A4), U64_C(0xCE346587B84F30D5), U64_C(0xFE0A2BCF2187E82D), U64_C(0x02570C399EB2D15C),
+        U64_C(0x9E76B75E121659DD), U64_C(0x622B90A8AD2360AC), U64_C(0x5215DEE034EBB854), U64_C(0xAE48F9168BDE8125),
+        U64_C(0x3A5D0A9E7BC12975), U64_C(0xC6002D68C4F41004), U64_C(0xF63E63205D3CC8FC), U64_C(0x0A6344D6E209F18D),
+        U64_C(0x9642FFB16EAD790C), U64_C(0x6A1FD847D198407D), U64_C(0x5A21960F48509885), U64_C(0xA67CB1F9F765A1F4),
+        U64_C(0x56BBC693098E1AEC), U64_C(0xAAE6E165B6BB239D), U64_C(0x9AD8AF2D2F73FB65), U64_C(0x668588DB9046C214),
+        U64_C(0xFAA433BC1CE24A95), U64_C(0x06F9144AA3D773E4), U64_C(0x36C75A023A1FAB1C), U64_C(0xCA9A7DF4852A926D),
+        U64_C(0xE39092849F5F4E47), U64_C(0x1FCDB572206A7736), U64_C(0x2FF3FB3AB9A2AFCE), U64_C(0xD3AEDCCC069796BF),
+        U64_C(0x4F8F67AB8A331E3E), U64_C(0xB3D2405D3506274F), U64_C(0x83EC0E15ACCEFFB7), U64_C(0x7FB129E313FBC6C6),
+        U64_C(0x8F765E89ED107DDE), U64_C(0x732B797F522544AF), U64_C(0x43153737CBED9C57), U64_C(0xBF4810C174D8A526),
+        U64_C(0x2369ABA6F87C2DA7), U64_C(0xDF348C50474914D6), U64_C(0xEF0AC218DE81CC2E), U64_C(0x1357E5EE61B4F55F),
+        U64_C(0xBD1F1CF8EA6A747A), U64_C(0x41423B0E555F4D0B), U64_C(0x717C7546CC9795F3), U64_C(0x8D2152B073A2AC82),
+        U64_C(0x1100E9D7FF062403), U64_C(0xED5DCE2140331D72), U64_C(0xDD638069D9FBC58A), U64_C(0x213EA79F66CEFCFB),
+        U64_C(0xD1F9D0F5982547E3), U64_C(0x2DA4F70327107E92), U64_C(0x1D9AB94BBED8A66A), U64_C(0xE1C79EBD01ED9F1B),
+        U64_C(0x7DE625DA8D49179A), U64_C(0x81BB022C327C2EEB), U64_C(0xB1854C64ABB4F613), U64_C(0x4DD86B921481CF62),
+        U64_C(0x64D284E20EF41348), U64_C(0x988FA314B1C12A39), U64_C(0xA8B1ED5C2809F2C1), U64_C(0x54ECCAAA973CCBB0),
+        U64_C(0xC8CD71CD1B984331), U64_C(0x3490563BA4AD7A40), U64_C(0x04AE18733D65A2B8), U64_C(0xF8F33F8582509BC9),
+        U64_C(0x083448EF7CBB20D1), U64_C(0xF4696F19C38E19A0), U64_C(0xC45721515A46C158), U64_C(0x380A06A7E573F829),
+        U64_C(0xA42BBDC069D770A8), U64_C(0x58769A36D6E249D9), U64_C(0x6848D47E4F2A9121), U64_C(0x9415F388F01FA850),
+        U64_C(0x74BA153CF78252EA), U64_C(0x88E732CA48B76B9B), U64_C(0xB8D97C82D17FB363), U64_C(0x44845B746E4A8A12),
+        U64_C(0xD8A5E013E2EE0293), U64_C(0x24F8C7E55DDB3BE2), U64_C(0x14C689ADC413E31A), U64_C(0xE89BAE5B7B26DA6B),
+        U64_C(0x185CD93185CD6173), U64_C(0xE401FEC73AF85802), U64_C(0xD43FB08FA33080FA), U64_C(0x286297791C05B98B),
+        U64_C(0xB4432C1E90A1310A), U64_C(0x481E0BE82F94087B), U64_C(0x782045A0B65CD083), U64_C(0x847D62560969E9F2),
+        U64_C(0xAD778D26131C35D8), U64_C(0x512AAAD0AC290CA9), U64_C(0x6114E49835E1D451), U64_C(0x9D49C36E8AD4ED20),
+        U64_C(0x01687809067065A1), U64_C(0xFD355FFFB9455CD0), U64_C(0xCD0B11B7208D8428), U64_C(0x315636419FB8BD59),
+        U64_C(0xC191412B61530641), U64_C(0x3DCC66DDDE663F30), U64_C(0x0DF2289547AEE7C8), U64_C(0xF1AF0F63F89BDEB9),
+        U64_C(0x6D8EB404743F5638), U64_C(0x91D393F2CB0A6F49), U64_C(0xA1EDDDBA52C2B7B1), U64_C(0x5DB0FA4CEDF78EC0),
+        U64_C(0xF3F8035A66290FE5), U64_C(0x0FA524ACD91C3694), U64_C(0x3F9B6AE440D4EE6C), U64_C(0xC3C64D12FFE1D71D),
+        U64_C(0x5FE7F67573455F9C), U64_C(0xA3BAD183CC7066ED), U64_C(0x93849FCB55B8BE15), U64_C(0x6FD9B83DEA8D8764),
+        U64_C(0x9F1ECF5714663C7C), U64_C(0x6343E8A1AB53050D), U64_C(0x537DA6E9329BDDF5), U64_C(0xAF20811F8DAEE484),
+        U64_C(0x33013A78010A6C05), U64_C(0xCF5C1D8EBE3F5574), U64_C(0xFF6253C627F78D8C), U64_C(0x033F743098C2B4FD),
+        U64_C(0x2A359B4082B768D7), U64_C(0xD668BCB63D8251A6), U64_C(0xE656F2FEA44A895E), U64_C(0x1A0BD5081B7FB02F),
+        U64_C(0x862A6E6F97DB38AE), U64_C(0x7A77499928EE01DF), U64_C(0x4A4907D1B126D927), U64_C(0xB61420270E13E056),
+        U64_C(0x46D3574DF0F85B4E), U64_C(0xBA8E70BB4FCD623F), U64_C(0x8AB03EF3D605BAC7), U64_C(0x76ED1905693083B6),
+        U64_C(0xEACCA262E5940B37), U64_C(0x169185945AA13246), U64_C(0x26AFCBDCC369EABE), U64_C(0xDAF2EC2A7C5CD3CF),
+        U64_C(0x4EE71FA28C437B9F), U64_C(0xB2BA3854337642EE), U64_C(0x8284761CAABE9A16), U64_C(0x7ED951EA158BA367),
+        U64_C(0xE2F8EA8D992F2BE6), U64_C(0x1EA5CD7B261A1297), U64_C(0x2E9B8333BFD2CA6F), U64_C(0xD2C6A4C500E7F31E),
+        U64_C(0x2201D3AFFE0C4806), U64_C(0xDE5CF45941397177), U64_C(0xEE62BA11D8F1A98F), U64_C(0x123F9DE767C490FE),
+        U64_C(0x8E1E2680EB60187F), U64_C(0x724301765455210E), U64_C(0x427D4F3ECD9DF9F6), U64_C(0xBE2068C872A8C087),
+        U64_C(0x972A87B868DD1CAD), U64_C(0x6B77A04ED7E825DC), U64_C(0x5B49EE064E20FD24), U64_C(0xA714C9F0F115C455),
+        U64_C(0x3B3572977DB14CD4), U64_C(0xC7685561C28475A5), U64_C(0xF7561B295B4CAD5D), U64_C(0x0B0B3CDFE479942C),
+        U64_C(0xFBCC4BB51A922F34), U64_C(0x07916C43A5A71645), U64_C(0x37AF220B3C6FCEBD), U64_C(0xCBF205FD835AF7CC),
+        U64_C(0x57D3BE9A0FFE7F4D), U64_C(0xAB8E996CB0CB463C), U64_C(0x9BB0D72429039EC4), U64_C(0x67EDF0D29636A7B5),
+        U64_C(0xC9A509C41DE82690), U64_C(0x35F82E32A2DD1FE1), U64_C(0x05C6607A3B15C719), U64_C(0xF99B478C8420FE68),
+        U64_C(0x65BAFCEB088476E9), U64_C(0x99E7DB1DB7B14F98), U64_C(0xA9D995552E799760), U64_C(0x5584B2A3914CAE11),
+        U64_C(0xA543C5C96FA71509), U64_C(0x591EE23FD0922C78), U64_C(0x6920AC77495AF480), U64_C(0x957D8B81F66FCDF1),
+        U64_C(0x095C30E67ACB4570), U64_C(0xF5011710C5FE7C01), U64_C(0xC53F59585C36A4F9), U64_C(0x39627EAEE3039D88),
+        U64_C(0x106891DEF97641A2), U64_C(0xEC35B628464378D3), U64_C(0xDC0BF860DF8BA02B), U64_C(0x2056DF9660BE995A),
+        U64_C(0xBC7764F1EC1A11DB), U64_C(0x402A4307532F28AA), U64_C(0x70140D4FCAE7F052), U64_C(0x8C492AB975D2C923),
+        U64_C(0x7C8E5DD38B39723B), U64_C(0x80D37A25340C4B4A), U64_C(0xB0ED346DADC493B2), U64_C(0x4CB0139B12F1AAC3),
+        U64_C(0xD091A8FC9E552242), U64_C(0x2CCC8F0A21601B33), U64_C(0x1CF2C142B8A8C3CB), U64_C(0xE0AFE6B4079DFABA),
+    },
+    {
+        U64_C(0x0000000000000000), U64_C(0x21E9761E252621AC), U64_C(0x43D2EC3C4A4C4358), U64_C(0x623B9A226F6A62F4),
+        U64_C(0x87A5D878949886B0), U64_C(0xA64CAE66B1BEA71C), U64_C(0xC4773444DED4C5E8), U64_C(0xE59E425AFBF2E444),
+        U64_C(0x3B9296A271A69E0B), U64_C(0x1A7BE0BC5480BFA7), U64_C(0x78407A9E3BEADD53), U64_C(0x59A90C801ECCFCFF),
+        U64_C(0xBC374EDAE53E18BB), U64_C(0x9DDE38C4C0183917), U64_C(0xFFE5A2E6AF725BE3), U64_C(0xDE0CD4F88A547A4F),
+        U64_C(0x77252D44E34D3C16), U64_C(0x56CC5B5AC66B1DBA), U64_C(0x34F7C178A9017F4E), U64_C(0x151EB7668C275EE2),
+        U64_C(0xF080F53C77D5BAA6), U64_C(0xD169832252F39B0A), U64_C(0xB35219003D99F9FE), U64_C(0x92BB6F1E18BFD852),
+        U64_C(0x4CB7BBE692EBA21D), U64_C(0x6D5ECDF8B7CD83B1), U64_C(0x0F6557DAD8A7E145), U64_C(0x2E8C21C4FD81C0E9),
+        U64_C(0xCB12639E067324AD), U64_C(0xEAFB158023550501), U64_C(0x88C08FA24C3F67F5), U64_C(0xA929F9BC69194659),
+        U64_C(0xEE4A5A89C69A782C), U64_C(0xCFA32C97E3BC5980), U64_C(0xAD98B6B58CD63B74), U64_C(0x8C71C0ABA9F01AD8),
+        U64_C(0x69EF82F15202FE9C), U64_C(0x4806F4EF7724DF30), U64_C(0x2A3D6ECD184EBDC4), U64_C(0x0BD418D33D689C68),
+        U64_C(0xD5D8CC2BB73CE627), U64_C(0xF431BA35921AC78B), U64_C(0x960A2017FD70A57F), U64_C(0xB7E35609D85684D3),
+        U64_C(0x527D145323A46097), U64_C(0x7394624D0682413B), U64_C(0x11AFF86F69E823CF), U64_C(0x30468E714CCE0263),
+        U64_C(0x996F77CD25D7443A), U64_C(0xB88601D300F16596), U64_C(0xDABD9BF16F9B0762), U64_C(0xFB54EDEF4ABD26CE),
+        U64_C(0x1ECAAFB5B14FC28A), U64_C(0x3F23D9AB9469E326), U64_C(0x5D184389FB0381D2), U64_C(0x7CF13597DE25A07E),
+        U64_C(0xA2FDE16F5471DA31), U64_C(0x831497717157FB9D), U64_C(0xE12F0D531E3D9969), U64_C(0xC0C67B4D3B1BB8C5),
+        U64_C(0x25583917C0E95C81), U64_C(0x04B14F09E5CF7D2D), U64_C(0x668AD52B8AA51FD9), U64_C(0x4763A335AF833E75),
+        U64_C(0xE84D9340D5A36333), U64_C(0xC9A4E55EF085429F), U64_C(0xAB9F7F7C9FEF206B), U64_C(0x8A760962BAC901C7),
+        U64_C(0x6FE84B38413BE583), U64_C(0x4E013D26641DC42F), U64_C(0x2C3AA7040B77A6DB), U64_C(0x0DD3D11A2E518777),
+        U64_C(0xD3DF05E2A405FD38), U64_C(0xF23673FC8123DC94), U64_C(0x900DE9DEEE49BE60), U64_C(0xB1E49FC0CB6F9FCC),
+        U64_C(0x547ADD9A309D7B88), U64_C(0x7593AB8415BB5A24), U64_C(0x17A831A67AD138D0), U64_C(0x364147B85FF7197C),
+        U64_C(0x9F68BE0436EE5F25), U64_C(0xBE81C81A13C87E89), U64_C(0xDCBA52387CA21C7D), U64_C(0xFD53242659843DD1),
+        U64_C(0x18CD667CA276D995), U64_C(0x392410628750F839), U64_C(0x5B1F8A40E83A9ACD), U64_C(0x7AF6FC5ECD1CBB61),
+        U64_C(0xA4FA28A64748C12E), U64_C(0x85135EB8626EE082), U64_C(0xE728C49A0D048276), U64_C(0xC6C1B2842822A3DA),
+        U64_C(0x235FF0DED3D0479E), U64_C(0x02B686C0F6F66632), U64_C(0x608D1CE2999C04C6), U64_C(0x41646AFCBCBA256A),
+        U64_C(0x0607C9C913391B1F), U64_C(0x27EEBFD7361F3AB3), U64_C(0x45D525F559755847), U64_C(0x643C53EB7C5379EB),
+        U64_C(0x81A211B187A19DAF), U64_C(0xA04B67AFA287BC03), U64_C(0xC270FD8DCDEDDEF7), U64_C(0xE3998B93E8CBFF5B),
+        U64_C(0x3D955F6B629F8514), U64_C(0x1C7C297547B9A4B8), U64_C(0x7E47B35728D3C64C), U64_C(0x5FAEC5490DF5E7E0),
+        U64_C(0xBA308713F60703A4), U64_C(0x9BD9F10DD3212208), U64_C(0xF9E26B2FBC4B40FC), U64_C(0xD80B1D31996D6150),
+        U64_C(0x7122E48DF0742709), U64_C(0x50CB9293D55206A5), U64_C(0x32F008B1BA386451), U64_C(0x13197EAF9F1E45FD),
+        U64_C(0xF6873CF564ECA1B9), U64_C(0xD76E4AEB41CA8015), U64_C(0xB555D0C92EA0E2E1), U64_C(0x94BCA6D70B86C34D),
+        U64_C(0x4AB0722F81D2B902), U64_C(0x6B590431A4F498AE), U64_C(0x09629E13CB9EFA5A), U64_C(0x288BE80DEEB8DBF6),
+        U64_C(0xCD15AA57154A3FB2), U64_C(0xECFCDC49306C1E1E), U64_C(0x8EC7466B5F067CEA), U64_C(0xAF2E30757A205D46),
+        U64_C(0xE44200D2F3D1550D), U64_C(0xC5AB76CCD6F774A1), U64_C(0xA790ECEEB99D1655), U64_C(0x86799AF09CBB37F9),
+        U64_C(0x63E7D8AA6749D3BD), U64_C(0x420EAEB4426FF211), U64_C(0x203534962D0590E5), U64_C(0x01DC42880823B149),
+        U64_C(0xDFD096708277CB06), U64_C(0xFE39E06EA751EAAA), U64_C(0x9C027A4CC83B885E), U64_C(0xBDEB0C52ED1DA9F2),
+        U64_C(0x58754E0816EF4DB6), U64_C(0x799C381633C96C1A), U64_C(0x1BA7A2345CA30EEE), U64_C(0x3A4ED42A79852F42),
+        U64_C(0x93672D96109C691B), U64_C(0xB28E5B8835BA48B7), U64_C(0xD0B5C1AA5AD02A43), U64_C(0xF15CB7B47FF60BEF),
+        U64_C(0x14C2F5EE8404EFAB), U64_C(0x352B83F0A122CE07), U64_C(0x571019D2CE48ACF3), U64_C(0x76F96FCCEB6E8D5F),
+        U64_C(0xA8F5BB34613AF710), U64_C(0x891CCD2A441CD6BC), U64_C(0xEB2757082B76B448), U64_C(0xCACE21160E5095E4),
+        U64_C(0x2F50634CF5A271A0), U64_C(0x0EB91552D084500C), U64_C(0x6C828F70BFEE32F8), U64_C(0x4D6BF96E9AC81354),
+        U64_C(0x0A085A5B354B2D21), U64_C(0x2BE12C45106D0C8D), U64_C(0x49DAB6677F076E79), U64_C(0x6833C0795A214FD5),
+        U64_C(0x8DAD8223A1D3AB91), U64_C(0xAC44F43D84F58A3D), U64_C(0xCE7F6E1FEB9FE8C9), U64_C(0xEF961801CEB9C965),
+        U64_C(0x319ACCF944EDB32A), U64_C(0x1073BAE761CB9286), U64_C(0x724820C50EA1F072), U64_C(0x53A156DB2B87D1DE),
+        U64_C(0xB63F1481D075359A), U64_C(0x97D6629FF5531436), U64_C(0xF5EDF8BD9A3976C2), U64_C(0xD4048EA3BF1F576E),
+        U64_C(0x7D2D771FD6061137), U64_C(0x5CC40101F320309B), U64_C(0x3EFF9B239C4A526F), U64_C(0x1F16ED3DB96C73C3),
+        U64_C(0xFA88AF67429E9787), U64_C(0xDB61D97967B8B62B), U64_C(0xB95A435B08D2D4DF), U64_C(0x98B335452DF4F573),
+        U64_C(0x46BFE1BDA7A08F3C), U64_C(0x675697A38286AE90), U64_C(0x056D0D81EDECCC64), U64_C(0x24847B9FC8CAEDC8),
+        U64_C(0xC11A39C53338098C), U64_C(0xE0F34FDB161E2820), U64_C(0x82C8D5F979744AD4), U64_C(0xA321A3E75C526B78),
+        U64_C(0x0C0F93922672363E), U64_C(0x2DE6E58C03541792), U64_C(0x4FDD7FAE6C3E7566), U64_C(0x6E3409B0491854CA),
+        U64_C(0x8BAA4BEAB2EAB08E), U64_C(0xAA433DF497CC9122), U64_C(0xC878A7D6F8A6F3D6), U64_C(0xE991D1C8DD80D27A),
+        U64_C(0x379D053057D4A835), U64_C(0x1674732E72F28999), U64_C(0x744FE90C1D98EB6D), U64_C(0x55A69F1238BECAC1),
+        U64_C(0xB038DD48C34C2E85), U64_C(0x91D1AB56E66A0F29), U64_C(0xF3EA317489006DDD), U64_C(0xD203476AAC264C71),
+        U64_C(0x7B2ABED6C53F0A28), U64_C(0x5AC3C8C8E0192B84), U64_C(0x38F852EA8F734970), U64_C(0x191124F4AA5568DC),
+        U64_C(0xFC8F66AE51A78C98), U64_C(0xDD6610B07481AD34), U64_C(0xBF5D8A921BEBCFC0), U64_C(0x9EB4FC8C3ECDEE6C),
+        U64_C(0x40B82874B4999423), U64_C(0x61515E6A91BFB58F), U64_C(0x036AC448FED5D77B), U64_C(0x2283B256DBF3F6D7),
+        U64_C(0xC71DF00C20011293), U64_C(0xE6F486120527333F), U64_C(0x84CF1C306A4D51CB), U64_C(0xA5266A2E4F6B7067),
+        U64_C(0xE245C91BE0E84E12), U64_C(0xC3ACBF05C5CE6FBE), U64_C(0xA1972527AAA40D4A), U64_C(0x807E53398F822CE6),
+        U64_C(0x65E011637470C8A2), U64_C(0x4409677D5156E90E), U64_C(0x2632FD5F3E3C8BFA), U64_C(0x07DB8B411B1AAA56),
+        U64_C(0xD9D75FB9914ED019), U64_C(0xF83E29A7B468F1B5), U64_C(0x9A05B385DB029341), U64_C(0xBBECC59BFE24B2ED),
+        U64_C(0x5E7287C105D656A9), U64_C(0x7F9BF1DF20F07705), U64_C(0x1DA06BFD4F9A15F1), U64_C(0x3C491DE36ABC345D),
+        U64_C(0x9560E45F03A57204), U64_C(0xB4899241268353A8), U64_C(0xD6B2086349E9315C), U64_C(0xF75B7E7D6CCF10F0),
+        U64_C(0x12C53C27973DF4B4), U64_C(0x332C4A39B21BD518), U64_C(0x5117D01BDD71B7EC), U64_C(0x70FEA605F8579640),
+        U64_C(0xAEF272FD7203EC0F), U64_C(0x8F1B04E35725CDA3), U64_C(0xED209EC1384FAF57), U64_C(0xCCC9E8DF1D698EFB),
+        U64_C(0x2957AA85E69B6ABF), U64_C(0x08BEDC9BC3BD4B13), U64_C(0x6A8546B9ACD729E7), U64_C(0x4B6C30A789F1084B),
+    },
+};
+
+// CRC-64/NVME folding constants
+const crc_clmul_consts CRC64_NVME_CLMUL =
+{
+    .fold128 = { U64_C(0xEADC41FD2BA3D420), U64_C(0x21E9761E252621AC) },
+    .fold256 = { U64_C(0xB0BC2E589204F500), U64_C(0xE1E0BB9D45D7A44C) },
+    .fold512 = { U64_C(0x0C32CDB31E18A84A), U64_C(0x62242240ACE5045A) },
+    .fold1024 = { U64_C(0xA1CA681E733F9C40), U64_C(0x5F852FB61E8D92DC) },
+    .fold2048 = { U64_C(0x37CCD3E14069CABC), U64_C(0xA043808C0F782663) },
+};
@@ -1,7 +1,98 @@
 #pragma once
 
+#include <stdbool.h>
+
 #include "util.h"
 
+// Asynchronous file read engine options
+typedef struct crc_read_options
+{
+    // Number of reads kept in flight while earlier buffers are hashed.
+    // Zero selects the default depth.
+    size_t queue_depth;
+
+    // Size (in bytes) of each read request.
+    // Zero selects the default size.
+    size_t block_size;
+
+    // Bypass the page cache using O_DIRECT with aligned buffers
+    // (ignored if the file system does not support it).
+    bool direct;
+} crc_read_options;
+
+// File CRC read and hash statistics
+typedef struct crc_read_stats
+{
+    // Number of bytes read and hashed
+    u64 bytes;
+
+    // Wall clock time (in seconds) of the whole operation
+    double elapsed;
+
+    // Time (in seconds) spent submitting and waiting for file reads
+    double wait_time;
+
+    // Time (in seconds) spent hashing file data
+    double hash_time;
+
+    // Whether the io_uring engine was used (false for the fallback path)
+    bool async;
+} crc_read_stats;
+
+// Parameterized CRC model.
+// Parameters follow the Rocksoft/Williams model used by the CRC catalogues
+// (input and output reflection are always equal). Use the predefined models
+// below; their tables are generated when the library is built.
+typedef struct crc_model
+{
+    // Catalogue name of the model
+    const char* name;
+
+    // Width (in bits) of the CRC value
+    size_t width;
+
+    // Whether input bytes and the CRC value are bit-reflected
+    bool reflect;
+
+    // Generator polynomial in normal form (without the leading term)
+    u64 poly;
+
+    // Initial register value
+    u64 init;
+
+    // Value XORed into the final register
+    u64 xorout;
+
+    // CRC of the ASCII string "123456789"
+    u64 check;
+
+    // Engine implementation (private)
+    u64 (*update)(const struct crc_model * restrict model, u64 crc, const void * restrict data, size_t size);
+    const u64 (*table)[256];
+    const struct crc_clmul_consts* clmul;
+} crc_model;
+
+// CRC-16/IBM-3740 (also known as CRC-16/CCITT-FALSE)
+extern const crc_model CRC_MODEL_CRC16_IBM_3740;
+
+// CRC-16/KERMIT (also known as CRC-16/CCITT)
+extern const crc_model CRC_MODEL_CRC16_KERMIT;
+
+// CRC-32 (same as crc32)
+extern const crc_model CRC_MODEL_CRC32;
+
+// CRC-32C (same as crc32c)
+extern const crc_model CRC_MODEL_CRC32C;
+
+// CRC-64/ECMA-182
+extern const crc_model CRC_MODEL_CRC64_ECMA_182;
+
+// CRC-64/XZ (also known as CRC-64/GO-ECMA)
+extern const crc_model CRC_MODEL_CRC64_XZ;
+
+// CRC-64/NVME
+extern const crc_model CRC_MODEL_CRC64_NVME;
+
 // CRC-32 Table
 // Uses CRC polynomial 0x04C11DB7 (or 0xEDB88320 in reversed form)
 // This is used in Ethernet, SATA, and other protocols, formats, and systems.
@@ -18,8 +109,99 @@ u32 crc32(const void * const restrict data, size_t size);
 // Calculate the CRC-32C value of the provided data
 u32 crc32c(const void * const restrict data, size_t size);
 
+// Get the CRC value of empty data for the provided model.
+// This is the starting value to pass to crc_update.
+u64 crc_init(const crc_model * const restrict model);
+
+// Continue the CRC value `crc` of the provided model over more data.
+// Splitting data across several calls gives the same result as one call.
+u64 crc_update(const crc_model * const restrict model, u64 crc, const void * const restrict data, size_t size);
+
+// Calculate the CRC value of the provided data for the provided model
+u64 crc_compute(const crc_model * const restrict model, const void * const restrict data, size_t size);
+
+// Calculate the CRC-32 values of `count` independent buffers.
+// crcs[i] receives the CRC-32 of the sizes[i] bytes at buffers[i].
+void crc32_batch(
+    const void * const * const restrict buffers,
+    const size_t * const restrict sizes,
+    u32 * const restrict crcs,
+    size_t count);
+
+// Calculate the CRC-32C values of `count` independent buffers.
+// crcs[i] receives the CRC-32C of the sizes[i] bytes at buffers[i].
+// Interleaves several messages at once so small buffers approach the
+// large-buffer throughput.
+void crc32c_batch(
+    const void * const * const restrict buffers,
+    const size_t * const restrict sizes,
+    u32 * const restrict crcs,
+    size_t count);
+
+// Combine the CRC-32 values of two adjacent blocks of data.
+// crc_a covers the first block and crc_b covers the following len_b bytes.
+// Runs in O(log len_b) time without access to the data itself.
+u32 crc32_combine(u32 crc_a, u32 crc_b, u64 len_b);
+
+// Combine the CRC-32C values of two adjacent blocks of data.
+// crc_a covers the first block and crc_b covers the following len_b bytes.
+// Runs in O(log len_b) time without access to the data itself.
+u32 crc32c_combine(u32 crc_a, u32 crc_b, u64 len_b);
+
+// Update the CRC-32 value of a block after modifying bytes in place.
+// old_crc covers all total_len bytes of the block before the change and the
+// `size` bytes at `offset` changed from old_bytes to new_bytes. Runs in
+// O(size + log total_len) time without access to the rest of the block.
+u32 crc32_patch(
+    u32 old_crc,
+    u64 total_len,
+    u64 offset,
+    const void * const restrict old_bytes,
+    const void * const restrict new_bytes,
+    size_t size);
+
+// Update the CRC-32C value of a block after modifying bytes in place.
+// old_crc covers all total_len bytes of the block before the change and the
+// `size` bytes at `offset` changed from old_bytes to new_bytes. Runs in
+// O(size + log total_len) time without access to the rest of the block.
+u32 crc32c_patch(
+    u32 old_crc,
+    u64 total_len,
+    u64 offset,
+    const void * const restrict old_bytes,
+    const void * const restrict new_bytes,
+    size_t size);
+
 // Calculate the CRC-32 value of the file at the provided path
 u32 crc32_filepath(const char * const restrict path);
 
 // Calculate the CRC-32C value of the file at the provided path
 u32 crc32c_filepath(const char * const restrict path);
+
+// Calculate the CRC-32 value of the file at the provided path.
+// The file is split into chunks that are read and hashed by up to `threads`
+// worker threads (0 uses all available cores) then combined in order.
+u32 crc32_filepath_parallel(const char * const restrict path, size_t threads);
+
+// Calculate the CRC-32C value of the file at the provided path.
+// The file is split into chunks that are read and hashed by up to `threads`
+// worker threads (0 uses all available cores) then combined in order.
+u32 crc32c_filepath_parallel(const char * const restrict path, size_t threads);
+
+// Calculate the CRC-32 value of the file at the provided path.
+// Keeps several reads in flight with io_uring while earlier buffers are
+// hashed, falling back to synchronous reads when io_uring is unavailable.
+// `options` and `stats` may be NULL.
+u32 crc32_filepath_async(
+    const char * const restrict path,
+    const crc_read_options * const restrict options,
+    crc_read_stats * const restrict stats);
+
+// Calculate the CRC-32C value of the file at the provided path.
+// Keeps several reads in flight with io_uring while earlier buffers are
+// hashed, falling back to synchronous reads when io_uring is unavailable.
+// `options` and `stats` may be NULL.
+u32 crc32c_filepath_async(
+    const char * const restrict path,
+    const crc_read_options * const restrict options,
+    crc_read_stats * const restrict stats);
@@ -0,0 +1,308 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "crc_internal.h"
+
+// Maximum size (in bytes) of each random block
+#define CHECK_BLOCK_SIZE (1 << 16)
+
+// Number of random cases per check
+#define CHECK_ROUNDS 2000
+
+// Number of messages in each batch (more than any kernel has lanes)
+#define CHECK_BATCH_MESSAGES 37
+
+// Maximum size (in bytes) of each batch message
+#define CHECK_BATCH_SIZE 600
+
+// Deterministic pseudo-random generator (xorshift64)
+static u64 check_state = U64_C(0x9E3779B97F4A7C15);
+
+static u64 check_rand(void)
+{
+    check_state ^= check_state << 13;
+    check_state ^= check_state >> 7;
+    check_state ^= check_state << 17;
+
+    return check_state;
+}
+
+static void check_fill(void* data, size_t size)
+{
+    u8* const bytes = (u8*) data;
+
+    for (size_t i = 0; i < size; i++)
+    {
+        bytes[i] = (u8) check_rand();
+    }
+}
+
+// Random size biased towards small blocks (all sizes up to `limit`)
+static size_t check_size(size_t limit)
+{
+    const size_t bits = (size_t) (check_rand() % 17);
+
+    return (size_t) (check_rand() % (MIN((size_t) 1 << bits, limit) + 1));
+}
+
+// Bitwise reference CRC of a model (independent of the generated tables)
+static u64 check_reference(const crc_model* model, const u8* data, size_t size)
+{
+    const u64 top = U64_C(1) << (model->width - 1);
+    const u64 mask = top | (top - 1);
+    u64 reg = model->init;
+
+    if (model->reflect)
+    {
+        u64 poly = 0;
+        u64 init = 0;
+
+        for (size_t i = 0; i < model->width; i++)
+        {
+            poly |= ((model->poly >> i) & 1) << (model->width - 1 - i);
+            init |= ((model->init >> i) & 1) << (model->width - 1 - i);
+        }
+
+        reg = init;
+
+        for (size_t i = 0; i < size; i++)
+        {
+            reg ^= data[i];
+
+            for (size_t b = 0; b < 8; b++)
+            {
+                reg = (reg & 1) ? (reg >> 1) ^ poly : reg >> 1;
+            }
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < size; i++)
+        {
+            reg ^= (u64) data[i] << (model->width - 8);
+
+            for (size_t b = 0; b < 8; b++)
+            {
+                reg = ((reg & top) ? (reg << 1) ^ model->poly : reg << 1) & mask;
+            }
+        }
+    }
+
+    return (reg ^ model->xorout) & mask;
+}
+
+// Every CRC-32/CRC-32C kernel usable at the selected instruction set level
+// must match the slicing tables bit for bit, from any seed and alignment
+static bool check_kernels(void)
+{
+    static u8 buffer[CHECK_BLOCK_SIZE + 64];
+
+    static const struct
+    {
+        const char* name;
+        crc_kernel_t kernel;
+        crc_kernel_t reference;
+        u32 features;
+    } kernels[] =
+    {
+#if CPU_X86
+        { "crc32_clmul", crc32_clmul, crc32_table, CPU_FEATURE_SSSE3 | CPU_FEATURE_PCLMUL },
+        { "crc32c_clmul", crc32c_clmul, crc32c_table, CPU_FEATURE_SSSE3 | CPU_FEATURE_PCLMUL },
+        { "crc32c_sse42", crc32c_sse42, crc32c_table, CPU_FEATURE_SSE42 | CPU_FEATURE_PCLMUL },
+        { "crc32_avx2", crc32_avx2, crc32_table, CPU_FEATURE_AVX2 | CPU_FEATURE_VPCLMULQDQ | CPU_FEATURE_PCLMUL },
+        { "crc32c_avx2", crc32c_avx2, crc32c_table, CPU_FEATURE_AVX2 | CPU_FEATURE_VPCLMULQDQ | CPU_FEATURE_PCLMUL },
+        { "crc32_avx512", crc32_avx512, crc32_table, CPU_FEATURE_AVX512F | CPU_FEATURE_VPCLMULQDQ | CPU_FEATURE_PCLMUL },
+        { "crc32c_avx512", crc32c_avx512, crc32c_table, CPU_FEATURE_AVX512F | CPU_FEATURE_VPCLMULQDQ | CPU_FEATURE_PCLMUL },
+#endif
+    };
+
+    const u32 features = cpu_features();
+
+    for (size_t round = 0; round < CHECK_ROUNDS; round++)
+    {
+        const size_t size = check_size(CHECK_BLOCK_SIZE);
+        const u8* const data = buffer + check_rand() % 64;
+        const u32 seed = (u32) check_rand();
+
+        check_fill(buffer, sizeof(buffer));
+
+        // Public entry points (dispatched at the selected level)
+        if (crc32(data, size) != crc32_table(data, size, 0) ||
+            crc32c(data, size) != crc32c_table(data, size, 0))
+        {
+            fprintf(stderr, "[check_kernels] crc32/crc32c of %zu bytes at alignment %zu mismatch\n",
+                size, (size_t) (data - buffer));
+            return false;
+        }
+
+        for (size_t i = 0; i < sizeof(kernels) / sizeof(kernels[0]); i++)
+        {
+            if (!cpu_has(features, kernels[i].features))
+            {
+                continue;
+            }
+
+            if (kernels[i].kernel(data, size, seed) != kernels[i].reference(data, size, seed))
+            {
+                fprintf(stderr, "[check_kernels] %s of %zu bytes at alignment %zu mismatch\n",
+                    kernels[i].name, size, (size_t) (data - buffer));
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// Every model must match the bitwise reference, also when split in two
+static bool check_models(void)
+{
+    static u8 buffer[CHECK_BLOCK_SIZE + 64];
+
+    static const crc_model* const models[] =
+    {
+        &CRC_MODEL_CRC16_IBM_3740,
+        &CRC_MODEL_CRC16_KERMIT,
+        &CRC_MODEL_CRC32,
+        &CRC_MODEL_CRC32C,
+        &CRC_MODEL_CRC64_ECMA_182,
+        &CRC_MODEL_CRC64_XZ,
+        &CRC_MODEL_CRC64_NVME,
+    };
+
+    for (size_t i = 0; i < sizeof(models) / sizeof(models[0]); i++)
+    {
+        const crc_model* const model = models[i];
+
+        if (crc_compute(model, "123456789", 9) != model->check)
+        {
+            fprintf(stderr, "[check_models] %s check value mismatch\n", model->name);
+            return false;
+        }
+
+        for (size_t round = 0; round < CHECK_ROUNDS / 10; round++)
+        {
+            const size_t size = check_size(CHECK_BLOCK_SIZE / 4);
+            const size_t split = (size_t) (check_rand() % (size + 1));
+            const u8* const data = buffer + check_rand() % 64;
+
+            check_fill(buffer, size + 64);
+
+            const u64 expected = check_reference(model, data, size);
+            const u64 crc = crc_compute(model, data, size);
+            const u64 head = crc_update(model, crc_init(model), data, split);
+            const u64 tail = crc_update(model, head, data + split, size - split);
+
+            if (crc != expected || tail != expected)
+            {
+                fprintf(stderr, "[check_models] %s of %zu bytes (split at %zu) mismatch\n", model->name, size, split);
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// Patching must match recomputing the CRC of the modified block
+static bool check_patch(void)
+{
+    static u8 block[CHECK_BLOCK_SIZE];
+    static u8 old_bytes[CHECK_BLOCK_SIZE];
+
+    for (size_t round = 0; round < CHECK_ROUNDS; round++)
+    {
+        const size_t total = check_size(CHECK_BLOCK_SIZE);
+        const size_t offset = (size_t) (check_rand() % (total + 1));
+        const size_t size = check_size(total - offset);
+
+        check_fill(block, total);
+        memcpy(old_bytes, block + offset, size);
+
+        const u32 old_crc32 = crc32(block, total);
+        const u32 old_crc32c = crc32c(block, total);
+
+        check_fill(block + offset, size);
+
+        const u32 patched32 = crc32_patch(old_crc32, total, offset, old_bytes, block + offset, size);
+        const u32 patched32c = crc32c_patch(old_crc32c, total, offset, old_bytes, block + offset, size);
+
+        if (patched32 != crc32(block, total) || patched32c != crc32c(block, total))
+        {
+            fprintf(stderr, "[check_patch] Patch of %zu bytes at %zu of %zu mismatch\n", size, offset, total);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Batches of mixed-length messages must match the CRC of each message
+static bool check_batch(void)
+{
+    static u8 buffer[CHECK_BATCH_MESSAGES * (CHECK_BATCH_SIZE + 8)];
+    const void* buffers[CHECK_BATCH_MESSAGES];
+    size_t sizes[CHECK_BATCH_MESSAGES];
+    u32 crcs32[CHECK_BATCH_MESSAGES];
+    u32 crcs32c[CHECK_BATCH_MESSAGES];
+
+    for (size_t round = 0; round < CHECK_ROUNDS / 10; round++)
+    {
+        // Random message count, sizes (some empty), and alignments
+        const size_t count = (size_t) (check_rand() % (CHECK_BATCH_MESSAGES + 1));
+
+        check_fill(buffer, sizeof(buffer));
+
+        for (size_t i = 0; i < count; i++)
+        {
+            sizes[i] = (size_t) (check_rand() % (CHECK_BATCH_SIZE + 1));
+            buffers[i] = buffer + i * (CHECK_BATCH_SIZE + 8) + check_rand() % 8;
+        }
+
+        crc32_batch(buffers, sizes, crcs32, count);
+        crc32c_batch(buffers, sizes, crcs32c, count);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            if (crcs32[i] != crc32(buffers[i], sizes[i]) || crcs32c[i] != crc32c(buffers[i], sizes[i]))
+            {
+                fprintf(stderr, "[check_batch] Message %zu (%zu bytes) of %zu mismatch\n", i, sizes[i], count);
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+int main(void)
+{
+    static const struct
+    {
+        const char* name;
+        bool (*run)(void);
+    } checks[] =
+    {
+        { "kernels", check_kernels },
+        { "models", check_models },
+        { "patch", check_patch },
+        { "batch", check_batch },
+    };
+
+    int status = EXIT_SUCCESS;
+
+    for (size_t i = 0; i < sizeof(checks) / sizeof(checks[0]); i++)
+    {
+        const bool ok = checks[i].run();
+
+        printf("%-16s %s\n", checks[i].name, ok ? "ok" : "FAILED");
+
+        if (!ok)
+        {
+            status = EXIT_FAILURE;
+        }
+    }
+
+    return status;
+}
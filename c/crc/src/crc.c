@@ -1,255 +1,958 @@
+#define _GNU_SOURCE
+#define _FILE_OFFSET_BITS 64
+
 #include <stdio.h>
+#include <stdbool.h>
 #include <errno.h>
+#include <assert.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <pthread.h>
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
 
-#include "crc.h"
+#include "crc_internal.h"
+
+// Buffer size to use for patch deltas
+#define CRC_PATCH_SIZE 512
 
 // Buffer size to use for file I/O
 #define CRC_BUFFER_SIZE 65536
 
-// CRC-32 Table
-const u32 CRC32_TABLE[256] =
-{
-    0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA,
-    0x076DC419, 0x706AF48F, 0xE963A535, 0x9E6495A3,
-    0x0EDB8832, 0x79DCB8A4, 0xE0D5E91E, 0x97D2D988,
-    0x09B64C2B, 0x7EB17CBD, 0xE7B82D07, 0x90BF1D91,
-    0x1DB71064, 0x6AB020F2, 0xF3B97148, 0x84BE41DE,
-    0x1ADAD47D, 0x6DDDE4EB, 0xF4D4B551, 0x83D385C7,
-    0x136C9856, 0x646BA8C0, 0xFD62F97A, 0x8A65C9EC,
-    0x14015C4F, 0x63066CD9, 0xFA0F3D63, 0x8D080DF5,
-    0x3B6E20C8, 0x4C69105E, 0xD56041E4, 0xA2677172,
-    0x3C03E4D1, 0x4B04D447, 0xD20D85FD, 0xA50AB56B,
-    0x35B5A8FA, 0x42B2986C, 0xDBBBC9D6, 0xACBCF940,
-    0x32D86CE3, 0x45DF5C75, 0xDCD60DCF, 0xABD13D59,
-    0x26D930AC, 0x51DE003A, 0xC8D75180, 0xBFD06116,
-    0x21B4F4B5, 0x56B3C423, 0xCFBA9599, 0xB8BDA50F,
-    0x2802B89E, 0x5F058808, 0xC60CD9B2, 0xB10BE924,
-    0x2F6F7C87, 0x58684C11, 0xC1611DAB, 0xB6662D3D,
-    0x76DC4190, 0x01DB7106, 0x98D220BC, 0xEFD5102A,
-    0x71B18589, 0x06B6B51F, 0x9FBFE4A5, 0xE8B8D433,
-    0x7807C9A2, 0x0F00F934, 0x9609A88E, 0xE10E9818,
-    0x7F6A0DBB, 0x086D3D2D, 0x91646C97, 0xE6635C01,
-    0x6B6B51F4, 0x1C6C6162, 0x856530D8, 0xF262004E,
-    0x6C0695ED, 0x1B01A57B, 0x8208F4C1, 0xF50FC457,
-    0x65B0D9C6, 0x12B7E950, 0x8BBEB8EA, 0xFCB9887C,
-    0x62DD1DDF, 0x15DA2D49, 0x8CD37CF3, 0xFBD44C65,
-    0x4DB26158, 0x3AB551CE, 0xA3BC0074, 0xD4BB30E2,
-    0x4ADFA541, 0x3DD895D7, 0xA4D1C46D, 0xD3D6F4FB,
-    0x4369E96A, 0x346ED9FC, 0xAD678846, 0xDA60B8D0,
-    0x44042D73, 0x33031DE5, 0xAA0A4C5F, 0xDD0D7CC9,
-    0x5005713C, 0x270241AA, 0xBE0B1010, 0xC90C2086,
-    0x5768B525, 0x206F85B3, 0xB966D409, 0xCE61E49F,
-    0x5EDEF90E, 0x29D9C998, 0xB0D09822, 0xC7D7A8B4,
-    0x59B33D17, 0x2EB40D81, 0xB7BD5C3B, 0xC0BA6CAD,
-    0xEDB88320, 0x9ABFB3B6, 0x03B6E20C, 0x74B1D29A,
-    0xEAD54739, 0x9DD277AF, 0x04DB2615, 0x73DC1683,
-    0xE3630B12, 0x94643B84, 0x0D6D6A3E, 0x7A6A5AA8,
-    0xE40ECF0B, 0x9309FF9D, 0x0A00AE27, 0x7D079EB1,
-    0xF00F9344, 0x8708A3D2, 0x1E01F268, 0x6906C2FE,
-    0xF762575D, 0x806567CB, 0x196C3671, 0x6E6B06E7,
-    0xFED41B76, 0x89D32BE0, 0x10DA7A5A, 0x67DD4ACC,
-    0xF9B9DF6F, 0x8EBEEFF9, 0x17B7BE43, 0x60B08ED5,
-    0xD6D6A3E8, 0xA1D1937E, 0x38D8C2C4, 0x4FDFF252,
-    0xD1BB67F1, 0xA6BC5767, 0x3FB506DD, 0x48B2364B,
-    0xD80D2BDA, 0xAF0A1B4C, 0x36034AF6, 0x41047A60,
-    0xDF60EFC3, 0xA867DF55, 0x316E8EEF, 0x4669BE79,
-    0xCB61B38C, 0xBC66831A, 0x256FD2A0, 0x5268E236,
-    0xCC0C7795, 0xBB0B4703, 0x220216B9, 0x5505262F,
-    0xC5BA3BBE, 0xB2BD0B28, 0x2BB45A92, 0x5CB36A04,
-    0xC2D7FFA7, 0xB5D0CF31, 0x2CD99E8B, 0x5BDEAE1D,
-    0x9B64C2B0, 0xEC63F226, 0x756AA39C, 0x026D930A,
-    0x9C0906A9, 0xEB0E363F, 0x72076785, 0x05005713,
-    0x95BF4A82, 0xE2B87A14, 0x7BB12BAE, 0x0CB61B38,
-    0x92D28E9B, 0xE5D5BE0D, 0x7CDCEFB7, 0x0BDBDF21,
-    0x86D3D2D4, 0xF1D4E242, 0x68DDB3F8, 0x1FDA836E,
-    0x81BE16CD, 0xF6B9265B, 0x6FB077E1, 0x18B74777,
-    0x88085AE6, 0xFF0F6A70, 0x66063BCA, 0x11010B5C,
-    0x8F659EFF, 0xF862AE69, 0x616BFFD3, 0x166CCF45,
-    0xA00AE278, 0xD70DD2EE, 0x4E048354, 0x3903B3C2,
-    0xA7672661, 0xD06016F7, 0x4969474D, 0x3E6E77DB,
-    0xAED16A4A, 0xD9D65ADC, 0x40DF0B66, 0x37D83BF0,
-    0xA9BCAE53, 0xDEBB9EC5, 0x47B2CF7F, 0x30B5FFE9,
-    0xBDBDF21C, 0xCABAC28A, 0x53B39330, 0x24B4A3A6,
-    0xBAD03605, 0xCDD70693, 0x54DE5729, 0x23D967BF,
-    0xB3667A2E, 0xC4614AB8, 0x5D681B02, 0x2A6F2B94,
-    0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B, 0x2D02EF8D,
-};
-
-// CRC-32C (Castagnoli) Table
-const u32 CRC32C_TABLE[256] =
-{
-    0x00000000, 0xF26B8303, 0xE13B70F7, 0x1350F3F4,
-    0xC79A971F, 0x35F1141C, 0x26A1E7E8, 0xD4CA64EB,
-    0x8AD958CF, 0x78B2DBCC, 0x6BE22838, 0x9989AB3B,
-    0x4D43CFD0, 0xBF284CD3, 0xAC78BF27, 0x5E133C24,
-    0x105EC76F, 0xE235446C, 0xF165B798, 0x030E349B,
-    0xD7C45070, 0x25AFD373, 0x36FF2087, 0xC494A384,
-    0x9A879FA0, 0x68EC1CA3, 0x7BBCEF57, 0x89D76C54,
-    0x5D1D08BF, 0xAF768BBC, 0xBC267848, 0x4E4DFB4B,
-    0x20BD8EDE, 0xD2D60DDD, 0xC186FE29, 0x33ED7D2A,
-    0xE72719C1, 0x154C9AC2, 0x061C6936, 0xF477EA35,
-    0xAA64D611, 0x580F5512, 0x4B5FA6E6, 0xB93425E5,
-    0x6DFE410E, 0x9F95C20D, 0x8CC531F9, 0x7EAEB2FA,
-    0x30E349B1, 0xC288CAB2, 0xD1D83946, 0x23B3BA45,
-    0xF779DEAE, 0x05125DAD, 0x1642AE59, 0xE4292D5A,
-    0xBA3A117E, 0x4851927D, 0x5B016189, 0xA96AE28A,
-    0x7DA08661, 0x8FCB0562, 0x9C9BF696, 0x6EF07595,
-    0x417B1DBC, 0xB3109EBF, 0xA0406D4B, 0x522BEE48,
-    0x86E18AA3, 0x748A09A0, 0x67DAFA54, 0x95B17957,
-    0xCBA24573, 0x39C9C670, 0x2A993584, 0xD8F2B687,
-    0x0C38D26C, 0xFE53516F, 0xED03A29B, 0x1F682198,
-    0x5125DAD3, 0xA34E59D0, 0xB01EAA24, 0x42752927,
-    0x96BF4DCC, 0x64D4CECF, 0x77843D3B, 0x85EFBE38,
-    0xDBFC821C, 0x2997011F, 0x3AC7F2EB, 0xC8AC71E8,
-    0x1C661503, 0xEE0D9600, 0xFD5D65F4, 0x0F36E6F7,
-    0x61C69362, 0x93AD1061, 0x80FDE395, 0x72966096,
-    0xA65C047D, 0x5437877E, 0x4767748A, 0xB50CF789,
-    0xEB1FCBAD, 0x197448AE, 0x0A24BB5A, 0xF84F3859,
-    0x2C855CB2, 0xDEEEDFB1, 0xCDBE2C45, 0x3FD5AF46,
-    0x7198540D, 0x83F3D70E, 0x90A324FA, 0x62C8A7F9,
-    0xB602C312, 0x44694011, 0x5739B3E5, 0xA55230E6,
-    0xFB410CC2, 0x092A8FC1, 0x1A7A7C35, 0xE811FF36,
-    0x3CDB9BDD, 0xCEB018DE, 0xDDE0EB2A, 0x2F8B6829,
-    0x82F63B78, 0x709DB87B, 0x63CD4B8F, 0x91A6C88C,
-    0x456CAC67, 0xB7072F64, 0xA457DC90, 0x563C5F93,
-    0x082F63B7, 0xFA44E0B4, 0xE9141340, 0x1B7F9043,
-    0xCFB5F4A8, 0x3DDE77AB, 0x2E8E845F, 0xDCE5075C,
-    0x92A8FC17, 0x60C37F14, 0x73938CE0, 0x81F80FE3,
-    0x55326B08, 0xA759E80B, 0xB4091BFF, 0x466298FC,
-    0x1871A4D8, 0xEA1A27DB, 0xF94AD42F, 0x0B21572C,
-    0xDFEB33C7, 0x2D80B0C4, 0x3ED04330, 0xCCBBC033,
-    0xA24BB5A6, 0x502036A5, 0x4370C551, 0xB11B4652,
-    0x65D122B9, 0x97BAA1BA, 0x84EA524E, 0x7681D14D,
-    0x2892ED69, 0xDAF96E6A, 0xC9A99D9E, 0x3BC21E9D,
-    0xEF087A76, 0x1D63F975, 0x0E330A81, 0xFC588982,
-    0xB21572C9, 0x407EF1CA, 0x532E023E, 0xA145813D,
-    0x758FE5D6, 0x87E466D5, 0x94B49521, 0x66DF1622,
-    0x38CC2A06, 0xCAA7A905, 0xD9F75AF1, 0x2B9CD9F2,
-    0xFF56BD19, 0x0D3D3E1A, 0x1E6DCDEE, 0xEC064EED,
-    0xC38D26C4, 0x31E6A5C7, 0x22B65633, 0xD0DDD530,
-    0x0417B1DB, 0xF67C32D8, 0xE52CC12C, 0x1747422F,
-    0x49547E0B, 0xBB3FFD08, 0xA86F0EFC, 0x5A048DFF,
-    0x8ECEE914, 0x7CA56A17, 0x6FF599E3, 0x9D9E1AE0,
-    0xD3D3E1AB, 0x21B862A8, 0x32E8915C, 0xC083125F,
-    0x144976B4, 0xE622F5B7, 0xF5720643, 0x07198540,
-    0x590AB964, 0xAB613A67, 0xB831C993, 0x4A5A4A90,
-    0x9E902E7B, 0x6CFBAD78, 0x7FAB5E8C, 0x8DC0DD8F,
-    0xE330A81A, 0x115B2B19, 0x020BD8ED, 0xF0605BEE,
-    0x24AA3F05, 0xD6C1BC06, 0xC5914FF2, 0x37FACCF1,
-    0x69E9F0D5, 0x9B8273D6, 0x88D28022, 0x7AB90321,
-    0xAE7367CA, 0x5C18E4C9, 0x4F48173D, 0xBD23943E,
-    0xF36E6F75, 0x0105EC76, 0x12551F82, 0xE03E9C81,
-    0x34F4F86A, 0xC69F7B69, 0xD5CF889D, 0x27A40B9E,
-    0x79B737BA, 0x8BDCB4B9, 0x988C474D, 0x6AE7C44E,
-    0xBE2DA0A5, 0x4C4623A6, 0x5F16D052, 0xAD7D5351,
-};
+// Size of the file chunks hashed independently by parallel workers
+#define CRC_CHUNK_SIZE (8 << 20)
+
+// Advance CRC over a single byte
+static inline u32 crc_byte(
+    u32 crc,
+    u8 byte,
+    const u32 table[static const restrict 16][256])
+{
+    return (crc >> 8) ^ table[0][(crc ^ byte) & 0xFF];
+}
+
+// Advance CRC over an 8-byte block (slicing-by-8)
+static inline u32 crc_slice8(
+    u32 crc,
+    const u8 * const restrict p,
+    const u32 table[static const restrict 16][256])
+{
+    const u64 x = load64_le(p) ^ crc;
+
+    return table[7][(x >>  0) & 0xFF] ^ table[6][(x >>  8) & 0xFF] ^
+           table[5][(x >> 16) & 0xFF] ^ table[4][(x >> 24) & 0xFF] ^
+           table[3][(x >> 32) & 0xFF] ^ table[2][(x >> 40) & 0xFF] ^
+           table[1][(x >> 48) & 0xFF] ^ table[0][(x >> 56) & 0xFF];
+}
+
+// Advance CRC over a 16-byte block (slicing-by-16)
+static inline u32 crc_slice16(
+    u32 crc,
+    const u8 * const restrict p,
+    const u32 table[static const restrict 16][256])
+{
+    const u64 x = load64_le(p + 0) ^ crc;
+    const u64 y = load64_le(p + 8);
+
+    return table[15][(x >>  0) & 0xFF] ^ table[14][(x >>  8) & 0xFF] ^
+           table[13][(x >> 16) & 0xFF] ^ table[12][(x >> 24) & 0xFF] ^
+           table[11][(x >> 32) & 0xFF] ^ table[10][(x >> 40) & 0xFF] ^
+           table[ 9][(x >> 48) & 0xFF] ^ table[ 8][(x >> 56) & 0xFF] ^
+           table[ 7][(y >>  0) & 0xFF] ^ table[ 6][(y >>  8) & 0xFF] ^
+           table[ 5][(y >> 16) & 0xFF] ^ table[ 4][(y >> 24) & 0xFF] ^
+           table[ 3][(y >> 32) & 0xFF] ^ table[ 2][(y >> 40) & 0xFF] ^
+           table[ 1][(y >> 48) & 0xFF] ^ table[ 0][(y >> 56) & 0xFF];
+}
 
 static u32 internal_crc(
     const void * const restrict data,
     size_t size,
     u32 crc,
-    const u32 table[static const restrict 256])
+    const u32 table[static const restrict 16][256])
 {
     const u8 * restrict p = (const u8 *) data;
     crc = ~crc;
 
-    // Process 4-byte blocks
-    while (size >= 4)
+    // Process leading bytes until 8-byte aligned
+    while (size > 0 && ((uintptr_t) p & 7))
+    {
+        crc = crc_byte(crc, *p++, table);
+        size--;
+    }
+
+    // Process 64-byte blocks
+    while (size >= 64)
+    {
+        crc = crc_slice16(crc, p + 0, table);
+        crc = crc_slice16(crc, p + 16, table);
+        crc = crc_slice16(crc, p + 32, table);
+        crc = crc_slice16(crc, p + 48, table);
+
+        p += 64;
+        size -= 64;
+    }
+
+    // Process 16-byte blocks
+    while (size >= 16)
+    {
+        crc = crc_slice16(crc, p, table);
+
+        p += 16;
+        size -= 16;
+    }
+
+    // Process 8-byte block
+    if (size >= 8)
     {
-        crc = (crc >> 8) ^ table[(crc ^ p[0]) & 0xFF];
-        crc = (crc >> 8) ^ table[(crc ^ p[1]) & 0xFF];
-        crc = (crc >> 8) ^ table[(crc ^ p[2]) & 0xFF];
-        crc = (crc >> 8) ^ table[(crc ^ p[3]) & 0xFF];
+        crc = crc_slice8(crc, p, table);
 
-        p += 4;
-        size -= 4;
+        p += 8;
+        size -= 8;
     }
 
     // Process last partial block
     while (size--)
     {
-        crc = (crc >> 8) ^ table[(crc ^ *p++) & 0xFF];
+        crc = crc_byte(crc, *p++, table);
     }
 
     return ~crc;
 }
 
+// Multiply two reflected polynomials modulo the reversed polynomial `poly`
+u32 crc_multmodp(u32 a, u32 b, u32 poly)
+{
+    u32 m = U32_C(1) << 31;
+    u32 p = 0;
+
+    for (;;)
+    {
+        if (a & m)
+        {
+            p ^= b;
+
+            if ((a & (m - 1)) == 0)
+            {
+                break;
+            }
+        }
+
+        m >>= 1;
+        b = (b >> 1) ^ (poly & (U32_C(0) - (b & 1)));
+    }
+
+    return p;
+}
+
+// Calculate x^(8n) mod P (reflected) using a table of x^(2^k) powers
+u32 crc_x8nmodp(u64 n, const u32 x2n[static 64], u32 poly)
+{
+    // x^0 == 1
+    u32 p = U32_C(1) << 31;
+
+    // Calculate x^n from the binary expansion of n
+    for (size_t k = 0; n != 0; k++, n >>= 1)
+    {
+        if (n & 1)
+        {
+            p = crc_multmodp(x2n[k], p, poly);
+        }
+    }
+
+    // x^(8n) == (x^n)^8
+    p = crc_multmodp(p, p, poly);
+    p = crc_multmodp(p, p, poly);
+    p = crc_multmodp(p, p, poly);
+
+    return p;
+}
+
+// Monotonic wall clock time (in seconds)
+double crc_wtime(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+}
+
+// Calculate CRC-32 using the slicing tables
+u32 crc32_table(const void * const restrict data, size_t size, u32 crc)
+{
+    return internal_crc(data, size, crc, CRC32_SLICE_TABLE);
+}
+
+// Calculate CRC-32C using the slicing tables
+u32 crc32c_table(const void * const restrict data, size_t size, u32 crc)
+{
+    return internal_crc(data, size, crc, CRC32C_SLICE_TABLE);
+}
+
+// Kernels bound to the best implementation for the running CPU
+typedef struct crc_dispatch
+{
+    // CRC-32 kernel and optional wide kernel for buffers of at least wide_size bytes
+    crc_kernel_t crc32;
+    crc_kernel_t crc32_wide;
+    size_t crc32_wide_size;
+
+    // CRC-32C kernel and optional wide kernel for buffers of at least wide_size bytes
+    crc_kernel_t crc32c;
+    crc_kernel_t crc32c_wide;
+    size_t crc32c_wide_size;
+
+    // Generic model engine
+    u64 (*model)(const crc_model * restrict model, u64 reg, const void * restrict data, size_t size);
+
+    // Interleaved CRC-32C batch kernel (NULL if unavailable)
+    void (*crc32c_batch)(
+        const void * const * restrict buffers,
+        const size_t * restrict sizes,
+        u32 * restrict crcs,
+        size_t count);
+} crc_dispatch;
+
+static crc_dispatch CRC_DISPATCH;
+static pthread_once_t CRC_DISPATCH_ONCE = PTHREAD_ONCE_INIT;
+
+// Bind kernels from the detected CPU features
+static void crc_dispatch_resolve(void)
+{
+    crc_dispatch d =
+    {
+        .crc32 = crc32_table,
+        .crc32c = crc32c_table,
+        .model = crc_model_slice,
+    };
+
+#if CPU_X86
+    const u32 features = cpu_features();
+
+    if (cpu_has(features, CPU_FEATURE_SSSE3 | CPU_FEATURE_PCLMUL))
+    {
+        d.crc32 = crc32_clmul;
+        d.crc32c = crc32c_clmul;
+        d.model = crc_model_clmul;
+    }
+
+    if (cpu_has(features, CPU_FEATURE_SSE42 | CPU_FEATURE_PCLMUL))
+    {
+        d.crc32c = crc32c_sse42;
+        d.crc32c_batch = crc32c_sse42_batch;
+    }
+
+    // Wide folding only beats the crc32 instruction on larger buffers
+    if (cpu_has(features, CPU_FEATURE_AVX512F | CPU_FEATURE_VPCLMULQDQ | CPU_FEATURE_PCLMUL))
+    {
+        d.crc32_wide = crc32_avx512;
+        d.crc32_wide_size = 256;
+        d.crc32c_wide = crc32c_avx512;
+        d.crc32c_wide_size = 1024;
+    }
+    else if (cpu_has(features, CPU_FEATURE_AVX2 | CPU_FEATURE_VPCLMULQDQ | CPU_FEATURE_PCLMUL))
+    {
+        d.crc32_wide = crc32_avx2;
+        d.crc32_wide_size = 128;
+        d.crc32c_wide = crc32c_avx2;
+        d.crc32c_wide_size = 1024;
+    }
+#endif
+
+    CRC_DISPATCH = d;
+}
+
+// Get the kernels bound for the running CPU
+static inline const crc_dispatch* crc_dispatch_get(void)
+{
+    pthread_once(&CRC_DISPATCH_ONCE, crc_dispatch_resolve);
+    return &CRC_DISPATCH;
+}
+
+// Calculate CRC-32 using the fastest available engine
+static u32 crc32_kernel(const void * const restrict data, size_t size, u32 crc)
+{
+    const crc_dispatch * const restrict d = crc_dispatch_get();
+
+    if (d->crc32_wide != NULL && size >= d->crc32_wide_size)
+    {
+        return d->crc32_wide(data, size, crc);
+    }
+
+    return d->crc32(data, size, crc);
+}
+
+// Calculate CRC-32C using the fastest available engine
+static u32 crc32c_kernel(const void * const restrict data, size_t size, u32 crc)
+{
+    const crc_dispatch * const restrict d = crc_dispatch_get();
+
+    if (d->crc32c_wide != NULL && size >= d->crc32c_wide_size)
+    {
+        return d->crc32c_wide(data, size, crc);
+    }
+
+    return d->crc32c(data, size, crc);
+}
+
+// Mask of the low `width` bits of a model register
+static inline u64 crc_model_mask(size_t width)
+{
+    return width >= 64 ? ~U64_C(0) : (U64_C(1) << width) - 1;
+}
+
+// Advance a model register over the provided data (slicing-by-8)
+u64 crc_model_slice(
+    const crc_model * const restrict model,
+    u64 reg,
+    const void * const restrict data,
+    size_t size)
+{
+    const u64 (* const table)[256] = model->table;
+    const u8 * restrict p = (const u8 *) data;
+
+    if (model->reflect)
+    {
+        while (size >= 8)
+        {
+            const u64 x = load64_le(p) ^ reg;
+
+            reg = table[7][(x >>  0) & 0xFF] ^ table[6][(x >>  8) & 0xFF] ^
+                  table[5][(x >> 16) & 0xFF] ^ table[4][(x >> 24) & 0xFF] ^
+                  table[3][(x >> 32) & 0xFF] ^ table[2][(x >> 40) & 0xFF] ^
+                  table[1][(x >> 48) & 0xFF] ^ table[0][(x >> 56) & 0xFF];
+
+            p += 8;
+            size -= 8;
+        }
+
+        while (size--)
+        {
+            reg = (reg >> 8) ^ table[0][(reg ^ *p++) & 0xFF];
+        }
+    }
+    else
+    {
+        while (size >= 8)
+        {
+            const u64 x = load64_be(p) ^ reg;
+
+            reg = table[7][(x >> 56) & 0xFF] ^ table[6][(x >> 48) & 0xFF] ^
+                  table[5][(x >> 40) & 0xFF] ^ table[4][(x >> 32) & 0xFF] ^
+                  table[3][(x >> 24) & 0xFF] ^ table[2][(x >> 16) & 0xFF] ^
+                  table[1][(x >>  8) & 0xFF] ^ table[0][(x >>  0) & 0xFF];
+
+            p += 8;
+            size -= 8;
+        }
+
+        while (size--)
+        {
+            reg = (reg << 8) ^ table[0][(reg >> 56) ^ *p++];
+        }
+    }
+
+    return reg;
+}
+
+// Calculate a model CRC using the generic engine
+u64 crc_model_update(
+    const crc_model * const restrict model,
+    u64 crc,
+    const void * const restrict data,
+    size_t size)
+{
+    // Normal registers are kept left aligned in 64 bits
+    const size_t shift = model->reflect ? 0 : 64 - model->width;
+    u64 reg = ((crc ^ model->xorout) & crc_model_mask(model->width)) << shift;
+
+    reg = crc_dispatch_get()->model(model, reg, data, size);
+
+    return (reg >> shift) ^ model->xorout;
+}
+
+// Calculate a CRC-32 model CRC using the dedicated engine
+u64 crc32_model_update(
+    const crc_model * const restrict model,
+    u64 crc,
+    const void * const restrict data,
+    size_t size)
+{
+    (void) model;
+    return crc32_kernel(data, size, (u32) crc);
+}
+
+// Calculate a CRC-32C model CRC using the dedicated engine
+u64 crc32c_model_update(
+    const crc_model * const restrict model,
+    u64 crc,
+    const void * const restrict data,
+    size_t size)
+{
+    (void) model;
+    return crc32c_kernel(data, size, (u32) crc);
+}
+
+// CRC model catalogue
+#define CRC_MODEL(id, name, width, reflect, poly, init, xorout, check, kernel) \
+    const crc_model CRC_MODEL_##id = \
+    { \
+        name, width, reflect, U64_C(poly), U64_C(init), U64_C(xorout), U64_C(check), \
+        kernel, id##_SLICE64_TABLE, &id##_CLMUL, \
+    };
+#include "crc_models.h"
+#undef CRC_MODEL
+
+// CRC combine function type
+typedef u32 (*crc_combine_t)(u32 crc_a, u32 crc_b, u64 len_b);
+
+// Calculate the CRC of a byte range of an open file using positional reads
+static bool internal_crc_range(
+    int fd,
+    u64 offset,
+    u64 size,
+    u8 * const restrict buffer,
+    crc_kernel_t kernel,
+    u32 * const restrict crc,
+    crc_read_stats * const restrict stats)
+{
+    while (size > 0)
+    {
+        const size_t request = (size_t) MIN(size, CRC_BUFFER_SIZE);
+        const double read_start = stats != NULL ? crc_wtime() : 0.0;
+        const ssize_t read_size = pread(fd, buffer, request, (off_t) offset);
+
+        // Retry interrupted reads and fail on errors or unexpected EOF
+        if (read_size < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        else if (read_size <= 0)
+        {
+            if (read_size == 0)
+            {
+                errno = EIO;
+            }
+
+            return false;
+        }
+
+        if (stats != NULL)
+        {
+            const double hash_start = crc_wtime();
+            *crc = kernel(buffer, (size_t) read_size, *crc);
+
+            stats->wait_time += hash_start - read_start;
+            stats->hash_time += crc_wtime() - hash_start;
+            stats->bytes += (u64) read_size;
+        }
+        else
+        {
+            *crc = kernel(buffer, (size_t) read_size, *crc);
+        }
+
+        offset += (u64) read_size;
+        size -= (u64) read_size;
+    }
+
+    return true;
+}
+
+// Advance CRC over `size` zero bytes in O(log size) time
+static inline u32 crc_zeros(u32 crc, u64 size, crc_combine_t combine)
+{
+    // Shifting the register by x^(8n) mod P is the same as hashing n zeros
+    return ~combine(~crc, 0, size);
+}
+
+// Calculate the CRC of a byte range of an open file, skipping holes.
+// Data extents are read normally and holes are hashed arithmetically.
+static bool internal_crc_sparse_range(
+    int fd,
+    u64 offset,
+    u64 size,
+    u8 * const restrict buffer,
+    crc_kernel_t kernel,
+    crc_combine_t combine,
+    u32 * const restrict crc)
+{
+    const u64 end = offset + size;
+
+    while (offset < end)
+    {
+        u64 data = offset;
+        u64 hole = end;
+
+#if defined(SEEK_DATA) && defined(SEEK_HOLE)
+        const off_t data_offset = lseek(fd, (off_t) offset, SEEK_DATA);
+
+        if (data_offset >= 0)
+        {
+            const off_t hole_offset = lseek(fd, data_offset, SEEK_HOLE);
+
+            data = MIN((u64) data_offset, end);
+            hole = hole_offset >= 0 ? MIN((u64) hole_offset, end) : end;
+        }
+        else if (errno == ENXIO)
+        {
+            // No data past offset (the rest of the range is a hole)
+            data = end;
+        }
+#endif
+
+        // Hash the leading zero run without reading it
+        if (data > offset)
+        {
+            *crc = crc_zeros(*crc, data - offset, combine);
+        }
+
+        if (!internal_crc_range(fd, data, hole - data, buffer, kernel, crc, NULL))
+        {
+            return false;
+        }
+
+        offset = hole;
+    }
+
+    return true;
+}
+
 static u32 internal_crc_filepath(
     const char * const restrict path,
-    const u32 table[static const restrict 256])
+    crc_kernel_t kernel,
+    crc_combine_t combine)
 {
-    FILE * const restrict f = fopen(path, "rb");
+    const int fd = open(path, O_RDONLY);
     u8 * const restrict buffer = (u8 *) malloc(CRC_BUFFER_SIZE);
+    struct stat sb;
     u32 crc = 0;
 
     // Check for errors
-    if (f == NULL || buffer == NULL)
+    if (fd < 0 || buffer == NULL || fstat(fd, &sb) != 0)
     {
         goto error;
     }
 
-    // Disable I/O buffering
-    setbuf(f, NULL);
-
-    // CRC file blocks
-    for (;;)
+    if (S_ISREG(sb.st_mode))
     {
-        // Read file data into buffer
-        const size_t read_size = fread(buffer, 1, CRC_BUFFER_SIZE, f);
-
-        // Calculate CRC of buffer contents
-        crc = internal_crc(buffer, read_size, crc, table);
-
-        // Check for EOF or errors
-        if (read_size != CRC_BUFFER_SIZE)
+        // CRC data extents and holes of regular files
+        if (!internal_crc_sparse_range(fd, 0, (u64) sb.st_size, buffer, kernel, combine, &crc))
+        {
+            goto error;
+        }
+    }
+    else
+    {
+        // CRC other files (pipes, devices) as a sequential stream
+        for (;;)
         {
-            if (ferror(f))
+            const ssize_t read_size = read(fd, buffer, CRC_BUFFER_SIZE);
+
+            if (read_size < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            else if (read_size < 0)
             {
                 goto error;
             }
-            else
+            else if (read_size == 0)
             {
                 break;
             }
+
+            crc = kernel(buffer, (size_t) read_size, crc);
         }
     }
 
     goto exit;
 
 error:
-    fprintf(stderr, "[crc] Failed to CRC file contents of '%s': %s",
+    fprintf(stderr, "[crc] Failed to CRC file contents of '%s': %s\n",
         path, strerror(errno));
 
+    crc = 0;
+
 exit:
-    if (f != NULL)
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+
+    free(buffer);
+
+    return crc;
+}
+
+static u32 internal_crc_filepath_parallel(
+    const char * const restrict path,
+    size_t threads,
+    crc_kernel_t kernel,
+    crc_combine_t combine)
+{
+    const int fd = open(path, O_RDONLY);
+    u32 * restrict chunk_crcs = NULL;
+    struct stat sb;
+    bool success = true;
+    u32 crc = 0;
+
+    // Check for errors
+    if (fd < 0 || fstat(fd, &sb) != 0)
+    {
+        goto error;
+    }
+
+    const u64 size = (u64) sb.st_size;
+    const size_t chunks = (size_t) ((size + CRC_CHUNK_SIZE - 1) / CRC_CHUNK_SIZE);
+
+    chunk_crcs = (u32 *) malloc(MAX(chunks, 1) * sizeof(*chunk_crcs));
+    if (chunk_crcs == NULL)
+    {
+        goto error;
+    }
+
+#if defined(_OPENMP)
+    if (threads == 0)
     {
-        fclose(f);
+        threads = (size_t) omp_get_max_threads();
     }
+#endif
 
-    if (buffer != NULL)
+    // CRC file chunks independently (using parallel threads if possible)
+    #pragma omp parallel num_threads(MAX(threads, 1)) default(shared)
     {
+        u8 * const restrict buffer = (u8 *) malloc(CRC_BUFFER_SIZE);
+        int error = 0;
+
+        if (buffer == NULL)
+        {
+            error = errno;
+        }
+
+        #pragma omp for schedule(dynamic)
+        for (size_t i = 0; i < chunks; i++)
+        {
+            const u64 offset = (u64) i * CRC_CHUNK_SIZE;
+            const u64 chunk_size = MIN(size - offset, CRC_CHUNK_SIZE);
+
+            chunk_crcs[i] = 0;
+
+            if (!error && !internal_crc_sparse_range(fd, offset, chunk_size, buffer, kernel, combine, chunk_crcs + i))
+            {
+                error = errno;
+            }
+        }
+
+        // Report the first worker failure
+        if (error)
+        {
+            #pragma omp critical(crc_error)
+            {
+                if (success)
+                {
+                    success = false;
+                    errno = error;
+                }
+            }
+        }
+
         free(buffer);
     }
 
+    if (!success)
+    {
+        goto error;
+    }
+
+    // Merge chunk CRCs in file order
+    for (size_t i = 0; i < chunks; i++)
+    {
+        const u64 offset = (u64) i * CRC_CHUNK_SIZE;
+        crc = combine(crc, chunk_crcs[i], MIN(size - offset, CRC_CHUNK_SIZE));
+    }
+
+    goto exit;
+
+error:
+    fprintf(stderr, "[crc] Failed to CRC file contents of '%s': %s\n",
+        path, strerror(errno));
+
+    crc = 0;
+
+exit:
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+
+    free(chunk_crcs);
+
     return crc;
 }
 
+static u32 internal_crc_filepath_async(
+    const char * const restrict path,
+    const crc_read_options * restrict options,
+    crc_read_stats * restrict stats,
+    crc_kernel_t kernel)
+{
+    const crc_read_options default_options = { 0 };
+    crc_read_stats local_stats;
+    u8 * restrict buffer = NULL;
+    int fd = -1;
+    u32 crc = 0;
+
+    if (options == NULL)
+    {
+        options = &default_options;
+    }
+
+    if (stats == NULL)
+    {
+        stats = &local_stats;
+    }
+
+    memset(stats, 0, sizeof(*stats));
+    const double start = crc_wtime();
+
+    // Prefer the io_uring read pipeline
+    if (crc_uring_filepath(path, options, kernel, &crc, stats))
+    {
+        goto exit;
+    }
+    else if (errno != ENOSYS)
+    {
+        goto error;
+    }
+
+    // Fall back to synchronous reads (from the start of the file)
+    memset(stats, 0, sizeof(*stats));
+    crc = 0;
+
+    struct stat sb;
+    fd = open(path, O_RDONLY);
+    buffer = (u8 *) malloc(CRC_BUFFER_SIZE);
+
+    if (fd < 0 || buffer == NULL || fstat(fd, &sb) != 0)
+    {
+        goto error;
+    }
+
+    if (!internal_crc_range(fd, 0, (u64) sb.st_size, buffer, kernel, &crc, stats))
+    {
+        goto error;
+    }
+
+    goto exit;
+
+error:
+    fprintf(stderr, "[crc] Failed to CRC file contents of '%s': %s\n",
+        path, strerror(errno));
+
+    crc = 0;
+
+exit:
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+
+    free(buffer);
+
+    stats->elapsed = crc_wtime() - start;
+
+    return crc;
+}
+
+static u32 internal_crc_patch(
+    u32 crc,
+    u64 total_len,
+    u64 offset,
+    const u8 * restrict old_bytes,
+    const u8 * restrict new_bytes,
+    size_t size,
+    crc_kernel_t kernel,
+    crc_combine_t combine)
+{
+    assert(offset <= total_len && size <= total_len - offset);
+
+    u8 delta[CRC_PATCH_SIZE];
+
+    // CRC of the XOR delta with a zero register (~0 cancels the kernel
+    // inversion so only the linear part remains)
+    u32 raw = ~U32_C(0);
+
+    while (size > 0)
+    {
+        const size_t n = MIN(size, sizeof(delta));
+
+        for (size_t i = 0; i < n; i++)
+        {
+            delta[i] = old_bytes[i] ^ new_bytes[i];
+        }
+
+        raw = kernel(delta, n, raw);
+
+        old_bytes += n;
+        new_bytes += n;
+        offset += n;
+        size -= n;
+    }
+
+    raw = ~raw;
+
+    // Shift the delta past the unmodified bytes following the range
+    return crc ^ combine(raw, 0, total_len - offset);
+}
+
 u32 crc32(const void * const restrict data, size_t size)
 {
-    return internal_crc(data, size, 0, CRC32_TABLE);
+    return (u32) crc_compute(&CRC_MODEL_CRC32, data, size);
 }
 
 u32 crc32c(const void * const restrict data, size_t size)
 {
-    return internal_crc(data, size, 0, CRC32C_TABLE);
+    return (u32) crc_compute(&CRC_MODEL_CRC32C, data, size);
+}
+
+u64 crc_init(const crc_model * const restrict model)
+{
+    u64 init = model->init;
+
+    // Reflected models keep a bit-reversed register
+    if (model->reflect)
+    {
+        init = 0;
+
+        for (size_t i = 0; i < model->width; i++)
+        {
+            init = (init << 1) | ((model->init >> i) & 1);
+        }
+    }
+
+    return init ^ model->xorout;
+}
+
+u64 crc_update(
+    const crc_model * const restrict model,
+    u64 crc,
+    const void * const restrict data,
+    size_t size)
+{
+    return model->update(model, crc, data, size);
+}
+
+u64 crc_compute(
+    const crc_model * const restrict model,
+    const void * const restrict data,
+    size_t size)
+{
+    return crc_update(model, crc_init(model), data, size);
+}
+
+void crc32_batch(
+    const void * const * const restrict buffers,
+    const size_t * const restrict sizes,
+    u32 * const restrict crcs,
+    size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        crcs[i] = crc32_kernel(buffers[i], sizes[i], 0);
+    }
+}
+
+void crc32c_batch(
+    const void * const * const restrict buffers,
+    const size_t * const restrict sizes,
+    u32 * const restrict crcs,
+    size_t count)
+{
+    const crc_dispatch * const restrict d = crc_dispatch_get();
+
+    if (d->crc32c_batch != NULL)
+    {
+        d->crc32c_batch(buffers, sizes, crcs, count);
+        return;
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        crcs[i] = crc32c_kernel(buffers[i], sizes[i], 0);
+    }
+}
+
+u32 crc32_combine(u32 crc_a, u32 crc_b, u64 len_b)
+{
+    const u32 shift = crc_x8nmodp(len_b, CRC32_X2N_TABLE, CRC32_POLY);
+    return crc_multmodp(shift, crc_a, CRC32_POLY) ^ crc_b;
+}
+
+u32 crc32c_combine(u32 crc_a, u32 crc_b, u64 len_b)
+{
+    const u32 shift = crc_x8nmodp(len_b, CRC32C_X2N_TABLE, CRC32C_POLY);
+    return crc_multmodp(shift, crc_a, CRC32C_POLY) ^ crc_b;
+}
+
+u32 crc32_patch(
+    u32 old_crc,
+    u64 total_len,
+    u64 offset,
+    const void * const restrict old_bytes,
+    const void * const restrict new_bytes,
+    size_t size)
+{
+    return internal_crc_patch(old_crc, total_len, offset, old_bytes, new_bytes, size, crc32_kernel, crc32_combine);
+}
+
+u32 crc32c_patch(
+    u32 old_crc,
+    u64 total_len,
+    u64 offset,
+    const void * const restrict old_bytes,
+    const void * const restrict new_bytes,
+    size_t size)
+{
+    return internal_crc_patch(old_crc, total_len, offset, old_bytes, new_bytes, size, crc32c_kernel, crc32c_combine);
 }
 
 u32 crc32_filepath(const char * const restrict path)
 {
-    return internal_crc_filepath(path, CRC32_TABLE);
+    return internal_crc_filepath(path, crc32_kernel, crc32_combine);
 }
 
 u32 crc32c_filepath(const char * const restrict path)
 {
-    return internal_crc_filepath(path, CRC32C_TABLE);
+    return internal_crc_filepath(path, crc32c_kernel, crc32c_combine);
+}
+
+u32 crc32_filepath_parallel(const char * const restrict path, size_t threads)
+{
+    return internal_crc_filepath_parallel(path, threads, crc32_kernel, crc32_combine);
+}
+
+u32 crc32c_filepath_parallel(const char * const restrict path, size_t threads)
+{
+    return internal_crc_filepath_parallel(path, threads, crc32c_kernel, crc32c_combine);
+}
+
+u32 crc32_filepath_async(
+    const char * const restrict path,
+    const crc_read_options * const restrict options,
+    crc_read_stats * const restrict stats)
+{
+    return internal_crc_filepath_async(path, options, stats, crc32_kernel);
+}
+
+u32 crc32c_filepath_async(
+    const char * const restrict path,
+    const crc_read_options * const restrict options,
+    crc_read_stats * const restrict stats)
+{
+    return internal_crc_filepath_async(path, options, stats, crc32c_kernel);
 }
@@ -0,0 +1,88 @@
+#include "crc_clmul.h"
+
+#if defined(__PCLMUL__) && defined(__VPCLMULQDQ__) && defined(__AVX2__)
+
+#include <immintrin.h>
+
+// Fold 256 bits of CRC state forward into the next 256 bits of data
+static inline __m256i crc_vpclmul_fold(__m256i x, __m256i data, __m256i k)
+{
+    const __m256i lo = _mm256_clmulepi64_epi128(x, k, 0x00);
+    const __m256i hi = _mm256_clmulepi64_epi128(x, k, 0x11);
+
+    return _mm256_xor_si256(_mm256_xor_si256(lo, hi), data);
+}
+
+// Calculate a reflected 32-bit CRC by folding four 256-bit lanes
+static u32 internal_crc_avx2(
+    const void * const restrict data,
+    size_t size,
+    u32 crc,
+    const crc_clmul_consts * const restrict c,
+    crc_kernel_t tail)
+{
+    const u8 * restrict p = (const u8 *) data;
+
+    if (size < 128)
+    {
+        return tail(p, size, crc);
+    }
+
+    // Load first 128-byte block and inject initial CRC state
+    __m256i x0 = _mm256_loadu_si256((const __m256i *) (p + 0));
+    __m256i x1 = _mm256_loadu_si256((const __m256i *) (p + 32));
+    __m256i x2 = _mm256_loadu_si256((const __m256i *) (p + 64));
+    __m256i x3 = _mm256_loadu_si256((const __m256i *) (p + 96));
+    x0 = _mm256_xor_si256(x0, _mm256_zextsi128_si256(_mm_cvtsi32_si128((int) ~crc)));
+
+    p += 128;
+    size -= 128;
+
+    // Fold 128-byte blocks
+    const __m256i k1024 = _mm256_broadcastsi128_si256(crc_clmul_load(c->fold1024));
+    while (size >= 128)
+    {
+        x0 = crc_vpclmul_fold(x0, _mm256_loadu_si256((const __m256i *) (p + 0)), k1024);
+        x1 = crc_vpclmul_fold(x1, _mm256_loadu_si256((const __m256i *) (p + 32)), k1024);
+        x2 = crc_vpclmul_fold(x2, _mm256_loadu_si256((const __m256i *) (p + 64)), k1024);
+        x3 = crc_vpclmul_fold(x3, _mm256_loadu_si256((const __m256i *) (p + 96)), k1024);
+
+        p += 128;
+        size -= 128;
+    }
+
+    // Fold lanes together (1024 -> 256 bits)
+    const __m256i k256 = _mm256_broadcastsi128_si256(crc_clmul_load(c->fold256));
+    __m256i y = crc_vpclmul_fold(x0, x1, k256);
+    y = crc_vpclmul_fold(y, x2, k256);
+    y = crc_vpclmul_fold(y, x3, k256);
+
+    // Fold 32-byte blocks
+    while (size >= 32)
+    {
+        y = crc_vpclmul_fold(y, _mm256_loadu_si256((const __m256i *) p), k256);
+
+        p += 32;
+        size -= 32;
+    }
+
+    // Fold halves together (256 -> 128 bits)
+    const __m128i x = crc_clmul_fold(
+        _mm256_castsi256_si128(y),
+        _mm256_extracti128_si256(y, 1),
+        crc_clmul_load(c->fold128));
+
+    return crc_clmul_finish(x, p, size, c, tail);
+}
+
+u32 crc32_avx2(const void * const restrict data, size_t size, u32 crc)
+{
+    return internal_crc_avx2(data, size, crc, &CRC32_CLMUL, crc32_table);
+}
+
+u32 crc32c_avx2(const void * const restrict data, size_t size, u32 crc)
+{
+    return internal_crc_avx2(data, size, crc, &CRC32C_CLMUL, crc32c_table);
+}
+
+#endif
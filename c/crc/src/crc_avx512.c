@@ -0,0 +1,91 @@
+#include "crc_clmul.h"
+
+#if defined(__PCLMUL__) && defined(__VPCLMULQDQ__) && defined(__AVX512F__)
+
+#include <immintrin.h>
+
+// Fold 512 bits of CRC state forward into the next 512 bits of data
+static inline __m512i crc_vpclmul_fold(__m512i x, __m512i data, __m512i k)
+{
+    const __m512i lo = _mm512_clmulepi64_epi128(x, k, 0x00);
+    const __m512i hi = _mm512_clmulepi64_epi128(x, k, 0x11);
+
+    return _mm512_ternarylogic_epi64(lo, hi, data, 0x96);
+}
+
+// Calculate a reflected 32-bit CRC by folding four 512-bit lanes
+static u32 internal_crc_avx512(
+    const void * const restrict data,
+    size_t size,
+    u32 crc,
+    const crc_clmul_consts * const restrict c,
+    crc_kernel_t tail)
+{
+    const u8 * restrict p = (const u8 *) data;
+
+    if (size < 256)
+    {
+        return tail(p, size, crc);
+    }
+
+    // Load first 256-byte block and inject initial CRC state
+    __m512i x0 = _mm512_loadu_si512((const void *) (p + 0));
+    __m512i x1 = _mm512_loadu_si512((const void *) (p + 64));
+    __m512i x2 = _mm512_loadu_si512((const void *) (p + 128));
+    __m512i x3 = _mm512_loadu_si512((const void *) (p + 192));
+    x0 = _mm512_xor_si512(x0, _mm512_zextsi128_si512(_mm_cvtsi32_si128((int) ~crc)));
+
+    p += 256;
+    size -= 256;
+
+    // Fold 256-byte blocks
+    const __m512i k2048 = _mm512_broadcast_i32x4(crc_clmul_load(c->fold2048));
+    while (size >= 256)
+    {
+        x0 = crc_vpclmul_fold(x0, _mm512_loadu_si512((const void *) (p + 0)), k2048);
+        x1 = crc_vpclmul_fold(x1, _mm512_loadu_si512((const void *) (p + 64)), k2048);
+        x2 = crc_vpclmul_fold(x2, _mm512_loadu_si512((const void *) (p + 128)), k2048);
+        x3 = crc_vpclmul_fold(x3, _mm512_loadu_si512((const void *) (p + 192)), k2048);
+
+        p += 256;
+        size -= 256;
+    }
+
+    // Fold lanes together (2048 -> 512 bits)
+    const __m512i k512 = _mm512_broadcast_i32x4(crc_clmul_load(c->fold512));
+    __m512i y = crc_vpclmul_fold(x0, x1, k512);
+    y = crc_vpclmul_fold(y, x2, k512);
+    y = crc_vpclmul_fold(y, x3, k512);
+
+    // Fold 64-byte blocks
+    while (size >= 64)
+    {
+        y = crc_vpclmul_fold(y, _mm512_loadu_si512((const void *) p), k512);
+
+        p += 64;
+        size -= 64;
+    }
+
+    // Fold quarters together (512 -> 128 bits)
+    const __m128i k128 = crc_clmul_load(c->fold128);
+    __m128i x = crc_clmul_fold(
+        _mm512_extracti32x4_epi32(y, 0),
+        _mm512_extracti32x4_epi32(y, 1),
+        k128);
+    x = crc_clmul_fold(x, _mm512_extracti32x4_epi32(y, 2), k128);
+    x = crc_clmul_fold(x, _mm512_extracti32x4_epi32(y, 3), k128);
+
+    return crc_clmul_finish(x, p, size, c, tail);
+}
+
+u32 crc32_avx512(const void * const restrict data, size_t size, u32 crc)
+{
+    return internal_crc_avx512(data, size, crc, &CRC32_CLMUL, crc32_table);
+}
+
+u32 crc32c_avx512(const void * const restrict data, size_t size, u32 crc)
+{
+    return internal_crc_avx512(data, size, crc, &CRC32C_CLMUL, crc32c_table);
+}
+
+#endif
@@ -0,0 +1,154 @@
+#include "crc_clmul.h"
+
+#if defined(__PCLMUL__)
+
+// Calculate a reflected 32-bit CRC by folding four 128-bit lanes
+static u32 internal_crc_clmul(
+    const void * const restrict data,
+    size_t size,
+    u32 crc,
+    const crc_clmul_consts * const restrict c,
+    crc_kernel_t tail)
+{
+    const u8 * restrict p = (const u8 *) data;
+
+    if (size < 64)
+    {
+        return tail(p, size, crc);
+    }
+
+    // Load first 64-byte block and inject initial CRC state
+    __m128i x0 = _mm_loadu_si128((const __m128i *) (p + 0));
+    __m128i x1 = _mm_loadu_si128((const __m128i *) (p + 16));
+    __m128i x2 = _mm_loadu_si128((const __m128i *) (p + 32));
+    __m128i x3 = _mm_loadu_si128((const __m128i *) (p + 48));
+    x0 = _mm_xor_si128(x0, _mm_cvtsi32_si128((int) ~crc));
+
+    p += 64;
+    size -= 64;
+
+    // Fold 64-byte blocks
+    const __m128i k512 = crc_clmul_load(c->fold512);
+    while (size >= 64)
+    {
+        x0 = crc_clmul_fold(x0, _mm_loadu_si128((const __m128i *) (p + 0)), k512);
+        x1 = crc_clmul_fold(x1, _mm_loadu_si128((const __m128i *) (p + 16)), k512);
+        x2 = crc_clmul_fold(x2, _mm_loadu_si128((const __m128i *) (p + 32)), k512);
+        x3 = crc_clmul_fold(x3, _mm_loadu_si128((const __m128i *) (p + 48)), k512);
+
+        p += 64;
+        size -= 64;
+    }
+
+    // Fold lanes together (512 -> 128 bits)
+    const __m128i k128 = crc_clmul_load(c->fold128);
+    __m128i x = crc_clmul_fold(x0, x1, k128);
+    x = crc_clmul_fold(x, x2, k128);
+    x = crc_clmul_fold(x, x3, k128);
+
+    return crc_clmul_finish(x, p, size, c, tail);
+}
+
+u32 crc32_clmul(const void * const restrict data, size_t size, u32 crc)
+{
+    return internal_crc_clmul(data, size, crc, &CRC32_CLMUL, crc32_table);
+}
+
+u32 crc32c_clmul(const void * const restrict data, size_t size, u32 crc)
+{
+    return internal_crc_clmul(data, size, crc, &CRC32C_CLMUL, crc32c_table);
+}
+
+#if defined(__SSSE3__)
+
+#include <tmmintrin.h>
+
+// Load a 16-byte block of model data.
+// Normal models are byte-reversed so register bits follow polynomial degree.
+static inline __m128i crc_model_load(const u8 * const restrict p, __m128i swap, bool reflect)
+{
+    const __m128i x = _mm_loadu_si128((const __m128i *) p);
+    return reflect ? x : _mm_shuffle_epi8(x, swap);
+}
+
+// Advance a model register by folding four 128-bit lanes
+static inline u64 internal_crc_model_clmul(
+    const crc_model * const restrict model,
+    u64 reg,
+    const u8 * restrict p,
+    size_t size,
+    const bool reflect)
+{
+    const crc_clmul_consts * const restrict c = model->clmul;
+    const __m128i swap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+    // Load first 64-byte block and inject initial register
+    __m128i x0 = crc_model_load(p + 0, swap, reflect);
+    __m128i x1 = crc_model_load(p + 16, swap, reflect);
+    __m128i x2 = crc_model_load(p + 32, swap, reflect);
+    __m128i x3 = crc_model_load(p + 48, swap, reflect);
+    x0 = _mm_xor_si128(x0, reflect ?
+        _mm_set_epi64x(0, (long long) reg) :
+        _mm_set_epi64x((long long) reg, 0));
+
+    p += 64;
+    size -= 64;
+
+    // Fold 64-byte blocks
+    const __m128i k512 = crc_clmul_load(c->fold512);
+    while (size >= 64)
+    {
+        x0 = crc_clmul_fold(x0, crc_model_load(p + 0, swap, reflect), k512);
+        x1 = crc_clmul_fold(x1, crc_model_load(p + 16, swap, reflect), k512);
+        x2 = crc_clmul_fold(x2, crc_model_load(p + 32, swap, reflect), k512);
+        x3 = crc_clmul_fold(x3, crc_model_load(p + 48, swap, reflect), k512);
+
+        p += 64;
+        size -= 64;
+    }
+
+    // Fold lanes together (512 -> 128 bits)
+    const __m128i k128 = crc_clmul_load(c->fold128);
+    __m128i x = crc_clmul_fold(x0, x1, k128);
+    x = crc_clmul_fold(x, x2, k128);
+    x = crc_clmul_fold(x, x3, k128);
+
+    // Fold remaining 16-byte blocks
+    while (size >= 16)
+    {
+        x = crc_clmul_fold(x, crc_model_load(p, swap, reflect), k128);
+
+        p += 16;
+        size -= 16;
+    }
+
+    // The folded state is a 16-byte message with the same CRC as everything
+    // consumed so far, so finish it and the tail with the slicing tables
+    u8 block[16];
+    _mm_storeu_si128((__m128i *) block, reflect ? x : _mm_shuffle_epi8(x, swap));
+
+    reg = crc_model_slice(model, 0, block, sizeof(block));
+    return crc_model_slice(model, reg, p, size);
+}
+
+u64 crc_model_clmul(
+    const crc_model * const restrict model,
+    u64 reg,
+    const void * const restrict data,
+    size_t size)
+{
+    const u8 * const restrict p = (const u8 *) data;
+
+    if (size < 64)
+    {
+        return crc_model_slice(model, reg, p, size);
+    }
+
+    return model->reflect ?
+        internal_crc_model_clmul(model, reg, p, size, true) :
+        internal_crc_model_clmul(model, reg, p, size, false);
+}
+
+#endif
+
+#endif
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "crc_internal.h"
+
+#if defined(__PCLMUL__)
+
+#include <emmintrin.h>
+#include <wmmintrin.h>
+
+// Load a pair of folding constants
+static inline __m128i crc_clmul_load(const u64 k[static 2])
+{
+    return _mm_set_epi64x((long long) k[1], (long long) k[0]);
+}
+
+// Fold 128 bits of CRC state forward into the next 128 bits of data
+static inline __m128i crc_clmul_fold(__m128i x, __m128i data, __m128i k)
+{
+    const __m128i lo = _mm_clmulepi64_si128(x, k, 0x00);
+    const __m128i hi = _mm_clmulepi64_si128(x, k, 0x11);
+
+    return _mm_xor_si128(_mm_xor_si128(lo, hi), data);
+}
+
+// Reduce 128 bits of folded state to a 32-bit CRC state
+static inline u32 crc_clmul_reduce(__m128i x, const crc_clmul_consts * const restrict c)
+{
+    const __m128i k = crc_clmul_load(c->reduce);
+
+    // Fold the low 64 bits into the upper 96 bits (128 -> 96 bits)
+    __m128i y = _mm_clmulepi64_si128(x, k, 0x00);
+    y = _mm_xor_si128(y, _mm_slli_si128(_mm_srli_si128(x, 8), 4));
+    y = _mm_srli_si128(y, 4);
+
+    // Fold the low 32 bits into the upper 64 bits (96 -> 64 bits)
+    const __m128i t = _mm_clmulepi64_si128(_mm_cvtsi32_si128(_mm_cvtsi128_si32(y)), k, 0x10);
+    const u64 z = (u64) _mm_cvtsi128_si64(_mm_xor_si128(t, _mm_srli_si128(y, 4)));
+
+    // Barrett reduction (64 -> 32 bits)
+    const __m128i b = crc_clmul_load(c->barrett);
+    const __m128i zh = _mm_cvtsi64_si128((long long) (z & U64_C(0xFFFFFFFF)));
+    __m128i q = _mm_clmulepi64_si128(zh, b, 0x00);
+    q = _mm_and_si128(q, _mm_cvtsi64_si128((long long) U64_C(0x7FFFFFFF80000000)));
+    const __m128i qp = _mm_clmulepi64_si128(q, b, 0x10);
+
+    return (u32) (z >> 32) ^ (u32) ((u64) _mm_cvtsi128_si64(_mm_unpackhi_epi64(qp, qp)) >> 30);
+}
+
+// Fold remaining 16-byte blocks, reduce, and finish the tail with the
+// slicing tables. Returns the (non-inverted) CRC value.
+static inline u32 crc_clmul_finish(
+    __m128i x,
+    const u8 * restrict p,
+    size_t size,
+    const crc_clmul_consts * const restrict c,
+    crc_kernel_t tail)
+{
+    const __m128i k = crc_clmul_load(c->fold128);
+
+    while (size >= 16)
+    {
+        x = crc_clmul_fold(x, _mm_loadu_si128((const __m128i *) p), k);
+
+        p += 16;
+        size -= 16;
+    }
+
+    return tail(p, size, ~crc_clmul_reduce(x, c));
+}
+
+#endif
@@ -0,0 +1,344 @@
+// CRC table generator.
+//
+// Emits the slicing tables and folding constants for every model listed in
+// crc_models.h as C source on standard output. Runs on the build host as
+// part of the build so no table is ever pasted into the tree by hand.
+
+#include <stdio.h>
+#include <stdbool.h>
+
+#include "util.h"
+
+typedef struct crc_gen_model
+{
+    const char* id;
+    const char* name;
+    unsigned width;
+    bool reflect;
+    u64 poly;
+    u64 init;
+    u64 xorout;
+    u64 check;
+} crc_gen_model;
+
+static const crc_gen_model MODELS[] =
+{
+#define CRC_MODEL(id, name, width, reflect, poly, init, xorout, check, kernel) \
+    { #id, name, width, reflect, U64_C(poly), U64_C(init), U64_C(xorout), U64_C(check) },
+#include "crc_models.h"
+#undef CRC_MODEL
+};
+
+// Mask of the low `width` bits
+static u64 gen_mask(unsigned width)
+{
+    return width >= 64 ? ~U64_C(0) : (U64_C(1) << width) - 1;
+}
+
+// Reverse the low `width` bits of `value`
+static u64 gen_reflect(u64 value, unsigned width)
+{
+    u64 r = 0;
+
+    for (unsigned i = 0; i < width; i++)
+    {
+        r = (r << 1) | ((value >> i) & 1);
+    }
+
+    return r;
+}
+
+// Multiply two polynomials modulo P (normal form, degree < width)
+static u64 gen_mulmodp(u64 a, u64 b, const crc_gen_model * const m)
+{
+    const u64 top = U64_C(1) << (m->width - 1);
+    u64 p = 0;
+
+    for (unsigned i = 0; i < m->width; i++)
+    {
+        if (a & 1)
+        {
+            p ^= b;
+        }
+
+        a >>= 1;
+        b = (b & top) ? ((b << 1) ^ m->poly) & gen_mask(m->width) : b << 1;
+    }
+
+    return p;
+}
+
+// Calculate x^n mod P (normal form)
+static u64 gen_xnmodp(u64 n, const crc_gen_model * const m)
+{
+    u64 p = 1;
+    u64 x = 2;
+
+    for (; n != 0; n >>= 1)
+    {
+        if (n & 1)
+        {
+            p = gen_mulmodp(p, x, m);
+        }
+
+        x = gen_mulmodp(x, x, m);
+    }
+
+    return p;
+}
+
+// Calculate floor(x^64 / P) for a 32-bit polynomial (Barrett constant)
+static u64 gen_barrett32(const crc_gen_model * const m)
+{
+    const u64 p = (U64_C(1) << 32) | m->poly;
+    u64 q = 0;
+    u64 r = 0;
+
+    // Long division of x^64, one dividend bit at a time
+    for (int i = 64; i >= 0; i--)
+    {
+        r = (r << 1) | (i == 64);
+        q <<= 1;
+
+        if (r & (U64_C(1) << 32))
+        {
+            r ^= p;
+            q |= 1;
+        }
+    }
+
+    return q;
+}
+
+// Calculate one byte table entry for a model register.
+// Reflected registers are right aligned, normal registers are left aligned
+// in 64 bits so a single slicing kernel serves every width.
+static u64 gen_byte(u64 byte, const crc_gen_model * const m)
+{
+    if (m->reflect)
+    {
+        const u64 poly = gen_reflect(m->poly, m->width);
+        u64 c = byte;
+
+        for (int i = 0; i < 8; i++)
+        {
+            c = (c & 1) ? (c >> 1) ^ poly : c >> 1;
+        }
+
+        return c;
+    }
+    else
+    {
+        const u64 poly = m->poly << (64 - m->width);
+        u64 c = byte << 56;
+
+        for (int i = 0; i < 8; i++)
+        {
+            c = (c >> 63) ? (c << 1) ^ poly : c << 1;
+        }
+
+        return c;
+    }
+}
+
+// Calculate the model check value bit by bit
+static u64 gen_check(const crc_gen_model * const m)
+{
+    const char* s = "123456789";
+    const u64 top = U64_C(1) << (m->width - 1);
+    u64 reg = m->init;
+
+    for (; *s; s++)
+    {
+        u64 byte = (u8) *s;
+
+        if (m->reflect)
+        {
+            byte = gen_reflect(byte, 8);
+        }
+
+        for (int i = 7; i >= 0; i--)
+        {
+            const u64 bit = ((byte >> i) & 1) ^ ((reg & top) ? 1 : 0);
+            reg = (reg << 1) & gen_mask(m->width);
+
+            if (bit)
+            {
+                reg ^= m->poly;
+            }
+        }
+    }
+
+    if (m->reflect)
+    {
+        reg = gen_reflect(reg, m->width);
+    }
+
+    return reg ^ m->xorout;
+}
+
+// Print a table of 32-bit or 64-bit entries, four per line
+static void gen_print_row(const u64 * const row, size_t count, unsigned width, const char* indent)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        if (i % 4 == 0)
+        {
+            printf("%s", indent);
+        }
+
+        if (width == 32)
+        {
+            printf("0x%08llX,", (unsigned long long) row[i]);
+        }
+        else
+        {
+            printf("U64_C(0x%016llX),", (unsigned long long) row[i]);
+        }
+
+        printf(i % 4 == 3 ? "\n" : " ");
+    }
+}
+
+// Print a pair of folding constants for a fold distance of `d` bits
+static void gen_print_fold(const char* field, u64 d, const crc_gen_model * const m)
+{
+    u64 lo;
+    u64 hi;
+
+    if (m->reflect)
+    {
+        lo = gen_reflect(gen_xnmodp(d + 63, m), 64);
+        hi = gen_reflect(gen_xnmodp(d - 1, m), 64);
+    }
+    else
+    {
+        lo = gen_xnmodp(d, m);
+        hi = gen_xnmodp(d + 64, m);
+    }
+
+    printf("    .%s = { U64_C(0x%016llX), U64_C(0x%016llX) },\n",
+        field, (unsigned long long) lo, (unsigned long long) hi);
+}
+
+static void gen_model(const crc_gen_model * const m)
+{
+    static u64 table[16][256];
+
+    const bool crc32 = m->reflect && m->width == 32;
+    const size_t rows = crc32 ? 16 : 8;
+
+    // Row 0 is the classic byte-at-a-time table and row k holds the CRC
+    // contribution of a byte followed by k zero bytes
+    for (size_t b = 0; b < 256; b++)
+    {
+        table[0][b] = gen_byte(b, m);
+    }
+
+    for (size_t k = 1; k < 16; k++)
+    {
+        for (size_t b = 0; b < 256; b++)
+        {
+            const u64 c = table[k - 1][b];
+
+            table[k][b] = m->reflect ?
+                (c >> 8) ^ table[0][c & 0xFF] :
+                (c << 8) ^ table[0][c >> 56];
+        }
+    }
+
+    printf("\n// %s slicing tables (generic engine)\n", m->name);
+    printf("const u64 %s_SLICE64_TABLE[8][256] =\n{\n", m->id);
+    for (size_t k = 0; k < 8; k++)
+    {
+        printf("    {\n");
+        gen_print_row(table[k], 256, 64, "        ");
+        printf("    },\n");
+    }
+    printf("};\n");
+
+    // Reflected 32-bit models also get the dedicated engine tables
+    if (crc32)
+    {
+        u64 x2n[64];
+
+        printf("\n// %s table\n", m->name);
+        printf("const u32 %s_TABLE[256] =\n{\n", m->id);
+        gen_print_row(table[0], 256, 32, "    ");
+        printf("};\n");
+
+        printf("\n// %s slicing tables\n", m->name);
+        printf("const u32 %s_SLICE_TABLE[%zu][256] =\n{\n", m->id, rows);
+        for (size_t k = 0; k < rows; k++)
+        {
+            printf("    {\n");
+            gen_print_row(table[k], 256, 32, "        ");
+            printf("    },\n");
+        }
+        printf("};\n");
+
+        for (size_t k = 0; k < 64; k++)
+        {
+            x2n[k] = gen_reflect(gen_xnmodp(U64_C(1) << k, m), 32);
+        }
+
+        printf("\n// %s powers x^(2^k) mod P (reflected)\n", m->name);
+        printf("const u32 %s_X2N_TABLE[64] =\n{\n", m->id);
+        gen_print_row(x2n, 64, 32, "    ");
+        printf("};\n");
+    }
+
+    printf("\n// %s folding constants\n", m->name);
+    printf("const crc_clmul_consts %s_CLMUL =\n{\n", m->id);
+    gen_print_fold("fold128", 128, m);
+    gen_print_fold("fold256", 256, m);
+    gen_print_fold("fold512", 512, m);
+    gen_print_fold("fold1024", 1024, m);
+    gen_print_fold("fold2048", 2048, m);
+
+    // Barrett reduction constants only apply to the 32-bit engines
+    if (crc32)
+    {
+        const u64 rp = gen_reflect((U64_C(1) << 32) | m->poly, 33);
+
+        printf("    .reduce = { U64_C(0x%016llX), U64_C(0x%016llX) },\n",
+            (unsigned long long) gen_reflect(gen_xnmodp(95, m), 64),
+            (unsigned long long) gen_reflect(gen_xnmodp(63, m), 32));
+        printf("    .barrett = { U64_C(0x%016llX), U64_C(0x%016llX) },\n",
+            (unsigned long long) gen_reflect(gen_barrett32(m), 64),
+            (unsigned long long) (rp << 31));
+    }
+
+    printf("};\n");
+}
+
+int main(void)
+{
+    for (size_t i = 0; i < ARRAY_LEN(MODELS); i++)
+    {
+        const crc_gen_model * const m = &MODELS[i];
+
+        if (m->width < 8 || m->width > 64 || (m->poly & ~gen_mask(m->width)))
+        {
+            fprintf(stderr, "[crc_gen] %s: unsupported width\n", m->name);
+            return EXIT_FAILURE;
+        }
+
+        if (gen_check(m) != m->check)
+        {
+            fprintf(stderr, "[crc_gen] %s: check value mismatch (0x%llX != 0x%llX)\n",
+                m->name, (unsigned long long) gen_check(m), (unsigned long long) m->check);
+            return EXIT_FAILURE;
+        }
+    }
+
+    printf("// Generated by crc_gen from crc_models.h. Do not edit.\n\n");
+    printf("#include \"crc_internal.h\"\n");
+
+    for (size_t i = 0; i < ARRAY_LEN(MODELS); i++)
+    {
+        gen_model(&MODELS[i]);
+    }
+
+    return EXIT_SUCCESS;
+}
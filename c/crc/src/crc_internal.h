@@ -0,0 +1,144 @@
+#pragma once
+
+#include "crc.h"
+#include "cpu.h"
+
+// CRC-32 polynomial 0x04C11DB7 (reversed form)
+#define CRC32_POLY U32_C(0xEDB88320)
+
+// CRC-32C (Castagnoli) polynomial 0x1EDC6F41 (reversed form)
+#define CRC32C_POLY U32_C(0x82F63B78)
+
+// Carry-less multiply folding constants.
+// For reflected models fold pairs are x^(d+63) mod P and x^(d-1) mod P for a
+// fold distance of d bits, bit-reversed into a 64-bit lane. For normal models
+// they are x^d mod P and x^(d+64) mod P.
+typedef struct crc_clmul_consts
+{
+    u64 fold128[2];
+    u64 fold256[2];
+    u64 fold512[2];
+    u64 fold1024[2];
+    u64 fold2048[2];
+
+    // x^95 mod P (bit-reversed, upper half) and x^63 mod P (bit-reversed)
+    // (reflected 32-bit models only)
+    u64 reduce[2];
+
+    // Barrett constants floor(x^64 / P) and P (bit-reversed, 33 bits)
+    // (reflected 32-bit models only)
+    u64 barrett[2];
+} crc_clmul_consts;
+
+// Generated tables (see crc_gen.c) for every model in crc_models.h
+#define CRC_MODEL(id, name, width, reflect, poly, init, xorout, check, kernel) \
+    extern const u64 id##_SLICE64_TABLE[8][256]; \
+    extern const crc_clmul_consts id##_CLMUL;
+#include "crc_models.h"
+#undef CRC_MODEL
+
+// CRC-32 slicing tables (16 rows of 256 entries)
+extern const u32 CRC32_SLICE_TABLE[16][256];
+
+// CRC-32C (Castagnoli) slicing tables (16 rows of 256 entries)
+extern const u32 CRC32C_SLICE_TABLE[16][256];
+
+// CRC-32 powers x^(2^k) mod P (reflected)
+extern const u32 CRC32_X2N_TABLE[64];
+
+// CRC-32C (Castagnoli) powers x^(2^k) mod P (reflected)
+extern const u32 CRC32C_X2N_TABLE[64];
+
+// Model kernel continuing the CRC value `crc` over the provided data
+u64 crc_model_update(const crc_model * restrict model, u64 crc, const void * restrict data, size_t size);
+
+// CRC-32 model kernel (dedicated engine)
+u64 crc32_model_update(const crc_model * restrict model, u64 crc, const void * restrict data, size_t size);
+
+// CRC-32C model kernel (dedicated engine)
+u64 crc32c_model_update(const crc_model * restrict model, u64 crc, const void * restrict data, size_t size);
+
+// Advance a model register over the provided data (slicing-by-8).
+// Reflected registers are right aligned and normal registers are left
+// aligned in 64 bits.
+u64 crc_model_slice(const crc_model * restrict model, u64 reg, const void * restrict data, size_t size);
+
+// Multiply two reflected polynomials modulo the reversed polynomial `poly`
+u32 crc_multmodp(u32 a, u32 b, u32 poly);
+
+// Calculate x^(8n) mod P (reflected) using a table of x^(2^k) powers
+u32 crc_x8nmodp(u64 n, const u32 x2n[static 64], u32 poly);
+
+// CRC kernel function type.
+// Continues the CRC value `crc` over `size` bytes of `data`.
+typedef u32 (*crc_kernel_t)(const void * restrict data, size_t size, u32 crc);
+
+// Calculate CRC-32 using the slicing tables
+u32 crc32_table(const void * restrict data, size_t size, u32 crc);
+
+// Calculate CRC-32C using the slicing tables
+u32 crc32c_table(const void * restrict data, size_t size, u32 crc);
+
+// Monotonic wall clock time (in seconds)
+double crc_wtime(void);
+
+// Calculate the CRC of the file at `path` with an io_uring read pipeline.
+// Returns false with errno set to ENOSYS if io_uring is unavailable.
+bool crc_uring_filepath(
+    const char * restrict path,
+    const crc_read_options * restrict options,
+    crc_kernel_t kernel,
+    u32 * restrict crc,
+    crc_read_stats * restrict stats);
+
+// Instruction set specific kernels.
+// Each is built in its own translation unit with its own target flags and
+// MUST only be called when the CPU features noted above it are available.
+
+#if CPU_X86
+// Requires CPU_FEATURE_SSE42 and CPU_FEATURE_PCLMUL
+
+// Calculate CRC-32C using the SSE4.2 crc32 instruction
+u32 crc32c_sse42(const void * restrict data, size_t size, u32 crc);
+
+// Calculate CRC-32C of many independent messages by interleaving them
+// across the crc32 instruction pipeline
+void crc32c_sse42_batch(
+    const void * const * restrict buffers,
+    const size_t * restrict sizes,
+    u32 * restrict crcs,
+    size_t count);
+#endif
+
+#if CPU_X86
+// Requires CPU_FEATURE_SSSE3 and CPU_FEATURE_PCLMUL
+
+// Calculate CRC-32 by folding with the PCLMULQDQ instruction
+u32 crc32_clmul(const void * restrict data, size_t size, u32 crc);
+
+// Calculate CRC-32C by folding with the PCLMULQDQ instruction
+u32 crc32c_clmul(const void * restrict data, size_t size, u32 crc);
+
+// Advance a model register by folding with the PCLMULQDQ instruction
+u64 crc_model_clmul(const crc_model * restrict model, u64 reg, const void * restrict data, size_t size);
+#endif
+
+#if CPU_X86
+// Requires CPU_FEATURE_AVX2 and CPU_FEATURE_VPCLMULQDQ
+
+// Calculate CRC-32 by folding with 256-bit VPCLMULQDQ instructions
+u32 crc32_avx2(const void * restrict data, size_t size, u32 crc);
+
+// Calculate CRC-32C by folding with 256-bit VPCLMULQDQ instructions
+u32 crc32c_avx2(const void * restrict data, size_t size, u32 crc);
+#endif
+
+#if CPU_X86
+// Requires CPU_FEATURE_AVX512F and CPU_FEATURE_VPCLMULQDQ
+
+// Calculate CRC-32 by folding with 512-bit VPCLMULQDQ instructions
+u32 crc32_avx512(const void * restrict data, size_t size, u32 crc);
+
+// Calculate CRC-32C by folding with 512-bit VPCLMULQDQ instructions
+u32 crc32c_avx512(const void * restrict data, size_t size, u32 crc);
+#endif
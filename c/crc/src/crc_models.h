@@ -0,0 +1,32 @@
+// CRC model catalogue (X-macro list, intentionally has no include guard).
+//
+// CRC_MODEL(id, name, width, reflect, poly, init, xorout, check, kernel)
+//
+// Parameters follow the Rocksoft/Williams model with refin == refout.
+// `poly` is in normal (non-reversed) form without the leading term and
+// `check` is the CRC of the ASCII string "123456789". Slicing tables and
+// folding constants for every entry are generated at build time.
+
+CRC_MODEL(CRC16_IBM_3740, "CRC-16/IBM-3740", 16, false,
+    0x1021, 0xFFFF, 0x0000, 0x29B1, crc_model_update)
+
+CRC_MODEL(CRC16_KERMIT, "CRC-16/KERMIT", 16, true,
+    0x1021, 0x0000, 0x0000, 0x2189, crc_model_update)
+
+CRC_MODEL(CRC32, "CRC-32/ISO-HDLC", 32, true,
+    0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, 0xCBF43926, crc32_model_update)
+
+CRC_MODEL(CRC32C, "CRC-32/ISCSI", 32, true,
+    0x1EDC6F41, 0xFFFFFFFF, 0xFFFFFFFF, 0xE3069283, crc32c_model_update)
+
+CRC_MODEL(CRC64_ECMA_182, "CRC-64/ECMA-182", 64, false,
+    0x42F0E1EBA9EA3693, 0x0000000000000000, 0x0000000000000000,
+    0x6C40DF5F0B497347, crc_model_update)
+
+CRC_MODEL(CRC64_XZ, "CRC-64/XZ", 64, true,
+    0x42F0E1EBA9EA3693, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+    0x995DC9BBDF1939FA, crc_model_update)
+
+CRC_MODEL(CRC64_NVME, "CRC-64/NVME", 64, true,
+    0xAD93D23594C93659, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+    0xAE8B14860A799888, crc_model_update)
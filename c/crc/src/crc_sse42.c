@@ -0,0 +1,271 @@
+#include "crc_internal.h"
+
+#if defined(__SSE4_2__)
+
+#include <nmmintrin.h>
+
+#if defined(__PCLMUL__)
+#include <wmmintrin.h>
+#endif
+
+// Stream length (in bytes) used for large 3-way interleaved blocks
+#define CRC32C_LONG 8192
+
+// Stream length (in bytes) used for small 3-way interleaved blocks
+#define CRC32C_SHORT 256
+
+// Number of independent messages hashed together by the batch kernel
+// (one per cycle of crc32 instruction latency)
+#define CRC32C_BATCH_LANES 3
+
+#if defined(__PCLMUL__)
+
+// Shift constants x^(8n - 33) mod P (reflected) for use with the
+// carry-less multiply followed by a crc32 instruction reduction
+#define CRC32C_LONG_SHIFT U32_C(0x54A86326)
+#define CRC32C_SHORT_SHIFT U32_C(0xB9E02B86)
+
+// Multiply CRC state by a shift constant modulo the Castagnoli polynomial
+static inline u32 crc32c_shift(u32 crc, u32 constant)
+{
+    const __m128i a = _mm_cvtsi32_si128((int) crc);
+    const __m128i b = _mm_cvtsi32_si128((int) constant);
+    const u64 product = (u64) _mm_cvtsi128_si64(_mm_clmulepi64_si128(a, b, 0x00));
+
+    return (u32) _mm_crc32_u64(0, product);
+}
+
+#else
+
+// Shift constants x^(8n) mod P (reflected) for use with the
+// bitwise polynomial multiply
+#define CRC32C_LONG_SHIFT U32_C(0x28461564)
+#define CRC32C_SHORT_SHIFT U32_C(0x88E56F72)
+
+// Multiply CRC state by a shift constant modulo the Castagnoli polynomial
+static inline u32 crc32c_shift(u32 crc, u32 constant)
+{
+    u32 product = 0;
+
+    for (size_t i = 0; i < 32; i++)
+    {
+        product ^= constant & (U32_C(0) - (crc >> 31));
+        constant = (constant >> 1) ^ (CRC32C_POLY & (U32_C(0) - (constant & 1)));
+        crc <<= 1;
+    }
+
+    return product;
+}
+
+#endif
+
+// Process a final partial block of fewer than 8 bytes
+static inline u32 crc32c_tail(const u8 * restrict p, size_t size, u32 crc)
+{
+    if (size & 4)
+    {
+        crc = _mm_crc32_u32(crc, load32(p));
+        p += 4;
+    }
+
+    if (size & 2)
+    {
+        crc = _mm_crc32_u16(crc, load16(p));
+        p += 2;
+    }
+
+    if (size & 1)
+    {
+        crc = _mm_crc32_u8(crc, *p);
+    }
+
+    return crc;
+}
+
+// Process three adjacent streams of `length` bytes in parallel
+// and merge their CRC states
+static inline u32 crc32c_interleave(
+    const u8 * const restrict p,
+    size_t length,
+    u32 crc,
+    u32 shift)
+{
+    const u8 * const end = p + length;
+    const u8 * restrict q = p;
+    u64 crc0 = crc;
+    u64 crc1 = 0;
+    u64 crc2 = 0;
+
+    // Interleave independent dependency chains to hide instruction latency
+    do
+    {
+        crc0 = _mm_crc32_u64(crc0, load64(q));
+        crc1 = _mm_crc32_u64(crc1, load64(q + length));
+        crc2 = _mm_crc32_u64(crc2, load64(q + length * 2));
+        q += 8;
+    }
+    while (q < end);
+
+    // Shift earlier stream states past later streams and combine
+    crc = crc32c_shift((u32) crc0, shift) ^ (u32) crc1;
+    crc = crc32c_shift(crc, shift) ^ (u32) crc2;
+
+    return crc;
+}
+
+u32 crc32c_sse42(const void * const restrict data, size_t size, u32 crc)
+{
+    const u8 * restrict p = (const u8 *) data;
+    crc = ~crc;
+
+    // Process leading bytes until 8-byte aligned
+    while (size > 0 && ((uintptr_t) p & 7))
+    {
+        crc = _mm_crc32_u8(crc, *p++);
+        size--;
+    }
+
+    // Process large interleaved blocks
+    while (size >= CRC32C_LONG * 3)
+    {
+        crc = crc32c_interleave(p, CRC32C_LONG, crc, CRC32C_LONG_SHIFT);
+
+        p += CRC32C_LONG * 3;
+        size -= CRC32C_LONG * 3;
+    }
+
+    // Process small interleaved blocks
+    while (size >= CRC32C_SHORT * 3)
+    {
+        crc = crc32c_interleave(p, CRC32C_SHORT, crc, CRC32C_SHORT_SHIFT);
+
+        p += CRC32C_SHORT * 3;
+        size -= CRC32C_SHORT * 3;
+    }
+
+    // Process 8-byte blocks
+    while (size >= 8)
+    {
+        crc = (u32) _mm_crc32_u64(crc, load64(p));
+
+        p += 8;
+        size -= 8;
+    }
+
+    // Process last partial block
+    crc = crc32c_tail(p, size, crc);
+
+    return ~crc;
+}
+
+// Assign the next message with at least one 8-byte word to a batch lane.
+// Messages shorter than a word are hashed immediately.
+static inline bool crc32c_batch_refill(
+    const void * const * const restrict buffers,
+    const size_t * const restrict sizes,
+    u32 * const restrict crcs,
+    size_t count,
+    size_t * const restrict next,
+    const u8 ** const restrict p,
+    size_t * const restrict words,
+    size_t * const restrict index,
+    u64 * const restrict crc)
+{
+    while (*next < count)
+    {
+        const size_t i = (*next)++;
+
+        if (sizes[i] < 8)
+        {
+            crcs[i] = ~crc32c_tail((const u8 *) buffers[i], sizes[i], U32_C(0xFFFFFFFF));
+            continue;
+        }
+
+        *p = (const u8 *) buffers[i];
+        *words = sizes[i] / 8;
+        *index = i;
+        *crc = U32_C(0xFFFFFFFF);
+
+        return true;
+    }
+
+    return false;
+}
+
+void crc32c_sse42_batch(
+    const void * const * const restrict buffers,
+    const size_t * const restrict sizes,
+    u32 * const restrict crcs,
+    size_t count)
+{
+    const u8 * p[CRC32C_BATCH_LANES];
+    size_t words[CRC32C_BATCH_LANES];
+    size_t index[CRC32C_BATCH_LANES];
+    u64 crc[CRC32C_BATCH_LANES];
+    size_t next = 0;
+    size_t active = 0;
+
+    // Assign one message to each lane (SIZE_MAX words marks an empty lane)
+    for (size_t k = 0; k < CRC32C_BATCH_LANES; k++)
+    {
+        if (crc32c_batch_refill(buffers, sizes, crcs, count, &next,
+            p + k, words + k, index + k, crc + k))
+        {
+            active++;
+        }
+        else
+        {
+            words[k] = SIZE_MAX;
+        }
+    }
+
+    // Step every lane one word at a time while all lanes are busy
+    while (active == CRC32C_BATCH_LANES)
+    {
+        bool retire = false;
+
+        // Interleave independent lanes to hide instruction latency
+        for (size_t k = 0; k < CRC32C_BATCH_LANES; k++)
+        {
+            crc[k] = _mm_crc32_u64(crc[k], load64(p[k]));
+            p[k] += 8;
+            retire |= --words[k] == 0;
+        }
+
+        if (!retire)
+        {
+            continue;
+        }
+
+        // Finish lanes out of full words and refill them with new messages
+        for (size_t k = 0; k < CRC32C_BATCH_LANES; k++)
+        {
+            if (words[k] != 0)
+            {
+                continue;
+            }
+
+            const size_t i = index[k];
+            crcs[i] = ~crc32c_tail(p[k], sizes[i] % 8, (u32) crc[k]);
+
+            if (!crc32c_batch_refill(buffers, sizes, crcs, count, &next,
+                p + k, words + k, index + k, crc + k))
+            {
+                words[k] = SIZE_MAX;
+                active--;
+            }
+        }
+    }
+
+    // Finish lanes still in flight one message at a time
+    for (size_t k = 0; k < CRC32C_BATCH_LANES; k++)
+    {
+        if (words[k] != SIZE_MAX)
+        {
+            const size_t i = index[k];
+            crcs[i] = crc32c_sse42(p[k], words[k] * 8 + sizes[i] % 8, ~(u32) crc[k]);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,467 @@
+#define _GNU_SOURCE
+#define _FILE_OFFSET_BITS 64
+
+#include <stdbool.h>
+#include <errno.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include "crc_internal.h"
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define CRC_HAVE_URING 1
+#endif
+#endif
+
+#if defined(CRC_HAVE_URING)
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+
+// Default number of reads kept in flight
+#define CRC_URING_QUEUE_DEPTH 8
+
+// Default size (in bytes) of each read request
+#define CRC_URING_BLOCK_SIZE (512 << 10)
+
+// Buffer, offset, and size alignment required for O_DIRECT reads
+#define CRC_URING_ALIGNMENT 4096
+
+// Minimal io_uring instance mapped without liburing
+typedef struct crc_uring
+{
+    int fd;
+    unsigned pending;
+
+    // Reads queued or in flight whose completion was not reaped yet
+    unsigned inflight;
+
+    // Submission queue
+    unsigned* sq_head;
+    unsigned* sq_tail;
+    unsigned* sq_mask;
+    unsigned* sq_array;
+    struct io_uring_sqe* sqes;
+
+    // Completion queue
+    unsigned* cq_head;
+    unsigned* cq_tail;
+    unsigned* cq_mask;
+    struct io_uring_cqe* cqes;
+
+    // Ring mappings
+    void* sq_ring;
+    void* cq_ring;
+    size_t sq_ring_size;
+    size_t cq_ring_size;
+    size_t sqes_size;
+} crc_uring;
+
+// Read buffer slot in the pipeline
+typedef struct crc_uring_slot
+{
+    u8* buffer;
+    u64 offset;
+    size_t size;
+    size_t filled;
+    size_t start;
+    int error;
+    bool ready;
+} crc_uring_slot;
+
+static void crc_uring_exit(crc_uring * const restrict ring)
+{
+    if (ring->sqes != NULL && ring->sqes != MAP_FAILED)
+    {
+        munmap(ring->sqes, ring->sqes_size);
+    }
+
+    if (ring->cq_ring != NULL && ring->cq_ring != MAP_FAILED && ring->cq_ring != ring->sq_ring)
+    {
+        munmap(ring->cq_ring, ring->cq_ring_size);
+    }
+
+    if (ring->sq_ring != NULL && ring->sq_ring != MAP_FAILED)
+    {
+        munmap(ring->sq_ring, ring->sq_ring_size);
+    }
+
+    if (ring->fd >= 0)
+    {
+        close(ring->fd);
+    }
+}
+
+static bool crc_uring_init(crc_uring * const restrict ring, unsigned entries)
+{
+    struct io_uring_params params;
+
+    memset(ring, 0, sizeof(*ring));
+    memset(&params, 0, sizeof(params));
+
+    ring->fd = (int) syscall(__NR_io_uring_setup, entries, &params);
+    if (ring->fd < 0)
+    {
+        return false;
+    }
+
+    // Map submission and completion rings (shared with IORING_FEAT_SINGLE_MMAP)
+    ring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        ring->sq_ring_size = MAX(ring->sq_ring_size, ring->cq_ring_size);
+        ring->cq_ring_size = ring->sq_ring_size;
+    }
+
+    ring->sq_ring = mmap(NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+
+    if (ring->sq_ring == MAP_FAILED)
+    {
+        goto error;
+    }
+
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        ring->cq_ring = ring->sq_ring;
+    }
+    else
+    {
+        ring->cq_ring = mmap(NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_CQ_RING);
+
+        if (ring->cq_ring == MAP_FAILED)
+        {
+            goto error;
+        }
+    }
+
+    ring->sqes = (struct io_uring_sqe*) mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQES);
+
+    if (ring->sqes == MAP_FAILED)
+    {
+        goto error;
+    }
+
+    ring->sq_head = (unsigned*) OFFSET_PTR(ring->sq_ring, params.sq_off.head);
+    ring->sq_tail = (unsigned*) OFFSET_PTR(ring->sq_ring, params.sq_off.tail);
+    ring->sq_mask = (unsigned*) OFFSET_PTR(ring->sq_ring, params.sq_off.ring_mask);
+    ring->sq_array = (unsigned*) OFFSET_PTR(ring->sq_ring, params.sq_off.array);
+
+    ring->cq_head = (unsigned*) OFFSET_PTR(ring->cq_ring, params.cq_off.head);
+    ring->cq_tail = (unsigned*) OFFSET_PTR(ring->cq_ring, params.cq_off.tail);
+    ring->cq_mask = (unsigned*) OFFSET_PTR(ring->cq_ring, params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe*) OFFSET_PTR(ring->cq_ring, params.cq_off.cqes);
+
+    return true;
+
+error:
+    {
+        const int error = errno;
+        crc_uring_exit(ring);
+        errno = error;
+    }
+
+    return false;
+}
+
+// Queue a read of the unfilled part of a slot.
+// Reads resume from an aligned position so short reads of O_DIRECT files
+// are requeued with a valid buffer, offset, and size.
+static void crc_uring_read(
+    crc_uring * const restrict ring,
+    int fd,
+    crc_uring_slot * const restrict slot,
+    u64 index,
+    size_t request)
+{
+    const unsigned tail = *ring->sq_tail;
+    const unsigned entry = tail & *ring->sq_mask;
+    struct io_uring_sqe * const sqe = ring->sqes + entry;
+
+    slot->start = slot->filled & ~(size_t) (CRC_URING_ALIGNMENT - 1);
+
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = IORING_OP_READ;
+    sqe->fd = fd;
+    sqe->addr = (u64) (uintptr_t) (slot->buffer + slot->start);
+    sqe->len = (u32) (request - slot->start);
+    sqe->off = slot->offset + slot->start;
+    sqe->user_data = index;
+
+    ring->sq_array[entry] = entry;
+    __atomic_store_n(ring->sq_tail, tail + 1, __ATOMIC_RELEASE);
+    ring->pending++;
+    ring->inflight++;
+}
+
+// Submit queued reads and optionally wait for at least one completion
+static bool crc_uring_enter(crc_uring * const restrict ring, bool wait)
+{
+    for (;;)
+    {
+        const unsigned flags = wait ? IORING_ENTER_GETEVENTS : 0;
+        const long result = syscall(__NR_io_uring_enter, ring->fd,
+            ring->pending, wait ? 1 : 0, flags, NULL, 0);
+
+        if (result >= 0)
+        {
+            ring->pending -= (unsigned) result;
+            return true;
+        }
+
+        if (errno != EINTR && errno != EAGAIN && errno != EBUSY)
+        {
+            return false;
+        }
+    }
+}
+
+// Drain completions into their slots, requeueing short reads (unless
+// `draining` reads before teardown)
+static void crc_uring_reap(
+    crc_uring * const restrict ring,
+    int fd,
+    crc_uring_slot * const restrict slots,
+    size_t request,
+    bool draining)
+{
+    unsigned head = *ring->cq_head;
+    const unsigned tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+
+    for (; head != tail; head++)
+    {
+        const struct io_uring_cqe * const cqe = ring->cqes + (head & *ring->cq_mask);
+        crc_uring_slot * const slot = slots + cqe->user_data;
+
+        ring->inflight--;
+
+        if (draining)
+        {
+            continue;
+        }
+
+        // Kernels without IORING_OP_READ (before 5.6) reject it with EINVAL,
+        // so report it like a missing io_uring to use the synchronous path
+        if (cqe->res == -EINVAL)
+        {
+            slot->error = ENOSYS;
+            slot->ready = true;
+        }
+        else if (cqe->res < 0)
+        {
+            slot->error = -cqe->res;
+            slot->ready = true;
+        }
+        else if ((size_t) cqe->res + slot->start <= slot->filled)
+        {
+            slot->error = slot->filled < slot->size ? EIO : 0;
+            slot->ready = true;
+        }
+        else
+        {
+            slot->filled = slot->start + (size_t) cqe->res;
+            slot->ready = slot->filled >= slot->size;
+
+            if (!slot->ready)
+            {
+                crc_uring_read(ring, fd, slot, cqe->user_data, request);
+            }
+        }
+    }
+
+    __atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+}
+
+bool crc_uring_filepath(
+    const char * const restrict path,
+    const crc_read_options * const restrict options,
+    crc_kernel_t kernel,
+    u32 * const restrict crc,
+    crc_read_stats * const restrict stats)
+{
+    const size_t depth = options->queue_depth ? options->queue_depth : CRC_URING_QUEUE_DEPTH;
+    size_t request = options->block_size ? options->block_size : CRC_URING_BLOCK_SIZE;
+    crc_uring_slot * restrict slots = NULL;
+    crc_uring ring;
+    struct stat sb;
+    bool success = false;
+    int fd = -1;
+    int error = 0;
+
+    // Create ring before touching the file so callers can fall back cleanly
+    if (!crc_uring_init(&ring, (unsigned) depth))
+    {
+        errno = ENOSYS;
+        return false;
+    }
+
+    // Open file (bypassing the page cache if requested and supported)
+    if (options->direct)
+    {
+        fd = open(path, O_RDONLY | O_DIRECT);
+        request = (request + CRC_URING_ALIGNMENT - 1) & ~(size_t) (CRC_URING_ALIGNMENT - 1);
+    }
+
+    if (fd < 0)
+    {
+        fd = open(path, O_RDONLY);
+    }
+
+    if (fd < 0 || fstat(fd, &sb) != 0)
+    {
+        error = errno;
+        goto exit;
+    }
+
+    // Allocate aligned read buffers
+    slots = (crc_uring_slot*) calloc(depth, sizeof(*slots));
+    if (slots == NULL)
+    {
+        error = errno;
+        goto exit;
+    }
+
+    for (size_t i = 0; i < depth; i++)
+    {
+        if (posix_memalign((void**) &slots[i].buffer, CRC_URING_ALIGNMENT, request) != 0)
+        {
+            error = ENOMEM;
+            goto exit;
+        }
+    }
+
+    const u64 size = (u64) sb.st_size;
+    const u64 blocks = (size + request - 1) / request;
+    u64 issued = 0;
+
+    // Prime the read queue
+    for (; issued < blocks && issued < depth; issued++)
+    {
+        crc_uring_slot * const slot = slots + issued;
+
+        slot->offset = issued * request;
+        slot->size = (size_t) MIN(size - slot->offset, request);
+        crc_uring_read(&ring, fd, slot, issued, request);
+    }
+
+    // Hash blocks in file order while later reads are in flight
+    for (u64 hashed = 0; hashed < blocks; hashed++)
+    {
+        const size_t index = (size_t) (hashed % depth);
+        crc_uring_slot * const slot = slots + index;
+
+        // Wait for the next block
+        const double wait_start = crc_wtime();
+        while (!slot->ready)
+        {
+            if (!crc_uring_enter(&ring, true))
+            {
+                error = errno;
+                goto exit;
+            }
+
+            crc_uring_reap(&ring, fd, slots, request, false);
+        }
+        stats->wait_time += crc_wtime() - wait_start;
+
+        if (slot->error)
+        {
+            error = slot->error;
+            goto exit;
+        }
+
+        // Hash block contents
+        const double hash_start = crc_wtime();
+        *crc = kernel(slot->buffer, slot->filled, *crc);
+        stats->hash_time += crc_wtime() - hash_start;
+        stats->bytes += slot->filled;
+
+        // Reuse slot for the next unread block
+        if (issued < blocks)
+        {
+            slot->offset = issued * request;
+            slot->size = (size_t) MIN(size - slot->offset, request);
+            slot->filled = 0;
+            slot->ready = false;
+            crc_uring_read(&ring, fd, slot, index, request);
+            issued++;
+
+            // Cached reads may complete inline during submission
+            const double submit_start = crc_wtime();
+            if (!crc_uring_enter(&ring, false))
+            {
+                error = errno;
+                goto exit;
+            }
+            stats->wait_time += crc_wtime() - submit_start;
+        }
+    }
+
+    stats->async = true;
+    success = true;
+
+exit:
+    // Closing the ring does not cancel reads the kernel already started, so
+    // wait for every outstanding read before the buffers are released
+    while (ring.inflight > 0)
+    {
+        if (!crc_uring_enter(&ring, true))
+        {
+            break;
+        }
+
+        crc_uring_reap(&ring, fd, slots, request, true);
+    }
+
+    crc_uring_exit(&ring);
+
+    // Buffers may still be written if draining failed, so leak them instead
+    if (slots != NULL && ring.inflight == 0)
+    {
+        for (size_t i = 0; i < depth; i++)
+        {
+            free(slots[i].buffer);
+        }
+
+        free(slots);
+    }
+
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+
+    errno = error;
+    return success;
+}
+
+#else
+
+bool crc_uring_filepath(
+    const char * const restrict path,
+    const crc_read_options * const restrict options,
+    crc_kernel_t kernel,
+    u32 * const restrict crc,
+    crc_read_stats * const restrict stats)
+{
+    (void) path;
+    (void) options;
+    (void) kernel;
+    (void) crc;
+    (void) stats;
+
+    errno = ENOSYS;
+    return false;
+}
+
+#endif
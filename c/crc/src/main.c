@@ -1,11 +1,82 @@
+#define _GNU_SOURCE
+
 #include <stdio.h>
 #include <stdbool.h>
+#include <errno.h>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+#include "crc_internal.h"
+
+// Buffer size to use for batch file reads
+#define CRC_BATCH_BUFFER_SIZE 65536
+
+// File hashing mode
+typedef enum crc_mode
+{
+    CRC_MODE_SERIAL,
+    CRC_MODE_PARALLEL,
+    CRC_MODE_ASYNC,
+    CRC_MODE_BATCH,
+    CRC_MODE_CHECK,
+} crc_mode;
+
+// Batch hashing state shared by all workers
+typedef struct crc_batch
+{
+    // Manifest (hash mode) or mismatch report (check mode) output
+    FILE* out;
 
-#include "crc.h"
+    // Per-thread read buffers
+    u8** buffers;
+    size_t threads;
+
+    // Statistics
+    u64 files;
+    u64 bytes;
+    u64 failures;
+    u64 mismatches;
+} crc_batch;
+
+// Manifest entry
+typedef struct crc_entry
+{
+    char* path;
+    u64 size;
+    u32 crc32;
+    u32 crc32c;
+} crc_entry;
 
-static bool crc_file(const char * const restrict path, u32 * const restrict crc)
+static bool crc_file(
+    const char * const restrict path,
+    crc_mode mode,
+    size_t threads,
+    const crc_read_options * const restrict options,
+    crc_read_stats * const restrict stats,
+    u32 * const restrict crc)
 {
-    *crc = crc32_filepath(path);
+    switch (mode)
+    {
+        case CRC_MODE_PARALLEL:
+            *crc = crc32_filepath_parallel(path, threads);
+            break;
+
+        case CRC_MODE_ASYNC:
+            *crc = crc32_filepath_async(path, options, stats);
+            break;
+
+        default:
+            *crc = crc32_filepath(path);
+            break;
+    }
 
     if (!*crc)
     {
@@ -15,24 +86,560 @@ static bool crc_file(const char * const restrict path, u32 * const restrict crc)
     return true;
 }
 
+// Get the read buffer of the calling worker
+static u8* crc_batch_buffer(const crc_batch * const restrict batch)
+{
+#if defined(_OPENMP)
+    return batch->buffers[omp_get_thread_num()];
+#else
+    return batch->buffers[0];
+#endif
+}
+
+// Calculate the CRC-32 and CRC-32C values of a file in a single pass
+static bool crc_batch_hash(
+    const char * const restrict path,
+    u8 * const restrict buffer,
+    u64 * const restrict size,
+    u32 * const restrict crc32_value,
+    u32 * const restrict crc32c_value)
+{
+    const int fd = open(path, O_RDONLY);
+    u32 a = (u32) crc_init(&CRC_MODEL_CRC32);
+    u32 b = (u32) crc_init(&CRC_MODEL_CRC32C);
+    u64 total = 0;
+
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    for (;;)
+    {
+        const ssize_t read_size = read(fd, buffer, CRC_BATCH_BUFFER_SIZE);
+
+        if (read_size < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        else if (read_size < 0)
+        {
+            const int error = errno;
+            close(fd);
+            errno = error;
+
+            return false;
+        }
+        else if (read_size == 0)
+        {
+            break;
+        }
+
+        a = (u32) crc_update(&CRC_MODEL_CRC32, a, buffer, (size_t) read_size);
+        b = (u32) crc_update(&CRC_MODEL_CRC32C, b, buffer, (size_t) read_size);
+        total += (u64) read_size;
+    }
+
+    close(fd);
+
+    *size = total;
+    *crc32_value = a;
+    *crc32c_value = b;
+
+    return true;
+}
+
+// Report a file that could not be hashed
+static void crc_batch_fail(crc_batch * const restrict batch, const char * const restrict path, int error)
+{
+    #pragma omp atomic
+    batch->failures++;
+
+    #pragma omp critical(crc_batch_output)
+    fprintf(stderr, "[crc] Failed to CRC '%s': %s\n", path, strerror(error));
+}
+
+// Hash a file and append it to the manifest (takes ownership of path)
+static void crc_batch_file(char * const restrict path, crc_batch * const restrict batch)
+{
+    u64 size = 0;
+    u32 a = 0;
+    u32 b = 0;
+
+    // Paths are stored one per line
+    if (strchr(path, '\n') != NULL)
+    {
+        crc_batch_fail(batch, path, EINVAL);
+    }
+    else if (!crc_batch_hash(path, crc_batch_buffer(batch), &size, &a, &b))
+    {
+        crc_batch_fail(batch, path, errno);
+    }
+    else
+    {
+        #pragma omp atomic
+        batch->files++;
+
+        #pragma omp atomic
+        batch->bytes += size;
+
+        #pragma omp critical(crc_batch_output)
+        fprintf(batch->out, "%08x %08x %llu %s\n", a, b, (unsigned long long) size, path);
+    }
+
+    free(path);
+}
+
+// Join a directory path and an entry name
+static char* crc_batch_join(const char * const restrict dir, const char * const restrict name)
+{
+    const size_t dir_size = strlen(dir);
+    const size_t name_size = strlen(name);
+    const bool slash = dir_size > 0 && dir[dir_size - 1] != '/';
+    char * const restrict path = (char *) malloc(dir_size + slash + name_size + 1);
+
+    if (path != NULL)
+    {
+        memcpy(path, dir, dir_size);
+        path[dir_size] = '/';
+        memcpy(path + dir_size + slash, name, name_size + 1);
+    }
+
+    return path;
+}
+
+// Recursively spawn hashing tasks for a directory (takes ownership of path)
+static void crc_batch_walk(char * const restrict path, crc_batch * const restrict batch)
+{
+    DIR * const restrict dir = opendir(path);
+    const struct dirent* entry;
+
+    if (dir == NULL)
+    {
+        crc_batch_fail(batch, path, errno);
+        free(path);
+        return;
+    }
+
+    while ((entry = readdir(dir)) != NULL)
+    {
+        if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0)
+        {
+            continue;
+        }
+
+        char* child = crc_batch_join(path, entry->d_name);
+        unsigned char type = entry->d_type;
+
+        if (child == NULL)
+        {
+            crc_batch_fail(batch, path, errno);
+            continue;
+        }
+
+        // Some file systems do not report entry types
+        if (type == DT_UNKNOWN)
+        {
+            struct stat sb;
+
+            if (lstat(child, &sb) == 0)
+            {
+                type = S_ISDIR(sb.st_mode) ? DT_DIR : S_ISREG(sb.st_mode) ? DT_REG : DT_UNKNOWN;
+            }
+        }
+
+        // Symbolic links and special files are skipped
+        if (type == DT_DIR)
+        {
+            #pragma omp task firstprivate(child)
+            crc_batch_walk(child, batch);
+        }
+        else if (type == DT_REG)
+        {
+            #pragma omp task firstprivate(child)
+            crc_batch_file(child, batch);
+        }
+        else
+        {
+            free(child);
+        }
+    }
+
+    closedir(dir);
+    free(path);
+}
+
+// Spawn hashing tasks for a command line path
+static void crc_batch_path(const char * const restrict path, crc_batch * const restrict batch)
+{
+    char* copy = strdup(path);
+    struct stat sb;
+
+    if (copy == NULL || stat(path, &sb) != 0)
+    {
+        crc_batch_fail(batch, path, errno);
+        free(copy);
+    }
+    else if (S_ISDIR(sb.st_mode))
+    {
+        #pragma omp task firstprivate(copy)
+        crc_batch_walk(copy, batch);
+    }
+    else
+    {
+        #pragma omp task firstprivate(copy)
+        crc_batch_file(copy, batch);
+    }
+}
+
+// Read all entries of a manifest file.
+// Malformed lines are skipped and counted in `malformed`.
+static bool crc_manifest_read(
+    const char * const restrict path,
+    crc_entry ** const restrict manifest,
+    size_t * const restrict count,
+    size_t * const restrict malformed)
+{
+    FILE * const restrict f = fopen(path, "r");
+    crc_entry* entries = NULL;
+    bool success = true;
+    size_t capacity = 0;
+    char* line = NULL;
+    size_t line_size = 0;
+    ssize_t length;
+    size_t number = 0;
+
+    *count = 0;
+    *malformed = 0;
+
+    if (f == NULL)
+    {
+        goto error;
+    }
+
+    while ((length = getline(&line, &line_size, f)) > 0)
+    {
+        unsigned int a;
+        unsigned int b;
+        unsigned long long size;
+        int first = 0;
+        int second = 0;
+        int offset = 0;
+
+        number++;
+
+        if (line[length - 1] == '\n')
+        {
+            line[length - 1] = '\0';
+        }
+
+        // Fields are separated by single spaces as written by crc_batch_file
+        // (leading spaces belong to the path)
+        if (sscanf(line, "%8x%n %8x%n %llu%n", &a, &first, &b, &second, &size, &offset) != 3 ||
+            first != 8 || line[first] != ' ' || second != 17 || line[second] != ' ' ||
+            line[offset] != ' ' || line[offset + 1] == '\0')
+        {
+            fprintf(stderr, "[crc] Ignoring malformed manifest line %zu of '%s'\n", number, path);
+            (*malformed)++;
+            continue;
+        }
+
+        if (*count == capacity)
+        {
+            capacity = MAX(capacity * 2, 1024);
+            crc_entry * const restrict new_entries = (crc_entry *) realloc(entries, capacity * sizeof(*entries));
+
+            if (new_entries == NULL)
+            {
+                goto error;
+            }
+
+            entries = new_entries;
+        }
+
+        crc_entry * const restrict e = entries + *count;
+        e->path = strdup(line + offset + 1);
+        e->size = (u64) size;
+        e->crc32 = (u32) a;
+        e->crc32c = (u32) b;
+
+        if (e->path == NULL)
+        {
+            goto error;
+        }
+
+        (*count)++;
+    }
+
+    if (ferror(f))
+    {
+        goto error;
+    }
+
+    goto exit;
+
+error:
+    fprintf(stderr, "[crc] Failed to read manifest '%s': %s\n", path, strerror(errno));
+
+    for (size_t i = 0; i < *count; i++)
+    {
+        free(entries[i].path);
+    }
+
+    free(entries);
+    entries = NULL;
+    *count = 0;
+    success = false;
+
+exit:
+    if (f != NULL)
+    {
+        fclose(f);
+    }
+
+    free(line);
+
+    *manifest = entries;
+    return success;
+}
+
+// Verify one manifest entry against the file on disk
+static void crc_batch_check(const crc_entry * const restrict e, crc_batch * const restrict batch)
+{
+    u64 size = 0;
+    u32 a = 0;
+    u32 b = 0;
+
+    if (!crc_batch_hash(e->path, crc_batch_buffer(batch), &size, &a, &b))
+    {
+        crc_batch_fail(batch, e->path, errno);
+        return;
+    }
+
+    #pragma omp atomic
+    batch->files++;
+
+    #pragma omp atomic
+    batch->bytes += size;
+
+    if (size != e->size || a != e->crc32 || b != e->crc32c)
+    {
+        #pragma omp atomic
+        batch->mismatches++;
+
+        #pragma omp critical(crc_batch_output)
+        fprintf(batch->out, "MISMATCH %s (size %llu, expected %llu)\n",
+            e->path, (unsigned long long) size, (unsigned long long) e->size);
+    }
+}
+
+// Hash many files (or verify a manifest) using a pool of worker threads
+static bool crc_batch_run(
+    crc_mode mode,
+    char** paths,
+    size_t count,
+    const char * const restrict outpath,
+    size_t threads)
+{
+    crc_batch batch = { 0 };
+    crc_entry* entries = NULL;
+    size_t entry_count = 0;
+    bool success = false;
+
+#if defined(_OPENMP)
+    if (threads == 0)
+    {
+        threads = (size_t) omp_get_max_threads();
+    }
+#endif
+
+    batch.threads = MAX(threads, 1);
+    batch.out = outpath != NULL ? fopen(outpath, "w") : stdout;
+    batch.buffers = (u8 **) calloc(batch.threads, sizeof(*batch.buffers));
+
+    if (batch.out == NULL || batch.buffers == NULL)
+    {
+        fprintf(stderr, "[crc] Failed to open '%s': %s\n",
+            outpath != NULL ? outpath : "output", strerror(errno));
+        goto exit;
+    }
+
+    for (size_t i = 0; i < batch.threads; i++)
+    {
+        batch.buffers[i] = (u8 *) malloc(CRC_BATCH_BUFFER_SIZE);
+
+        if (batch.buffers[i] == NULL)
+        {
+            goto exit;
+        }
+    }
+
+    if (mode == CRC_MODE_CHECK)
+    {
+        size_t malformed;
+
+        if (!crc_manifest_read(paths[0], &entries, &entry_count, &malformed))
+        {
+            goto exit;
+        }
+
+        // Unreadable entries fail the check like unreadable files
+        batch.failures += malformed;
+    }
+
+    const double start = crc_wtime();
+
+    if (mode == CRC_MODE_CHECK)
+    {
+        // Verify entries (dynamic scheduling balances uneven file sizes)
+        #pragma omp parallel for num_threads(batch.threads) schedule(dynamic, 16)
+        for (size_t i = 0; i < entry_count; i++)
+        {
+            crc_batch_check(entries + i, &batch);
+        }
+    }
+    else
+    {
+        // Walk directories and hash files as tasks
+        #pragma omp parallel num_threads(batch.threads)
+        #pragma omp single
+        for (size_t i = 0; i < count; i++)
+        {
+            crc_batch_path(paths[i], &batch);
+        }
+    }
+
+    const double elapsed = crc_wtime() - start;
+
+    fprintf(stderr, "[crc] %s %llu files (%.1f MB) in %.3f s: %.0f files/s, %.1f MB/s, %llu failed",
+        mode == CRC_MODE_CHECK ? "Checked" : "Hashed",
+        (unsigned long long) batch.files, (double) batch.bytes / 1e6, elapsed,
+        elapsed > 0.0 ? (double) batch.files / elapsed : 0.0,
+        elapsed > 0.0 ? (double) batch.bytes / elapsed / 1e6 : 0.0,
+        (unsigned long long) batch.failures);
+
+    if (mode == CRC_MODE_CHECK)
+    {
+        fprintf(stderr, ", %llu mismatched", (unsigned long long) batch.mismatches);
+    }
+
+    fprintf(stderr, "\n");
+
+    success = batch.failures == 0 && batch.mismatches == 0;
+
+exit:
+    if (batch.out != NULL && batch.out != stdout)
+    {
+        fclose(batch.out);
+    }
+
+    if (batch.buffers != NULL)
+    {
+        for (size_t i = 0; i < batch.threads; i++)
+        {
+            free(batch.buffers[i]);
+        }
+    }
+
+    free(batch.buffers);
+
+    for (size_t i = 0; i < entry_count; i++)
+    {
+        free(entries[i].path);
+    }
+
+    free(entries);
+
+    return success;
+}
+
 int main(int argc, char** argv)
 {
+    crc_read_options options = { 0 };
+    crc_read_stats stats = { 0 };
+    crc_mode mode = CRC_MODE_SERIAL;
+    const char* outpath = NULL;
+    size_t threads = 0;
     u32 crc = 0;
     bool success = true;
+    int arg = 1;
 
-    if (argc < 2)
+    // Parse options
+    while (arg < argc)
     {
-        printf("Usage: %s input_file\n", argv[0]);
+        if (arg + 1 < argc && strcmp(argv[arg], "-j") == 0)
+        {
+            threads = (size_t) strtoul(argv[arg + 1], NULL, 10);
+            mode = mode == CRC_MODE_SERIAL ? CRC_MODE_PARALLEL : mode;
+            arg += 2;
+        }
+        else if (arg + 1 < argc && strcmp(argv[arg], "-o") == 0)
+        {
+            outpath = argv[arg + 1];
+            arg += 2;
+        }
+        else if (strcmp(argv[arg], "-r") == 0)
+        {
+            mode = CRC_MODE_BATCH;
+            arg += 1;
+        }
+        else if (strcmp(argv[arg], "--check") == 0)
+        {
+            mode = CRC_MODE_CHECK;
+            arg += 1;
+        }
+        else if (arg + 1 < argc && strcmp(argv[arg], "-q") == 0)
+        {
+            options.queue_depth = (size_t) strtoul(argv[arg + 1], NULL, 10);
+            mode = CRC_MODE_ASYNC;
+            arg += 2;
+        }
+        else if (strcmp(argv[arg], "-d") == 0)
+        {
+            options.direct = true;
+            mode = CRC_MODE_ASYNC;
+            arg += 1;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    if (argc <= arg)
+    {
+        printf("Usage: %s [-j threads | -q queue_depth [-d]] input_file\n", argv[0]);
+        printf("       %s [-j threads] [-o manifest] -r path...\n", argv[0]);
+        printf("       %s [-j threads] [-o report] --check manifest\n", argv[0]);
         goto exit;
     }
 
-    const char* inpath = argv[1];
+    // Hash files in bulk or verify a manifest
+    if (mode == CRC_MODE_BATCH || mode == CRC_MODE_CHECK)
+    {
+        success = crc_batch_run(mode, argv + arg, (size_t) (argc - arg), outpath, threads);
+        goto exit;
+    }
+
+    const char* inpath = argv[arg];
 
     // CRC file
     printf("Hashing '%s' using CRC-32 hash...", inpath); fflush(stdout);
-    success = crc_file(inpath, &crc);
+    success = crc_file(inpath, mode, threads, &options, &stats, &crc);
     printf(success ? " done. %u\n" : " failed. %u\n", crc);
 
+    // Report which stage limited the asynchronous pipeline
+    if (success && mode == CRC_MODE_ASYNC && stats.elapsed > 0.0 && stats.hash_time > 0.0)
+    {
+        const double read_bandwidth = (double) stats.bytes / stats.elapsed / 1e6;
+        const double hash_bandwidth = (double) stats.bytes / stats.hash_time / 1e6;
+
+        printf("Read %.1f MB/s, hash %.1f MB/s, waited %.3f s of %.3f s (%s, %s-bound)\n",
+            read_bandwidth, hash_bandwidth, stats.wait_time, stats.elapsed,
+            stats.async ? "io_uring" : "synchronous",
+            stats.wait_time > stats.hash_time ? "read" : "hash");
+    }
+
 exit:
     return success ? EXIT_SUCCESS : EXIT_FAILURE;
 }
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "util.h"
+
+// Runtime CPU feature detection used to select kernels.
+//
+// Kernels are built in their own translation units with their own
+// instruction set flags, and each module binds function pointers to the
+// best kernel the running CPU supports. Set the CODEC_ISA environment
+// variable to scalar, sse2, sse4.2, avx2 or avx512 to cap the selection
+// (for benchmarking and testing).
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define CPU_X86 1
+#include <cpuid.h>
+#else
+#define CPU_X86 0
+#endif
+
+// CPU feature flags
+#define CPU_FEATURE_SSE2       (U32_C(1) << 0)
+#define CPU_FEATURE_SSSE3      (U32_C(1) << 1)
+#define CPU_FEATURE_SSE42      (U32_C(1) << 2)
+#define CPU_FEATURE_PCLMUL     (U32_C(1) << 3)
+#define CPU_FEATURE_AVX        (U32_C(1) << 4)
+#define CPU_FEATURE_AVX2       (U32_C(1) << 5)
+#define CPU_FEATURE_VPCLMULQDQ (U32_C(1) << 6)
+#define CPU_FEATURE_AVX512F    (U32_C(1) << 7)
+#define CPU_FEATURE_AVX512VL   (U32_C(1) << 8)
+
+// Instruction set levels accepted by the CODEC_ISA override
+#define CPU_LEVEL_SCALAR U32_C(0)
+#define CPU_LEVEL_SSE2   (CPU_LEVEL_SCALAR | CPU_FEATURE_SSE2)
+#define CPU_LEVEL_SSE42  (CPU_LEVEL_SSE2 | CPU_FEATURE_SSSE3 | CPU_FEATURE_SSE42 | CPU_FEATURE_PCLMUL)
+#define CPU_LEVEL_AVX2   (CPU_LEVEL_SSE42 | CPU_FEATURE_AVX | CPU_FEATURE_AVX2 | CPU_FEATURE_VPCLMULQDQ)
+#define CPU_LEVEL_AVX512 (CPU_LEVEL_AVX2 | CPU_FEATURE_AVX512F | CPU_FEATURE_AVX512VL)
+
+// Detect the features supported by the CPU and enabled by the OS
+static inline u32 cpu_detect(void)
+{
+    u32 features = 0;
+
+#if CPU_X86
+    unsigned int a;
+    unsigned int b;
+    unsigned int c;
+    unsigned int d;
+
+    if (!__get_cpuid(1, &a, &b, &c, &d))
+    {
+        return 0;
+    }
+
+    features |= (d & bit_SSE2) ? CPU_FEATURE_SSE2 : 0;
+    features |= (c & bit_SSSE3) ? CPU_FEATURE_SSSE3 : 0;
+    features |= (c & bit_SSE4_2) ? CPU_FEATURE_SSE42 : 0;
+    features |= (c & bit_PCLMUL) ? CPU_FEATURE_PCLMUL : 0;
+
+    // Wide register state must be enabled by the OS (XCR0)
+    u64 xcr0 = 0;
+
+    if (c & bit_OSXSAVE)
+    {
+        u32 lo;
+        u32 hi;
+
+        __asm__ volatile ("xgetbv" : "=a" (lo), "=d" (hi) : "c" (0));
+        xcr0 = ((u64) hi << 32) | lo;
+    }
+
+    const bool ymm = (xcr0 & 0x06) == 0x06;
+    const bool zmm = (xcr0 & 0xE6) == 0xE6;
+
+    features |= ((c & bit_AVX) && ymm) ? CPU_FEATURE_AVX : 0;
+
+    if (__get_cpuid_max(0, NULL) >= 7)
+    {
+        __cpuid_count(7, 0, a, b, c, d);
+
+        features |= ((b & bit_AVX2) && ymm) ? CPU_FEATURE_AVX2 : 0;
+        features |= ((c & bit_VPCLMULQDQ) && ymm) ? CPU_FEATURE_VPCLMULQDQ : 0;
+        features |= ((b & bit_AVX512F) && zmm) ? CPU_FEATURE_AVX512F : 0;
+        features |= ((b & bit_AVX512VL) && zmm) ? CPU_FEATURE_AVX512VL : 0;
+    }
+#endif
+
+    return features;
+}
+
+// Get the CPU features to select kernels with (honoring CODEC_ISA).
+// Executes cpuid, so call it once when binding kernels.
+static inline u32 cpu_features(void)
+{
+    static const struct
+    {
+        const char* name;
+        u32 level;
+    } levels[] =
+    {
+        { "scalar", CPU_LEVEL_SCALAR },
+        { "sse2", CPU_LEVEL_SSE2 },
+        { "sse4.2", CPU_LEVEL_SSE42 },
+        { "avx2", CPU_LEVEL_AVX2 },
+        { "avx512", CPU_LEVEL_AVX512 },
+    };
+
+    const u32 features = cpu_detect();
+    const char* const isa = getenv("CODEC_ISA");
+
+    if (isa != NULL)
+    {
+        for (size_t i = 0; i < ARRAY_LEN(levels); i++)
+        {
+            if (strcmp(isa, levels[i].name) == 0)
+            {
+                return features & levels[i].level;
+            }
+        }
+    }
+
+    return features;
+}
+
+// Check whether all of the `required` features are available
+static inline bool cpu_has(u32 features, u32 required)
+{
+    return (features & required) == required;
+}
@@ -4,6 +4,14 @@
 #include <string.h>
 #include <stdint.h>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
 typedef uint8_t u8;
 typedef uint16_t u16;
 typedef uint32_t u32;
@@ -22,26 +30,6 @@ typedef uint64_t u64;
 #define OFFSET_CPTR(data, offset) ((const u8*)(data) + (offset))
 #define OFFSET_PTR(data, offset) ((u8*)(data) + (offset))
 
-static inline u8 rand8(void)
-{
-    return (u8) rand();
-}
-
-static inline u16 rand16(void)
-{
-    return (u16) rand() | ((u16) rand() << 8);
-}
-
-static inline u32 rand32(void)
-{
-    return (u32) rand16() | ((u32) rand16() << 16);
-}
-
-static inline u64 rand64(void)
-{
-    return (u64) rand32() | ((u64) rand32() << 32);
-}
-
 static inline u8 rotl8(u8 value, size_t count)
 {
     count &= 7;
@@ -309,18 +297,73 @@ static inline void store64_be(void* data, u64 value)
     store64(data, value);
 }
 
-// Securely zero out memory
+// Securely zero out memory.
+// The compiler barrier keeps the (word-wide) memset from being removed as
+// a dead store before the memory is released or goes out of scope.
 static inline void memwipe(void* data, size_t size)
 {
+#if defined(__GNUC__)
+    memset(data, 0, size);
+    __asm__ __volatile__ ("" : : "r" (data) : "memory");
+#else
     volatile u8* p = (volatile u8*) data;
 
     while (size--)
     {
         *p++ = 0;
     }
+#endif
+}
+
+// Width (in bytes) of the widest vector registers enabled for the
+// including translation unit
+#if defined(__AVX512F__)
+#define UTIL_VECTOR_SIZE 64
+#elif defined(__AVX2__)
+#define UTIL_VECTOR_SIZE 32
+#elif defined(__SSE2__)
+#define UTIL_VECTOR_SIZE 16
+#else
+#define UTIL_VECTOR_SIZE 8
+#endif
+
+// Minimum size (in bytes) worth aligning the destination of memxor for
+#define UTIL_MEMXOR_ALIGN_SIZE (4 * UTIL_VECTOR_SIZE)
+
+// Xor bytes (and whole words) until dst is aligned to `align` bytes.
+// Returns the number of bytes processed.
+static inline size_t memxor_head(
+    u8* x,
+    const u8* y,
+    const u8* z,
+    size_t size,
+    size_t align)
+{
+    const size_t head = MIN((size_t) (-(uintptr_t) x & (align - 1)), size);
+    size_t i = 0;
+
+    for (; i < head && ((uintptr_t) (x + i) & 7); i++)
+    {
+        x[i] = y[i] ^ z[i];
+    }
+
+    for (; i + 8 <= head; i += 8)
+    {
+        store64(x + i, load64(y + i) ^ load64(z + i));
+    }
+
+    for (; i < head; i++)
+    {
+        x[i] = y[i] ^ z[i];
+    }
+
+    return head;
 }
 
-// Xor blocks of memory storing the result in dst
+// Xor blocks of memory storing the result in dst (which may alias either
+// source). Uses the widest vector registers enabled for the including
+// translation unit (SSE2 on any x86-64 build) and aligns the destination
+// of larger blocks first.
 static inline void memxor(
     void* dst,
     const void* src1,
@@ -330,53 +373,150 @@ static inline void memxor(
     u8* x = (u8*) dst;
     const u8* y = (const u8*) src1;
     const u8* z = (const u8*) src2;
+    size_t i = 0;
 
-    // Hoping the compiler chooses SIMD instructions (use -O3)
-    while (size--)
+    if (size >= UTIL_MEMXOR_ALIGN_SIZE)
+    {
+        i = memxor_head(x, y, z, size, UTIL_VECTOR_SIZE);
+    }
+
+#if defined(__AVX512F__)
+    for (; i + 64 <= size; i += 64)
+    {
+        const __m512i a = _mm512_loadu_si512((const void*) (y + i));
+        const __m512i b = _mm512_loadu_si512((const void*) (z + i));
+        _mm512_storeu_si512((void*) (x + i), _mm512_xor_si512(a, b));
+    }
+#endif
+
+#if defined(__AVX2__)
+    for (; i + 32 <= size; i += 32)
+    {
+        const __m256i a = _mm256_loadu_si256((const __m256i*) (y + i));
+        const __m256i b = _mm256_loadu_si256((const __m256i*) (z + i));
+        _mm256_storeu_si256((__m256i*) (x + i), _mm256_xor_si256(a, b));
+    }
+#endif
+
+#if defined(__SSE2__)
+    for (; i + 16 <= size; i += 16)
+    {
+        const __m128i a = _mm_loadu_si128((const __m128i*) (y + i));
+        const __m128i b = _mm_loadu_si128((const __m128i*) (z + i));
+        _mm_storeu_si128((__m128i*) (x + i), _mm_xor_si128(a, b));
+    }
+#endif
+
+    for (; i + 8 <= size; i += 8)
+    {
+        store64(x + i, load64(y + i) ^ load64(z + i));
+    }
+
+    for (; i < size; i++)
     {
-        *x++ = *y++ ^ *z++;
+        x[i] = y[i] ^ z[i];
     }
 }
 
-// Fills memory with pseudo-random bytes (not cryptographically secure).
-// can be seeded with srand().
-static inline void memrand(void* data, size_t size)
+// Xor large blocks of memory storing the result in dst using non-temporal
+// stores, which bypass the cache for output that is not read back soon.
+// Falls back to memxor without SSE2.
+static inline void memxor_stream(
+    void* dst,
+    const void* src1,
+    const void* src2,
+    size_t size)
 {
-    u8* p = (u8*) data;
+#if defined(__SSE2__)
+    u8* x = (u8*) dst;
+    const u8* y = (const u8*) src1;
+    const u8* z = (const u8*) src2;
+    size_t i = memxor_head(x, y, z, size, UTIL_VECTOR_SIZE);
 
-    while (size >= 16)
+#if defined(__AVX512F__)
+    for (; i + 64 <= size; i += 64)
+    {
+        const __m512i a = _mm512_loadu_si512((const void*) (y + i));
+        const __m512i b = _mm512_loadu_si512((const void*) (z + i));
+        _mm512_stream_si512((void*) (x + i), _mm512_xor_si512(a, b));
+    }
+#elif defined(__AVX2__)
+    for (; i + 32 <= size; i += 32)
     {
-        u8 buffer[16];
-        u8* q = buffer;
+        const __m256i a = _mm256_loadu_si256((const __m256i*) (y + i));
+        const __m256i b = _mm256_loadu_si256((const __m256i*) (z + i));
+        _mm256_stream_si256((__m256i*) (x + i), _mm256_xor_si256(a, b));
+    }
+#else
+    for (; i + 16 <= size; i += 16)
+    {
+        const __m128i a = _mm_loadu_si128((const __m128i*) (y + i));
+        const __m128i b = _mm_loadu_si128((const __m128i*) (z + i));
+        _mm_stream_si128((__m128i*) (x + i), _mm_xor_si128(a, b));
+    }
+#endif
 
-        store32_le(buffer + 0, rand32());
-        store32_le(buffer + 4, rand32());
-        store32_le(buffer + 8, rand32());
-        store32_le(buffer + 12, rand32());
+    // Order streamed stores before any later stores
+    _mm_sfence();
 
-        for (size_t i = 0; i < 16; i++)
-        {
-            *p++ = *q++;
-        }
+    memxor(x + i, y + i, z + i, size - i);
+#else
+    memxor(dst, src1, src2, size);
+#endif
+}
 
-        size -= 16;
-    }
+// Fills memory with random bytes.
+// Modules that link a cryptographically secure generator define
+// UTIL_RAND_EXTERN and provide memrand (the chacha library does).
+// Otherwise this falls back to libc rand() (not cryptographically
+// secure, can be seeded with srand()).
+#if defined(UTIL_RAND_EXTERN)
+void memrand(void* data, size_t size);
+#else
+static inline void memrand(void* data, size_t size)
+{
+    u8* p = (u8*) data;
 
+    // Fill whole words (rand() yields at least 15 random bits per call)
     while (size >= 4)
     {
-        u32 r = rand32();
-        u8* q = (u8*) &r;
-
-        for (size_t i = 0; i < 4; i++)
-        {
-            *p++ = *q++;
-        }
+        store32(p, (u32) rand() ^ ((u32) rand() << 11) ^ ((u32) rand() << 22));
 
+        p += 4;
         size -= 4;
     }
 
     while (size--)
     {
-        *p++ = rand8();
+        *p++ = (u8) rand();
     }
 }
+#endif
+
+static inline u8 rand8(void)
+{
+    u8 value;
+    memrand(&value, sizeof(value));
+    return value;
+}
+
+static inline u16 rand16(void)
+{
+    u16 value;
+    memrand(&value, sizeof(value));
+    return value;
+}
+
+static inline u32 rand32(void)
+{
+    u32 value;
+    memrand(&value, sizeof(value));
+    return value;
+}
+
+static inline u64 rand64(void)
+{
+    u64 value;
+    memrand(&value, sizeof(value));
+    return value;
+}
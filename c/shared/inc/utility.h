@@ -6,17 +6,92 @@
 #define UTIL_ALLOC malloc
 #define UTIL_DEALLOC free
 
+// Default size (in bytes) of each arena chunk
+#define UTIL_ARENA_CHUNK_SIZE (1 << 20)
+
+// Alignment (in bytes) of arena allocations
+#define UTIL_ARENA_ALIGN 16
+
+// Number of power of two size classes kept by a pool (16 B to 2 GiB)
+#define UTIL_POOL_CLASSES 28
+
+// Smallest pool size class (in bytes, as log2)
+#define UTIL_POOL_MIN_CLASS 4
+
+// Default limit (in bytes) of memory kept by each thread's buffer cache
+#define UTIL_THREAD_CACHE_SIZE (64 << 20)
+
+// Allocator backend of buffer_t.
+// dealloc receives the size that was requested from alloc.
+typedef struct _allocator_t
+{
+    void* (*alloc)(void* context, size_t size);
+    void (*dealloc)(void* context, void* data, size_t size);
+    void* context;
+} allocator_t;
+
+// Allocates with UTIL_ALLOC and releases with UTIL_DEALLOC
+extern const allocator_t UTIL_ALLOCATOR_DEFAULT;
+
+// Recycles released buffers through a pool private to each thread
+// (released when the thread exits or by buffer_cache_flush)
+extern const allocator_t UTIL_ALLOCATOR_THREAD_CACHE;
+
+// Bump arena: allocations are carved out of large chunks and only released
+// together by arena_reset (which keeps regular sized chunks for reuse)
+typedef struct _arena_chunk_t arena_chunk_t;
+
+typedef struct _arena_t
+{
+    allocator_t allocator;
+    arena_chunk_t* chunks;
+    arena_chunk_t* current;
+    size_t chunk_size;
+} arena_t;
+
+// Size-class pool: released buffers are kept in power of two size classes
+// and handed out again instead of going back to UTIL_DEALLOC
+typedef struct _pool_t
+{
+    allocator_t allocator;
+    void* free[UTIL_POOL_CLASSES];
+    size_t cached;
+    size_t max_cached;
+} pool_t;
+
 typedef struct _buffer_t
 {
     uint8_t* data;
     size_t size;
     size_t capacity;
+
+    // Allocator that owns data (NULL for UTIL_ALLOCATOR_DEFAULT)
+    const allocator_t* allocator;
 } buffer_t;
 
-#define UTIL_EMPTY_BUFFER (const buffer_t){ .data = NULL, .size = 0, .capacity = 0 }
+#define UTIL_EMPTY_BUFFER (const buffer_t){ .data = NULL, .size = 0, .capacity = 0, .allocator = NULL }
+
+void arena_init(arena_t* arena, size_t chunk_size);
+const allocator_t* arena_allocator(arena_t* arena);
+void arena_reset(arena_t* arena);
+void arena_destroy(arena_t* arena);
+
+void pool_init(pool_t* pool, size_t max_cached);
+const allocator_t* pool_allocator(pool_t* pool);
+void pool_destroy(pool_t* pool);
+
+// Select the allocator of buffers allocated by the calling thread from now
+// on (NULL selects UTIL_ALLOCATOR_DEFAULT). Existing buffers keep theirs.
+void buffer_set_allocator(const allocator_t* allocator);
+const allocator_t* buffer_get_allocator(void);
+
+// Release the memory kept by the calling thread's buffer cache
+void buffer_cache_flush(void);
 
 void buffer_init(buffer_t* buffer);
 buffer_t buffer_alloc(size_t size);
+// Allocate without zero-filling (for callers that overwrite the data)
+buffer_t buffer_alloc_uninit(size_t size);
 buffer_t buffer_copy(const void* data, size_t size);
 void buffer_reserve(buffer_t* buffer, size_t capacity);
 void buffer_shrink(buffer_t* buffer);
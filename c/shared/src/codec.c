@@ -13,12 +13,21 @@ int codec_main(int argc, char** argv, const char* codec_name,
 
     const bool decode = !strcmp(argv[1], "-d");
     const size_t extension_size = strlen(codec_extension);
+    int status = EXIT_SUCCESS;
+
+    // Buffers of each file come from an arena reset between files, so
+    // later files reuse the memory (and faulted in pages) of earlier ones
+    arena_t arena;
+    arena_init(&arena, 0);
+    buffer_set_allocator(arena_allocator(&arena));
 
     for (int i = 1 + decode; i < argc; i++)
     {
         const char* const path = argv[i];
         if (!filepath_isfile(path)) continue;
 
+        arena_reset(&arena);
+
         double diff = 0.0;
         const size_t path_size = strlen(path);
         buffer_t outpath_buffer = buffer_copy(path, path_size);
@@ -38,7 +47,8 @@ int codec_main(int argc, char** argv, const char* codec_name,
             else
             {
                 printf("%s error: attempting to encode already encoded file\n", codec_name);
-                return EXIT_FAILURE;
+                status = EXIT_FAILURE;
+                break;
             }
         }
         else
@@ -56,7 +66,8 @@ int codec_main(int argc, char** argv, const char* codec_name,
             else
             {
                 printf("%s error: attempting to decode non '%s' file\n", codec_name, codec_extension);
-                return EXIT_FAILURE;
+                status = EXIT_FAILURE;
+                break;
             }
         }
 
@@ -71,5 +82,8 @@ int codec_main(int argc, char** argv, const char* codec_name,
         buffer_dealloc(&outpath_buffer);
     }
 
-    return EXIT_SUCCESS;
+    buffer_set_allocator(NULL);
+    arena_destroy(&arena);
+
+    return status;
 }
@@ -3,27 +3,338 @@
 #include <assert.h>
 #include <stdbool.h>
 
+#include <pthread.h>
 #include <sys/stat.h>
 
 #include "utility.h"
 
+// Allocator selected for new buffers of the calling thread
+static __thread const allocator_t* buffer_allocator = NULL;
+
+// Buffer cache of the calling thread
+static __thread pool_t thread_cache;
+
+static void* default_alloc(void* context, size_t size)
+{
+    (void) context;
+    return UTIL_ALLOC(size);
+}
+
+static void default_dealloc(void* context, void* data, size_t size)
+{
+    (void) context;
+    (void) size;
+    UTIL_DEALLOC(data);
+}
+
+const allocator_t UTIL_ALLOCATOR_DEFAULT = { .alloc = default_alloc, .dealloc = default_dealloc, .context = NULL };
+
+// Arena chunk header (allocation data follows at an aligned offset)
+struct _arena_chunk_t
+{
+    arena_chunk_t* next;
+    size_t used;
+    size_t capacity;
+};
+
+#define ARENA_ALIGN_UP(x) (((x) + UTIL_ARENA_ALIGN - 1) & ~(size_t) (UTIL_ARENA_ALIGN - 1))
+#define ARENA_CHUNK_DATA(chunk) ((uint8_t*) (chunk) + ARENA_ALIGN_UP(sizeof(arena_chunk_t)))
+
+static void* arena_alloc(void* context, size_t size)
+{
+    arena_t* const arena = (arena_t*) context;
+    const size_t aligned_size = ARENA_ALIGN_UP(size);
+
+    // Oversized requests get a chunk of their own at the head of the list,
+    // out of the bump sequence (arena_reset releases them)
+    if (aligned_size > arena->chunk_size)
+    {
+        arena_chunk_t* const chunk = (arena_chunk_t*) UTIL_ALLOC(ARENA_ALIGN_UP(sizeof(arena_chunk_t)) + aligned_size);
+        if (!chunk) return NULL;
+
+        chunk->next = arena->chunks;
+        chunk->used = aligned_size;
+        chunk->capacity = aligned_size;
+        arena->chunks = chunk;
+
+        return ARENA_CHUNK_DATA(chunk);
+    }
+
+    // Bump the current chunk, moving on to chunks kept by arena_reset
+    arena_chunk_t** link = arena->current ? &arena->current : &arena->chunks;
+
+    for (; *link; link = &(*link)->next)
+    {
+        arena_chunk_t* const chunk = *link;
+
+        if (chunk->capacity - chunk->used >= aligned_size)
+        {
+            uint8_t* const data = ARENA_CHUNK_DATA(chunk) + chunk->used;
+            chunk->used += aligned_size;
+            arena->current = chunk;
+            return data;
+        }
+    }
+
+    // Append a new chunk
+    arena_chunk_t* const chunk = (arena_chunk_t*) UTIL_ALLOC(ARENA_ALIGN_UP(sizeof(arena_chunk_t)) + arena->chunk_size);
+    if (!chunk) return NULL;
+
+    chunk->next = NULL;
+    chunk->used = aligned_size;
+    chunk->capacity = arena->chunk_size;
+
+    *link = chunk;
+    arena->current = chunk;
+
+    return ARENA_CHUNK_DATA(chunk);
+}
+
+static void arena_dealloc(void* context, void* data, size_t size)
+{
+    // Released all at once by arena_reset
+    (void) context;
+    (void) data;
+    (void) size;
+}
+
+void arena_init(arena_t* arena, size_t chunk_size)
+{
+    if (!arena) return;
+
+    arena->allocator = (allocator_t){ .alloc = arena_alloc, .dealloc = arena_dealloc, .context = arena };
+    arena->chunks = NULL;
+    arena->current = NULL;
+    arena->chunk_size = chunk_size ? chunk_size : UTIL_ARENA_CHUNK_SIZE;
+}
+
+const allocator_t* arena_allocator(arena_t* arena)
+{
+    return &arena->allocator;
+}
+
+void arena_reset(arena_t* arena)
+{
+    if (!arena) return;
+
+    // Keep regular chunks (and their faulted in pages) for the next run, but
+    // release oversized ones so retained memory does not grow with the input
+    arena_chunk_t** link = &arena->chunks;
+
+    while (*link)
+    {
+        arena_chunk_t* const chunk = *link;
+
+        if (chunk->capacity > arena->chunk_size)
+        {
+            *link = chunk->next;
+            UTIL_DEALLOC(chunk);
+            continue;
+        }
+
+        chunk->used = 0;
+        link = &chunk->next;
+    }
+
+    arena->current = arena->chunks;
+}
+
+void arena_destroy(arena_t* arena)
+{
+    if (!arena) return;
+
+    arena_chunk_t* chunk = arena->chunks;
+
+    while (chunk)
+    {
+        arena_chunk_t* const next = chunk->next;
+        UTIL_DEALLOC(chunk);
+        chunk = next;
+    }
+
+    arena->chunks = NULL;
+    arena->current = NULL;
+}
+
+// Size class of an allocation (UTIL_POOL_CLASSES if too large to pool)
+static size_t pool_class(size_t size)
+{
+    size_t c = 0;
+
+    while (c < UTIL_POOL_CLASSES && ((size_t) 1 << (c + UTIL_POOL_MIN_CLASS)) < size)
+    {
+        c++;
+    }
+
+    return c;
+}
+
+static void* pool_alloc(void* context, size_t size)
+{
+    pool_t* const pool = (pool_t*) context;
+    const size_t c = pool_class(size);
+
+    if (c >= UTIL_POOL_CLASSES) return UTIL_ALLOC(size);
+
+    const size_t class_size = (size_t) 1 << (c + UTIL_POOL_MIN_CLASS);
+    void* const data = pool->free[c];
+
+    // Reuse a released buffer of the same class (free lists are threaded
+    // through the first word of each buffer)
+    if (data)
+    {
+        memcpy(&pool->free[c], data, sizeof(void*));
+        pool->cached -= class_size;
+        return data;
+    }
+
+    return UTIL_ALLOC(class_size);
+}
+
+static void pool_dealloc(void* context, void* data, size_t size)
+{
+    pool_t* const pool = (pool_t*) context;
+    const size_t c = pool_class(size);
+
+    if (!data) return;
+
+    // Release buffers that are too large or over the cache limit
+    if (c >= UTIL_POOL_CLASSES || pool->cached + ((size_t) 1 << (c + UTIL_POOL_MIN_CLASS)) > pool->max_cached)
+    {
+        UTIL_DEALLOC(data);
+        return;
+    }
+
+    memcpy(data, &pool->free[c], sizeof(void*));
+    pool->free[c] = data;
+    pool->cached += (size_t) 1 << (c + UTIL_POOL_MIN_CLASS);
+}
+
+void pool_init(pool_t* pool, size_t max_cached)
+{
+    if (!pool) return;
+
+    pool->allocator = (allocator_t){ .alloc = pool_alloc, .dealloc = pool_dealloc, .context = pool };
+    memset(pool->free, 0, sizeof(pool->free));
+    pool->cached = 0;
+    pool->max_cached = max_cached;
+}
+
+const allocator_t* pool_allocator(pool_t* pool)
+{
+    return &pool->allocator;
+}
+
+void pool_destroy(pool_t* pool)
+{
+    if (!pool) return;
+
+    for (size_t c = 0; c < UTIL_POOL_CLASSES; c++)
+    {
+        void* data = pool->free[c];
+
+        while (data)
+        {
+            void* next;
+            memcpy(&next, data, sizeof(void*));
+            UTIL_DEALLOC(data);
+            data = next;
+        }
+
+        pool->free[c] = NULL;
+    }
+
+    pool->cached = 0;
+}
+
+// Key whose destructor releases a thread's buffer cache when it exits
+static pthread_key_t thread_cache_key;
+static pthread_once_t thread_cache_once = PTHREAD_ONCE_INIT;
+
+static void thread_cache_exit(void* cache)
+{
+    pool_destroy((pool_t*) cache);
+}
+
+static void thread_cache_key_init(void)
+{
+    pthread_key_create(&thread_cache_key, thread_cache_exit);
+}
+
+static pool_t* thread_cache_get(void)
+{
+    if (!thread_cache.allocator.alloc)
+    {
+        pool_init(&thread_cache, UTIL_THREAD_CACHE_SIZE);
+        pthread_once(&thread_cache_once, thread_cache_key_init);
+        pthread_setspecific(thread_cache_key, &thread_cache);
+    }
+
+    return &thread_cache;
+}
+
+static void* thread_cache_alloc(void* context, size_t size)
+{
+    (void) context;
+    return pool_alloc(thread_cache_get(), size);
+}
+
+static void thread_cache_dealloc(void* context, void* data, size_t size)
+{
+    // Buffers released on another thread join that thread's cache
+    (void) context;
+    pool_dealloc(thread_cache_get(), data, size);
+}
+
+const allocator_t UTIL_ALLOCATOR_THREAD_CACHE = { .alloc = thread_cache_alloc, .dealloc = thread_cache_dealloc, .context = NULL };
+
+void buffer_cache_flush(void)
+{
+    pool_destroy(&thread_cache);
+}
+
+void buffer_set_allocator(const allocator_t* allocator)
+{
+    buffer_allocator = allocator == &UTIL_ALLOCATOR_DEFAULT ? NULL : allocator;
+}
+
+const allocator_t* buffer_get_allocator(void)
+{
+    return buffer_allocator ? buffer_allocator : &UTIL_ALLOCATOR_DEFAULT;
+}
+
+// Allocator that owns the data of a buffer
+static inline const allocator_t* buffer_owner(const buffer_t* buffer)
+{
+    return buffer->allocator ? buffer->allocator : &UTIL_ALLOCATOR_DEFAULT;
+}
+
 void buffer_init(buffer_t* buffer)
 {
     if (!buffer) return;
     *buffer = UTIL_EMPTY_BUFFER;
 }
 
-buffer_t buffer_alloc(size_t size)
+buffer_t buffer_alloc_uninit(size_t size)
 {
     const size_t aligned_size = align_up2(size);
-    buffer_t buffer = { .data = (uint8_t*) UTIL_ALLOC(aligned_size), .size = size, .capacity = aligned_size};
+    const allocator_t* const allocator = buffer_get_allocator();
+    buffer_t buffer = { .data = (uint8_t*) allocator->alloc(allocator->context, aligned_size), .size = size, .capacity = aligned_size, .allocator = buffer_allocator };
     assert(buffer.data != NULL);
 
     if (!buffer.data)
     {
         buffer = UTIL_EMPTY_BUFFER;
     }
-    else
+
+    return buffer;
+}
+
+buffer_t buffer_alloc(size_t size)
+{
+    buffer_t buffer = buffer_alloc_uninit(size);
+
+    if (buffer.data)
     {
         memset(buffer.data, 0, buffer.size);
     }
@@ -35,40 +346,44 @@ buffer_t buffer_copy(const void* data, size_t size)
 {
     if (!data || !size) return UTIL_EMPTY_BUFFER;
 
-    buffer_t buffer = buffer_alloc(size);
-    memcpy(buffer.data, data, size);
+    // Every byte is overwritten (no zero fill)
+    buffer_t buffer = buffer_alloc_uninit(size);
+    if (buffer.data) memcpy(buffer.data, data, size);
 
     return buffer;
 }
 
-void buffer_reserve(buffer_t* buffer, size_t capacity)
+// Move buffer data into a new allocation of `new_capacity` bytes
+static void buffer_move(buffer_t* buffer, size_t new_capacity)
 {
-    if (!buffer || capacity <= buffer->capacity) return;
-
-    const size_t new_capacity = align_up2(capacity);
-    uint8_t* const new_data = (uint8_t*) UTIL_ALLOC(new_capacity);
+    const allocator_t* const allocator = buffer_owner(buffer);
+    uint8_t* const new_data = (uint8_t*) allocator->alloc(allocator->context, new_capacity);
     assert(new_data != NULL);
 
-    memcpy(new_data, buffer->data, buffer->size);
+    if (!new_data) return;
+
+    if (buffer->size) memcpy(new_data, buffer->data, buffer->size);
+    if (buffer->data) allocator->dealloc(allocator->context, buffer->data, buffer->capacity);
 
     buffer->data = new_data;
     buffer->capacity = new_capacity;
-    UTIL_DEALLOC(buffer->data);
 }
 
-void buffer_shrink(buffer_t* buffer)
+void buffer_reserve(buffer_t* buffer, size_t capacity)
 {
-    if (!buffer || buffer->size >= (buffer->capacity / 4)) return;
+    if (!buffer || capacity <= buffer->capacity) return;
 
-    const size_t new_capacity = align_up2(buffer->size);
-    uint8_t* const new_data = (uint8_t*) UTIL_ALLOC(new_capacity);
-    assert(new_data != NULL);
+    // Buffers without data take the thread's current allocator
+    if (!buffer->data) buffer->allocator = buffer_allocator;
 
-    memcpy(new_data, buffer->data, buffer->size);
+    buffer_move(buffer, align_up2(capacity));
+}
 
-    buffer->data = new_data;
-    buffer->capacity = new_capacity;
-    UTIL_DEALLOC(buffer->data);
+void buffer_shrink(buffer_t* buffer)
+{
+    if (!buffer || buffer->size >= (buffer->capacity / 4)) return;
+
+    buffer_move(buffer, align_up2(buffer->size));
 }
 
 void buffer_resize(buffer_t* buffer, size_t new_size)
@@ -108,7 +423,8 @@ void buffer_dealloc(buffer_t* buffer)
 {
     if (!buffer) return;
 
-    UTIL_DEALLOC(buffer->data);
+    const allocator_t* const allocator = buffer_owner(buffer);
+    if (buffer->data) allocator->dealloc(allocator->context, buffer->data, buffer->capacity);
     buffer_init(buffer);
 }
 
@@ -120,7 +436,9 @@ buffer_t buffer_hex(const buffer_t buffer)
         '8', '9', 'A', 'B', 'C', 'D', 'E', 'F',
     };
 
-    buffer_t hex = buffer_alloc(buffer.size * 2 + 1);
+    // Every byte is overwritten (no zero fill)
+    buffer_t hex = buffer_alloc_uninit(buffer.size * 2 + 1);
+    if (!hex.data) return hex;
 
     for (size_t i = 0; i < buffer.size; i++)
     {
@@ -131,6 +449,8 @@ buffer_t buffer_hex(const buffer_t buffer)
         hex.data[i * 2 + 1] = nibbles[lower];
     }
 
+    hex.data[buffer.size * 2] = '\0';
+
     return hex;
 }
 